@@ -0,0 +1,194 @@
+// This file implements memory allocation for compiler objects.
+//
+// punyc never frees what it allocates individually: tokens, AST
+// nodes, types and so on live until the compilation is done. So
+// instead of calling calloc() for each of them, we carve them out
+// of large chunks of memory with a bump pointer, and release all
+// chunks at once at the end.
+//
+// All allocations also go through the counters below, so that
+// -fmem-report can show which kinds of objects, and which phases,
+// use up the memory.
+
+#include "punyc.h"
+
+bool mem_report;
+
+// Size of a regular arena chunk. Objects larger than LARGE_SIZE get
+// a chunk of their own so that they don't waste a regular one.
+enum { CHUNK_SIZE = 1 << 20 };
+enum { LARGE_SIZE = 1 << 16 };
+
+typedef struct Chunk Chunk;
+struct Chunk {
+  Chunk *next;
+  long size;
+};
+
+// Objects allocated between enter_arena() and leave_arena() are
+// kept apart from the others, so that they can be released together
+// with release_arena() while the others stay.
+struct Arena {
+  Chunk *chunks;
+  char *ptr;
+  long left;
+};
+
+static Chunk *chunks;
+static char *arena_ptr;
+static long arena_left;
+static long nr_chunks;
+static long arena_reserved;
+static long arena_used;
+
+static char *kind_name[] = {
+  "token", "hideset", "macro", "node", "type", "member", "var",
+  "var_scope", "tag_scope", "function", "initializer", "gvar_init",
+  "string", "file",
+};
+
+static long kind_allocs[NR_ALLOC_KINDS];
+static long kind_bytes[NR_ALLOC_KINDS];
+
+// The last slot is for allocations made outside of any phase.
+static long phase_allocs[NR_PHASES + 1];
+static long phase_bytes[NR_PHASES + 1];
+
+// Records an allocation of `size` bytes made elsewhere.
+void count_alloc(AllocKind kind, long size) {
+  Phase ph = current_phase();
+  kind_allocs[kind]++;
+  kind_bytes[kind] += size;
+  phase_allocs[ph]++;
+  phase_bytes[ph] += size;
+}
+
+// Clears the numbers collected so far.
+void reset_alloc_stats(void) {
+  memset(kind_allocs, 0, sizeof(kind_allocs));
+  memset(kind_bytes, 0, sizeof(kind_bytes));
+  memset(phase_allocs, 0, sizeof(phase_allocs));
+  memset(phase_bytes, 0, sizeof(phase_bytes));
+}
+
+// Returns a new zero-cleared chunk that can hold `size` bytes.
+static char *new_chunk(long size) {
+  // calloc() gets a large block directly from mmap(), which is
+  // already zero-cleared, so this doesn't touch the memory.
+  Chunk *c = calloc(1, sizeof(Chunk) + size);
+  if (!c)
+    error("out of memory");
+  c->next = chunks;
+  c->size = size;
+  chunks = c;
+  nr_chunks++;
+  arena_reserved += sizeof(Chunk) + size;
+  return (char *)(c + 1);
+}
+
+// Returns a zero-cleared memory block for an object of a given kind.
+void *alloc_obj(AllocKind kind, long size) {
+  count_alloc(kind, size);
+
+  // None of our objects need alignment stricter than 8.
+  size = (size + 7) & ~7;
+  arena_used += size;
+
+  if (size > LARGE_SIZE)
+    return new_chunk(size);
+
+  if (size > arena_left) {
+    arena_ptr = new_chunk(CHUNK_SIZE);
+    arena_left = CHUNK_SIZE;
+  }
+
+  char *p = arena_ptr;
+  arena_ptr += size;
+  arena_left -= size;
+  return p;
+}
+
+// Returns a null-terminated copy of a given string.
+char *alloc_str(char *s, long len) {
+  char *p = alloc_obj(AK_STRING, len + 1);
+  memcpy(p, s, len);
+  return p;
+}
+
+static void free_chunks(Chunk *c) {
+  while (c) {
+    Chunk *next = c->next;
+    free(c);
+    c = next;
+  }
+}
+
+// Releases all objects allocated by alloc_obj() at once.
+void free_arena(void) {
+  free_chunks(chunks);
+  chunks = NULL;
+  arena_ptr = NULL;
+  arena_left = 0;
+}
+
+// Makes alloc_obj() allocate objects from a new arena.
+Arena *enter_arena(void) {
+  Arena *arena = calloc(1, sizeof(Arena));
+  arena->chunks = chunks;
+  arena->ptr = arena_ptr;
+  arena->left = arena_left;
+  chunks = NULL;
+  arena_ptr = NULL;
+  arena_left = 0;
+  return arena;
+}
+
+// Makes alloc_obj() go back to the arena used before enter_arena().
+// The objects allocated in between are left in `arena`.
+void leave_arena(Arena *arena) {
+  Chunk *c = chunks;
+  chunks = arena->chunks;
+  arena_ptr = arena->ptr;
+  arena_left = arena->left;
+  arena->chunks = c;
+  arena->ptr = NULL;
+  arena->left = 0;
+}
+
+// Releases all objects in an arena returned by enter_arena().
+void release_arena(Arena *arena) {
+  free_chunks(arena->chunks);
+  free(arena);
+}
+
+static void print_row(char *name, long allocs, long bytes) {
+  long avg = allocs ? bytes / allocs : 0;
+  fprintf(stderr, "%-12s %12ld %14ld %8ld\n", name, allocs, bytes, avg);
+}
+
+// Prints out the report to stderr.
+void print_mem_report(char *input) {
+  long total_allocs = 0;
+  long total_bytes = 0;
+
+  fprintf(stderr, "memory report for %s\n", input);
+  fprintf(stderr, "kind               allocs          bytes  avg(B)\n");
+  for (int i = 0; i < NR_ALLOC_KINDS; i++) {
+    print_row(kind_name[i], kind_allocs[i], kind_bytes[i]);
+    total_allocs += kind_allocs[i];
+    total_bytes += kind_bytes[i];
+  }
+  print_row("total", total_allocs, total_bytes);
+
+  fprintf(stderr, "\nphase              allocs          bytes  avg(B)\n");
+  for (int i = 0; i <= NR_PHASES; i++)
+    if (phase_allocs[i])
+      print_row(phase_name(i), phase_allocs[i], phase_bytes[i]);
+
+  fprintf(stderr, "\narena: %ld chunks, %ld KiB reserved, %ld KiB used\n",
+          nr_chunks, arena_reserved / 1024, arena_used / 1024);
+
+  struct rusage ru;
+  getrusage(RUSAGE_SELF, &ru);
+  fprintf(stderr, "peak RSS: %ld KiB\n", ru.ru_maxrss);
+}
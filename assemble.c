@@ -0,0 +1,1143 @@
+// This file implements a built-in assembler for `-c`. It translates
+// the assembly text that codegen.c produces into an ELF64 relocatable
+// object file, so that we don't have to run an external assembler.
+//
+// This is not a general-purpose assembler. It understands only the
+// subset of the Intel syntax that codegen.c emits, i.e. mov, lea,
+// movsx, movzx, arithmetic and logical operations, setcc, jcc, call,
+// push, pop and a handful of data directives. Every jump is encoded
+// with a 32-bit displacement, so we don't need branch relaxation and
+// can assemble in a single pass, patching jump targets at the end.
+//
+// .file and .loc directives are ignored, so the resulting object
+// file has no line number information.
+
+#include "punyc.h"
+
+typedef struct {
+  char *data;
+  long len;
+  long cap;
+} ByteBuf;
+
+// Sections
+enum { SEC_TEXT, SEC_DATA, SEC_BSS };
+
+typedef struct Symbol Symbol;
+struct Symbol {
+  Symbol *next;
+  char *name;
+  int sec;        // -1 if undefined
+  long offset;
+  bool is_global;
+  int index;      // Index in .symtab
+};
+
+// Relocation
+typedef struct Reloc Reloc;
+struct Reloc {
+  Reloc *next;
+  long offset;
+  int type;
+  Symbol *sym;
+  long addend;
+};
+
+// A jump whose 32-bit displacement is resolved after all labels
+// are defined.
+typedef struct Fixup Fixup;
+struct Fixup {
+  Fixup *next;
+  long offset;
+  Symbol *sym;
+  char *line;
+};
+
+// Instruction operand
+typedef enum {
+  OP_REG, // Register
+  OP_MEM, // Memory reference [base+disp]
+  OP_IMM, // Immediate value
+  OP_SYM, // Symbol address or jump target
+} OperandKind;
+
+typedef struct {
+  OperandKind kind;
+  int reg;   // Register number, or the base register if OP_MEM
+  int size;  // Operand size in bytes. 0 if unknown.
+  long val;  // Immediate value or displacement
+  Symbol *sym;
+} Operand;
+
+// ELF constants
+enum {
+  R_X86_64_64 = 1,
+  R_X86_64_32S = 11,
+
+  SHT_PROGBITS = 1,
+  SHT_SYMTAB = 2,
+  SHT_STRTAB = 3,
+  SHT_RELA = 4,
+  SHT_NOBITS = 8,
+
+  SHF_WRITE = 1,
+  SHF_ALLOC = 2,
+  SHF_EXECINSTR = 4,
+  SHF_INFO_LINK = 0x40,
+
+  STB_LOCAL = 0,
+  STB_GLOBAL = 1,
+
+  STT_NOTYPE = 0,
+  STT_OBJECT = 1,
+  STT_FUNC = 2,
+  STT_SECTION = 3,
+  STT_FILE = 4,
+
+  SHN_ABS = 0xfff1,
+};
+
+// Section header
+typedef struct {
+  int name;
+  int type;
+  long flags;
+  long offset;
+  long size;
+  int link;
+  int info;
+  int align;
+  int entsize;
+} Shdr;
+
+// Section header indices
+enum {
+  SH_NULL, SH_TEXT, SH_DATA, SH_BSS, SH_RELA_TEXT, SH_RELA_DATA,
+  SH_SYMTAB, SH_STRTAB, SH_SHSTRTAB, SH_NOTE, SH_NUM,
+};
+
+static ByteBuf text;
+static ByteBuf data;
+static long bss_size;
+static int align[3];
+static int cur_sec;
+
+static HashMap symbols;
+static Symbol sym_head;
+static Symbol *sym_last = &sym_head;
+static char *source_file;
+
+static Reloc *text_relocs;
+static Reloc *data_relocs;
+static Fixup *fixups;
+
+static HashMap registers;
+
+// The current line for error messages
+static char *cur_line;
+
+static char *reg64[] = {
+  "rax", "rcx", "rdx", "rbx", "rsp", "rbp", "rsi", "rdi",
+  "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15",
+};
+
+static char *reg32[] = {
+  "eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi",
+  "r8d", "r9d", "r10d", "r11d", "r12d", "r13d", "r14d", "r15d",
+};
+
+static char *reg16[] = {
+  "ax", "cx", "dx", "bx", "sp", "bp", "si", "di",
+  "r8w", "r9w", "r10w", "r11w", "r12w", "r13w", "r14w", "r15w",
+};
+
+static char *reg8[] = {
+  "al", "cl", "dl", "bl", "spl", "bpl", "sil", "dil",
+  "r8b", "r9b", "r10b", "r11b", "r12b", "r13b", "r14b", "r15b",
+};
+
+static void asm_error(char *msg) {
+  char *end = cur_line;
+  while (*end && *end != '\n')
+    end++;
+  error("internal error: %s: %.*s", msg, (int)(end - cur_line), cur_line);
+}
+
+//
+// Output buffers
+//
+
+static void buf_reserve(ByteBuf *buf, long len) {
+  if (buf->len + len <= buf->cap)
+    return;
+  while (buf->len + len > buf->cap)
+    buf->cap = buf->cap ? buf->cap * 2 : 4096;
+  buf->data = realloc(buf->data, buf->cap);
+}
+
+static void buf_put(ByteBuf *buf, void *p, long len) {
+  buf_reserve(buf, len);
+  memcpy(buf->data + buf->len, p, len);
+  buf->len += len;
+}
+
+// Appends a little-endian integer of a given size.
+static void buf_int(ByteBuf *buf, long val, int size) {
+  char tmp[8];
+  for (int i = 0; i < size; i++)
+    tmp[i] = val >> (i * 8);
+  buf_put(buf, tmp, size);
+}
+
+static void buf_zero(ByteBuf *buf, long len) {
+  buf_reserve(buf, len);
+  memset(buf->data + buf->len, 0, len);
+  buf->len += len;
+}
+
+static void buf_align(ByteBuf *buf, int align) {
+  buf_zero(buf, align_to(buf->len, align) - buf->len);
+}
+
+static void patch32(ByteBuf *buf, long offset, long val) {
+  for (int i = 0; i < 4; i++)
+    buf->data[offset + i] = val >> (i * 8);
+}
+
+static void emit8(int val) {
+  buf_int(&text, val, 1);
+}
+
+//
+// Symbols
+//
+
+static Symbol *get_symbol(char *name, int len) {
+  Symbol *sym = hashmap_get2(&symbols, name, len);
+  if (sym)
+    return sym;
+
+  sym = calloc(1, sizeof(Symbol));
+  sym->name = strndup(name, len);
+  sym->sec = -1;
+  hashmap_put2(&symbols, sym->name, len, sym);
+  sym_last = sym_last->next = sym;
+  return sym;
+}
+
+static long cur_offset(void) {
+  if (cur_sec == SEC_TEXT)
+    return text.len;
+  if (cur_sec == SEC_DATA)
+    return data.len;
+  return bss_size;
+}
+
+static void define_symbol(char *name, int len) {
+  Symbol *sym = get_symbol(name, len);
+  if (sym->sec != -1)
+    asm_error("symbol already defined");
+  sym->sec = cur_sec;
+  sym->offset = cur_offset();
+}
+
+static bool is_local_label(Symbol *sym) {
+  return !strncmp(sym->name, ".L", 2);
+}
+
+static void add_reloc(Reloc **list, long offset, int type, Symbol *sym, long addend) {
+  Reloc *rel = calloc(1, sizeof(Reloc));
+  rel->offset = offset;
+  rel->type = type;
+  rel->sym = sym;
+  rel->addend = addend;
+  rel->next = *list;
+  *list = rel;
+}
+
+//
+// Operand parser
+//
+
+static void init_registers(void) {
+  if (registers.buckets)
+    return;
+
+  // Values are encoded as size * 16 + register number + 1
+  // so that we don't store a null pointer.
+  for (int i = 0; i < 16; i++) {
+    hashmap_put(&registers, reg64[i], (void *)(long)(8 * 16 + i + 1));
+    hashmap_put(&registers, reg32[i], (void *)(long)(4 * 16 + i + 1));
+    hashmap_put(&registers, reg16[i], (void *)(long)(2 * 16 + i + 1));
+    hashmap_put(&registers, reg8[i], (void *)(long)(1 * 16 + i + 1));
+  }
+}
+
+// Parses a register name. Returns false if it is not a register.
+static bool parse_reg(Operand *op, char *s, int len) {
+  long val = (long)hashmap_get2(&registers, s, len);
+  if (!val)
+    return false;
+  val--;
+  op->reg = val % 16;
+  op->size = val / 16;
+  return true;
+}
+
+static long parse_number(char *s, int len) {
+  char *end;
+  long val = strtol(s, &end, 10);
+  if (end != s + len)
+    asm_error("invalid number");
+  return val;
+}
+
+static bool startswith(char *p, int len, char *q) {
+  int n = strlen(q);
+  return n <= len && !strncmp(p, q, n);
+}
+
+// Parses `[reg]`, `[reg+disp]` or `[reg-disp]`.
+static void parse_mem(Operand *op, char *s, int len) {
+  if (s[0] != '[' || s[len - 1] != ']')
+    asm_error("invalid memory operand");
+
+  char *p = s + 1;
+  char *end = s + len - 1;
+  char *q = p;
+  while (q < end && *q != '+' && *q != '-')
+    q++;
+
+  Operand base = {};
+  if (!parse_reg(&base, p, q - p) || base.size != 8)
+    asm_error("invalid base register");
+
+  op->kind = OP_MEM;
+  op->reg = base.reg;
+  op->val = 0;
+  if (q < end)
+    op->val = parse_number(q, end - q);
+}
+
+static void parse_operand(Operand *op, char *s, int len) {
+  *op = (Operand){};
+
+  if (startswith(s, len, "byte ptr ")) {
+    parse_mem(op, s + 9, len - 9);
+    op->size = 1;
+    return;
+  }
+
+  if (startswith(s, len, "word ptr ")) {
+    parse_mem(op, s + 9, len - 9);
+    op->size = 2;
+    return;
+  }
+
+  if (startswith(s, len, "dword ptr ")) {
+    parse_mem(op, s + 10, len - 10);
+    op->size = 4;
+    return;
+  }
+
+  if (startswith(s, len, "qword ptr ")) {
+    parse_mem(op, s + 10, len - 10);
+    op->size = 8;
+    return;
+  }
+
+  if (s[0] == '[') {
+    parse_mem(op, s, len);
+    return;
+  }
+
+  if (startswith(s, len, "offset ")) {
+    op->kind = OP_SYM;
+    op->sym = get_symbol(s + 7, len - 7);
+    return;
+  }
+
+  if (isdigit(s[0]) || s[0] == '-') {
+    op->kind = OP_IMM;
+    op->val = parse_number(s, len);
+    return;
+  }
+
+  if (parse_reg(op, s, len)) {
+    op->kind = OP_REG;
+    return;
+  }
+
+  op->kind = OP_SYM;
+  op->sym = get_symbol(s, len);
+}
+
+//
+// Instruction encoder
+//
+
+// Returns true if a given operand is spl, bpl, sil or dil, which
+// can be accessed only with a REX prefix.
+static bool needs_rex8(Operand *op) {
+  return op && op->kind == OP_REG && op->size == 1 && 4 <= op->reg && op->reg < 8;
+}
+
+// Emits prefixes, opcode and ModRM (and SIB and displacement if
+// needed) bytes. `reg` is a register number or an opcode extension
+// for the reg field. `rm` is a register or a memory operand. `src`
+// is the register operand in the reg field, if any.
+static void emit_modrm(int size, int opcode, int opcode2, int reg, Operand *rm, Operand *src) {
+  if (size == 2)
+    emit8(0x66);
+
+  int rex = 0x40;
+  if (size == 8)
+    rex |= 8;
+  if (reg >= 8)
+    rex |= 4;
+  if (rm->reg >= 8)
+    rex |= 1;
+  if (rex != 0x40 || needs_rex8(rm) || needs_rex8(src))
+    emit8(rex);
+
+  emit8(opcode);
+  if (opcode2 >= 0)
+    emit8(opcode2);
+
+  if (rm->kind == OP_REG) {
+    emit8(0xc0 | ((reg & 7) << 3) | (rm->reg & 7));
+    return;
+  }
+
+  if (rm->kind != OP_MEM)
+    asm_error("invalid operand");
+
+  int base = rm->reg & 7;
+  int mod;
+  if (rm->val == 0 && base != 5)
+    mod = 0;
+  else if (-128 <= rm->val && rm->val <= 127)
+    mod = 1;
+  else
+    mod = 2;
+
+  emit8((mod << 6) | ((reg & 7) << 3) | base);
+
+  // rsp and r12 as a base register require a SIB byte.
+  if (base == 4)
+    emit8(0x24);
+
+  if (mod == 1)
+    buf_int(&text, rm->val, 1);
+  else if (mod == 2)
+    buf_int(&text, rm->val, 4);
+}
+
+// Emits an instruction that encodes a register in its opcode,
+// such as push, pop or mov with an immediate.
+static void emit_opreg(bool rex_w, int opcode, Operand *op) {
+  int rex = 0x40;
+  if (rex_w)
+    rex |= 8;
+  if (op->reg >= 8)
+    rex |= 1;
+  if (rex != 0x40 || needs_rex8(op))
+    emit8(rex);
+  emit8(opcode + (op->reg & 7));
+}
+
+static bool is_rm(Operand *op) {
+  return op->kind == OP_REG || op->kind == OP_MEM;
+}
+
+static bool is_int8(long val) {
+  return -128 <= val && val <= 127;
+}
+
+static bool is_int32(long val) {
+  return -2147483648 <= val && val <= 2147483647;
+}
+
+static int operand_size(Operand *x, Operand *y) {
+  if (x->size)
+    return x->size;
+  if (y && y->size)
+    return y->size;
+  asm_error("unknown operand size");
+  return 0;
+}
+
+// mov
+static void asm_mov(Operand *dst, Operand *src) {
+  int size = operand_size(dst, src);
+
+  if (is_rm(dst) && src->kind == OP_REG) {
+    emit_modrm(size, size == 1 ? 0x88 : 0x89, -1, src->reg, dst, src);
+    return;
+  }
+
+  if (dst->kind == OP_REG && src->kind == OP_MEM) {
+    emit_modrm(size, size == 1 ? 0x8a : 0x8b, -1, dst->reg, src, dst);
+    return;
+  }
+
+  if (dst->kind == OP_REG && src->kind == OP_SYM) {
+    // mov r64, imm32 (sign-extended) with a relocation
+    if (size != 8)
+      asm_error("invalid operand size");
+    emit_modrm(8, 0xc7, -1, 0, dst, NULL);
+    add_reloc(&text_relocs, text.len, R_X86_64_32S, src->sym, 0);
+    buf_int(&text, 0, 4);
+    return;
+  }
+
+  if (src->kind != OP_IMM)
+    asm_error("invalid operand");
+
+  if (dst->kind == OP_REG && size == 8 && !is_int32(src->val)) {
+    emit_opreg(true, 0xb8, dst);
+    buf_int(&text, src->val, 8);
+    return;
+  }
+
+  if (dst->kind == OP_REG && size == 4) {
+    emit_opreg(false, 0xb8, dst);
+    buf_int(&text, src->val, 4);
+    return;
+  }
+
+  if (size == 1) {
+    emit_modrm(1, 0xc6, -1, 0, dst, NULL);
+    buf_int(&text, src->val, 1);
+    return;
+  }
+
+  emit_modrm(size, 0xc7, -1, 0, dst, NULL);
+  buf_int(&text, src->val, size == 2 ? 2 : 4);
+}
+
+// add, or, and, sub, xor and cmp
+static void asm_alu(int ext, Operand *dst, Operand *src) {
+  int size = operand_size(dst, src);
+
+  if (is_rm(dst) && src->kind == OP_REG) {
+    emit_modrm(size, ext * 8 + (size == 1 ? 0 : 1), -1, src->reg, dst, src);
+    return;
+  }
+
+  if (dst->kind == OP_REG && src->kind == OP_MEM) {
+    emit_modrm(size, ext * 8 + (size == 1 ? 2 : 3), -1, dst->reg, src, dst);
+    return;
+  }
+
+  if (src->kind != OP_IMM)
+    asm_error("invalid operand");
+
+  if (size == 1) {
+    emit_modrm(1, 0x80, -1, ext, dst, NULL);
+    buf_int(&text, src->val, 1);
+  } else if (is_int8(src->val)) {
+    emit_modrm(size, 0x83, -1, ext, dst, NULL);
+    buf_int(&text, src->val, 1);
+  } else {
+    emit_modrm(size, 0x81, -1, ext, dst, NULL);
+    buf_int(&text, src->val, size == 2 ? 2 : 4);
+  }
+}
+
+// movsx and movzx
+static void asm_movx(bool is_signed, Operand *dst, Operand *src) {
+  if (dst->kind != OP_REG || !is_rm(src))
+    asm_error("invalid operand");
+
+  if (src->size == 1)
+    emit_modrm(dst->size, 0x0f, is_signed ? 0xbe : 0xb6, dst->reg, src, NULL);
+  else if (src->size == 2)
+    emit_modrm(dst->size, 0x0f, is_signed ? 0xbf : 0xb7, dst->reg, src, NULL);
+  else if (src->size == 4 && dst->size == 8 && is_signed)
+    emit_modrm(8, 0x63, -1, dst->reg, src, NULL);
+  else
+    asm_error("invalid operand size");
+}
+
+// Unary operations with an opcode extension, i.e. not, div and idiv
+static void asm_unary(int ext, Operand *op) {
+  if (!is_rm(op) || !op->size)
+    asm_error("invalid operand");
+  emit_modrm(op->size, op->size == 1 ? 0xf6 : 0xf7, -1, ext, op, NULL);
+}
+
+// shl, shr and sar
+static void asm_shift(int ext, Operand *dst, Operand *src) {
+  if (!is_rm(dst) || src->kind != OP_REG || src->size != 1 || src->reg != 1)
+    asm_error("invalid operand");
+  emit_modrm(dst->size, dst->size == 1 ? 0xd2 : 0xd3, -1, ext, dst, NULL);
+}
+
+static void asm_jump(int opcode, int opcode2, Operand *op) {
+  if (op->kind != OP_SYM)
+    asm_error("invalid jump target");
+
+  emit8(opcode);
+  if (opcode2 >= 0)
+    emit8(opcode2);
+
+  Fixup *fix = calloc(1, sizeof(Fixup));
+  fix->offset = text.len;
+  fix->sym = op->sym;
+  fix->line = cur_line;
+  fix->next = fixups;
+  fixups = fix;
+  buf_int(&text, 0, 4);
+}
+
+// Condition codes for jcc and setcc
+static int cond_code(char *s) {
+  static char *conds[] = {
+    "o", "no", "b", "ae", "e", "ne", "be", "a",
+    "s", "ns", "p", "np", "l", "ge", "le", "g",
+  };
+
+  for (int i = 0; i < sizeof(conds) / sizeof(*conds); i++)
+    if (!strcmp(s, conds[i]))
+      return i;
+  return -1;
+}
+
+static void expect_operands(int nops, int n) {
+  if (nops != n)
+    asm_error("wrong number of operands");
+}
+
+static void assemble_insn(char *insn, Operand *ops, int nops) {
+  if (cur_sec != SEC_TEXT)
+    asm_error("instruction outside .text");
+
+  if (!strcmp(insn, "mov")) {
+    expect_operands(nops, 2);
+    asm_mov(&ops[0], &ops[1]);
+    return;
+  }
+
+  if (!strcmp(insn, "movabs")) {
+    expect_operands(nops, 2);
+    if (ops[0].kind != OP_REG || ops[0].size != 8 || ops[1].kind != OP_IMM)
+      asm_error("invalid operand");
+    emit_opreg(true, 0xb8, &ops[0]);
+    buf_int(&text, ops[1].val, 8);
+    return;
+  }
+
+  if (!strcmp(insn, "lea")) {
+    expect_operands(nops, 2);
+    if (ops[0].kind != OP_REG || ops[1].kind != OP_MEM)
+      asm_error("invalid operand");
+    emit_modrm(ops[0].size, 0x8d, -1, ops[0].reg, &ops[1], NULL);
+    return;
+  }
+
+  if (!strcmp(insn, "movsx")) {
+    expect_operands(nops, 2);
+    asm_movx(true, &ops[0], &ops[1]);
+    return;
+  }
+
+  if (!strcmp(insn, "movzx") || !strcmp(insn, "movzb")) {
+    expect_operands(nops, 2);
+    if (insn[4] == 'b' && ops[1].kind == OP_MEM)
+      ops[1].size = 1;
+    asm_movx(false, &ops[0], &ops[1]);
+    return;
+  }
+
+  static char *alu[] = {"add", "or", "adc", "sbb", "and", "sub", "xor", "cmp"};
+  for (int i = 0; i < sizeof(alu) / sizeof(*alu); i++) {
+    if (!strcmp(insn, alu[i])) {
+      expect_operands(nops, 2);
+      asm_alu(i, &ops[0], &ops[1]);
+      return;
+    }
+  }
+
+  if (!strcmp(insn, "imul")) {
+    expect_operands(nops, 2);
+    if (ops[0].kind != OP_REG || !is_rm(&ops[1]))
+      asm_error("invalid operand");
+    emit_modrm(ops[0].size, 0x0f, 0xaf, ops[0].reg, &ops[1], NULL);
+    return;
+  }
+
+  if (!strcmp(insn, "not")) {
+    expect_operands(nops, 1);
+    asm_unary(2, &ops[0]);
+    return;
+  }
+
+  if (!strcmp(insn, "div")) {
+    expect_operands(nops, 1);
+    asm_unary(6, &ops[0]);
+    return;
+  }
+
+  if (!strcmp(insn, "idiv")) {
+    expect_operands(nops, 1);
+    asm_unary(7, &ops[0]);
+    return;
+  }
+
+  if (!strcmp(insn, "shl")) {
+    expect_operands(nops, 2);
+    asm_shift(4, &ops[0], &ops[1]);
+    return;
+  }
+
+  if (!strcmp(insn, "shr")) {
+    expect_operands(nops, 2);
+    asm_shift(5, &ops[0], &ops[1]);
+    return;
+  }
+
+  if (!strcmp(insn, "sar")) {
+    expect_operands(nops, 2);
+    asm_shift(7, &ops[0], &ops[1]);
+    return;
+  }
+
+  if (!strncmp(insn, "set", 3) && cond_code(insn + 3) >= 0) {
+    expect_operands(nops, 1);
+    if (!is_rm(&ops[0]))
+      asm_error("invalid operand");
+    emit_modrm(1, 0x0f, 0x90 + cond_code(insn + 3), 0, &ops[0], NULL);
+    return;
+  }
+
+  if (!strcmp(insn, "jmp")) {
+    expect_operands(nops, 1);
+    asm_jump(0xe9, -1, &ops[0]);
+    return;
+  }
+
+  if (insn[0] == 'j' && cond_code(insn + 1) >= 0) {
+    expect_operands(nops, 1);
+    asm_jump(0x0f, 0x80 + cond_code(insn + 1), &ops[0]);
+    return;
+  }
+
+  if (!strcmp(insn, "call")) {
+    expect_operands(nops, 1);
+    if (ops[0].kind != OP_REG || ops[0].size != 8)
+      asm_error("invalid operand");
+    emit_modrm(4, 0xff, -1, 2, &ops[0], NULL);
+    return;
+  }
+
+  if (!strcmp(insn, "push") || !strcmp(insn, "pop")) {
+    expect_operands(nops, 1);
+    if (ops[0].kind != OP_REG || ops[0].size != 8)
+      asm_error("invalid operand");
+    emit_opreg(false, insn[1] == 'u' ? 0x50 : 0x58, &ops[0]);
+    return;
+  }
+
+  if (!strcmp(insn, "ret")) {
+    expect_operands(nops, 0);
+    emit8(0xc3);
+    return;
+  }
+
+  if (!strcmp(insn, "cqo")) {
+    expect_operands(nops, 0);
+    emit8(0x48);
+    emit8(0x99);
+    return;
+  }
+
+  if (!strcmp(insn, "cdq")) {
+    expect_operands(nops, 0);
+    emit8(0x99);
+    return;
+  }
+
+  asm_error("unknown instruction");
+}
+
+//
+// Directives
+//
+
+static void assemble_data(char *directive, int size, char *arg, int len) {
+  if (cur_sec != SEC_DATA)
+    asm_error("data directive outside .data");
+
+  // A number or `sym+addend` or `sym-addend`.
+  if (isdigit(arg[0]) || arg[0] == '-') {
+    buf_int(&data, parse_number(arg, len), size);
+    return;
+  }
+
+  char *p = arg;
+  while (p < arg + len && *p != '+' && *p != '-')
+    p++;
+
+  if (size != 8)
+    asm_error("symbol reference must be 8 bytes");
+
+  long addend = 0;
+  if (p < arg + len)
+    addend = parse_number(p, arg + len - p);
+  add_reloc(&data_relocs, data.len, R_X86_64_64, get_symbol(arg, p - arg), addend);
+  buf_int(&data, 0, 8);
+}
+
+static void assemble_directive(char *directive, char *arg, int len) {
+  if (!strcmp(directive, ".text")) {
+    cur_sec = SEC_TEXT;
+    return;
+  }
+
+  if (!strcmp(directive, ".data")) {
+    cur_sec = SEC_DATA;
+    return;
+  }
+
+  if (!strcmp(directive, ".bss")) {
+    cur_sec = SEC_BSS;
+    return;
+  }
+
+  if (!strcmp(directive, ".globl")) {
+    get_symbol(arg, len)->is_global = true;
+    return;
+  }
+
+  if (!strcmp(directive, ".align")) {
+    int n = parse_number(arg, len);
+    if (align[cur_sec] < n)
+      align[cur_sec] = n;
+
+    if (cur_sec == SEC_TEXT)
+      buf_align(&text, n);
+    else if (cur_sec == SEC_DATA)
+      buf_align(&data, n);
+    else
+      bss_size = align_to(bss_size, n);
+    return;
+  }
+
+  if (!strcmp(directive, ".zero")) {
+    int n = parse_number(arg, len);
+    if (cur_sec == SEC_TEXT)
+      buf_zero(&text, n);
+    else if (cur_sec == SEC_DATA)
+      buf_zero(&data, n);
+    else
+      bss_size += n;
+    return;
+  }
+
+  if (!strcmp(directive, ".byte")) {
+    assemble_data(directive, 1, arg, len);
+    return;
+  }
+
+  if (!strcmp(directive, ".short")) {
+    assemble_data(directive, 2, arg, len);
+    return;
+  }
+
+  if (!strcmp(directive, ".long")) {
+    assemble_data(directive, 4, arg, len);
+    return;
+  }
+
+  if (!strcmp(directive, ".quad")) {
+    assemble_data(directive, 8, arg, len);
+    return;
+  }
+
+  if (!strcmp(directive, ".file")) {
+    // Use the first filename for an STT_FILE symbol.
+    char *p = strchr(arg, '"');
+    if (p && !source_file)
+      source_file = strndup(p + 1, arg + len - p - 2);
+    return;
+  }
+
+  if (!strcmp(directive, ".loc") || !strcmp(directive, ".intel_syntax"))
+    return;
+
+  asm_error("unknown directive");
+}
+
+// Assembles a single line.
+static void assemble_line(char *p, char *end) {
+  cur_line = p;
+
+  while (p < end && *p == ' ')
+    p++;
+  if (p == end)
+    return;
+
+  // Label
+  if (end[-1] == ':') {
+    define_symbol(p, end - 1 - p);
+    return;
+  }
+
+  // Read a mnemonic or a directive name.
+  char name[16];
+  char *q = p;
+  while (q < end && *q != ' ')
+    q++;
+
+  int len = q - p;
+  if (len >= sizeof(name))
+    asm_error("unknown instruction");
+  memcpy(name, p, len);
+  name[len] = '\0';
+
+  while (q < end && *q == ' ')
+    q++;
+
+  if (name[0] == '.') {
+    assemble_directive(name, q, end - q);
+    return;
+  }
+
+  // Read operands.
+  Operand ops[2];
+  int nops = 0;
+  while (q < end) {
+    char *start = q;
+    while (q < end && *q != ',')
+      q++;
+    if (nops == 2)
+      asm_error("too many operands");
+    parse_operand(&ops[nops++], start, q - start);
+    if (q < end)
+      q += 2; // skip ", "
+  }
+
+  assemble_insn(name, ops, nops);
+}
+
+static void resolve_fixups(void) {
+  for (Fixup *fix = fixups; fix; fix = fix->next) {
+    cur_line = fix->line;
+    if (fix->sym->sec != SEC_TEXT)
+      asm_error("undefined jump target");
+    patch32(&text, fix->offset, fix->sym->offset - (fix->offset + 4));
+  }
+}
+
+//
+// ELF writer
+//
+
+static int add_string(ByteBuf *strtab, char *s) {
+  int offset = strtab->len;
+  buf_put(strtab, s, strlen(s) + 1);
+  return offset;
+}
+
+static void write_symbol(ByteBuf *buf, int name, int bind, int type, int shndx, long val) {
+  buf_int(buf, name, 4);
+  buf_int(buf, (bind << 4) | type, 1);
+  buf_int(buf, 0, 1);
+  buf_int(buf, shndx, 2);
+  buf_int(buf, val, 8);
+  buf_int(buf, 0, 8);
+}
+
+static void write_relocs(ByteBuf *buf, Reloc *rel) {
+  for (; rel; rel = rel->next) {
+    Symbol *sym = rel->sym;
+    long addend = rel->addend;
+    int index;
+
+    if (sym->sec == -1 && is_local_label(sym))
+      error("internal error: undefined symbol %s", sym->name);
+
+    if (sym->sec != -1 && is_local_label(sym)) {
+      // References to local labels are converted to references
+      // to their section symbols.
+      index = SH_TEXT + sym->sec + (source_file ? 1 : 0);
+      addend += sym->offset;
+    } else {
+      index = sym->index;
+    }
+
+    buf_int(buf, rel->offset, 8);
+    buf_int(buf, ((long)index << 32) | rel->type, 8);
+    buf_int(buf, addend, 8);
+  }
+}
+
+static void write_shdr(ByteBuf *buf, Shdr *sh) {
+  buf_int(buf, sh->name, 4);
+  buf_int(buf, sh->type, 4);
+  buf_int(buf, sh->flags, 8);
+  buf_int(buf, 0, 8);  // sh_addr
+  buf_int(buf, sh->offset, 8);
+  buf_int(buf, sh->size, 8);
+  buf_int(buf, sh->link, 4);
+  buf_int(buf, sh->info, 4);
+  buf_int(buf, sh->align, 8);
+  buf_int(buf, sh->entsize, 8);
+}
+
+static int symbol_type(Symbol *sym) {
+  if (sym->sec == SEC_TEXT)
+    return STT_FUNC;
+  if (sym->sec == -1)
+    return STT_NOTYPE;
+  return STT_OBJECT;
+}
+
+static void write_elf(char *path) {
+  ByteBuf strtab = {};
+  ByteBuf symtab = {};
+  buf_int(&strtab, 0, 1);
+
+  // Null symbol, an optional file symbol and section symbols
+  write_symbol(&symtab, 0, STB_LOCAL, STT_NOTYPE, 0, 0);
+  int nsyms = 1;
+
+  if (source_file) {
+    write_symbol(&symtab, add_string(&strtab, source_file), STB_LOCAL, STT_FILE, SHN_ABS, 0);
+    nsyms++;
+  }
+
+  for (int i = SH_TEXT; i <= SH_BSS; i++) {
+    write_symbol(&symtab, 0, STB_LOCAL, STT_SECTION, i, 0);
+    nsyms++;
+  }
+
+  // Local symbols must precede global ones.
+  for (Symbol *sym = sym_head.next; sym; sym = sym->next) {
+    if (sym->is_global || sym->sec == -1 || is_local_label(sym))
+      continue;
+    sym->index = nsyms++;
+    write_symbol(&symtab, add_string(&strtab, sym->name), STB_LOCAL,
+                 symbol_type(sym), SH_TEXT + sym->sec, sym->offset);
+  }
+
+  int first_global = nsyms;
+
+  for (Symbol *sym = sym_head.next; sym; sym = sym->next) {
+    if (is_local_label(sym) || !(sym->is_global || sym->sec == -1))
+      continue;
+    sym->index = nsyms++;
+    write_symbol(&symtab, add_string(&strtab, sym->name), STB_GLOBAL,
+                 symbol_type(sym), sym->sec == -1 ? 0 : SH_TEXT + sym->sec,
+                 sym->offset);
+  }
+
+  ByteBuf rela_text = {};
+  ByteBuf rela_data = {};
+  write_relocs(&rela_text, text_relocs);
+  write_relocs(&rela_data, data_relocs);
+
+  ByteBuf shstrtab = {};
+  buf_int(&shstrtab, 0, 1);
+  int name_text = add_string(&shstrtab, ".text");
+  int name_data = add_string(&shstrtab, ".data");
+  int name_bss = add_string(&shstrtab, ".bss");
+  int name_rela_text = add_string(&shstrtab, ".rela.text");
+  int name_rela_data = add_string(&shstrtab, ".rela.data");
+  int name_symtab = add_string(&shstrtab, ".symtab");
+  int name_strtab = add_string(&shstrtab, ".strtab");
+  int name_shstrtab = add_string(&shstrtab, ".shstrtab");
+  int name_note = add_string(&shstrtab, ".note.GNU-stack");
+
+  // Lay out the file: the ELF header, section contents and then
+  // the section header table.
+  ByteBuf out = {};
+  buf_zero(&out, 64);
+
+  buf_align(&out, 16);
+  long off_text = out.len;
+  buf_put(&out, text.data, text.len);
+
+  buf_align(&out, 16);
+  long off_data = out.len;
+  buf_put(&out, data.data, data.len);
+
+  buf_align(&out, 8);
+  long off_rela_text = out.len;
+  buf_put(&out, rela_text.data, rela_text.len);
+
+  long off_rela_data = out.len;
+  buf_put(&out, rela_data.data, rela_data.len);
+
+  long off_symtab = out.len;
+  buf_put(&out, symtab.data, symtab.len);
+
+  long off_strtab = out.len;
+  buf_put(&out, strtab.data, strtab.len);
+
+  long off_shstrtab = out.len;
+  buf_put(&out, shstrtab.data, shstrtab.len);
+
+  buf_align(&out, 8);
+  long off_shdr = out.len;
+
+  for (int i = 0; i < 3; i++)
+    if (align[i] == 0)
+      align[i] = 1;
+
+  write_shdr(&out, &(Shdr){0, 0, 0, 0, 0, 0, 0, 0, 0});
+  write_shdr(&out, &(Shdr){name_text, SHT_PROGBITS, SHF_ALLOC | SHF_EXECINSTR, off_text, text.len, 0, 0, align[SEC_TEXT], 0});
+  write_shdr(&out, &(Shdr){name_data, SHT_PROGBITS, SHF_ALLOC | SHF_WRITE, off_data, data.len, 0, 0, align[SEC_DATA], 0});
+  write_shdr(&out, &(Shdr){name_bss, SHT_NOBITS, SHF_ALLOC | SHF_WRITE, off_data + data.len, bss_size, 0, 0, align[SEC_BSS], 0});
+  write_shdr(&out, &(Shdr){name_rela_text, SHT_RELA, SHF_INFO_LINK, off_rela_text, rela_text.len, SH_SYMTAB, SH_TEXT, 8, 24});
+  write_shdr(&out, &(Shdr){name_rela_data, SHT_RELA, SHF_INFO_LINK, off_rela_data, rela_data.len, SH_SYMTAB, SH_DATA, 8, 24});
+  write_shdr(&out, &(Shdr){name_symtab, SHT_SYMTAB, 0, off_symtab, symtab.len, SH_STRTAB, first_global, 8, 24});
+  write_shdr(&out, &(Shdr){name_strtab, SHT_STRTAB, 0, off_strtab, strtab.len, 0, 0, 1, 0});
+  write_shdr(&out, &(Shdr){name_shstrtab, SHT_STRTAB, 0, off_shstrtab, shstrtab.len, 0, 0, 1, 0});
+  write_shdr(&out, &(Shdr){name_note, SHT_PROGBITS, 0, off_shdr, 0, 0, 0, 1, 0});
+
+  // ELF header
+  char *h = out.data;
+  memcpy(h, "\177ELF", 4);
+  h[4] = 2;  // ELFCLASS64
+  h[5] = 1;  // ELFDATA2LSB
+  h[6] = 1;  // EV_CURRENT
+
+  ByteBuf hdr = {};
+  buf_int(&hdr, 1, 2);         // e_type = ET_REL
+  buf_int(&hdr, 62, 2);        // e_machine = EM_X86_64
+  buf_int(&hdr, 1, 4);         // e_version
+  buf_int(&hdr, 0, 8);         // e_entry
+  buf_int(&hdr, 0, 8);         // e_phoff
+  buf_int(&hdr, off_shdr, 8);  // e_shoff
+  buf_int(&hdr, 0, 4);         // e_flags
+  buf_int(&hdr, 64, 2);        // e_ehsize
+  buf_int(&hdr, 0, 2);         // e_phentsize
+  buf_int(&hdr, 0, 2);         // e_phnum
+  buf_int(&hdr, 64, 2);        // e_shentsize
+  buf_int(&hdr, SH_NUM, 2);    // e_shnum
+  buf_int(&hdr, SH_SHSTRTAB, 2); // e_shstrndx
+  memcpy(h + 16, hdr.data, hdr.len);
+
+  open_output(path);
+  write_output(out.data, out.len);
+  timer_count(PH_ASSEMBLE, out.len);
+}
+
+// Assembles a given assembly text and writes an object file to path.
+void assemble(char *input, char *path) {
+  init_registers();
+
+  char *p = input;
+  while (*p) {
+    char *end = strchr(p, '\n');
+    if (!end)
+      end = p + strlen(p);
+    assemble_line(p, end);
+    p = *end ? end + 1 : end;
+  }
+
+  resolve_fixups();
+  write_elf(path);
+}
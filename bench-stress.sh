@@ -0,0 +1,136 @@
+#!/bin/bash
+# Runs a compiler over synthetic inputs of growing size to catch
+# superlinear behavior.
+#
+# For each input shape, the size N is doubled a few times, and time
+# and peak memory are measured for each N. If doubling N makes the
+# compiler more than THRESHOLD/100 times slower (or bigger), the row
+# is flagged, as linear growth would only double it.
+#
+# usage: ./bench-stress.sh <compiler> [<steps>]
+set -e
+
+CC=$(realpath $1)
+STEPS=${2:-4}
+THRESHOLD=300
+TMP=$(mktemp -d)
+trap "rm -rf $TMP" EXIT
+
+# N functions, each calling the previous one.
+gen_funcs() {
+    awk -v n=$1 'BEGIN {
+        print "int f0(int x) { return x; }";
+        for (i = 1; i < n; i++)
+            printf "int f%d(int x) { return f%d(x) + %d; }\n", i, i - 1, i;
+    }'
+}
+
+# N global variables used by a function at the end.
+gen_globals() {
+    awk -v n=$1 'BEGIN {
+        for (i = 0; i < n; i++)
+            printf "int g%d = %d;\n", i, i;
+        printf "int main() { return g0 + g%d; }\n", n - 1;
+    }'
+}
+
+# A chain of N macros, each expanding to the previous one.
+gen_macros() {
+    awk -v n=$1 'BEGIN {
+        print "#define M0 1";
+        for (i = 1; i < n; i++)
+            printf "#define M%d (M%d + 1)\n", i, i - 1;
+        printf "int main() { return M%d; }\n", n - 1;
+    }'
+}
+
+# N nested blocks, each declaring a variable.
+gen_scopes() {
+    awk -v n=$1 'BEGIN {
+        print "int main() {";
+        for (i = 0; i < n; i++)
+            printf "{ int v%d = %d;\n", i, i;
+        for (i = 0; i < n; i++)
+            print "}";
+        print "return 0; }";
+    }'
+}
+
+# An array with N initializer elements.
+gen_array() {
+    awk -v n=$1 'BEGIN {
+        print "int a[] = {";
+        for (i = 0; i < n; i++)
+            printf "%d,\n", i % 1000;
+        print "};";
+    }'
+}
+
+# An expression with N terms.
+gen_expr() {
+    awk -v n=$1 'BEGIN {
+        printf "int f(int x) { return x";
+        for (i = 0; i < n; i++)
+            printf " + x * %d", i % 100;
+        print "; }";
+    }'
+}
+
+# Prints "<time in ms> <peak RSS in KiB>" of compiling a given file.
+measure() {
+    local start=$(date +%s%N)
+    local rss=$($CC -fmem-report -o /dev/null $1 2>&1 >/dev/null |
+                    awk '/^peak RSS/ { print $3 }')
+    local end=$(date +%s%N)
+    echo $(( (end - start) / 1000000 )) $rss
+}
+
+# Prints a ratio of two numbers with two decimal places.
+ratio() {
+    local r=$(( $2 * 100 / ($1 > 0 ? $1 : 1) ))
+    printf "%d.%02d" $(( r / 100 )) $(( r % 100 ))
+}
+
+# run <name> <initial N>
+run() {
+    local n=$2
+    local prev_ms=0
+    local prev_rss=0
+
+    for i in $(seq $STEPS); do
+        gen_$1 $n > $TMP/$1.c
+        read ms rss < <(measure $TMP/$1.c)
+        if [ -z "$rss" ]; then
+            printf "%-8s %9d  compilation failed\n" $1 $n
+            return
+        fi
+
+        local flag=
+        if [ $i -gt 1 ]; then
+            # Ignore timings too short to be meaningful.
+            if [ $ms -ge 50 ] && [ $(( ms * 100 / (prev_ms > 0 ? prev_ms : 1) )) -gt $THRESHOLD ]; then
+                flag="superlinear time"
+            fi
+            if [ $(( rss * 100 / prev_rss )) -gt $THRESHOLD ]; then
+                flag="$flag${flag:+, }superlinear memory"
+            fi
+            printf "%-8s %9d %9d %7s %10d %7s%s\n" $1 $n $ms \
+                   $(ratio $prev_ms $ms) $rss $(ratio $prev_rss $rss) \
+                   "${flag:+  $flag}"
+        else
+            printf "%-8s %9d %9d %7s %10d %7s\n" $1 $n $ms - $rss -
+        fi
+
+        prev_ms=$ms
+        prev_rss=$rss
+        n=$(( n * 2 ))
+    done
+}
+
+printf "%-8s %9s %9s %7s %10s %7s\n" case N "time(ms)" ratio "RSS(KiB)" ratio
+run funcs 500
+run globals 500
+run macros 250
+run scopes 250
+run array 100000
+run expr 2000
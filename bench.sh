@@ -0,0 +1,21 @@
+#!/bin/bash
+# Measures how fast a compiler translates a given C file to assembly.
+#
+# usage: ./bench.sh <compiler> <file> [<iterations>]
+set -e
+
+CC=$(realpath $1)
+DIR=$(dirname $2)
+FILE=$(basename $2)
+N=${3:-20}
+
+BYTES=$(cd $DIR; $CC $FILE | wc -c)
+
+START=$(date +%s%N)
+for i in $(seq $N); do
+    (cd $DIR; $CC $FILE > /dev/null)
+done
+END=$(date +%s%N)
+
+NS=$(( (END - START) / N ))
+echo "$2: $BYTES bytes of asm in $(( NS / 1000 )) us ($(( BYTES * 1000 / NS )) MB/s)"
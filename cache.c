@@ -0,0 +1,286 @@
+// This file implements the compilation cache.
+//
+// With -fcache-dir=<dir>, the assembly generated for a translation
+// unit is stored in <dir> under a hash of everything that determines
+// it: the preprocessed token stream including source lines and
+// columns (for .loc directives), the .file directives emitted by the
+// preprocessor, and the identity of the compiler binary. If the
+// same hash is seen again, parse() and codegen() are skipped and the
+// stored assembly is used instead.
+//
+// The total size of the cache is kept under -fcache-size bytes by
+// removing the least recently used entries, using each entry's atime
+// which we update explicitly on every hit.
+
+#include "punyc.h"
+
+char *cache_dir;
+long cache_max_size = 256 * 1024 * 1024;
+bool cache_stats;
+
+// Bump this if the cache entry format changes.
+static char *cache_version = "punyc-cache-3";
+
+// 128-bit FNV-1a. The state is held in two 64-bit halves, and each
+// multiplication by the FNV prime 2^88 + 0x13b carries from the low
+// half into the high half, so that every input byte affects all 128
+// bits.
+typedef struct {
+  unsigned long hi;
+  unsigned long lo;
+} Hash;
+
+typedef struct {
+  char *name;
+  long size;
+  long atime;
+} CacheEntry;
+
+static void hash_bytes(Hash *h, char *p, long len) {
+  for (long i = 0; i < len; i++) {
+    unsigned long lo = h->lo ^ (unsigned char)p[i];
+
+    // (hi, lo) * 0x13b, computed 32 bits at a time to get the carry
+    unsigned long p0 = (lo & 0xffffffff) * 0x13b;
+    unsigned long p1 = (lo >> 32) * 0x13b + (p0 >> 32);
+    h->lo = (p1 << 32) | (p0 & 0xffffffff);
+    h->hi = h->hi * 0x13b + (p1 >> 32);
+
+    // (hi, lo) * 2^88
+    h->hi += lo << 24;
+  }
+}
+
+static void hash_long(Hash *h, long val) {
+  hash_bytes(h, (char *)&val, sizeof(val));
+}
+
+static char *entry_path(char *name) {
+  char *buf = alloc_obj(AK_STRING, strlen(cache_dir) + strlen(name) + 2);
+  sprintf(buf, "%s/%s", cache_dir, name);
+  return buf;
+}
+
+// Returns a cache key for the preprocessed tokens `tok`. `hdr` is the
+// output emitted by the preprocessor (i.e. .file directives).
+char *cache_key(Token *tok, char *hdr, long hdr_len) {
+  Hash h = {0x6c62272e07bb0142, 0x62b821756295c58d};
+
+  hash_bytes(&h, cache_version, strlen(cache_version) + 1);
+
+  // Different builds of the compiler may generate different code.
+  struct stat st;
+  if (!stat("/proc/self/exe", &st)) {
+    hash_long(&h, st.st_size);
+    hash_long(&h, st.st_mtim.tv_sec);
+    hash_long(&h, st.st_mtim.tv_nsec);
+  }
+
+  // The state restored from a precompiled header is not visible
+  // in the tokens.
+  if (include_pch && !stat(include_pch, &st)) {
+    hash_long(&h, st.st_dev);
+    hash_long(&h, st.st_ino);
+    hash_long(&h, st.st_size);
+    hash_long(&h, st.st_mtim.tv_sec);
+    hash_long(&h, st.st_mtim.tv_nsec);
+  }
+
+  hash_bytes(&h, hdr, hdr_len);
+
+  for (; tok->kind != TK_EOF; tok = tok->next) {
+    hash_long(&h, tok->kind);
+    hash_long(&h, tok->file->file_no);
+    hash_long(&h, tok->lineno);
+    hash_long(&h, get_column(tok));
+    hash_long(&h, tok->len);
+    hash_bytes(&h, tok->loc, tok->len);
+  }
+
+  char *buf = alloc_obj(AK_STRING, 40);
+  sprintf(buf, "%016lx%016lx.s", h.hi, h.lo);
+  return buf;
+}
+
+// Adds `hit` and `miss` to the statistics file, and returns the
+// updated numbers in `hits` and `misses`.
+static void update_stats(long hit, long miss, long *hits, long *misses) {
+  *hits = *misses = 0;
+
+  int fd = open(entry_path("stats"), O_RDWR | O_CREAT, 0644);
+  if (fd < 0)
+    return;
+  flock(fd, LOCK_EX);
+
+  char buf[64] = {};
+  if (pread(fd, buf, sizeof(buf) - 1, 0) > 0) {
+    char *p;
+    *hits = strtol(buf, &p, 10);
+    *misses = strtol(p, &p, 10);
+  }
+
+  if (hit || miss) {
+    *hits += hit;
+    *misses += miss;
+    int len = sprintf(buf, "%ld %ld\n", *hits, *misses);
+    pwrite(fd, buf, len, 0);
+    ftruncate(fd, len);
+  }
+  close(fd);
+}
+
+// Looks up the cache. If found, appends the cached assembly to the
+// output and returns true.
+bool cache_lookup(char *key) {
+  long hits, misses;
+  char *path = entry_path(key);
+  mkdir(cache_dir, 0755);
+
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    update_stats(0, 1, &hits, &misses);
+    return false;
+  }
+
+  struct stat st;
+  fstat(fd, &st);
+  char *buf = malloc(st.st_size + 1);
+  long len = 0;
+  while (len < st.st_size) {
+    long n = read(fd, buf + len, st.st_size - len);
+    if (n <= 0)
+      break;
+    len += n;
+  }
+  close(fd);
+
+  if (len != st.st_size) {
+    free(buf);
+    update_stats(0, 1, &hits, &misses);
+    return false;
+  }
+
+  emitf("%.*s", (int)len, buf);
+  free(buf);
+
+  // Mark the entry as recently used.
+  utime(path, NULL);
+  update_stats(1, 0, &hits, &misses);
+  return true;
+}
+
+// Returns all entries in the cache directory.
+static CacheEntry *read_entries(int *len) {
+  *len = 0;
+  DIR *dir = opendir(cache_dir);
+  if (!dir)
+    return NULL;
+
+  int cap = 64;
+  CacheEntry *ents = malloc(sizeof(CacheEntry) * cap);
+
+  for (struct dirent *de = readdir(dir); de; de = readdir(dir)) {
+    char *name = de->d_name;
+    int namelen = strlen(name);
+    if (namelen < 3 || strcmp(name + namelen - 2, ".s"))
+      continue;
+
+    struct stat st;
+    char *path = entry_path(name);
+    if (stat(path, &st))
+      continue;
+
+    if (*len == cap) {
+      cap *= 2;
+      ents = realloc(ents, sizeof(CacheEntry) * cap);
+    }
+    ents[*len].name = path;
+    ents[*len].size = st.st_size;
+    ents[*len].atime = st.st_atim.tv_sec;
+    *len = *len + 1;
+  }
+
+  closedir(dir);
+  return ents;
+}
+
+// Removes least recently used entries until the cache is smaller
+// than 90% of the limit.
+static void evict(void) {
+  int len;
+  CacheEntry *ents = read_entries(&len);
+
+  long total = 0;
+  for (int i = 0; i < len; i++)
+    total += ents[i].size;
+  if (total <= cache_max_size) {
+    free(ents);
+    return;
+  }
+
+  // Sort entries by atime. Eviction is rare, so a simple
+  // insertion sort is good enough.
+  for (int i = 1; i < len; i++) {
+    CacheEntry e = ents[i];
+    int j = i;
+    for (; j > 0 && ents[j - 1].atime > e.atime; j--)
+      ents[j] = ents[j - 1];
+    ents[j] = e;
+  }
+
+  for (int i = 0; i < len && total > cache_max_size / 10 * 9; i++)
+    if (!unlink(ents[i].name))
+      total -= ents[i].size;
+  free(ents);
+}
+
+// Stores the assembly for a given key to the cache.
+void cache_store(char *key, char *p, long len) {
+  // Write to a temporary file first and then rename it, so that
+  // no one sees a partially written entry.
+  char *path = entry_path(key);
+  char *tmp = alloc_obj(AK_STRING, strlen(path) + 32);
+  sprintf(tmp, "%s.%d.tmp", path, getpid());
+
+  int fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0)
+    return;
+
+  while (len > 0) {
+    long n = write(fd, p, len);
+    if (n <= 0) {
+      close(fd);
+      unlink(tmp);
+      return;
+    }
+    p += n;
+    len -= n;
+  }
+  close(fd);
+
+  if (rename(tmp, path)) {
+    unlink(tmp);
+    return;
+  }
+  evict();
+}
+
+// Prints out the cache statistics to stderr.
+void print_cache_stats(void) {
+  long hits, misses;
+  update_stats(0, 0, &hits, &misses);
+
+  int len;
+  CacheEntry *ents = read_entries(&len);
+  long total = 0;
+  for (int i = 0; i < len; i++)
+    total += ents[i].size;
+  free(ents);
+
+  long lookups = hits + misses;
+  long pct = lookups ? hits * 1000 / lookups : 0;
+  fprintf(stderr, "cache %s: %ld hits, %ld misses ", cache_dir, hits, misses);
+  fprintf(stderr, "(%ld.%ld%% hit rate)\n", pct / 10, pct % 10);
+  fprintf(stderr, "cache %s: %d entries, %ld bytes (limit %ld bytes)\n",
+          cache_dir, len, total, cache_max_size);
+}
@@ -1,6 +1,12 @@
 #include "punyc.h"
 
+// The number of worker processes to generate functions with.
+int codegen_jobs = 1;
+
 static int top;
+
+// Labels are numbered from 1 in each function and qualified with
+// the function name, so that functions can be generated separately.
 static int labelseq = 1;
 static int brkseq;
 static int contseq;
@@ -10,6 +16,10 @@ static char *argreg32[] = {"edi", "esi", "edx", "ecx", "r8d", "r9d"};
 static char *argreg64[] = {"rdi", "rsi", "rdx", "rcx", "r8", "r9"};
 static char *funcname;
 
+// The last source location emitted by a .loc directive.
+static int loc_file_no;
+static int loc_lineno;
+
 static char *reg(int idx) {
   static char *r[] = {"r10", "r11", "r12", "r13", "r14", "r15"};
   if (idx < 0 || sizeof(r) / sizeof(*r) <= idx)
@@ -30,21 +40,31 @@ static char *regx(Type *ty, int idx) {
 static void gen_expr(Node *node);
 static void gen_stmt(Node *node);
 
+// Emits a .loc directive unless the line is the same as the one we
+// emitted last. The column is that of the first token on the line.
+static void emit_loc(Token *tok) {
+  if (tok->file->file_no == loc_file_no && tok->lineno == loc_lineno)
+    return;
+  loc_file_no = tok->file->file_no;
+  loc_lineno = tok->lineno;
+  println(".loc %d %d %d", tok->file->file_no, tok->lineno, get_column(tok));
+}
+
 // Pushes the given node's address to the stack.
 static void gen_addr(Node *node) {
   switch (node->kind) {
     case ND_VAR:
       if (node->var->is_local)
-        printf("  lea %s, [rbp-%d]\n", reg(top++), node->var->offset);
+        println("  lea %s, [rbp-%d]", reg(top++), node->var->offset);
       else
-        printf("  mov %s, offset %s\n", reg(top++), node->var->name);
+        println("  mov %s, offset %s", reg(top++), node->var->name);
       return;
     case ND_DEREF:
       gen_expr(node->lhs);
       return;
     case ND_MEMBER:
       gen_addr(node->lhs);
-      printf("  add %s, %d\n", reg(top - 1), node->member->offset);
+      println("  add %s, %d", reg(top - 1), node->member->offset);
       return;
     case ND_COMMA:
       gen_expr(node->lhs);
@@ -79,13 +99,13 @@ static void load(Type *ty) {
   // a long value to a register, it simply occupies the entire register.
   int sz = size_of(ty);
   if (sz == 1)
-    printf("  %s %s, byte ptr [%s]\n", insn, rd, rs);
+    println("  %s %s, byte ptr [%s]", insn, rd, rs);
   else if (sz == 2)
-    printf("  %s %s, word ptr [%s]\n", insn, rd, rs);
+    println("  %s %s, word ptr [%s]", insn, rd, rs);
   else if (sz == 4)
-    printf("  mov %s, dword ptr [%s]\n", rd, rs);
+    println("  mov %s, dword ptr [%s]", rd, rs);
   else
-    printf("  mov %s, [%s]\n", rd, rs);
+    println("  mov %s, [%s]", rd, rs);
 }
 
 static void store(Type *ty) {
@@ -95,17 +115,17 @@ static void store(Type *ty) {
 
   if (ty->kind == TY_STRUCT){
     for (int i = 0; i < ty->size; i++) {
-      printf("  mov al, [%s+%d]\n", rs, i);
-      printf("  mov [%s+%d], al\n", rd, i);
+      println("  mov al, [%s+%d]", rs, i);
+      println("  mov [%s+%d], al", rd, i);
     }
   } else if (sz == 1){
-    printf("  mov [%s], %sb\n", rd, rs);
+    println("  mov [%s], %sb", rd, rs);
   } else if (sz == 2) {
-    printf("  mov [%s], %sw\n", rd, rs);
+    println("  mov [%s], %sw", rd, rs);
   } else if (sz == 4){
-    printf("  mov [%s], %sd\n", rd, rs);
+    println("  mov [%s], %sd", rd, rs);
   } else {
-    printf("  mov [%s], %s\n", rd, rs);
+    println("  mov [%s], %s", rd, rs);
   }
 
   top--;
@@ -118,59 +138,59 @@ static void cast(Type *from, Type *to) {
   char *r = reg(top - 1);
 
   if (to->kind == TY_BOOL) {
-    printf("  cmp %s, 0\n", r);
-    printf("  setne %sb\n", r);
-    printf("  movzx %s, %sb\n", r, r);
+    println("  cmp %s, 0", r);
+    println("  setne %sb", r);
+    println("  movzx %s, %sb", r, r);
     return;
   }
 
   char *insn = to->is_unsigned ? "movzx" : "movsx";
 
   if (size_of(to) == 1) {
-    printf("  %s %s, %sb\n", insn, r, r);
+    println("  %s %s, %sb", insn, r, r);
   } else if (size_of(to) == 2) {
-    printf("  %s %s, %sw\n", insn, r, r);
+    println("  %s %s, %sw", insn, r, r);
   } else if (size_of(to) == 4) {
-    printf("  mov %sd, %sd\n", r, r);
+    println("  mov %sd, %sd", r, r);
   } else if (!from->base && size_of(from) < 8 && !from->is_unsigned) {
-    printf("  movsx %s, %sd\n", r, r);
+    println("  movsx %s, %sd", r, r);
   }
 }
 
 static void divmod(Node *node, char *rd, char *rs, char *r64, char *r32) {
     if (size_of(node->ty) == 8) {
-      printf("  mov rax, %s\n", rd);
+      println("  mov rax, %s", rd);
       if (node->ty->is_unsigned) {
-        printf("  mov rdx, 0\n");
-        printf("  div %s\n", rs);
+        println("  mov rdx, 0");
+        println("  div %s", rs);
       } else {
-        printf("  cqo\n");
-        printf("  idiv %s\n", rs);
+        println("  cqo");
+        println("  idiv %s", rs);
       }
-      printf("  mov %s, %s\n", rd, r64);
+      println("  mov %s, %s", rd, r64);
     } else {
-      printf("  mov eax, %s\n", rd);
+      println("  mov eax, %s", rd);
       if (node->ty->is_unsigned) {
-        printf("  mov edx, 0\n");
-        printf("  div %s\n", rs);
+        println("  mov edx, 0");
+        println("  div %s", rs);
       } else {
-        printf("  cdq\n");
-        printf("  idiv %s\n", rs);
+        println("  cdq");
+        println("  idiv %s", rs);
       }
-      printf("  mov %s, %s\n", rd, r32);
+      println("  mov %s, %s", rd, r32);
     }
 }
 
 // Generate code for a given node.
 static void gen_expr(Node *node) {
-  printf(".loc %d %d\n", node->tok->file_no, node->tok->lineno);
+  emit_loc(node->tok);
 
   switch (node->kind) {
     case ND_NUM:
       if (node->ty->kind == TY_LONG)
-        printf("  movabs %s, %ld\n", reg(top++), node->val);
+        println("  movabs %s, %ld", reg(top++), node->val);
       else
-        printf("  mov %s, %ld\n", reg(top++), node->val);
+        println("  mov %s, %ld", reg(top++), node->val);
       return;
     case ND_VAR:
     case ND_MEMBER:
@@ -211,64 +231,64 @@ static void gen_expr(Node *node) {
     case ND_COND: {
       int seq = labelseq++;
       gen_expr(node->cond);
-      printf("  cmp %s, 0\n", reg(--top));
-      printf("  je  .L.else.%d\n", seq);
+      println("  cmp %s, 0", reg(--top));
+      println("  je  .L.else.%s.%d", funcname, seq);
       gen_expr(node->then);
       top--;
-      printf("  jmp .L.end.%d\n", seq);
-      printf(".L.else.%d:\n", seq);
+      println("  jmp .L.end.%s.%d", funcname, seq);
+      println(".L.else.%s.%d:", funcname, seq);
       gen_expr(node->els);
-      printf(".L.end.%d:\n", seq);
+      println(".L.end.%s.%d:", funcname, seq);
       return;
     }
     case ND_NOT:
       gen_expr(node->lhs);
-      printf("  cmp %s, 0\n", reg(top - 1));
-      printf("  sete %sb\n", reg(top - 1));
-      printf("  movzx %s, %sb\n", reg(top - 1), reg(top - 1));
+      println("  cmp %s, 0", reg(top - 1));
+      println("  sete %sb", reg(top - 1));
+      println("  movzx %s, %sb", reg(top - 1), reg(top - 1));
       return;
     case ND_BITNOT:
       gen_expr(node->lhs);
-      printf("  not %s\n", reg(top - 1));
+      println("  not %s", reg(top - 1));
       return;
     case ND_LOGAND: {
       int seq = labelseq++;
       gen_expr(node->lhs);
-      printf("  cmp %s, 0\n", reg(--top));
-      printf("  je .L.false.%d\n", seq);
+      println("  cmp %s, 0", reg(--top));
+      println("  je .L.false.%s.%d", funcname, seq);
       gen_expr(node->rhs);
-      printf("  cmp %s, 0\n", reg(--top));
-      printf("  je .L.false.%d\n", seq);
-      printf("  mov %s, 1\n", reg(top));
-      printf("  jmp .L.end.%d\n", seq);
-      printf(".L.false.%d:\n", seq);
-      printf("  mov %s, 0\n", reg(top++));
-      printf(".L.end.%d:\n", seq);
+      println("  cmp %s, 0", reg(--top));
+      println("  je .L.false.%s.%d", funcname, seq);
+      println("  mov %s, 1", reg(top));
+      println("  jmp .L.end.%s.%d", funcname, seq);
+      println(".L.false.%s.%d:", funcname, seq);
+      println("  mov %s, 0", reg(top++));
+      println(".L.end.%s.%d:", funcname, seq);
       return;
     }
     case ND_LOGOR: {
       int seq = labelseq++;
       gen_expr(node->lhs);
-      printf("  cmp %s, 0\n", reg(--top));
-      printf("  jne .L.true.%d\n", seq);
+      println("  cmp %s, 0", reg(--top));
+      println("  jne .L.true.%s.%d", funcname, seq);
       gen_expr(node->rhs);
-      printf("  cmp %s, 0\n", reg(--top));
-      printf("  jne .L.true.%d\n", seq);
-      printf("  mov %s, 0\n", reg(top));
-      printf("  jmp .L.end.%d\n", seq);
-      printf(".L.true.%d:\n", seq);
-      printf("  mov %s, 1\n", reg(top++));
-      printf(".L.end.%d:\n", seq);
+      println("  cmp %s, 0", reg(--top));
+      println("  jne .L.true.%s.%d", funcname, seq);
+      println("  mov %s, 0", reg(top));
+      println("  jmp .L.end.%s.%d", funcname, seq);
+      println(".L.true.%s.%d:", funcname, seq);
+      println("  mov %s, 1", reg(top++));
+      println(".L.end.%s.%d:", funcname, seq);
       return;
     }
     case ND_FUNCALL: {
       if (node->lhs->kind == ND_VAR &&
           !strcmp(node->lhs->var->name, "__builtin_va_start")) {
         gen_expr(node->args);
-        printf("  mov eax, [rbp-40]\n");
-        printf("  mov [%s], eax\n", reg(top - 1));
-        printf("  lea rax, [rbp-88]\n");
-        printf("  mov [%s+16], rax\n", reg(top - 1));
+        println("  mov eax, [rbp-40]");
+        println("  mov [%s], eax", reg(top - 1));
+        println("  lea rax, [rbp-88]");
+        println("  mov [%s+16], rax", reg(top - 1));
         return;
       }
       // Save all temporary registers to the stack before evaluating
@@ -279,47 +299,47 @@ static void gen_expr(Node *node) {
       int top_orig = top;
       top = 0;
 
-      printf("  push r10\n");
-      printf("  push r11\n");
-      printf("  push r12\n");
-      printf("  push r13\n");
-      printf("  push r14\n");
-      printf("  push r15\n");
+      println("  push r10");
+      println("  push r11");
+      println("  push r12");
+      println("  push r13");
+      println("  push r14");
+      println("  push r15");
 
       int nargs = 0;
       for (Node *arg = node->args; arg; arg = arg->next) {
         gen_expr(arg);
-        printf("  push %s\n", reg(--top));
-        printf("  sub rsp, 8\n");
+        println("  push %s", reg(--top));
+        println("  sub rsp, 8");
         nargs++;
       }
 
       gen_expr(node->lhs);
 
       for (int i = nargs - 1; i >= 0; i--) {
-        printf("  add rsp, 8\n");
-        printf("  pop %s\n", argreg64[i]);
+        println("  add rsp, 8");
+        println("  pop %s", argreg64[i]);
       }
 
-      printf("  mov rax, 0\n");
-      printf("  call %s\n", reg(--top));
+      println("  mov rax, 0");
+      println("  call %s", reg(--top));
 
       // The System V x86-64 ABI has a special rule ragarding a boolean
       // return value that only the lower 8 bits are valid for it and
       // the upper 56 bits may contain garbage. Here, we claer the upper
       // 56 bits.
       if (node->ty->kind == TY_BOOL)
-        printf("  movzx eax, al\n");
+        println("  movzx eax, al");
 
       top = top_orig;
-      printf("  pop r15\n");
-      printf("  pop r14\n");
-      printf("  pop r13\n");
-      printf("  pop r12\n");
-      printf("  pop r11\n");
-      printf("  pop r10\n");
-
-      printf("  mov %s, rax\n", reg(top++));
+      println("  pop r15");
+      println("  pop r14");
+      println("  pop r13");
+      println("  pop r12");
+      println("  pop r11");
+      println("  pop r10");
+
+      println("  mov %s, rax", reg(top++));
       return;
   }
   }
@@ -334,13 +354,13 @@ static void gen_expr(Node *node) {
 
   switch (node->kind) {
   case ND_ADD:
-    printf("  add %s, %s\n", rd, rs);
+    println("  add %s, %s", rd, rs);
     return;
   case ND_SUB:
-    printf("  sub %s, %s\n", rd, rs);
+    println("  sub %s, %s", rd, rs);
     return;
   case ND_MUL:
-    printf("  imul %s, %s\n", rd, rs);
+    println("  imul %s, %s", rd, rs);
     return;
   case ND_DIV:
     divmod(node, rd, rs, "rax", "eax");
@@ -349,50 +369,50 @@ static void gen_expr(Node *node) {
     divmod(node, rd, rs, "rdx", "edx");
     return;
   case ND_BITAND:
-    printf("  and %s, %s\n", rd, rs);
+    println("  and %s, %s", rd, rs);
     return;
   case ND_BITOR:
-    printf("  or %s, %s\n", rd, rs);
+    println("  or %s, %s", rd, rs);
     return;
   case ND_BITXOR:
-    printf("  xor %s, %s\n", rd, rs);
+    println("  xor %s, %s", rd, rs);
     return;
   case ND_EQ:
-    printf("  cmp %s, %s\n", rd, rs);
-    printf("  sete al\n");
-    printf("  movzb %s, al\n", rd);
+    println("  cmp %s, %s", rd, rs);
+    println("  sete al");
+    println("  movzb %s, al", rd);
     return;
   case ND_NE:
-    printf("  cmp %s, %s\n", rd, rs);
-    printf("  setne al\n");
-    printf("  movzb %s, al\n", rd);
+    println("  cmp %s, %s", rd, rs);
+    println("  setne al");
+    println("  movzb %s, al", rd);
     return;
   case ND_LT:
-    printf("  cmp %s, %s\n", rd, rs);
+    println("  cmp %s, %s", rd, rs);
     if (node->lhs->ty->is_unsigned)
-      printf("  setb al\n");
+      println("  setb al");
     else
-      printf("  setl al\n");
-    printf("  movzb %s, al\n", rd);
+      println("  setl al");
+    println("  movzb %s, al", rd);
     return;
   case ND_LE:
-    printf("  cmp %s, %s\n", rd, rs);
+    println("  cmp %s, %s", rd, rs);
     if (node->lhs->ty->is_unsigned)
-      printf("  setbe al\n");
+      println("  setbe al");
     else
-      printf("  setle al\n");
-    printf("  movzb %s, al\n", rd);
+      println("  setle al");
+    println("  movzb %s, al", rd);
     return;
   case ND_SHL:
-    printf("  mov rcx, %s\n", reg(top));
-    printf("  shl %s, cl\n", rd);
+    println("  mov rcx, %s", reg(top));
+    println("  shl %s, cl", rd);
     return;
   case ND_SHR:
-    printf("  mov rcx, %s\n", reg(top));
+    println("  mov rcx, %s", reg(top));
     if (node->lhs->ty->is_unsigned)
-      printf("  shr %s, cl\n", rd);
+      println("  shr %s, cl", rd);
     else
-      printf("  sar %s, cl\n", rd);
+      println("  sar %s, cl", rd);
     return;
   default:
     error_tok(node->tok, "invalid expression");
@@ -400,26 +420,26 @@ static void gen_expr(Node *node) {
 }
 
 static void gen_stmt(Node *node) {
-  printf(".loc %d %d\n", node->tok->file_no, node->tok->lineno);
+  emit_loc(node->tok);
 
   switch (node->kind) {
   case ND_IF: {
     int seq = labelseq++;
     if (node->els) {
       gen_expr(node->cond);
-      printf("  cmp %s, 0\n", reg(--top));
-      printf("  je .L.else.%d\n", seq);
+      println("  cmp %s, 0", reg(--top));
+      println("  je .L.else.%s.%d", funcname, seq);
       gen_stmt(node->then);
-      printf("  jmp .L.end.%d\n", seq);
-      printf(".L.else.%d:\n", seq);
+      println("  jmp .L.end.%s.%d", funcname, seq);
+      println(".L.else.%s.%d:", funcname, seq);
       gen_stmt(node->els);
-      printf(".L.end.%d:\n", seq);
+      println(".L.end.%s.%d:", funcname, seq);
     } else {
       gen_expr(node->cond);
-      printf("  cmp %s, 0\n", reg(--top));
-      printf("  je .L.end.%d\n", seq);
+      println("  cmp %s, 0", reg(--top));
+      println("  je .L.end.%s.%d", funcname, seq);
       gen_stmt(node->then);
-      printf(".L.end.%d:\n", seq);
+      println(".L.end.%s.%d:", funcname, seq);
     }
     return;
   }
@@ -431,18 +451,18 @@ static void gen_stmt(Node *node) {
 
     if (node->init)
       gen_stmt(node->init);
-    printf(".L.begin.%d:\n", seq);
+    println(".L.begin.%s.%d:", funcname, seq);
     if (node->cond) {
       gen_expr(node->cond);
-      printf("  cmp %s, 0\n", reg(--top));
-      printf("  je .L.break.%d\n", seq);
+      println("  cmp %s, 0", reg(--top));
+      println("  je .L.break.%s.%d", funcname, seq);
     }
     gen_stmt(node->then);
-    printf(".L.continue.%d:\n", seq);
+    println(".L.continue.%s.%d:", funcname, seq);
     if(node->inc)
       gen_stmt(node->inc);
-    printf("  jmp .L.begin.%d\n", seq);
-    printf(".L.break.%d:\n", seq);
+    println("  jmp .L.begin.%s.%d", funcname, seq);
+    println(".L.break.%s.%d:", funcname, seq);
 
     brkseq = brk;
     contseq = cont;
@@ -454,13 +474,13 @@ static void gen_stmt(Node *node) {
     int count = contseq;
     brkseq = contseq = seq;
 
-    printf(".L.begin.%d:\n", seq);
+    println(".L.begin.%s.%d:", funcname, seq);
     gen_stmt(node->then);
-    printf(".L.continue.%d:\n", seq);
+    println(".L.continue.%s.%d:", funcname, seq);
     gen_expr(node->cond);
-    printf("  cmp %s, 0\n", reg(--top));
-    printf("  jne .L.begin.%d\n", seq);
-    printf(".L.break.%d:\n", seq);
+    println("  cmp %s, 0", reg(--top));
+    println("  jne .L.begin.%s.%d", funcname, seq);
+    println(".L.break.%s.%d:", funcname, seq);
 
     brkseq = brk;
     contseq = count;
@@ -477,8 +497,8 @@ static void gen_stmt(Node *node) {
     for (Node *n = node->case_next; n; n = n->case_next) {
       n->case_label = labelseq++;
       n->case_end_label = seq;
-      printf("  cmp %s, %ld\n", reg(top - 1), n->val);
-      printf("  je .L.case.%d\n", n->case_label);
+      println("  cmp %s, %ld", reg(top - 1), n->val);
+      println("  je .L.case.%s.%d", funcname, n->case_label);
     }
     top--;
 
@@ -486,18 +506,18 @@ static void gen_stmt(Node *node) {
       int i = labelseq++;
       node->default_case->case_end_label = seq;
       node->default_case->case_label = i;
-      printf("  jmp .L.case.%d\n", i);
+      println("  jmp .L.case.%s.%d", funcname, i);
     }
 
-    printf("  jmp .L.break.%d\n", seq);
+    println("  jmp .L.break.%s.%d", funcname, seq);
     gen_stmt(node->then);
-    printf(".L.break.%d:\n", seq);
+    println(".L.break.%s.%d:", funcname, seq);
 
     brkseq = brk;
     return;
   }
   case ND_CASE:
-    printf(".L.case.%d:\n", node->case_label);
+    println(".L.case.%s.%d:", funcname, node->case_label);
     gen_stmt(node->lhs);
     return;
   case ND_BLOCK:
@@ -507,26 +527,26 @@ static void gen_stmt(Node *node) {
   case ND_BREAK:
     if (brkseq == 0)
       error_tok(node->tok, "stray break");
-    printf("  jmp .L.break.%d\n", brkseq);
+    println("  jmp .L.break.%s.%d", funcname, brkseq);
     return;
   case ND_CONTINUE:
     if (contseq == 0)
       error_tok(node->tok, "stray continue");
-    printf("  jmp .L.continue.%d\n", contseq);
+    println("  jmp .L.continue.%s.%d", funcname, contseq);
     return;
   case ND_GOTO:
-    printf("  jmp .L.label.%s.%s\n", funcname, node->label_name);
+    println("  jmp .L.label.%s.%s", funcname, node->label_name);
     return;
   case ND_LABEL:
-    printf(".L.label.%s.%s:\n", funcname, node->label_name);
+    println(".L.label.%s.%s:", funcname, node->label_name);
     gen_stmt(node->lhs);
     return;
   case ND_RETURN:
     if (node->lhs) {
       gen_expr(node->lhs);
-      printf("  mov rax, %s\n", reg(--top));
+      println("  mov rax, %s", reg(--top));
     }
-    printf("  jmp .L.return.%s\n", funcname);
+    println("  jmp .L.return.%s", funcname);
     return;
   case ND_EXPR_STMT:
     gen_expr(node->lhs);
@@ -538,50 +558,53 @@ static void gen_stmt(Node *node) {
 }
 
 static void emit_data(Program *prog) {
-  printf(".bss\n");
+  println(".bss");
 
   for (Var *var = prog->globals; var; var = var->next) {
     if (var->initializer)
       continue;
 
-    printf(".align %d\n", var->align);
+    println(".align %d", var->align);
     if (!var->is_static)
-      printf(".globl %s\n", var->name);
-    printf("%s:\n", var->name);
-    printf("  .zero %d\n", size_of(var->ty));
+      println(".globl %s", var->name);
+    println("%s:", var->name);
+    println("  .zero %d", size_of(var->ty));
   }
 
-  printf(".data\n");
+  println(".data");
 
   for (Var *var = prog->globals; var; var = var->next) {
     if (!var->initializer)
       continue;
 
-    printf(".align %d\n", var->align);
+    println(".align %d", var->align);
     if (!var->is_static)
-      printf(".globl %s\n", var->name);
-    printf("%s:\n", var->name);
+      println(".globl %s", var->name);
+    println("%s:", var->name);
 
     int offset = 0;
     for (GvarInitializer *init = var->initializer; init; init = init->next) {
       if (offset < init->offset)
-        printf("  .zero %d\n", init->offset - offset);
+        println("  .zero %d", init->offset - offset);
       offset = init->offset + init->sz;
 
-      if (init->label)
-        printf("  .quad %s%+ld\n", init->label, init->addend);
+      if (init->bytes)
+        for (int i = 0; i < init->sz; i++)
+          println("  .byte %d", init->bytes[i]);
+      else if (init->label)
+        println("  .quad %s%+ld", init->label, init->addend);
       else if (init->sz == 1)
-        printf("  .byte %ld\n", init->val);
+        println("  .byte %ld", init->val);
       else if (init->sz == 2)
-        printf("  .short %ld\n", init->val);
+        println("  .short %ld", init->val);
       else if (init->sz == 4)
-        printf("  .long %ld\n", init->val);
+        println("  .long %ld", init->val);
       else
-        printf("  .quad %ld\n", init->val);
+        println("  .quad %ld", init->val);
     }
 
     if (offset < size_of(var->ty))
-      printf("  .zero %d\n", size_of(var->ty) - offset);
+      println("  .zero %d", size_of(var->ty) - offset);
   }
 }
 
@@ -596,69 +619,193 @@ static char *get_argreg(int sz, int idx) {
   return argreg64[idx];
 }
 
-static void emit_text(Program *prog) {
-  printf(".text\n");
+static void emit_function(Function *fn) {
+  if (!fn->is_static)
+    println(".globl %s", fn->name);
+  println("%s:", fn->name);
+  funcname = fn->name;
+  labelseq = 1;
+  loc_file_no = loc_lineno = 0;
+
+  //Prologue. r12-r15 are callee-saved registers.
+  println("  push rbp");
+  println("  mov rbp, rsp");
+  println("  sub rsp, %d", fn->stack_size);
+  println("  mov [rbp-8], r12");
+  println("  mov [rbp-16], r13");
+  println("  mov [rbp-24], r14");
+  println("  mov [rbp-32], r15");
+
+  // Save arg registers if funtion is variadic
+  if (fn->is_varargs) {
+    int n = 0;
+    for (Var *var = fn->params; var; var = var->next)
+      n++;
+
+    println("  mov [rbp-88], rdi");
+    println("  mov [rbp-80], rsi");
+    println("  mov [rbp-72], rdx");
+    println("  mov [rbp-64], rcx");
+    println("  mov [rbp-56], r8");
+    println("  mov [rbp-48], r9");
+    println("  mov dword ptr [rbp-40], %d", n * 8);
+  }
 
-  for (Function *fn = prog->fns; fn; fn = fn->next) {
-    if (!fn->is_static)
-      printf(".globl %s\n", fn->name);
-    printf("%s:\n", fn->name);
-    funcname = fn->name;
-
-    //Prologue. r12-r15 are callee-saved registers.
-    printf("  push rbp\n");
-    printf("  mov rbp, rsp\n");
-    printf("  sub rsp, %d\n", fn->stack_size);
-    printf("  mov [rbp-8], r12\n");
-    printf("  mov [rbp-16], r13\n");
-    printf("  mov [rbp-24], r14\n");
-    printf("  mov [rbp-32], r15\n");
-
-    // Save arg registers if funtion is variadic
-    if (fn->is_varargs) {
-      int n = 0;
-      for (Var *var = fn->params; var; var = var->next)
-        n++;
-
-      printf("  mov [rbp-88], rdi\n");
-      printf("  mov [rbp-80], rsi\n");
-      printf("  mov [rbp-72], rdx\n");
-      printf("  mov [rbp-64], rcx\n");
-      printf("  mov [rbp-56], r8\n");
-      printf("  mov [rbp-48], r9\n");
-      printf("  mov dword ptr [rbp-40], %d\n", n * 8);
-    }
+  // Push arguments to the stack
+  int i = 0;
+  for (Var *var = fn->params; var; var = var->next)
+    i++;
 
-    // Push arguments to the stack
-    int i = 0;
-    for (Var *var = fn->params; var; var = var->next)
-      i++;
+  for (Var *var = fn->params; var; var = var->next) {
+    char *r = get_argreg(size_of(var->ty), --i);
+    println("  mov [rbp-%d], %s", var->offset, r);
+  }
 
-    for (Var *var = fn->params; var; var = var->next) {
-      char *r = get_argreg(size_of(var->ty), --i);
-      printf("  mov [rbp-%d], %s\n", var->offset, r);
-    }
+  // Emit code
+  for (Node *n = fn->node; n; n = n->next) {
+    gen_stmt(n);
+    assert(top == 0);
+  }
 
-    // Emit code
-    for (Node *n = fn->node; n; n = n->next) {
-      gen_stmt(n);
-      assert(top == 0);
+  // Epilogue
+  println(".L.return.%s:", funcname);
+  println("  mov r12, [rbp-8]");
+  println("  mov r13, [rbp-16]");
+  println("  mov r14, [rbp-24]");
+  println("  mov r15, [rbp-32]");
+  println("  mov rsp, rbp");
+  println("  pop rbp");
+  println("  ret");
+}
+
+// Forking a worker process and collecting its output costs about as
+// much as generating code for this many AST nodes, so each worker
+// is given at least this many.
+enum { MIN_JOB_NODES = 50000 };
+
+// Generates functions in parallel using up to `codegen_jobs` worker
+// processes, each of which takes a run of consecutive functions.
+// Their outputs are concatenated in the original order. Since labels
+// are local to each function, the output is byte-identical to the
+// one generated by a single process.
+static void emit_text_parallel(Function **fns, int nfns, long total) {
+  int njobs = codegen_jobs;
+  if (njobs > total / MIN_JOB_NODES)
+    njobs = total / MIN_JOB_NODES;
+
+  int *pids = calloc(njobs, sizeof(int));
+  int *fds = calloc(njobs, sizeof(int));
+  int nworkers = 0;
+  int begin = 0;
+
+  while (begin < nfns) {
+    // Take functions until this worker gets its share of nodes.
+    int end = begin;
+    long nodes = 0;
+    long share = total / njobs;
+    do {
+      nodes += fns[end++]->nr_nodes;
+    } while (end < nfns && nodes < share && nworkers < njobs - 1);
+    if (nworkers == njobs - 1)
+      end = nfns;
+
+    int pfd[2];
+    if (pipe(pfd))
+      error("pipe failed: %s", strerror(errno));
+
+    int pid = fork();
+    if (pid < 0)
+      error("fork failed: %s", strerror(errno));
+
+    if (pid == 0) {
+      close(pfd[0]);
+      for (int i = 0; i < nworkers; i++)
+        close(fds[i]);
+
+      // Drop the output inherited from the parent, and collect ours
+      // in memory so that we don't block on the pipe while others
+      // are still working.
+      take_output();
+      capture_output();
+
+      for (int i = begin; i < end; i++)
+        emit_function(fns[i]);
+
+      char *p = take_output();
+      dup2(pfd[1], 1);
+      open_output(NULL);
+      write_output(p, strlen(p));
+      exit(0);
     }
 
-    // Epilogue
-    printf(".L.return.%s:\n", funcname);
-    printf("  mov r12, [rbp-8]\n");
-    printf("  mov r13, [rbp-16]\n");
-    printf("  mov r14, [rbp-24]\n");
-    printf("  mov r15, [rbp-32]\n");
-    printf("  mov rsp, rbp\n");
-    printf("  pop rbp\n");
-    printf("  ret\n");
+    close(pfd[1]);
+    pids[nworkers] = pid;
+    fds[nworkers] = pfd[0];
+    nworkers++;
+    begin = end;
+  }
+
+  bool failed = false;
+  for (int i = 0; i < nworkers; i++) {
+    char *p = read_all(fds[i]);
+    close(fds[i]);
+
+    int status;
+    while (waitpid(pids[i], &status, 0) < 0)
+      if (errno != EINTR)
+        error("waitpid failed: %s", strerror(errno));
+
+    if (status != 0)
+      failed = true;
+    else if (!failed)
+      emitf("%s", p);
+    free(p);
+  }
+
+  // A worker has reported the error.
+  if (failed)
+    exit(1);
+
+  free(pids);
+  free(fds);
+}
+
+static void emit_text(Program *prog) {
+  println(".text");
+
+  int nfns = 0;
+  long total = 0;
+  for (Function *fn = prog->fns; fn; fn = fn->next) {
+    nfns++;
+    total += fn->nr_nodes;
   }
+
+  if (codegen_jobs > 1 && nfns > 1 && total >= MIN_JOB_NODES * 2) {
+    Function **fns = calloc(nfns, sizeof(Function *));
+    int i = 0;
+    for (Function *fn = prog->fns; fn; fn = fn->next)
+      fns[i++] = fn;
+    emit_text_parallel(fns, nfns, total);
+    free(fns);
+    return;
+  }
+
+  for (Function *fn = prog->fns; fn; fn = fn->next)
+    emit_function(fn);
 }
 
 void codegen(Program *prog) {
-  printf(".intel_syntax noprefix\n");
+  println(".intel_syntax noprefix");
+
+  long start = output_size();
+  timer_start(PH_EMIT_DATA);
   emit_data(prog);
+  timer_stop();
+  timer_count(PH_EMIT_DATA, output_size() - start);
+
+  start = output_size();
+  timer_start(PH_EMIT_TEXT);
   emit_text(prog);
+  timer_stop();
+  timer_count(PH_EMIT_TEXT, output_size() - start);
 }
\ No newline at end of file
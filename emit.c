@@ -0,0 +1,208 @@
+// This file implements the output buffer for generated assembly.
+//
+// Codegen produces a very large number of short lines. Instead of
+// calling printf for each of them, we format lines ourselves into
+// an append-only buffer and hand the buffer to the kernel with
+// write(2) in large chunks.
+
+#include "punyc.h"
+
+enum { FLUSH_SIZE = 1 << 20 };
+
+static int out_fd = 1;
+static char *buf;
+static long buf_len;
+static long buf_cap;
+
+// Total number of bytes produced so far.
+static long total_len;
+
+// If true, output is kept in the buffer until it is taken by
+// take_output() instead of being written out.
+static bool capturing;
+
+// Opens the output file. If path is NULL, output goes to stdout.
+void open_output(char *path) {
+  if (!path) {
+    out_fd = 1;
+    return;
+  }
+
+  out_fd = creat(path, 0644);
+  if (out_fd < 0)
+    error("cannot open output file %s: %s", path, strerror(errno));
+}
+
+static void write_all(char *p, long len) {
+  while (len > 0) {
+    long n = write(out_fd, p, len);
+    if (n < 0) {
+      if (errno == EINTR)
+        continue;
+      error("write failed: %s", strerror(errno));
+    }
+    p += n;
+    len -= n;
+  }
+}
+
+// Writes the buffered output out to the output file.
+void flush_output(void) {
+  write_all(buf, buf_len);
+  buf_len = 0;
+}
+
+// Writes a given data to the output file.
+void write_output(char *p, long len) {
+  flush_output();
+  write_all(p, len);
+}
+
+static void put(char *s, long len) {
+  if (buf_len + len > buf_cap) {
+    while (buf_len + len > buf_cap)
+      buf_cap = buf_cap ? buf_cap * 2 : FLUSH_SIZE * 2;
+    buf = realloc(buf, buf_cap);
+  }
+  memcpy(buf + buf_len, s, len);
+  buf_len += len;
+  total_len += len;
+}
+
+// Keeps subsequent output in memory.
+void capture_output(void) {
+  capturing = true;
+}
+
+// Returns the captured output as a null-terminated string.
+char *take_output(void) {
+  put("", 1);
+  char *p = buf;
+  buf = NULL;
+  buf_len = buf_cap = 0;
+  capturing = false;
+  return p;
+}
+
+static void put_long(long val, bool plus) {
+  char tmp[24];
+  int i = sizeof(tmp);
+  unsigned long u = val;
+  if (val < 0)
+    u = -u;
+
+  do {
+    tmp[--i] = '0' + u % 10;
+    u /= 10;
+  } while (u);
+
+  if (val < 0)
+    tmp[--i] = '-';
+  else if (plus)
+    tmp[--i] = '+';
+  put(tmp + i, sizeof(tmp) - i);
+}
+
+// punyc doesn't support va_arg() yet, so we fetch integer-class
+// arguments right out of the va_list as defined by the x86-64 psABI:
+// the first six come from the register save area and the rest from
+// the overflow area on the stack.
+static long next_arg(va_list ap) {
+  if (ap->gp_offset < 48) {
+    long *p = (long *)((char *)ap->reg_save_area + ap->gp_offset);
+    ap->gp_offset += 8;
+    return *p;
+  }
+
+  long *p = ap->overflow_arg_area;
+  ap->overflow_arg_area = p + 1;
+  return *p;
+}
+
+// A tiny replacement for vprintf. Supported conversions are %s,
+// %.*s, %d, %ld, %+ld and %%, which are all that we need.
+static void format(char *fmt, va_list ap) {
+  char *p = fmt;
+
+  for (;;) {
+    char *start = p;
+    while (*p && *p != '%')
+      p++;
+    if (start < p)
+      put(start, p - start);
+    if (*p == '\0')
+      return;
+    p++;
+
+    if (*p == '%') {
+      put(p++, 1);
+      continue;
+    }
+
+    if (*p == 's') {
+      char *s = (char *)next_arg(ap);
+      put(s, strlen(s));
+      p++;
+      continue;
+    }
+
+    if (!strncmp(p, ".*s", 3)) {
+      int len = next_arg(ap);
+      put((char *)next_arg(ap), len);
+      p += 3;
+      continue;
+    }
+
+    if (*p == 'd') {
+      put_long((int)next_arg(ap), false);
+      p++;
+      continue;
+    }
+
+    if (!strncmp(p, "ld", 2)) {
+      put_long(next_arg(ap), false);
+      p += 2;
+      continue;
+    }
+
+    if (!strncmp(p, "+ld", 3)) {
+      put_long(next_arg(ap), true);
+      p += 3;
+      continue;
+    }
+
+    error("internal error: unsupported format: %s", fmt);
+  }
+}
+
+// Appends formatted text to the output.
+void emitf(char *fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  format(fmt, ap);
+  va_end(ap);
+}
+
+// Appends a formatted line to the output.
+void println(char *fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  format(fmt, ap);
+  va_end(ap);
+  put("\n", 1);
+
+  if (buf_len >= FLUSH_SIZE && !capturing)
+    flush_output();
+}
+
+// Returns the number of bytes produced so far.
+long output_size(void) {
+  return total_len;
+}
+
+// Returns the output produced since output_size() returned `pos`.
+// This is valid only while output is being captured.
+char *output_since(long pos) {
+  assert(capturing);
+  return buf + buf_len - (total_len - pos);
+}
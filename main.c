@@ -1,13 +1,28 @@
 #include "punyc.h"
 
 bool preprocess_only;
-static char *input_file;
+bool output_object;
+char *include_pch;
+
+static char **input_files;
+static int nr_input_files;
+static char *output_path;
+static int nr_jobs = 1;
+static bool emit_pch;
 
 static void usage(void) {
-  fprintf(stderr, "punyc [ -I<path> ] <file>\n");
+  fprintf(stderr, "punyc [ -E | -c ] [ -j <jobs> ] [ -o <path> ] [ -ftime-report[=json] ] [ -fmem-report ] [ -fpp-report ] [ -fno-fast-lexer ] [ -fcache-dir=<dir> [ -fcache-size=<bytes> ] [ -fcache-stats ] ] [ -include-pch <file> ] <file>...\n");
+  fprintf(stderr, "punyc --emit-pch -o <file> <header>\n");
+  fprintf(stderr, "punyc --server <socket>\n");
+  fprintf(stderr, "punyc --client <socket> <args>...\n");
   exit(1);
 }
 
+static void add_input_file(char *path) {
+  input_files = realloc(input_files, sizeof(char *) * (nr_input_files + 1));
+  input_files[nr_input_files++] = path;
+}
+
 static void parse_args(int argc, char **argv) {
   for (int i = 1; i < argc; i++) {
     if (!strcmp(argv[i], "--help"))
@@ -18,43 +33,175 @@ static void parse_args(int argc, char **argv) {
       continue;
     }
 
+    if (!strcmp(argv[i], "-c")) {
+      output_object = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-ftime-report")) {
+      time_report = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-ftime-report=json")) {
+      time_report = true;
+      time_report_json = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fno-fast-lexer")) {
+      fast_lexer = false;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fmem-report")) {
+      mem_report = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fpp-report")) {
+      pp_report = true;
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-fcache-dir=", 12)) {
+      cache_dir = argv[i] + 12;
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-fcache-size=", 13)) {
+      cache_max_size = strtol(argv[i] + 13, NULL, 10);
+      if (cache_max_size <= 0)
+        error("invalid cache size: %s", argv[i] + 13);
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fcache-stats")) {
+      cache_stats = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "--emit-pch")) {
+      emit_pch = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-include-pch")) {
+      if (++i == argc)
+        usage();
+      include_pch = argv[i];
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-o")) {
+      if (++i == argc)
+        usage();
+      output_path = argv[i];
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-j", 2)) {
+      char *arg = argv[i] + 2;
+      if (*arg == '\0') {
+        if (++i == argc)
+          usage();
+        arg = argv[i];
+      }
+      nr_jobs = atoi(arg);
+      if (nr_jobs < 1)
+        error("invalid number of jobs: %s", arg);
+      continue;
+    }
+
     if (argv[i][0] == '-' && argv[i][1] != '\0')
       error("unknown argument: %s", argv[i]);
 
-    input_file = argv[i];
+    add_input_file(argv[i]);
   }
 
-  if (!input_file)
+  if (cache_stats && !cache_dir)
+    error("-fcache-stats requires -fcache-dir");
+
+  if (nr_input_files == 0 && !cache_stats)
     error("no input files");
+
+  if (emit_pch && (nr_input_files != 1 || !output_path))
+    error("--emit-pch requires a single header and -o");
 }
 
 static void print_tokens(Token *tok) {
   int line = 1;
   for (; tok->kind != TK_EOF; tok = tok->next) {
     if (line > 1 && tok->at_bol)
-      printf("\n");
+      emitf("\n");
     if (tok->has_space && !tok->at_bol)
-      printf(" ");
-    printf(" %.*s", tok->len, tok->loc);
+      emitf(" ");
+    emitf(" %.*s", tok->len, tok->loc);
     line++;
   }
-  printf("\n");
+  emitf("\n");
 }
 
-int main(int argc, char **argv) {
-  parse_args(argc, argv);
+// Returns true if the -o argument names a directory rather than
+// a single output file.
+static bool output_is_dir(void) {
+  if (nr_input_files > 1)
+    return true;
+  if (output_object && !preprocess_only && !output_path)
+    return true;
+  return output_path && output_path[strlen(output_path) - 1] == '/';
+}
 
-  // Tokenize and parse.
-  Token *tok = read_file(input_file);
+static char *output_ext(void) {
+  if (preprocess_only)
+    return ".i";
+  if (output_object)
+    return ".o";
+  return ".s";
+}
 
-  if (preprocess_only) {
-    print_tokens(tok);
-    return 0;
-  }
+// Returns "<dir>/<basename of path without extension><ext>".
+static char *output_filename(char *dir, char *path) {
+  char *base = strrchr(path, '/');
+  base = base ? base + 1 : path;
+
+  char *dot = strrchr(base, '.');
+  int len = dot ? dot - base : strlen(base);
+  char *ext = output_ext();
 
+  char *buf = malloc(strlen(dir) + len + strlen(ext) + 2);
+  if (dir[strlen(dir) - 1] == '/')
+    sprintf(buf, "%s%.*s%s", dir, len, base, ext);
+  else
+    sprintf(buf, "%s/%.*s%s", dir, len, base, ext);
+  return buf;
+}
+
+// Returns the output filename for a given input, or NULL if the
+// output should go to stdout.
+static char *get_output(char *input) {
+  if (!output_is_dir())
+    return output_path;
+  return output_filename(output_path ? output_path : ".", input);
+}
+
+static void print_reports(char *input) {
+  if (time_report)
+    print_time_report(input);
+  if (mem_report)
+    print_mem_report(input);
+  if (pp_report)
+    print_pp_report(input);
+}
+
+// Parses preprocessed tokens and emits assembly.
+static void gen_asm(Token *tok) {
+  timer_start(PH_PARSE);
   Program *prog = parse(tok);
+  timer_stop();
 
   // Assign offsets to local variables.
+  timer_start(PH_LAYOUT);
   for (Function *fn = prog->fns; fn; fn = fn->next) {
     // Besides local variables, callee-saved registers take 32 bytes
     // and the variable-argument save area takes 56 bytes in the stack.
@@ -64,12 +211,180 @@ int main(int argc, char **argv) {
       offset = align_to(offset, var->align);
       offset += size_of(var->ty);
       var->offset = offset;
+      timer_count(PH_LAYOUT, 1);
     }
     fn->stack_size = align_to(offset, 16);
   }
+  timer_stop();
 
   // Traverse the AST to emit assembly.
   codegen(prog);
+}
+
+// Saves the declarations and macros of a given header to a
+// precompiled header.
+static void compile_pch(char *input, char *output) {
+  // The preprocessor emits .file directives, which we don't need.
+  capture_output();
+
+  if (include_pch)
+    read_pch(include_pch);
+
+  Token *tok = read_file(input);
+
+  timer_start(PH_PARSE);
+  Program *prog = parse(tok);
+  timer_stop();
+
+  if (prog->fns || prog->globals)
+    error("%s: a precompiled header cannot contain definitions", input);
+
+  take_output();
+  write_pch(output);
+  print_reports(input);
+  free_arena();
+}
+
+// Compiles a single translation unit.
+static void compile(char *input, char *output) {
+  bool assemble_output = output_object && !preprocess_only;
+  if (assemble_output)
+    capture_output();
+  else
+    open_output(output);
+
+  // Keep the output in memory so that it can be stored to the cache.
+  if (cache_dir && !preprocess_only)
+    capture_output();
+  long start = output_size();
+
+  if (include_pch)
+    read_pch(include_pch);
+
+  // Tokenize and parse.
+  Token *tok = read_file(input);
+
+  if (preprocess_only) {
+    print_tokens(tok);
+    flush_output();
+    print_reports(input);
+    free_arena();
+    return;
+  }
+
+  if (cache_dir) {
+    // The preprocessor has emitted .file directives so far.
+    long mid = output_size();
+    char *key = cache_key(tok, output_since(start), mid - start);
+    if (!cache_lookup(key)) {
+      gen_asm(tok);
+      cache_store(key, output_since(mid), output_size() - mid);
+    }
+  } else {
+    gen_asm(tok);
+  }
+
+  if (assemble_output) {
+    timer_start(PH_ASSEMBLE);
+    assemble(take_output(), output);
+    timer_stop();
+  } else {
+    flush_output();
+  }
+
+  print_reports(input);
+  free_arena();
+}
+
+// Compiles all input files using up to `nr_jobs` worker processes.
+//
+// The compiler keeps its state in global variables and reports
+// errors by calling exit(), so each translation unit is compiled
+// in its own forked process. A failure in one file is reported
+// and doesn't abort the others.
+static int run_jobs(void) {
+  char **outputs = calloc(nr_input_files, sizeof(char *));
+  int *pids = calloc(nr_input_files, sizeof(int));
+  int next = 0;
+  int running = 0;
+  int failed = 0;
+
+  // Inputs with the same basename in different directories would
+  // overwrite each other's output.
+  HashMap seen = {};
+  for (int i = 0; i < nr_input_files; i++) {
+    outputs[i] = get_output(input_files[i]);
+    char *prev = hashmap_get(&seen, outputs[i]);
+    if (prev)
+      error("%s and %s would both be written to %s", prev, input_files[i],
+            outputs[i]);
+    hashmap_put(&seen, outputs[i], input_files[i]);
+  }
+
+  fflush(stdout);
+  fflush(stderr);
+
+  while (next < nr_input_files || running > 0) {
+    // Start a new worker if we have a free slot.
+    if (next < nr_input_files && running < nr_jobs) {
+      int pid = fork();
+      if (pid < 0)
+        error("fork failed: %s", strerror(errno));
+
+      if (pid == 0) {
+        compile(input_files[next], outputs[next]);
+        exit(0);
+      }
+
+      pids[next++] = pid;
+      running++;
+      continue;
+    }
+
+    // Otherwise, wait for any worker to finish.
+    int status;
+    int pid = waitpid(-1, &status, 0);
+    if (pid < 0)
+      error("waitpid failed: %s", strerror(errno));
+    running--;
+
+    for (int i = 0; i < next; i++) {
+      if (pids[i] != pid)
+        continue;
+      if (status != 0) {
+        fprintf(stderr, "%s: compilation failed\n", input_files[i]);
+        unlink(outputs[i]);
+        failed++;
+      }
+      break;
+    }
+  }
+
+  return failed ? 1 : 0;
+}
+
+int main(int argc, char **argv) {
+  // In server mode, we come back here in a worker process forked
+  // for each request, with the arguments sent by a client.
+  if (argc == 3 && !strcmp(argv[1], "--server"))
+    run_server(argv[2], &argc, &argv);
+  else if (argc >= 3 && !strcmp(argv[1], "--client"))
+    return run_client(argv[2], argc - 2, argv + 2);
+
+  parse_args(argc, argv);
+
+  int ret = 0;
+  if (emit_pch)
+    compile_pch(input_files[0], output_path);
+  else if (nr_input_files > 1)
+    ret = run_jobs();
+  else if (nr_input_files == 1) {
+    // With a single input, -j runs codegen in parallel instead.
+    codegen_jobs = nr_jobs;
+    compile(input_files[0], get_output(input_files[0]));
+  }
 
-  return 0;
+  if (cache_stats)
+    print_cache_stats();
+  return ret;
 }
@@ -91,6 +91,9 @@ static int scope_depth;
 // Points to the function object the parser is currently parsing.
 static Var *current_fn;
 
+// The number of nodes created so far
+static long nr_nodes;
+
 // Points to a node representing a switch if we are parsing
 // a switch statement. Otherwise, NULL.
 static Node *current_switch;
@@ -151,20 +154,22 @@ static void leave_scope(void) {
 // Find a variable or a typedef by name.
 static VarScope *find_var(Token *tok) {
   for (VarScope *sc = var_scope; sc; sc = sc->next)
-    if (strlen(sc->name) == tok->len && !strncmp(tok->loc, sc->name, tok->len))
+    if (sc->name == tok->name)
       return sc;
   return NULL;
 }
 
 static TagScope *find_tag(Token *tok) {
   for (TagScope *sc = tag_scope; sc; sc = sc->next)
-    if (strlen(sc->name) == tok->len && !strncmp(tok->loc, sc->name, tok->len))
+    if (sc->name == tok->name)
       return sc;
   return NULL;
 }
 
 static Node *new_node(NodeKind kind, Token *tok) {
-  Node *node = calloc(1, sizeof(Node));
+  Node *node = alloc_obj(AK_NODE, sizeof(Node));
+  timer_count(PH_PARSE, 1);
+  nr_nodes++;
   node->kind = kind;
   node->tok = tok;
   return node;
@@ -205,7 +210,9 @@ static Node *new_var_node(Var *var, Token *tok) {
 Node *new_cast(Node *expr, Type *ty) {
   add_type(expr);
 
-  Node *node = calloc(1, sizeof(Node));
+  Node *node = alloc_obj(AK_NODE, sizeof(Node));
+  timer_count(PH_PARSE, 1);
+  nr_nodes++;
   node->kind = ND_CAST;
   node->tok = expr->tok;
   node->lhs = expr;
@@ -214,7 +221,7 @@ Node *new_cast(Node *expr, Type *ty) {
 }
 
 static VarScope *push_scope(char *name) {
-  VarScope *sc = calloc(1, sizeof(VarScope));
+  VarScope *sc = alloc_obj(AK_VAR_SCOPE, sizeof(VarScope));
   sc->next = var_scope;
   sc->name = name;
   sc->depth = scope_depth;
@@ -223,18 +230,18 @@ static VarScope *push_scope(char *name) {
 }
 
 static Initializer *new_init(Type *ty, int len, Node *expr, Token *tok) {
-  Initializer *init = calloc(1, sizeof(Initializer));
+  Initializer *init = alloc_obj(AK_INITIALIZER, sizeof(Initializer));
   init->ty = ty;
   init->tok = tok;
   init->len = len;
   init->expr = expr;
   if (len)
-    init->children = calloc(len, sizeof(Initializer *));
+    init->children = alloc_obj(AK_INITIALIZER, len * sizeof(Initializer *));
   return init;
 }
 
 static Var *new_lvar(char *name, Type *ty) {
-  Var *var = calloc(1, sizeof(Var));
+  Var *var = alloc_obj(AK_VAR, sizeof(Var));
   var->name = name;
   var->ty = ty;
   var->align = ty->align;
@@ -246,7 +253,7 @@ static Var *new_lvar(char *name, Type *ty) {
 }
 
 static Var *new_gvar(char *name, Type *ty, bool is_static, bool emit) {
-  Var *var = calloc(1, sizeof(Var));
+  Var *var = alloc_obj(AK_VAR, sizeof(Var));
   var->name = name;
   var->ty = ty;
   var->align = ty->align;
@@ -262,26 +269,27 @@ static Var *new_gvar(char *name, Type *ty, bool is_static, bool emit) {
 
 static char *new_label(void) {
   static int cnt = 0;
-  char *buf = malloc(20);
+  char *buf = alloc_obj(AK_STRING, 20);
   sprintf(buf, ".L.data.%d", cnt++);
   return buf;
 }
 
 static Var *new_string_literal(char *p, int len) {
-  Type *ty = array_of(ty_char, len);
+  Type *ty = array_of(ty_char, len + 1);
   Var *var = new_gvar(new_label(), ty, true, true);
   var->initializer = gvar_init_string(p, len);
   return var;
 }
 
 static bool is_end(Token *tok) {
-  return (equal(tok, "}") || (equal(tok, ",") && equal(tok->next, "}")));
+  return (tok->id == P_RBRACE ||
+          (tok->id == P_COMMA && tok->next->id == P_RBRACE));
 }
 
 static Token *expect_end(Token *tok) {
-  if (equal(tok, "}"))
+  if (tok->id == P_RBRACE)
     return tok->next;
-  if (equal(tok, ",") && equal(tok->next, "}"))
+  if (tok->id == P_COMMA && tok->next->id == P_RBRACE)
     return tok->next->next;
   error_tok(tok, "expected '}'");
 }
@@ -289,7 +297,7 @@ static Token *expect_end(Token *tok) {
 static char *get_ident(Token *tok) {
   if (tok->kind != TK_IDENT)
     error_tok(tok, "expected an identifier");
-  return strndup(tok->loc, tok->len);
+  return tok->name;
 }
 
 static Type *find_typedef(Token *tok) {
@@ -304,13 +312,13 @@ static Type *find_typedef(Token *tok) {
 static long get_number(Token *tok) {
   if (tok->kind != TK_NUM)
     error_tok(tok, "expected a number");
-  return tok->val;
+  return tok->lit->val;
 }
 
 static void push_tag_scope(Token *tok, Type *ty) {
-  TagScope *sc = calloc(1, sizeof(TagScope));
+  TagScope *sc = alloc_obj(AK_TAG_SCOPE, sizeof(TagScope));
   sc->next = tag_scope;
-  sc->name = strndup(tok->loc, tok->len);
+  sc->name = tok->name;
   sc->depth = scope_depth;
   sc->ty = ty;
   tag_scope = sc;
@@ -327,7 +335,7 @@ static Function *funcdef(Token **rest, Token *tok) {
   if (!ty->name)
     error_tok(ty->name_pos, "function name omitted");
 
-  Function *fn = calloc(1, sizeof(Function));
+  Function *fn = alloc_obj(AK_FUNCTION, sizeof(Function));
   fn->name = get_ident(ty->name);
   fn->is_static = attr.is_static;
   fn->is_varargs = ty->is_varargs;
@@ -340,8 +348,10 @@ static Function *funcdef(Token **rest, Token *tok) {
   }
   fn->params = locals;
 
-  tok = skip(tok, "{");
+  tok = skip(tok, P_LBRACE);
+  long start = nr_nodes;
   fn->node = compound_stmt(rest, tok)->body;
+  fn->nr_nodes = nr_nodes - start;
   fn->locals = locals;
   leave_scope();
   return fn;
@@ -385,13 +395,13 @@ static Type *typespec(Token **rest, Token *tok, VarAttr *attr) {
 
   while (is_typename(tok)) {
     // Handle storage class specifiers.
-    if (equal(tok, "typedef") || equal(tok, "static") || equal(tok, "extern")) {
+    if (tok->id == KW_TYPEDEF || tok->id == KW_STATIC || tok->id == KW_EXTERN) {
       if (!attr)
         error_tok(tok, "storage class specifier is not allowed in this context");
 
-      if (equal(tok, "typedef"))
+      if (tok->id == KW_TYPEDEF)
         attr->is_typedef = true;
-      else if (equal(tok, "static"))
+      else if (tok->id == KW_STATIC)
         attr->is_static = true;
       else
         attr->is_extern = true;
@@ -402,39 +412,40 @@ static Type *typespec(Token **rest, Token *tok, VarAttr *attr) {
       continue;
     }
 
-    if (consume(&tok, tok, "const")) {
+    if (consume(&tok, tok, KW_CONST)) {
       is_const = true;
       continue;
     }
 
-    if (consume(&tok, tok, "volatile")) {
+    if (consume(&tok, tok, KW_VOLATILE)) {
       continue;
     }
 
-    if (equal(tok, "_Alignas")) {
+    if (tok->id == KW_ALIGNAS) {
       if (!attr)
         error_tok(tok, "_Alignas is not allowed in this context");
-      tok = skip(tok->next, "(");
+      tok = skip(tok->next, P_LPAREN);
 
       if (is_typename(tok))
         attr->align = typename(&tok, tok)->align;
       else
         attr->align = const_expr(&tok, tok);
-      tok = skip(tok, ")");
+      tok = skip(tok, P_RPAREN);
       continue;
     }
 
     // Handle user-defined types.
     Type *ty2 = find_typedef(tok);
-    if (equal(tok, "struct") || equal(tok, "union") || equal(tok, "enum") || ty2) {
+    if (tok->id == KW_STRUCT || tok->id == KW_UNION || tok->id == KW_ENUM ||
+        ty2) {
       if (counter)
         break;
 
-      if (equal(tok, "struct")) {
+      if (tok->id == KW_STRUCT) {
         ty = struct_decl(&tok, tok->next);
-      } else if (equal(tok, "union")) {
+      } else if (tok->id == KW_UNION) {
         ty = union_decl(&tok, tok->next);
-      } else if (equal(tok, "enum")) {
+      } else if (tok->id == KW_ENUM) {
         ty = enum_specifier(&tok, tok->next);
       } else {
         ty = ty2;
@@ -446,21 +457,21 @@ static Type *typespec(Token **rest, Token *tok, VarAttr *attr) {
     }
 
     // Handle built-int types.
-    if (equal(tok, "void"))
+    if (tok->id == KW_VOID)
       counter += VOID;
-    else if (equal(tok, "_Bool"))
+    else if (tok->id == KW_BOOL)
       counter += BOOL;
-    else if (equal(tok, "char"))
+    else if (tok->id == KW_CHAR)
       counter += CHAR;
-    else if (equal(tok, "short"))
+    else if (tok->id == KW_SHORT)
       counter += SHORT;
-    else if (equal(tok, "int"))
+    else if (tok->id == KW_INT)
       counter += INT;
-    else if (equal(tok, "long"))
+    else if (tok->id == KW_LONG)
       counter += LONG;
-    else if (equal(tok, "signed"))
+    else if (tok->id == KW_SIGNED)
       counter |= SIGNED;
-    else if (equal(tok, "unsigned"))
+    else if (tok->id == KW_UNSIGNED)
       counter |= UNSIGNED;
     else
       error_tok(tok, "internal error");
@@ -533,7 +544,7 @@ static Type *typespec(Token **rest, Token *tok, VarAttr *attr) {
 // func-parms  = ("void" | param ("," param)* ("," "...")?)? ")"
 // param       = typespec declarator
 static Type *func_params(Token **rest, Token *tok, Type *ty) {
-  if (equal(tok, "void") && (equal(tok->next, ")"))) {
+  if (tok->id == KW_VOID && (tok->next->id == P_RPAREN)) {
     *rest = tok->next->next;
     return func_type(ty);
   }
@@ -542,14 +553,14 @@ static Type *func_params(Token **rest, Token *tok, Type *ty) {
   Type *cur = &head;
   bool is_varargs = false;
 
-  while (!equal(tok, ")")) {
+  while (tok->id != P_RPAREN) {
     if (cur != &head)
-      tok = skip(tok, ",");
+      tok = skip(tok, P_COMMA);
 
-    if (equal(tok, "...")) {
+    if (tok->id == P_ELLIPSIS) {
       is_varargs = true;
       tok = tok->next;
-      skip(tok, ")");
+      skip(tok, P_RPAREN);
       break;
     }
 
@@ -576,7 +587,7 @@ static Type *func_params(Token **rest, Token *tok, Type *ty) {
 
 // attay-dimensions = const-expr? "]" type-suffix
 static Type *array_dimensions(Token **rest, Token *tok, Type *ty) {
-  if (equal(tok, "]")) {
+  if (tok->id == P_RBRACKET) {
     ty = type_suffix(rest, tok->next, ty);
     ty = array_of(ty, 0);
     ty->is_incomplete = true;
@@ -584,7 +595,7 @@ static Type *array_dimensions(Token **rest, Token *tok, Type *ty) {
   }
 
   int sz = const_expr(&tok, tok);
-  tok = skip(tok, "]");
+  tok = skip(tok, P_RBRACKET);
   ty = type_suffix(rest, tok, ty);
   return array_of(ty, sz);
 }
@@ -593,10 +604,10 @@ static Type *array_dimensions(Token **rest, Token *tok, Type *ty) {
 //             | "[" array-dimensions
 //             | ε
 static Type *type_suffix(Token **rest, Token *tok, Type *ty) {
-  if (equal(tok, "("))
+  if (tok->id == P_LPAREN)
     return func_params(rest, tok->next, ty);
 
-  if (equal(tok, "["))
+  if (tok->id == P_LBRACKET)
     return array_dimensions(rest, tok->next, ty);
 
   *rest = tok;
@@ -605,10 +616,10 @@ static Type *type_suffix(Token **rest, Token *tok, Type *ty) {
 
 // pointers = ("*" ("const" | "volatile")*)*
 static Type *pointers(Token **rest, Token *tok, Type *ty) {
-  while (consume(&tok, tok, "*")) {
+  while (consume(&tok, tok, P_STAR)) {
     ty = pointer_to(ty);
-    while (equal(tok, "const") || equal(tok, "volatile")) {
-      if (equal(tok, "const"))
+    while (tok->id == KW_CONST || tok->id == KW_VOLATILE) {
+      if (tok->id == KW_CONST)
         ty->is_const = true;
       tok = tok->next;
     }
@@ -621,10 +632,10 @@ static Type *pointers(Token **rest, Token *tok, Type *ty) {
 static Type *declarator(Token **rest, Token *tok, Type *ty) {
   ty = pointers(&tok, tok, ty);
 
-  if (equal(tok, "(")) {
-    Type *placeholder = calloc(1, sizeof(Type));
+  if (tok->id == P_LPAREN) {
+    Type *placeholder = alloc_obj(AK_TYPE, sizeof(Type));
     Type *new_ty = declarator(&tok, tok->next, placeholder);
-    tok = skip(tok, ")");
+    tok = skip(tok, P_RPAREN);
     *placeholder = *type_suffix(rest, tok, ty);
     return new_ty;
   }
@@ -647,10 +658,10 @@ static Type *declarator(Token **rest, Token *tok, Type *ty) {
 static Type *abstract_declarator(Token **rest, Token *tok, Type *ty)  {
   ty = pointers(&tok, tok, ty);
 
-  if (equal(tok, "(")) {
-    Type *placeholder = calloc(1, sizeof(Type));
+  if (tok->id == P_LPAREN) {
+    Type *placeholder = alloc_obj(AK_TYPE, sizeof(Type));
     Type *new_ty = abstract_declarator(&tok, tok->next, placeholder);
-    tok = skip(tok, ")");
+    tok = skip(tok, P_RPAREN);
     *placeholder = *type_suffix(rest, tok, ty);
     return new_ty;
   }
@@ -668,12 +679,12 @@ static Type *typename(Token **rest, Token *tok) {
 // to allow a trailing comma. This function returns true if it looks
 // like we are at the end of such list.
 static bool consume_end(Token **rest, Token *tok) {
-  if (equal(tok, "}")) {
+  if (tok->id == P_RBRACE) {
     *rest = tok->next;
     return true;
   }
 
-  if (equal(tok, ",") && equal(tok->next, "}")) {
+  if (tok->id == P_COMMA && tok->next->id == P_RBRACE) {
     *rest = tok->next->next;
     return true;
   }
@@ -696,7 +707,7 @@ static Type *enum_specifier(Token **rest, Token *tok) {
     tok = tok->next;
   }
 
-  if(tag && !equal(tok, "{")) {
+  if(tag && tok->id != P_LBRACE) {
     TagScope *sc = find_tag(tag);
     if (!sc)
       error_tok(tag, "unknown enum type");
@@ -706,19 +717,19 @@ static Type *enum_specifier(Token **rest, Token *tok) {
     return sc->ty;
   }
 
-  tok = skip(tok, "{");
+  tok = skip(tok, P_LBRACE);
 
   // Read an enum-list.
   int i = 0;
   int val = 0;
   while (!is_end(tok)) {
     if (i++ > 0)
-      tok = skip(tok, ",");
+      tok = skip(tok, P_COMMA);
 
     char *name = get_ident(tok);
     tok = tok->next;
 
-    if (equal(tok, "="))
+    if (tok->id == P_ASSIGN)
       val = const_expr(&tok, tok->next);
 
     VarScope *sc = push_scope(name);
@@ -741,9 +752,9 @@ static Node *declaration(Token **rest, Token *tok) {
   Node *cur = &head;
   int cnt = 0;
 
-  while (!equal(tok, ";")) {
+  while (tok->id != P_SEMICOLON) {
     if (cnt++ > 0)
-      tok = skip(tok, ",");
+      tok = skip(tok, P_COMMA);
 
     Type *ty = declarator(&tok, tok, basety);
     if (!ty->name)
@@ -761,7 +772,7 @@ static Node *declaration(Token **rest, Token *tok) {
       Var *var = new_gvar(new_label(), ty, true, true);
       push_scope(get_ident(ty->name))->var = var;
 
-      if (equal(tok, "="))
+      if (tok->id == P_ASSIGN)
         var->initializer = gvar_initializer(&tok, tok->next, ty);
       continue;
     }
@@ -770,7 +781,7 @@ static Node *declaration(Token **rest, Token *tok) {
     if (attr.align)
       var->align = attr.align;
 
-    if (equal(tok, "="))
+    if (tok->id == P_ASSIGN)
       cur = cur->next = lvar_initializer(&tok, tok->next, var);
   }
 
@@ -782,8 +793,8 @@ static Node *declaration(Token **rest, Token *tok) {
 
 static void skip_excess_elements(Token **rest, Token *tok) {
   while (!consume_end(&tok, tok)) {
-    tok = skip(tok, ",");
-    if (equal(tok, "{"))
+    tok = skip(tok, P_COMMA);
+    if (tok->id == P_LBRACE)
       skip_excess_elements(&tok, tok->next);
     else
       assign(&tok, tok);
@@ -802,19 +813,20 @@ static Token *skip_end(Token *tok) {
 // string-ilinializer = string-literal
 static Initializer *string_initializer(Token **rest, Token *tok, Type *ty) {
   // Initialize a char array with a string literal.
+  Literal *lit = tok->lit;
   if (ty->is_incomplete) {
-    ty->size = tok->cont_len;
-    ty->array_len = tok->cont_len;
+    ty->size = lit->cont_len + 1;
+    ty->array_len = lit->cont_len + 1;
     ty->is_incomplete = false;
   }
 
   Initializer *init = new_init(ty, ty->array_len, NULL, tok);
 
-  int len = (ty->array_len < tok->cont_len)
-    ? ty->array_len : tok->cont_len;
+  int len = (ty->array_len < lit->cont_len + 1)
+    ? ty->array_len : lit->cont_len + 1;
 
   for (int i = 0; i < len; i++) {
-    Node *expr = new_num(tok->contents[i], tok);
+    Node *expr = new_num(i < lit->cont_len ? lit->contents[i] : 0, tok);
     init->children[i] = new_init(ty->base, 0, expr, tok);
   }
   *rest = tok->next;
@@ -824,13 +836,13 @@ static Initializer *string_initializer(Token **rest, Token *tok, Type *ty) {
 // array-initializer = "{" initializer ("," initializer)* ","? "}"
 //                   | initializer ("," initializer)* ","
 static Initializer *array_initializer(Token **rest, Token *tok, Type *ty) {
-  bool has_paren = consume(&tok, tok, "{");
+  bool has_paren = consume(&tok, tok, P_LBRACE);
 
   if (ty->is_incomplete) {
     int i = 0;
     for (Token *tok2 = tok; !is_end(tok2); i++) {
       if (i > 0)
-        tok2 = skip(tok2, ",");
+        tok2 = skip(tok2, P_COMMA);
       initializer(&tok2, tok2, ty->base);
     }
 
@@ -843,7 +855,7 @@ static Initializer *array_initializer(Token **rest, Token *tok, Type *ty) {
 
   for (int i = 0; i < ty->array_len && !is_end(tok); i++) {
     if (i > 0)
-      tok = skip(tok, ",");
+      tok = skip(tok, P_COMMA);
     init->children[i] = initializer(&tok, tok, ty->base);
   }
 
@@ -856,7 +868,7 @@ static Initializer *array_initializer(Token **rest, Token *tok, Type *ty) {
 // struct-initializer = "{" initializer ("," initializer)* ","? "}"
 //                    | initializer ("," initializer)* ","
 static Initializer *struct_initializer(Token **rest, Token *tok, Type *ty) {
-  if (!equal(tok, "{")) {
+  if (tok->id != P_LBRACE) {
     Token *tok2;
     Node *expr = assign(&tok2, tok);
     add_type(expr);
@@ -872,12 +884,12 @@ static Initializer *struct_initializer(Token **rest, Token *tok, Type *ty) {
     len++;
 
   Initializer *init = new_init(ty, len, NULL, tok);
-  bool has_paren = consume(&tok, tok, "{");
+  bool has_paren = consume(&tok, tok, P_LBRACE);
 
   int i = 0;
   for (Member *mem = ty->members; mem && !is_end(tok); mem = mem->next, i++) {
     if (i > 0)
-      tok = skip(tok, ",");
+      tok = skip(tok, P_COMMA);
     init->children[i] = initializer(&tok, tok, mem->ty);
   }
 
@@ -901,7 +913,7 @@ static Initializer *initializer(Token **rest, Token *tok, Type *ty) {
     return struct_initializer(rest, tok, ty);
 
   Token *start = tok;
-  bool has_paren = consume(&tok, tok, "{");
+  bool has_paren = consume(&tok, tok, P_LBRACE);
   Initializer *init = new_init(ty, 0, assign(&tok, tok), start);
   if (has_paren)
     tok = skip_end(tok);
@@ -971,7 +983,7 @@ static Node *lvar_initializer(Token **rest, Token *tok, Var *var) {
 
 static GvarInitializer *
 new_gvar_init_val(GvarInitializer *cur, int offset, int sz, int val) {
-  GvarInitializer *init = calloc(1, sizeof(GvarInitializer));
+  GvarInitializer *init = alloc_obj(AK_GVAR_INIT, sizeof(GvarInitializer));
   init->sz = sz;
   init->val = val;
   init->offset = offset;
@@ -981,7 +993,7 @@ new_gvar_init_val(GvarInitializer *cur, int offset, int sz, int val) {
 
 static GvarInitializer *
 new_gvar_init_label(GvarInitializer *cur, int offset, char *label, long addend) {
-  GvarInitializer *init = calloc(1, sizeof(GvarInitializer));
+  GvarInitializer *init = alloc_obj(AK_GVAR_INIT, sizeof(GvarInitializer));
   init->sz = 8;
   init->label = label;
   init->addend = addend;
@@ -1020,31 +1032,42 @@ create_gvar_init(GvarInitializer *cur, Initializer *init, Type *ty, int offset)
 // objects to GvarInitializer objects. It is a compile error if an
 // initializer list contains a non-constant expression.
 static GvarInitializer *gvar_initializer(Token **rest, Token *tok, Type *ty) {
+  // A char array initialized with a string literal doesn't need
+  // an Initializer object for each byte.
+  if (ty->kind == TY_ARRAY && ty->base->kind == TY_CHAR && tok->kind == TK_STR) {
+    Literal *lit = tok->lit;
+    if (ty->is_incomplete) {
+      ty->size = lit->cont_len + 1;
+      ty->array_len = lit->cont_len + 1;
+      ty->is_incomplete = false;
+    }
+    *rest = tok->next;
+    int len = (ty->array_len < lit->cont_len) ? ty->array_len : lit->cont_len;
+    return gvar_init_string(lit->contents, len);
+  }
+
   Initializer *init = initializer(rest, tok, ty);
   GvarInitializer head = {};
   create_gvar_init(&head, init, ty, 0);
   return head.next;
 }
 
-// Construct GvarInitializer objects for a given string literal.
+// Construct a GvarInitializer object for a given string literal.
+// The terminating '\0' is left to zero padding.
 static GvarInitializer *gvar_init_string(char *p, int len) {
-  GvarInitializer head = {};
-  GvarInitializer *cur = &head;
-  for (int i = 0; i < len; i++)
-    cur = new_gvar_init_val(cur, i, 1, p[i]);
-  return head.next;
+  GvarInitializer *init = alloc_obj(AK_GVAR_INIT, sizeof(GvarInitializer));
+  init->sz = len;
+  init->bytes = p;
+  return init;
 }
 
 static bool is_typename(Token *tok) {
-  static char *kw[] = {
-    "void", "_Bool", "char", "short", "int", "long", "struct", "union",
-    "typedef", "enum", "static", "extern", "_Alignas", "signed", "unsigned",
-    "const", "volatile",
-  };
-
-  for (int i = 0; i < sizeof(kw) / sizeof(*kw); i++) {
-    if (equal(tok, kw[i]))
-      return true;
+  switch (tok->id) {
+  case KW_VOID: case KW_BOOL: case KW_CHAR: case KW_SHORT: case KW_INT:
+  case KW_LONG: case KW_STRUCT: case KW_UNION: case KW_TYPEDEF:
+  case KW_ENUM: case KW_STATIC: case KW_EXTERN: case KW_ALIGNAS:
+  case KW_SIGNED: case KW_UNSIGNED: case KW_CONST: case KW_VOLATILE:
+    return true;
   }
   return find_typedef(tok);
 }
@@ -1065,36 +1088,37 @@ static bool is_typename(Token *tok) {
 //      | "{" compund-stmt
 //      | expr ";"
 static Node *stmt(Token **rest, Token *tok) {
-  if (equal(tok, "return")) {
+  switch (tok->id) {
+  case KW_RETURN: {
     Node *node = new_node(ND_RETURN, tok);
-    if (consume(rest, tok->next, ";"))
+    if (consume(rest, tok->next, P_SEMICOLON))
       return node;
 
     Node *exp = expr(&tok, tok->next);
-    *rest = skip(tok, ";");
+    *rest = skip(tok, P_SEMICOLON);
 
     add_type(exp);
     node->lhs = new_cast(exp, current_fn->ty->return_ty);
     return node;
   }
 
-  if (equal(tok, "if")) {
+  case KW_IF: {
     Node *node = new_node(ND_IF, tok);
-    tok = skip(tok->next, "(");
+    tok = skip(tok->next, P_LPAREN);
     node->cond = expr(&tok, tok);
-    tok = skip(tok, ")");
+    tok = skip(tok, P_RPAREN);
     node->then = stmt(&tok, tok);
-    if (equal(tok, "else"))
+    if (tok->id == KW_ELSE)
       node->els = stmt(&tok, tok->next);
     *rest = tok;
     return node;
   }
 
-  if (equal(tok, "switch")) {
+  case KW_SWITCH: {
     Node *node = new_node(ND_SWITCH, tok);
-    tok = skip(tok->next, "(");
+    tok = skip(tok->next, P_LPAREN);
     node->cond = expr(&tok, tok);
-    tok = skip(tok, ")");
+    tok = skip(tok, P_RPAREN);
 
     Node *sw = current_switch;
     current_switch = node;
@@ -1103,13 +1127,13 @@ static Node *stmt(Token **rest, Token *tok) {
     return node;
   }
 
-  if (equal(tok, "case")) {
+  case KW_CASE: {
     if (!current_switch)
       error_tok(tok, "stray case");
 
     Node *node = new_node(ND_CASE, tok);
     int val = const_expr(&tok, tok->next);
-    tok = skip(tok, ":");
+    tok = skip(tok, P_COLON);
     node->lhs = stmt(rest, tok);
     node->val = val;
     node->case_next = current_switch->case_next;
@@ -1117,99 +1141,100 @@ static Node *stmt(Token **rest, Token *tok) {
     return node;
   }
 
-  if (equal(tok, "default")) {
+  case KW_DEFAULT: {
     if (!current_switch)
       error_tok(tok, "stray default");
 
     Node *node = new_node(ND_CASE, tok);
-    tok = skip(tok->next, ":");
+    tok = skip(tok->next, P_COLON);
     node->lhs = stmt(rest, tok);
     current_switch->default_case = node;
     return node;
   }
 
-  if (equal(tok, "for")) {
+  case KW_FOR: {
     Node *node = new_node(ND_FOR, tok);
-    tok = skip(tok->next, "(");
+    tok = skip(tok->next, P_LPAREN);
 
     enter_scope();
 
     if (is_typename(tok)) {
       node->init = declaration(&tok, tok);
     } else {
-      if(!equal(tok, ";"))
+      if(tok->id != P_SEMICOLON)
         node->init = expr_stmt(&tok, tok);
-      tok = skip(tok, ";");
+      tok = skip(tok, P_SEMICOLON);
     }
 
-    if(!equal(tok, ";"))
+    if(tok->id != P_SEMICOLON)
       node->cond = expr(&tok, tok);
-    tok = skip(tok, ";");
+    tok = skip(tok, P_SEMICOLON);
 
-    if(!equal(tok, ")"))
+    if(tok->id != P_RPAREN)
       node->inc = expr_stmt(&tok, tok);
-    tok = skip(tok, ")");
+    tok = skip(tok, P_RPAREN);
 
     node->then = stmt(rest, tok);
     leave_scope();
     return node;
   }
 
-  if (equal(tok, "while")) {
+  case KW_WHILE: {
     Node *node = new_node(ND_FOR, tok);
-    tok = skip(tok->next, "(");
+    tok = skip(tok->next, P_LPAREN);
     node->cond = expr(&tok, tok);
-    tok = skip(tok, ")");
+    tok = skip(tok, P_RPAREN);
     node->then = stmt(rest, tok);
     return node;
   }
 
-  if (equal(tok, "do")) {
+  case KW_DO: {
     Node *node = new_node(ND_DO, tok);
     node->then = stmt(&tok, tok->next);
-    tok = skip(tok, "while");
-    tok = skip(tok, "(");
+    tok = skip(tok, KW_WHILE);
+    tok = skip(tok, P_LPAREN);
     node->cond = expr(&tok, tok);
-    tok = skip(tok, ")");
-    *rest = skip(tok, ";");
+    tok = skip(tok, P_RPAREN);
+    *rest = skip(tok, P_SEMICOLON);
     return node;
   }
 
-  if (equal(tok, "break")) {
-    *rest = skip(tok->next, ";");
+  case KW_BREAK: {
+    *rest = skip(tok->next, P_SEMICOLON);
     return new_node(ND_BREAK, tok);
   }
 
-  if (equal(tok, "continue")) {
-    *rest = skip(tok->next, ";");
+  case KW_CONTINUE: {
+    *rest = skip(tok->next, P_SEMICOLON);
     return new_node(ND_CONTINUE, tok);
   }
 
-  if (equal(tok, "goto")) {
+  case KW_GOTO: {
     Node *node = new_node(ND_GOTO, tok);
     node->label_name = get_ident(tok->next);
-    *rest = skip(tok->next->next, ";");
+    *rest = skip(tok->next->next, P_SEMICOLON);
     return node;
   }
 
-  if (equal(tok, ";")) {
+  case P_SEMICOLON: {
     Node *node = new_node(ND_BLOCK, tok);
     *rest = tok->next;
     return node;
   }
 
-  if (tok->kind == TK_IDENT && equal(tok->next, ":")) {
+  case P_LBRACE:
+    return compound_stmt(rest, tok->next);
+  }
+
+  if (tok->kind == TK_IDENT && tok->next->id == P_COLON) {
     Node *node = new_node(ND_LABEL, tok);
-    node->label_name = strndup(tok->loc, tok->len);
+    node->label_name = tok->name;
     node->lhs = stmt(rest, tok->next->next);
     return node;
   }
 
-  if (equal(tok, "{"))
-    return compound_stmt(rest, tok->next);
-
   Node *node = expr_stmt(&tok, tok);
-  *rest = skip(tok, ";");
+  *rest = skip(tok, P_SEMICOLON);
   return node;
 }
 
@@ -1221,7 +1246,7 @@ static Node *compound_stmt(Token **rest, Token *tok) {
 
   enter_scope();
 
-  while (!equal(tok, "}")) {
+  while (tok->id != P_RBRACE) {
     if (is_typename(tok))
       cur = cur->next = declaration(&tok, tok);
     else
@@ -1247,7 +1272,7 @@ static Node *expr_stmt(Token **rest, Token *tok) {
 static Node *expr(Token **rest, Token *tok) {
   Node *node = assign(&tok, tok);
 
-  if(equal(tok, ","))
+  if(tok->id == P_COMMA)
     return new_binary(ND_COMMA, node, expr(rest, tok->next), tok);
 
   *rest = tok;
@@ -1386,37 +1411,37 @@ static Node *to_assign(Node *binary) {
 static Node *assign(Token **rest, Token *tok) {
   Node *node = conditional(&tok, tok);
 
-  if (equal(tok, "="))
+  if (tok->id == P_ASSIGN)
     return new_binary(ND_ASSIGN, node, assign(rest, tok->next), tok);
 
-  if (equal(tok, "+="))
+  if (tok->id == P_ADD_ASSIGN)
     return to_assign(new_add(node, assign(rest, tok->next), tok));
 
-  if (equal(tok, "-="))
+  if (tok->id == P_SUB_ASSIGN)
     return to_assign(new_sub(node, assign(rest, tok->next), tok));
 
-  if (equal(tok, "*="))
+  if (tok->id == P_MUL_ASSIGN)
     return to_assign(new_binary(ND_MUL, node, assign(rest, tok->next), tok));
 
-  if (equal(tok, "/="))
+  if (tok->id == P_DIV_ASSIGN)
     return to_assign(new_binary(ND_DIV, node, assign(rest, tok->next), tok));
 
-  if (equal(tok, "%="))
+  if (tok->id == P_MOD_ASSIGN)
     return to_assign(new_binary(ND_MOD, node, assign(rest, tok->next), tok));
 
-  if (equal(tok, "&="))
+  if (tok->id == P_AND_ASSIGN)
     return to_assign(new_binary(ND_BITAND, node, assign(rest, tok->next), tok));
 
-  if (equal(tok, "|="))
+  if (tok->id == P_OR_ASSIGN)
     return to_assign(new_binary(ND_BITOR, node, assign(rest, tok->next), tok));
 
-  if (equal(tok, "^="))
+  if (tok->id == P_XOR_ASSIGN)
     return to_assign(new_binary(ND_BITXOR, node, assign(rest, tok->next), tok));
 
-  if (equal(tok, "<<="))
+  if (tok->id == P_SHL_ASSIGN)
     return to_assign(new_binary(ND_SHL, node, assign(rest, tok->next), tok));
 
-  if (equal(tok, ">>="))
+  if (tok->id == P_SHR_ASSIGN)
     return to_assign(new_binary(ND_SHR, node, assign(rest, tok->next), tok));
 
   *rest = tok;
@@ -1427,7 +1452,7 @@ static Node *assign(Token **rest, Token *tok) {
 static Node *conditional(Token **rest, Token *tok) {
   Node *node = logor(&tok, tok);
 
-  if (!equal(tok, "?")) {
+  if (tok->id != P_QUESTION) {
     *rest = tok;
     return node;
   }
@@ -1435,7 +1460,7 @@ static Node *conditional(Token **rest, Token *tok) {
   Node *cond = new_node(ND_COND, tok);
   cond->cond = node;
   cond->then = expr(&tok, tok->next);
-  tok = skip(tok, ":");
+  tok = skip(tok, P_COLON);
   cond->els = conditional(rest, tok);
   return cond;
 }
@@ -1443,7 +1468,7 @@ static Node *conditional(Token **rest, Token *tok) {
 // logor = logand ("||" logand)*
 static Node *logor(Token **rest, Token *tok) {
   Node *node = logand(&tok, tok);
-  while (equal(tok, "||")) {
+  while (tok->id == P_LOGOR) {
     node = new_binary(ND_LOGOR, node, NULL, tok);
     node->rhs = logand(&tok, tok->next);
   }
@@ -1454,7 +1479,7 @@ static Node *logor(Token **rest, Token *tok) {
 // logand = bitor ("&&" bitor)*
 static Node *logand(Token **rest, Token *tok) {
   Node *node = bitor(&tok, tok);
-  while (equal(tok, "&&")) {
+  while (tok->id == P_LOGAND) {
     node = new_binary(ND_LOGAND, node, NULL, tok);
     node->rhs = bitor(&tok, tok->next);
   }
@@ -1465,7 +1490,7 @@ static Node *logand(Token **rest, Token *tok) {
 // bitor = bitxor ("|" bitxor)*
 static Node *bitor(Token **rest, Token *tok) {
   Node *node = bitxor(&tok, tok);
-  while (equal(tok, "|")) {
+  while (tok->id == P_PIPE) {
     node = new_binary(ND_BITOR, node, NULL, tok);
     node->rhs = bitxor(&tok, tok->next);
   }
@@ -1476,7 +1501,7 @@ static Node *bitor(Token **rest, Token *tok) {
 // bitxor = bitand ("^" bitand)*
 static Node *bitxor(Token **rest, Token *tok) {
   Node *node = bitand(&tok, tok);
-  while (equal(tok, "^")) {
+  while (tok->id == P_CARET) {
     node = new_binary(ND_BITXOR, node, NULL, tok);
     node->rhs = bitand(&tok, tok->next);
   }
@@ -1487,7 +1512,7 @@ static Node *bitxor(Token **rest, Token *tok) {
 // bitand = equality ("&" equality)*
 static Node *bitand(Token **rest, Token *tok) {
   Node *node = equality(&tok, tok);
-  while (equal(tok, "&")) {
+  while (tok->id == P_AMP) {
     node = new_binary(ND_BITAND, node, NULL, tok);
     node->rhs = equality(&tok, tok->next);
   }
@@ -1500,13 +1525,13 @@ static Node *equality(Token **rest, Token *tok) {
   Node *node = relational(&tok, tok);
 
   for (;;) {
-    if (equal(tok, "==")) {
+    if (tok->id == P_EQ) {
       node = new_binary(ND_EQ, node, NULL, tok);
       node->rhs = relational(&tok, tok->next);
       continue;
     }
 
-    if (equal(tok, "!=")) {
+    if (tok->id == P_NE) {
       node = new_binary(ND_NE, node, NULL, tok);
       node->rhs = relational(&tok, tok->next);
       continue;
@@ -1522,25 +1547,25 @@ static Node *relational(Token **rest, Token *tok) {
   Node *node = shift(&tok, tok);
 
   for (;;) {
-    if (equal(tok, "<")) {
+    if (tok->id == P_LT) {
       node = new_binary(ND_LT, node, NULL, tok);
       node->rhs = shift(&tok, tok->next);
       continue;
     }
 
-    if (equal(tok, "<=")) {
+    if (tok->id == P_LE) {
       node = new_binary(ND_LE, node, NULL, tok);
       node->rhs = shift(&tok, tok->next);
       continue;
     }
 
-    if (equal(tok, ">")) {
+    if (tok->id == P_GT) {
       node = new_binary(ND_LT, NULL, node, tok);
       node->lhs = shift(&tok, tok->next);
       continue;
     }
 
-    if (equal(tok, ">=")) {
+    if (tok->id == P_GE) {
       node = new_binary(ND_LE, NULL, node, tok);
       node->lhs = shift(&tok, tok->next);
       continue;
@@ -1556,13 +1581,13 @@ static Node *shift(Token **rest, Token *tok) {
   Node *node = add(&tok, tok);
 
   for (;;) {
-    if (equal(tok, "<<")) {
+    if (tok->id == P_SHL) {
       node = new_binary(ND_SHL, node, NULL, tok);
       node->rhs = add(&tok, tok->next);
       continue;
     }
 
-    if (equal(tok, ">>")) {
+    if (tok->id == P_SHR) {
       node = new_binary(ND_SHR, node, NULL, tok);
       node->rhs = add(&tok, tok->next);
       continue;
@@ -1632,12 +1657,12 @@ static Node *add(Token **rest, Token *tok) {
   for (;;) {
     Token *start = tok;
 
-    if (equal(tok, "+")) {
+    if (tok->id == P_PLUS) {
       node = new_add(node, mul(&tok, tok->next), start);
       continue;
     }
 
-    if (equal(tok, "-")) {
+    if (tok->id == P_MINUS) {
       node = new_sub(node, mul(&tok, tok->next), start);
       continue;
     }
@@ -1652,19 +1677,19 @@ static Node *mul(Token **rest, Token *tok) {
   Node *node = cast(&tok, tok);
 
   for (;;) {
-    if (equal(tok, "*")) {
+    if (tok->id == P_STAR) {
       node = new_binary(ND_MUL, node, NULL, tok);
       node->rhs = cast(&tok, tok->next);
       continue;
     }
 
-    if (equal(tok, "/")) {
+    if (tok->id == P_SLASH) {
       node = new_binary(ND_DIV, node, NULL, tok);
       node->rhs = cast(&tok, tok->next);
       continue;
     }
 
-    if (equal(tok, "%")) {
+    if (tok->id == P_PERCENT) {
       node = new_binary(ND_MOD, node, NULL, tok);
       node->rhs = cast(&tok, tok->next);
       continue;
@@ -1694,12 +1719,12 @@ static Node *compound_literal(Token **rest, Token *tok, Type *ty, Token *start)
 //      | "(" type-name ")" cast
 //      | unary
 static Node *cast(Token **rest, Token *tok) {
-  if (equal(tok, "(") && is_typename(tok->next)) {
+  if (tok->id == P_LPAREN && is_typename(tok->next)) {
     Token *start = tok;
     Type *ty = typename(&tok, tok->next);
-    tok = skip(tok, ")");
+    tok = skip(tok, P_RPAREN);
 
-    if (equal(tok, "{"))
+    if (tok->id == P_LBRACE)
       return compound_literal(rest, tok, ty, start);
 
     Node *node = new_unary(ND_CAST, NULL, start);
@@ -1716,30 +1741,30 @@ static Node *cast(Token **rest, Token *tok) {
 //       | ("++" | "--") unary
 //       | postfix
 static Node *unary(Token **rest, Token *tok) {
-  if (equal(tok, "+"))
+  if (tok->id == P_PLUS)
     return cast(rest, tok->next);
 
-  if (equal(tok, "-"))
+  if (tok->id == P_MINUS)
     return new_binary(ND_SUB, new_num(0, tok), cast(rest, tok->next), tok);
 
-  if (equal(tok, "&"))
+  if (tok->id == P_AMP)
     return new_unary(ND_ADDR, cast(rest, tok->next), tok);
 
-  if (equal(tok, "*"))
+  if (tok->id == P_STAR)
     return new_unary(ND_DEREF, cast(rest, tok->next), tok);
 
-  if (equal(tok, "!"))
+  if (tok->id == P_NOT)
     return new_unary(ND_NOT, cast(rest, tok->next), tok);
 
-  if (equal(tok, "~"))
+  if (tok->id == P_TILDE)
     return new_unary(ND_BITNOT, cast(rest, tok->next), tok);
 
   // Read ++i as i+=1
-  if (equal(tok, "++"))
+  if (tok->id == P_INC)
     return to_assign(new_add(unary(rest, tok->next), new_num(1, tok), tok));
 
   // Read --i as i-=1
-  if (equal(tok, "--"))
+  if (tok->id == P_DEC)
     return to_assign(new_sub(unary(rest, tok->next), new_num(1, tok), tok));
 
   return postfix(rest, tok);
@@ -1750,16 +1775,16 @@ static Member *struct_members(Token **rest, Token *tok) {
   Member head = {};
   Member *cur = &head;
 
-  while (!equal(tok, "}")) {
+  while (tok->id != P_RBRACE) {
     VarAttr attr = {};
     Type *basety = typespec(&tok, tok, &attr);
     int cnt = 0;
 
-    while (!consume(&tok, tok, ";")) {
+    while (!consume(&tok, tok, P_SEMICOLON)) {
       if (cnt++)
-        tok = skip(tok, ",");
+        tok = skip(tok, P_COMMA);
 
-      Member *mem = calloc(1, sizeof(Member));
+      Member *mem = alloc_obj(AK_MEMBER, sizeof(Member));
       mem->ty = declarator(&tok, tok, basety);
       mem->name = mem->ty->name;
       mem->align = attr.align ? attr.align : mem->ty->align;
@@ -1780,7 +1805,7 @@ static Type *struct_union_decl(Token **rest, Token *tok) {
     tok = tok->next;
   }
 
-  if (tag && !equal(tok, "{")) {
+  if (tag && tok->id != P_LBRACE) {
     *rest = tok;
 
     TagScope *sc = find_tag(tag);
@@ -1793,7 +1818,7 @@ static Type *struct_union_decl(Token **rest, Token *tok) {
     return ty;
   }
 
-  tok = skip(tok, "{");
+  tok = skip(tok, P_LBRACE);
 
   // Construct a struct object.
   Type *ty = struct_type();
@@ -1851,8 +1876,7 @@ static Type *union_decl(Token **rest, Token *tok) {
 
 static Member *get_struct_member(Type *ty, Token *tok) {
   for (Member *mem = ty->members; mem; mem = mem->next)
-    if (mem->name->len == tok->len &&
-        !strncmp(mem->name->loc, tok->loc, tok->len))
+    if (mem->name->name == tok->name)
       return mem;
   error_tok(tok, "no such member");
 }
@@ -1900,7 +1924,7 @@ static Node *postfix(Token **rest, Token *tok) {
   Node *node = primary(&tok, tok);
 
   for(;;) {
-    if (equal(tok, "(")) {
+    if (tok->id == P_LPAREN) {
       add_type(node);
 
       Type *ty = node->ty;
@@ -1914,22 +1938,22 @@ static Node *postfix(Token **rest, Token *tok) {
       continue;
     }
 
-    if (equal(tok, "[")) {
+    if (tok->id == P_LBRACKET) {
       // x[y] is shoert for *(x+y)
       Token *start = tok;
       Node *idx = expr(&tok, tok->next);
-      tok = skip(tok, "]");
+      tok = skip(tok, P_RBRACKET);
       node = new_unary(ND_DEREF, new_add(node, idx, start), start);
       continue;
     }
 
-    if (equal(tok, ".")) {
+    if (tok->id == P_DOT) {
       node = struct_ref(node, tok->next);
       tok = tok->next->next;
       continue;
     }
 
-    if (equal(tok, "->")) {
+    if (tok->id == P_ARROW) {
       // x->y is short for (*x).y
       node = new_unary(ND_DEREF, node, tok);
       node = struct_ref(node, tok->next);
@@ -1937,13 +1961,13 @@ static Node *postfix(Token **rest, Token *tok) {
       continue;
     }
 
-    if (equal(tok, "++")) {
+    if (tok->id == P_INC) {
       node = new_inc_dec(node, tok, true);
       tok = tok->next;
       continue;
     }
 
-    if (equal(tok, "--")) {
+    if (tok->id == P_DEC) {
       node = new_inc_dec(node, tok, false);
       tok = tok->next;
       continue;
@@ -1959,13 +1983,13 @@ static Node *func_args(Token **rest, Token *tok) {
   Node head = {};
   Node *cur = &head;
 
-  while (!equal(tok, ")")) {
+  while (tok->id != P_RPAREN) {
     if (cur != &head)
-      tok = skip(tok, ",");
+      tok = skip(tok, P_COMMA);
     cur = cur->next = assign(&tok, tok);
   }
 
-  *rest = skip(tok, ")");
+  *rest = skip(tok, P_RPAREN);
   return head.next;
 }
 
@@ -1978,11 +2002,11 @@ static Node *func_args(Token **rest, Token *tok) {
 //         | str
 //         | num
 static Node *primary(Token **rest, Token *tok) {
-  if (equal(tok, "(") && equal(tok->next, "{")) {
+  if (tok->id == P_LPAREN && tok->next->id == P_LBRACE) {
     // This is a GNU statment expression.
     Node *node = new_node(ND_STMT_EXPR, tok);
     node->body = compound_stmt(&tok, tok->next->next)->body;
-    *rest = skip(tok, ")");
+    *rest = skip(tok, P_RPAREN);
 
     Node *cur = node->body;
     while (cur->next)
@@ -1993,28 +2017,29 @@ static Node *primary(Token **rest, Token *tok) {
     return node;
   }
 
-  if (equal(tok, "(")) {
+  if (tok->id == P_LPAREN) {
     Node *node = expr(&tok, tok->next);
-    *rest = skip(tok, ")");
+    *rest = skip(tok, P_RPAREN);
     return node;
   }
 
-  if (equal(tok, "sizeof") && equal(tok->next, "(") && is_typename(tok->next->next)) {
+  if (tok->id == KW_SIZEOF && tok->next->id == P_LPAREN &&
+      is_typename(tok->next->next)) {
     Type *ty = typename(&tok, tok->next->next);
-    *rest = skip(tok, ")");
+    *rest = skip(tok, P_RPAREN);
     return new_ulong(size_of(ty), tok);
   }
 
-  if (equal(tok, "sizeof")) {
+  if (tok->id == KW_SIZEOF) {
     Node *node = unary(rest, tok->next);
     add_type(node);
     return new_ulong(size_of(node->ty), tok);
   }
 
-  if (equal(tok, "alignof")) {
-    tok = skip(tok->next, "(");
+  if (tok->id == KW_ALIGNOF) {
+    tok = skip(tok->next, P_LPAREN);
     Type *ty = typename(&tok, tok);
-    *rest = skip(tok, ")");
+    *rest = skip(tok, P_RPAREN);
     return new_ulong(ty->align, tok);
   }
 
@@ -2030,10 +2055,9 @@ static Node *primary(Token **rest, Token *tok) {
         return new_num(sc->enum_val, tok);
     }
 
-    if (equal(tok->next, "(")) {
+    if (tok->next->id == P_LPAREN) {
       warn_tok(tok, "implicit declaration of a function");
-      char *name = strndup(tok->loc, tok->len);
-      Var *var = new_gvar(name, func_type(ty_int), false, false);
+      Var *var = new_gvar(tok->name, func_type(ty_int), false, false);
       return new_var_node(var, tok);
     }
 
@@ -2041,7 +2065,7 @@ static Node *primary(Token **rest, Token *tok) {
   }
 
   if (tok->kind == TK_STR) {
-    Var *var = new_string_literal(tok->contents, tok->cont_len);
+    Var *var = new_string_literal(tok->lit->contents, tok->lit->cont_len);
     *rest = tok->next;
     return new_var_node(var, tok);
   }
@@ -2049,12 +2073,66 @@ static Node *primary(Token **rest, Token *tok) {
   if (tok->kind != TK_NUM)
     error_tok(tok, "expected expression");
 
-  Node *node = new_num(tok->val, tok);
-  node->ty = tok->ty;
+  Node *node = new_num(tok->lit->val, tok);
+  node->ty = tok->lit->ty;
   *rest = tok->next;
   return node;
 }
 
+// Saves file-scope declarations to a precompiled header.
+void save_scopes(void) {
+  long n = 0;
+  for (VarScope *sc = var_scope; sc; sc = sc->next)
+    n++;
+  pch_put_long(n);
+
+  for (VarScope *sc = var_scope; sc; sc = sc->next) {
+    pch_put_str(sc->name);
+    pch_put_var(sc->var);
+    pch_put_type(sc->type_def);
+    pch_put_type(sc->enum_ty);
+    pch_put_long(sc->enum_val);
+  }
+
+  n = 0;
+  for (TagScope *sc = tag_scope; sc; sc = sc->next)
+    n++;
+  pch_put_long(n);
+
+  for (TagScope *sc = tag_scope; sc; sc = sc->next) {
+    pch_put_str(sc->name);
+    pch_put_type(sc->ty);
+  }
+}
+
+// Restores file-scope declarations from a precompiled header.
+void load_scopes(void) {
+  VarScope head = {};
+  VarScope *cur = &head;
+
+  for (long n = pch_get_long(); n > 0; n--) {
+    cur = cur->next = alloc_obj(AK_VAR_SCOPE, sizeof(VarScope));
+    cur->name = pch_get_name();
+    cur->var = pch_get_var();
+    cur->type_def = pch_get_type();
+    cur->enum_ty = pch_get_type();
+    cur->enum_val = pch_get_long();
+  }
+  cur->next = var_scope;
+  var_scope = head.next;
+
+  TagScope head2 = {};
+  TagScope *cur2 = &head2;
+
+  for (long n = pch_get_long(); n > 0; n--) {
+    cur2 = cur2->next = alloc_obj(AK_TAG_SCOPE, sizeof(TagScope));
+    cur2->name = pch_get_name();
+    cur2->ty = pch_get_type();
+  }
+  cur2->next = tag_scope;
+  tag_scope = head2.next;
+}
+
 // program = (funcdef | global-var)*
 Program *parse(Token *tok) {
   // Add built-in function types.
@@ -2069,7 +2147,7 @@ Program *parse(Token *tok) {
     Token *start = tok;
     VarAttr attr = {};
     Type *basety = typespec(&tok, tok, &attr);
-    if (consume (&tok, tok, ";"))
+    if (consume (&tok, tok, P_SEMICOLON))
       continue;
     Type *ty = declarator(&tok, tok, basety);
 
@@ -2080,9 +2158,9 @@ Program *parse(Token *tok) {
           error_tok(ty->name_pos, "typedef name omitted");
         push_scope(get_ident(ty->name))->type_def = ty;
 
-        if (consume(&tok, tok, ";"))
+        if (consume(&tok, tok, P_SEMICOLON))
           break;
-        tok = skip(tok, ",");
+        tok = skip(tok, P_COMMA);
         ty = declarator(&tok, tok, basety);
       }
       continue;
@@ -2091,7 +2169,7 @@ Program *parse(Token *tok) {
     // Function
     if (ty->kind == TY_FUNC) {
       current_fn = new_gvar(get_ident(ty->name), ty, true, false);
-      if (!consume(&tok, tok, ";"))
+      if (!consume(&tok, tok, P_SEMICOLON))
         cur = cur->next = funcdef(&tok, start);
       continue;
     }
@@ -2105,17 +2183,17 @@ Program *parse(Token *tok) {
       if (attr.align)
         var->align = attr.align;
 
-      if (equal(tok, "="))
+      if (tok->id == P_ASSIGN)
         var->initializer = gvar_initializer(&tok, tok->next, ty);
 
-      if (consume(&tok, tok, ";"))
+      if (consume(&tok, tok, P_SEMICOLON))
         break;
-      tok = skip(tok, ",");
+      tok = skip(tok, P_COMMA);
       ty = declarator(&tok, tok, basety);
     }
   }
 
-  Program *prog = calloc(1, sizeof(Program));
+  Program *prog = alloc_obj(AK_FUNCTION, sizeof(Program));
   prog->globals = globals;
   prog->fns = head.next;
   return prog;
@@ -0,0 +1,488 @@
+// This file implements precompiled headers.
+//
+// `punyc --emit-pch foo.h -o foo.pch` preprocesses and parses a
+// header, and saves the resulting state of the preprocessor (macros)
+// and the parser (file-scope typedefs, struct/union/enum tags, enum
+// constants and extern declarations) to a file. `-include-pch
+// foo.pch` restores that state before compiling a file, which has
+// the same effect as including the header first but doesn't
+// tokenize nor parse it again.
+//
+// The saved state is a graph of Types, Tokens, Vars and so on which
+// may have cycles (e.g. a struct with a pointer to itself). We
+// serialize it by visiting each object only once: the first
+// reference to an object writes it out in full and implicitly
+// assigns it a new ID, and later references are written as the ID.
+
+#include "punyc.h"
+
+static char *pch_magic = "PUNYCPCH";
+
+// Bump this if the file format changes.
+enum { PCH_VERSION = 7 };
+
+// A reference to an object which is written out right after it.
+enum { NEW_OBJECT = -1 };
+
+// Writer states
+static char *out;
+static long out_len;
+static long out_cap;
+static HashMap obj_ids;
+static long nr_objs;
+
+// Reader states
+static char *in;
+static long in_len;
+static long in_pos;
+static char *in_path;
+static void **objs;
+static long objs_cap;
+
+// File numbers in the precompiled header are mapped to new ones
+// when a token from the file is read for the first time.
+static int *file_map;
+static int file_map_cap;
+
+// Built-in types are not written out, but always referred to by ID.
+static Type **builtin_types(void) {
+  static Type *types[11];
+  types[0] = ty_void;
+  types[1] = ty_bool;
+  types[2] = ty_char;
+  types[3] = ty_short;
+  types[4] = ty_int;
+  types[5] = ty_long;
+  types[6] = ty_uchar;
+  types[7] = ty_ushort;
+  types[8] = ty_uint;
+  types[9] = ty_ulong;
+  types[10] = NULL;
+  return types;
+}
+
+//
+// Writer
+//
+
+static void put_bytes(void *p, long len) {
+  if (out_len + len > out_cap) {
+    while (out_len + len > out_cap)
+      out_cap = out_cap ? out_cap * 2 : 4096;
+    out = realloc(out, out_cap);
+  }
+  memcpy(out + out_len, p, len);
+  out_len += len;
+}
+
+void pch_put_long(long val) {
+  put_bytes(&val, sizeof(val));
+}
+
+// Assigns a new ID to a given object.
+static void add_id(void *p) {
+  char *key = alloc_obj(AK_STRING, sizeof(p));
+  memcpy(key, &p, sizeof(p));
+  hashmap_put2(&obj_ids, key, sizeof(p), (void *)++nr_objs);
+}
+
+// Writes a reference to a given object. Returns true if the object
+// is seen for the first time, in which case the caller must write
+// out its contents.
+static bool put_ref(void *p) {
+  if (!p) {
+    pch_put_long(0);
+    return false;
+  }
+
+  long id = (long)hashmap_get2(&obj_ids, (char *)&p, sizeof(p));
+  if (id) {
+    pch_put_long(id);
+    return false;
+  }
+
+  add_id(p);
+  pch_put_long(NEW_OBJECT);
+  return true;
+}
+
+static void put_blob(char *p, long len) {
+  pch_put_long(len);
+  put_bytes(p, len);
+}
+
+void pch_put_str(char *s) {
+  if (put_ref(s))
+    put_blob(s, strlen(s));
+}
+
+static void put_file(File *file) {
+  if (!put_ref(file))
+    return;
+  pch_put_str(file->name);
+  pch_put_str(file->contents);
+  pch_put_long(file->file_no);
+}
+
+static void put_literal(Literal *lit) {
+  if (!put_ref(lit))
+    return;
+  pch_put_long(lit->val);
+  pch_put_type(lit->ty);
+  pch_put_long(lit->contents != NULL);
+  if (lit->contents)
+    put_blob(lit->contents, lit->cont_len);
+}
+
+static void put_token_fields(Token *tok) {
+  pch_put_long(tok->kind);
+  pch_put_long(tok->id);
+  put_file(tok->file);
+  pch_put_long(tok->loc - tok->file->contents);
+  pch_put_long(tok->len);
+  pch_put_long(tok->name != NULL);
+  put_literal(tok->lit);
+  pch_put_long(tok->lineno);
+  pch_put_long(tok->at_bol);
+  pch_put_long(tok->has_space);
+}
+
+// Writes a single token. Its `next` is not followed.
+void pch_put_token(Token *tok) {
+  if (put_ref(tok))
+    put_token_fields(tok);
+}
+
+// Writes a list of tokens.
+void pch_put_tokens(Token *tok) {
+  long n = 0;
+  for (Token *t = tok; t; t = t->next)
+    n++;
+
+  pch_put_long(n);
+  for (Token *t = tok; t; t = t->next)
+    put_token_fields(t);
+}
+
+static void put_member(Member *mem) {
+  if (!put_ref(mem))
+    return;
+  put_member(mem->next);
+  pch_put_type(mem->ty);
+  pch_put_token(mem->tok);
+  pch_put_token(mem->name);
+  pch_put_long(mem->align);
+  pch_put_long(mem->offset);
+}
+
+void pch_put_type(Type *ty) {
+  if (!put_ref(ty))
+    return;
+  pch_put_long(ty->kind);
+  pch_put_long(ty->size);
+  pch_put_long(ty->align);
+  pch_put_long(ty->is_unsigned);
+  pch_put_long(ty->is_incomplete);
+  pch_put_long(ty->is_const);
+  pch_put_type(ty->base);
+  pch_put_token(ty->name);
+  pch_put_token(ty->name_pos);
+  pch_put_long(ty->array_len);
+  put_member(ty->members);
+  pch_put_type(ty->return_ty);
+  pch_put_type(ty->params);
+  pch_put_long(ty->is_varargs);
+  pch_put_type(ty->next);
+}
+
+void pch_put_var(Var *var) {
+  if (!put_ref(var))
+    return;
+  pch_put_str(var->name);
+  pch_put_type(var->ty);
+  pch_put_token(var->tok);
+  pch_put_long(var->align);
+  pch_put_long(var->is_static);
+}
+
+static void put_compiler_id(void) {
+  struct stat st = {};
+  stat("/proc/self/exe", &st);
+  pch_put_long(st.st_size);
+  pch_put_long(st.st_mtim.tv_sec);
+  pch_put_long(st.st_mtim.tv_nsec);
+}
+
+// Writes the current preprocessor and parser states to a given file.
+void write_pch(char *path) {
+  nr_objs = 0;
+  put_bytes(pch_magic, strlen(pch_magic));
+  pch_put_long(PCH_VERSION);
+  put_compiler_id();
+
+  for (Type **ty = builtin_types(); *ty; ty++)
+    add_id(*ty);
+
+  save_file_ids();
+  save_macros();
+  save_scopes();
+
+  open_output(path);
+  write_output(out, out_len);
+}
+
+//
+// Reader
+//
+
+static void get_bytes(void *p, long len) {
+  if (in_pos + len > in_len)
+    error("%s: corrupted precompiled header", in_path);
+  memcpy(p, in + in_pos, len);
+  in_pos += len;
+}
+
+long pch_get_long(void) {
+  long val;
+  get_bytes(&val, sizeof(val));
+  return val;
+}
+
+static void add_obj(void *p) {
+  if (nr_objs == objs_cap) {
+    objs_cap = objs_cap ? objs_cap * 2 : 1024;
+    objs = realloc(objs, sizeof(void *) * objs_cap);
+  }
+  objs[nr_objs++] = p;
+}
+
+// Reads a reference written by put_ref(). If it's a new object,
+// sets `fresh` to true, and the caller must read its contents and
+// register it with add_obj().
+static void *get_ref(bool *fresh) {
+  *fresh = false;
+
+  long id = pch_get_long();
+  if (id == 0)
+    return NULL;
+
+  if (id == NEW_OBJECT) {
+    *fresh = true;
+    return NULL;
+  }
+
+  if (id < 1 || id > nr_objs)
+    error("%s: corrupted precompiled header", in_path);
+  return objs[id - 1];
+}
+
+static char *get_blob(long *len) {
+  *len = pch_get_long();
+  if (*len < 0 || in_pos + *len > in_len)
+    error("%s: corrupted precompiled header", in_path);
+  char *p = alloc_str(in + in_pos, *len);
+  in_pos += *len;
+  return p;
+}
+
+char *pch_get_str(void) {
+  bool fresh;
+  char *s = get_ref(&fresh);
+  if (!fresh)
+    return s;
+
+  long len;
+  s = get_blob(&len);
+  add_obj(s);
+  return s;
+}
+
+// Reads a string written by pch_put_str() and interns it.
+char *pch_get_name(void) {
+  char *s = pch_get_str();
+  return s ? intern(s, strlen(s)) : NULL;
+}
+
+static int map_file_no(int old, char *filename) {
+  if (old <= 0)
+    return old;
+
+  if (old >= file_map_cap) {
+    int cap = file_map_cap;
+    while (old >= file_map_cap)
+      file_map_cap = file_map_cap ? file_map_cap * 2 : 16;
+    file_map = realloc(file_map, sizeof(int) * file_map_cap);
+    memset(file_map + cap, 0, sizeof(int) * (file_map_cap - cap));
+  }
+
+  if (!file_map[old])
+    file_map[old] = add_file(filename);
+  return file_map[old];
+}
+
+static File *get_file(void) {
+  bool fresh;
+  File *file = get_ref(&fresh);
+  if (!fresh)
+    return file;
+
+  file = alloc_obj(AK_FILE, sizeof(File));
+  add_obj(file);
+  file->name = pch_get_str();
+  file->contents = pch_get_str();
+  file->file_no = map_file_no(pch_get_long(), file->name);
+  return file;
+}
+
+static Literal *get_literal(void) {
+  bool fresh;
+  Literal *lit = get_ref(&fresh);
+  if (!fresh)
+    return lit;
+
+  lit = alloc_obj(AK_TOKEN, sizeof(Literal));
+  add_obj(lit);
+  lit->val = pch_get_long();
+  lit->ty = pch_get_type();
+  if (pch_get_long()) {
+    long len;
+    lit->contents = get_blob(&len);
+    lit->cont_len = len;
+  }
+  return lit;
+}
+
+static void get_token_fields(Token *tok) {
+  tok->kind = pch_get_long();
+  tok->id = pch_get_long();
+  tok->file = get_file();
+  tok->loc = tok->file->contents + pch_get_long();
+  tok->len = pch_get_long();
+  if (pch_get_long())
+    tok->name = intern(tok->loc, tok->len);
+  tok->lit = get_literal();
+  tok->lineno = pch_get_long();
+  tok->at_bol = pch_get_long();
+  tok->has_space = pch_get_long();
+}
+
+Token *pch_get_token(void) {
+  bool fresh;
+  Token *tok = get_ref(&fresh);
+  if (!fresh)
+    return tok;
+
+  tok = alloc_obj(AK_TOKEN, sizeof(Token));
+  add_obj(tok);
+  get_token_fields(tok);
+  return tok;
+}
+
+Token *pch_get_tokens(void) {
+  Token head = {};
+  Token *cur = &head;
+
+  for (long n = pch_get_long(); n > 0; n--) {
+    cur = cur->next = alloc_obj(AK_TOKEN, sizeof(Token));
+    get_token_fields(cur);
+  }
+  return head.next;
+}
+
+static Member *get_member(void) {
+  bool fresh;
+  Member *mem = get_ref(&fresh);
+  if (!fresh)
+    return mem;
+
+  mem = alloc_obj(AK_MEMBER, sizeof(Member));
+  add_obj(mem);
+  mem->next = get_member();
+  mem->ty = pch_get_type();
+  mem->tok = pch_get_token();
+  mem->name = pch_get_token();
+  mem->align = pch_get_long();
+  mem->offset = pch_get_long();
+  return mem;
+}
+
+Type *pch_get_type(void) {
+  bool fresh;
+  Type *ty = get_ref(&fresh);
+  if (!fresh)
+    return ty;
+
+  ty = alloc_obj(AK_TYPE, sizeof(Type));
+  add_obj(ty);
+  ty->kind = pch_get_long();
+  ty->size = pch_get_long();
+  ty->align = pch_get_long();
+  ty->is_unsigned = pch_get_long();
+  ty->is_incomplete = pch_get_long();
+  ty->is_const = pch_get_long();
+  ty->base = pch_get_type();
+  ty->name = pch_get_token();
+  ty->name_pos = pch_get_token();
+  ty->array_len = pch_get_long();
+  ty->members = get_member();
+  ty->return_ty = pch_get_type();
+  ty->params = pch_get_type();
+  ty->is_varargs = pch_get_long();
+  ty->next = pch_get_type();
+  return ty;
+}
+
+Var *pch_get_var(void) {
+  bool fresh;
+  Var *var = get_ref(&fresh);
+  if (!fresh)
+    return var;
+
+  var = alloc_obj(AK_VAR, sizeof(Var));
+  add_obj(var);
+  var->name = pch_get_str();
+  var->ty = pch_get_type();
+  var->tok = pch_get_token();
+  var->align = pch_get_long();
+  var->is_static = pch_get_long();
+  return var;
+}
+
+// Restores the preprocessor and parser states from a given file.
+void read_pch(char *path) {
+  in_path = path;
+  in = read_file_string(path, NULL);
+  if (!in)
+    error("cannot open %s: %s", path, strerror(errno));
+  in_len = strlen(pch_magic) + sizeof(long) * 4;
+
+  // read_file_string() may have appended a newline.
+  struct stat st;
+  stat(path, &st);
+  if (st.st_size < in_len || memcmp(in, pch_magic, strlen(pch_magic)))
+    error("%s: not a precompiled header", path);
+  in_len = st.st_size;
+  in_pos = strlen(pch_magic);
+
+  // A precompiled header depends on the compiler's data structures,
+  // so it can be used only by the compiler that created it.
+  long version = pch_get_long();
+  struct stat exe = {};
+  stat("/proc/self/exe", &exe);
+  if (version != PCH_VERSION || pch_get_long() != exe.st_size ||
+      pch_get_long() != exe.st_mtim.tv_sec ||
+      pch_get_long() != exe.st_mtim.tv_nsec)
+    error("%s: precompiled header was created by a different compiler", path);
+
+  for (Type **ty = builtin_types(); *ty; ty++)
+    add_obj(*ty);
+
+  // The header and the files it includes must not have changed.
+  char *changed = load_file_ids();
+  if (changed)
+    error("%s: precompiled header is out of date: %s has changed",
+          path, changed);
+
+  load_macros();
+  load_scopes();
+}
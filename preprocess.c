@@ -33,19 +33,71 @@ typedef struct MacroArg MacroArg;
 struct MacroArg {
   MacroArg *next;
   char *name;
-  Token *tok;
+  Token *tok; // The first token of the argument
+  Token *end; // The token following the argument
 };
 
 typedef struct Macro Macro;
 struct Macro {
-  Macro *next;
   char *name;
   bool is_objlike; // Object-like or function-like
   MacroParam *params;
   Token *body;
-  bool deleted;
+  Hideset *hideset; // The hideset containing just this macro
+};
+
+// A macro expansion in progress. The resulting tokens are produced
+// on demand by next(), just like tokens of a lazily tokenized file,
+// so that neither the macro body nor the arguments are copied in
+// advance. A token is copied only once, when it is produced with
+// the new hideset.
+typedef struct Expansion Expansion;
+struct Expansion {
+  Expansion *next;
+  Macro *macro;
+  MacroArg *args;
+  Hideset *hideset; // The hideset added to the resulting tokens
+  Token *body;      // The next token of the macro body
+  Token *arg;       // If not NULL, the next token of an argument
+  Token *arg_end;   // The token following the argument
+  Token *last;      // The last token produced so far
+  Token *cont;      // The token following the macro invocation
+
+  // Adjacent tokens usually have the same hideset, so we reuse the
+  // last result of hideset_union().
+  Hideset *last_hs;
+  Hideset *result_hs;
 };
 
+// What we know about a file that has been included. Different paths
+// to the same file share a FileInfo.
+typedef struct FileInfo FileInfo;
+struct FileInfo {
+  FileId id;
+  bool pragma_once; // The file contains "#pragma once"
+  char *guard;      // The file's include guard macro
+  char *contents;   // The file's contents once it has been read
+
+  // The tokens of an included file are kept and shared by all
+  // includes of the file. While an include is in progress, `cont`
+  // is the token following it, and the FileInfo is in `includes`.
+  Token *tokens;
+  Token *eof;
+  Token *cont;
+  FileInfo *next_include;
+};
+
+// A memoized result of a hideset operation
+typedef enum { HS_UNION, HS_INTERSECTION } HidesetOpKind;
+
+typedef struct {
+  long op;
+  Hideset *hs1;
+  Hideset *hs2;
+  Hideset *result;
+  bool done;
+} HidesetOp;
+
 // `#if` can be nested, so we use a stack to manane nested `#if`s.
 typedef struct CondIncl CondIncl;
 struct CondIncl {
@@ -53,35 +105,99 @@ struct CondIncl {
   enum { IN_THEN, IN_ELSE, IN_ELIF } ctx;
   Token *tok;
   bool included;
+
+  // If this is an #ifndef at the beginning of an included file, the
+  // macro name, the file and the token following the file. If the
+  // matching #endif turns out to end the file, the macro is the
+  // file's include guard.
+  char *guard;
+  FileInfo *guard_file;
+  Token *guard_end;
 };
 
+bool pp_report;
+
 static int file_no;
-static Macro *macros;
+
+// Maps macro names to Macros. Since an identifier token has the
+// same length as its name, find_macro() doesn't need strlen().
+static HashMap macros;
 static CondIncl *cond_incl;
 
+// Macro expansions that have not reached the end, and recycled ones
+static Expansion *expansions;
+static Expansion *free_expansions;
+
+// Map FileIds and paths to FileInfos.
+static HashMap file_ids;
+static HashMap file_paths;
+
+static int nr_include_guards;
+static int nr_pragma_once;
+static long nr_skipped_includes;
+static int nr_token_cache_files;
+static long nr_token_cache_hits;
+
+// Files whose shared tokens are being included, innermost first
+static FileInfo *includes;
+
+// Interned Hidesets, and memoized HidesetOps
+static HashMap hidesets;
+static HashMap hideset_ops;
+static long nr_hidesets;
+static long nr_hideset_ops;
+static long nr_hideset_op_hits;
+
+// The first token of the file that has just been included, if the
+// file starts with "#ifndef".
+static Token *guard_start;
+static FileInfo *guard_file;
+static Token *guard_end;
+
 static Token *read_file2(char *path);
 static Macro *find_macro(Token *tok);
 static Token *preprocess(Token *tok);
+static Token *next(Token *tok);
+
+// Maps a regular file to memory. The mapping is followed by at least
+// two zero bytes so that the result can be used just like a string
+// returned by read_stream().
+static char *map_file(int fd, long size, long *mapping) {
+  long page = sysconf(_SC_PAGESIZE);
+  long len = (size + 2 + page - 1) / page * page;
+
+  // Reserve zero-filled memory first, and then map the file over
+  // it, so that the bytes after the end of the file are accessible.
+  // (Touching a page entirely past EOF of a file mapping raises
+  // SIGBUS.)
+  char *buf = mmap(NULL, len, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (buf == MAP_FAILED)
+    return NULL;
 
-// Returns the contents of a given file.
-static char *read_file_string(char *path) {
-  // By convention, read from stdin if a given filename is "-".
-  FILE *fp = stdin;
-  if (strcmp(path, "-")) {
-    fp = fopen(path, "r");
-    if (!fp)
-      return NULL;
+  if (mmap(buf, size, PROT_READ | PROT_WRITE,
+           MAP_PRIVATE | MAP_FIXED | MAP_POPULATE, fd, 0) == MAP_FAILED) {
+    munmap(buf, len);
+    return NULL;
   }
 
+  count_alloc(AK_FILE, len);
+  *mapping = len;
+  return buf;
+}
+
+// Reads everything from a non-seekable file such as a pipe.
+static char *read_stream(int fd, long *len) {
   int buflen = 4096;
   int nread = 0;
   char *buf = malloc(buflen);
 
-  // Read the entire file.
   for (;;) {
     int end = buflen - 2; // extra 2 bytes for the trailing "\n\0"
-    int n = fread(buf + nread, 1, end - nread, fp);
-    if (n == 0)
+    int n = read(fd, buf + nread, end - nread);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
       break;
     nread += n;
     if (nread == end) {
@@ -90,23 +206,185 @@ static char *read_file_string(char *path) {
     }
   }
 
-  if (fp != stdin)
-    fclose(fp);
+  buf[nread] = '\0';
+  count_alloc(AK_FILE, buflen);
+  *len = nread;
+  return buf;
+}
+
+// Gets the identity of a given file. Returns false if the file
+// cannot be stat'ed.
+bool get_file_id(char *path, FileId *id) {
+  struct stat st;
+  if (stat(path, &st))
+    return false;
+
+  memset(id, 0, sizeof(FileId));
+  id->dev = st.st_dev;
+  id->ino = st.st_ino;
+  id->size = st.st_size;
+  id->mtime_sec = st.st_mtim.tv_sec;
+  id->mtime_nsec = st.st_mtim.tv_nsec;
+  return true;
+}
+
+// Returns the FileInfo of a given file, or NULL if the file cannot
+// be stat'ed. Each path is stat'ed only once.
+static FileInfo *get_file_info(char *path) {
+  FileInfo *fi = hashmap_get(&file_paths, path);
+  if (fi)
+    return fi;
+
+  FileId id;
+  if (!strcmp(path, "-") || !get_file_id(path, &id))
+    return NULL;
+
+  fi = hashmap_get2(&file_ids, (char *)&id, sizeof(id));
+  if (!fi) {
+    fi = alloc_obj(AK_FILE, sizeof(FileInfo));
+    fi->id = id;
+    hashmap_put2(&file_ids, (char *)&fi->id, sizeof(FileId), fi);
+  }
+  hashmap_put(&file_paths, path, fi);
+  return fi;
+}
+
+// Returns the contents of a given file. If `mapping` is not NULL,
+// it's set to the size of the memory mapping that holds the contents,
+// or to 0 if they were read into memory from malloc().
+char *read_file_string(char *path, long *mapping) {
+  // By convention, read from stdin if a given filename is "-".
+  int fd = 0;
+  if (strcmp(path, "-")) {
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+      return NULL;
+  }
+
+  timer_start(PH_READ);
+
+  // Regular files are mapped to memory rather than copied.
+  struct stat st;
+  char *buf = NULL;
+  long len = 0;
+  long mapped = 0;
+  if (fd != 0 && !fstat(fd, &st) && (st.st_mode & S_IFMT) == S_IFREG &&
+      st.st_size > 0) {
+    len = st.st_size;
+    buf = map_file(fd, len, &mapped);
+  }
+  if (!buf)
+    buf = read_stream(fd, &len);
+
+  if (fd != 0)
+    close(fd);
 
   // Canonicalize the last line by appending "\n"
   // if it does not end with a newline.
-  if (nread == 0 || buf[nread - 1] != '\n')
-    buf[nread++] = '\n';
-  buf[nread] = '\0';
+  if (len == 0 || buf[len - 1] != '\n')
+    buf[len++] = '\n';
+  buf[len] = '\0';
+  timer_count(PH_READ, len);
+  timer_stop();
+
+  if (mapping)
+    *mapping = mapped;
+  return buf;
+}
 
-  // Emit a .file directive for the assembler.
+// Releases the contents of a file returned by read_file_string().
+void free_file_string(char *buf, long mapping) {
+  if (mapping)
+    munmap(buf, mapping);
+  else
+    free(buf);
+}
+
+// Assigns a new file number to a given file, and emits a .file
+// directive for the assembler.
+int add_file(char *path) {
+  file_no++;
   if (!preprocess_only)
-    printf(".file %d \"%s\"\n", ++file_no, path);
-  return buf;
+    println(".file %d \"%s\"", file_no, path);
+  return file_no;
+}
+
+// Starts including the shared tokens of a file. The last token
+// is followed by `cont`, which next() takes care of.
+static Token *include_shared(FileInfo *fi, Token *cont) {
+  if (fi->tokens == fi->eof)
+    return cont;
+  fi->cont = cont;
+  fi->next_include = includes;
+  includes = fi;
+  return fi->tokens;
+}
+
+// Reads and tokenizes a given file. The last token of the file is
+// followed by `cont`, or by an EOF token if `cont` is NULL. Returns
+// NULL if the file cannot be read.
+//
+// A file is tokenized lazily when it's read for the first time, so
+// that a file read only once doesn't take more memory than that. If
+// it's included again (e.g. an X-macro table), it's tokenized as a
+// whole, and the tokens are kept and shared by that and later
+// includes. The shared tokens are never modified; ones passed on to
+// the output are copied.
+static Token *tokenize_file(char *path, Token *cont) {
+  FileInfo *fi = get_file_info(path);
+  if (fi && fi->tokens) {
+    nr_token_cache_hits++;
+    note_input_file(path);
+
+    // The tokens refer to the file number assigned when the file was
+    // read, so we don't need a new one unless we make a copy. A file
+    // including itself needs a copy, as its last token can't be
+    // followed by two different tokens.
+    if (!fi->cont)
+      return include_shared(fi, cont);
+    add_file(path);
+    return tokenize_cached(fi->tokens, path, file_no, cont);
+  }
+
+  // A file read before is still in memory.
+  Token *cached = find_cached_file(path);
+  char *input = NULL;
+  if (!cached) {
+    input = (fi && fi->contents) ? fi->contents : read_file_string(path, NULL);
+    if (!input)
+      return NULL;
+  }
+
+  note_input_file(path);
+  add_file(path);
+
+  if (!fi || !cont || !fi->contents) {
+    if (fi)
+      fi->contents = cached ? cached->file->contents : input;
+    if (cached)
+      return tokenize_cached(cached, path, file_no, cont);
+    return tokenize_lazy(path, file_no, input, cont);
+  }
+
+  if (cached)
+    fi->tokens = tokenize_cached(cached, path, file_no, NULL);
+  else
+    fi->tokens = tokenize(path, file_no, input);
+  nr_token_cache_files++;
+
+  Token *tok = fi->tokens;
+  for (;; tok = next_token(tok)) {
+    tok->is_raw = false;
+    tok->is_shared = true;
+    if (tok->kind == TK_EOF)
+      break;
+  }
+  fi->eof = tok;
+  return include_shared(fi, cont);
 }
 
 static bool is_hash(Token *tok) {
-  return tok->at_bol && equal(tok, "#");
+  return tok->at_bol && tok->id == P_HASH;
 }
 
 // Some preprocessor directives suc as #include allow extraneous
@@ -116,95 +394,245 @@ static Token *skip_line(Token *tok) {
     return tok;
   warn_tok(tok, "extra token");
   while (tok->at_bol)
-    tok = tok->next;
+    tok = next(tok);
   return tok;
 }
 
 static Token *copy_token(Token *tok) {
-  Token *t = malloc(sizeof(Token));
+  Token *t = alloc_obj(AK_TOKEN, sizeof(Token));
   *t = *tok;
   t->next = NULL;
-  t->ty = NULL;
+  t->is_shared = false;
   return t;
 }
 
 static Token *new_eof(Token *tok) {
   Token *t = copy_token(tok);
   t->kind = TK_EOF;
+  t->id = ID_NONE;
   t->len = 0;
+  t->lit = NULL;
   return t;
 }
 
-static Hideset *new_hideset(char *name) {
-  Hideset *hs = calloc(1, sizeof(Hideset));
-  hs->name = name;
+// Returns a hideset node. Nodes are hash-consed: there is only one
+// node for each combination of children, prefix and bit.
+static Hideset *new_hideset(Hideset *left, Hideset *right, long prefix,
+                            long bit, char *name) {
+  // Hidesets are keyed by their first four members.
+  int keylen = sizeof(Hideset *) * 2 + sizeof(long) * 2;
+  Hideset key = {};
+  key.left = left;
+  key.right = right;
+  key.prefix = prefix;
+  key.bit = bit;
+
+  Hideset *hs = hashmap_get2(&hidesets, (char *)&key, keylen);
+  if (hs)
+    return hs;
+
+  hs = alloc_obj(AK_HIDESET, sizeof(Hideset));
+  *hs = key;
+  if (left) {
+    hs->bloom = left->bloom | right->bloom;
+  } else {
+    hs->name = name;
+    hs->bloom = 1UL << (prefix & 63);
+  }
+  hashmap_put2(&hidesets, (char *)hs, keylen, hs);
+  nr_hidesets++;
   return hs;
 }
 
-static Hideset *hideset_union(Hideset *hs1, Hideset *hs2) {
-  Hideset head = {};
-  Hideset *cur = &head;
+static Hideset *new_leaf(char *name) {
+  return new_hideset(NULL, NULL, name_id(name), 0, name);
+}
 
-  for (; hs1; hs1 = hs1->next)
-    cur = cur->next = new_hideset(hs1->name);
-  cur->next =hs2;
-  return head.next;
+static bool is_leaf(Hideset *hs) {
+  return !hs->left;
 }
 
-static bool hideset_contains(Hideset *hs, char *s, int len) {
-  for (; hs; hs = hs->next)
-    if (strlen(hs->name) == len && !strncmp(hs->name, s, len))
-      return true;
-  return false;
+// Returns the bits of `id` below `bit`.
+static long mask_bits(long id, long bit) {
+  return id & (bit - 1);
 }
 
-static Hideset *hideset_intersection(Hideset *hs1, Hideset *hs2) {
-  Hideset head = {};
-  Hideset *cur = &head;
+static bool has_prefix(long id, long prefix, long bit) {
+  return mask_bits(id, bit) == prefix;
+}
 
-  for (; hs1; hs1 = hs1->next)
-    if (hideset_contains(hs2, hs1->name, strlen(hs1->name)))
-      cur = cur->next = new_hideset(hs1->name);
-  return head.next;
+// Returns a node for the union of two disjoint trees whose prefixes
+// differ.
+static Hideset *join(long p1, Hideset *hs1, long p2, Hideset *hs2) {
+  long x = p1 ^ p2;
+  long bit = x & -x;
+  if (p1 & bit)
+    return new_hideset(hs2, hs1, mask_bits(p1, bit), bit, NULL);
+  return new_hideset(hs1, hs2, mask_bits(p1, bit), bit, NULL);
 }
 
-static Token *add_hideset(Token *tok, Hideset *hs) {
-  Token head = {};
-  Token *cur = &head;
+// Returns a node with given children, either of which may be empty.
+static Hideset *new_branch(Hideset *left, Hideset *right, long prefix,
+                           long bit) {
+  if (!left)
+    return right;
+  if (!right)
+    return left;
+  return new_hideset(left, right, prefix, bit, NULL);
+}
 
-  for (; tok; tok = tok->next) {
-    Token *t = copy_token(tok);
-    t->hideset = hideset_union(t->hideset, hs);
-    cur = cur->next = t;
+// Looks up a memoized result of `op` applied to `hs1` and `hs2`.
+static HidesetOp *find_hideset_op(HidesetOpKind op, Hideset *hs1,
+                                  Hideset *hs2) {
+  HidesetOp key = {};
+  key.op = op;
+  key.hs1 = hs1;
+  key.hs2 = hs2;
+  int keylen = sizeof(long) + sizeof(Hideset *) * 2;
+  nr_hideset_ops++;
+
+  HidesetOp *ent = hashmap_get2(&hideset_ops, (char *)&key, keylen);
+  if (ent) {
+    nr_hideset_op_hits++;
+    return ent;
   }
-  return head.next;
+
+  ent = alloc_obj(AK_HIDESET, sizeof(HidesetOp));
+  *ent = key;
+  hashmap_put2(&hideset_ops, (char *)ent, keylen, ent);
+  return ent;
 }
 
-// Append tok2 to the end fo tok1.
-static Token *append(Token *tok1, Token *tok2) {
-  if (!tok1 || tok1->kind == TK_EOF)
-    return tok2;
+static bool hideset_contains(Hideset *hs, char *name) {
+  if (!hs || !name)
+    return false;
 
-  Token head = {};
-  Token *cur = &head;
+  long id = name_id(name);
+  if (!(hs->bloom & (1UL << (id & 63))))
+    return false;
 
-  for(; tok1 && tok1->kind != TK_EOF; tok1 = tok1->next)
-    cur = cur->next =copy_token(tok1);
-  cur->next = tok2;
-  return head.next;
+  while (!is_leaf(hs)) {
+    if (!has_prefix(id, hs->prefix, hs->bit))
+      return false;
+    hs = (id & hs->bit) ? hs->right : hs->left;
+  }
+  return hs->name == name;
+}
+
+static Hideset *hideset_add(Hideset *hs, char *name) {
+  if (!hs)
+    return new_leaf(name);
+
+  long id = name_id(name);
+  if (is_leaf(hs)) {
+    if (hs->name == name)
+      return hs;
+    return join(id, new_leaf(name), hs->prefix, hs);
+  }
+
+  if (!has_prefix(id, hs->prefix, hs->bit))
+    return join(id, new_leaf(name), hs->prefix, hs);
+  if (id & hs->bit)
+    return new_hideset(hs->left, hideset_add(hs->right, name), hs->prefix,
+                       hs->bit, NULL);
+  return new_hideset(hideset_add(hs->left, name), hs->right, hs->prefix,
+                     hs->bit, NULL);
+}
+
+static Hideset *hideset_union(Hideset *hs1, Hideset *hs2) {
+  if (!hs1 || hs1 == hs2)
+    return hs2;
+  if (!hs2)
+    return hs1;
+
+  HidesetOp *ent = find_hideset_op(HS_UNION, hs1, hs2);
+  if (ent->done)
+    return ent->result;
+
+  long p = hs1->prefix;
+  long m = hs1->bit;
+  long q = hs2->prefix;
+  long n = hs2->bit;
+  Hideset *hs;
+
+  if (is_leaf(hs1))
+    hs = hideset_add(hs2, hs1->name);
+  else if (is_leaf(hs2))
+    hs = hideset_add(hs1, hs2->name);
+  else if (m == n && p == q)
+    hs = new_hideset(hideset_union(hs1->left, hs2->left),
+                     hideset_union(hs1->right, hs2->right), p, m, NULL);
+  else if (m < n && has_prefix(q, p, m))
+    hs = (q & m)
+      ? new_hideset(hs1->left, hideset_union(hs1->right, hs2), p, m, NULL)
+      : new_hideset(hideset_union(hs1->left, hs2), hs1->right, p, m, NULL);
+  else if (n < m && has_prefix(p, q, n))
+    hs = (p & n)
+      ? new_hideset(hs2->left, hideset_union(hs1, hs2->right), q, n, NULL)
+      : new_hideset(hideset_union(hs1, hs2->left), hs2->right, q, n, NULL);
+  else
+    hs = join(p, hs1, q, hs2);
+
+  ent->result = hs;
+  ent->done = true;
+  return hs;
+}
+
+static Hideset *hideset_intersection(Hideset *hs1, Hideset *hs2) {
+  if (!hs1 || !hs2 || !(hs1->bloom & hs2->bloom))
+    return NULL;
+  if (hs1 == hs2)
+    return hs1;
+  if (is_leaf(hs1))
+    return hideset_contains(hs2, hs1->name) ? hs1 : NULL;
+  if (is_leaf(hs2))
+    return hideset_contains(hs1, hs2->name) ? hs2 : NULL;
+
+  HidesetOp *ent = find_hideset_op(HS_INTERSECTION, hs1, hs2);
+  if (ent->done)
+    return ent->result;
+
+  long p = hs1->prefix;
+  long m = hs1->bit;
+  long q = hs2->prefix;
+  long n = hs2->bit;
+  Hideset *hs = NULL;
+
+  if (m == n && p == q)
+    hs = new_branch(hideset_intersection(hs1->left, hs2->left),
+                    hideset_intersection(hs1->right, hs2->right), p, m);
+  else if (m < n && has_prefix(q, p, m))
+    hs = hideset_intersection((q & m) ? hs1->right : hs1->left, hs2);
+  else if (n < m && has_prefix(p, q, n))
+    hs = hideset_intersection(hs1, (p & n) ? hs2->right : hs2->left);
+
+  ent->result = hs;
+  ent->done = true;
+  return hs;
+}
+
+// Skips `n` tokens which are no longer needed, and returns the
+// token following them.
+static Token *drop_tokens(Token *tok, int n) {
+  for (; n > 0; n--) {
+    Token *t = next(tok);
+    free_token(tok);
+    tok = t;
+  }
+  return tok;
 }
 
 static Token *skip_cond_incl2(Token *tok) {
   while (tok->kind != TK_EOF) {
     if (is_hash(tok) &&
-        (equal(tok->next, "if") || equal(tok->next, "ifdef") ||
-         equal(tok->next, "ifndef"))) {
-      tok = skip_cond_incl2(tok->next->next);
+        (next(tok)->id == KW_IF || next(tok)->id == PP_IFDEF ||
+         next(tok)->id == PP_IFNDEF)) {
+      tok = skip_cond_incl2(drop_tokens(tok, 2));
       continue;
     }
-    if (is_hash(tok) && equal(tok->next, "endif"))
-      return tok->next->next;
-    tok = tok->next;
+    if (is_hash(tok) && next(tok)->id == PP_ENDIF)
+      return drop_tokens(tok, 2);
+    tok = drop_tokens(tok, 1);
   }
   return tok;
 }
@@ -214,17 +642,17 @@ static Token *skip_cond_incl2(Token *tok) {
 static Token *skip_cond_incl(Token *tok) {
   while (tok->kind != TK_EOF) {
     if (is_hash(tok) &&
-        (equal(tok->next, "if") || equal(tok->next, "ifdef") ||
-         equal(tok->next, "ifndef"))) {
-      tok = skip_cond_incl2(tok->next->next);
+        (next(tok)->id == KW_IF || next(tok)->id == PP_IFDEF ||
+         next(tok)->id == PP_IFNDEF)) {
+      tok = skip_cond_incl2(drop_tokens(tok, 2));
       continue;
     }
 
     if (is_hash(tok) &&
-        equal(tok->next, "else") || equal(tok->next, "elif") ||
-        equal(tok->next, "endif"))
+        next(tok)->id == KW_ELSE || next(tok)->id == PP_ELIF ||
+        next(tok)->id == PP_ENDIF)
       break;
-    tok = tok->next;
+    tok = drop_tokens(tok, 1);
   }
   return tok;
 }
@@ -238,7 +666,7 @@ static char *quote_string(char *str) {
     bufsize++;
   }
 
-  char *buf = malloc(bufsize);
+  char *buf = alloc_obj(AK_STRING, bufsize);
   char *p = buf;
   *p++ = '"';
   for (int i = 0; str[i]; i++) {
@@ -253,7 +681,7 @@ static char *quote_string(char *str) {
 
 static Token *new_str_token(char *str, Token *tmpl) {
   char *buf = quote_string(str);
-  return tokenize(tmpl->filename, tmpl->file_no, buf);
+  return tokenize(tmpl->file->name, tmpl->file->file_no, buf);
 }
 
 // Copy all tokens until the next newline, terminate them with
@@ -263,8 +691,10 @@ static Token *copy_line(Token **rest, Token *tok) {
   Token head = {};
   Token *cur = &head;
 
-  for (; !tok->at_bol; tok = tok->next)
+  while (!tok->at_bol) {
     cur = cur->next = copy_token(tok);
+    tok = drop_tokens(tok, 1);
+  }
 
   cur->next = new_eof(tok);
   *rest = tok;
@@ -272,9 +702,9 @@ static Token *copy_line(Token **rest, Token *tok) {
 }
 
 static Token *new_num_token(int val, Token *tmpl) {
-  char *buf = malloc(20);
+  char *buf = alloc_obj(AK_STRING, 20);
   sprintf(buf, "%d\n", val);
-  return tokenize(tmpl->filename, tmpl->file_no, buf);
+  return tokenize(tmpl->file->name, tmpl->file->file_no, buf);
 }
 
 static Token *read_const_expr(Token **rest, Token *tok) {
@@ -286,9 +716,9 @@ static Token *read_const_expr(Token **rest, Token *tok) {
   while (tok->kind != TK_EOF) {
     // "defined(foo)" or "defined foo" becomes "1" if macro "foo"
     // is defined. Otherwise "0".
-    if (equal(tok, "defined")) {
+    if (tok->id == PP_DEFINED) {
       Token *start = tok;
-      bool has_paren = consume(&tok, tok->next, "(");
+      bool has_paren = consume(&tok, tok->next, P_LPAREN);
 
       if (tok->kind != TK_IDENT)
         error_tok(start, "macro name must be an identifier");
@@ -296,7 +726,7 @@ static Token *read_const_expr(Token **rest, Token *tok) {
       tok = tok->next;
 
       if (has_paren)
-        tok = skip(tok, ")");
+        tok = skip(tok, P_RPAREN);
 
       cur = cur->next = new_num_token(m ? 1: 0, start);
       continue;
@@ -335,7 +765,7 @@ static long eval_const_expr(Token **rest, Token *tok) {
 }
 
 static CondIncl *push_cond_incl(Token *tok, bool included) {
-  CondIncl *ci = calloc(1, sizeof(CondIncl));
+  CondIncl *ci = alloc_obj(AK_MACRO, sizeof(CondIncl));
   ci->next = cond_incl;
   ci->ctx = IN_THEN;
   ci->tok = tok;
@@ -347,20 +777,16 @@ static CondIncl *push_cond_incl(Token *tok, bool included) {
 static Macro *find_macro(Token *tok) {
   if (tok->kind != TK_IDENT)
     return NULL;
-
-  for (Macro *m = macros; m; m = m->next)
-    if (strlen(m->name) == tok->len && !strncmp(m->name, tok->loc, tok->len))
-      return m->deleted ? NULL : m;
-  return NULL;
+  return hashmap_get2(&macros, tok->name, tok->len);
 }
 
 static Macro *add_macro(char *name, bool is_objlike, Token *body) {
-  Macro *m = calloc(1, sizeof(Macro));
-  m->next = macros;
+  Macro *m = alloc_obj(AK_MACRO, sizeof(Macro));
   m->name = name;
   m->is_objlike = is_objlike;
   m->body = body;
-  macros = m;
+  m->hideset = new_leaf(name);
+  hashmap_put(&macros, name, m);
   return m;
 }
 
@@ -368,30 +794,33 @@ static MacroParam *read_macro_params(Token **rest, Token *tok) {
   MacroParam head = {};
   MacroParam *cur = &head;
 
-  while (!equal(tok, ")")) {
-    if (cur != &head)
-      tok = skip(tok, ",");
+  while (tok->id != P_RPAREN) {
+    // skip() doesn't read more tokens of a lazily tokenized file.
+    if (cur != &head) {
+      skip(tok, P_COMMA);
+      tok = next(tok);
+    }
 
     if (tok->kind != TK_IDENT)
       error_tok(tok, "expected an identifier");
-    MacroParam *m = calloc(1, sizeof(MacroParam));
-    m->name = strndup(tok->loc, tok->len);
+    MacroParam *m = alloc_obj(AK_MACRO, sizeof(MacroParam));
+    m->name = tok->name;
     cur = cur->next = m;
-    tok = tok->next;
+    tok = next(tok);
   }
-  *rest = tok->next;
+  *rest = next(tok);
   return head.next;
 }
 
 static void read_macro_definition(Token **rest, Token *tok) {
   if (tok->kind != TK_IDENT)
     error_tok(tok, "macro name must be an identifier");
-  char *name = strndup(tok->loc, tok->len);
-  tok = tok->next;
+  char *name = tok->name;
+  tok = next(tok);
 
-  if (!tok->has_space && equal(tok, "(")) {
+  if (!tok->has_space && tok->id == P_LPAREN) {
     // Function-like macro
-    MacroParam *params = read_macro_params(&tok, tok->next);
+    MacroParam *params = read_macro_params(&tok, next(tok));
     Macro *m = add_macro(name, false, copy_line(rest, tok));
     m->params = params;
   } else {
@@ -401,79 +830,78 @@ static void read_macro_definition(Token **rest, Token *tok) {
 }
 
 static MacroArg *read_macro_arg_one(Token **rest, Token *tok) {
-  Token head = {};
-  Token *cur = &head;
+  MacroArg *arg = alloc_obj(AK_MACRO, sizeof(MacroArg));
+  arg->tok = tok;
   int level = 0;
 
-  while (level > 0 || !equal(tok, ",") && !equal(tok, ")")) {
+  while (level > 0 || tok->id != P_COMMA && tok->id != P_RPAREN) {
     if (tok->kind == TK_EOF)
       error_tok(tok, "premature end of input");
 
-    if (equal(tok, "("))
+    if (tok->id == P_LPAREN)
       level++;
 
-    if (equal(tok, ")"))
+    if (tok->id == P_RPAREN)
       level--;
 
-    cur = cur->next = copy_token(tok);
-    tok = tok->next;
+    tok = next(tok);
   }
 
-  MacroArg *arg = calloc(1, sizeof(MacroArg));
-  arg->tok = head.next;
+  arg->end = tok;
   *rest = tok;
   return arg;
 }
 
 static MacroArg *read_macro_args(Token **rest, Token *tok, MacroParam *params) {
   Token *start = tok;
-  tok = tok->next->next;
+  tok = next(next(tok));
 
   MacroArg head = {};
   MacroArg *cur = &head;
 
   MacroParam *pp = params;
   for (; pp; pp = pp->next) {
-    if (cur != &head)
-      tok = skip(tok, ",");
+    if (cur != &head) {
+      skip(tok, P_COMMA);
+      tok = next(tok);
+    }
     cur = cur->next = read_macro_arg_one(&tok, tok);
     cur->name = pp->name;
   }
 
   if (pp)
     error_tok(start, "too many arguments");
-  skip(tok, ")");
+  skip(tok, P_RPAREN);
   *rest = tok;
   return head.next;
 }
 
-// Macro arguments can be empty. For example, the second argument
-// of foo(a,,c) is the empty list of tokens. The following special
-// pointer represents the empty list.
-static Token *EMPTY = (Token *)-1;
-
-static Token *find_arg(MacroArg *args, Token *tok) {
+// Returns the argument if `tok` is a macro parameter. Macro arguments
+// can be empty. For example, the second argument of foo(a,,c) is the
+// empty list of tokens, whose `tok` and `end` are the same.
+static MacroArg *find_arg(MacroArg *args, Token *tok) {
   for (MacroArg *ap = args; ap; ap = ap->next)
-    if (tok->len == strlen(ap->name) && !strncmp(tok->loc, ap->name, tok->len))
-      return ap->tok ? ap->tok : EMPTY;
+    if (tok->name == ap->name)
+      return ap;
   return NULL;
 }
 
-// Concatenates all tokens in `tok` and returns a new string.
-static char *join_tokens(Token *tok) {
+// Concatenates all tokens in `tok` up to `end` and returns a new
+// string.
+static char *join_tokens(Token *tok, Token *end) {
   // Compute the length of the resulting token.
   int len = 1;
-  for (Token *t = tok; t; t = t->next) {
+  for (Token *t = tok; t != end; t = next(t)) {
     if (t != tok && t->has_space)
       len++;
     len += t->len;
   }
 
-  char *buf = malloc(len);
+  char *buf = alloc_obj(AK_STRING, len);
 
   // Copy token texts.
   int pos = 0;
-  for (Token *t = tok; t; t = t->next) {
+  for (Token *t = tok; t != end; t = next(t)) {
     if (t != tok && t->has_space)
       buf[pos++] = ' ';
     strncpy(buf + pos, t->loc, t->len);
@@ -485,97 +913,191 @@ static char *join_tokens(Token *tok) {
 
 // Concatenates all tokens in `arg` and returns a new string token.
 // This function is used for the stringizing operator (#).
-static Token *stringize(Token *hash, Token *arg) {
+static Token *stringize(Token *hash, MacroArg *arg) {
   // Create a new string token. We need to set some value to its
   // source location for error reporting function, so we use a macro
   // name token as a template
-  char *s = join_tokens(arg);
+  char *s = join_tokens(arg->tok, arg->end);
   return new_str_token(s, hash);
 }
 
 // Concatenate two tokens to create a new token.
 static Token *paste(Token *lhs, Token *rhs) {
   // Paste the two tokens.
-  char *buf = malloc(lhs->len + rhs->len + 1);
+  char *buf = alloc_obj(AK_STRING, lhs->len + rhs->len + 1);
   sprintf(buf, "%.*s%.*s", lhs->len, lhs->loc, rhs->len, rhs->loc);
 
   // Tokenize the resulting string.
-  Token *tok = tokenize(lhs->filename, lhs->file_no, buf);
+  Token *tok = tokenize(lhs->file->name, lhs->file->file_no, buf);
   if(tok->next->kind != TK_EOF)
     error_tok(lhs, "pasting forms '%s', an invalid token", buf);
   return tok;
 }
 
-// Replace func-like macro parameters with given arguments.
-static Token *subst(Token *tok, MacroArg *args) {
-  Token head = {};
-  Token *cur = &head;
+// Starts reading the tokens of an argument.
+static void start_arg(Expansion *e, Token *tok, Token *end) {
+  if (tok != end) {
+    e->arg = tok;
+    e->arg_end = end;
+  }
+}
 
-  while (tok->kind != TK_EOF) {
-    Token *arg = find_arg(args, tok);
+// Returns the next token of a macro body with func-like macro
+// parameters replaced with given arguments, or NULL at the end.
+// Unless `*is_new` is set, the token is one of the macro body or
+// an argument, which must not be modified.
+static Token *read_subst(Expansion *e, bool *is_new) {
+  *is_new = false;
+
+  for (;;) {
+    if (e->arg) {
+      Token *tok = e->arg;
+      e->arg = (next(tok) == e->arg_end) ? NULL : next(tok);
+      return tok;
+    }
+
+    Token *tok = e->body;
+    if (tok->kind == TK_EOF)
+      return NULL;
+    e->body = tok->next;
 
     // If the current token is a mcro parameter, replaces
     // it with actuals.
+    MacroArg *arg = find_arg(e->args, tok);
     if (arg) {
-      tok = tok->next;
-
       // x##y becomes y if x is the empty argument list.
-      if (arg == EMPTY && equal(tok, "##")) {
-        tok = tok->next;
-        continue;
+      if (arg->tok == arg->end && e->body->id == P_HASHHASH)
+        e->body = e->body->next;
+      start_arg(e, arg->tok, arg->end);
+      continue;
+    }
+
+    // "#" followed by a parameter is replaced with stringized actuals.
+    if (tok->id == P_HASH) {
+      arg = find_arg(e->args, tok->next);
+      if (arg) {
+        e->body = tok->next->next;
+        *is_new = true;
+        return stringize(tok, arg);
       }
+    }
+    return tok;
+  }
+}
 
-      if (arg != EMPTY)
-        for (Token *t = arg; t; t = t->next)
-          cur = cur->next = copy_token(t);
+// Produces the next token of a macro expansion, or returns NULL at
+// the end.
+static Token *expand_next(Expansion *e) {
+  bool is_new;
+  Token *tok = read_subst(e, &is_new);
+  if (!tok)
+    return NULL;
+
+  // Replace x##y with xy. The left-hand side is the token we have
+  // just read, which must be a whole argument or its last token.
+  while (!e->macro->is_objlike && !e->arg && e->body->id == P_HASHHASH) {
+    Token *rhs = e->body->next;
+    if (rhs->kind == TK_EOF)
+      error_tok(e->body, "'##' cannot appear at the end of a macro");
+    MacroArg *arg = find_arg(e->args, rhs);
+    e->body = rhs->next;
+
+    if (!arg) {
+      tok = paste(tok, rhs);
+      is_new = true;
       continue;
     }
 
-    // Replace x##y with xy. LHS has already been macro-expanded and
-    // added to `cur`.
-    if (equal(tok, "##")) {
-      tok = tok->next;
-      Token *rhs = find_arg(args, tok);
+    // x##y becomes x if y is the empty argument list.
+    if (arg->tok == arg->end)
+      continue;
 
-      if (!rhs) {
-        *cur = *paste(cur, tok);
-        tok = tok->next;
-        continue;
-      }
+    tok = paste(tok, arg->tok);
+    is_new = true;
+    start_arg(e, next(arg->tok), arg->end);
+  }
 
-      tok = tok->next;
+  if (!is_new)
+    tok = copy_token(tok);
+  tok->next = NULL;
 
-      // x##y becomes x if y is the empty argument list.
-      if (rhs == EMPTY)
-        continue;
+  if (tok->hideset != e->last_hs) {
+    e->last_hs = tok->hideset;
+    e->result_hs = hideset_union(tok->hideset, e->hideset);
+  }
+  tok->hideset = e->result_hs;
+  return tok;
+}
+
+// Starts expanding a macro and returns the first resulting token.
+// The last resulting token is followed by `cont`.
+static Token *start_expansion(Macro *m, MacroArg *args, Hideset *hs,
+                              Token *cont) {
+  Expansion *e = free_expansions;
+  if (e)
+    free_expansions = e->next;
+  else
+    e = alloc_obj(AK_MACRO, sizeof(Expansion));
+
+  memset(e, 0, sizeof(Expansion));
+  e->macro = m;
+  e->args = args;
+  e->hideset = hs;
+  e->body = m->body;
+  e->cont = cont;
+  e->result_hs = hs;
+
+  e->last = expand_next(e);
+  if (!e->last) {
+    e->next = free_expansions;
+    free_expansions = e;
+    return cont;
+  }
+  e->next = expansions;
+  expansions = e;
+  return e->last;
+}
+
+// Returns the token following `tok`. If `tok` is the last token
+// produced so far by a macro expansion, the next one is produced.
+// If it's the last one read so far from a file, more are read.
+// If it's the last one of an included file's shared tokens, the
+// token following the include is returned.
+static Token *next(Token *tok) {
+  Token *t = tok->next;
+  if (t && (t->kind != TK_EOF || !t->is_shared))
+    return t;
+
+  if (t) {
+    for (FileInfo *fi = includes; fi; fi = fi->next_include)
+      if (fi->eof == t)
+        return fi->cont;
+    return t;
+  }
 
-      *cur = *paste(cur, rhs);
-      for (Token *t = rhs->next; t; t = t->next)
-        cur = cur->next = copy_token(t);
+  for (Expansion **ep = &expansions; *ep; ep = &(*ep)->next) {
+    Expansion *e = *ep;
+    if (e->last != tok)
       continue;
-    }
 
-    // "#" followed by a parameter is replaced with stringized actuals.
-    if (equal(tok, "#")) {
-      Token *arg = find_arg(args, tok->next);
-      if (arg) {
-        cur = cur->next = stringize(tok, arg);
-        tok = tok->next->next;
-        continue;
-      }
+    tok->next = expand_next(e);
+    if (tok->next) {
+      e->last = tok->next;
+      return tok->next;
     }
 
-    // Handle non-macro token.
-    cur = cur->next = copy_token(tok);
-    tok = tok->next;
-    continue;
+    // This expansion is done.
+    tok->next = e->cont;
+    *ep = e->next;
+    e->next = free_expansions;
+    free_expansions = e;
+    return tok->next;
   }
-
-  return head.next;
+  return next_token(tok);
 }
 
 static bool expand_macro(Token **rest, Token *tok) {
-  if (hideset_contains(tok->hideset, tok->loc, tok->len))
+  if (hideset_contains(tok->hideset, tok->name))
     return false;
 
   Macro *m = find_macro(tok);
@@ -584,15 +1106,14 @@ static bool expand_macro(Token **rest, Token *tok) {
 
   // Object-like macro application
   if (m->is_objlike) {
-    Hideset *hs = hideset_union(tok->hideset, new_hideset(m->name));
-    Token *body = add_hideset(m->body, hs);
-    *rest = append(body, tok->next);
+    Hideset *hs = hideset_union(tok->hideset, m->hideset);
+    *rest = start_expansion(m, NULL, hs, next(tok));
     return true;
   }
 
   // If a funclike macro token is not followed by an argument list,
   // treat it as a normal identifier.
-  if (!equal(tok->next, "("))
+  if (next(tok)->id != P_LPAREN)
     return false;
 
   // Function-like macro application
@@ -607,11 +1128,9 @@ static bool expand_macro(Token **rest, Token *tok) {
   // as explained in the Dave Prossor's algorithm
   // (https://github.com/rui314/8cc/wiki/cpp.algo.pdf)
   Hideset *hs = hideset_intersection(macro_token->hideset, rparen->hideset);
-  hs = hideset_union(hs, new_hideset(m->name));
+  hs = hideset_union(hs, m->hideset);
 
-  Token *body = subst(m->body, args);
-  body = add_hideset(body, hs);
-  *rest = append(body, tok->next);
+  *rest = start_expansion(m, args, hs, next(rparen));
   return true;
 }
 
@@ -622,106 +1141,167 @@ static Token *preprocess(Token *tok) {
   Token *cur = &head;
 
   while (tok->kind != TK_EOF) {
+    // Includes end where the tokens following them begin.
+    while (includes && tok == includes->cont) {
+      includes->cont = NULL;
+      includes = includes->next_include;
+    }
+
     // If it is a macro, expand it.
     if (expand_macro(&tok, tok))
       continue;
 
-    // Pass through if it is not a "#".
+    // Pass through if it is not a "#". Shared tokens are copied.
     if (!is_hash(tok)) {
-      cur = cur->next = tok;
-      tok = tok->next;
+      cur = cur->next = tok->is_shared ? copy_token(tok) : tok;
+      tok = next(tok);
       continue;
     }
 
     Token *start = tok;
-    tok = tok->next;
-
-    if (equal(tok, "include")) {
-      tok = tok->next;
+    tok = next(tok);
+
+    if (tok->id == PP_INCLUDE) {
+      Token *name = next(tok);
+      if (name->kind != TK_STR)
+        error_tok(name, "expected a filename");
+
+      char *path = alloc_str(name->lit->contents, name->lit->cont_len);
+      Token *rest = skip_line(next(name));
+      free_token(start);
+      free_token(tok);
+
+      // A file with "#pragma once" is never included twice. A file
+      // wrapped in an include guard yields no tokens once the guard
+      // macro is defined. Either way, we don't even read it.
+      FileInfo *fi = get_file_info(path);
+      if (fi && (fi->pragma_once ||
+                 (fi->guard && hashmap_get(&macros, fi->guard)))) {
+        nr_skipped_includes++;
+        free_token(name);
+        tok = rest;
+        continue;
+      }
 
-      if (tok->kind != TK_STR)
-        error_tok(tok, "expected a filename");
+      Token *tok2 = tokenize_file(path, rest);
+      if (!tok2)
+        error_tok(name, "%s", strerror(errno));
+      free_token(name);
 
-      char *path = tok->contents;
-      char *input = read_file_string(path);
-      if(!input)
-        error_tok(tok, "%s", strerror(errno));
-      tok = skip_line(tok->next);
-      tok = append(tokenize(path, file_no, input), tok);
+      if (fi && is_hash(tok2) && next(tok2)->id == PP_IFNDEF) {
+        guard_start = tok2;
+        guard_file = fi;
+        guard_end = rest;
+      }
+      tok = tok2;
       continue;
     }
 
-    if (equal(tok, "define")) {
-      read_macro_definition(&tok, tok->next);
+    if (tok->id == PP_DEFINE) {
+      read_macro_definition(&tok, drop_tokens(start, 2));
       continue;
     }
 
-    if (equal(tok, "undef")) {
-      tok = tok->next;
+    if (tok->id == PP_UNDEF) {
+      tok = drop_tokens(start, 2);
       if (tok->kind != TK_IDENT)
         error_tok(tok, "macro name must be an identifier");
-      char *name = strndup(tok->loc, tok->len);
-      tok = skip_line(tok->next);
-
-      Macro *m = add_macro(name, true, NULL);
-      m->deleted = true;
+      char *name = tok->name;
+      tok = skip_line(drop_tokens(tok, 1));
+      hashmap_delete(&macros, name);
       continue;
     }
 
-    if (equal(tok, "if")) {
-      long val = eval_const_expr(&tok, tok->next);
+    if (tok->id == KW_IF) {
+      long val = eval_const_expr(&tok, next(tok));
       push_cond_incl(start, val);
       if (!val)
         tok = skip_cond_incl(tok);
       continue;
     }
 
-    if (equal(tok, "ifdef")) {
-      bool defined = find_macro(tok->next);
+    if (tok->id == PP_IFDEF) {
+      bool defined = find_macro(next(tok));
       push_cond_incl(tok, defined);
-      tok = skip_line(tok->next->next);
+      tok = skip_line(next(next(tok)));
       if (!defined)
         tok = skip_cond_incl(tok);
       continue;
     }
 
-    if (equal(tok, "ifndef")) {
-      bool defined = find_macro(tok->next);
-      push_cond_incl(tok, !defined);
-      tok = skip_line(tok->next->next);
+    if (tok->id == PP_IFNDEF) {
+      Token *name = next(tok);
+      bool defined = find_macro(name);
+      CondIncl *ci = push_cond_incl(tok, !defined);
+      if (start == guard_start && name->kind == TK_IDENT) {
+        ci->guard = name->name;
+        ci->guard_file = guard_file;
+        ci->guard_end = guard_end;
+      }
+      guard_start = NULL;
+      tok = skip_line(next(next(tok)));
       if (defined)
         tok = skip_cond_incl(tok);
       continue;
     }
 
-    if (equal(tok, "else")) {
+    if (tok->id == KW_ELSE) {
       if (!cond_incl || cond_incl->ctx == IN_ELSE)
         error_tok(start, "stray #else");
       cond_incl->ctx = IN_ELSE;
-      tok = skip_line(tok->next);
+      tok = skip_line(drop_tokens(start, 2));
 
       if (cond_incl->included)
         tok = skip_cond_incl(tok);
       continue;
     }
 
-    if (equal(tok, "elif")) {
+    if (tok->id == PP_ELIF) {
       if (!cond_incl || cond_incl->ctx == IN_ELSE)
         error_tok(start, "stray #elif");
       cond_incl->ctx = IN_ELIF;
 
-      if (!cond_incl->included && eval_const_expr(&tok, tok->next))
+      if (!cond_incl->included && eval_const_expr(&tok, next(tok)))
         cond_incl->included = true;
       else
         tok = skip_cond_incl(tok);
       continue;
     }
 
-    if (equal(tok, "endif")) {
+    if (tok->id == PP_ENDIF) {
       if (!cond_incl)
         error_tok(start, "stray #endif");
-      cond_incl = cond_incl->next;
-      tok = skip_line(tok->next);
+      CondIncl *ci = cond_incl;
+      cond_incl = ci->next;
+      bool same_file = (start->file == ci->tok->file);
+      tok = skip_line(drop_tokens(start, 2));
+
+      if (ci->guard && ci->ctx == IN_THEN && same_file &&
+          tok == ci->guard_end) {
+        if (!ci->guard_file->guard)
+          nr_include_guards++;
+        ci->guard_file->guard = ci->guard;
+      }
+      continue;
+    }
+
+    if (tok->id == PP_PRAGMA) {
+      File *file = start->file;
+      tok = drop_tokens(start, 2);
+
+      if (!tok->at_bol && tok->id == PP_ONCE) {
+        FileInfo *fi = get_file_info(file->name);
+        if (fi && !fi->pragma_once) {
+          fi->pragma_once = true;
+          nr_pragma_once++;
+        }
+        tok = skip_line(drop_tokens(tok, 1));
+        continue;
+      }
+
+      // Other pragmas are ignored.
+      while (tok->kind != TK_EOF && !tok->at_bol)
+        tok = drop_tokens(tok, 1);
       continue;
     }
 
@@ -736,13 +1316,131 @@ static Token *preprocess(Token *tok) {
   return head.next;
 }
 
+// Saves the files read so far to a precompiled header, which goes
+// out of date once any of them changes.
+void save_file_ids(void) {
+  long n = 0;
+  for (int i = 0; i < file_paths.capacity; i++)
+    if (file_paths.buckets[i].val)
+      n++;
+  pch_put_long(n);
+
+  for (int i = 0; i < file_paths.capacity; i++) {
+    FileInfo *fi = file_paths.buckets[i].val;
+    if (!fi)
+      continue;
+
+    // A relative path would be resolved against a different directory
+    // by a compiler running elsewhere.
+    char *path = file_paths.buckets[i].key;
+    char *real = realpath(path, NULL);
+    if (real) {
+      path = alloc_str(real, strlen(real));
+      free(real);
+    }
+    pch_put_str(path);
+
+    pch_put_long(fi->id.dev);
+    pch_put_long(fi->id.ino);
+    pch_put_long(fi->id.size);
+    pch_put_long(fi->id.mtime_sec);
+    pch_put_long(fi->id.mtime_nsec);
+  }
+}
+
+// Reads files saved by save_file_ids() and returns one that has
+// changed since, or NULL if none has.
+char *load_file_ids(void) {
+  char *changed = NULL;
+  for (long n = pch_get_long(); n > 0; n--) {
+    char *path = pch_get_str();
+    FileId id = {};
+    id.dev = pch_get_long();
+    id.ino = pch_get_long();
+    id.size = pch_get_long();
+    id.mtime_sec = pch_get_long();
+    id.mtime_nsec = pch_get_long();
+
+    FileId cur;
+    if (!changed && (!get_file_id(path, &cur) ||
+                     memcmp(&id, &cur, sizeof(FileId))))
+      changed = path;
+  }
+  return changed;
+}
+
+// Saves macros to a precompiled header.
+void save_macros(void) {
+  long n = 0;
+  for (int i = 0; i < macros.capacity; i++)
+    if (macros.buckets[i].val)
+      n++;
+  pch_put_long(n);
+
+  for (int i = 0; i < macros.capacity; i++) {
+    Macro *m = macros.buckets[i].val;
+    if (!m)
+      continue;
+    pch_put_str(m->name);
+    pch_put_long(m->is_objlike);
+    pch_put_tokens(m->body);
+
+    long nparams = 0;
+    for (MacroParam *mp = m->params; mp; mp = mp->next)
+      nparams++;
+    pch_put_long(nparams);
+    for (MacroParam *mp = m->params; mp; mp = mp->next)
+      pch_put_str(mp->name);
+  }
+}
+
+// Restores macros from a precompiled header.
+void load_macros(void) {
+  for (long n = pch_get_long(); n > 0; n--) {
+    char *name = pch_get_name();
+    bool is_objlike = pch_get_long();
+    Macro *m = add_macro(name, is_objlike, pch_get_tokens());
+
+    MacroParam head = {};
+    MacroParam *cur = &head;
+    for (long i = pch_get_long(); i > 0; i--) {
+      cur = cur->next = alloc_obj(AK_MACRO, sizeof(MacroParam));
+      cur->name = pch_get_name();
+    }
+    m->params = head.next;
+  }
+}
+
+// Prints out statistics of the preprocessor to stderr.
+void print_pp_report(char *input) {
+  int n = 0;
+  for (int i = 0; i < macros.capacity; i++)
+    if (macros.buckets[i].val)
+      n++;
+
+  long lookups = macros.lookups;
+  long avg = lookups ? macros.probes * 100 / lookups : 0;
+  fprintf(stderr, "preprocessor report for %s\n", input);
+  fprintf(stderr, "macros: %d defined, %d buckets\n", n, macros.capacity);
+  fprintf(stderr, "macro lookups: %ld, probes: %ld (%ld.%02ld per lookup)\n",
+          lookups, macros.probes, avg / 100, avg % 100);
+  fprintf(stderr, "include guards: %d, #pragma once: %d, ",
+          nr_include_guards, nr_pragma_once);
+  fprintf(stderr, "includes skipped: %ld\n", nr_skipped_includes);
+  fprintf(stderr, "token cache: %d files, %ld hits\n",
+          nr_token_cache_files, nr_token_cache_hits);
+  fprintf(stderr, "hidesets: %ld, set operations: %ld (%ld memoized)\n",
+          nr_hidesets, nr_hideset_ops, nr_hideset_op_hits);
+}
+
 // Entry point function of the preprocessor.
 Token *read_file(char *path) {
-  char *input = read_file_string(path);
-  if (!input)
+  Token *tok = tokenize_file(path, NULL);
+  if (!tok)
     error("cannot open %s: %s", path, strerror(errno));
-  Token *tok = tokenize(path, file_no, input);
+  timer_start(PH_PREPROCESS);
   tok = preprocess(tok);
+  timer_stop();
   if (cond_incl)
     error_tok(cond_incl->tok, "unterminated conditional directive");
   convert_keywords(tok);
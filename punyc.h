@@ -2,12 +2,26 @@
 #include <assert.h>
 #include <ctype.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <poll.h>
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <strings.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <dirent.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <utime.h>
+#include <time.h>
+#include <unistd.h>
 
 typedef struct Type Type;
 typedef struct Member Member;
@@ -26,48 +40,139 @@ typedef enum {
   TK_EOF,      // End-of-file markers
 } TokenKind;
 
+// Keywords, preprocessor directive names and punctuators are given
+// an ID by the tokenizer, so that they can be compared as integers.
+// The order must match `token_names` in tokenize.c.
+typedef enum {
+  ID_NONE,
+
+  // Keywords
+  KW_RETURN, KW_IF, KW_ELSE, KW_FOR, KW_WHILE, KW_INT, KW_SIZEOF,
+  KW_CHAR, KW_STRUCT, KW_UNION, KW_SHORT, KW_LONG, KW_VOID,
+  KW_TYPEDEF, KW_BOOL, KW_ENUM, KW_STATIC, KW_BREAK, KW_CONTINUE,
+  KW_GOTO, KW_SWITCH, KW_CASE, KW_DEFAULT, KW_EXTERN, KW_ALIGNOF,
+  KW_ALIGNAS, KW_DO, KW_SIGNED, KW_UNSIGNED, KW_CONST, KW_VOLATILE,
+
+  // Preprocessor directive names other than keywords
+  PP_INCLUDE, PP_DEFINE, PP_UNDEF, PP_IFDEF, PP_IFNDEF, PP_ELIF,
+  PP_ENDIF, PP_PRAGMA, PP_DEFINED, PP_ONCE,
+
+  // Punctuators, longest first
+  P_ELLIPSIS, P_SHL_ASSIGN, P_SHR_ASSIGN,
+  P_EQ, P_NE, P_LE, P_GE, P_ARROW, P_ADD_ASSIGN, P_SUB_ASSIGN,
+  P_MUL_ASSIGN, P_DIV_ASSIGN, P_INC, P_DEC, P_MOD_ASSIGN,
+  P_AND_ASSIGN, P_OR_ASSIGN, P_XOR_ASSIGN, P_LOGAND, P_LOGOR, P_SHL,
+  P_SHR, P_HASHHASH,
+  P_LPAREN, P_RPAREN, P_LBRACE, P_RBRACE, P_LBRACKET, P_RBRACKET,
+  P_SEMICOLON, P_COMMA, P_DOT, P_ASSIGN, P_LT, P_GT, P_PLUS, P_MINUS,
+  P_STAR, P_SLASH, P_PERCENT, P_AMP, P_PIPE, P_CARET, P_TILDE, P_NOT,
+  P_QUESTION, P_COLON, P_HASH,
+
+  NR_TOKEN_IDS,
+} TokenId;
+
+// Set of macro names, represented as a Patricia tree keyed by
+// name_id(). There is only one Hideset object for each set, so equal
+// sets are the same pointer. A Hideset must not be modified.
 typedef struct Hideset Hideset;
 struct Hideset {
-  Hideset *next;
-  char *name;
+  Hideset *left;       // NULL if leaf
+  Hideset *right;
+  long prefix;         // Bits below `bit` shared by all names, or leaf's ID
+  long bit;            // The bit that tells which child has a name
+  char *name;          // If leaf, the name
+  unsigned long bloom; // One bit for each name, for quick rejection
 };
 
+// Source file of tokens. Tokens read from the same input share one.
+typedef struct {
+  char *name;     // Input filename
+  char *contents; // Entire input string
+  int file_no;    // File number for .loc directive
+
+  // Offsets of the beginnings of lines, recorded as the file is
+  // tokenized
+  int *lines;
+  int nr_lines;
+  int lines_cap;
+} File;
+
+// Payload of a literal token
+typedef struct {
+  long val;       // If TK_NUM, its value
+  Type *ty;       // If TK_NUM, its type
+  char *contents; // If TK_STR, its contents, not null-terminated
+  int cont_len;   // If TK_STR, its length excluding terminating '\0'
+} Literal;
+
 // Token type
+//
+// Fields the preprocessor and the parser look at for every token
+// come first. Those used only for some tokens or only for error
+// messages and debug info are kept out of line.
 typedef struct Token Token;
 struct Token {
   TokenKind kind;   // Token kind
+  TokenId id;       // Keyword or punctuator ID, or ID_NONE
   Token *next;      // Next token
-  long val;         // If kind is TK_NUM, its value
-  Type *ty;         // Used if TK_NUM
   char *loc;        // Token location
   int len;          // Token length
-
-  char *contents;   // String literal contents including terminating '\0'
-  char cont_len;    // string literal length
-
-  char *filename;   // Input filename
-  char *input;      // Entire input string
   int lineno;       // Line number
-  int file_no;      // File number for .loc directive
+  char *name;       // If identifier or keyword, its interned spelling
+  Hideset *hideset; // For macro expension
   bool at_bol;      // True if this token is at beginning of line
   bool has_space;   // True if this token follows a space character
-  Hideset *hideset; // For macro expension
+  bool is_raw;      // True if this token is read from a file
+  bool is_shared;   // True if this token is in a file's cached tokens
+
+  File *file;       // Source file
+  Literal *lit;     // If TK_NUM or TK_STR, its value
 };
 
+extern bool fast_lexer;
+
 void error(char *fmt, ...);
 void error_tok(Token *tok, char *fmt, ...);
 void warn_tok(Token *tok, char *fmt, ...);
-bool equal(Token *tok, char *s);
-Token *skip(Token *tok, char *s);
-bool consume(Token **rest, Token *tok, char *str);
+Token *skip(Token *tok, TokenId id);
+bool consume(Token **rest, Token *tok, TokenId id);
+char *intern(char *s, int len);
+long name_id(char *name);
+File *new_file(char *name, int file_no, char *contents);
+int get_column(Token *tok);
 void convert_keywords(Token *tok);
+Token *next_token(Token *tok);
+void free_token(Token *tok);
+Token *tokenize_lazy(char *filename, int file_no, char *p, Token *cont);
+Token *tokenize_cached(Token *src, char *filename, int file_no,
+                       Token *cont);
 Token *tokenize(char *filename, int file_no, char *p);
 
 //
 // preprocess.c
 //
 
+extern bool pp_report;
+
+// Identifies a file and its version.
+typedef struct {
+  unsigned long dev;
+  unsigned long ino;
+  long size;
+  long mtime_sec;
+  long mtime_nsec;
+} FileId;
+
+bool get_file_id(char *path, FileId *id);
+char *read_file_string(char *path, long *mapping);
+void free_file_string(char *buf, long mapping);
+int add_file(char *path);
+void save_file_ids(void);
+char *load_file_ids(void);
+void save_macros(void);
+void load_macros(void);
 Token *read_file(char *path);
+void print_pp_report(char *input);
 
 //
 // parse.c
@@ -198,6 +303,9 @@ struct GvarInitializer {
   int sz;
   long val;
 
+  // Byte string of `sz` bytes
+  char *bytes;
+
   // Reference to another global variable
   char *label;
   long addend;
@@ -214,6 +322,7 @@ struct Function {
   Node *node;
   Var *locals;
   int stack_size;
+  long nr_nodes; // The number of AST nodes, as an estimate of work
 };
 
 typedef struct {
@@ -223,6 +332,8 @@ typedef struct {
 
 Node *new_cast(Node *expr, Type *ty);
 long const_expr(Token **rest, Token *tok);
+void save_scopes(void);
+void load_scopes(void);
 Program *parse(Token *tok);
 
 //
@@ -310,10 +421,170 @@ void add_type(Node *node);
 // codegen.c
 //
 
+extern int codegen_jobs;
+
 void codegen(Program *prog);
 
+//
+// emit.c
+//
+
+void open_output(char *path);
+void flush_output(void);
+void write_output(char *p, long len);
+void capture_output(void);
+char *take_output(void);
+void emitf(char *fmt, ...);
+void println(char *fmt, ...);
+long output_size(void);
+char *output_since(long pos);
+
+//
+// assemble.c
+//
+
+void assemble(char *input, char *path);
+
+//
+// timer.c
+//
+
+typedef enum {
+  PH_READ,       // read_file_string
+  PH_TOKENIZE,   // tokenize
+  PH_PREPROCESS, // preprocess
+  PH_KEYWORDS,   // convert_keywords
+  PH_PARSE,      // parse
+  PH_LAYOUT,     // stack offset assignment
+  PH_EMIT_DATA,  // emit_data
+  PH_EMIT_TEXT,  // emit_text
+  PH_ASSEMBLE,   // assemble
+  NR_PHASES,
+} Phase;
+
+extern bool time_report;
+extern bool time_report_json;
+
+void timer_start(Phase ph);
+void timer_stop(void);
+void timer_count(Phase ph, long n);
+void timer_count_lines(long n);
+void reset_timer(void);
+Phase current_phase(void);
+char *phase_name(Phase ph);
+void print_time_report(char *input);
+
+//
+// alloc.c
+//
+
+typedef enum {
+  AK_TOKEN,       // Token
+  AK_HIDESET,     // Hideset
+  AK_MACRO,       // Macro, MacroParam, MacroArg and CondIncl
+  AK_NODE,        // Node
+  AK_TYPE,        // Type
+  AK_MEMBER,      // Member
+  AK_VAR,         // Var
+  AK_VAR_SCOPE,   // VarScope
+  AK_TAG_SCOPE,   // TagScope
+  AK_FUNCTION,    // Function and Program
+  AK_INITIALIZER, // Initializer
+  AK_GVAR_INIT,   // GvarInitializer
+  AK_STRING,      // Names, labels and string literals
+  AK_FILE,        // Source file contents
+  NR_ALLOC_KINDS,
+} AllocKind;
+
+typedef struct Arena Arena;
+
+extern bool mem_report;
+
+void reset_alloc_stats(void);
+void count_alloc(AllocKind kind, long size);
+void *alloc_obj(AllocKind kind, long size);
+char *alloc_str(char *s, long len);
+void free_arena(void);
+Arena *enter_arena(void);
+void leave_arena(Arena *arena);
+void release_arena(Arena *arena);
+void print_mem_report(char *input);
+
+//
+// server.c
+//
+
+Token *find_cached_file(char *path);
+void note_input_file(char *path);
+char *read_all(int fd);
+void run_server(char *path, int *argc, char ***argv);
+int run_client(char *path, int argc, char **argv);
+
+//
+// pch.c
+//
+
+void pch_put_long(long val);
+void pch_put_str(char *s);
+void pch_put_token(Token *tok);
+void pch_put_tokens(Token *tok);
+void pch_put_type(Type *ty);
+void pch_put_var(Var *var);
+void write_pch(char *path);
+
+long pch_get_long(void);
+char *pch_get_str(void);
+char *pch_get_name(void);
+Token *pch_get_token(void);
+Token *pch_get_tokens(void);
+Type *pch_get_type(void);
+Var *pch_get_var(void);
+void read_pch(char *path);
+
+//
+// cache.c
+//
+
+extern char *cache_dir;
+extern long cache_max_size;
+extern bool cache_stats;
+
+char *cache_key(Token *tok, char *hdr, long hdr_len);
+bool cache_lookup(char *key);
+void cache_store(char *key, char *p, long len);
+void print_cache_stats(void);
+
+//
+// hashmap.c
+//
+
+typedef struct {
+  char *key;
+  int keylen;
+  void *val;
+} HashEntry;
+
+typedef struct {
+  HashEntry *buckets;
+  int capacity;
+  int used;
+
+  // Statistics
+  long lookups;
+  long probes;
+} HashMap;
+
+void *hashmap_get(HashMap *map, char *key);
+void *hashmap_get2(HashMap *map, char *key, int keylen);
+void hashmap_put(HashMap *map, char *key, void *val);
+void hashmap_put2(HashMap *map, char *key, int keylen, void *val);
+void hashmap_delete(HashMap *map, char *key);
+void hashmap_delete2(HashMap *map, char *key, int keylen);
+
 //
 // main.c
 //
 
-extern bool preprocess_only;
\ No newline at end of file
+extern bool preprocess_only;
+extern bool output_object;
+extern char *include_pch;
@@ -22,6 +22,85 @@ typedef struct {
   void *reg_save_area;
 } va_list[1];
 
+struct timespec {
+  long tv_sec;
+  long tv_nsec;
+};
+
+struct rusage {
+  long ru_utime[2];
+  long ru_stime[2];
+  long ru_maxrss;
+  long ru_reserved[13];
+};
+
+struct stat {
+  unsigned long st_dev;
+  unsigned long st_ino;
+  unsigned long st_nlink;
+  unsigned int st_mode;
+  unsigned int st_uid;
+  unsigned int st_gid;
+  int __pad0;
+  unsigned long st_rdev;
+  long st_size;
+  long st_blksize;
+  long st_blocks;
+  struct timespec st_atim;
+  struct timespec st_mtim;
+  struct timespec st_ctim;
+  long __reserved[3];
+};
+
+struct sockaddr_un {
+  unsigned short sun_family;
+  char sun_path[108];
+};
+
+struct iovec {
+  void *iov_base;
+  long iov_len;
+};
+
+struct msghdr {
+  void *msg_name;
+  int msg_namelen;
+  struct iovec *msg_iov;
+  long msg_iovlen;
+  void *msg_control;
+  long msg_controllen;
+  int msg_flags;
+};
+
+struct pollfd {
+  int fd;
+  short events;
+  short revents;
+};
+
+typedef struct DIR DIR;
+
+struct dirent {
+  unsigned long d_ino;
+  long d_off;
+  unsigned short d_reclen;
+  unsigned char d_type;
+  char d_name[256];
+};
+
+enum { EINTR = 4 };
+enum { O_RDONLY = 0, O_WRONLY = 1, O_RDWR = 2, O_CREAT = 64, O_TRUNC = 512 };
+enum { LOCK_EX = 2 };
+enum { S_IFMT = 61440, S_IFREG = 32768 };
+enum { PROT_READ = 1, PROT_WRITE = 2 };
+enum { MAP_PRIVATE = 2, MAP_FIXED = 16, MAP_ANONYMOUS = 32, MAP_POPULATE = 32768 };
+enum { _SC_PAGESIZE = 30 };
+enum { AF_UNIX = 1, SOCK_STREAM = 1, SOL_SOCKET = 1, SCM_RIGHTS = 1 };
+enum { MSG_CTRUNC = 8, MSG_NOSIGNAL = 16384 };
+enum { POLLIN = 1 };
+enum { RUSAGE_SELF = 0 };
+enum { CLOCK_MONOTONIC = 1, CLOCK_PROCESS_CPUTIME_ID = 2 };
+
 void *malloc(long size);
 void *calloc(long nmemb, long size);
 void *realloc(void *buf, long size);
@@ -50,6 +129,56 @@ static void va_end(va_list ap) {}
 long strtoul(char *nptr, char **endptr, int base);
 char *strncpy(char *dest, char *src, long n);
 void exit(int code);
+int atoi(char *nptr);
+char *strrchr(char *s, int c);
+int fflush(FILE *stream);
+int fork(void);
+int waitpid(int pid, int *status, int options);
+int unlink(char *pathname);
+int creat(char *pathname, int mode);
+void *memset(void *s, int c, long n);
+int memcmp(void *s1, void *s2, long n);
+char *strchr(char *s, int c);
+long strtol(char *nptr, char **endptr, int base);
+long write(int fd, void *buf, long count);
+void *memcpy(void *dst, void *src, long n);
+int clock_gettime(int clockid, struct timespec *tp);
+int getrusage(int who, struct rusage *usage);
+void free(void *ptr);
+char *strcpy(char *dest, char *src);
+long read(int fd, void *buf, long count);
+int close(int fd);
+int dup2(int oldfd, int newfd);
+int pipe(int *pipefd);
+int chdir(char *path);
+char *getcwd(char *buf, long size);
+char *realpath(char *path, char *resolved_path);
+int stat(char *path, struct stat *buf);
+int socket(int domain, int type, int protocol);
+int bind(int fd, struct sockaddr *addr, int len);
+int listen(int fd, int backlog);
+int accept(int fd, struct sockaddr *addr, int *len);
+int connect(int fd, struct sockaddr *addr, int len);
+long send(int fd, void *buf, long len, int flags);
+long sendmsg(int fd, struct msghdr *msg, int flags);
+long recvmsg(int fd, struct msghdr *msg, int flags);
+int poll(struct pollfd *fds, long nfds, int timeout);
+int open(char *path, int flags, ...);
+int fstat(int fd, struct stat *buf);
+int flock(int fd, int op);
+void *mmap(void *addr, long len, int prot, int flags, int fd, long off);
+int munmap(void *addr, long len);
+long sysconf(int name);
+long pread(int fd, void *buf, long count, long offset);
+long pwrite(int fd, void *buf, long count, long offset);
+int ftruncate(int fd, long length);
+int getpid(void);
+int rename(char *oldpath, char *newpath);
+int mkdir(char *path, int mode);
+int utime(char *path, void *times);
+DIR *opendir(char *name);
+struct dirent *readdir(DIR *dirp);
+int closedir(DIR *dirp);
 EOF
 
     grep -v '^#' punyc.h >> $TMP/$1
@@ -58,6 +187,7 @@ EOF
     sed -i 's/\berrno\b/*__errno_location()/g' $TMP/$1
     sed -i 's/\btrue\b/1/g; s/\bfalse\b/0/g;' $TMP/$1
     sed -i 's/\bNULL\b/0/g' $TMP/$1
+    sed -i 's/\bMAP_FAILED\b/((void *)-1)/g' $TMP/$1
     sed -i 's/INT_MAX/2147483647/g' $TMP/$1
     sed -i 's/\bva_start\b/__builtin_va_start/g' $TMP/$1
 
@@ -75,5 +205,13 @@ punyc parse.c
 punyc codegen.c
 punyc tokenize.c
 punyc preprocess.c
+punyc emit.c
+punyc assemble.c
+punyc hashmap.c
+punyc timer.c
+punyc alloc.c
+punyc server.c
+punyc cache.c
+punyc pch.c
 
 (cd $TMP; gcc -static -o ../$OUTPUT *.o)
\ No newline at end of file
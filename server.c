@@ -0,0 +1,549 @@
+// This file implements the compile server.
+//
+// `punyc --server <socket>` starts a daemon that accepts compile
+// requests from `punyc --client <socket> <args>...`. A client sends
+// its working directory, its arguments and its standard file
+// descriptors, and the server compiles the request just as if punyc
+// had been started with these arguments in that directory. The
+// exit status is sent back to the client.
+//
+// The compiler keeps its state in global variables and calls exit()
+// on errors, so each request is still compiled in a worker process
+// forked from the server. What the server keeps across requests is
+// a cache of files that have already been read and tokenized.
+// Workers inherit the cache when they are forked, and report back
+// the files they read so that the server can add them to the cache
+// once a request has succeeded. A cached file is used only while
+// its device, inode, size and modification time are unchanged.
+//
+// The server never waits for a worker: it goes back to accepting
+// connections right after forking, and watches the workers' report
+// pipes with poll(). When a pipe is closed, the worker has exited,
+// and its status is sent back to the client. Reported files are
+// tokenized into the cache only while there's nothing else to do.
+
+#include "punyc.h"
+
+enum { MAX_REQUEST = 1 << 20 };
+
+typedef struct {
+  FileId id;
+  Token *tok;
+  Arena *arena;  // Where the tokens are allocated
+  char *input;   // The contents of the file
+  long mapping;  // See read_file_string()
+} CachedFile;
+
+// Ancillary data for passing the standard file descriptors to the
+// server. This has the same layout as struct cmsghdr followed by
+// three ints, padded to CMSG_SPACE. The padding has room for one
+// more descriptor, which a bad request may send.
+typedef struct {
+  long len;
+  int level;
+  int type;
+  int fds[4];
+} FdMessage;
+
+// A request being compiled by a worker process
+typedef struct Job Job;
+struct Job {
+  Job *next;
+  int pid;
+  int conn;    // The connection to the client
+  int fd;      // The pipe from which files read by the worker come
+  char *files; // Files reported so far, one per line
+  long len;
+  long cap;
+};
+
+// A file to be added to the cache
+typedef struct PendingFile PendingFile;
+struct PendingFile {
+  PendingFile *next;
+  char *path;
+};
+
+// Maps absolute paths to CachedFiles.
+static HashMap file_cache;
+
+// Requests being compiled
+static Job *jobs;
+
+// Files to be added to the cache when the server is idle
+static PendingFile *pending;
+static PendingFile *pending_last;
+
+// In a worker, the pipe to report files read back to the server.
+static int report_fd = -1;
+
+// In a worker, the current directory to make paths absolute.
+static char *cwd;
+
+// Returns an absolute path for a given path.
+static char *absolute_path(char *path) {
+  if (path[0] == '/')
+    return path;
+
+  if (!cwd) {
+    char buf[4096];
+    if (!getcwd(buf, sizeof(buf)))
+      return path;
+    cwd = alloc_str(buf, strlen(buf));
+  }
+
+  char *buf = alloc_obj(AK_STRING, strlen(cwd) + strlen(path) + 2);
+  sprintf(buf, "%s/%s", cwd, path);
+  return buf;
+}
+
+static bool is_fresh(CachedFile *cf, FileId *id) {
+  return !memcmp(&cf->id, id, sizeof(FileId));
+}
+
+// Returns the cached tokens of a given file, or NULL if the file
+// is not in the cache or has been modified since it was cached.
+Token *find_cached_file(char *path) {
+  if (file_cache.used == 0 || !strcmp(path, "-"))
+    return NULL;
+
+  CachedFile *cf = hashmap_get(&file_cache, absolute_path(path));
+  if (!cf)
+    return NULL;
+
+  FileId id;
+  if (!get_file_id(path, &id) || !is_fresh(cf, &id))
+    return NULL;
+  return cf->tok;
+}
+
+// In a worker, tells the server that a given file has been read.
+void note_input_file(char *path) {
+  if (report_fd < 0 || !strcmp(path, "-"))
+    return;
+
+  char *abs = absolute_path(path);
+  int len = strlen(abs);
+  char *buf = alloc_obj(AK_STRING, len + 1);
+  memcpy(buf, abs, len);
+  buf[len] = '\n';
+
+  // A write to a pipe up to PIPE_BUF bytes is atomic, so lines
+  // written by parallel workers don't get mixed.
+  write(report_fd, buf, len + 1);
+}
+
+// Releases a cached file which has been replaced or removed. Workers
+// forked before have their own copies, so they are not affected.
+static void free_cached_file(CachedFile *cf) {
+  free(cf->tok->file->lines);
+  release_arena(cf->arena);
+  free_file_string(cf->input, cf->mapping);
+  free(cf);
+}
+
+// Reads and tokenizes a given file into the cache unless it's
+// already cached. A stale entry is replaced, and its memory is
+// released so that the server doesn't grow as files are edited.
+static void cache_file(char *path) {
+  CachedFile *old = hashmap_get(&file_cache, path);
+
+  FileId id;
+  if (!get_file_id(path, &id)) {
+    if (old) {
+      hashmap_delete(&file_cache, path);
+      free_cached_file(old);
+    }
+    return;
+  }
+
+  if (old && is_fresh(old, &id))
+    return;
+
+  CachedFile *cf = calloc(1, sizeof(CachedFile));
+  cf->input = read_file_string(path, &cf->mapping);
+  if (!cf->input) {
+    free(cf);
+    return;
+  }
+
+  cf->id = id;
+  cf->arena = enter_arena();
+  cf->tok = tokenize(path, 0, cf->input);
+  leave_arena(cf->arena);
+
+  if (old) {
+    hashmap_put(&file_cache, path, cf);
+    free_cached_file(old);
+  } else {
+    hashmap_put(&file_cache, alloc_str(path, strlen(path)), cf);
+  }
+}
+
+static bool send_all(int fd, char *p, long len) {
+  while (len > 0) {
+    long n = send(fd, p, len, MSG_NOSIGNAL);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+    p += n;
+    len -= n;
+  }
+  return true;
+}
+
+static bool recv_all(int fd, char *p, long len) {
+  while (len > 0) {
+    long n = read(fd, p, len);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+    p += n;
+    len -= n;
+  }
+  return true;
+}
+
+// Reads everything from a given file descriptor until EOF.
+char *read_all(int fd) {
+  long cap = 4096;
+  long len = 0;
+  char *buf = malloc(cap);
+
+  for (;;) {
+    if (len == cap - 1) {
+      cap *= 2;
+      buf = realloc(buf, cap);
+    }
+    long n = read(fd, buf + len, cap - 1 - len);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      break;
+    len += n;
+  }
+  buf[len] = '\0';
+  return buf;
+}
+
+// Returns the length of an FdMessage with `n` descriptors, just
+// like CMSG_LEN.
+static long fd_message_len(int n) {
+  return sizeof(long) + sizeof(int) * 2 + sizeof(int) * n;
+}
+
+// Receives a request, which consists of the payload length, the
+// standard file descriptors, and a payload of null-terminated
+// strings: the working directory followed by arguments.
+static char *recv_request(int conn, int *fds, int *len) {
+  struct iovec iov = {};
+  iov.iov_base = len;
+  iov.iov_len = sizeof(int);
+
+  FdMessage fdmsg = {};
+  struct msghdr msg = {};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = &fdmsg;
+  msg.msg_controllen = sizeof(fdmsg);
+
+  long n = recvmsg(conn, &msg, 0);
+
+  // Find out how many descriptors have arrived, so that they are
+  // closed if the request turns out to be bad.
+  int nfds = 0;
+  if (n >= 0 && msg.msg_controllen >= fd_message_len(0) &&
+      fdmsg.level == SOL_SOCKET && fdmsg.type == SCM_RIGHTS &&
+      fdmsg.len > fd_message_len(0))
+    nfds = (fdmsg.len - fd_message_len(0)) / sizeof(int);
+  if (nfds > 4)
+    nfds = 4;
+
+  char *buf = NULL;
+  if (n == sizeof(int) && !(msg.msg_flags & MSG_CTRUNC) &&
+      fdmsg.len == fd_message_len(3) && 0 < *len && *len <= MAX_REQUEST) {
+    buf = calloc(1, *len + 1);
+    if (recv_all(conn, buf, *len)) {
+      for (int i = 0; i < 3; i++)
+        fds[i] = fdmsg.fds[i];
+      return buf;
+    }
+  }
+
+  for (int i = 0; i < nfds; i++)
+    close(fdmsg.fds[i]);
+  free(buf);
+  return NULL;
+}
+
+// Sets up the current process as a worker for a given request.
+static void start_worker(char *buf, int len, int *fds, int *argc,
+                         char ***argv) {
+  for (int i = 0; i < 3; i++) {
+    dup2(fds[i], i);
+    close(fds[i]);
+  }
+
+  char **args = calloc(len + 2, sizeof(char *));
+  int n = 0;
+  args[n++] = "punyc";
+  for (char *p = buf + strlen(buf) + 1; p < buf + len; p += strlen(p) + 1)
+    args[n++] = p;
+
+  if (chdir(buf))
+    error("cannot change directory to %s: %s", buf, strerror(errno));
+
+  *argc = n;
+  *argv = args;
+}
+
+// Accepts a connection and starts a worker for it. Returns true in
+// the forked worker process which should go on to compile the
+// request.
+static bool start_job(int sock, int *argc, char ***argv) {
+  int conn = accept(sock, NULL, NULL);
+  if (conn < 0) {
+    if (errno == EINTR)
+      return false;
+    error("accept failed: %s", strerror(errno));
+  }
+
+  int fds[3];
+  int len;
+  char *buf = recv_request(conn, fds, &len);
+  if (!buf) {
+    close(conn);
+    return false;
+  }
+
+  int pfd[2];
+  if (pipe(pfd))
+    error("pipe failed: %s", strerror(errno));
+
+  int pid = fork();
+  if (pid < 0)
+    error("fork failed: %s", strerror(errno));
+
+  if (pid == 0) {
+    close(sock);
+    for (Job *job = jobs; job; job = job->next) {
+      close(job->conn);
+      close(job->fd);
+    }
+    close(conn);
+    close(pfd[0]);
+    report_fd = pfd[1];
+    reset_timer();
+    reset_alloc_stats();
+    start_worker(buf, len, fds, argc, argv);
+    return true;
+  }
+
+  close(pfd[1]);
+  for (int i = 0; i < 3; i++)
+    close(fds[i]);
+  free(buf);
+
+  Job *job = calloc(1, sizeof(Job));
+  job->pid = pid;
+  job->conn = conn;
+  job->fd = pfd[0];
+  job->cap = 4096;
+  job->files = malloc(job->cap);
+  job->next = jobs;
+  jobs = job;
+  return false;
+}
+
+// Adds files listed in a given string to the pending list.
+static void add_pending_files(char *files) {
+  for (char *p = files; *p;) {
+    char *end = strchr(p, '\n');
+    if (!end)
+      break;
+
+    PendingFile *pf = malloc(sizeof(PendingFile));
+    pf->next = NULL;
+    pf->path = strndup(p, end - p);
+    if (pending_last)
+      pending_last->next = pf;
+    else
+      pending = pf;
+    pending_last = pf;
+    p = end + 1;
+  }
+}
+
+// Reads what a worker has reported. Once the worker has exited,
+// sends its exit status to the client and returns true.
+static bool read_job(Job *job) {
+  if (job->len == job->cap - 1) {
+    job->cap *= 2;
+    job->files = realloc(job->files, job->cap);
+  }
+
+  long n = read(job->fd, job->files + job->len, job->cap - 1 - job->len);
+  if (n < 0 && errno == EINTR)
+    return false;
+  if (n > 0) {
+    job->len += n;
+    return false;
+  }
+  close(job->fd);
+
+  int status;
+  while (waitpid(job->pid, &status, 0) < 0)
+    if (errno != EINTR)
+      error("waitpid failed: %s", strerror(errno));
+
+  int code = status ? 1 : 0;
+  send_all(job->conn, (char *)&code, sizeof(code));
+  close(job->conn);
+
+  // Files of a failed compilation may not even tokenize,
+  // so we cache files only for successful ones.
+  job->files[job->len] = '\0';
+  if (code == 0)
+    add_pending_files(job->files);
+  free(job->files);
+  return true;
+}
+
+// Adds the first pending file to the cache.
+static void cache_pending_file(void) {
+  PendingFile *pf = pending;
+  pending = pf->next;
+  if (!pending)
+    pending_last = NULL;
+  cache_file(pf->path);
+  free(pf->path);
+  free(pf);
+}
+
+// Runs the compile server. This function returns only in a worker
+// process, with `argc` and `argv` set to the arguments of a request.
+void run_server(char *path, int *argc, char ***argv) {
+  struct sockaddr_un addr = {};
+  if (strlen(path) >= sizeof(addr.sun_path))
+    error("socket path too long: %s", path);
+  addr.sun_family = AF_UNIX;
+  strcpy(addr.sun_path, path);
+
+  int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (sock < 0)
+    error("socket failed: %s", strerror(errno));
+
+  unlink(path);
+  if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)))
+    error("cannot bind to %s: %s", path, strerror(errno));
+  if (listen(sock, 64))
+    error("listen failed: %s", strerror(errno));
+
+  for (;;) {
+    // Watch the socket and the report pipes of all workers.
+    int nfds = 1;
+    for (Job *job = jobs; job; job = job->next)
+      nfds++;
+
+    struct pollfd *fds = calloc(nfds, sizeof(struct pollfd));
+    fds[0].fd = sock;
+    fds[0].events = POLLIN;
+    int i = 1;
+    for (Job *job = jobs; job; job = job->next) {
+      fds[i].fd = job->fd;
+      fds[i].events = POLLIN;
+      i++;
+    }
+
+    // Don't block if there are files to cache.
+    int n = poll(fds, nfds, pending ? 0 : -1);
+    if (n < 0 && errno != EINTR)
+      error("poll failed: %s", strerror(errno));
+
+    if (n == 0) {
+      cache_pending_file();
+      free(fds);
+      continue;
+    }
+
+    // Finish requests whose workers have exited.
+    Job **jp = &jobs;
+    for (i = 1; i < nfds; i++) {
+      Job *job = *jp;
+      if (n > 0 && fds[i].revents && read_job(job)) {
+        *jp = job->next;
+        free(job);
+        continue;
+      }
+      jp = &job->next;
+    }
+
+    bool is_new = n > 0 && (fds[0].revents & POLLIN);
+    free(fds);
+    if (is_new && start_job(sock, argc, argv))
+      return;
+  }
+}
+
+// Sends a compile request to the server and returns the exit status
+// of the compilation. argv[0] is ignored.
+int run_client(char *path, int argc, char **argv) {
+  struct sockaddr_un addr = {};
+  if (strlen(path) >= sizeof(addr.sun_path))
+    error("socket path too long: %s", path);
+  addr.sun_family = AF_UNIX;
+  strcpy(addr.sun_path, path);
+
+  int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (sock < 0)
+    error("socket failed: %s", strerror(errno));
+  if (connect(sock, (struct sockaddr *)&addr, sizeof(addr)))
+    error("cannot connect to %s: %s", path, strerror(errno));
+
+  // Build a payload.
+  char dir[4096];
+  if (!getcwd(dir, sizeof(dir)))
+    error("getcwd failed: %s", strerror(errno));
+
+  int len = strlen(dir) + 1;
+  for (int i = 1; i < argc; i++)
+    len += strlen(argv[i]) + 1;
+
+  char *buf = malloc(len);
+  char *p = buf;
+  strcpy(p, dir);
+  p += strlen(dir) + 1;
+  for (int i = 1; i < argc; i++) {
+    strcpy(p, argv[i]);
+    p += strlen(argv[i]) + 1;
+  }
+
+  // Send the payload length along with our stdin, stdout and stderr.
+  struct iovec iov = {};
+  iov.iov_base = &len;
+  iov.iov_len = sizeof(int);
+
+  FdMessage fdmsg = {};
+  fdmsg.len = fd_message_len(3);
+  fdmsg.level = SOL_SOCKET;
+  fdmsg.type = SCM_RIGHTS;
+  for (int i = 0; i < 3; i++)
+    fdmsg.fds[i] = i;
+
+  struct msghdr msg = {};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = &fdmsg;
+  msg.msg_controllen = sizeof(fdmsg);
+
+  if (sendmsg(sock, &msg, 0) != sizeof(int) || !send_all(sock, buf, len))
+    error("cannot send a request to %s: %s", path, strerror(errno));
+
+  int code;
+  if (!recv_all(sock, (char *)&code, sizeof(code)))
+    error("%s: connection closed by server", path);
+  close(sock);
+  return code;
+}
@@ -0,0 +1,9 @@
+#ifndef INCLUDE3_H
+#define INCLUDE3_H
+#ifdef INCLUDE3_SEEN
+#undef INCLUDE3_SEEN
+#define INCLUDE3_SEEN 2
+#else
+#define INCLUDE3_SEEN 1
+#endif
+#endif
@@ -0,0 +1,9 @@
+#ifndef INCLUDE4_H
+#define INCLUDE4_H
+#endif
+#ifdef INCLUDE4_SEEN
+#undef INCLUDE4_SEEN
+#define INCLUDE4_SEEN 2
+#else
+#define INCLUDE4_SEEN 1
+#endif
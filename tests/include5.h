@@ -0,0 +1,7 @@
+#pragma once
+#ifdef INCLUDE5_SEEN
+#undef INCLUDE5_SEEN
+#define INCLUDE5_SEEN 2
+#else
+#define INCLUDE5_SEEN 1
+#endif
@@ -0,0 +1,20 @@
+XM(1, 1)
+XM(2, 1)
+XM(3, 1)
+XM(4, 1)
+XM(5, 1)
+XM(6, 1)
+XM(7, 1)
+XM(8, 1)
+XM(9, 1)
+XM(10, 1)
+XM(11, 1)
+XM(12, 1)
+XM(13, 1)
+XM(14, 1)
+XM(15, 1)
+XM(16, 1)
+XM(17, 1)
+XM(18, 1)
+XM(19, 1)
+XM(20, 1)
@@ -266,6 +266,13 @@ int main() {
   assert(99, "abc"[2], "\"abc\"[2]");
   assert(0, "abc"[3], "\"abc\"[3]");
   assert(4, sizeof("abc"), "sizeof(\"abc\")");
+  assert(201, sizeof("01234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789"), "sizeof(<200 chars>)");
+  assert(55, ("01234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789")[197], "(<200 chars>)[197]");
+  assert(0, ("01234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789")[200], "(<200 chars>)[200]");
+  assert(201, ({ char x[] = "01234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789"; sizeof(x); }), "({ char x[] = <200 chars>; sizeof(x); })");
+  assert(56, ({ char x[] = "01234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789"; x[198]; }), "({ char x[] = <200 chars>; x[198]; })");
+  assert(5, sizeof("a\tb\\"), "sizeof(\"a\\tb\\\\\")");
+  assert(92, "a\tb\\"[3], "\"a\\tb\\\\\"[3]");
 
   assert(7, "\a"[0], "\"\\a\"[0]");
   assert(8, "\b"[0], "\"\\b\"[0]");
@@ -965,6 +972,41 @@ int main() {
   assert(5, include1, "include1");
   assert(7, include2, "include2");
 
+#include "include3.h"
+#include "include3.h"
+  assert(1, INCLUDE3_SEEN, "INCLUDE3_SEEN");
+#undef INCLUDE3_H
+#include "include3.h"
+  assert(2, INCLUDE3_SEEN, "INCLUDE3_SEEN");
+
+#include "include4.h"
+#include "include4.h"
+  assert(2, INCLUDE4_SEEN, "INCLUDE4_SEEN");
+
+#include "include5.h"
+#include "include5.h"
+#include "./include5.h"
+  assert(1, INCLUDE5_SEEN, "INCLUDE5_SEEN");
+
+#define XM(a, b) + a
+  assert(210, 0
+#include "include6.h"
+         , "0 + 1 + 2 + ... + 20");
+#undef XM
+#define XM(a, b) + b
+  assert(20, 0
+#include "include6.h"
+         , "0 + 1 + 1 + ... + 1");
+#undef XM
+#define XM(a, b) + a * b
+  assert(210, 0
+#include "include6.h"
+         , "0 + 1 * 1 + 2 * 1 + ... + 20 * 1");
+#undef XM
+
+#pragma pack(1)
+#pragma
+
 #if 0
 #include "/no/such/file"
   assert(0, 1, "1");
@@ -1187,6 +1229,15 @@ int main() {
 #define paste3(x) 2##x
   assert(21, paste3(1), "paste3(1)");
 
+#define paste4(x,y,z) x##y##z
+  assert(123, paste4(1,2,3), "paste4(1,2,3)");
+  assert(13, paste4(1,,3), "paste4(1,,3)");
+  assert(248, paste4(2 * 3, 1 <, < 2), "paste4(2 * 3, 1 <, < 2)");
+  assert(2, paste4(, (4 - 2), ), "paste4(, (4 - 2), )");
+
+#define M13 10000000000
+  assert(8, sizeof(M13), "sizeof(M13)");
+
 #define M12
   assert(3,
 #if defined(M12)
@@ -1221,6 +1272,58 @@ int main() {
 #endif
          "4");
 
+  // Redefining a macro whose name collides with a deleted one must
+  // replace it, not add a second entry.
+#define U0 1
+#define U1 1
+#define U2 1
+#define U3 1
+#define U4 1
+#define U5 1
+#define U6 1
+#define U7 1
+#define U8 1
+#define U9 1
+#define U10 1
+#define U11 1
+#define U12 1
+#define U13 1
+#define U14 1
+#define U15 1
+#undef U0
+#undef U2
+#undef U4
+#undef U6
+#undef U8
+#undef U10
+#undef U12
+#undef U14
+#define U1 2
+#define U3 2
+#define U5 2
+#define U7 2
+#define U9 2
+#define U11 2
+#define U13 2
+#define U15 2
+#undef U1
+#undef U3
+#undef U5
+#undef U7
+#undef U9
+#undef U11
+#undef U13
+#undef U15
+  assert(0,
+#if defined(U0) || defined(U1) || defined(U2) || defined(U3) || defined(U4) || defined(U5) || defined(U6) || defined(U7)
+         1,
+#elif defined(U8) || defined(U9) || defined(U10) || defined(U11) || defined(U12) || defined(U13) || defined(U14) || defined(U15)
+         1,
+#else
+         0,
+#endif
+         "0");
+
   assert(5,
 #if no_such_symbol == 0
          5,
@@ -1229,6 +1332,11 @@ int main() {
 #endif
          "5");
 
+  assert(7, ({ int	x_0123456789_abcdefghij_ABCDEFGHIJ_ = 7;	/* tab */ x_0123456789_abcdefghij_ABCDEFGHIJ_; }), "({ int x_0123456789_abcdefghij_ABCDEFGHIJ_ = 7; x_0123456789_abcdefghij_ABCDEFGHIJ_; })");
+  assert(47, sizeof("0123456789 \"0123456789\" \\0123456789 0123456789"), "sizeof(\"0123456789 \\\"0123456789\\\" \\\\0123456789 0123456789\")");
+  assert(3, ({ int x = 3; /* a block
+     comment spanning lines */ x; }), "({ int x = 3; x; })");
+
   printf("OK\n");
   return 0;
 }
\ No newline at end of file
@@ -0,0 +1,188 @@
+// This file implements -ftime-report, which shows how much time
+// each phase of the compiler takes. It also keeps track of the
+// current phase for -fmem-report.
+//
+// Phases nest: e.g. an #include reads and tokenizes a file in the
+// middle of preprocessing. Elapsed time is always charged to the
+// innermost running phase, so the numbers in the report add up to
+// the total.
+
+#include "punyc.h"
+
+bool time_report;
+bool time_report_json;
+
+enum { MAX_DEPTH = 8 };
+
+static char *phase_names[] = {
+  "read", "tokenize", "preprocess", "keywords", "parse", "layout",
+  "emit_data", "emit_text", "assemble",
+};
+
+static char *phase_unit[] = {
+  "bytes", "tokens", "tokens", "tokens", "nodes", "vars",
+  "bytes", "bytes", "bytes",
+};
+
+// Elapsed wall-clock and CPU time in nanoseconds.
+static long phase_wall[NR_PHASES];
+static long phase_cpu[NR_PHASES];
+
+// Number of items (see phase_unit) processed by each phase.
+static long phase_count[NR_PHASES];
+
+static long nr_lines;
+
+static Phase stack[MAX_DEPTH];
+static int depth;
+static long last_wall;
+static long last_cpu;
+
+static long now(int clock) {
+  struct timespec ts;
+  clock_gettime(clock, &ts);
+  return ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+// Charges the time elapsed since the last call to the current phase.
+static void charge(void) {
+  long wall = now(CLOCK_MONOTONIC);
+  long cpu = now(CLOCK_PROCESS_CPUTIME_ID);
+
+  if (depth > 0) {
+    Phase ph = stack[depth - 1];
+    phase_wall[ph] += wall - last_wall;
+    phase_cpu[ph] += cpu - last_cpu;
+  }
+  last_wall = wall;
+  last_cpu = cpu;
+}
+
+void timer_start(Phase ph) {
+  if (!time_report && !mem_report)
+    return;
+  if (depth == MAX_DEPTH)
+    error("internal error: phases nested too deeply");
+  if (time_report)
+    charge();
+  stack[depth++] = ph;
+}
+
+void timer_stop(void) {
+  if (!time_report && !mem_report)
+    return;
+  if (time_report)
+    charge();
+  depth--;
+}
+
+// Returns the innermost running phase, or NR_PHASES if none.
+Phase current_phase(void) {
+  return depth ? stack[depth - 1] : NR_PHASES;
+}
+
+char *phase_name(Phase ph) {
+  return ph == NR_PHASES ? "other" : phase_names[ph];
+}
+
+void timer_count(Phase ph, long n) {
+  phase_count[ph] += n;
+}
+
+void timer_count_lines(long n) {
+  nr_lines += n;
+}
+
+// Clears the numbers collected so far.
+void reset_timer(void) {
+  memset(phase_wall, 0, sizeof(phase_wall));
+  memset(phase_cpu, 0, sizeof(phase_cpu));
+  memset(phase_count, 0, sizeof(phase_count));
+  nr_lines = 0;
+}
+
+// Returns the number of items per second.
+static long rate(long count, long ns) {
+  return ns ? count * 1000000000 / ns : 0;
+}
+
+static void print_ms(long ns) {
+  long us = ns / 1000;
+  fprintf(stderr, " %9ld.%03ld", us / 1000, us % 1000);
+}
+
+static void print_table(char *input, long total_wall, long total_cpu) {
+  fprintf(stderr, "time report for %s\n", input);
+  fprintf(stderr, "phase             wall(ms)       cpu(ms)       %%      count unit        rate(/s)\n");
+
+  for (int i = 0; i < NR_PHASES; i++) {
+    long pct = total_wall ? phase_wall[i] * 1000 / total_wall : 0;
+    fprintf(stderr, "%-12s", phase_names[i]);
+    print_ms(phase_wall[i]);
+    print_ms(phase_cpu[i]);
+    fprintf(stderr, " %5ld.%ld", pct / 10, pct % 10);
+    fprintf(stderr, " %10ld %-7s %12ld\n", phase_count[i], phase_unit[i],
+            rate(phase_count[i], phase_wall[i]));
+  }
+
+  fprintf(stderr, "%-12s", "total");
+  print_ms(total_wall);
+  print_ms(total_cpu);
+  fprintf(stderr, "\n");
+
+  fprintf(stderr, "%ld lines, %ld tokens: ", nr_lines,
+          phase_count[PH_TOKENIZE]);
+  fprintf(stderr, "%ld lines/sec, %ld tokens/sec\n",
+          rate(nr_lines, total_wall),
+          rate(phase_count[PH_TOKENIZE], total_wall));
+}
+
+// Prints a given string as a JSON string.
+static void print_json_string(char *str) {
+  fprintf(stderr, "\"");
+  for (char *p = str; *p; p++) {
+    if (*p == '\\' || *p == '"')
+      fprintf(stderr, "\\%c", *p);
+    else if ((unsigned char)*p < 0x20)
+      fprintf(stderr, "\\u%04x", *p);
+    else
+      fprintf(stderr, "%c", *p);
+  }
+  fprintf(stderr, "\"");
+}
+
+static void print_json(char *input, long total_wall, long total_cpu) {
+  fprintf(stderr, "{\"file\": ");
+  print_json_string(input);
+  fprintf(stderr, ", \"phases\": [");
+
+  for (int i = 0; i < NR_PHASES; i++) {
+    fprintf(stderr, "%s{\"name\": \"%s\", \"wall_ns\": %ld, \"cpu_ns\": %ld, ",
+            i ? ", " : "", phase_names[i], phase_wall[i], phase_cpu[i]);
+    fprintf(stderr, "\"count\": %ld, \"unit\": \"%s\"}",
+            phase_count[i], phase_unit[i]);
+  }
+
+  fprintf(stderr, "], \"wall_ns\": %ld, \"cpu_ns\": %ld, ",
+          total_wall, total_cpu);
+  fprintf(stderr, "\"lines\": %ld, \"tokens\": %ld, ",
+          nr_lines, phase_count[PH_TOKENIZE]);
+  fprintf(stderr, "\"lines_per_sec\": %ld, \"tokens_per_sec\": %ld}\n",
+          rate(nr_lines, total_wall),
+          rate(phase_count[PH_TOKENIZE], total_wall));
+}
+
+// Prints out the report to stderr.
+void print_time_report(char *input) {
+  long total_wall = 0;
+  long total_cpu = 0;
+  for (int i = 0; i < NR_PHASES; i++) {
+    total_wall += phase_wall[i];
+    total_cpu += phase_cpu[i];
+  }
+
+  if (time_report_json)
+    print_json(input, total_wall, total_cpu);
+  else
+    print_table(input, total_wall, total_cpu);
+}
@@ -0,0 +1,27 @@
+.file 1 "tmp-cache.c"
+.intel_syntax noprefix
+.bss
+.data
+.text
+.globl main
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 1 14
+  mov r10, 1
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.main
+.L.return.main:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,4 @@
+#define N 40
+typedef int T;
+struct S { T x; };
+#define M 1
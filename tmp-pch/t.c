@@ -0,0 +1 @@
+int main() { struct S s = { N + 2 }; return s.x; }
@@ -0,0 +1,7 @@
+#define F(a) [a]
+#include "x.h"
+1)
+#include "x.h"
+2)
+#include "x.h"
+3)
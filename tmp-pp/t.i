@@ -0,0 +1,4 @@
+  [
+ 1 ]  [
+ 2 ]  [
+ 3 ]
@@ -0,0 +1 @@
+F(
@@ -0,0 +1,60699 @@
+.file 1 "tests.c"
+.file 2 "include1.h"
+.file 3 "include2.h"
+.file 4 "include3.h"
+.file 5 "include3.h"
+.file 6 "include4.h"
+.file 7 "include4.h"
+.file 8 "include5.h"
+.file 9 "include6.h"
+.file 10 "include6.h"
+.intel_syntax noprefix
+.bss
+.align 4
+.L.data.7:
+  .zero 4
+.align 512
+.globl g_aligned2
+g_aligned2:
+  .zero 4
+.align 512
+.globl g_aligned1
+g_aligned1:
+  .zero 4
+.align 4
+.globl g2
+g2:
+  .zero 16
+.align 4
+.globl g1
+g1:
+  .zero 4
+.data
+.align 1
+.L.data.790:
+  .byte 79
+  .byte 75
+  .byte 10
+  .zero 1
+.align 1
+.L.data.789:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.788:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 34
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 32
+  .byte 92
+  .byte 34
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 92
+  .byte 34
+  .byte 32
+  .byte 92
+  .byte 92
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 32
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 34
+  .byte 41
+  .zero 1
+.align 1
+.L.data.787:
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 32
+  .byte 34
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 34
+  .byte 32
+  .byte 92
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 32
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .zero 1
+.align 1
+.L.data.786:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 95
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 95
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 103
+  .byte 104
+  .byte 105
+  .byte 106
+  .byte 95
+  .byte 65
+  .byte 66
+  .byte 67
+  .byte 68
+  .byte 69
+  .byte 70
+  .byte 71
+  .byte 72
+  .byte 73
+  .byte 74
+  .byte 95
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 95
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 95
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 103
+  .byte 104
+  .byte 105
+  .byte 106
+  .byte 95
+  .byte 65
+  .byte 66
+  .byte 67
+  .byte 68
+  .byte 69
+  .byte 70
+  .byte 71
+  .byte 72
+  .byte 73
+  .byte 74
+  .byte 95
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.785:
+  .byte 53
+  .zero 1
+.align 1
+.L.data.784:
+  .byte 48
+  .zero 1
+.align 1
+.L.data.783:
+  .byte 52
+  .zero 1
+.align 1
+.L.data.782:
+  .byte 52
+  .zero 1
+.align 1
+.L.data.781:
+  .byte 51
+  .zero 1
+.align 1
+.L.data.780:
+  .byte 51
+  .zero 1
+.align 1
+.L.data.779:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 77
+  .byte 49
+  .byte 51
+  .byte 41
+  .zero 1
+.align 1
+.L.data.778:
+  .byte 112
+  .byte 97
+  .byte 115
+  .byte 116
+  .byte 101
+  .byte 52
+  .byte 40
+  .byte 44
+  .byte 32
+  .byte 40
+  .byte 52
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 50
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 41
+  .zero 1
+.align 1
+.L.data.777:
+  .byte 112
+  .byte 97
+  .byte 115
+  .byte 116
+  .byte 101
+  .byte 52
+  .byte 40
+  .byte 50
+  .byte 32
+  .byte 42
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 32
+  .byte 60
+  .byte 44
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 50
+  .byte 41
+  .zero 1
+.align 1
+.L.data.776:
+  .byte 112
+  .byte 97
+  .byte 115
+  .byte 116
+  .byte 101
+  .byte 52
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 44
+  .byte 51
+  .byte 41
+  .zero 1
+.align 1
+.L.data.775:
+  .byte 112
+  .byte 97
+  .byte 115
+  .byte 116
+  .byte 101
+  .byte 52
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 41
+  .zero 1
+.align 1
+.L.data.774:
+  .byte 112
+  .byte 97
+  .byte 115
+  .byte 116
+  .byte 101
+  .byte 51
+  .byte 40
+  .byte 49
+  .byte 41
+  .zero 1
+.align 1
+.L.data.773:
+  .byte 112
+  .byte 97
+  .byte 115
+  .byte 116
+  .byte 101
+  .byte 50
+  .byte 40
+  .byte 49
+  .byte 41
+  .zero 1
+.align 1
+.L.data.772:
+  .byte 112
+  .byte 97
+  .byte 115
+  .byte 116
+  .byte 101
+  .byte 40
+  .byte 44
+  .byte 53
+  .byte 41
+  .zero 1
+.align 1
+.L.data.771:
+  .byte 112
+  .byte 97
+  .byte 115
+  .byte 116
+  .byte 101
+  .byte 40
+  .byte 53
+  .byte 44
+  .byte 41
+  .zero 1
+.align 1
+.L.data.770:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 97
+  .byte 115
+  .byte 116
+  .byte 101
+  .byte 40
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 44
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.769:
+  .byte 112
+  .byte 97
+  .byte 115
+  .byte 116
+  .byte 101
+  .byte 40
+  .byte 48
+  .byte 44
+  .byte 120
+  .byte 102
+  .byte 102
+  .byte 41
+  .zero 1
+.align 1
+.L.data.768:
+  .byte 112
+  .byte 97
+  .byte 115
+  .byte 116
+  .byte 101
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 53
+  .byte 41
+  .zero 1
+.align 1
+.L.data.767:
+  .byte 77
+  .byte 49
+  .byte 49
+  .byte 40
+  .byte 32
+  .byte 97
+  .byte 33
+  .byte 98
+  .byte 32
+  .byte 32
+  .byte 96
+  .byte 34
+  .byte 34
+  .byte 99
+  .byte 41
+  .byte 91
+  .byte 56
+  .byte 93
+  .zero 1
+.align 1
+.L.data.766:
+  .byte 97
+  .byte 33
+  .byte 98
+  .byte 32
+  .byte 96
+  .byte 34
+  .byte 34
+  .byte 99
+  .zero 1
+.align 1
+.L.data.765:
+  .byte 77
+  .byte 49
+  .byte 49
+  .byte 40
+  .byte 32
+  .byte 97
+  .byte 33
+  .byte 98
+  .byte 32
+  .byte 32
+  .byte 96
+  .byte 34
+  .byte 34
+  .byte 99
+  .byte 41
+  .byte 91
+  .byte 55
+  .byte 93
+  .zero 1
+.align 1
+.L.data.764:
+  .byte 97
+  .byte 33
+  .byte 98
+  .byte 32
+  .byte 96
+  .byte 34
+  .byte 34
+  .byte 99
+  .zero 1
+.align 1
+.L.data.763:
+  .byte 77
+  .byte 49
+  .byte 49
+  .byte 40
+  .byte 32
+  .byte 97
+  .byte 33
+  .byte 98
+  .byte 32
+  .byte 32
+  .byte 96
+  .byte 34
+  .byte 34
+  .byte 99
+  .byte 41
+  .byte 91
+  .byte 54
+  .byte 93
+  .zero 1
+.align 1
+.L.data.762:
+  .byte 97
+  .byte 33
+  .byte 98
+  .byte 32
+  .byte 96
+  .byte 34
+  .byte 34
+  .byte 99
+  .zero 1
+.align 1
+.L.data.761:
+  .byte 77
+  .byte 49
+  .byte 49
+  .byte 40
+  .byte 32
+  .byte 97
+  .byte 33
+  .byte 98
+  .byte 32
+  .byte 32
+  .byte 96
+  .byte 34
+  .byte 34
+  .byte 99
+  .byte 41
+  .byte 91
+  .byte 53
+  .byte 93
+  .zero 1
+.align 1
+.L.data.760:
+  .byte 97
+  .byte 33
+  .byte 98
+  .byte 32
+  .byte 96
+  .byte 34
+  .byte 34
+  .byte 99
+  .zero 1
+.align 1
+.L.data.759:
+  .byte 77
+  .byte 49
+  .byte 49
+  .byte 40
+  .byte 32
+  .byte 97
+  .byte 33
+  .byte 98
+  .byte 32
+  .byte 32
+  .byte 96
+  .byte 34
+  .byte 34
+  .byte 99
+  .byte 41
+  .byte 91
+  .byte 52
+  .byte 93
+  .zero 1
+.align 1
+.L.data.758:
+  .byte 97
+  .byte 33
+  .byte 98
+  .byte 32
+  .byte 96
+  .byte 34
+  .byte 34
+  .byte 99
+  .zero 1
+.align 1
+.L.data.757:
+  .byte 77
+  .byte 49
+  .byte 49
+  .byte 40
+  .byte 32
+  .byte 97
+  .byte 33
+  .byte 98
+  .byte 32
+  .byte 32
+  .byte 96
+  .byte 34
+  .byte 34
+  .byte 99
+  .byte 41
+  .byte 91
+  .byte 51
+  .byte 93
+  .zero 1
+.align 1
+.L.data.756:
+  .byte 97
+  .byte 33
+  .byte 98
+  .byte 32
+  .byte 96
+  .byte 34
+  .byte 34
+  .byte 99
+  .zero 1
+.align 1
+.L.data.755:
+  .byte 77
+  .byte 49
+  .byte 49
+  .byte 40
+  .byte 32
+  .byte 97
+  .byte 33
+  .byte 98
+  .byte 32
+  .byte 32
+  .byte 96
+  .byte 34
+  .byte 34
+  .byte 99
+  .byte 41
+  .byte 91
+  .byte 50
+  .byte 93
+  .zero 1
+.align 1
+.L.data.754:
+  .byte 97
+  .byte 33
+  .byte 98
+  .byte 32
+  .byte 96
+  .byte 34
+  .byte 34
+  .byte 99
+  .zero 1
+.align 1
+.L.data.753:
+  .byte 77
+  .byte 49
+  .byte 49
+  .byte 40
+  .byte 32
+  .byte 97
+  .byte 33
+  .byte 98
+  .byte 32
+  .byte 32
+  .byte 96
+  .byte 34
+  .byte 34
+  .byte 99
+  .byte 41
+  .byte 91
+  .byte 49
+  .byte 93
+  .zero 1
+.align 1
+.L.data.752:
+  .byte 97
+  .byte 33
+  .byte 98
+  .byte 32
+  .byte 96
+  .byte 34
+  .byte 34
+  .byte 99
+  .zero 1
+.align 1
+.L.data.751:
+  .byte 77
+  .byte 49
+  .byte 49
+  .byte 40
+  .byte 32
+  .byte 97
+  .byte 33
+  .byte 98
+  .byte 32
+  .byte 32
+  .byte 96
+  .byte 34
+  .byte 34
+  .byte 99
+  .byte 41
+  .byte 91
+  .byte 48
+  .byte 93
+  .zero 1
+.align 1
+.L.data.750:
+  .byte 97
+  .byte 33
+  .byte 98
+  .byte 32
+  .byte 96
+  .byte 34
+  .byte 34
+  .byte 99
+  .zero 1
+.align 1
+.L.data.749:
+  .byte 77
+  .byte 57
+  .byte 40
+  .byte 50
+  .byte 41
+  .zero 1
+.align 1
+.L.data.748:
+  .byte 77
+  .byte 56
+  .byte 40
+  .byte 40
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 41
+  .zero 1
+.align 1
+.L.data.747:
+  .byte 77
+  .byte 56
+  .byte 40
+  .byte 40
+  .byte 50
+  .byte 43
+  .byte 51
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 41
+  .zero 1
+.align 1
+.L.data.746:
+  .byte 77
+  .byte 56
+  .byte 40
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 43
+  .byte 53
+  .byte 41
+  .zero 1
+.align 1
+.L.data.745:
+  .byte 77
+  .byte 56
+  .byte 40
+  .byte 51
+  .byte 43
+  .byte 52
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 43
+  .byte 53
+  .byte 41
+  .zero 1
+.align 1
+.L.data.744:
+  .byte 77
+  .byte 56
+  .byte 40
+  .byte 51
+  .byte 43
+  .byte 52
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 43
+  .byte 53
+  .byte 41
+  .zero 1
+.align 1
+.L.data.743:
+  .byte 77
+  .byte 56
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 41
+  .zero 1
+.align 1
+.L.data.742:
+  .byte 114
+  .byte 101
+  .byte 116
+  .byte 51
+  .byte 32
+  .byte 77
+  .byte 55
+  .zero 1
+.align 1
+.L.data.741:
+  .byte 77
+  .byte 55
+  .zero 1
+.align 1
+.L.data.740:
+  .byte 77
+  .byte 55
+  .byte 40
+  .byte 41
+  .zero 1
+.align 1
+.L.data.739:
+  .byte 53
+  .zero 1
+.align 1
+.L.data.738:
+  .byte 51
+  .zero 1
+.align 1
+.L.data.737:
+  .byte 53
+  .zero 1
+.align 1
+.L.data.736:
+  .byte 51
+  .zero 1
+.align 1
+.L.data.735:
+  .byte 77
+  .byte 52
+  .zero 1
+.align 1
+.L.data.734:
+  .byte 77
+  .byte 51
+  .zero 1
+.align 1
+.L.data.733:
+  .byte 77
+  .byte 50
+  .zero 1
+.align 1
+.L.data.732:
+  .byte 53
+  .zero 1
+.align 1
+.L.data.731:
+  .byte 53
+  .zero 1
+.align 1
+.L.data.730:
+  .byte 53
+  .zero 1
+.align 1
+.L.data.729:
+  .byte 77
+  .byte 49
+  .byte 42
+  .byte 53
+  .zero 1
+.align 1
+.L.data.728:
+  .byte 77
+  .byte 49
+  .byte 32
+  .byte 53
+  .zero 1
+.align 1
+.L.data.727:
+  .byte 77
+  .byte 49
+  .zero 1
+.align 1
+.L.data.726:
+  .byte 77
+  .byte 49
+  .zero 1
+.align 1
+.L.data.725:
+  .byte 77
+  .byte 49
+  .zero 1
+.align 1
+.L.data.724:
+  .byte 49
+  .zero 1
+.align 1
+.L.data.723:
+  .byte 51
+  .zero 1
+.align 1
+.L.data.722:
+  .byte 50
+  .zero 1
+.align 1
+.L.data.721:
+  .byte 51
+  .zero 1
+.align 1
+.L.data.720:
+  .byte 49
+  .byte 43
+  .byte 50
+  .zero 1
+.align 1
+.L.data.719:
+  .byte 49
+  .byte 43
+  .byte 50
+  .zero 1
+.align 1
+.L.data.718:
+  .byte 48
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 32
+  .byte 42
+  .byte 32
+  .byte 49
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 50
+  .byte 32
+  .byte 42
+  .byte 32
+  .byte 49
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 46
+  .byte 46
+  .byte 46
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 50
+  .byte 48
+  .byte 32
+  .byte 42
+  .byte 32
+  .byte 49
+  .zero 1
+.align 1
+.L.data.717:
+  .byte 48
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 46
+  .byte 46
+  .byte 46
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .zero 1
+.align 1
+.L.data.716:
+  .byte 48
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 50
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 46
+  .byte 46
+  .byte 46
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 50
+  .byte 48
+  .zero 1
+.align 1
+.L.data.715:
+  .byte 73
+  .byte 78
+  .byte 67
+  .byte 76
+  .byte 85
+  .byte 68
+  .byte 69
+  .byte 53
+  .byte 95
+  .byte 83
+  .byte 69
+  .byte 69
+  .byte 78
+  .zero 1
+.align 1
+.L.data.714:
+  .byte 73
+  .byte 78
+  .byte 67
+  .byte 76
+  .byte 85
+  .byte 68
+  .byte 69
+  .byte 52
+  .byte 95
+  .byte 83
+  .byte 69
+  .byte 69
+  .byte 78
+  .zero 1
+.align 1
+.L.data.713:
+  .byte 73
+  .byte 78
+  .byte 67
+  .byte 76
+  .byte 85
+  .byte 68
+  .byte 69
+  .byte 51
+  .byte 95
+  .byte 83
+  .byte 69
+  .byte 69
+  .byte 78
+  .zero 1
+.align 1
+.L.data.712:
+  .byte 73
+  .byte 78
+  .byte 67
+  .byte 76
+  .byte 85
+  .byte 68
+  .byte 69
+  .byte 51
+  .byte 95
+  .byte 83
+  .byte 69
+  .byte 69
+  .byte 78
+  .zero 1
+.align 1
+.L.data.711:
+  .byte 105
+  .byte 110
+  .byte 99
+  .byte 108
+  .byte 117
+  .byte 100
+  .byte 101
+  .byte 50
+  .zero 1
+.align 1
+.L.data.710:
+  .byte 105
+  .byte 110
+  .byte 99
+  .byte 108
+  .byte 117
+  .byte 100
+  .byte 101
+  .byte 49
+  .zero 1
+.align 1
+.L.data.709:
+  .byte 40
+  .byte 42
+  .byte 42
+  .byte 42
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 41
+  .byte 40
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 41
+  .zero 1
+.align 1
+.L.data.708:
+  .byte 102
+  .byte 110
+  .byte 112
+  .byte 116
+  .byte 114
+  .byte 40
+  .byte 41
+  .byte 40
+  .byte 41
+  .zero 1
+.align 1
+.L.data.707:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 102
+  .byte 110
+  .byte 41
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 44
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 110
+  .byte 40
+  .byte 50
+  .byte 44
+  .byte 53
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.706:
+  .byte 40
+  .byte 38
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 41
+  .byte 40
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 41
+  .zero 1
+.align 1
+.L.data.705:
+  .byte 40
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 41
+  .byte 40
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 41
+  .zero 1
+.align 1
+.L.data.704:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 115
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 115
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 115
+  .byte 116
+  .byte 41
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.703:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 115
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 115
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.702:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 115
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.701:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 40
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 41
+  .byte 49
+  .byte 60
+  .byte 61
+  .byte 45
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.700:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 40
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 41
+  .byte 49
+  .byte 60
+  .byte 45
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.699:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 40
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 47
+  .byte 40
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 49
+  .byte 60
+  .byte 60
+  .byte 54
+  .byte 50
+  .byte 41
+  .byte 43
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.698:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 47
+  .byte 40
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 49
+  .byte 60
+  .byte 60
+  .byte 54
+  .byte 50
+  .byte 41
+  .byte 43
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.697:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 40
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 48
+  .byte 120
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 62
+  .byte 62
+  .byte 51
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.696:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 40
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 48
+  .byte 120
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 56
+  .byte 48
+  .byte 48
+  .byte 102
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.695:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 40
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 48
+  .byte 120
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.694:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 62
+  .byte 62
+  .byte 51
+  .byte 49
+  .byte 41
+  .byte 43
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.693:
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 32
+  .byte 60
+  .byte 60
+  .byte 32
+  .byte 54
+  .byte 51
+  .byte 32
+  .byte 62
+  .byte 62
+  .byte 32
+  .byte 54
+  .byte 51
+  .zero 1
+.align 1
+.L.data.692:
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 32
+  .byte 60
+  .byte 60
+  .byte 32
+  .byte 51
+  .byte 49
+  .byte 32
+  .byte 62
+  .byte 62
+  .byte 32
+  .byte 51
+  .byte 49
+  .zero 1
+.align 1
+.L.data.691:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 32
+  .byte 60
+  .byte 60
+  .byte 32
+  .byte 54
+  .byte 51
+  .byte 32
+  .byte 62
+  .byte 62
+  .byte 32
+  .byte 54
+  .byte 51
+  .zero 1
+.align 1
+.L.data.690:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 32
+  .byte 60
+  .byte 60
+  .byte 32
+  .byte 51
+  .byte 49
+  .byte 32
+  .byte 62
+  .byte 62
+  .byte 32
+  .byte 51
+  .byte 49
+  .zero 1
+.align 1
+.L.data.689:
+  .byte 48
+  .byte 120
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 62
+  .byte 62
+  .byte 54
+  .byte 51
+  .zero 1
+.align 1
+.L.data.688:
+  .byte 45
+  .byte 49
+  .byte 117
+  .byte 108
+  .byte 108
+  .byte 62
+  .byte 62
+  .byte 54
+  .byte 50
+  .zero 1
+.align 1
+.L.data.687:
+  .byte 45
+  .byte 49
+  .byte 85
+  .byte 108
+  .byte 62
+  .byte 62
+  .byte 54
+  .byte 50
+  .zero 1
+.align 1
+.L.data.686:
+  .byte 45
+  .byte 49
+  .byte 85
+  .byte 62
+  .byte 62
+  .byte 51
+  .byte 48
+  .zero 1
+.align 1
+.L.data.685:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 120
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 41
+  .zero 1
+.align 1
+.L.data.684:
+  .byte 48
+  .byte 120
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .zero 1
+.align 1
+.L.data.683:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 56
+  .byte 41
+  .zero 1
+.align 1
+.L.data.682:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 55
+  .byte 41
+  .zero 1
+.align 1
+.L.data.681:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 98
+  .byte 48
+  .byte 76
+  .byte 41
+  .zero 1
+.align 1
+.L.data.680:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 120
+  .byte 48
+  .byte 76
+  .byte 41
+  .zero 1
+.align 1
+.L.data.679:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 108
+  .byte 108
+  .byte 41
+  .zero 1
+.align 1
+.L.data.678:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 108
+  .byte 41
+  .zero 1
+.align 1
+.L.data.677:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 85
+  .byte 108
+  .byte 108
+  .byte 41
+  .zero 1
+.align 1
+.L.data.676:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 76
+  .byte 76
+  .byte 85
+  .byte 41
+  .zero 1
+.align 1
+.L.data.675:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 76
+  .byte 76
+  .byte 41
+  .zero 1
+.align 1
+.L.data.674:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 85
+  .byte 76
+  .byte 41
+  .zero 1
+.align 1
+.L.data.673:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 76
+  .byte 85
+  .byte 41
+  .zero 1
+.align 1
+.L.data.672:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 76
+  .byte 41
+  .zero 1
+.align 1
+.L.data.671:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 41
+  .zero 1
+.align 1
+.L.data.670:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 59
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 54
+  .byte 53
+  .byte 53
+  .byte 51
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.669:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 59
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 54
+  .byte 53
+  .byte 53
+  .byte 51
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.668:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 54
+  .byte 53
+  .byte 53
+  .byte 51
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.667:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 54
+  .byte 53
+  .byte 53
+  .byte 51
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.666:
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 40
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 54
+  .byte 53
+  .byte 53
+  .byte 51
+  .byte 53
+  .zero 1
+.align 1
+.L.data.665:
+  .byte 40
+  .byte 40
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 37
+  .byte 57
+  .zero 1
+.align 1
+.L.data.664:
+  .byte 40
+  .byte 40
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 37
+  .byte 55
+  .zero 1
+.align 1
+.L.data.663:
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 37
+  .byte 55
+  .zero 1
+.align 1
+.L.data.662:
+  .byte 40
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 47
+  .byte 40
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 41
+  .byte 49
+  .byte 48
+  .byte 48
+  .zero 1
+.align 1
+.L.data.661:
+  .byte 40
+  .byte 40
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 47
+  .byte 50
+  .zero 1
+.align 1
+.L.data.660:
+  .byte 40
+  .byte 40
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 47
+  .byte 50
+  .zero 1
+.align 1
+.L.data.659:
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 47
+  .byte 50
+  .zero 1
+.align 1
+.L.data.658:
+  .byte 40
+  .byte 40
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 62
+  .byte 62
+  .byte 49
+  .zero 1
+.align 1
+.L.data.657:
+  .byte 40
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .zero 1
+.align 1
+.L.data.656:
+  .byte 45
+  .byte 49
+  .byte 62
+  .byte 62
+  .byte 49
+  .zero 1
+.align 1
+.L.data.655:
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 51
+  .byte 50
+  .byte 55
+  .byte 54
+  .byte 55
+  .byte 43
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 51
+  .byte 50
+  .byte 55
+  .byte 54
+  .byte 55
+  .zero 1
+.align 1
+.L.data.654:
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 49
+  .byte 50
+  .byte 55
+  .byte 43
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 49
+  .byte 50
+  .byte 55
+  .zero 1
+.align 1
+.L.data.653:
+  .byte 45
+  .byte 49
+  .byte 60
+  .byte 40
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 41
+  .byte 49
+  .zero 1
+.align 1
+.L.data.652:
+  .byte 45
+  .byte 49
+  .byte 60
+  .byte 49
+  .zero 1
+.align 1
+.L.data.651:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 49
+  .byte 63
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 50
+  .byte 58
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 51
+  .byte 41
+  .zero 1
+.align 1
+.L.data.650:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 49
+  .byte 63
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 50
+  .byte 58
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 51
+  .byte 41
+  .zero 1
+.align 1
+.L.data.649:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 49
+  .byte 63
+  .byte 50
+  .byte 58
+  .byte 51
+  .byte 41
+  .zero 1
+.align 1
+.L.data.648:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 49
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 49
+  .byte 41
+  .zero 1
+.align 1
+.L.data.647:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 49
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 49
+  .byte 41
+  .zero 1
+.align 1
+.L.data.646:
+  .byte 40
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 41
+  .byte 48
+  .byte 120
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .zero 1
+.align 1
+.L.data.645:
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 48
+  .byte 120
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .zero 1
+.align 1
+.L.data.644:
+  .byte 40
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 54
+  .byte 53
+  .byte 53
+  .byte 51
+  .byte 53
+  .zero 1
+.align 1
+.L.data.643:
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 54
+  .byte 53
+  .byte 53
+  .byte 51
+  .byte 53
+  .zero 1
+.align 1
+.L.data.642:
+  .byte 40
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 50
+  .byte 53
+  .byte 53
+  .zero 1
+.align 1
+.L.data.641:
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 50
+  .byte 53
+  .byte 53
+  .zero 1
+.align 1
+.L.data.640:
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 50
+  .byte 53
+  .byte 53
+  .zero 1
+.align 1
+.L.data.639:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 49
+  .byte 41
+  .zero 1
+.align 1
+.L.data.638:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 49
+  .byte 41
+  .zero 1
+.align 1
+.L.data.637:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 49
+  .byte 41
+  .zero 1
+.align 1
+.L.data.636:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 49
+  .byte 41
+  .zero 1
+.align 1
+.L.data.635:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .zero 1
+.align 1
+.L.data.634:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .zero 1
+.align 1
+.L.data.633:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .zero 1
+.align 1
+.L.data.632:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .zero 1
+.align 1
+.L.data.631:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .zero 1
+.align 1
+.L.data.630:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .zero 1
+.align 1
+.L.data.629:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .zero 1
+.align 1
+.L.data.628:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .zero 1
+.align 1
+.L.data.627:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .zero 1
+.align 1
+.L.data.626:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .zero 1
+.align 1
+.L.data.625:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 41
+  .zero 1
+.align 1
+.L.data.624:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 41
+  .zero 1
+.align 1
+.L.data.623:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .zero 1
+.align 1
+.L.data.622:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 41
+  .zero 1
+.align 1
+.L.data.621:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 41
+  .zero 1
+.align 1
+.L.data.620:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .zero 1
+.align 1
+.L.data.619:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .zero 1
+.align 1
+.L.data.618:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 41
+  .zero 1
+.align 1
+.L.data.617:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .zero 1
+.align 1
+.L.data.616:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 41
+  .zero 1
+.align 1
+.L.data.615:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .zero 1
+.align 1
+.L.data.614:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .zero 1
+.align 1
+.L.data.613:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .zero 1
+.align 1
+.L.data.612:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .zero 1
+.align 1
+.L.data.611:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 41
+  .zero 1
+.align 1
+.L.data.610:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .zero 1
+.align 1
+.L.data.609:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 41
+  .zero 1
+.align 1
+.L.data.608:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .zero 1
+.align 1
+.L.data.607:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .zero 1
+.align 1
+.L.data.606:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 117
+  .byte 102
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 109
+  .byte 116
+  .byte 40
+  .byte 98
+  .byte 117
+  .byte 102
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 34
+  .byte 49
+  .byte 32
+  .byte 50
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 117
+  .byte 102
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.605:
+  .byte 49
+  .byte 32
+  .byte 50
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .zero 1
+.align 1
+.L.data.604:
+  .byte 102
+  .byte 111
+  .byte 111
+  .zero 1
+.align 1
+.L.data.603:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.602:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 117
+  .byte 102
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 112
+  .byte 114
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 102
+  .byte 40
+  .byte 98
+  .byte 117
+  .byte 102
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 34
+  .byte 49
+  .byte 32
+  .byte 50
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 117
+  .byte 102
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.601:
+  .byte 49
+  .byte 32
+  .byte 50
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .zero 1
+.align 1
+.L.data.600:
+  .byte 102
+  .byte 111
+  .byte 111
+  .zero 1
+.align 1
+.L.data.599:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.598:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 95
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 51
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 45
+  .byte 49
+  .byte 44
+  .byte 48
+  .byte 41
+  .zero 1
+.align 1
+.L.data.597:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 95
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 51
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 48
+  .byte 41
+  .zero 1
+.align 1
+.L.data.596:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 95
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 49
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 45
+  .byte 49
+  .byte 44
+  .byte 48
+  .byte 41
+  .zero 1
+.align 1
+.L.data.595:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 95
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 49
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 48
+  .byte 41
+  .zero 1
+.align 1
+.L.data.594:
+  .byte 102
+  .byte 97
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 40
+  .byte 41
+  .zero 1
+.align 1
+.L.data.593:
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 101
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 40
+  .byte 41
+  .zero 1
+.align 1
+.L.data.592:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 107
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 111
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 43
+  .byte 43
+  .byte 106
+  .byte 32
+  .byte 62
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 107
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.591:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 111
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 54
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.590:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 94
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.589:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 124
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.588:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 38
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.587:
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 51
+  .zero 1
+.align 1
+.L.data.586:
+  .byte 116
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 45
+  .byte 62
+  .byte 108
+  .byte 104
+  .byte 115
+  .byte 45
+  .byte 62
+  .byte 114
+  .byte 104
+  .byte 115
+  .byte 45
+  .byte 62
+  .byte 118
+  .byte 97
+  .byte 108
+  .zero 1
+.align 1
+.L.data.585:
+  .byte 116
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 45
+  .byte 62
+  .byte 108
+  .byte 104
+  .byte 115
+  .byte 45
+  .byte 62
+  .byte 108
+  .byte 104
+  .byte 115
+  .byte 45
+  .byte 62
+  .byte 118
+  .byte 97
+  .byte 108
+  .zero 1
+.align 1
+.L.data.584:
+  .byte 116
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 45
+  .byte 62
+  .byte 108
+  .byte 104
+  .byte 115
+  .byte 45
+  .byte 62
+  .byte 118
+  .byte 97
+  .byte 108
+  .zero 1
+.align 1
+.L.data.583:
+  .byte 116
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 45
+  .byte 62
+  .byte 118
+  .byte 97
+  .byte 108
+  .zero 1
+.align 1
+.L.data.581:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 123
+  .byte 120
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.579:
+  .byte 40
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 41
+  .byte 123
+  .byte 39
+  .byte 97
+  .byte 39
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 125
+  .byte 41
+  .byte 46
+  .byte 97
+  .zero 1
+.align 1
+.L.data.577:
+  .byte 40
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 91
+  .byte 93
+  .byte 41
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 41
+  .byte 91
+  .byte 50
+  .byte 93
+  .zero 1
+.align 1
+.L.data.575:
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 123
+  .byte 49
+  .byte 125
+  .zero 1
+.align 1
+.L.data.573:
+  .byte 99
+  .byte 111
+  .byte 117
+  .byte 110
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 40
+  .byte 41
+  .zero 1
+.align 1
+.L.data.572:
+  .byte 99
+  .byte 111
+  .byte 117
+  .byte 110
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 40
+  .byte 41
+  .zero 1
+.align 1
+.L.data.571:
+  .byte 99
+  .byte 111
+  .byte 117
+  .byte 110
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 40
+  .byte 41
+  .zero 1
+.align 1
+.L.data.570:
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 38
+  .byte 103
+  .byte 95
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 50
+  .byte 32
+  .byte 37
+  .byte 32
+  .byte 53
+  .byte 49
+  .byte 50
+  .zero 1
+.align 1
+.L.data.569:
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 38
+  .byte 103
+  .byte 95
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 49
+  .byte 32
+  .byte 37
+  .byte 32
+  .byte 53
+  .byte 49
+  .byte 50
+  .zero 1
+.align 1
+.L.data.568:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 97
+  .byte 115
+  .byte 40
+  .byte 56
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.567:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 97
+  .byte 115
+  .byte 40
+  .byte 49
+  .byte 54
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 38
+  .byte 97
+  .byte 46
+  .byte 121
+  .byte 45
+  .byte 38
+  .byte 97
+  .byte 46
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.566:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 97
+  .byte 115
+  .byte 40
+  .byte 51
+  .byte 50
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 38
+  .byte 121
+  .byte 41
+  .byte 45
+  .byte 40
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 38
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.565:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 97
+  .byte 115
+  .byte 40
+  .byte 51
+  .byte 50
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 38
+  .byte 121
+  .byte 45
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.564:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 97
+  .byte 115
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 38
+  .byte 121
+  .byte 45
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.563:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 97
+  .byte 115
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 38
+  .byte 121
+  .byte 45
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.562:
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 41
+  .zero 1
+.align 1
+.L.data.561:
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 41
+  .zero 1
+.align 1
+.L.data.560:
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 41
+  .zero 1
+.align 1
+.L.data.559:
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 41
+  .zero 1
+.align 1
+.L.data.558:
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .zero 1
+.align 1
+.L.data.557:
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .zero 1
+.align 1
+.L.data.556:
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .zero 1
+.align 1
+.L.data.555:
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .zero 1
+.align 1
+.L.data.554:
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .zero 1
+.align 1
+.L.data.553:
+  .byte 42
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 50
+  .zero 1
+.align 1
+.L.data.552:
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 49
+  .zero 1
+.align 1
+.L.data.551:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 51
+  .byte 52
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 41
+  .zero 1
+.align 1
+.L.data.550:
+  .byte 102
+  .byte 111
+  .byte 111
+  .zero 1
+.align 1
+.L.data.549:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 51
+  .byte 51
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .zero 1
+.align 1
+.L.data.548:
+  .byte 98
+  .byte 97
+  .byte 114
+  .zero 1
+.align 1
+.L.data.547:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 51
+  .byte 51
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 41
+  .zero 1
+.align 1
+.L.data.546:
+  .byte 102
+  .byte 111
+  .byte 111
+  .zero 1
+.align 1
+.L.data.545:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.544:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.543:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.542:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.541:
+  .byte 103
+  .byte 51
+  .byte 49
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .zero 1
+.align 1
+.L.data.540:
+  .byte 103
+  .byte 51
+  .byte 49
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .zero 1
+.align 1
+.L.data.539:
+  .byte 103
+  .byte 51
+  .byte 49
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .zero 1
+.align 1
+.L.data.538:
+  .byte 103
+  .byte 51
+  .byte 49
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .zero 1
+.align 1
+.L.data.537:
+  .byte 103
+  .byte 51
+  .byte 48
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .zero 1
+.align 1
+.L.data.536:
+  .byte 103
+  .byte 51
+  .byte 48
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .zero 1
+.align 1
+.L.data.535:
+  .byte 103
+  .byte 51
+  .byte 48
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .zero 1
+.align 1
+.L.data.534:
+  .byte 103
+  .byte 51
+  .byte 48
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .zero 1
+.align 1
+.L.data.533:
+  .byte 42
+  .byte 103
+  .byte 50
+  .byte 55
+  .zero 1
+.align 1
+.L.data.532:
+  .byte 42
+  .byte 103
+  .byte 50
+  .byte 53
+  .zero 1
+.align 1
+.L.data.531:
+  .byte 103
+  .byte 50
+  .byte 52
+  .zero 1
+.align 1
+.L.data.530:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 51
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 43
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .zero 1
+.align 1
+.L.data.529:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .zero 1
+.align 1
+.L.data.528:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 51
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .zero 1
+.align 1
+.L.data.527:
+  .byte 98
+  .byte 97
+  .byte 114
+  .zero 1
+.align 1
+.L.data.526:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 51
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .zero 1
+.align 1
+.L.data.525:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .zero 1
+.align 1
+.L.data.524:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 50
+  .byte 43
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .zero 1
+.align 1
+.L.data.523:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .zero 1
+.align 1
+.L.data.522:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .zero 1
+.align 1
+.L.data.521:
+  .byte 98
+  .byte 97
+  .byte 114
+  .zero 1
+.align 1
+.L.data.520:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .zero 1
+.align 1
+.L.data.519:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .zero 1
+.align 1
+.L.data.518:
+  .byte 109
+  .byte 101
+  .byte 109
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 57
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .zero 1
+.align 1
+.L.data.517:
+  .byte 102
+  .byte 111
+  .byte 111
+  .zero 1
+.align 1
+.L.data.516:
+  .byte 109
+  .byte 101
+  .byte 109
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 56
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 92
+  .byte 48
+  .byte 92
+  .byte 48
+  .byte 92
+  .byte 48
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 48
+  .byte 41
+  .zero 1
+.align 1
+.L.data.515:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+  .byte 0
+  .byte 0
+  .zero 1
+.align 1
+.L.data.514:
+  .byte 109
+  .byte 101
+  .byte 109
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 55
+  .byte 41
+  .zero 1
+.align 1
+.L.data.513:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .zero 1
+.align 1
+.L.data.512:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 57
+  .byte 41
+  .zero 1
+.align 1
+.L.data.511:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 56
+  .byte 41
+  .zero 1
+.align 1
+.L.data.510:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 55
+  .byte 41
+  .zero 1
+.align 1
+.L.data.509:
+  .byte 103
+  .byte 49
+  .byte 50
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .zero 1
+.align 1
+.L.data.508:
+  .byte 103
+  .byte 49
+  .byte 50
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .zero 1
+.align 1
+.L.data.507:
+  .byte 103
+  .byte 49
+  .byte 50
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .zero 1
+.align 1
+.L.data.506:
+  .byte 103
+  .byte 49
+  .byte 50
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .zero 1
+.align 1
+.L.data.505:
+  .byte 103
+  .byte 49
+  .byte 49
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 98
+  .zero 1
+.align 1
+.L.data.504:
+  .byte 103
+  .byte 49
+  .byte 49
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .zero 1
+.align 1
+.L.data.503:
+  .byte 103
+  .byte 49
+  .byte 49
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 98
+  .zero 1
+.align 1
+.L.data.502:
+  .byte 103
+  .byte 49
+  .byte 49
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .zero 1
+.align 1
+.L.data.501:
+  .byte 103
+  .byte 57
+  .byte 91
+  .byte 50
+  .byte 93
+  .zero 1
+.align 1
+.L.data.500:
+  .byte 103
+  .byte 57
+  .byte 91
+  .byte 49
+  .byte 93
+  .zero 1
+.align 1
+.L.data.499:
+  .byte 103
+  .byte 57
+  .byte 91
+  .byte 48
+  .byte 93
+  .zero 1
+.align 1
+.L.data.498:
+  .byte 103
+  .byte 54
+  .zero 1
+.align 1
+.L.data.497:
+  .byte 103
+  .byte 53
+  .zero 1
+.align 1
+.L.data.496:
+  .byte 103
+  .byte 52
+  .zero 1
+.align 1
+.L.data.495:
+  .byte 103
+  .byte 51
+  .zero 1
+.align 1
+.L.data.494:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 44
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 84
+  .byte 59
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 121
+  .byte 44
+  .byte 32
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 122
+  .byte 61
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 122
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.493:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 44
+  .byte 98
+  .byte 44
+  .byte 99
+  .byte 44
+  .byte 100
+  .byte 44
+  .byte 101
+  .byte 44
+  .byte 102
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 84
+  .byte 59
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 46
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.492:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 44
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 84
+  .byte 59
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.491:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.490:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.489:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.488:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.487:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.486:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.485:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.484:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.483:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.482:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.481:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.480:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.479:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.478:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.477:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.476:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.475:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 44
+  .byte 34
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 34
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.474:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 44
+  .byte 34
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 34
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.473:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 44
+  .byte 34
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 34
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.472:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 44
+  .byte 34
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 34
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.471:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.470:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.469:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.468:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.467:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.466:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.465:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.464:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.463:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.462:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.461:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.460:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.459:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.458:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.457:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.456:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.455:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 42
+  .byte 41
+  .byte 49
+  .byte 54
+  .byte 45
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 42
+  .byte 41
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.454:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 42
+  .byte 41
+  .byte 49
+  .byte 54
+  .byte 45
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.453:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 42
+  .byte 41
+  .byte 48
+  .byte 43
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.452:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 48
+  .byte 120
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 43
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.451:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 48
+  .byte 120
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 48
+  .byte 49
+  .byte 48
+  .byte 102
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.450:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 48
+  .byte 120
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 48
+  .byte 102
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.449:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.448:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 40
+  .byte 49
+  .byte 38
+  .byte 38
+  .byte 48
+  .byte 41
+  .byte 43
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.447:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 40
+  .byte 49
+  .byte 38
+  .byte 38
+  .byte 49
+  .byte 41
+  .byte 43
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.446:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 40
+  .byte 48
+  .byte 124
+  .byte 124
+  .byte 48
+  .byte 41
+  .byte 43
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.445:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 40
+  .byte 53
+  .byte 124
+  .byte 124
+  .byte 54
+  .byte 41
+  .byte 43
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.444:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 126
+  .byte 45
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.443:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 33
+  .byte 49
+  .byte 43
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.442:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 33
+  .byte 48
+  .byte 43
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.441:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 51
+  .byte 41
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.440:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 63
+  .byte 50
+  .byte 58
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.439:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 63
+  .byte 50
+  .byte 58
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.438:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 40
+  .byte 49
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 41
+  .byte 43
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.437:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 40
+  .byte 49
+  .byte 60
+  .byte 49
+  .byte 41
+  .byte 43
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.436:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 40
+  .byte 49
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 41
+  .byte 43
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.435:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 40
+  .byte 49
+  .byte 61
+  .byte 61
+  .byte 49
+  .byte 41
+  .byte 43
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.434:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 62
+  .byte 62
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.433:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 60
+  .byte 60
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.432:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 94
+  .byte 48
+  .byte 98
+  .byte 48
+  .byte 48
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.431:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 49
+  .byte 48
+  .byte 124
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 48
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.430:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 49
+  .byte 48
+  .byte 38
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 48
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.429:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 50
+  .byte 47
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.428:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 42
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.427:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 56
+  .byte 45
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.426:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 43
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.425:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 53
+  .byte 45
+  .byte 50
+  .byte 43
+  .byte 48
+  .byte 42
+  .byte 51
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.424:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 101
+  .byte 110
+  .byte 61
+  .byte 49
+  .byte 43
+  .byte 50
+  .byte 43
+  .byte 51
+  .byte 43
+  .byte 52
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 101
+  .byte 110
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.423:
+  .byte 49
+  .byte 63
+  .byte 45
+  .byte 50
+  .byte 58
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .zero 1
+.align 1
+.L.data.422:
+  .byte 49
+  .byte 63
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 50
+  .byte 58
+  .byte 45
+  .byte 49
+  .zero 1
+.align 1
+.L.data.421:
+  .byte 48
+  .byte 63
+  .byte 45
+  .byte 50
+  .byte 58
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .zero 1
+.align 1
+.L.data.420:
+  .byte 48
+  .byte 63
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 50
+  .byte 58
+  .byte 45
+  .byte 49
+  .zero 1
+.align 1
+.L.data.419:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 63
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 49
+  .byte 58
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 50
+  .byte 41
+  .zero 1
+.align 1
+.L.data.418:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 63
+  .byte 49
+  .byte 58
+  .byte 50
+  .byte 41
+  .zero 1
+.align 1
+.L.data.417:
+  .byte 49
+  .byte 63
+  .byte 45
+  .byte 50
+  .byte 58
+  .byte 45
+  .byte 49
+  .zero 1
+.align 1
+.L.data.416:
+  .byte 48
+  .byte 63
+  .byte 45
+  .byte 50
+  .byte 58
+  .byte 45
+  .byte 49
+  .zero 1
+.align 1
+.L.data.415:
+  .byte 49
+  .byte 63
+  .byte 49
+  .byte 58
+  .byte 50
+  .zero 1
+.align 1
+.L.data.414:
+  .byte 48
+  .byte 63
+  .byte 49
+  .byte 58
+  .byte 50
+  .zero 1
+.align 1
+.L.data.413:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 45
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 62
+  .byte 62
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.412:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 45
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.411:
+  .byte 45
+  .byte 49
+  .zero 1
+.align 1
+.L.data.410:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 62
+  .byte 62
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.409:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.408:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 60
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.407:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 60
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.406:
+  .byte 45
+  .byte 49
+  .byte 62
+  .byte 62
+  .byte 49
+  .zero 1
+.align 1
+.L.data.405:
+  .byte 53
+  .byte 62
+  .byte 62
+  .byte 49
+  .zero 1
+.align 1
+.L.data.404:
+  .byte 53
+  .byte 60
+  .byte 60
+  .byte 49
+  .zero 1
+.align 1
+.L.data.403:
+  .byte 49
+  .byte 60
+  .byte 60
+  .byte 51
+  .zero 1
+.align 1
+.L.data.402:
+  .byte 49
+  .byte 60
+  .byte 60
+  .byte 48
+  .zero 1
+.align 1
+.L.data.401:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.400:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.399:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 97
+  .byte 117
+  .byte 108
+  .byte 116
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.398:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 97
+  .byte 117
+  .byte 108
+  .byte 116
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.397:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.396:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 50
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.395:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.394:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.393:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 104
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.392:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 32
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.391:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.390:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 33
+  .byte 105
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.389:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.388:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.387:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 40
+  .byte 59
+  .byte 33
+  .byte 105
+  .byte 59
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 59
+  .byte 106
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.386:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 59
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.385:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 59
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.384:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.383:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 40
+  .byte 59
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 59
+  .byte 59
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.382:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.381:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 40
+  .byte 59
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.380:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 84
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 84
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.379:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 42
+  .byte 110
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 46
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 46
+  .byte 110
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 61
+  .byte 38
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 46
+  .byte 110
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 45
+  .byte 62
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.378:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 42
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.377:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 32
+  .byte 42
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.376:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 97
+  .byte 114
+  .byte 97
+  .byte 109
+  .byte 95
+  .byte 100
+  .byte 101
+  .byte 99
+  .byte 97
+  .byte 121
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.375:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 42
+  .byte 41
+  .byte 91
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 41
+  .zero 1
+.align 1
+.L.data.374:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 42
+  .byte 41
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 41
+  .zero 1
+.align 1
+.L.data.373:
+  .byte 49
+  .byte 38
+  .byte 38
+  .byte 53
+  .zero 1
+.align 1
+.L.data.372:
+  .byte 40
+  .byte 50
+  .byte 45
+  .byte 50
+  .byte 41
+  .byte 38
+  .byte 38
+  .byte 53
+  .zero 1
+.align 1
+.L.data.371:
+  .byte 48
+  .byte 38
+  .byte 38
+  .byte 49
+  .zero 1
+.align 1
+.L.data.370:
+  .byte 48
+  .byte 124
+  .byte 124
+  .byte 40
+  .byte 50
+  .byte 45
+  .byte 50
+  .byte 41
+  .zero 1
+.align 1
+.L.data.369:
+  .byte 48
+  .byte 124
+  .byte 124
+  .byte 48
+  .zero 1
+.align 1
+.L.data.368:
+  .byte 48
+  .byte 124
+  .byte 124
+  .byte 40
+  .byte 50
+  .byte 45
+  .byte 50
+  .byte 41
+  .byte 124
+  .byte 124
+  .byte 53
+  .zero 1
+.align 1
+.L.data.367:
+  .byte 48
+  .byte 124
+  .byte 124
+  .byte 49
+  .zero 1
+.align 1
+.L.data.366:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 94
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.365:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 124
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.364:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 38
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.363:
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 94
+  .byte 48
+  .byte 98
+  .byte 48
+  .byte 48
+  .byte 49
+  .byte 49
+  .byte 48
+  .byte 48
+  .zero 1
+.align 1
+.L.data.362:
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 94
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 49
+  .zero 1
+.align 1
+.L.data.361:
+  .byte 48
+  .byte 94
+  .byte 48
+  .zero 1
+.align 1
+.L.data.360:
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 124
+  .byte 48
+  .byte 98
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 49
+  .byte 49
+  .zero 1
+.align 1
+.L.data.359:
+  .byte 48
+  .byte 124
+  .byte 49
+  .zero 1
+.align 1
+.L.data.358:
+  .byte 45
+  .byte 49
+  .byte 38
+  .byte 49
+  .byte 48
+  .zero 1
+.align 1
+.L.data.357:
+  .byte 55
+  .byte 38
+  .byte 51
+  .zero 1
+.align 1
+.L.data.356:
+  .byte 51
+  .byte 38
+  .byte 49
+  .zero 1
+.align 1
+.L.data.355:
+  .byte 48
+  .byte 38
+  .byte 49
+  .zero 1
+.align 1
+.L.data.354:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 37
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.353:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 37
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.352:
+  .byte 40
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 49
+  .byte 55
+  .byte 41
+  .byte 37
+  .byte 54
+  .zero 1
+.align 1
+.L.data.351:
+  .byte 49
+  .byte 55
+  .byte 37
+  .byte 54
+  .zero 1
+.align 1
+.L.data.350:
+  .byte 126
+  .byte 45
+  .byte 49
+  .zero 1
+.align 1
+.L.data.349:
+  .byte 126
+  .byte 48
+  .zero 1
+.align 1
+.L.data.348:
+  .byte 33
+  .byte 48
+  .zero 1
+.align 1
+.L.data.347:
+  .byte 33
+  .byte 50
+  .zero 1
+.align 1
+.L.data.346:
+  .byte 33
+  .byte 49
+  .zero 1
+.align 1
+.L.data.345:
+  .byte 48
+  .byte 66
+  .byte 49
+  .byte 48
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 49
+  .zero 1
+.align 1
+.L.data.344:
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 48
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 49
+  .zero 1
+.align 1
+.L.data.343:
+  .byte 48
+  .byte 98
+  .byte 49
+  .zero 1
+.align 1
+.L.data.342:
+  .byte 48
+  .byte 98
+  .byte 48
+  .zero 1
+.align 1
+.L.data.341:
+  .byte 48
+  .byte 88
+  .byte 66
+  .byte 69
+  .byte 69
+  .byte 70
+  .zero 1
+.align 1
+.L.data.340:
+  .byte 48
+  .byte 120
+  .byte 66
+  .byte 69
+  .byte 69
+  .byte 70
+  .zero 1
+.align 1
+.L.data.339:
+  .byte 48
+  .byte 120
+  .byte 98
+  .byte 101
+  .byte 101
+  .byte 102
+  .zero 1
+.align 1
+.L.data.338:
+  .byte 48
+  .byte 88
+  .byte 65
+  .zero 1
+.align 1
+.L.data.337:
+  .byte 48
+  .byte 120
+  .byte 97
+  .zero 1
+.align 1
+.L.data.336:
+  .byte 48
+  .byte 120
+  .byte 48
+  .zero 1
+.align 1
+.L.data.335:
+  .byte 48
+  .byte 55
+  .byte 55
+  .byte 55
+  .zero 1
+.align 1
+.L.data.334:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.333:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.332:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.331:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.330:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 41
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.329:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 41
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.328:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 40
+  .byte 112
+  .byte 45
+  .byte 45
+  .byte 41
+  .byte 41
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.327:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.326:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.325:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.324:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.323:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.322:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.321:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.320:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 45
+  .byte 45
+  .byte 42
+  .byte 112
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.319:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 43
+  .byte 43
+  .byte 42
+  .byte 112
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.318:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 43
+  .byte 43
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.317:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 47
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.316:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 47
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.315:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 42
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.314:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 42
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.313:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 45
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.312:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 45
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.311:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.310:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.309:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 106
+  .byte 41
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.308:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 106
+  .byte 41
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.307:
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 41
+  .zero 1
+.align 1
+.L.data.306:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 106
+  .byte 43
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.305:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 106
+  .byte 43
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.304:
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 116
+  .byte 105
+  .byte 99
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 40
+  .byte 41
+  .zero 1
+.align 1
+.L.data.303:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 111
+  .byte 110
+  .byte 101
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 119
+  .byte 111
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.302:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 111
+  .byte 110
+  .byte 101
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 119
+  .byte 111
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.301:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 61
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 117
+  .byte 114
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 117
+  .byte 114
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.300:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 61
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 117
+  .byte 114
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.299:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 61
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 117
+  .byte 114
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.298:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 61
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 117
+  .byte 114
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.297:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 115
+  .byte 101
+  .byte 118
+  .byte 101
+  .byte 110
+  .byte 44
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.296:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 115
+  .byte 101
+  .byte 118
+  .byte 101
+  .byte 110
+  .byte 44
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.295:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 111
+  .byte 110
+  .byte 101
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 119
+  .byte 111
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 119
+  .byte 111
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.294:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 111
+  .byte 110
+  .byte 101
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 119
+  .byte 111
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 111
+  .byte 110
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.293:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 111
+  .byte 110
+  .byte 101
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 119
+  .byte 111
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.292:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 39
+  .byte 97
+  .byte 39
+  .byte 41
+  .zero 1
+.align 1
+.L.data.291:
+  .byte 39
+  .byte 92
+  .byte 110
+  .byte 39
+  .zero 1
+.align 1
+.L.data.290:
+  .byte 39
+  .byte 97
+  .byte 39
+  .zero 1
+.align 1
+.L.data.289:
+  .byte 98
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 95
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 40
+  .byte 48
+  .byte 41
+  .zero 1
+.align 1
+.L.data.288:
+  .byte 98
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 95
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 40
+  .byte 48
+  .byte 41
+  .zero 1
+.align 1
+.L.data.287:
+  .byte 98
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 95
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 40
+  .byte 45
+  .byte 51
+  .byte 41
+  .zero 1
+.align 1
+.L.data.286:
+  .byte 98
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 95
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 40
+  .byte 45
+  .byte 51
+  .byte 41
+  .zero 1
+.align 1
+.L.data.285:
+  .byte 98
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 95
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 40
+  .byte 51
+  .byte 41
+  .zero 1
+.align 1
+.L.data.284:
+  .byte 98
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 95
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 40
+  .byte 51
+  .byte 41
+  .zero 1
+.align 1
+.L.data.283:
+  .byte 40
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 41
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 50
+  .byte 53
+  .byte 54
+  .zero 1
+.align 1
+.L.data.282:
+  .byte 40
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 41
+  .byte 50
+  .zero 1
+.align 1
+.L.data.281:
+  .byte 40
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 41
+  .byte 49
+  .zero 1
+.align 1
+.L.data.280:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.279:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.278:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.277:
+  .byte 100
+  .byte 105
+  .byte 118
+  .byte 95
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 41
+  .zero 1
+.align 1
+.L.data.276:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 95
+  .byte 116
+  .byte 111
+  .byte 95
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 40
+  .byte 50
+  .byte 54
+  .byte 49
+  .byte 41
+  .zero 1
+.align 1
+.L.data.275:
+  .byte 42
+  .byte 103
+  .byte 49
+  .byte 95
+  .byte 112
+  .byte 116
+  .byte 114
+  .byte 40
+  .byte 41
+  .zero 1
+.align 1
+.L.data.274:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 45
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.273:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.272:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.271:
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 55
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 55
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 50
+  .zero 1
+.align 1
+.L.data.270:
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 50
+  .byte 32
+  .byte 62
+  .byte 61
+  .byte 32
+  .byte 45
+  .byte 49
+  .zero 1
+.align 1
+.L.data.269:
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 50
+  .byte 32
+  .byte 62
+  .byte 32
+  .byte 45
+  .byte 49
+  .zero 1
+.align 1
+.L.data.268:
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 50
+  .byte 32
+  .byte 60
+  .byte 61
+  .byte 32
+  .byte 45
+  .byte 49
+  .zero 1
+.align 1
+.L.data.267:
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 50
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 45
+  .byte 49
+  .zero 1
+.align 1
+.L.data.266:
+  .byte 45
+  .byte 50
+  .byte 32
+  .byte 62
+  .byte 61
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .zero 1
+.align 1
+.L.data.265:
+  .byte 45
+  .byte 50
+  .byte 32
+  .byte 62
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .zero 1
+.align 1
+.L.data.264:
+  .byte 45
+  .byte 50
+  .byte 32
+  .byte 60
+  .byte 61
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .zero 1
+.align 1
+.L.data.263:
+  .byte 45
+  .byte 50
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .zero 1
+.align 1
+.L.data.262:
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 47
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 53
+  .zero 1
+.align 1
+.L.data.261:
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 42
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 53
+  .zero 1
+.align 1
+.L.data.260:
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 53
+  .zero 1
+.align 1
+.L.data.259:
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 53
+  .zero 1
+.align 1
+.L.data.258:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 47
+  .byte 32
+  .byte 53
+  .byte 41
+  .zero 1
+.align 1
+.L.data.257:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 42
+  .byte 32
+  .byte 53
+  .byte 41
+  .zero 1
+.align 1
+.L.data.256:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 53
+  .byte 41
+  .zero 1
+.align 1
+.L.data.255:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 53
+  .byte 41
+  .zero 1
+.align 1
+.L.data.254:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 47
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 53
+  .byte 41
+  .zero 1
+.align 1
+.L.data.253:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 42
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 53
+  .byte 41
+  .zero 1
+.align 1
+.L.data.252:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 53
+  .byte 41
+  .zero 1
+.align 1
+.L.data.251:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 53
+  .byte 41
+  .zero 1
+.align 1
+.L.data.250:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 47
+  .byte 32
+  .byte 53
+  .byte 41
+  .zero 1
+.align 1
+.L.data.249:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 42
+  .byte 32
+  .byte 53
+  .byte 41
+  .zero 1
+.align 1
+.L.data.248:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 53
+  .byte 41
+  .zero 1
+.align 1
+.L.data.247:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 53
+  .byte 41
+  .zero 1
+.align 1
+.L.data.246:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 42
+  .byte 41
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.245:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 53
+  .byte 49
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 38
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.244:
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 38
+  .byte 42
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 48
+  .zero 1
+.align 1
+.L.data.243:
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 49
+  .zero 1
+.align 1
+.L.data.242:
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 56
+  .byte 53
+  .byte 57
+  .byte 48
+  .byte 48
+  .byte 54
+  .byte 54
+  .byte 49
+  .byte 55
+  .byte 55
+  .zero 1
+.align 1
+.L.data.241:
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 56
+  .byte 53
+  .byte 57
+  .byte 48
+  .byte 48
+  .byte 54
+  .byte 54
+  .byte 49
+  .byte 55
+  .byte 55
+  .zero 1
+.align 1
+.L.data.240:
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 56
+  .byte 53
+  .byte 57
+  .byte 48
+  .byte 48
+  .byte 54
+  .byte 54
+  .byte 49
+  .byte 55
+  .byte 55
+  .zero 1
+.align 1
+.L.data.239:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.238:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 41
+  .zero 1
+.align 1
+.L.data.237:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 41
+  .zero 1
+.align 1
+.L.data.236:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 42
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 41
+  .zero 1
+.align 1
+.L.data.235:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 42
+  .byte 41
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 41
+  .zero 1
+.align 1
+.L.data.234:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 41
+  .zero 1
+.align 1
+.L.data.233:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 42
+  .byte 41
+  .zero 1
+.align 1
+.L.data.232:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 41
+  .zero 1
+.align 1
+.L.data.231:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 41
+  .zero 1
+.align 1
+.L.data.230:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .zero 1
+.align 1
+.L.data.229:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .zero 1
+.align 1
+.L.data.228:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .zero 1
+.align 1
+.L.data.227:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .zero 1
+.align 1
+.L.data.226:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .zero 1
+.align 1
+.L.data.225:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .zero 1
+.align 1
+.L.data.224:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .zero 1
+.align 1
+.L.data.223:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .zero 1
+.align 1
+.L.data.222:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 77
+  .byte 121
+  .byte 73
+  .byte 110
+  .byte 116
+  .byte 50
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.221:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 77
+  .byte 121
+  .byte 73
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.220:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.219:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.218:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.217:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.216:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.215:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.214:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.213:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.212:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.211:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.210:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.209:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.208:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.207:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 121
+  .byte 41
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.206:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.205:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.204:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.203:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 95
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 40
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .zero 1
+.align 1
+.L.data.202:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 95
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 40
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .zero 1
+.align 1
+.L.data.201:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.200:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.199:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.198:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.197:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.196:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.195:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 44
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 44
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 42
+  .byte 113
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 113
+  .byte 61
+  .byte 42
+  .byte 112
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.194:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 44
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 122
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 122
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.193:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 44
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.192:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 44
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 44
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.191:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 117
+  .byte 110
+  .byte 105
+  .byte 111
+  .byte 110
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 53
+  .byte 49
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.190:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 117
+  .byte 110
+  .byte 105
+  .byte 111
+  .byte 110
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 53
+  .byte 49
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.189:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 117
+  .byte 110
+  .byte 105
+  .byte 111
+  .byte 110
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 53
+  .byte 49
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.188:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 117
+  .byte 110
+  .byte 105
+  .byte 111
+  .byte 110
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 53
+  .byte 49
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.187:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 117
+  .byte 110
+  .byte 105
+  .byte 111
+  .byte 110
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 91
+  .byte 54
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.186:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 45
+  .byte 62
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.185:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 45
+  .byte 62
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.184:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 46
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 43
+  .byte 121
+  .byte 46
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.183:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.182:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 97
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 98
+  .byte 61
+  .byte 38
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 45
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.181:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 97
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 98
+  .byte 61
+  .byte 38
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 45
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.180:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.179:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.178:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.177:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.176:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.175:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.174:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.173:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.172:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.171:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.170:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.169:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.168:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.167:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.166:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.165:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.164:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.163:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.162:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.161:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.160:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.159:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 45
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.158:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.157:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.156:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.155:
+  .byte 34
+  .byte 92
+  .byte 120
+  .byte 55
+  .byte 55
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .zero 1
+.align 1
+.L.data.154:
+  .byte 119
+  .zero 1
+.align 1
+.L.data.153:
+  .byte 34
+  .byte 92
+  .byte 120
+  .byte 48
+  .byte 48
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .zero 1
+.align 1
+.L.data.152:
+  .byte 0
+  .zero 1
+.align 1
+.L.data.151:
+  .byte 34
+  .byte 92
+  .byte 49
+  .byte 53
+  .byte 48
+  .byte 48
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .zero 1
+.align 1
+.L.data.150:
+  .byte 104
+  .byte 48
+  .zero 1
+.align 1
+.L.data.149:
+  .byte 34
+  .byte 92
+  .byte 49
+  .byte 48
+  .byte 49
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .zero 1
+.align 1
+.L.data.148:
+  .byte 65
+  .zero 1
+.align 1
+.L.data.147:
+  .byte 34
+  .byte 92
+  .byte 50
+  .byte 48
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .zero 1
+.align 1
+.L.data.146:
+  .byte 16
+  .zero 1
+.align 1
+.L.data.145:
+  .byte 34
+  .byte 92
+  .byte 48
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .zero 1
+.align 1
+.L.data.144:
+  .byte 0
+  .zero 1
+.align 1
+.L.data.143:
+  .byte 34
+  .byte 92
+  .byte 108
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .zero 1
+.align 1
+.L.data.142:
+  .byte 108
+  .zero 1
+.align 1
+.L.data.141:
+  .byte 34
+  .byte 92
+  .byte 107
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .zero 1
+.align 1
+.L.data.140:
+  .byte 107
+  .zero 1
+.align 1
+.L.data.139:
+  .byte 34
+  .byte 92
+  .byte 106
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .zero 1
+.align 1
+.L.data.138:
+  .byte 106
+  .zero 1
+.align 1
+.L.data.137:
+  .byte 34
+  .byte 92
+  .byte 101
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .zero 1
+.align 1
+.L.data.136:
+  .byte 27
+  .zero 1
+.align 1
+.L.data.135:
+  .byte 34
+  .byte 92
+  .byte 114
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .zero 1
+.align 1
+.L.data.134:
+  .byte 13
+  .zero 1
+.align 1
+.L.data.133:
+  .byte 34
+  .byte 92
+  .byte 102
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .zero 1
+.align 1
+.L.data.132:
+  .byte 12
+  .zero 1
+.align 1
+.L.data.131:
+  .byte 34
+  .byte 92
+  .byte 118
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .zero 1
+.align 1
+.L.data.130:
+  .byte 11
+  .zero 1
+.align 1
+.L.data.129:
+  .byte 34
+  .byte 92
+  .byte 110
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .zero 1
+.align 1
+.L.data.128:
+  .byte 10
+  .zero 1
+.align 1
+.L.data.127:
+  .byte 34
+  .byte 92
+  .byte 116
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .zero 1
+.align 1
+.L.data.126:
+  .byte 9
+  .zero 1
+.align 1
+.L.data.125:
+  .byte 34
+  .byte 92
+  .byte 98
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .zero 1
+.align 1
+.L.data.124:
+  .byte 8
+  .zero 1
+.align 1
+.L.data.123:
+  .byte 34
+  .byte 92
+  .byte 97
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .zero 1
+.align 1
+.L.data.122:
+  .byte 7
+  .zero 1
+.align 1
+.L.data.121:
+  .byte 34
+  .byte 97
+  .byte 92
+  .byte 116
+  .byte 98
+  .byte 92
+  .byte 92
+  .byte 34
+  .byte 91
+  .byte 51
+  .byte 93
+  .zero 1
+.align 1
+.L.data.120:
+  .byte 97
+  .byte 9
+  .byte 98
+  .byte 92
+  .zero 1
+.align 1
+.L.data.119:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 34
+  .byte 97
+  .byte 92
+  .byte 116
+  .byte 98
+  .byte 92
+  .byte 92
+  .byte 34
+  .byte 41
+  .zero 1
+.align 1
+.L.data.118:
+  .byte 97
+  .byte 9
+  .byte 98
+  .byte 92
+  .zero 1
+.align 1
+.L.data.117:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 60
+  .byte 50
+  .byte 48
+  .byte 48
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 115
+  .byte 62
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 57
+  .byte 56
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.116:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 60
+  .byte 50
+  .byte 48
+  .byte 48
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 115
+  .byte 62
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.115:
+  .byte 40
+  .byte 60
+  .byte 50
+  .byte 48
+  .byte 48
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 115
+  .byte 62
+  .byte 41
+  .byte 91
+  .byte 50
+  .byte 48
+  .byte 48
+  .byte 93
+  .zero 1
+.align 1
+.L.data.114:
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .zero 1
+.align 1
+.L.data.113:
+  .byte 40
+  .byte 60
+  .byte 50
+  .byte 48
+  .byte 48
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 115
+  .byte 62
+  .byte 41
+  .byte 91
+  .byte 49
+  .byte 57
+  .byte 55
+  .byte 93
+  .zero 1
+.align 1
+.L.data.112:
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .zero 1
+.align 1
+.L.data.111:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 60
+  .byte 50
+  .byte 48
+  .byte 48
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 115
+  .byte 62
+  .byte 41
+  .zero 1
+.align 1
+.L.data.110:
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .zero 1
+.align 1
+.L.data.109:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 41
+  .zero 1
+.align 1
+.L.data.108:
+  .byte 97
+  .byte 98
+  .byte 99
+  .zero 1
+.align 1
+.L.data.107:
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 91
+  .byte 51
+  .byte 93
+  .zero 1
+.align 1
+.L.data.106:
+  .byte 97
+  .byte 98
+  .byte 99
+  .zero 1
+.align 1
+.L.data.105:
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 91
+  .byte 50
+  .byte 93
+  .zero 1
+.align 1
+.L.data.104:
+  .byte 97
+  .byte 98
+  .byte 99
+  .zero 1
+.align 1
+.L.data.103:
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 91
+  .byte 49
+  .byte 93
+  .zero 1
+.align 1
+.L.data.102:
+  .byte 97
+  .byte 98
+  .byte 99
+  .zero 1
+.align 1
+.L.data.101:
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .zero 1
+.align 1
+.L.data.100:
+  .byte 97
+  .byte 98
+  .byte 99
+  .zero 1
+.align 1
+.L.data.99:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 95
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 40
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.98:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.97:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.96:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.95:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.94:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.93:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 41
+  .zero 1
+.align 1
+.L.data.92:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 41
+  .zero 1
+.align 1
+.L.data.91:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.90:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.89:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.88:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.87:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 49
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.86:
+  .byte 103
+  .byte 49
+  .zero 1
+.align 1
+.L.data.85:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.84:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.83:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.82:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.81:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.80:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.79:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.78:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.77:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.76:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.75:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 54
+  .byte 41
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.74:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 53
+  .byte 41
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.73:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 52
+  .byte 41
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.72:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 51
+  .byte 41
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.71:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.70:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.69:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.68:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.67:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.66:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.65:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.64:
+  .byte 102
+  .byte 105
+  .byte 98
+  .byte 40
+  .byte 57
+  .byte 41
+  .zero 1
+.align 1
+.L.data.63:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 50
+  .byte 40
+  .byte 52
+  .byte 44
+  .byte 51
+  .byte 41
+  .zero 1
+.align 1
+.L.data.62:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 41
+  .zero 1
+.align 1
+.L.data.61:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 54
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 41
+  .zero 1
+.align 1
+.L.data.60:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 50
+  .byte 40
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .zero 1
+.align 1
+.L.data.59:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .zero 1
+.align 1
+.L.data.58:
+  .byte 114
+  .byte 101
+  .byte 116
+  .byte 51
+  .byte 40
+  .byte 41
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 114
+  .byte 101
+  .byte 116
+  .byte 53
+  .byte 40
+  .byte 41
+  .zero 1
+.align 1
+.L.data.57:
+  .byte 114
+  .byte 101
+  .byte 116
+  .byte 53
+  .byte 40
+  .byte 41
+  .zero 1
+.align 1
+.L.data.56:
+  .byte 114
+  .byte 101
+  .byte 116
+  .byte 51
+  .byte 40
+  .byte 41
+  .zero 1
+.align 1
+.L.data.55:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 43
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.54:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 43
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.53:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 45
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.52:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 121
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.51:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.50:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.49:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 121
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.48:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.47:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 122
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.46:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.45:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 106
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.44:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.43:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.42:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.41:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 97
+  .byte 62
+  .byte 98
+  .byte 41
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.40:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 50
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.39:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.38:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 49
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.37:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.36:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 59
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.35:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 43
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.34:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.33:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 98
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 43
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.32:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 122
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 43
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.31:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .zero 1
+.align 1
+.L.data.30:
+  .byte 52
+  .byte 50
+  .byte 33
+  .byte 61
+  .byte 52
+  .byte 50
+  .zero 1
+.align 1
+.L.data.29:
+  .byte 48
+  .byte 33
+  .byte 61
+  .byte 49
+  .zero 1
+.align 1
+.L.data.28:
+  .byte 52
+  .byte 50
+  .byte 61
+  .byte 61
+  .byte 52
+  .byte 50
+  .zero 1
+.align 1
+.L.data.27:
+  .byte 48
+  .byte 61
+  .byte 61
+  .byte 49
+  .zero 1
+.align 1
+.L.data.26:
+  .byte 52
+  .byte 50
+  .byte 33
+  .byte 61
+  .byte 52
+  .byte 50
+  .zero 1
+.align 1
+.L.data.25:
+  .byte 48
+  .byte 33
+  .byte 61
+  .byte 49
+  .zero 1
+.align 1
+.L.data.24:
+  .byte 52
+  .byte 50
+  .byte 61
+  .byte 61
+  .byte 52
+  .byte 50
+  .zero 1
+.align 1
+.L.data.23:
+  .byte 48
+  .byte 61
+  .byte 61
+  .byte 49
+  .zero 1
+.align 1
+.L.data.22:
+  .byte 52
+  .byte 50
+  .byte 33
+  .byte 61
+  .byte 52
+  .byte 50
+  .zero 1
+.align 1
+.L.data.21:
+  .byte 48
+  .byte 33
+  .byte 61
+  .byte 49
+  .zero 1
+.align 1
+.L.data.20:
+  .byte 52
+  .byte 50
+  .byte 61
+  .byte 61
+  .byte 52
+  .byte 50
+  .zero 1
+.align 1
+.L.data.19:
+  .byte 48
+  .byte 61
+  .byte 61
+  .byte 49
+  .zero 1
+.align 1
+.L.data.18:
+  .byte 45
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 43
+  .byte 49
+  .byte 48
+  .zero 1
+.align 1
+.L.data.17:
+  .byte 45
+  .byte 32
+  .byte 45
+  .byte 49
+  .byte 48
+  .zero 1
+.align 1
+.L.data.16:
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 43
+  .byte 50
+  .byte 48
+  .zero 1
+.align 1
+.L.data.15:
+  .byte 40
+  .byte 51
+  .byte 43
+  .byte 53
+  .byte 41
+  .byte 47
+  .byte 50
+  .zero 1
+.align 1
+.L.data.14:
+  .byte 53
+  .byte 42
+  .byte 40
+  .byte 57
+  .byte 45
+  .byte 54
+  .byte 41
+  .zero 1
+.align 1
+.L.data.13:
+  .byte 53
+  .byte 43
+  .byte 54
+  .byte 42
+  .byte 55
+  .zero 1
+.align 1
+.L.data.12:
+  .byte 32
+  .byte 49
+  .byte 50
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 51
+  .byte 52
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 53
+  .byte 32
+  .zero 1
+.align 1
+.L.data.11:
+  .byte 53
+  .byte 43
+  .byte 50
+  .byte 48
+  .byte 45
+  .byte 52
+  .zero 1
+.align 1
+.L.data.10:
+  .byte 52
+  .byte 50
+  .zero 1
+.align 1
+.L.data.9:
+  .byte 48
+  .zero 1
+.align 4
+.L.data.8:
+  .long 2
+.align 1
+.L.data.6:
+  .byte 37
+  .byte 115
+  .byte 32
+  .byte 61
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 101
+  .byte 120
+  .byte 112
+  .byte 101
+  .byte 99
+  .byte 116
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 98
+  .byte 117
+  .byte 116
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .zero 1
+.align 1
+.L.data.5:
+  .byte 37
+  .byte 115
+  .byte 32
+  .byte 61
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .zero 1
+.align 4
+ext3:
+  .long 3
+.align 8
+.L.data.4:
+  .long 4
+  .zero 4
+  .quad 0
+  .quad 0
+.align 8
+.L.data.3:
+  .long 3
+  .zero 4
+  .quad 0
+  .quad 0
+.align 8
+.L.data.2:
+  .long 2
+  .zero 4
+  .quad .L.data.3+0
+  .quad .L.data.4+0
+.align 8
+.L.data.1:
+  .long 1
+  .zero 4
+  .quad .L.data.2+0
+  .quad 0
+.align 8
+.globl tree
+tree:
+  .quad .L.data.1+0
+.align 1
+.L.data.0:
+  .byte 102
+  .byte 111
+  .byte 111
+  .zero 1
+.align 8
+.globl g34
+g34:
+  .quad .L.data.0+0
+.align 1
+.globl g33
+g33:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 4
+.globl g31
+g31:
+  .long 1
+  .long 2
+  .long 3
+  .long 4
+.align 4
+.globl g30
+g30:
+  .long 1
+  .long 2
+  .long 3
+  .long 4
+.align 8
+.globl g27
+g27:
+  .quad g26+4
+.align 4
+.globl g26
+g26:
+  .long 1
+  .long 2
+  .long 3
+.align 8
+.globl g25
+g25:
+  .quad g24+0
+.align 4
+.globl g24
+g24:
+  .long 3
+.align 8
+.globl g23
+g23:
+  .quad g17+0
+  .quad g17+3
+  .quad g17-3
+.align 8
+.globl g22
+g22:
+  .quad g17-3
+.align 8
+.globl g21
+g21:
+  .quad g17+3
+.align 8
+.globl g20
+g20:
+  .quad g17+0
+.align 1
+.globl g19
+g19:
+  .byte 102
+  .byte 111
+  .byte 111
+.align 1
+.globl g18
+g18:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .zero 4
+.align 1
+.globl g17
+g17:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .zero 1
+.align 4
+.globl g12
+g12:
+  .long 1
+  .long 2
+  .zero 8
+.align 4
+.globl g11
+g11:
+  .byte 1
+  .zero 3
+  .long 2
+  .byte 3
+  .zero 3
+  .long 4
+.align 4
+.globl g9
+g9:
+  .long 0
+  .long 1
+  .long 2
+.align 8
+.globl g6
+g6:
+  .quad 6
+.align 4
+.globl g5
+g5:
+  .long 5
+.align 2
+.globl g4
+g4:
+  .short 4
+.align 1
+.globl g3
+g3:
+  .byte 3
+.align 4
+.globl include1
+include1:
+  .long 5
+.align 4
+.globl include2
+include2:
+  .long 7
+.text
+.globl assert
+assert:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdx
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 68 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.else.assert.1
+.loc 1 69 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.5
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset printf
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.assert.1
+.L.else.assert.1:
+.loc 1 71 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.6
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset printf
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 72 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  push r10
+  sub rsp, 8
+  mov r10, offset exit
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.assert.1:
+.L.return.assert:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl ret3
+ret3:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 76 18
+  mov r10, 3
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.ret3
+  mov r10, 5
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.ret3
+.L.return.ret3:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl ret5
+ret5:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 77 14
+  mov r10, 5
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.ret5
+.L.return.ret5:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl add2
+add2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-36], esi
+  mov [rbp-40], edi
+.loc 1 78 26
+  lea r10, [rbp-40]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.add2
+.L.return.add2:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl sub2
+sub2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-36], esi
+  mov [rbp-40], edi
+.loc 1 79 26
+  lea r10, [rbp-40]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.sub2
+.L.return.sub2:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl add6
+add6:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-36], r9d
+  mov [rbp-40], r8d
+  mov [rbp-44], ecx
+  mov [rbp-48], edx
+  mov [rbp-52], esi
+  mov [rbp-56], edi
+.loc 1 82 3
+  lea r10, [rbp-56]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-44]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.add6
+.L.return.add6:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl sub_short
+sub_short:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-34], dx
+  mov [rbp-36], si
+  mov [rbp-38], di
+.loc 1 86 3
+  lea r10, [rbp-38]
+  movsx r10d, word ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  movsx r11d, word ptr [r11]
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-34]
+  movsx r11d, word ptr [r11]
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.sub_short
+.L.return.sub_short:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl sub_long
+sub_long:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdx
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 90 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  sub r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  sub r10, r11
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.sub_long
+.L.return.sub_long:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl fib
+fib:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-36], edi
+.loc 1 94 3
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.fib.1
+.loc 1 95 5
+  mov r10, 1
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.fib
+.L.end.fib.1:
+.loc 1 96 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset fib
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset fib
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.fib
+.L.return.fib:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl sub_char
+sub_char:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-33], dl
+  mov [rbp-34], sil
+  mov [rbp-35], dil
+.loc 1 99 40
+  lea r10, [rbp-35]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-34]
+  movsx r11d, byte ptr [r11]
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-33]
+  movsx r11d, byte ptr [r11]
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.sub_char
+.L.return.sub_char:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl g1_ptr
+g1_ptr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 101 17
+  mov r10, offset g1
+  mov rax, r10
+  jmp .L.return.g1_ptr
+.L.return.g1_ptr:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl int_to_char
+int_to_char:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-36], edi
+.loc 1 102 27
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10b
+  mov rax, r10
+  jmp .L.return.int_to_char
+.L.return.int_to_char:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl div_long
+div_long:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rsi
+  mov [rbp-48], rdi
+.loc 1 105 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.div_long
+.L.return.div_long:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl bool_fn_add
+bool_fn_add:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-33], dil
+.loc 1 108 30
+  lea r10, [rbp-33]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.bool_fn_add
+.L.return.bool_fn_add:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl bool_fn_sub
+bool_fn_sub:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-33], dil
+.loc 1 109 30
+  lea r10, [rbp-33]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.bool_fn_sub
+.L.return.bool_fn_sub:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl ret_none
+ret_none:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 112 3
+  jmp .L.return.ret_none
+.L.return.ret_none:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+static_fn:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 115 26
+  mov r10, 3
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.static_fn
+.L.return.static_fn:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl param_decay
+param_decay:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 117 28
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.param_decay
+.L.return.param_decay:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl counter
+counter:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 120 15
+.loc 1 121 21
+.loc 1 122 3
+  mov r10, offset .L.data.7
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov r11, offset .L.data.8
+  lea r12, [rbp-40]
+  mov [r12], r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  add r11d, r12d
+  mov r11d, r11d
+  lea r12, [rbp-40]
+  mov r12, [r12]
+  mov [r12], r11d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, -1
+  mov r12d, r12d
+  add r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.counter
+.L.return.counter:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl fmt
+fmt:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 128
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-88], rdi
+  mov [rbp-80], rsi
+  mov [rbp-72], rdx
+  mov [rbp-64], rcx
+  mov [rbp-56], r8
+  mov [rbp-48], r9
+  mov dword ptr [rbp-40], 16
+  mov [rbp-120], rsi
+  mov [rbp-128], rdi
+.loc 1 141 13
+.loc 1 142 3
+  lea r10, [rbp-112]
+  mov eax, [rbp-40]
+  mov [r10], eax
+  lea rax, [rbp-88]
+  mov [r10+16], rax
+.loc 1 143 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-112]
+  push r10
+  sub rsp, 8
+  mov r10, offset vsprintf
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.fmt:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl fnptr
+fnptr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 147 3
+  mov r10, offset ret3
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.fnptr
+.L.return.fnptr:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl M9
+M9:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-36], edi
+.loc 1 150 17
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  imul r10d, r11d
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.M9
+.L.return.M9:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl main
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 38096
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 153 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.9
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 154 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 42
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 42
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.10
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 155 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 21
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 5
+  mov r10d, r10d
+  mov r11, 20
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.11
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 156 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 41
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 12
+  mov r10d, r10d
+  mov r11, 34
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov r11, 5
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.12
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 157 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 47
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 5
+  mov r10d, r10d
+  mov r11, 6
+  mov r11d, r11d
+  mov r12, 7
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.13
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 158 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 15
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 5
+  mov r10d, r10d
+  mov r11, 9
+  mov r11d, r11d
+  mov r12, 6
+  mov r12d, r12d
+  sub r11d, r12d
+  mov r11d, r11d
+  imul r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.14
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 159 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  mov r11, 5
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  mov eax, r10d
+  cdq
+  idiv r11d
+  mov r10d, eax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.15
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 160 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 10
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  mov r11, 20
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.16
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 161 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 10
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 10
+  mov r12d, r12d
+  sub r11d, r12d
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.17
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 162 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 10
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 10
+  mov r12d, r12d
+  sub r11d, r12d
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.18
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 164 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.19
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 165 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 42
+  mov r10d, r10d
+  mov r11, 42
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.20
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 166 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.21
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 167 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 42
+  mov r10d, r10d
+  mov r11, 42
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.22
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 169 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.23
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 170 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 42
+  mov r10d, r10d
+  mov r11, 42
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.24
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 171 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.25
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 172 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 42
+  mov r10d, r10d
+  mov r11, 42
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.26
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 174 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.27
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 175 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 42
+  mov r10d, r10d
+  mov r11, 42
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.28
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 176 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.29
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 177 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 42
+  mov r10d, r10d
+  mov r11, 42
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.30
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 179 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-38088]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-38088]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.31
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 180 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-38084]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-38080]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-38084]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-38080]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.32
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 181 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-38072]
+  mov [r11], r10d
+  mov r10d, r10d
+  lea r11, [rbp-38076]
+  mov [r11], r10d
+  lea r10, [rbp-38076]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-38072]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.33
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 182 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-38068]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-38068]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.34
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 183 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-38064]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-38060]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-38064]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-38060]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.35
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 184 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-38056]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-38052]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 7
+  mov r10d, r10d
+  lea r11, [rbp-38056]
+  mov [r11], r10d
+  lea r10, [rbp-38056]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.36
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 186 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  cmp r10, 0
+  je .L.else.main.1
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-38048]
+  mov [r11], r10d
+  jmp .L.end.main.1
+.L.else.main.1:
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-38048]
+  mov [r11], r10d
+.L.end.main.1:
+  lea r10, [rbp-38048]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.37
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 187 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  cmp r10, 0
+  je .L.else.main.2
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-38044]
+  mov [r11], r10d
+  jmp .L.end.main.2
+.L.else.main.2:
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-38044]
+  mov [r11], r10d
+.L.end.main.2:
+  lea r10, [rbp-38044]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.38
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 188 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  cmp r10, 0
+  je .L.else.main.3
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-38040]
+  mov [r11], r10d
+  jmp .L.end.main.3
+.L.else.main.3:
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-38040]
+  mov [r11], r10d
+.L.end.main.3:
+  lea r10, [rbp-38040]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.39
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 189 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  cmp r10, 0
+  je .L.else.main.4
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-38036]
+  mov [r11], r10d
+  jmp .L.end.main.4
+.L.else.main.4:
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-38036]
+  mov [r11], r10d
+.L.end.main.4:
+  lea r10, [rbp-38036]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.40
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 190 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-38032]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-38028]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-38028]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-38032]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.main.5
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-38032]
+  mov [r11], r10d
+  jmp .L.end.main.5
+.L.else.main.5:
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-38032]
+  mov [r11], r10d
+.L.end.main.5:
+  lea r10, [rbp-38032]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.41
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 192 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 55
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-38024]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-38020]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-38024]
+  mov [r11], r10d
+.L.begin.main.6:
+  lea r10, [rbp-38024]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.main.6
+  lea r10, [rbp-38024]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-38020]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-38020]
+  mov [r11], r10d
+.L.continue.main.6:
+  lea r10, [rbp-38024]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-38024]
+  mov [r11], r10d
+  jmp .L.begin.main.6
+.L.break.main.6:
+  lea r10, [rbp-38020]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.42
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 194 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 10
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-38016]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.main.7:
+  lea r10, [rbp-38016]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.main.7
+  lea r10, [rbp-38016]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-38016]
+  mov [r11], r10d
+.L.continue.main.7:
+  jmp .L.begin.main.7
+.L.break.main.7:
+  lea r10, [rbp-38016]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.43
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 196 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 10
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-38012]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.main.8:
+  lea r10, [rbp-38012]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.main.8
+  lea r10, [rbp-38012]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-38012]
+  mov [r11], r10d
+.L.continue.main.8:
+  jmp .L.begin.main.8
+.L.break.main.8:
+  lea r10, [rbp-38012]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.44
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 197 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 55
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-38008]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-38004]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.main.9:
+  lea r10, [rbp-38008]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.main.9
+  lea r10, [rbp-38008]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-38004]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-38004]
+  mov [r11], r10d
+  lea r10, [rbp-38008]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-38008]
+  mov [r11], r10d
+.L.continue.main.9:
+  jmp .L.begin.main.9
+.L.break.main.9:
+  lea r10, [rbp-38004]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.45
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 199 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-38000]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-38000]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.46
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 200 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-37996]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-37996]
+  lea r11, [rbp-37992]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-37992]
+  lea r11, [rbp-37984]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-37984]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.47
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 201 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-37972]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-37968]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-37972]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.48
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 202 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-37964]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-37960]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-37960]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  sub r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.49
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 203 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-37956]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-37956]
+  lea r11, [rbp-37952]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-37952]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-37956]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.50
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 204 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-37940]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-37936]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 7
+  mov r10d, r10d
+  lea r11, [rbp-37940]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-37936]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.51
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 205 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-37932]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-37928]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 7
+  mov r10d, r10d
+  lea r11, [rbp-37928]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  sub r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-37932]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.52
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 206 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-37924]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-37924]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-37924]
+  sub r10, r11
+  mov r11, 4
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.53
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 207 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-37920]
+  mov [r11], r10d
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-37916]
+  mov [r11], r10d
+  lea r10, [rbp-37920]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-37916]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.54
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 208 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-37912]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-37908]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-37912]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-37908]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.55
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 210 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset ret3
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.56
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 211 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset ret5
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.57
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 212 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset ret3
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset ret5
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.58
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 213 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 5
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset add2
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.59
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 214 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset sub2
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.60
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 215 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 21
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 5
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 6
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset add6
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.61
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 217 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset add2
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.62
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 218 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset sub2
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.63
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 219 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 55
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 9
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset fib
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.64
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 221 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-37904]
+  lea r11, [rbp-37896]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-37896]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-37904]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.65
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 223 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-37884]
+  mov [r11], r10d
+  mov r10, 4
+  mov r10d, r10d
+  lea r11, [rbp-37884]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-37884]
+  mov r12, 2
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-37884]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.66
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 224 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-37872]
+  mov [r11], r10d
+  mov r10, 4
+  mov r10d, r10d
+  lea r11, [rbp-37872]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-37872]
+  mov r12, 2
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-37872]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.67
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 225 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-37860]
+  mov [r11], r10d
+  mov r10, 4
+  mov r10d, r10d
+  lea r11, [rbp-37860]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-37860]
+  mov r12, 2
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-37860]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.68
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 227 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-37848]
+  lea r11, [rbp-37824]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-37824]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-37848]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.69
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 228 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-37816]
+  lea r11, [rbp-37792]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-37792]
+  mov r11, [r11]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-37816]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.70
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 229 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-37784]
+  lea r11, [rbp-37760]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-37760]
+  mov r11, [r11]
+  mov r12, 2
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-37784]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.71
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 230 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-37752]
+  lea r11, [rbp-37728]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-37728]
+  mov r11, [r11]
+  mov r12, 3
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-37752]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 12
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.72
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 231 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-37720]
+  lea r11, [rbp-37696]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 4
+  mov r10d, r10d
+  lea r11, [rbp-37696]
+  mov r11, [r11]
+  mov r12, 4
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-37720]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 12
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.73
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 232 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-37688]
+  lea r11, [rbp-37664]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-37664]
+  mov r11, [r11]
+  mov r12, 5
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-37688]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 12
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.74
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 233 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-37656]
+  lea r11, [rbp-37632]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 6
+  mov r10d, r10d
+  lea r11, [rbp-37632]
+  mov r11, [r11]
+  mov r12, 6
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-37656]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 12
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.75
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 235 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.76
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 236 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.77
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 237 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.78
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 238 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 16
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 16
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.79
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 239 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 48
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 48
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.80
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 240 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 16
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 16
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.81
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 241 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.82
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 242 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.83
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 243 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.84
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 244 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.85
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 246 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g1
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.86
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 247 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  mov r11, offset g1
+  mov [r11], r10d
+  mov r10, offset g1
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.87
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 248 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, offset g2
+  mov r12, 0
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  mov r10d, r10d
+  mov r11, offset g2
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  mov r11, offset g2
+  mov r12, 2
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  mov r11, offset g2
+  mov r12, 3
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, offset g2
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.88
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 249 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, offset g2
+  mov r12, 0
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  mov r10d, r10d
+  mov r11, offset g2
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  mov r11, offset g2
+  mov r12, 2
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  mov r11, offset g2
+  mov r12, 3
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, offset g2
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.89
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 250 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, offset g2
+  mov r12, 0
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  mov r10d, r10d
+  mov r11, offset g2
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  mov r11, offset g2
+  mov r12, 2
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  mov r11, offset g2
+  mov r12, 3
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, offset g2
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.90
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 251 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, offset g2
+  mov r12, 0
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  mov r10d, r10d
+  mov r11, offset g2
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  mov r11, offset g2
+  mov r12, 2
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  mov r11, offset g2
+  mov r12, 3
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, offset g2
+  mov r11, 3
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.91
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 253 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.92
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 254 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 16
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 16
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.93
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 256 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  movsx r10, r10b
+  lea r11, [rbp-37302]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  lea r10, [rbp-37302]
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.94
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 257 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  movsx r10, r10b
+  lea r11, [rbp-37301]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 2
+  movsx r10, r10b
+  lea r11, [rbp-37300]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  lea r10, [rbp-37301]
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.95
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 258 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  movsx r10, r10b
+  lea r11, [rbp-37299]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 2
+  movsx r10, r10b
+  lea r11, [rbp-37298]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  lea r10, [rbp-37298]
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.96
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 260 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 1
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.97
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 261 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 10
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 10
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.98
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 262 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  movsx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  movsx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  movsx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset sub_char
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.99
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 264 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 97
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.100
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.101
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 265 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 98
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.102
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.103
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 266 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 99
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.104
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.105
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 267 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.106
+  mov r11, 3
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.107
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 268 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.109
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 269 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 201
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 201
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.111
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 270 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 55
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.112
+  mov r11, 197
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.113
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 271 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.114
+  mov r11, 200
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.115
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 272 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 201
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 1
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 2
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 3
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 5
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 6
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 7
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 9
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 10
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 11
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 12
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 13
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 14
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 15
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 17
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 18
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 19
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 20
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 21
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 22
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 23
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 25
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 26
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 27
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 28
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 29
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 30
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 31
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 33
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 34
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 35
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 36
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 37
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 38
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 39
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 41
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 42
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 43
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 44
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 45
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 46
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 47
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 48
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 49
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 50
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 51
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 52
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 53
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 54
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 55
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 56
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 57
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 58
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 59
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 60
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 61
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 62
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 63
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 64
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 65
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 66
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 67
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 68
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 69
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 70
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 71
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 72
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 73
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 74
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 75
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 76
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 77
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 78
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 79
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 80
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 81
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 82
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 83
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 84
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 85
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 86
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 87
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 88
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 89
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 90
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 91
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 92
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 93
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 94
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 95
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 96
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 97
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 98
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 99
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 100
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 101
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 102
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 103
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 104
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 105
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 106
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 107
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 108
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 109
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 110
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 111
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 112
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 113
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 114
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 115
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 116
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 117
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 118
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 119
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 120
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 121
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 122
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 123
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 124
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 125
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 126
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 127
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 128
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 129
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 130
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 131
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 132
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 133
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 134
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 135
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 136
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 137
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 138
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 139
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 140
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 141
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 142
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 143
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 144
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 145
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 146
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 147
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 148
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 149
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 150
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 151
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 152
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 153
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 154
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 155
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 156
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 157
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 158
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 159
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 160
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 161
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 162
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 163
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 164
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 165
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 166
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 167
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 168
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 169
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 170
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 171
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 172
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 173
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 174
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 175
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 176
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 177
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 178
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 179
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 180
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 181
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 182
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 183
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 184
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 185
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 186
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 187
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 188
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 189
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 190
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 191
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 192
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 193
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 194
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 195
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 196
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 197
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 198
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 199
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-37286]
+  mov r12, 200
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  movabs r10, 201
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.116
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 273 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 56
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 1
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 2
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 3
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 5
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 6
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 7
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 9
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 10
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 11
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 12
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 13
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 14
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 15
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 17
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 18
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 19
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 20
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 21
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 22
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 23
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 25
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 26
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 27
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 28
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 29
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 30
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 31
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 33
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 34
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 35
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 36
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 37
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 38
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 39
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 41
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 42
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 43
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 44
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 45
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 46
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 47
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 48
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 49
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 50
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 51
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 52
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 53
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 54
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 55
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 56
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 57
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 58
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 59
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 60
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 61
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 62
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 63
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 64
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 65
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 66
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 67
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 68
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 69
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 70
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 71
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 72
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 73
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 74
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 75
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 76
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 77
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 78
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 79
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 80
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 81
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 82
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 83
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 84
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 85
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 86
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 87
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 88
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 89
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 90
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 91
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 92
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 93
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 94
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 95
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 96
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 97
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 98
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 99
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 100
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 101
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 102
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 103
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 104
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 105
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 106
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 107
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 108
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 109
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 110
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 111
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 112
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 113
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 114
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 115
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 116
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 117
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 118
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 119
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 120
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 121
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 122
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 123
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 124
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 125
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 126
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 127
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 128
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 129
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 130
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 131
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 132
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 133
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 134
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 135
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 136
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 137
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 138
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 139
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 140
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 141
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 142
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 143
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 144
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 145
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 146
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 147
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 148
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 149
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 150
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 151
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 152
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 153
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 154
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 155
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 156
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 157
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 158
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 159
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 160
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 161
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 162
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 163
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 164
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 165
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 166
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 167
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 168
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 169
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 170
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 171
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 172
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 173
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 174
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 175
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 176
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 177
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 178
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 179
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 180
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 181
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 182
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 183
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 184
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 185
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 186
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 187
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 188
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 189
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 48
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 190
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 49
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 191
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 50
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 192
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 51
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 193
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 52
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 194
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 53
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 195
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 54
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 196
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 55
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 197
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 56
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 198
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 57
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 199
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-37085]
+  mov r12, 200
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  lea r10, [rbp-37085]
+  mov r11, 198
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.117
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 274 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 5
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.119
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 275 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 92
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.120
+  mov r11, 3
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.121
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 277 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.122
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.123
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 278 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.124
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.125
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 279 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 9
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.126
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.127
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 280 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 10
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.128
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.129
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 281 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 11
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.130
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.131
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 282 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 12
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.132
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.133
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 283 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 13
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.134
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.135
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 284 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 27
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.136
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.137
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 286 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 106
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.138
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.139
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 287 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 107
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.140
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.141
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 288 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 108
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.142
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.143
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 290 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.144
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.145
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 291 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 16
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.146
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.147
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 292 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 65
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.148
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.149
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 293 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 104
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.150
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.151
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 294 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.152
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.153
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 295 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 119
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.154
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.155
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 297 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-36884]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-36880]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-36884]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.156
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 298 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-36876]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-36872]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 4
+  mov r10d, r10d
+  lea r11, [rbp-36868]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-36876]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.157
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 299 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-36864]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-36864]
+  mov [r11], r10d
+  lea r10, [rbp-36864]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.158
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 301 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-36860]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-36840]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-36840]
+  mov r10, [r10]
+  lea r11, [rbp-36860]
+  sub r10, r11
+  mov r11, 4
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.159
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 303 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-36828]
+  add r11, 0
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-36828]
+  add r11, 4
+  mov [r11], r10d
+  lea r10, [rbp-36828]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.160
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 304 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-36820]
+  add r11, 0
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-36820]
+  add r11, 4
+  mov [r11], r10d
+  lea r10, [rbp-36820]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.161
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 305 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-36812]
+  add r11, 0
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-36812]
+  add r11, 4
+  mov [r11], r10d
+  mov r10, 3
+  movsx r10, r10b
+  lea r11, [rbp-36812]
+  add r11, 8
+  mov [r11], r10b
+  lea r10, [rbp-36812]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.162
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 306 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-36800]
+  add r11, 0
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-36800]
+  add r11, 4
+  mov [r11], r10d
+  mov r10, 3
+  movsx r10, r10b
+  lea r11, [rbp-36800]
+  add r11, 8
+  mov [r11], r10b
+  lea r10, [rbp-36800]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.163
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 307 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-36788]
+  add r11, 0
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-36788]
+  add r11, 4
+  mov [r11], r10d
+  mov r10, 3
+  movsx r10, r10b
+  lea r11, [rbp-36788]
+  add r11, 8
+  mov [r11], r10b
+  lea r10, [rbp-36788]
+  add r10, 8
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.164
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 309 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-36776]
+  lea r11, [rbp-36752]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-36752]
+  mov r11, [r11]
+  mov r12, 0
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-36776]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.165
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 310 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-36744]
+  lea r11, [rbp-36720]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-36720]
+  mov r11, [r11]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-36744]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.166
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 311 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-36712]
+  lea r11, [rbp-36688]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-36688]
+  mov r11, [r11]
+  mov r12, 2
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-36712]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.167
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 312 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-36680]
+  lea r11, [rbp-36656]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-36656]
+  mov r11, [r11]
+  mov r12, 3
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-36680]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.168
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 314 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-36648]
+  lea r11, [rbp-36616]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 6
+  mov r10d, r10d
+  lea r11, [rbp-36648]
+  add r11, 0
+  mov r12, 0
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-36616]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.169
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 315 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-36608]
+  lea r11, [rbp-36576]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 7
+  mov r10d, r10d
+  lea r11, [rbp-36608]
+  add r11, 12
+  mov r12, 0
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-36576]
+  mov r10, [r10]
+  mov r11, 3
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.170
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 317 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 6
+  mov r10d, r10d
+  lea r11, [rbp-36564]
+  add r11, 0
+  add r11, 0
+  mov [r11], r10d
+  lea r10, [rbp-36564]
+  add r10, 0
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.171
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 319 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.172
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 320 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.173
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 321 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.174
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 322 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 12
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 12
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.175
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 323 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 16
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 16
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.176
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 324 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 24
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 24
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.177
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 325 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.178
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 326 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.179
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 327 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.180
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 329 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-36464]
+  lea r11, [rbp-36456]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-36457]
+  lea r11, [rbp-36448]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-36448]
+  mov r10, [r10]
+  lea r11, [rbp-36456]
+  mov r11, [r11]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.181
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 330 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-36429]
+  lea r11, [rbp-36424]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-36428]
+  lea r11, [rbp-36416]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-36416]
+  mov r10, [r10]
+  lea r11, [rbp-36424]
+  mov r11, [r11]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.182
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 332 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.183
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 333 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-36404]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-36400]
+  add r11, 0
+  mov [r11], r10d
+  lea r10, [rbp-36404]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-36400]
+  add r11, 0
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.184
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 335 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-36393]
+  lea r11, [rbp-36392]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 3
+  movsx r10, r10b
+  lea r11, [rbp-36393]
+  add r11, 0
+  mov [r11], r10b
+  lea r10, [rbp-36392]
+  mov r10, [r10]
+  add r10, 0
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.185
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 336 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-36377]
+  lea r11, [rbp-36376]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 3
+  movsx r10, r10b
+  lea r11, [rbp-36376]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10b
+  lea r10, [rbp-36377]
+  add r10, 0
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.186
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 338 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.187
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 339 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 515
+  mov r10d, r10d
+  lea r11, [rbp-36360]
+  add r11, 0
+  mov [r11], r10d
+  lea r10, [rbp-36360]
+  add r10, 0
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.188
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 340 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 515
+  mov r10d, r10d
+  lea r11, [rbp-36356]
+  add r11, 0
+  mov [r11], r10d
+  lea r10, [rbp-36356]
+  add r10, 0
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.189
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 341 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 515
+  mov r10d, r10d
+  lea r11, [rbp-36352]
+  add r11, 0
+  mov [r11], r10d
+  lea r10, [rbp-36352]
+  add r10, 0
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.190
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 342 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 515
+  mov r10d, r10d
+  lea r11, [rbp-36348]
+  add r11, 0
+  mov [r11], r10d
+  lea r10, [rbp-36348]
+  add r10, 0
+  mov r11, 3
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.191
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 344 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-36344]
+  add r11, 0
+  mov [r11], r10d
+  lea r10, [rbp-36344]
+  lea r11, [rbp-36336]
+  mov al, [r10+0]
+  mov [r11+0], al
+  mov al, [r10+1]
+  mov [r11+1], al
+  mov al, [r10+2]
+  mov [r11+2], al
+  mov al, [r10+3]
+  mov [r11+3], al
+  mov al, [r10+4]
+  mov [r11+4], al
+  mov al, [r10+5]
+  mov [r11+5], al
+  mov al, [r10+6]
+  mov [r11+6], al
+  mov al, [r10+7]
+  mov [r11+7], al
+  lea r10, [rbp-36336]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.192
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 345 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-36328]
+  add r11, 0
+  mov [r11], r10d
+  lea r10, [rbp-36328]
+  lea r11, [rbp-36320]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov al, [r10+0]
+  mov [r11+0], al
+  mov al, [r10+1]
+  mov [r11+1], al
+  mov al, [r10+2]
+  mov [r11+2], al
+  mov al, [r10+3]
+  mov [r11+3], al
+  mov al, [r10+4]
+  mov [r11+4], al
+  mov al, [r10+5]
+  mov [r11+5], al
+  mov al, [r10+6]
+  mov [r11+6], al
+  mov al, [r10+7]
+  mov [r11+7], al
+  lea r10, [rbp-36320]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.193
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 346 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 7
+  mov r10d, r10d
+  lea r11, [rbp-36312]
+  add r11, 0
+  mov [r11], r10d
+  lea r10, [rbp-36304]
+  lea r11, [rbp-36296]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-36312]
+  lea r11, [rbp-36296]
+  mov r11, [r11]
+  mov al, [r10+0]
+  mov [r11+0], al
+  mov al, [r10+1]
+  mov [r11+1], al
+  mov al, [r10+2]
+  mov [r11+2], al
+  mov al, [r10+3]
+  mov [r11+3], al
+  mov al, [r10+4]
+  mov [r11+4], al
+  mov al, [r10+5]
+  mov [r11+5], al
+  mov al, [r10+6]
+  mov [r11+6], al
+  mov al, [r10+7]
+  mov [r11+7], al
+  lea r10, [rbp-36304]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.194
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 347 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 7
+  mov r10d, r10d
+  lea r11, [rbp-36288]
+  add r11, 0
+  mov [r11], r10d
+  lea r10, [rbp-36288]
+  lea r11, [rbp-36272]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-36280]
+  lea r11, [rbp-36264]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-36272]
+  mov r10, [r10]
+  lea r11, [rbp-36264]
+  mov r11, [r11]
+  mov al, [r10+0]
+  mov [r11+0], al
+  mov al, [r10+1]
+  mov [r11+1], al
+  mov al, [r10+2]
+  mov [r11+2], al
+  mov al, [r10+3]
+  mov [r11+3], al
+  mov al, [r10+4]
+  mov [r11+4], al
+  mov al, [r10+5]
+  mov [r11+5], al
+  mov al, [r10+6]
+  mov [r11+6], al
+  mov al, [r10+7]
+  mov [r11+7], al
+  lea r10, [rbp-36280]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.195
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 349 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.196
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 350 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.197
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 352 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.198
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 353 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.199
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 355 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.200
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 356 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 16
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 16
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.201
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 358 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  movsx r10, r10w
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  movsx r10, r10w
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  movsx r10, r10w
+  push r10
+  sub rsp, 8
+  mov r10, offset sub_short
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.202
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 359 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset sub_long
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.203
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 361 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 24
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 24
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.204
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 362 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.205
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 363 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-36144]
+  lea r11, [rbp-36168]
+  mov r12, 0
+  mov r12d, r12d
+  mov r13, 8
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-36144]
+  mov [r11], r10d
+  lea r10, [rbp-36168]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.206
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 364 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-36140]
+  lea r11, [rbp-36128]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 4
+  mov r10d, r10d
+  lea r11, [rbp-36128]
+  mov r11, [r11]
+  mov r12, 0
+  mov r12d, r12d
+  mov r13, 12
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov r12, 0
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-36128]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 12
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.207
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 366 5
+.loc 1 368 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 1
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.208
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 369 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.209
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 370 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.210
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 371 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.211
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 372 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.212
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 373 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.213
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 375 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.214
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 377 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-36068]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-36068]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.215
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 378 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-36064]
+  add r11, 0
+  mov [r11], r10d
+  lea r10, [rbp-36064]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.216
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 379 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-36060]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-36060]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.217
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 380 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-36056]
+  add r11, 0
+  mov [r11], r10d
+  lea r10, [rbp-36056]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.218
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 381 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.219
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 382 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.220
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 383 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-36044]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-36044]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.221
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 384 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 16
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 16
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.222
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 386 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 1
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.223
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 387 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.224
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 388 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.225
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 389 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.226
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 390 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.227
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 391 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.228
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 392 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.229
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 393 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.230
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 394 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.231
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 395 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.232
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 396 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.233
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 397 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.234
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 398 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.235
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 399 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 32
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 32
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.236
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 400 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 16
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 16
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.237
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 401 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 48
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 48
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.238
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 402 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.239
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 404 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 131585
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8590066177
+  mov r10d, r10d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.240
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 405 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 513
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8590066177
+  movsx r10, r10w
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.241
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 406 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8590066177
+  movsx r10, r10b
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.242
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 407 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.243
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 408 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.244
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 409 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 513
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 512
+  mov r10d, r10d
+  lea r11, [rbp-36024]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  movsx r10, r10b
+  lea r11, [rbp-36024]
+  mov [r11], r10b
+  lea r10, [rbp-36024]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.245
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 410 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-36020]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-36020]
+  lea r11, [rbp-36016]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-36016]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.246
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 412 3
+  mov r10, 1
+.loc 1 414 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.247
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 415 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.248
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 416 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.249
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 417 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.250
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 419 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.251
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 420 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.252
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 421 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.253
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 422 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.254
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 423 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.255
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 424 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.256
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 425 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.257
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 426 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.258
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 428 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 5
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  mov r11, 5
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.259
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 429 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 15
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  mov r11, 5
+  movsx r11, r11d
+  sub r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.260
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 430 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 50
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  mov r11, 5
+  movsx r11, r11d
+  imul r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.261
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 431 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  mov r11, 5
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.262
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 433 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  sub r11d, r12d
+  movsx r11, r11d
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.263
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 434 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  sub r11d, r12d
+  movsx r11, r11d
+  cmp r10, r11
+  setle al
+  movzb r10, al
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.264
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 435 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 2
+  mov r12d, r12d
+  sub r11d, r12d
+  movsx r11, r11d
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.265
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 436 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 2
+  mov r12d, r12d
+  sub r11d, r12d
+  movsx r11, r11d
+  cmp r10, r11
+  setle al
+  movzb r10, al
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.266
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 438 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  sub r11d, r12d
+  movsx r11, r11d
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.267
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 439 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  sub r11d, r12d
+  movsx r11, r11d
+  cmp r10, r11
+  setle al
+  movzb r10, al
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.268
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 440 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 2
+  mov r12d, r12d
+  sub r11d, r12d
+  movsx r11, r11d
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.269
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 441 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 2
+  mov r12d, r12d
+  sub r11d, r12d
+  movsx r11, r11d
+  cmp r10, r11
+  setle al
+  movzb r10, al
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.270
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 443 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2147483647
+  mov r10d, r10d
+  mov r11, 2147483647
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.271
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 444 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  lea r11, [rbp-36008]
+  mov [r11], r10
+  lea r10, [rbp-36008]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.272
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 446 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-35995]
+  mov r12, 0
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 1
+  movsx r10, r10b
+  lea r11, [rbp-35995]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 2
+  movsx r10, r10b
+  lea r11, [rbp-35995]
+  mov r12, 2
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  lea r10, [rbp-35995]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35992]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-35992]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.273
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 447 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-35979]
+  mov r12, 0
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 1
+  movsx r10, r10b
+  lea r11, [rbp-35979]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 2
+  movsx r10, r10b
+  lea r11, [rbp-35979]
+  mov r12, 2
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  lea r10, [rbp-35979]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35976]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-35976]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  sub r11d, r12d
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.274
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 449 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset g1_ptr
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.275
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 450 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 261
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset int_to_char
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.276
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 452 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 5
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset div_long
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.277
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 454 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-35963]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  lea r10, [rbp-35963]
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.278
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 455 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-35962]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  lea r10, [rbp-35962]
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.279
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 456 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-35961]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  lea r10, [rbp-35961]
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.280
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 457 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.281
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 458 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.282
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 459 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 256
+  movsx r10, r10b
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.283
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 460 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset bool_fn_add
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.284
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 461 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset bool_fn_sub
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.285
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 462 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 3
+  mov r11d, r11d
+  sub r10d, r11d
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset bool_fn_add
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.286
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 463 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 3
+  mov r11d, r11d
+  sub r10d, r11d
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset bool_fn_sub
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.287
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 464 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset bool_fn_add
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.288
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 465 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset bool_fn_sub
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.289
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 467 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 97
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 97
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.290
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 468 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 10
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 10
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.291
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 469 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.292
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 471 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.293
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 472 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.294
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 473 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.295
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 474 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.296
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 475 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 6
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.297
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 476 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.298
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 477 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.299
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 478 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.300
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 479 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.301
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 480 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.302
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 481 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.303
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 483 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset static_fn
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.304
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 485 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 55
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-35952]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-35948]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.main.10:
+  lea r10, [rbp-35948]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.main.10
+  lea r10, [rbp-35952]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-35948]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35952]
+  mov [r11], r10d
+.L.continue.main.10:
+  lea r10, [rbp-35948]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35948]
+  mov [r11], r10d
+  jmp .L.begin.main.10
+.L.break.main.10:
+  lea r10, [rbp-35952]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.305
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 486 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-35944]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-35940]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-35936]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.main.11:
+  lea r10, [rbp-35936]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.main.11
+  lea r10, [rbp-35940]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-35936]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35940]
+  mov [r11], r10d
+.L.continue.main.11:
+  lea r10, [rbp-35936]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35936]
+  mov [r11], r10d
+  jmp .L.begin.main.11
+.L.break.main.11:
+  lea r10, [rbp-35944]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.306
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 488 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10, 2
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.307
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 489 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-35932]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-35928]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 6
+  mov r10d, r10d
+  mov r11, 5
+  mov r11d, r11d
+  lea r12, [rbp-35932]
+  mov [r12], r11d
+  lea r11, [rbp-35928]
+  mov [r11], r10d
+  lea r10, [rbp-35932]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.308
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 490 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-35924]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-35920]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 6
+  mov r10d, r10d
+  mov r11, 5
+  mov r11d, r11d
+  lea r12, [rbp-35924]
+  mov [r12], r11d
+  lea r11, [rbp-35920]
+  mov [r11], r10d
+  lea r10, [rbp-35920]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.309
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 492 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-35916]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35916]
+  lea r11, [rbp-35912]
+  mov [r11], r10
+  lea r10, [rbp-35912]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 5
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35912]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35916]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.310
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 493 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-35900]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35900]
+  lea r11, [rbp-35896]
+  mov [r11], r10
+  lea r10, [rbp-35896]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 5
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35896]
+  mov r11, [r11]
+  mov [r11], r10d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.311
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 494 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-35884]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35884]
+  lea r11, [rbp-35880]
+  mov [r11], r10
+  lea r10, [rbp-35880]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35880]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35884]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.312
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 495 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-35868]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35868]
+  lea r11, [rbp-35864]
+  mov [r11], r10
+  lea r10, [rbp-35864]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35864]
+  mov r11, [r11]
+  mov [r11], r10d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.313
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 496 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-35852]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35852]
+  lea r11, [rbp-35848]
+  mov [r11], r10
+  lea r10, [rbp-35848]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  imul r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35848]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35852]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.314
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 497 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-35836]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35836]
+  lea r11, [rbp-35832]
+  mov [r11], r10
+  lea r10, [rbp-35832]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  imul r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35832]
+  mov r11, [r11]
+  mov [r11], r10d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.315
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 498 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 6
+  mov r10d, r10d
+  lea r11, [rbp-35820]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35820]
+  lea r11, [rbp-35816]
+  mov [r11], r10
+  lea r10, [rbp-35816]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  mov eax, r10d
+  cdq
+  idiv r11d
+  mov r10d, eax
+  mov r10d, r10d
+  lea r11, [rbp-35816]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35820]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.316
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 499 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 6
+  mov r10d, r10d
+  lea r11, [rbp-35804]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35804]
+  lea r11, [rbp-35800]
+  mov [r11], r10
+  lea r10, [rbp-35800]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  mov eax, r10d
+  cdq
+  idiv r11d
+  mov r10d, eax
+  mov r10d, r10d
+  lea r11, [rbp-35800]
+  mov r11, [r11]
+  mov [r11], r10d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.317
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 501 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-35788]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35788]
+  lea r11, [rbp-35784]
+  mov [r11], r10
+  lea r10, [rbp-35784]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35784]
+  mov r11, [r11]
+  mov [r11], r10d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.318
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 502 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-35772]
+  mov r12, 0
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-35772]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-35772]
+  mov r12, 2
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35772]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35760]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-35760]
+  mov r10, [r10]
+  lea r11, [rbp-35752]
+  mov [r11], r10
+  lea r10, [rbp-35752]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35752]
+  mov r11, [r11]
+  mov [r11], r10d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.319
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 503 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-35740]
+  mov r12, 0
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-35740]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-35740]
+  mov r12, 2
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35740]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35728]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-35728]
+  mov r10, [r10]
+  lea r11, [rbp-35720]
+  mov [r11], r10
+  lea r10, [rbp-35720]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35720]
+  mov r11, [r11]
+  mov [r11], r10d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.320
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 505 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-35708]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35708]
+  lea r11, [rbp-35704]
+  mov [r11], r10
+  lea r10, [rbp-35704]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35704]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35704]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.321
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 506 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-35692]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35692]
+  lea r11, [rbp-35688]
+  mov [r11], r10
+  lea r10, [rbp-35688]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35688]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35688]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.322
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 507 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-35676]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35676]
+  lea r11, [rbp-35672]
+  mov [r11], r10
+  lea r10, [rbp-35672]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35672]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35672]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  lea r10, [rbp-35676]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.323
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 508 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-35660]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35660]
+  lea r11, [rbp-35656]
+  mov [r11], r10
+  lea r10, [rbp-35656]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35656]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35656]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  lea r10, [rbp-35660]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.324
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 509 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-35644]
+  mov r12, 0
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-35644]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-35644]
+  mov r12, 2
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35644]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35632]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-35632]
+  lea r11, [rbp-35624]
+  mov [r11], r10
+  lea r10, [rbp-35624]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35624]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-35624]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.325
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 510 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-35612]
+  mov r12, 0
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-35612]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-35612]
+  mov r12, 2
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35612]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35600]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-35600]
+  lea r11, [rbp-35592]
+  mov [r11], r10
+  lea r10, [rbp-35592]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35592]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-35592]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.326
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 512 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-35580]
+  mov r12, 0
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-35580]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-35580]
+  mov r12, 2
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35580]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35568]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-35568]
+  lea r11, [rbp-35560]
+  mov [r11], r10
+  lea r10, [rbp-35560]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35560]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-35560]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35552]
+  mov [r11], r10
+  lea r10, [rbp-35552]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35552]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35552]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  lea r10, [rbp-35580]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.327
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 513 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-35540]
+  mov r12, 0
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-35540]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-35540]
+  mov r12, 2
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35540]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35528]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-35528]
+  lea r11, [rbp-35520]
+  mov [r11], r10
+  lea r10, [rbp-35520]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35520]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-35520]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35512]
+  mov [r11], r10
+  lea r10, [rbp-35512]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35512]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35512]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  lea r10, [rbp-35540]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.328
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 514 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-35500]
+  mov r12, 0
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-35500]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-35500]
+  mov r12, 2
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35500]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35488]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-35488]
+  mov r10, [r10]
+  lea r11, [rbp-35480]
+  mov [r11], r10
+  lea r10, [rbp-35480]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35480]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35480]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  lea r10, [rbp-35500]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.329
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 515 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-35468]
+  mov r12, 0
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-35468]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-35468]
+  mov r12, 2
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35468]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35456]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-35456]
+  mov r10, [r10]
+  lea r11, [rbp-35448]
+  mov [r11], r10
+  lea r10, [rbp-35448]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35448]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35448]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  lea r10, [rbp-35456]
+  lea r11, [rbp-35440]
+  mov [r11], r10
+  lea r10, [rbp-35440]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35440]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-35440]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r10, [rbp-35456]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.330
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 517 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-35428]
+  mov r12, 0
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-35428]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-35428]
+  mov r12, 2
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35428]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35416]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-35416]
+  lea r11, [rbp-35408]
+  mov [r11], r10
+  lea r10, [rbp-35408]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35408]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-35408]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35400]
+  mov [r11], r10
+  lea r10, [rbp-35400]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35400]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35400]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  lea r10, [rbp-35428]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.331
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 518 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-35388]
+  mov r12, 0
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-35388]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-35388]
+  mov r12, 2
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35388]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35376]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-35376]
+  lea r11, [rbp-35368]
+  mov [r11], r10
+  lea r10, [rbp-35368]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35368]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-35368]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35360]
+  mov [r11], r10
+  lea r10, [rbp-35360]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35360]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35360]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  lea r10, [rbp-35388]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.332
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 519 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-35348]
+  mov r12, 0
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-35348]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-35348]
+  mov r12, 2
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35348]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35336]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-35336]
+  lea r11, [rbp-35328]
+  mov [r11], r10
+  lea r10, [rbp-35328]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35328]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-35328]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35320]
+  mov [r11], r10
+  lea r10, [rbp-35320]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35320]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35320]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  lea r10, [rbp-35348]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.333
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 520 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-35308]
+  mov r12, 0
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-35308]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-35308]
+  mov r12, 2
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35308]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35296]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-35296]
+  lea r11, [rbp-35288]
+  mov [r11], r10
+  lea r10, [rbp-35288]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35288]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-35288]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-35280]
+  mov [r11], r10
+  lea r10, [rbp-35280]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35280]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35280]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  lea r10, [rbp-35296]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.334
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 522 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 511
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 511
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.335
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 523 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.336
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 524 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 10
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 10
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.337
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 525 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 10
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 10
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.338
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 526 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 48879
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 48879
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.339
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 527 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 48879
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 48879
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.340
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 528 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 48879
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 48879
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.341
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 529 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.342
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 530 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.343
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 531 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 47
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 47
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.344
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 532 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 47
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 47
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.345
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 534 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.346
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 535 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.347
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 536 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.348
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 538 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  not r10
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.349
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 539 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  not r10
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.350
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 541 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 17
+  mov r10d, r10d
+  mov r11, 6
+  mov r11d, r11d
+  mov eax, r10d
+  cdq
+  idiv r11d
+  mov r10d, edx
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.351
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 542 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 17
+  movsx r10, r10d
+  mov r11, 6
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rdx
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.352
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 543 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 10
+  mov r10d, r10d
+  lea r11, [rbp-35268]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35268]
+  lea r11, [rbp-35264]
+  mov [r11], r10
+  lea r10, [rbp-35264]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  mov eax, r10d
+  cdq
+  idiv r11d
+  mov r10d, edx
+  mov r10d, r10d
+  lea r11, [rbp-35264]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35268]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.353
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 544 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 10
+  movsx r10, r10d
+  lea r11, [rbp-35256]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-35256]
+  lea r11, [rbp-35248]
+  mov [r11], r10
+  lea r10, [rbp-35248]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 4
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rdx
+  lea r11, [rbp-35248]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-35256]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.354
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 546 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  and r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.355
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 547 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  and r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.356
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 548 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 7
+  mov r10d, r10d
+  mov r11, 3
+  mov r11d, r11d
+  and r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.357
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 549 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 10
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  and r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.358
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 551 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  or r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.359
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 552 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 19
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 16
+  mov r10d, r10d
+  mov r11, 3
+  mov r11d, r11d
+  or r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.360
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 554 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  xor r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.361
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 555 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 15
+  mov r10d, r10d
+  mov r11, 15
+  mov r11d, r11d
+  xor r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.362
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 556 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 52
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 56
+  mov r10d, r10d
+  mov r11, 12
+  mov r11d, r11d
+  xor r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.363
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 558 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 6
+  mov r10d, r10d
+  lea r11, [rbp-35236]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35236]
+  lea r11, [rbp-35232]
+  mov [r11], r10
+  lea r10, [rbp-35232]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 3
+  mov r11d, r11d
+  and r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35232]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35236]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.364
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 559 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 6
+  mov r10d, r10d
+  lea r11, [rbp-35220]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35220]
+  lea r11, [rbp-35216]
+  mov [r11], r10
+  lea r10, [rbp-35216]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 3
+  mov r11d, r11d
+  or r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35216]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35220]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.365
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 560 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 10
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 15
+  mov r10d, r10d
+  lea r11, [rbp-35204]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-35204]
+  lea r11, [rbp-35200]
+  mov [r11], r10
+  lea r10, [rbp-35200]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 5
+  mov r11d, r11d
+  xor r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35200]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35204]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.366
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 562 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  cmp r10, 0
+  jne .L.true.main.12
+  mov r10, 1
+  cmp r10, 0
+  jne .L.true.main.12
+  mov r10, 0
+  jmp .L.end.main.12
+.L.true.main.12:
+  mov r10, 1
+.L.end.main.12:
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.367
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 563 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  cmp r10, 0
+  jne .L.true.main.14
+  mov r10, 2
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  sub r10d, r11d
+  cmp r10, 0
+  jne .L.true.main.14
+  mov r10, 0
+  jmp .L.end.main.14
+.L.true.main.14:
+  mov r10, 1
+.L.end.main.14:
+  cmp r10, 0
+  jne .L.true.main.13
+  mov r10, 5
+  cmp r10, 0
+  jne .L.true.main.13
+  mov r10, 0
+  jmp .L.end.main.13
+.L.true.main.13:
+  mov r10, 1
+.L.end.main.13:
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.368
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 564 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  cmp r10, 0
+  jne .L.true.main.15
+  mov r10, 0
+  cmp r10, 0
+  jne .L.true.main.15
+  mov r10, 0
+  jmp .L.end.main.15
+.L.true.main.15:
+  mov r10, 1
+.L.end.main.15:
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.369
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 565 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  cmp r10, 0
+  jne .L.true.main.16
+  mov r10, 2
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  sub r10d, r11d
+  cmp r10, 0
+  jne .L.true.main.16
+  mov r10, 0
+  jmp .L.end.main.16
+.L.true.main.16:
+  mov r10, 1
+.L.end.main.16:
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.370
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 567 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  cmp r10, 0
+  je .L.false.main.17
+  mov r10, 1
+  cmp r10, 0
+  je .L.false.main.17
+  mov r10, 1
+  jmp .L.end.main.17
+.L.false.main.17:
+  mov r10, 0
+.L.end.main.17:
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.371
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 568 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  sub r10d, r11d
+  cmp r10, 0
+  je .L.false.main.18
+  mov r10, 5
+  cmp r10, 0
+  je .L.false.main.18
+  mov r10, 1
+  jmp .L.end.main.18
+.L.false.main.18:
+  mov r10, 0
+.L.end.main.18:
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.372
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 569 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  cmp r10, 0
+  je .L.false.main.19
+  mov r10, 5
+  cmp r10, 0
+  je .L.false.main.19
+  mov r10, 1
+  jmp .L.end.main.19
+.L.false.main.19:
+  mov r10, 0
+.L.end.main.19:
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.373
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 571 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.374
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 572 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.375
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 574 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-35192]
+  mov r12, 0
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-35192]
+  push r10
+  sub rsp, 8
+  mov r10, offset param_decay
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.376
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 576 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.377
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 577 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.378
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 578 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-35152]
+  add r11, 8
+  mov [r11], r10d
+  lea r10, [rbp-35152]
+  lea r11, [rbp-35168]
+  add r11, 0
+  mov [r11], r10
+  lea r10, [rbp-35168]
+  add r10, 0
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.379
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 579 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.380
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 581 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-35132]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.main.20:
+  lea r10, [rbp-35132]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.main.20
+  lea r10, [rbp-35132]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 3
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.main.21
+  jmp .L.break.main.20
+.L.end.main.21:
+.L.continue.main.20:
+  lea r10, [rbp-35132]
+  lea r11, [rbp-35128]
+  mov [r11], r10
+  lea r10, [rbp-35128]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35128]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35128]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.main.20
+.L.break.main.20:
+  lea r10, [rbp-35132]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.381
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 582 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-35116]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.main.22:
+  mov r10, 1
+  cmp r10, 0
+  je .L.break.main.22
+  lea r10, [rbp-35116]
+  lea r11, [rbp-35112]
+  mov [r11], r10
+  lea r10, [rbp-35112]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35112]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35112]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov r11, 3
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.main.23
+  jmp .L.break.main.22
+.L.end.main.23:
+.L.continue.main.22:
+  jmp .L.begin.main.22
+.L.break.main.22:
+  lea r10, [rbp-35116]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.382
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 583 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-35100]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.main.24:
+  lea r10, [rbp-35100]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.main.24
+.L.begin.main.25:
+  jmp .L.break.main.25
+.L.continue.main.25:
+  jmp .L.begin.main.25
+.L.break.main.25:
+  lea r10, [rbp-35100]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 3
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.main.26
+  jmp .L.break.main.24
+.L.end.main.26:
+.L.continue.main.24:
+  lea r10, [rbp-35100]
+  lea r11, [rbp-35096]
+  mov [r11], r10
+  lea r10, [rbp-35096]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35096]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35096]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.main.24
+.L.break.main.24:
+  lea r10, [rbp-35100]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.383
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 584 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-35084]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.main.27:
+  mov r10, 1
+  cmp r10, 0
+  je .L.break.main.27
+.L.begin.main.28:
+  mov r10, 1
+  cmp r10, 0
+  je .L.break.main.28
+  jmp .L.break.main.28
+.L.continue.main.28:
+  jmp .L.begin.main.28
+.L.break.main.28:
+  lea r10, [rbp-35084]
+  lea r11, [rbp-35080]
+  mov [r11], r10
+  lea r10, [rbp-35080]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35080]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35080]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov r11, 3
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.main.29
+  jmp .L.break.main.27
+.L.end.main.29:
+.L.continue.main.27:
+  jmp .L.begin.main.27
+.L.break.main.27:
+  lea r10, [rbp-35084]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.384
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 586 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 10
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-35072]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-35068]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.main.30:
+  lea r10, [rbp-35072]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.main.30
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-35072]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.main.31
+  jmp .L.continue.main.30
+.L.end.main.31:
+  lea r10, [rbp-35068]
+  lea r11, [rbp-35056]
+  mov [r11], r10
+  lea r10, [rbp-35056]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35056]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35056]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.continue.main.30:
+  lea r10, [rbp-35072]
+  lea r11, [rbp-35064]
+  mov [r11], r10
+  lea r10, [rbp-35064]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35064]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35064]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.main.30
+.L.break.main.30:
+  lea r10, [rbp-35072]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.385
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 587 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-35048]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-35044]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.main.32:
+  lea r10, [rbp-35048]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.main.32
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-35048]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.main.33
+  jmp .L.continue.main.32
+.L.end.main.33:
+  lea r10, [rbp-35044]
+  lea r11, [rbp-35032]
+  mov [r11], r10
+  lea r10, [rbp-35032]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35032]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35032]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.continue.main.32:
+  lea r10, [rbp-35048]
+  lea r11, [rbp-35040]
+  mov [r11], r10
+  lea r10, [rbp-35040]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35040]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35040]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.main.32
+.L.break.main.32:
+  lea r10, [rbp-35044]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.386
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 588 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 10
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-35024]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-35020]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.main.34:
+  lea r10, [rbp-35024]
+  mov r10d, dword ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.break.main.34
+.L.begin.main.35:
+  lea r10, [rbp-35020]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.main.35
+  jmp .L.continue.main.35
+.L.continue.main.35:
+  lea r10, [rbp-35020]
+  lea r11, [rbp-35016]
+  mov [r11], r10
+  lea r10, [rbp-35016]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35016]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35016]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.main.35
+.L.break.main.35:
+  jmp .L.break.main.34
+.L.continue.main.34:
+  jmp .L.begin.main.34
+.L.break.main.34:
+  lea r10, [rbp-35020]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.387
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 589 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 11
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-35008]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-35004]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.main.36:
+  lea r10, [rbp-35008]
+  lea r11, [rbp-35000]
+  mov [r11], r10
+  lea r10, [rbp-35000]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-35000]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-35000]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.main.36
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-35008]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.main.37
+  jmp .L.continue.main.36
+.L.end.main.37:
+  lea r10, [rbp-35004]
+  lea r11, [rbp-34992]
+  mov [r11], r10
+  lea r10, [rbp-34992]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-34992]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-34992]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.continue.main.36:
+  jmp .L.begin.main.36
+.L.break.main.36:
+  lea r10, [rbp-35008]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.388
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 590 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34984]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34980]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.main.38:
+  lea r10, [rbp-34984]
+  lea r11, [rbp-34976]
+  mov [r11], r10
+  lea r10, [rbp-34976]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-34976]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-34976]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.main.38
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-34984]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.main.39
+  jmp .L.continue.main.38
+.L.end.main.39:
+  lea r10, [rbp-34980]
+  lea r11, [rbp-34968]
+  mov [r11], r10
+  lea r10, [rbp-34968]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-34968]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-34968]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.continue.main.38:
+  jmp .L.begin.main.38
+.L.break.main.38:
+  lea r10, [rbp-34980]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.389
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 591 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 11
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34960]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34956]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.main.40:
+  lea r10, [rbp-34960]
+  mov r10d, dword ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.break.main.40
+.L.begin.main.41:
+  lea r10, [rbp-34956]
+  lea r11, [rbp-34952]
+  mov [r11], r10
+  lea r10, [rbp-34952]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-34952]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-34952]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.main.41
+  jmp .L.continue.main.41
+.L.continue.main.41:
+  jmp .L.begin.main.41
+.L.break.main.41:
+  jmp .L.break.main.40
+.L.continue.main.40:
+  jmp .L.begin.main.40
+.L.break.main.40:
+  lea r10, [rbp-34956]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.390
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 593 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34940]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  jmp .L.label.main.a
+.L.label.main.a:
+  lea r10, [rbp-34940]
+  lea r11, [rbp-34936]
+  mov [r11], r10
+  lea r10, [rbp-34936]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-34936]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-34936]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.label.main.b:
+  lea r10, [rbp-34940]
+  lea r11, [rbp-34928]
+  mov [r11], r10
+  lea r10, [rbp-34928]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-34928]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-34928]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.label.main.c:
+  lea r10, [rbp-34940]
+  lea r11, [rbp-34920]
+  mov [r11], r10
+  lea r10, [rbp-34920]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-34920]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-34920]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  lea r10, [rbp-34940]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.391
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 594 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34908]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  jmp .L.label.main.e
+.L.label.main.d:
+  lea r10, [rbp-34908]
+  lea r11, [rbp-34904]
+  mov [r11], r10
+  lea r10, [rbp-34904]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-34904]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-34904]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.label.main.e:
+  lea r10, [rbp-34908]
+  lea r11, [rbp-34896]
+  mov [r11], r10
+  lea r10, [rbp-34896]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-34896]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-34896]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.label.main.f:
+  lea r10, [rbp-34908]
+  lea r11, [rbp-34888]
+  mov [r11], r10
+  lea r10, [rbp-34888]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-34888]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-34888]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  lea r10, [rbp-34908]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.392
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 595 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34876]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  jmp .L.label.main.i
+.L.label.main.g:
+  lea r10, [rbp-34876]
+  lea r11, [rbp-34872]
+  mov [r11], r10
+  lea r10, [rbp-34872]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-34872]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-34872]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.label.main.h:
+  lea r10, [rbp-34876]
+  lea r11, [rbp-34864]
+  mov [r11], r10
+  lea r10, [rbp-34864]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-34864]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-34864]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.label.main.i:
+  lea r10, [rbp-34876]
+  lea r11, [rbp-34856]
+  mov [r11], r10
+  lea r10, [rbp-34856]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-34856]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-34856]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  lea r10, [rbp-34876]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.393
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 597 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34844]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  cmp r10, 2
+  je .L.case.main.43
+  cmp r10, 1
+  je .L.case.main.44
+  cmp r10, 0
+  je .L.case.main.45
+  jmp .L.break.main.42
+.L.case.main.45:
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-34844]
+  mov [r11], r10d
+  jmp .L.break.main.42
+.L.case.main.44:
+  mov r10, 6
+  mov r10d, r10d
+  lea r11, [rbp-34844]
+  mov [r11], r10d
+  jmp .L.break.main.42
+.L.case.main.43:
+  mov r10, 7
+  mov r10d, r10d
+  lea r11, [rbp-34844]
+  mov [r11], r10d
+  jmp .L.break.main.42
+.L.break.main.42:
+  lea r10, [rbp-34844]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.394
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 598 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34840]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  cmp r10, 2
+  je .L.case.main.47
+  cmp r10, 1
+  je .L.case.main.48
+  cmp r10, 0
+  je .L.case.main.49
+  jmp .L.break.main.46
+.L.case.main.49:
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-34840]
+  mov [r11], r10d
+  jmp .L.break.main.46
+.L.case.main.48:
+  mov r10, 6
+  mov r10d, r10d
+  lea r11, [rbp-34840]
+  mov [r11], r10d
+  jmp .L.break.main.46
+.L.case.main.47:
+  mov r10, 7
+  mov r10d, r10d
+  lea r11, [rbp-34840]
+  mov [r11], r10d
+  jmp .L.break.main.46
+.L.break.main.46:
+  lea r10, [rbp-34840]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.395
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 599 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34836]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  cmp r10, 2
+  je .L.case.main.51
+  cmp r10, 1
+  je .L.case.main.52
+  cmp r10, 0
+  je .L.case.main.53
+  jmp .L.break.main.50
+.L.case.main.53:
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-34836]
+  mov [r11], r10d
+  jmp .L.break.main.50
+.L.case.main.52:
+  mov r10, 6
+  mov r10d, r10d
+  lea r11, [rbp-34836]
+  mov [r11], r10d
+  jmp .L.break.main.50
+.L.case.main.51:
+  mov r10, 7
+  mov r10d, r10d
+  lea r11, [rbp-34836]
+  mov [r11], r10d
+  jmp .L.break.main.50
+.L.break.main.50:
+  lea r10, [rbp-34836]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.396
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 600 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34832]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  cmp r10, 2
+  je .L.case.main.55
+  cmp r10, 1
+  je .L.case.main.56
+  cmp r10, 0
+  je .L.case.main.57
+  jmp .L.break.main.54
+.L.case.main.57:
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-34832]
+  mov [r11], r10d
+  jmp .L.break.main.54
+.L.case.main.56:
+  mov r10, 6
+  mov r10d, r10d
+  lea r11, [rbp-34832]
+  mov [r11], r10d
+  jmp .L.break.main.54
+.L.case.main.55:
+  mov r10, 7
+  mov r10d, r10d
+  lea r11, [rbp-34832]
+  mov [r11], r10d
+  jmp .L.break.main.54
+.L.break.main.54:
+  lea r10, [rbp-34832]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.397
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 601 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34828]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  cmp r10, 0
+  je .L.case.main.59
+  jmp .L.case.main.60
+  jmp .L.break.main.58
+.L.case.main.59:
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-34828]
+  mov [r11], r10d
+  jmp .L.break.main.58
+.L.case.main.60:
+  mov r10, 7
+  mov r10d, r10d
+  lea r11, [rbp-34828]
+  mov [r11], r10d
+.L.break.main.58:
+  lea r10, [rbp-34828]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.398
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 602 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34824]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  cmp r10, 0
+  je .L.case.main.62
+  jmp .L.case.main.63
+  jmp .L.break.main.61
+.L.case.main.62:
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-34824]
+  mov [r11], r10d
+  jmp .L.break.main.61
+.L.case.main.63:
+  mov r10, 7
+  mov r10d, r10d
+  lea r11, [rbp-34824]
+  mov [r11], r10d
+.L.break.main.61:
+  lea r10, [rbp-34824]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.399
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 603 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34820]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  cmp r10, 2
+  je .L.case.main.65
+  cmp r10, 1
+  je .L.case.main.66
+  cmp r10, 0
+  je .L.case.main.67
+  jmp .L.break.main.64
+.L.case.main.67:
+  mov r10, 0
+.L.case.main.66:
+  mov r10, 0
+.L.case.main.65:
+  mov r10, 0
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-34820]
+  mov [r11], r10d
+.L.break.main.64:
+  lea r10, [rbp-34820]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.400
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 604 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34816]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  cmp r10, 2
+  je .L.case.main.69
+  cmp r10, 1
+  je .L.case.main.70
+  cmp r10, 0
+  je .L.case.main.71
+  jmp .L.break.main.68
+.L.case.main.71:
+  mov r10, 0
+.L.case.main.70:
+  mov r10, 0
+.L.case.main.69:
+  mov r10, 0
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-34816]
+  mov [r11], r10d
+.L.break.main.68:
+  lea r10, [rbp-34816]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.401
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 606 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r11, 0
+  mov rcx, r11
+  shl r10d, cl
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.402
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 607 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r11, 3
+  mov rcx, r11
+  shl r10d, cl
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.403
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 608 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 10
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 5
+  mov r11, 1
+  mov rcx, r11
+  shl r10d, cl
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.404
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 609 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 5
+  mov r11, 1
+  mov rcx, r11
+  sar r10d, cl
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.405
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 610 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r11, 1
+  mov rcx, r11
+  sar r10d, cl
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.406
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 611 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-34812]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-34812]
+  lea r11, [rbp-34808]
+  mov [r11], r10
+  lea r10, [rbp-34808]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r11, 0
+  mov rcx, r11
+  shl r10d, cl
+  mov r10d, r10d
+  lea r11, [rbp-34808]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-34812]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.407
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 612 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-34796]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-34796]
+  lea r11, [rbp-34792]
+  mov [r11], r10
+  lea r10, [rbp-34792]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r11, 3
+  mov rcx, r11
+  shl r10d, cl
+  mov r10d, r10d
+  lea r11, [rbp-34792]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-34796]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.408
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 613 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 10
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-34780]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-34780]
+  lea r11, [rbp-34776]
+  mov [r11], r10
+  lea r10, [rbp-34776]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r11, 1
+  mov rcx, r11
+  shl r10d, cl
+  mov r10d, r10d
+  lea r11, [rbp-34776]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-34780]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.409
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 614 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-34764]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-34764]
+  lea r11, [rbp-34760]
+  mov [r11], r10
+  lea r10, [rbp-34760]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r11, 1
+  mov rcx, r11
+  sar r10d, cl
+  mov r10d, r10d
+  lea r11, [rbp-34760]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-34764]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.410
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 615 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.411
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 616 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-34752]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-34752]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.412
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 617 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-34748]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-34748]
+  lea r11, [rbp-34744]
+  mov [r11], r10
+  lea r10, [rbp-34744]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r11, 1
+  mov rcx, r11
+  sar r10d, cl
+  mov r10d, r10d
+  lea r11, [rbp-34744]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-34748]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.413
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 619 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  cmp r10, 0
+  je  .L.else.main.72
+  mov r10, 1
+  mov r10d, r10d
+  jmp .L.end.main.72
+.L.else.main.72:
+  mov r10, 2
+  mov r10d, r10d
+.L.end.main.72:
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.414
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 620 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  cmp r10, 0
+  je  .L.else.main.73
+  mov r10, 1
+  mov r10d, r10d
+  jmp .L.end.main.73
+.L.else.main.73:
+  mov r10, 2
+  mov r10d, r10d
+.L.end.main.73:
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.415
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 621 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  cmp r10, 0
+  je  .L.else.main.74
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  jmp .L.end.main.74
+.L.else.main.74:
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+.L.end.main.74:
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.416
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 622 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  cmp r10, 0
+  je  .L.else.main.75
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  jmp .L.end.main.75
+.L.else.main.75:
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+.L.end.main.75:
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.417
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 623 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.418
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 624 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.419
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 625 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  cmp r10, 0
+  je  .L.else.main.76
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  jmp .L.end.main.76
+.L.else.main.76:
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+.L.end.main.76:
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.420
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 626 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  cmp r10, 0
+  je  .L.else.main.77
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  jmp .L.end.main.77
+.L.else.main.77:
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+.L.end.main.77:
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.421
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 627 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  cmp r10, 0
+  je  .L.else.main.78
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  jmp .L.end.main.78
+.L.else.main.78:
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+.L.end.main.78:
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.422
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 628 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  cmp r10, 0
+  je  .L.else.main.79
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  jmp .L.end.main.79
+.L.else.main.79:
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+.L.end.main.79:
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.423
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 630 3
+  mov r10, 1
+  cmp r10, 0
+  je  .L.else.main.80
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  sub r10d, r11d
+  jmp .L.end.main.80
+.L.else.main.80:
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+.L.end.main.80:
+.loc 1 632 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 10
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 10
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.424
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 633 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34732]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  cmp r10, 3
+  je .L.case.main.82
+  jmp .L.break.main.81
+.L.case.main.82:
+  lea r10, [rbp-34732]
+  lea r11, [rbp-34728]
+  mov [r11], r10
+  lea r10, [rbp-34728]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-34728]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-34728]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.break.main.81:
+  lea r10, [rbp-34732]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.425
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 634 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.426
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 635 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 6
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.427
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 636 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 6
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.428
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 637 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 3
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.429
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 638 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.430
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 639 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 7
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.431
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 640 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 6
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.432
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 641 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.433
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 642 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.434
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 643 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.435
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 644 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 1
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.436
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 645 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 1
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.437
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 646 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.438
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 647 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.439
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 648 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 3
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.440
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 649 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 3
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.441
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 650 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.442
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 651 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 1
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.443
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 652 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.444
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 653 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.445
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 654 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 1
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.446
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 655 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.447
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 656 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 1
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.448
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 657 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 3
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.449
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 658 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 15
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 15
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.450
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 659 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 271
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 271
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.451
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 660 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.452
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 661 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.453
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 662 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 12
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 12
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.454
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 663 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 3
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.455
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 665 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-34328]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-34328]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-34328]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-34328]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.456
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 666 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-34316]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-34316]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-34316]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-34316]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.457
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 667 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-34304]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-34304]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-34304]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-34304]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.458
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 668 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-34292]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-34292]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-34292]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-34292]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.459
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 670 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-34280]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-34280]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-34280]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 4
+  mov r10d, r10d
+  lea r11, [rbp-34280]
+  mov r12, 12
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-34280]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 6
+  mov r10d, r10d
+  lea r11, [rbp-34280]
+  mov r12, 20
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-34280]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 12
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.460
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 671 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-34256]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-34256]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-34256]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 4
+  mov r10d, r10d
+  lea r11, [rbp-34256]
+  mov r12, 12
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-34256]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 6
+  mov r10d, r10d
+  lea r11, [rbp-34256]
+  mov r12, 20
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-34256]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 12
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.461
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 672 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-34232]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-34232]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-34232]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 4
+  mov r10d, r10d
+  lea r11, [rbp-34232]
+  mov r12, 12
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-34232]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 6
+  mov r10d, r10d
+  lea r11, [rbp-34232]
+  mov r12, 20
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-34232]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 12
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.462
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 674 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34208]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34208]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34208]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-34208]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.463
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 675 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34196]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34196]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34196]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-34196]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.464
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 676 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34184]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34184]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34184]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-34184]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.465
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 678 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-34172]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-34172]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34172]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34172]
+  mov r12, 12
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34172]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34172]
+  mov r12, 20
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-34172]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 12
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.466
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 679 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-34148]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-34148]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34148]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34148]
+  mov r12, 12
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34148]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34148]
+  mov r12, 20
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-34148]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 12
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.467
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 680 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-34124]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-34124]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34124]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34124]
+  mov r12, 12
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34124]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-34124]
+  mov r12, 20
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-34124]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 12
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.468
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 682 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 97
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 97
+  movsx r10, r10b
+  lea r11, [rbp-34100]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 98
+  movsx r10, r10b
+  lea r11, [rbp-34100]
+  mov r12, 1
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 99
+  movsx r10, r10b
+  lea r11, [rbp-34100]
+  mov r12, 2
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-34100]
+  mov r12, 3
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  lea r10, [rbp-34100]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.469
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 683 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 99
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 97
+  movsx r10, r10b
+  lea r11, [rbp-34096]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 98
+  movsx r10, r10b
+  lea r11, [rbp-34096]
+  mov r12, 1
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 99
+  movsx r10, r10b
+  lea r11, [rbp-34096]
+  mov r12, 2
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-34096]
+  mov r12, 3
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  lea r10, [rbp-34096]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.470
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 684 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 97
+  movsx r10, r10b
+  lea r11, [rbp-34092]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 98
+  movsx r10, r10b
+  lea r11, [rbp-34092]
+  mov r12, 1
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 99
+  movsx r10, r10b
+  lea r11, [rbp-34092]
+  mov r12, 2
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-34092]
+  mov r12, 3
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  lea r10, [rbp-34092]
+  mov r11, 3
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.471
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 685 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 97
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 97
+  movsx r10, r10b
+  lea r11, [rbp-34088]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 98
+  movsx r10, r10b
+  lea r11, [rbp-34088]
+  mov r12, 1
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 99
+  movsx r10, r10b
+  lea r11, [rbp-34088]
+  mov r12, 2
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-34088]
+  mov r12, 3
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 100
+  movsx r10, r10b
+  lea r11, [rbp-34088]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 101
+  movsx r10, r10b
+  lea r11, [rbp-34088]
+  mov r12, 5
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 102
+  movsx r10, r10b
+  lea r11, [rbp-34088]
+  mov r12, 6
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-34088]
+  mov r12, 7
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  lea r10, [rbp-34088]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.472
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 686 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 97
+  movsx r10, r10b
+  lea r11, [rbp-34080]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 98
+  movsx r10, r10b
+  lea r11, [rbp-34080]
+  mov r12, 1
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 99
+  movsx r10, r10b
+  lea r11, [rbp-34080]
+  mov r12, 2
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-34080]
+  mov r12, 3
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 100
+  movsx r10, r10b
+  lea r11, [rbp-34080]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 101
+  movsx r10, r10b
+  lea r11, [rbp-34080]
+  mov r12, 5
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 102
+  movsx r10, r10b
+  lea r11, [rbp-34080]
+  mov r12, 6
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-34080]
+  mov r12, 7
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  lea r10, [rbp-34080]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r11, 3
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.473
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 687 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 100
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 97
+  movsx r10, r10b
+  lea r11, [rbp-34072]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 98
+  movsx r10, r10b
+  lea r11, [rbp-34072]
+  mov r12, 1
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 99
+  movsx r10, r10b
+  lea r11, [rbp-34072]
+  mov r12, 2
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-34072]
+  mov r12, 3
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 100
+  movsx r10, r10b
+  lea r11, [rbp-34072]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 101
+  movsx r10, r10b
+  lea r11, [rbp-34072]
+  mov r12, 5
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 102
+  movsx r10, r10b
+  lea r11, [rbp-34072]
+  mov r12, 6
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-34072]
+  mov r12, 7
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  lea r10, [rbp-34072]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.474
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 688 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 102
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 97
+  movsx r10, r10b
+  lea r11, [rbp-34064]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 98
+  movsx r10, r10b
+  lea r11, [rbp-34064]
+  mov r12, 1
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 99
+  movsx r10, r10b
+  lea r11, [rbp-34064]
+  mov r12, 2
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-34064]
+  mov r12, 3
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 100
+  movsx r10, r10b
+  lea r11, [rbp-34064]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 101
+  movsx r10, r10b
+  lea r11, [rbp-34064]
+  mov r12, 5
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 102
+  movsx r10, r10b
+  lea r11, [rbp-34064]
+  mov r12, 6
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-34064]
+  mov r12, 7
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  lea r10, [rbp-34064]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.475
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 690 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-34056]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-34056]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-34056]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 4
+  mov r10d, r10d
+  lea r11, [rbp-34056]
+  mov r12, 12
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-34056]
+  mov r11, 3
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.476
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 691 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 16
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-34040]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-34040]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-34040]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 4
+  mov r10d, r10d
+  lea r11, [rbp-34040]
+  mov r12, 12
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  movabs r10, 16
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.477
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 692 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 102
+  movsx r10, r10b
+  lea r11, [rbp-34024]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 111
+  movsx r10, r10b
+  lea r11, [rbp-34024]
+  mov r12, 1
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 111
+  movsx r10, r10b
+  lea r11, [rbp-34024]
+  mov r12, 2
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-34024]
+  mov r12, 3
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.478
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 694 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-34020]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-34020]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-34020]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-34020]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.479
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 695 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-34008]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-34008]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-34008]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-34008]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.480
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 696 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-33996]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-33996]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-33996]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-33996]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.481
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 697 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-33984]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-33984]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-33984]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-33984]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.482
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 698 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-33972]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-33972]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-33972]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-33972]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.483
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 699 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-33960]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-33960]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-33960]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-33960]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.484
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 701 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-33948]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-33948]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-33948]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 4
+  mov r10d, r10d
+  lea r11, [rbp-33948]
+  mov r12, 12
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-33948]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.485
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 702 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-33932]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-33932]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-33932]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 4
+  mov r10d, r10d
+  lea r11, [rbp-33932]
+  mov r12, 12
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-33932]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.486
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 703 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-33916]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-33916]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-33916]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 4
+  mov r10d, r10d
+  lea r11, [rbp-33916]
+  mov r12, 12
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-33916]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.487
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 704 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-33900]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-33900]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-33900]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 4
+  mov r10d, r10d
+  lea r11, [rbp-33900]
+  mov r12, 12
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-33900]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.488
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 706 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-33884]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-33884]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-33884]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-33884]
+  mov r12, 12
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-33884]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.489
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 708 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-33868]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-33868]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-33868]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.490
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 709 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-33860]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-33860]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-33860]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.491
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 711 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-33852]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-33852]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-33852]
+  lea r11, [rbp-33844]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov al, [r10+0]
+  mov [r11+0], al
+  mov al, [r10+1]
+  mov [r11+1], al
+  mov al, [r10+2]
+  mov [r11+2], al
+  mov al, [r10+3]
+  mov [r11+3], al
+  mov al, [r10+4]
+  mov [r11+4], al
+  mov al, [r10+5]
+  mov [r11+5], al
+  mov al, [r10+6]
+  mov [r11+6], al
+  mov al, [r10+7]
+  mov [r11+7], al
+  lea r10, [rbp-33844]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.492
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 712 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-33836]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-33836]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-33836]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 4
+  mov r10d, r10d
+  lea r11, [rbp-33836]
+  mov r12, 12
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-33836]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 6
+  mov r10d, r10d
+  lea r11, [rbp-33836]
+  mov r12, 20
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-33836]
+  lea r11, [rbp-33812]
+  mov al, [r10+0]
+  mov [r11+0], al
+  mov al, [r10+1]
+  mov [r11+1], al
+  mov al, [r10+2]
+  mov [r11+2], al
+  mov al, [r10+3]
+  mov [r11+3], al
+  mov al, [r10+4]
+  mov [r11+4], al
+  mov al, [r10+5]
+  mov [r11+5], al
+  mov al, [r10+6]
+  mov [r11+6], al
+  mov al, [r10+7]
+  mov [r11+7], al
+  mov al, [r10+8]
+  mov [r11+8], al
+  mov al, [r10+9]
+  mov [r11+9], al
+  mov al, [r10+10]
+  mov [r11+10], al
+  mov al, [r10+11]
+  mov [r11+11], al
+  mov al, [r10+12]
+  mov [r11+12], al
+  mov al, [r10+13]
+  mov [r11+13], al
+  mov al, [r10+14]
+  mov [r11+14], al
+  mov al, [r10+15]
+  mov [r11+15], al
+  mov al, [r10+16]
+  mov [r11+16], al
+  mov al, [r10+17]
+  mov [r11+17], al
+  mov al, [r10+18]
+  mov [r11+18], al
+  mov al, [r10+19]
+  mov [r11+19], al
+  mov al, [r10+20]
+  mov [r11+20], al
+  mov al, [r10+21]
+  mov [r11+21], al
+  mov al, [r10+22]
+  mov [r11+22], al
+  mov al, [r10+23]
+  mov [r11+23], al
+  lea r10, [rbp-33812]
+  add r10, 16
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.493
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 713 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-33788]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-33788]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-33788]
+  lea r11, [rbp-33780]
+  mov al, [r10+0]
+  mov [r11+0], al
+  mov al, [r10+1]
+  mov [r11+1], al
+  mov al, [r10+2]
+  mov [r11+2], al
+  mov al, [r10+3]
+  mov [r11+3], al
+  mov al, [r10+4]
+  mov [r11+4], al
+  mov al, [r10+5]
+  mov [r11+5], al
+  mov al, [r10+6]
+  mov [r11+6], al
+  mov al, [r10+7]
+  mov [r11+7], al
+  lea r11, [rbp-33772]
+  mov al, [r10+0]
+  mov [r11+0], al
+  mov al, [r10+1]
+  mov [r11+1], al
+  mov al, [r10+2]
+  mov [r11+2], al
+  mov al, [r10+3]
+  mov [r11+3], al
+  mov al, [r10+4]
+  mov [r11+4], al
+  mov al, [r10+5]
+  mov [r11+5], al
+  mov al, [r10+6]
+  mov [r11+6], al
+  mov al, [r10+7]
+  mov [r11+7], al
+  lea r10, [rbp-33772]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.494
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 715 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g3
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.495
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 716 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g4
+  movsx r10d, word ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.496
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 717 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g5
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.497
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 718 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g6
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.498
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 720 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g9
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.499
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 721 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g9
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.500
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 722 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g9
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.501
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 724 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g11
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.502
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 725 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g11
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.503
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 726 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g11
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.504
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 727 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g11
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.505
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 729 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g12
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.506
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 730 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g12
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.507
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 731 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g12
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.508
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 732 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g12
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.509
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 734 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 7
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.510
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 735 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 10
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 10
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.511
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 736 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 3
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.512
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 738 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset g17
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.513
+  push r10
+  sub rsp, 8
+  mov r10, 7
+  push r10
+  sub rsp, 8
+  mov r10, offset memcmp
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.514
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 739 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset g18
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.515
+  push r10
+  sub rsp, 8
+  mov r10, 10
+  push r10
+  sub rsp, 8
+  mov r10, offset memcmp
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.516
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 740 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset g19
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.517
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  push r10
+  sub rsp, 8
+  mov r10, offset memcmp
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.518
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 742 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset g20
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.519
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.520
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 743 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset g21
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.521
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.522
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 744 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset g22
+  mov r10, [r10]
+  mov r11, 3
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.523
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.524
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 746 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset g23
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.525
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.526
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 747 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset g23
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.527
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.528
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 748 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset g23
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  mov r11, 3
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.529
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.530
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 750 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g24
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.531
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 751 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g25
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.532
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 752 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g27
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.533
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 754 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g30
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.534
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 755 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g30
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.535
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 756 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g30
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.536
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 757 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g30
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.537
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 759 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g31
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.538
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 760 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g31
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.539
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 761 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g31
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.540
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 762 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g31
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.541
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 764 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-33764]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-33764]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-33764]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-33764]
+  mov r12, 12
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 4
+  mov r10d, r10d
+  lea r11, [rbp-33764]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-33764]
+  mov r12, 20
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-33764]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 12
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.542
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 765 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-33740]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-33740]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-33740]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-33740]
+  mov r12, 12
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 4
+  mov r10d, r10d
+  lea r11, [rbp-33740]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-33740]
+  mov r12, 20
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-33740]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 12
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.543
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 767 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-33716]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-33716]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-33716]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-33716]
+  mov r12, 12
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-33716]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.544
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 768 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-33700]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-33700]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-33700]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-33700]
+  mov r12, 12
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-33700]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.545
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 770 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset g33
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.546
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.547
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 771 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset g33
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.548
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.549
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 772 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset g34
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.550
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.551
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 774 3
+  mov r10, 5
+  mov r10d, r10d
+  mov r11, offset ext1
+  mov [r11], r10d
+.loc 1 775 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset ext1
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.552
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 777 3
+  mov r10, offset ext1
+  mov r11, offset ext2
+  mov [r11], r10
+.loc 1 778 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset ext2
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.553
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 780 3
+.loc 1 782 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 1
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.554
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 783 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.555
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 784 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.556
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 785 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.557
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 786 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.558
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 787 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 1
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.559
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 788 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.560
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 789 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 1
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.561
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 790 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.562
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 792 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-33682]
+  lea r11, [rbp-33683]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.563
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 793 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-33673]
+  lea r11, [rbp-33681]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.564
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 794 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 32
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-33633]
+  lea r11, [rbp-33665]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.565
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 795 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 32
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-33576]
+  lea r11, [rbp-33608]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.566
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 796 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 16
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-33568]
+  add r10, 16
+  lea r11, [rbp-33568]
+  add r11, 0
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.567
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 797 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.568
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 798 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g_aligned1
+  mov r11, 512
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rdx
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.569
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 799 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset g_aligned2
+  mov r11, 512
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rdx
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.570
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 801 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset counter
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.571
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 802 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset counter
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.572
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 803 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset counter
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.573
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 805 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-33536]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-33536]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.575
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 806 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-33532]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-33532]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-33532]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-33532]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.577
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 807 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 97
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 97
+  movsx r10, r10b
+  lea r11, [rbp-33520]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-33520]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-33520]
+  add r10, 0
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.579
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 808 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-33512]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-33512]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-33508]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-33508]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.581
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 809 3
+  mov r10, 5
+  mov r10d, r10d
+  mov r11, 3
+  mov r11d, r11d
+  lea r12, [rbp-33504]
+  mov r13, 0
+  movsx r13, r13d
+  add r12, r13
+  mov [r12], r11d
+  lea r11, [rbp-33504]
+  mov [r11], r10d
+.loc 1 811 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset tree
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.583
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 812 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset tree
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.584
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 813 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset tree
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.585
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 814 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset tree
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.586
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 816 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset ret_none
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 818 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset ext3
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.587
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 820 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 6
+  mov r10d, r10d
+  lea r11, [rbp-33500]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-33500]
+  lea r11, [rbp-33496]
+  mov [r11], r10
+  lea r10, [rbp-33496]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 3
+  mov r11d, r11d
+  and r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-33496]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-33500]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.588
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 821 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 6
+  mov r10d, r10d
+  lea r11, [rbp-33484]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-33484]
+  lea r11, [rbp-33480]
+  mov [r11], r10
+  lea r10, [rbp-33480]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 3
+  mov r11d, r11d
+  or r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-33480]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-33484]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.589
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 822 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 10
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 15
+  mov r10d, r10d
+  lea r11, [rbp-33468]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-33468]
+  lea r11, [rbp-33464]
+  mov [r11], r10
+  lea r10, [rbp-33464]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 5
+  mov r11d, r11d
+  xor r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-33464]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-33468]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.590
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 824 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-33456]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-33452]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.main.83:
+  lea r10, [rbp-33452]
+  lea r11, [rbp-33448]
+  mov [r11], r10
+  lea r10, [rbp-33448]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-33448]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-33448]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.continue.main.83:
+  lea r10, [rbp-33456]
+  lea r11, [rbp-33440]
+  mov [r11], r10
+  lea r10, [rbp-33440]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-33440]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-33440]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov r11, 6
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.begin.main.83
+.L.break.main.83:
+  lea r10, [rbp-33452]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.591
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 825 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-33428]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-33424]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-33420]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.main.84:
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-33424]
+  lea r12, [rbp-33416]
+  mov [r12], r11
+  lea r11, [rbp-33416]
+  mov r11, [r11]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  add r11d, r12d
+  mov r11d, r11d
+  lea r12, [rbp-33416]
+  mov r12, [r12]
+  mov [r12], r11d
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.main.85
+  jmp .L.break.main.84
+.L.end.main.85:
+  jmp .L.continue.main.84
+  lea r10, [rbp-33420]
+  lea r11, [rbp-33408]
+  mov [r11], r10
+  lea r10, [rbp-33408]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-33408]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-33408]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.continue.main.84:
+  mov r10, 1
+  cmp r10, 0
+  jne .L.begin.main.84
+.L.break.main.84:
+  lea r10, [rbp-33424]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.592
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 827 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset true_fn
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.593
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 828 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset false_fn
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.594
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 830 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  push r10
+  sub rsp, 8
+  mov r10, offset add_all1
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.595
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 831 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  push r10
+  sub rsp, 8
+  mov r10, offset add_all1
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.596
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 833 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  push r10
+  sub rsp, 8
+  mov r10, offset add_all3
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.597
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 834 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  push r10
+  sub rsp, 8
+  mov r10, offset add_all3
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.598
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 836 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-33394]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.599
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.600
+  push r10
+  sub rsp, 8
+  mov r10, offset sprintf
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.601
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-33394]
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.602
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 838 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-33294]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.603
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.604
+  push r10
+  sub rsp, 8
+  mov r10, offset fmt
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.605
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-33294]
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.606
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 840 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 1
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.607
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 841 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 1
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.608
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 842 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 1
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.609
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 843 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 1
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.610
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 844 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 1
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.611
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 846 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.612
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 847 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.613
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 848 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.614
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 849 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.615
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 850 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.616
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 851 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.617
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 852 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.618
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 854 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.619
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 855 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.620
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 856 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.621
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 857 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.622
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 858 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.623
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 859 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.624
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 860 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.625
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 862 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.626
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 863 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.627
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 864 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.628
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 865 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.629
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 866 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.630
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 868 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.631
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 869 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.632
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 870 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.633
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 871 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.634
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 872 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.635
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 874 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 1
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.636
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 875 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.637
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 876 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.638
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 877 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.639
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 878 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 255
+  movsx r10, r10b
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.640
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 879 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 255
+  movsx r10, r10b
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.641
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 880 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 255
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 255
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.642
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 881 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 65535
+  movsx r10, r10w
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.643
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 882 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 65535
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 65535
+  movzx r10, r10w
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.644
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 883 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4294967295
+  mov r10d, r10d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.645
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 884 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  movabs r10, 4294967295
+  push r10
+  sub rsp, 8
+  movabs r10, 4294967295
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.646
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 886 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.647
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 887 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.648
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 888 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.649
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 889 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.650
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 890 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.651
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 892 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.652
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 893 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  mov r11d, r11d
+  cmp r10d, r11d
+  setb al
+  movzb r10d, al
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.653
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 894 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 254
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 127
+  movsx r10, r10b
+  mov r10d, r10d
+  mov r11, 127
+  movsx r11, r11b
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.654
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 895 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 65534
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 32767
+  movsx r10, r10w
+  mov r10d, r10d
+  mov r11, 32767
+  movsx r11, r11w
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.655
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 896 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r11, 1
+  mov rcx, r11
+  sar r10d, cl
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.656
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 897 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.657
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 898 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2147483647
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  mov r11, 1
+  mov rcx, r11
+  shr r10d, cl
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.658
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 899 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 50
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 100
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  mov eax, r10d
+  cdq
+  idiv r11d
+  mov r10d, eax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.659
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 900 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2147483598
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 100
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  mov eax, r10d
+  mov edx, 0
+  div r11d
+  mov r10d, eax
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.660
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 901 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  movabs r10, 9223372036854775758
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 100
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  mov r11, 2
+  movsx r11, r11d
+  mov rax, r10
+  mov rdx, 0
+  div r11
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.661
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 902 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  mov r11, 100
+  mov r11d, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.662
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 903 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 100
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  mov r11, 7
+  mov r11d, r11d
+  mov eax, r10d
+  cdq
+  idiv r11d
+  mov r10d, edx
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.663
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 904 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 100
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  mov r10d, r10d
+  mov r11, 7
+  mov r11d, r11d
+  mov eax, r10d
+  mov edx, 0
+  div r11d
+  mov r10d, edx
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.664
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 905 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 100
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  mov r11, 9
+  movsx r11, r11d
+  mov rax, r10
+  mov rdx, 0
+  div r11
+  mov r10, rdx
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.665
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 907 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 65535
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 65535
+  movzx r10, r10w
+  mov r10d, r10d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.666
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 908 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 65535
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 65535
+  movzx r10, r10w
+  lea r11, [rbp-33194]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10w
+  lea r10, [rbp-33194]
+  movzx r10d, word ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.667
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 909 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 65535
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 65535
+  movzx r10, r10w
+  lea r11, [rbp-33192]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10w
+  lea r10, [rbp-33192]
+  movzx r10d, word ptr [r10]
+  mov r10d, r10d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.668
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 911 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 65535
+  movsx r10, r10w
+  lea r11, [rbp-33190]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10w
+  lea r10, [rbp-33190]
+  movsx r10d, word ptr [r10]
+  mov r10d, r10d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.669
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 912 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 65535
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 65535
+  movzx r10, r10w
+  lea r11, [rbp-33188]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10w
+  lea r10, [rbp-33188]
+  movzx r10d, word ptr [r10]
+  mov r10d, r10d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.670
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 914 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.671
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 915 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.672
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 916 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.673
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 917 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.674
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 918 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.675
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 919 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.676
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 920 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.677
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 921 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.678
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 922 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.679
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 923 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.680
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 924 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.681
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 925 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.682
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 926 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.683
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 927 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, -1
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.684
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 928 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.685
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 930 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r11, 30
+  mov rcx, r11
+  shr r10d, cl
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.686
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 931 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  movabs r11, 1
+  sub r10, r11
+  mov r11, 62
+  mov rcx, r11
+  shr r10, cl
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.687
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 932 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  movabs r11, 1
+  sub r10, r11
+  mov r11, 62
+  mov rcx, r11
+  shr r10, cl
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.688
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 934 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, -1
+  mov r11, 63
+  mov rcx, r11
+  shr r10, cl
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.689
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 936 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 1
+  mov r11, 31
+  mov rcx, r11
+  shl r10, cl
+  mov r11, 31
+  mov rcx, r11
+  shr r10, cl
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.690
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 937 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 1
+  mov r11, 63
+  mov rcx, r11
+  shl r10, cl
+  mov r11, 63
+  mov rcx, r11
+  shr r10, cl
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.691
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 938 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 1
+  mov r11, 31
+  mov rcx, r11
+  shl r10, cl
+  mov r11, 31
+  mov rcx, r11
+  shr r10, cl
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.692
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 939 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 1
+  mov r11, 63
+  mov rcx, r11
+  shl r10, cl
+  mov r11, 63
+  mov rcx, r11
+  shr r10, cl
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.693
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 941 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.694
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 942 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 255
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 255
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.695
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 943 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 32783
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 32783
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.696
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 944 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 1
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.697
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 945 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 1
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.698
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 946 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.699
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 947 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 1
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.700
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 948 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 1
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.701
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 950 5
+.loc 1 951 5
+.loc 1 952 5
+.loc 1 953 5
+.loc 1 954 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-120]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-120]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.702
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 955 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 8
+  mov r10d, r10d
+  lea r11, [rbp-116]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-116]
+  lea r11, [rbp-112]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.703
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 956 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 6
+  mov r10d, r10d
+  lea r11, [rbp-100]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-100]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.704
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 958 5
+.loc 1 959 5
+.loc 1 960 5
+.loc 1 961 5
+.loc 1 962 5
+.loc 1 964 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset add2
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.705
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 965 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset add2
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.706
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 966 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset add2
+  movsx r10, r10d
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 5
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.707
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 967 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset fnptr
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.708
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 968 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset add2
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.709
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 972 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset include1
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.710
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 973 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset include2
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.711
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 977 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 4 7 23
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 977 28
+  mov r10, offset .L.data.712
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 980 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 5 5 23
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 980 28
+  mov r10, offset .L.data.713
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 984 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 7 6 23
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 984 28
+  mov r10, offset .L.data.714
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 989 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 8 6 23
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 989 28
+  mov r10, offset .L.data.715
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 992 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 210
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 991 18
+.loc 1 992 15
+  mov r10, 0
+  mov r10d, r10d
+.loc 9 1 4
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 9 2 4
+  mov r11, 2
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 9 3 4
+  mov r11, 3
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 9 4 4
+  mov r11, 4
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 9 5 4
+  mov r11, 5
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 9 6 4
+  mov r11, 6
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 9 7 4
+  mov r11, 7
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 9 8 4
+  mov r11, 8
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 9 9 4
+  mov r11, 9
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 9 10 4
+  mov r11, 10
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 9 11 4
+  mov r11, 11
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 9 12 4
+  mov r11, 12
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 9 13 4
+  mov r11, 13
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 9 14 4
+  mov r11, 14
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 9 15 4
+  mov r11, 15
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 9 16 4
+  mov r11, 16
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 9 17 4
+  mov r11, 17
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 9 18 4
+  mov r11, 18
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 9 19 4
+  mov r11, 19
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 9 20 4
+  mov r11, 20
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 994 12
+  mov r10, offset .L.data.716
+  push r10
+  sub rsp, 8
+.loc 1 992 3
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 997 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 20
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 996 18
+.loc 1 997 14
+  mov r10, 0
+  mov r10d, r10d
+.loc 10 1 7
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 10 2 7
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 10 3 7
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 10 4 7
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 10 5 7
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 10 6 7
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 10 7 7
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 10 8 7
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 10 9 7
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 10 10 8
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 10 11 8
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 10 12 8
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 10 13 8
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 10 14 8
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 10 15 8
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 10 16 8
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 10 17 8
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 10 18 8
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 10 19 8
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 10 20 8
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 999 12
+  mov r10, offset .L.data.717
+  push r10
+  sub rsp, 8
+.loc 1 997 3
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1002 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 210
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1001 18
+.loc 1 1002 15
+  mov r10, 0
+  mov r10d, r10d
+.loc 1 1001 22
+.loc 10 1 4
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 1 1001 22
+.loc 10 2 4
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 1 1001 22
+.loc 10 3 4
+  mov r11, 3
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 1 1001 22
+.loc 10 4 4
+  mov r11, 4
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 1 1001 22
+.loc 10 5 4
+  mov r11, 5
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 1 1001 22
+.loc 10 6 4
+  mov r11, 6
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 1 1001 22
+.loc 10 7 4
+  mov r11, 7
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 1 1001 22
+.loc 10 8 4
+  mov r11, 8
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 1 1001 22
+.loc 10 9 4
+  mov r11, 9
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 1 1001 22
+.loc 10 10 4
+  mov r11, 10
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 1 1001 22
+.loc 10 11 4
+  mov r11, 11
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 1 1001 22
+.loc 10 12 4
+  mov r11, 12
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 1 1001 22
+.loc 10 13 4
+  mov r11, 13
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 1 1001 22
+.loc 10 14 4
+  mov r11, 14
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 1 1001 22
+.loc 10 15 4
+  mov r11, 15
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 1 1001 22
+.loc 10 16 4
+  mov r11, 16
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 1 1001 22
+.loc 10 17 4
+  mov r11, 17
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 1 1001 22
+.loc 10 18 4
+  mov r11, 18
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 1 1001 22
+.loc 10 19 4
+  mov r11, 19
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 1 1001 22
+.loc 10 20 4
+  mov r11, 20
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1004 12
+  mov r10, offset .L.data.718
+  push r10
+  sub rsp, 8
+.loc 1 1002 3
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1017 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1019 5
+.loc 1 1017 13
+  mov r10, 1
+  mov r10d, r10d
+.loc 1 1019 7
+  mov r11, 2
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1021 7
+  mov r10, offset .L.data.719
+  push r10
+  sub rsp, 8
+.loc 1 1017 3
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1022 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1029 5
+.loc 1 1022 13
+  mov r10, 1
+  mov r10d, r10d
+.loc 1 1029 7
+  mov r11, 2
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1031 7
+  mov r10, offset .L.data.720
+  push r10
+  sub rsp, 8
+.loc 1 1022 3
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1033 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1046 10
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1049 10
+  mov r10, offset .L.data.721
+  push r10
+  sub rsp, 8
+.loc 1 1033 3
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1051 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1053 10
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1057 10
+  mov r10, offset .L.data.722
+  push r10
+  sub rsp, 8
+.loc 1 1051 3
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1059 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1065 5
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1069 5
+  mov r10, offset .L.data.723
+  push r10
+  sub rsp, 8
+.loc 1 1059 3
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1071 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1073 5
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1079 5
+  mov r10, offset .L.data.724
+  push r10
+  sub rsp, 8
+.loc 1 1071 3
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1081 13
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-60]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1084 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1083 12
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1084 17
+  mov r10, offset .L.data.725
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1086 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1085 12
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1086 17
+  mov r10, offset .L.data.726
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1088 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.727
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1091 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 12
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1090 15
+  mov r10, 3
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 1 1091 17
+  mov r11, 5
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.728
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1094 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 23
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1093 13
+  mov r10, 3
+  mov r10d, r10d
+.loc 1 1094 16
+.loc 1 1093 14
+  mov r11, 4
+  mov r11d, r11d
+.loc 1 1094 17
+  mov r12, 5
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.729
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1096 16
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+.loc 1 1100 10
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1097 12
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1098 14
+  mov r10, offset .L.data.730
+  push r10
+  sub rsp, 8
+.loc 1 1096 16
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1107 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1109 10
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1113 10
+  mov r10, offset .L.data.731
+  push r10
+  sub rsp, 8
+.loc 1 1107 3
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1116 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1120 10
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1122 10
+  mov r10, offset .L.data.732
+  push r10
+  sub rsp, 8
+.loc 1 1116 3
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1124 13
+  mov r10, 6
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1126 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 9
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1125 15
+  lea r10, [rbp-56]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 3
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1126 17
+  mov r10, offset .L.data.733
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1129 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 12
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1128 15
+.loc 1 1125 15
+  lea r10, [rbp-56]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 3
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.loc 1 1128 17
+  mov r11, 3
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1129 18
+  mov r10, offset .L.data.734
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1131 13
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1134 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 13
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1133 15
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+.loc 1 1132 15
+.loc 1 1133 17
+  mov r11, 2
+  mov r11d, r11d
+.loc 1 1132 17
+  mov r12, 5
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1134 18
+  mov r10, offset .L.data.735
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1136 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1140 10
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1142 10
+  mov r10, offset .L.data.736
+  push r10
+  sub rsp, 8
+.loc 1 1136 3
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1145 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1147 10
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1151 10
+  mov r10, offset .L.data.737
+  push r10
+  sub rsp, 8
+.loc 1 1145 3
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1153 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1155 10
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1159 10
+  mov r10, offset .L.data.738
+  push r10
+  sub rsp, 8
+.loc 1 1153 3
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1162 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1166 10
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1168 10
+  mov r10, offset .L.data.739
+  push r10
+  sub rsp, 8
+.loc 1 1162 3
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1179 13
+  mov r10, 5
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1180 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1178 14
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1180 19
+  mov r10, offset .L.data.740
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1181 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.741
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1184 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1183 12
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+.loc 1 1184 13
+  mov r10, offset ret3
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.742
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1187 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1186 18
+.loc 1 1187 16
+  mov r10, 3
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.743
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1190 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 24
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+.loc 1 1189 18
+.loc 1 1190 19
+  mov r11, 4
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov r11, 5
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.744
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1193 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 63
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1192 20
+.loc 1 1193 18
+  mov r10, 3
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  mov r12, 5
+  mov r12d, r12d
+  add r11d, r12d
+  mov r11d, r11d
+  imul r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.745
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1196 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 9
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 4
+  mov r10d, r10d
+  mov r11, 5
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.746
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1199 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 20
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1198 18
+.loc 1 1199 19
+  mov r10, 2
+  mov r10d, r10d
+  mov r11, 3
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  imul r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.747
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1202 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 12
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1201 18
+.loc 1 1202 19
+  mov r10, 2
+  mov r10, 3
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  imul r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.748
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1206 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 10
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1205 22
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+.loc 1 1206 17
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1205 16
+  mov r10, offset M9
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+.loc 1 1204 22
+.loc 1 1205 24
+  mov r11, 3
+  mov r11d, r11d
+.loc 1 1206 17
+  mov r12, 2
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.749
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1209 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 97
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1 1
+  mov r10, offset .L.data.750
+.loc 1 1209 30
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.751
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1210 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 33
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1 1
+  mov r10, offset .L.data.752
+.loc 1 1210 30
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.753
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1211 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 98
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1 1
+  mov r10, offset .L.data.754
+.loc 1 1211 30
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.755
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1212 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 32
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1 1
+  mov r10, offset .L.data.756
+.loc 1 1212 30
+  mov r11, 3
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.757
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1213 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 96
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1 1
+  mov r10, offset .L.data.758
+.loc 1 1213 30
+  mov r11, 4
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.759
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1214 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 34
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1 1
+  mov r10, offset .L.data.760
+.loc 1 1214 30
+  mov r11, 5
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.761
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1215 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 34
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1 1
+  mov r10, offset .L.data.762
+.loc 1 1215 30
+  mov r11, 6
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.763
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1216 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 99
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1 1
+  mov r10, offset .L.data.764
+.loc 1 1216 30
+  mov r11, 7
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.765
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1217 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1 1
+  mov r10, offset .L.data.766
+.loc 1 1217 28
+  mov r11, 8
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.767
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1220 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 15
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1 1
+  mov r10, 15
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1220 26
+  mov r10, offset .L.data.768
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1221 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 255
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1 1
+  mov r10, 255
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1221 29
+  mov r10, offset .L.data.769
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1222 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-44]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1 1
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1222 50
+  mov r10, offset .L.data.770
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1223 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.771
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1224 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.772
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1227 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 12
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1 1
+  mov r10, 12
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1227 25
+  mov r10, offset .L.data.773
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1230 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 21
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1 1
+  mov r10, 21
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1230 25
+  mov r10, offset .L.data.774
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1233 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 123
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1 1
+  mov r10, 123
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1233 30
+  mov r10, offset .L.data.775
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1234 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 13
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1 1
+  mov r10, 13
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1234 28
+  mov r10, offset .L.data.776
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1235 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 248
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1 1
+.loc 1 1235 24
+  mov r10, 2
+  mov r10d, r10d
+.loc 1 1 1
+  mov r11, 31
+  mov r11d, r11d
+  imul r10d, r11d
+.loc 1 1235 36
+  mov r11, 2
+  mov rcx, r11
+  shl r10d, cl
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.777
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1236 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 4
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.778
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1239 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.779
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1242 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1244 10
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1248 10
+  mov r10, offset .L.data.780
+  push r10
+  sub rsp, 8
+.loc 1 1242 3
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1251 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1253 10
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1257 10
+  mov r10, offset .L.data.781
+  push r10
+  sub rsp, 8
+.loc 1 1251 3
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1259 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1263 10
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1265 10
+  mov r10, offset .L.data.782
+  push r10
+  sub rsp, 8
+.loc 1 1259 3
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1267 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1271 10
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1273 10
+  mov r10, offset .L.data.783
+  push r10
+  sub rsp, 8
+.loc 1 1267 3
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1317 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1323 10
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1325 10
+  mov r10, offset .L.data.784
+  push r10
+  sub rsp, 8
+.loc 1 1317 3
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1327 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1329 10
+  mov r10, 5
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1333 10
+  mov r10, offset .L.data.785
+  push r10
+  sub rsp, 8
+.loc 1 1327 3
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1335 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 7
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-40]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.786
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1336 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 47
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 47
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.788
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1337 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1338 32
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.789
+  push r10
+  sub rsp, 8
+.loc 1 1337 3
+  mov r10, offset assert
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1340 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.790
+  push r10
+  sub rsp, 8
+  mov r10, offset printf
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1341 3
+  mov r10, 0
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.main
+.L.return.main:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
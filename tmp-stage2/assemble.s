@@ -0,0 +1,20322 @@
+.file 1 "assemble.c"
+.intel_syntax noprefix
+.bss
+.align 8
+cur_line:
+  .zero 8
+.align 8
+registers:
+  .zero 32
+.align 8
+fixups:
+  .zero 8
+.align 8
+data_relocs:
+  .zero 8
+.align 8
+text_relocs:
+  .zero 8
+.align 8
+source_file:
+  .zero 8
+.align 8
+sym_head:
+  .zero 40
+.align 8
+symbols:
+  .zero 32
+.align 4
+cur_sec:
+  .zero 4
+.align 4
+align:
+  .zero 12
+.align 8
+bss_size:
+  .zero 8
+.align 8
+data:
+  .zero 24
+.align 8
+text:
+  .zero 24
+.data
+.align 1
+.L.data.269:
+  .byte 127
+  .byte 69
+  .byte 76
+  .byte 70
+  .zero 1
+.align 1
+.L.data.258:
+  .byte 46
+  .byte 110
+  .byte 111
+  .byte 116
+  .byte 101
+  .byte 46
+  .byte 71
+  .byte 78
+  .byte 85
+  .byte 45
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 99
+  .byte 107
+  .zero 1
+.align 1
+.L.data.257:
+  .byte 46
+  .byte 115
+  .byte 104
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 116
+  .byte 97
+  .byte 98
+  .zero 1
+.align 1
+.L.data.256:
+  .byte 46
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 116
+  .byte 97
+  .byte 98
+  .zero 1
+.align 1
+.L.data.255:
+  .byte 46
+  .byte 115
+  .byte 121
+  .byte 109
+  .byte 116
+  .byte 97
+  .byte 98
+  .zero 1
+.align 1
+.L.data.254:
+  .byte 46
+  .byte 114
+  .byte 101
+  .byte 108
+  .byte 97
+  .byte 46
+  .byte 100
+  .byte 97
+  .byte 116
+  .byte 97
+  .zero 1
+.align 1
+.L.data.253:
+  .byte 46
+  .byte 114
+  .byte 101
+  .byte 108
+  .byte 97
+  .byte 46
+  .byte 116
+  .byte 101
+  .byte 120
+  .byte 116
+  .zero 1
+.align 1
+.L.data.252:
+  .byte 46
+  .byte 98
+  .byte 115
+  .byte 115
+  .zero 1
+.align 1
+.L.data.251:
+  .byte 46
+  .byte 100
+  .byte 97
+  .byte 116
+  .byte 97
+  .zero 1
+.align 1
+.L.data.250:
+  .byte 46
+  .byte 116
+  .byte 101
+  .byte 120
+  .byte 116
+  .zero 1
+.align 1
+.L.data.249:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 110
+  .byte 97
+  .byte 108
+  .byte 32
+  .byte 101
+  .byte 114
+  .byte 114
+  .byte 111
+  .byte 114
+  .byte 58
+  .byte 32
+  .byte 117
+  .byte 110
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 105
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 115
+  .byte 121
+  .byte 109
+  .byte 98
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.248:
+  .byte 117
+  .byte 110
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 105
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 106
+  .byte 117
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 116
+  .byte 97
+  .byte 114
+  .byte 103
+  .byte 101
+  .byte 116
+  .zero 1
+.align 1
+.L.data.247:
+  .byte 116
+  .byte 111
+  .byte 111
+  .byte 32
+  .byte 109
+  .byte 97
+  .byte 110
+  .byte 121
+  .byte 32
+  .byte 111
+  .byte 112
+  .byte 101
+  .byte 114
+  .byte 97
+  .byte 110
+  .byte 100
+  .byte 115
+  .zero 1
+.align 1
+.L.data.246:
+  .byte 117
+  .byte 110
+  .byte 107
+  .byte 110
+  .byte 111
+  .byte 119
+  .byte 110
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 105
+  .byte 111
+  .byte 110
+  .zero 1
+.align 1
+.L.data.245:
+  .byte 117
+  .byte 110
+  .byte 107
+  .byte 110
+  .byte 111
+  .byte 119
+  .byte 110
+  .byte 32
+  .byte 100
+  .byte 105
+  .byte 114
+  .byte 101
+  .byte 99
+  .byte 116
+  .byte 105
+  .byte 118
+  .byte 101
+  .zero 1
+.align 1
+.L.data.244:
+  .byte 46
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 101
+  .byte 108
+  .byte 95
+  .byte 115
+  .byte 121
+  .byte 110
+  .byte 116
+  .byte 97
+  .byte 120
+  .zero 1
+.align 1
+.L.data.243:
+  .byte 46
+  .byte 108
+  .byte 111
+  .byte 99
+  .zero 1
+.align 1
+.L.data.242:
+  .byte 46
+  .byte 102
+  .byte 105
+  .byte 108
+  .byte 101
+  .zero 1
+.align 1
+.L.data.241:
+  .byte 46
+  .byte 113
+  .byte 117
+  .byte 97
+  .byte 100
+  .zero 1
+.align 1
+.L.data.240:
+  .byte 46
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .zero 1
+.align 1
+.L.data.239:
+  .byte 46
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .zero 1
+.align 1
+.L.data.238:
+  .byte 46
+  .byte 98
+  .byte 121
+  .byte 116
+  .byte 101
+  .zero 1
+.align 1
+.L.data.237:
+  .byte 46
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .zero 1
+.align 1
+.L.data.236:
+  .byte 46
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .zero 1
+.align 1
+.L.data.235:
+  .byte 46
+  .byte 103
+  .byte 108
+  .byte 111
+  .byte 98
+  .byte 108
+  .zero 1
+.align 1
+.L.data.234:
+  .byte 46
+  .byte 98
+  .byte 115
+  .byte 115
+  .zero 1
+.align 1
+.L.data.233:
+  .byte 46
+  .byte 100
+  .byte 97
+  .byte 116
+  .byte 97
+  .zero 1
+.align 1
+.L.data.232:
+  .byte 46
+  .byte 116
+  .byte 101
+  .byte 120
+  .byte 116
+  .zero 1
+.align 1
+.L.data.231:
+  .byte 115
+  .byte 121
+  .byte 109
+  .byte 98
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 114
+  .byte 101
+  .byte 102
+  .byte 101
+  .byte 114
+  .byte 101
+  .byte 110
+  .byte 99
+  .byte 101
+  .byte 32
+  .byte 109
+  .byte 117
+  .byte 115
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 101
+  .byte 32
+  .byte 56
+  .byte 32
+  .byte 98
+  .byte 121
+  .byte 116
+  .byte 101
+  .byte 115
+  .zero 1
+.align 1
+.L.data.230:
+  .byte 100
+  .byte 97
+  .byte 116
+  .byte 97
+  .byte 32
+  .byte 100
+  .byte 105
+  .byte 114
+  .byte 101
+  .byte 99
+  .byte 116
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 32
+  .byte 111
+  .byte 117
+  .byte 116
+  .byte 115
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 32
+  .byte 46
+  .byte 100
+  .byte 97
+  .byte 116
+  .byte 97
+  .zero 1
+.align 1
+.L.data.229:
+  .byte 117
+  .byte 110
+  .byte 107
+  .byte 110
+  .byte 111
+  .byte 119
+  .byte 110
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 105
+  .byte 111
+  .byte 110
+  .zero 1
+.align 1
+.L.data.228:
+  .byte 99
+  .byte 100
+  .byte 113
+  .zero 1
+.align 1
+.L.data.227:
+  .byte 99
+  .byte 113
+  .byte 111
+  .zero 1
+.align 1
+.L.data.226:
+  .byte 114
+  .byte 101
+  .byte 116
+  .zero 1
+.align 1
+.L.data.225:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 111
+  .byte 112
+  .byte 101
+  .byte 114
+  .byte 97
+  .byte 110
+  .byte 100
+  .zero 1
+.align 1
+.L.data.224:
+  .byte 112
+  .byte 111
+  .byte 112
+  .zero 1
+.align 1
+.L.data.223:
+  .byte 112
+  .byte 117
+  .byte 115
+  .byte 104
+  .zero 1
+.align 1
+.L.data.222:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 111
+  .byte 112
+  .byte 101
+  .byte 114
+  .byte 97
+  .byte 110
+  .byte 100
+  .zero 1
+.align 1
+.L.data.221:
+  .byte 99
+  .byte 97
+  .byte 108
+  .byte 108
+  .zero 1
+.align 1
+.L.data.220:
+  .byte 106
+  .byte 109
+  .byte 112
+  .zero 1
+.align 1
+.L.data.219:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 111
+  .byte 112
+  .byte 101
+  .byte 114
+  .byte 97
+  .byte 110
+  .byte 100
+  .zero 1
+.align 1
+.L.data.218:
+  .byte 115
+  .byte 101
+  .byte 116
+  .zero 1
+.align 1
+.L.data.217:
+  .byte 115
+  .byte 97
+  .byte 114
+  .zero 1
+.align 1
+.L.data.216:
+  .byte 115
+  .byte 104
+  .byte 114
+  .zero 1
+.align 1
+.L.data.215:
+  .byte 115
+  .byte 104
+  .byte 108
+  .zero 1
+.align 1
+.L.data.214:
+  .byte 105
+  .byte 100
+  .byte 105
+  .byte 118
+  .zero 1
+.align 1
+.L.data.213:
+  .byte 100
+  .byte 105
+  .byte 118
+  .zero 1
+.align 1
+.L.data.212:
+  .byte 110
+  .byte 111
+  .byte 116
+  .zero 1
+.align 1
+.L.data.211:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 111
+  .byte 112
+  .byte 101
+  .byte 114
+  .byte 97
+  .byte 110
+  .byte 100
+  .zero 1
+.align 1
+.L.data.210:
+  .byte 105
+  .byte 109
+  .byte 117
+  .byte 108
+  .zero 1
+.align 1
+.L.data.209:
+  .byte 99
+  .byte 109
+  .byte 112
+  .zero 1
+.align 1
+.L.data.208:
+  .byte 120
+  .byte 111
+  .byte 114
+  .zero 1
+.align 1
+.L.data.207:
+  .byte 115
+  .byte 117
+  .byte 98
+  .zero 1
+.align 1
+.L.data.206:
+  .byte 97
+  .byte 110
+  .byte 100
+  .zero 1
+.align 1
+.L.data.205:
+  .byte 115
+  .byte 98
+  .byte 98
+  .zero 1
+.align 1
+.L.data.204:
+  .byte 97
+  .byte 100
+  .byte 99
+  .zero 1
+.align 1
+.L.data.203:
+  .byte 111
+  .byte 114
+  .zero 1
+.align 1
+.L.data.202:
+  .byte 97
+  .byte 100
+  .byte 100
+  .zero 1
+.align 1
+.L.data.201:
+  .byte 99
+  .byte 109
+  .byte 112
+  .zero 1
+.align 1
+.L.data.200:
+  .byte 120
+  .byte 111
+  .byte 114
+  .zero 1
+.align 1
+.L.data.199:
+  .byte 115
+  .byte 117
+  .byte 98
+  .zero 1
+.align 1
+.L.data.198:
+  .byte 97
+  .byte 110
+  .byte 100
+  .zero 1
+.align 1
+.L.data.197:
+  .byte 115
+  .byte 98
+  .byte 98
+  .zero 1
+.align 1
+.L.data.196:
+  .byte 97
+  .byte 100
+  .byte 99
+  .zero 1
+.align 1
+.L.data.195:
+  .byte 111
+  .byte 114
+  .zero 1
+.align 1
+.L.data.194:
+  .byte 97
+  .byte 100
+  .byte 100
+  .zero 1
+.align 8
+.L.data.193:
+  .quad .L.data.202+0
+  .quad .L.data.203+0
+  .quad .L.data.204+0
+  .quad .L.data.205+0
+  .quad .L.data.206+0
+  .quad .L.data.207+0
+  .quad .L.data.208+0
+  .quad .L.data.209+0
+.align 1
+.L.data.192:
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 122
+  .byte 98
+  .zero 1
+.align 1
+.L.data.191:
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 122
+  .byte 120
+  .zero 1
+.align 1
+.L.data.190:
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 115
+  .byte 120
+  .zero 1
+.align 1
+.L.data.189:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 111
+  .byte 112
+  .byte 101
+  .byte 114
+  .byte 97
+  .byte 110
+  .byte 100
+  .zero 1
+.align 1
+.L.data.188:
+  .byte 108
+  .byte 101
+  .byte 97
+  .zero 1
+.align 1
+.L.data.187:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 111
+  .byte 112
+  .byte 101
+  .byte 114
+  .byte 97
+  .byte 110
+  .byte 100
+  .zero 1
+.align 1
+.L.data.186:
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 97
+  .byte 98
+  .byte 115
+  .zero 1
+.align 1
+.L.data.185:
+  .byte 109
+  .byte 111
+  .byte 118
+  .zero 1
+.align 1
+.L.data.184:
+  .byte 105
+  .byte 110
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 105
+  .byte 111
+  .byte 110
+  .byte 32
+  .byte 111
+  .byte 117
+  .byte 116
+  .byte 115
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 32
+  .byte 46
+  .byte 116
+  .byte 101
+  .byte 120
+  .byte 116
+  .zero 1
+.align 1
+.L.data.183:
+  .byte 119
+  .byte 114
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 98
+  .byte 101
+  .byte 114
+  .byte 32
+  .byte 111
+  .byte 102
+  .byte 32
+  .byte 111
+  .byte 112
+  .byte 101
+  .byte 114
+  .byte 97
+  .byte 110
+  .byte 100
+  .byte 115
+  .zero 1
+.align 1
+.L.data.182:
+  .byte 103
+  .zero 1
+.align 1
+.L.data.181:
+  .byte 108
+  .byte 101
+  .zero 1
+.align 1
+.L.data.180:
+  .byte 103
+  .byte 101
+  .zero 1
+.align 1
+.L.data.179:
+  .byte 108
+  .zero 1
+.align 1
+.L.data.178:
+  .byte 110
+  .byte 112
+  .zero 1
+.align 1
+.L.data.177:
+  .byte 112
+  .zero 1
+.align 1
+.L.data.176:
+  .byte 110
+  .byte 115
+  .zero 1
+.align 1
+.L.data.175:
+  .byte 115
+  .zero 1
+.align 1
+.L.data.174:
+  .byte 97
+  .zero 1
+.align 1
+.L.data.173:
+  .byte 98
+  .byte 101
+  .zero 1
+.align 1
+.L.data.172:
+  .byte 110
+  .byte 101
+  .zero 1
+.align 1
+.L.data.171:
+  .byte 101
+  .zero 1
+.align 1
+.L.data.170:
+  .byte 97
+  .byte 101
+  .zero 1
+.align 1
+.L.data.169:
+  .byte 98
+  .zero 1
+.align 1
+.L.data.168:
+  .byte 110
+  .byte 111
+  .zero 1
+.align 1
+.L.data.167:
+  .byte 111
+  .zero 1
+.align 1
+.L.data.166:
+  .byte 103
+  .zero 1
+.align 1
+.L.data.165:
+  .byte 108
+  .byte 101
+  .zero 1
+.align 1
+.L.data.164:
+  .byte 103
+  .byte 101
+  .zero 1
+.align 1
+.L.data.163:
+  .byte 108
+  .zero 1
+.align 1
+.L.data.162:
+  .byte 110
+  .byte 112
+  .zero 1
+.align 1
+.L.data.161:
+  .byte 112
+  .zero 1
+.align 1
+.L.data.160:
+  .byte 110
+  .byte 115
+  .zero 1
+.align 1
+.L.data.159:
+  .byte 115
+  .zero 1
+.align 1
+.L.data.158:
+  .byte 97
+  .zero 1
+.align 1
+.L.data.157:
+  .byte 98
+  .byte 101
+  .zero 1
+.align 1
+.L.data.156:
+  .byte 110
+  .byte 101
+  .zero 1
+.align 1
+.L.data.155:
+  .byte 101
+  .zero 1
+.align 1
+.L.data.154:
+  .byte 97
+  .byte 101
+  .zero 1
+.align 1
+.L.data.153:
+  .byte 98
+  .zero 1
+.align 1
+.L.data.152:
+  .byte 110
+  .byte 111
+  .zero 1
+.align 1
+.L.data.151:
+  .byte 111
+  .zero 1
+.align 8
+.L.data.150:
+  .quad .L.data.167+0
+  .quad .L.data.168+0
+  .quad .L.data.169+0
+  .quad .L.data.170+0
+  .quad .L.data.171+0
+  .quad .L.data.172+0
+  .quad .L.data.173+0
+  .quad .L.data.174+0
+  .quad .L.data.175+0
+  .quad .L.data.176+0
+  .quad .L.data.177+0
+  .quad .L.data.178+0
+  .quad .L.data.179+0
+  .quad .L.data.180+0
+  .quad .L.data.181+0
+  .quad .L.data.182+0
+.align 1
+.L.data.149:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 106
+  .byte 117
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 116
+  .byte 97
+  .byte 114
+  .byte 103
+  .byte 101
+  .byte 116
+  .zero 1
+.align 1
+.L.data.148:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 111
+  .byte 112
+  .byte 101
+  .byte 114
+  .byte 97
+  .byte 110
+  .byte 100
+  .zero 1
+.align 1
+.L.data.147:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 111
+  .byte 112
+  .byte 101
+  .byte 114
+  .byte 97
+  .byte 110
+  .byte 100
+  .zero 1
+.align 1
+.L.data.146:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 111
+  .byte 112
+  .byte 101
+  .byte 114
+  .byte 97
+  .byte 110
+  .byte 100
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .zero 1
+.align 1
+.L.data.145:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 111
+  .byte 112
+  .byte 101
+  .byte 114
+  .byte 97
+  .byte 110
+  .byte 100
+  .zero 1
+.align 1
+.L.data.144:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 111
+  .byte 112
+  .byte 101
+  .byte 114
+  .byte 97
+  .byte 110
+  .byte 100
+  .zero 1
+.align 1
+.L.data.143:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 111
+  .byte 112
+  .byte 101
+  .byte 114
+  .byte 97
+  .byte 110
+  .byte 100
+  .zero 1
+.align 1
+.L.data.142:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 111
+  .byte 112
+  .byte 101
+  .byte 114
+  .byte 97
+  .byte 110
+  .byte 100
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .zero 1
+.align 1
+.L.data.141:
+  .byte 117
+  .byte 110
+  .byte 107
+  .byte 110
+  .byte 111
+  .byte 119
+  .byte 110
+  .byte 32
+  .byte 111
+  .byte 112
+  .byte 101
+  .byte 114
+  .byte 97
+  .byte 110
+  .byte 100
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .zero 1
+.align 1
+.L.data.140:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 111
+  .byte 112
+  .byte 101
+  .byte 114
+  .byte 97
+  .byte 110
+  .byte 100
+  .zero 1
+.align 1
+.L.data.139:
+  .byte 111
+  .byte 102
+  .byte 102
+  .byte 115
+  .byte 101
+  .byte 116
+  .byte 32
+  .zero 1
+.align 1
+.L.data.138:
+  .byte 113
+  .byte 119
+  .byte 111
+  .byte 114
+  .byte 100
+  .byte 32
+  .byte 112
+  .byte 116
+  .byte 114
+  .byte 32
+  .zero 1
+.align 1
+.L.data.137:
+  .byte 100
+  .byte 119
+  .byte 111
+  .byte 114
+  .byte 100
+  .byte 32
+  .byte 112
+  .byte 116
+  .byte 114
+  .byte 32
+  .zero 1
+.align 1
+.L.data.136:
+  .byte 119
+  .byte 111
+  .byte 114
+  .byte 100
+  .byte 32
+  .byte 112
+  .byte 116
+  .byte 114
+  .byte 32
+  .zero 1
+.align 1
+.L.data.135:
+  .byte 98
+  .byte 121
+  .byte 116
+  .byte 101
+  .byte 32
+  .byte 112
+  .byte 116
+  .byte 114
+  .byte 32
+  .zero 1
+.align 1
+.L.data.133:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 98
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 114
+  .byte 101
+  .byte 103
+  .byte 105
+  .byte 115
+  .byte 116
+  .byte 101
+  .byte 114
+  .zero 1
+.align 1
+.L.data.132:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 109
+  .byte 101
+  .byte 109
+  .byte 111
+  .byte 114
+  .byte 121
+  .byte 32
+  .byte 111
+  .byte 112
+  .byte 101
+  .byte 114
+  .byte 97
+  .byte 110
+  .byte 100
+  .zero 1
+.align 1
+.L.data.131:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 98
+  .byte 101
+  .byte 114
+  .zero 1
+.align 1
+.L.data.130:
+  .byte 46
+  .byte 76
+  .zero 1
+.align 1
+.L.data.129:
+  .byte 115
+  .byte 121
+  .byte 109
+  .byte 98
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 97
+  .byte 108
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 100
+  .byte 121
+  .byte 32
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 105
+  .byte 110
+  .byte 101
+  .byte 100
+  .zero 1
+.align 1
+.L.data.128:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 110
+  .byte 97
+  .byte 108
+  .byte 32
+  .byte 101
+  .byte 114
+  .byte 114
+  .byte 111
+  .byte 114
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 46
+  .byte 42
+  .byte 115
+  .zero 1
+.align 1
+.L.data.127:
+  .byte 114
+  .byte 49
+  .byte 53
+  .byte 98
+  .zero 1
+.align 1
+.L.data.126:
+  .byte 114
+  .byte 49
+  .byte 52
+  .byte 98
+  .zero 1
+.align 1
+.L.data.125:
+  .byte 114
+  .byte 49
+  .byte 51
+  .byte 98
+  .zero 1
+.align 1
+.L.data.124:
+  .byte 114
+  .byte 49
+  .byte 50
+  .byte 98
+  .zero 1
+.align 1
+.L.data.123:
+  .byte 114
+  .byte 49
+  .byte 49
+  .byte 98
+  .zero 1
+.align 1
+.L.data.122:
+  .byte 114
+  .byte 49
+  .byte 48
+  .byte 98
+  .zero 1
+.align 1
+.L.data.121:
+  .byte 114
+  .byte 57
+  .byte 98
+  .zero 1
+.align 1
+.L.data.120:
+  .byte 114
+  .byte 56
+  .byte 98
+  .zero 1
+.align 1
+.L.data.119:
+  .byte 100
+  .byte 105
+  .byte 108
+  .zero 1
+.align 1
+.L.data.118:
+  .byte 115
+  .byte 105
+  .byte 108
+  .zero 1
+.align 1
+.L.data.117:
+  .byte 98
+  .byte 112
+  .byte 108
+  .zero 1
+.align 1
+.L.data.116:
+  .byte 115
+  .byte 112
+  .byte 108
+  .zero 1
+.align 1
+.L.data.115:
+  .byte 98
+  .byte 108
+  .zero 1
+.align 1
+.L.data.114:
+  .byte 100
+  .byte 108
+  .zero 1
+.align 1
+.L.data.113:
+  .byte 99
+  .byte 108
+  .zero 1
+.align 1
+.L.data.112:
+  .byte 97
+  .byte 108
+  .zero 1
+.align 1
+.L.data.111:
+  .byte 114
+  .byte 49
+  .byte 53
+  .byte 98
+  .zero 1
+.align 1
+.L.data.110:
+  .byte 114
+  .byte 49
+  .byte 52
+  .byte 98
+  .zero 1
+.align 1
+.L.data.109:
+  .byte 114
+  .byte 49
+  .byte 51
+  .byte 98
+  .zero 1
+.align 1
+.L.data.108:
+  .byte 114
+  .byte 49
+  .byte 50
+  .byte 98
+  .zero 1
+.align 1
+.L.data.107:
+  .byte 114
+  .byte 49
+  .byte 49
+  .byte 98
+  .zero 1
+.align 1
+.L.data.106:
+  .byte 114
+  .byte 49
+  .byte 48
+  .byte 98
+  .zero 1
+.align 1
+.L.data.105:
+  .byte 114
+  .byte 57
+  .byte 98
+  .zero 1
+.align 1
+.L.data.104:
+  .byte 114
+  .byte 56
+  .byte 98
+  .zero 1
+.align 1
+.L.data.103:
+  .byte 100
+  .byte 105
+  .byte 108
+  .zero 1
+.align 1
+.L.data.102:
+  .byte 115
+  .byte 105
+  .byte 108
+  .zero 1
+.align 1
+.L.data.101:
+  .byte 98
+  .byte 112
+  .byte 108
+  .zero 1
+.align 1
+.L.data.100:
+  .byte 115
+  .byte 112
+  .byte 108
+  .zero 1
+.align 1
+.L.data.99:
+  .byte 98
+  .byte 108
+  .zero 1
+.align 1
+.L.data.98:
+  .byte 100
+  .byte 108
+  .zero 1
+.align 1
+.L.data.97:
+  .byte 99
+  .byte 108
+  .zero 1
+.align 1
+.L.data.96:
+  .byte 97
+  .byte 108
+  .zero 1
+.align 8
+reg8:
+  .quad .L.data.112+0
+  .quad .L.data.113+0
+  .quad .L.data.114+0
+  .quad .L.data.115+0
+  .quad .L.data.116+0
+  .quad .L.data.117+0
+  .quad .L.data.118+0
+  .quad .L.data.119+0
+  .quad .L.data.120+0
+  .quad .L.data.121+0
+  .quad .L.data.122+0
+  .quad .L.data.123+0
+  .quad .L.data.124+0
+  .quad .L.data.125+0
+  .quad .L.data.126+0
+  .quad .L.data.127+0
+.align 1
+.L.data.95:
+  .byte 114
+  .byte 49
+  .byte 53
+  .byte 119
+  .zero 1
+.align 1
+.L.data.94:
+  .byte 114
+  .byte 49
+  .byte 52
+  .byte 119
+  .zero 1
+.align 1
+.L.data.93:
+  .byte 114
+  .byte 49
+  .byte 51
+  .byte 119
+  .zero 1
+.align 1
+.L.data.92:
+  .byte 114
+  .byte 49
+  .byte 50
+  .byte 119
+  .zero 1
+.align 1
+.L.data.91:
+  .byte 114
+  .byte 49
+  .byte 49
+  .byte 119
+  .zero 1
+.align 1
+.L.data.90:
+  .byte 114
+  .byte 49
+  .byte 48
+  .byte 119
+  .zero 1
+.align 1
+.L.data.89:
+  .byte 114
+  .byte 57
+  .byte 119
+  .zero 1
+.align 1
+.L.data.88:
+  .byte 114
+  .byte 56
+  .byte 119
+  .zero 1
+.align 1
+.L.data.87:
+  .byte 100
+  .byte 105
+  .zero 1
+.align 1
+.L.data.86:
+  .byte 115
+  .byte 105
+  .zero 1
+.align 1
+.L.data.85:
+  .byte 98
+  .byte 112
+  .zero 1
+.align 1
+.L.data.84:
+  .byte 115
+  .byte 112
+  .zero 1
+.align 1
+.L.data.83:
+  .byte 98
+  .byte 120
+  .zero 1
+.align 1
+.L.data.82:
+  .byte 100
+  .byte 120
+  .zero 1
+.align 1
+.L.data.81:
+  .byte 99
+  .byte 120
+  .zero 1
+.align 1
+.L.data.80:
+  .byte 97
+  .byte 120
+  .zero 1
+.align 1
+.L.data.79:
+  .byte 114
+  .byte 49
+  .byte 53
+  .byte 119
+  .zero 1
+.align 1
+.L.data.78:
+  .byte 114
+  .byte 49
+  .byte 52
+  .byte 119
+  .zero 1
+.align 1
+.L.data.77:
+  .byte 114
+  .byte 49
+  .byte 51
+  .byte 119
+  .zero 1
+.align 1
+.L.data.76:
+  .byte 114
+  .byte 49
+  .byte 50
+  .byte 119
+  .zero 1
+.align 1
+.L.data.75:
+  .byte 114
+  .byte 49
+  .byte 49
+  .byte 119
+  .zero 1
+.align 1
+.L.data.74:
+  .byte 114
+  .byte 49
+  .byte 48
+  .byte 119
+  .zero 1
+.align 1
+.L.data.73:
+  .byte 114
+  .byte 57
+  .byte 119
+  .zero 1
+.align 1
+.L.data.72:
+  .byte 114
+  .byte 56
+  .byte 119
+  .zero 1
+.align 1
+.L.data.71:
+  .byte 100
+  .byte 105
+  .zero 1
+.align 1
+.L.data.70:
+  .byte 115
+  .byte 105
+  .zero 1
+.align 1
+.L.data.69:
+  .byte 98
+  .byte 112
+  .zero 1
+.align 1
+.L.data.68:
+  .byte 115
+  .byte 112
+  .zero 1
+.align 1
+.L.data.67:
+  .byte 98
+  .byte 120
+  .zero 1
+.align 1
+.L.data.66:
+  .byte 100
+  .byte 120
+  .zero 1
+.align 1
+.L.data.65:
+  .byte 99
+  .byte 120
+  .zero 1
+.align 1
+.L.data.64:
+  .byte 97
+  .byte 120
+  .zero 1
+.align 8
+reg16:
+  .quad .L.data.80+0
+  .quad .L.data.81+0
+  .quad .L.data.82+0
+  .quad .L.data.83+0
+  .quad .L.data.84+0
+  .quad .L.data.85+0
+  .quad .L.data.86+0
+  .quad .L.data.87+0
+  .quad .L.data.88+0
+  .quad .L.data.89+0
+  .quad .L.data.90+0
+  .quad .L.data.91+0
+  .quad .L.data.92+0
+  .quad .L.data.93+0
+  .quad .L.data.94+0
+  .quad .L.data.95+0
+.align 1
+.L.data.63:
+  .byte 114
+  .byte 49
+  .byte 53
+  .byte 100
+  .zero 1
+.align 1
+.L.data.62:
+  .byte 114
+  .byte 49
+  .byte 52
+  .byte 100
+  .zero 1
+.align 1
+.L.data.61:
+  .byte 114
+  .byte 49
+  .byte 51
+  .byte 100
+  .zero 1
+.align 1
+.L.data.60:
+  .byte 114
+  .byte 49
+  .byte 50
+  .byte 100
+  .zero 1
+.align 1
+.L.data.59:
+  .byte 114
+  .byte 49
+  .byte 49
+  .byte 100
+  .zero 1
+.align 1
+.L.data.58:
+  .byte 114
+  .byte 49
+  .byte 48
+  .byte 100
+  .zero 1
+.align 1
+.L.data.57:
+  .byte 114
+  .byte 57
+  .byte 100
+  .zero 1
+.align 1
+.L.data.56:
+  .byte 114
+  .byte 56
+  .byte 100
+  .zero 1
+.align 1
+.L.data.55:
+  .byte 101
+  .byte 100
+  .byte 105
+  .zero 1
+.align 1
+.L.data.54:
+  .byte 101
+  .byte 115
+  .byte 105
+  .zero 1
+.align 1
+.L.data.53:
+  .byte 101
+  .byte 98
+  .byte 112
+  .zero 1
+.align 1
+.L.data.52:
+  .byte 101
+  .byte 115
+  .byte 112
+  .zero 1
+.align 1
+.L.data.51:
+  .byte 101
+  .byte 98
+  .byte 120
+  .zero 1
+.align 1
+.L.data.50:
+  .byte 101
+  .byte 100
+  .byte 120
+  .zero 1
+.align 1
+.L.data.49:
+  .byte 101
+  .byte 99
+  .byte 120
+  .zero 1
+.align 1
+.L.data.48:
+  .byte 101
+  .byte 97
+  .byte 120
+  .zero 1
+.align 1
+.L.data.47:
+  .byte 114
+  .byte 49
+  .byte 53
+  .byte 100
+  .zero 1
+.align 1
+.L.data.46:
+  .byte 114
+  .byte 49
+  .byte 52
+  .byte 100
+  .zero 1
+.align 1
+.L.data.45:
+  .byte 114
+  .byte 49
+  .byte 51
+  .byte 100
+  .zero 1
+.align 1
+.L.data.44:
+  .byte 114
+  .byte 49
+  .byte 50
+  .byte 100
+  .zero 1
+.align 1
+.L.data.43:
+  .byte 114
+  .byte 49
+  .byte 49
+  .byte 100
+  .zero 1
+.align 1
+.L.data.42:
+  .byte 114
+  .byte 49
+  .byte 48
+  .byte 100
+  .zero 1
+.align 1
+.L.data.41:
+  .byte 114
+  .byte 57
+  .byte 100
+  .zero 1
+.align 1
+.L.data.40:
+  .byte 114
+  .byte 56
+  .byte 100
+  .zero 1
+.align 1
+.L.data.39:
+  .byte 101
+  .byte 100
+  .byte 105
+  .zero 1
+.align 1
+.L.data.38:
+  .byte 101
+  .byte 115
+  .byte 105
+  .zero 1
+.align 1
+.L.data.37:
+  .byte 101
+  .byte 98
+  .byte 112
+  .zero 1
+.align 1
+.L.data.36:
+  .byte 101
+  .byte 115
+  .byte 112
+  .zero 1
+.align 1
+.L.data.35:
+  .byte 101
+  .byte 98
+  .byte 120
+  .zero 1
+.align 1
+.L.data.34:
+  .byte 101
+  .byte 100
+  .byte 120
+  .zero 1
+.align 1
+.L.data.33:
+  .byte 101
+  .byte 99
+  .byte 120
+  .zero 1
+.align 1
+.L.data.32:
+  .byte 101
+  .byte 97
+  .byte 120
+  .zero 1
+.align 8
+reg32:
+  .quad .L.data.48+0
+  .quad .L.data.49+0
+  .quad .L.data.50+0
+  .quad .L.data.51+0
+  .quad .L.data.52+0
+  .quad .L.data.53+0
+  .quad .L.data.54+0
+  .quad .L.data.55+0
+  .quad .L.data.56+0
+  .quad .L.data.57+0
+  .quad .L.data.58+0
+  .quad .L.data.59+0
+  .quad .L.data.60+0
+  .quad .L.data.61+0
+  .quad .L.data.62+0
+  .quad .L.data.63+0
+.align 1
+.L.data.31:
+  .byte 114
+  .byte 49
+  .byte 53
+  .zero 1
+.align 1
+.L.data.30:
+  .byte 114
+  .byte 49
+  .byte 52
+  .zero 1
+.align 1
+.L.data.29:
+  .byte 114
+  .byte 49
+  .byte 51
+  .zero 1
+.align 1
+.L.data.28:
+  .byte 114
+  .byte 49
+  .byte 50
+  .zero 1
+.align 1
+.L.data.27:
+  .byte 114
+  .byte 49
+  .byte 49
+  .zero 1
+.align 1
+.L.data.26:
+  .byte 114
+  .byte 49
+  .byte 48
+  .zero 1
+.align 1
+.L.data.25:
+  .byte 114
+  .byte 57
+  .zero 1
+.align 1
+.L.data.24:
+  .byte 114
+  .byte 56
+  .zero 1
+.align 1
+.L.data.23:
+  .byte 114
+  .byte 100
+  .byte 105
+  .zero 1
+.align 1
+.L.data.22:
+  .byte 114
+  .byte 115
+  .byte 105
+  .zero 1
+.align 1
+.L.data.21:
+  .byte 114
+  .byte 98
+  .byte 112
+  .zero 1
+.align 1
+.L.data.20:
+  .byte 114
+  .byte 115
+  .byte 112
+  .zero 1
+.align 1
+.L.data.19:
+  .byte 114
+  .byte 98
+  .byte 120
+  .zero 1
+.align 1
+.L.data.18:
+  .byte 114
+  .byte 100
+  .byte 120
+  .zero 1
+.align 1
+.L.data.17:
+  .byte 114
+  .byte 99
+  .byte 120
+  .zero 1
+.align 1
+.L.data.16:
+  .byte 114
+  .byte 97
+  .byte 120
+  .zero 1
+.align 1
+.L.data.15:
+  .byte 114
+  .byte 49
+  .byte 53
+  .zero 1
+.align 1
+.L.data.14:
+  .byte 114
+  .byte 49
+  .byte 52
+  .zero 1
+.align 1
+.L.data.13:
+  .byte 114
+  .byte 49
+  .byte 51
+  .zero 1
+.align 1
+.L.data.12:
+  .byte 114
+  .byte 49
+  .byte 50
+  .zero 1
+.align 1
+.L.data.11:
+  .byte 114
+  .byte 49
+  .byte 49
+  .zero 1
+.align 1
+.L.data.10:
+  .byte 114
+  .byte 49
+  .byte 48
+  .zero 1
+.align 1
+.L.data.9:
+  .byte 114
+  .byte 57
+  .zero 1
+.align 1
+.L.data.8:
+  .byte 114
+  .byte 56
+  .zero 1
+.align 1
+.L.data.7:
+  .byte 114
+  .byte 100
+  .byte 105
+  .zero 1
+.align 1
+.L.data.6:
+  .byte 114
+  .byte 115
+  .byte 105
+  .zero 1
+.align 1
+.L.data.5:
+  .byte 114
+  .byte 98
+  .byte 112
+  .zero 1
+.align 1
+.L.data.4:
+  .byte 114
+  .byte 115
+  .byte 112
+  .zero 1
+.align 1
+.L.data.3:
+  .byte 114
+  .byte 98
+  .byte 120
+  .zero 1
+.align 1
+.L.data.2:
+  .byte 114
+  .byte 100
+  .byte 120
+  .zero 1
+.align 1
+.L.data.1:
+  .byte 114
+  .byte 99
+  .byte 120
+  .zero 1
+.align 1
+.L.data.0:
+  .byte 114
+  .byte 97
+  .byte 120
+  .zero 1
+.align 8
+reg64:
+  .quad .L.data.16+0
+  .quad .L.data.17+0
+  .quad .L.data.18+0
+  .quad .L.data.19+0
+  .quad .L.data.20+0
+  .quad .L.data.21+0
+  .quad .L.data.22+0
+  .quad .L.data.23+0
+  .quad .L.data.24+0
+  .quad .L.data.25+0
+  .quad .L.data.26+0
+  .quad .L.data.27+0
+  .quad .L.data.28+0
+  .quad .L.data.29+0
+  .quad .L.data.30+0
+  .quad .L.data.31+0
+.align 8
+sym_last:
+  .quad sym_head+0
+.text
+assert:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.L.return.assert:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+va_end:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.L.return.va_end:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+asm_error:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-56], rdi
+.loc 1 894 23
+  mov r10, offset cur_line
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 895 3
+.L.begin.asm_error.1:
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.false.asm_error.2
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.asm_error.2
+  mov r10, 1
+  jmp .L.end.asm_error.2
+.L.false.asm_error.2:
+  mov r10, 0
+.L.end.asm_error.2:
+  cmp r10, 0
+  je .L.break.asm_error.1
+.loc 1 896 5
+  lea r10, [rbp-48]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+.L.continue.asm_error.1:
+  jmp .L.begin.asm_error.1
+.L.break.asm_error.1:
+.loc 1 897 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.128
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r11, offset cur_line
+  mov r11, [r11]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset cur_line
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.asm_error:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+buf_reserve:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rsi
+  mov [rbp-48], rdi
+.loc 1 905 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 16
+  mov r11, [r11]
+  cmp r10, r11
+  setle al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.buf_reserve.1
+.loc 1 906 5
+  jmp .L.return.buf_reserve
+.L.end.buf_reserve.1:
+.loc 1 907 3
+.L.begin.buf_reserve.2:
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 8
+  mov r11, [r11]
+  lea r12, [rbp-40]
+  mov r12, [r12]
+  add r11, r12
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.break.buf_reserve.2
+.loc 1 908 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  cmp r10, 0
+  je  .L.else.buf_reserve.3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  mov r11, 2
+  movsx r11, r11d
+  imul r10, r11
+  jmp .L.end.buf_reserve.3
+.L.else.buf_reserve.3:
+  mov r10, 4096
+  movsx r10, r10d
+.L.end.buf_reserve.3:
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.L.continue.buf_reserve.2:
+  jmp .L.begin.buf_reserve.2
+.L.break.buf_reserve.2:
+.loc 1 909 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset realloc
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.L.return.buf_reserve:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+buf_put:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdx
+  mov [rbp-56], rsi
+  mov [rbp-64], rdi
+.loc 1 913 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_reserve
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 914 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 8
+  mov r11, [r11]
+  mov r12, 1
+  movsx r12, r12d
+  imul r11, r12
+  add r10, r11
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset memcpy
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 915 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 8
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+.L.return.buf_put:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+buf_int:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-56], edx
+  mov [rbp-64], rsi
+  mov [rbp-72], rdi
+.loc 1 920 14
+.loc 1 921 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-44]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.buf_int.1:
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.buf_int.1
+.loc 1 922 5
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  lea r11, [rbp-44]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  mov rcx, r11
+  sar r10, cl
+  movsx r10, r10b
+  lea r11, [rbp-52]
+  lea r12, [rbp-44]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.L.continue.buf_int.1:
+.loc 1 921 29
+  lea r10, [rbp-44]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.buf_int.1
+.L.break.buf_int.1:
+.loc 1 923 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-52]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_put
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.buf_int:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+buf_zero:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 927 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_reserve
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 928 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 8
+  mov r11, [r11]
+  mov r12, 1
+  movsx r12, r12d
+  imul r11, r12
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset memset
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 929 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 8
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+.L.return.buf_zero:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+buf_align:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-36], esi
+  mov [rbp-48], rdi
+.loc 1 933 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset align_to
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 8
+  mov r11, [r11]
+  sub r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_zero
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.buf_align:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+patch32:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-56], rdx
+  mov [rbp-64], rsi
+  mov [rbp-72], rdi
+.loc 1 937 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-44]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.patch32.1:
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.patch32.1
+.loc 1 938 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-44]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  mov rcx, r11
+  sar r10, cl
+  movsx r10, r10b
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  add r11, 0
+  mov r11, [r11]
+  lea r12, [rbp-64]
+  mov r12, [r12]
+  lea r13, [rbp-44]
+  mov r13d, dword ptr [r13]
+  movsx r13, r13d
+  add r12, r13
+  mov r13, 1
+  movsx r13, r13d
+  imul r12, r13
+  add r11, r12
+  mov [r11], r10b
+.L.continue.patch32.1:
+.loc 1 937 26
+  lea r10, [rbp-44]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.patch32.1
+.L.break.patch32.1:
+.L.return.patch32:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+emit8:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-36], edi
+.loc 1 942 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset text
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.emit8:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+get_symbol:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-44], esi
+  mov [rbp-56], rdi
+.loc 1 950 50
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset symbols
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_get2
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 951 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.get_symbol.1
+.loc 1 952 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.get_symbol
+.L.end.get_symbol.1:
+.loc 1 954 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 40
+  push r10
+  sub rsp, 8
+  mov r10, offset calloc
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 955 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset strndup
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 956 3
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10d
+.loc 1 957 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset symbols
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_put2
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 958 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, offset sym_last
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+  mov r11, offset sym_last
+  mov [r11], r10
+.loc 1 959 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.get_symbol
+.L.return.get_symbol:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+cur_offset:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 963 3
+  mov r10, offset cur_sec
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.cur_offset.1
+.loc 1 964 5
+  mov r10, offset text
+  add r10, 8
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.cur_offset
+.L.end.cur_offset.1:
+.loc 1 965 3
+  mov r10, offset cur_sec
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.cur_offset.2
+.loc 1 966 5
+  mov r10, offset data
+  add r10, 8
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.cur_offset
+.L.end.cur_offset.2:
+.loc 1 967 3
+  mov r10, offset bss_size
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.cur_offset
+.L.return.cur_offset:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+define_symbol:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-44], esi
+  mov [rbp-56], rdi
+.loc 1 971 38
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset get_symbol
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 972 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 16
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  sub r11d, r12d
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.define_symbol.1
+.loc 1 973 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.129
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.define_symbol.1:
+.loc 1 974 3
+  mov r10, offset cur_sec
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10d
+.loc 1 975 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset cur_offset
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10
+.L.return.define_symbol:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+is_local_label:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 979 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.130
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset strncmp
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.is_local_label
+.L.return.is_local_label:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+add_reloc:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], r8
+  mov [rbp-56], rcx
+  mov [rbp-60], edx
+  mov [rbp-72], rsi
+  mov [rbp-80], rdi
+.loc 1 983 40
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 40
+  push r10
+  sub rsp, 8
+  mov r10, offset calloc
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 984 3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 985 3
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10d
+.loc 1 986 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10
+.loc 1 987 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+.loc 1 988 3
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 989 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  mov [r11], r10
+.L.return.add_reloc:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+init_registers:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 997 3
+  mov r10, offset registers
+  add r10, 0
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.init_registers.1
+.loc 1 998 5
+  jmp .L.return.init_registers
+.L.end.init_registers.1:
+.loc 1 1002 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-44]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.init_registers.2:
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 16
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.init_registers.2
+.loc 1 1003 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset registers
+  push r10
+  sub rsp, 8
+  mov r10, offset reg64
+  lea r11, [rbp-44]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 8
+  mov r10d, r10d
+  mov r11, 16
+  mov r11d, r11d
+  imul r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-44]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_put
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1004 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset registers
+  push r10
+  sub rsp, 8
+  mov r10, offset reg32
+  lea r11, [rbp-44]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 4
+  mov r10d, r10d
+  mov r11, 16
+  mov r11d, r11d
+  imul r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-44]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_put
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1005 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset registers
+  push r10
+  sub rsp, 8
+  mov r10, offset reg16
+  lea r11, [rbp-44]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  mov r11, 16
+  mov r11d, r11d
+  imul r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-44]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_put
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1006 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset registers
+  push r10
+  sub rsp, 8
+  mov r10, offset reg8
+  lea r11, [rbp-44]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  mov r11, 16
+  mov r11d, r11d
+  imul r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-44]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_put
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.init_registers.2:
+.loc 1 1002 27
+  lea r10, [rbp-44]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.init_registers.2
+.L.break.init_registers.2:
+.L.return.init_registers:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+parse_reg:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-52], edx
+  mov [rbp-64], rsi
+  mov [rbp-72], rdi
+.loc 1 1012 52
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset registers
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_get2
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1013 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.parse_reg.1
+.loc 1 1014 5
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.parse_reg
+.L.end.parse_reg.1:
+.loc 1 1015 3
+  lea r10, [rbp-48]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+.loc 1 1016 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r11, 16
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rdx
+  mov r10d, r10d
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  add r11, 4
+  mov [r11], r10d
+.loc 1 1017 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r11, 16
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10d
+.loc 1 1018 3
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.parse_reg
+.L.return.parse_reg:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+parse_number:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-52], esi
+  mov [rbp-64], rdi
+.loc 1 1022 12
+.loc 1 1023 33
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  mov r10, 10
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset strtol
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1024 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  lea r12, [rbp-52]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  cmp r10, r11
+  setne al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.parse_number.1
+.loc 1 1025 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.131
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.parse_number.1:
+.loc 1 1026 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.parse_number
+.L.return.parse_number:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+startswith:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdx
+  mov [rbp-52], esi
+  mov [rbp-64], rdi
+.loc 1 1030 20
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strlen
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1031 3
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.startswith.1
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strncmp
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.startswith.1
+  mov r10, 1
+  jmp .L.end.startswith.1
+.L.false.startswith.1:
+  mov r10, 0
+.L.end.startswith.1:
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.startswith
+.L.return.startswith:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+parse_mem:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 128
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-100], edx
+  mov [rbp-112], rsi
+  mov [rbp-120], rdi
+.loc 1 1036 3
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 91
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.parse_mem.2
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  lea r11, [rbp-100]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  sub r11d, r12d
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 93
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.parse_mem.2
+  mov r10, 0
+  jmp .L.end.parse_mem.2
+.L.true.parse_mem.2:
+  mov r10, 1
+.L.end.parse_mem.2:
+  cmp r10, 0
+  je .L.end.parse_mem.1
+.loc 1 1037 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.132
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.parse_mem.1:
+.loc 1 1039 18
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-96]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1040 26
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  lea r11, [rbp-100]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  sub r10, r11
+  lea r11, [rbp-88]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1041 14
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1042 3
+.L.begin.parse_mem.3:
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.parse_mem.5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 43
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.parse_mem.5
+  mov r10, 1
+  jmp .L.end.parse_mem.5
+.L.false.parse_mem.5:
+  mov r10, 0
+.L.end.parse_mem.5:
+  cmp r10, 0
+  je .L.false.parse_mem.4
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 45
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.parse_mem.4
+  mov r10, 1
+  jmp .L.end.parse_mem.4
+.L.false.parse_mem.4:
+  mov r10, 0
+.L.end.parse_mem.4:
+  cmp r10, 0
+  je .L.break.parse_mem.3
+.loc 1 1043 5
+  lea r10, [rbp-80]
+  lea r11, [rbp-72]
+  mov [r11], r10
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+.L.continue.parse_mem.3:
+  jmp .L.begin.parse_mem.3
+.L.break.parse_mem.3:
+.loc 1 1045 20
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-64]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-64]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1046 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  lea r11, [rbp-96]
+  mov r11, [r11]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset parse_reg
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.parse_mem.7
+  lea r10, [rbp-64]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.parse_mem.7
+  mov r10, 0
+  jmp .L.end.parse_mem.7
+.L.true.parse_mem.7:
+  mov r10, 1
+.L.end.parse_mem.7:
+  cmp r10, 0
+  je .L.end.parse_mem.6
+.loc 1 1047 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.133
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.parse_mem.6:
+.loc 1 1049 3
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-120]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10d
+.loc 1 1050 3
+  lea r10, [rbp-64]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-120]
+  mov r11, [r11]
+  add r11, 4
+  mov [r11], r10d
+.loc 1 1051 3
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-120]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 1052 3
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.parse_mem.8
+.loc 1 1053 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset parse_number
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-120]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.L.end.parse_mem.8:
+.L.return.parse_mem:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+parse_operand:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-68], edx
+  mov [rbp-80], rsi
+  mov [rbp-88], rdi
+.loc 1 1057 3
+.loc 1 1045 11
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-64]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-64]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1057 18
+  lea r10, [rbp-64]
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  mov al, [r10+0]
+  mov [r11+0], al
+  mov al, [r10+1]
+  mov [r11+1], al
+  mov al, [r10+2]
+  mov [r11+2], al
+  mov al, [r10+3]
+  mov [r11+3], al
+  mov al, [r10+4]
+  mov [r11+4], al
+  mov al, [r10+5]
+  mov [r11+5], al
+  mov al, [r10+6]
+  mov [r11+6], al
+  mov al, [r10+7]
+  mov [r11+7], al
+  mov al, [r10+8]
+  mov [r11+8], al
+  mov al, [r10+9]
+  mov [r11+9], al
+  mov al, [r10+10]
+  mov [r11+10], al
+  mov al, [r10+11]
+  mov [r11+11], al
+  mov al, [r10+12]
+  mov [r11+12], al
+  mov al, [r10+13]
+  mov [r11+13], al
+  mov al, [r10+14]
+  mov [r11+14], al
+  mov al, [r10+15]
+  mov [r11+15], al
+  mov al, [r10+16]
+  mov [r11+16], al
+  mov al, [r10+17]
+  mov [r11+17], al
+  mov al, [r10+18]
+  mov [r11+18], al
+  mov al, [r10+19]
+  mov [r11+19], al
+  mov al, [r10+20]
+  mov [r11+20], al
+  mov al, [r10+21]
+  mov [r11+21], al
+  mov al, [r10+22]
+  mov [r11+22], al
+  mov al, [r10+23]
+  mov [r11+23], al
+  mov al, [r10+24]
+  mov [r11+24], al
+  mov al, [r10+25]
+  mov [r11+25], al
+  mov al, [r10+26]
+  mov [r11+26], al
+  mov al, [r10+27]
+  mov [r11+27], al
+  mov al, [r10+28]
+  mov [r11+28], al
+  mov al, [r10+29]
+  mov [r11+29], al
+  mov al, [r10+30]
+  mov [r11+30], al
+  mov al, [r10+31]
+  mov [r11+31], al
+.loc 1 1059 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.135
+  push r10
+  sub rsp, 8
+  mov r10, offset startswith
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.parse_operand.1
+.loc 1 1060 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r11, 9
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 9
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset parse_mem
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1061 5
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10d
+.loc 1 1062 5
+  jmp .L.return.parse_operand
+.L.end.parse_operand.1:
+.loc 1 1065 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.136
+  push r10
+  sub rsp, 8
+  mov r10, offset startswith
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.parse_operand.2
+.loc 1 1066 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r11, 9
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 9
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset parse_mem
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1067 5
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10d
+.loc 1 1068 5
+  jmp .L.return.parse_operand
+.L.end.parse_operand.2:
+.loc 1 1071 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.137
+  push r10
+  sub rsp, 8
+  mov r10, offset startswith
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.parse_operand.3
+.loc 1 1072 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r11, 10
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset parse_mem
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1073 5
+  mov r10, 4
+  mov r10d, r10d
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10d
+.loc 1 1074 5
+  jmp .L.return.parse_operand
+.L.end.parse_operand.3:
+.loc 1 1077 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.138
+  push r10
+  sub rsp, 8
+  mov r10, offset startswith
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.parse_operand.4
+.loc 1 1078 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r11, 10
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset parse_mem
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1079 5
+  mov r10, 8
+  mov r10d, r10d
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10d
+.loc 1 1080 5
+  jmp .L.return.parse_operand
+.L.end.parse_operand.4:
+.loc 1 1083 3
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 91
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.parse_operand.5
+.loc 1 1084 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset parse_mem
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1085 5
+  jmp .L.return.parse_operand
+.L.end.parse_operand.5:
+.loc 1 1088 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.139
+  push r10
+  sub rsp, 8
+  mov r10, offset startswith
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.parse_operand.6
+.loc 1 1089 5
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10d
+.loc 1 1090 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r11, 7
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 7
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset get_symbol
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10
+.loc 1 1091 5
+  jmp .L.return.parse_operand
+.L.end.parse_operand.6:
+.loc 1 1094 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset isdigit
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  jne .L.true.parse_operand.8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 45
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.parse_operand.8
+  mov r10, 0
+  jmp .L.end.parse_operand.8
+.L.true.parse_operand.8:
+  mov r10, 1
+.L.end.parse_operand.8:
+  cmp r10, 0
+  je .L.end.parse_operand.7
+.loc 1 1095 5
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10d
+.loc 1 1096 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset parse_number
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 1097 5
+  jmp .L.return.parse_operand
+.L.end.parse_operand.7:
+.loc 1 1100 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset parse_reg
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.parse_operand.9
+.loc 1 1101 5
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10d
+.loc 1 1102 5
+  jmp .L.return.parse_operand
+.L.end.parse_operand.9:
+.loc 1 1105 3
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10d
+.loc 1 1106 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset get_symbol
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10
+.L.return.parse_operand:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+needs_rex8:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 1116 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.needs_rex8.4
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.needs_rex8.4
+  mov r10, 1
+  jmp .L.end.needs_rex8.4
+.L.false.needs_rex8.4:
+  mov r10, 0
+.L.end.needs_rex8.4:
+  cmp r10, 0
+  je .L.false.needs_rex8.3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.needs_rex8.3
+  mov r10, 1
+  jmp .L.end.needs_rex8.3
+.L.false.needs_rex8.3:
+  mov r10, 0
+.L.end.needs_rex8.3:
+  cmp r10, 0
+  je .L.false.needs_rex8.2
+  mov r10, 4
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 4
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.needs_rex8.2
+  mov r10, 1
+  jmp .L.end.needs_rex8.2
+.L.false.needs_rex8.2:
+  mov r10, 0
+.L.end.needs_rex8.2:
+  cmp r10, 0
+  je .L.false.needs_rex8.1
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.needs_rex8.1
+  mov r10, 1
+  jmp .L.end.needs_rex8.1
+.L.false.needs_rex8.1:
+  mov r10, 0
+.L.end.needs_rex8.1:
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.needs_rex8
+.L.return.needs_rex8:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+emit_modrm:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 112
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-80], r9
+  mov [rbp-88], r8
+  mov [rbp-92], ecx
+  mov [rbp-96], edx
+  mov [rbp-100], esi
+  mov [rbp-104], edi
+.loc 1 1124 3
+  lea r10, [rbp-104]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.emit_modrm.1
+.loc 1 1125 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 102
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit8
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.emit_modrm.1:
+.loc 1 1127 17
+  mov r10, 64
+  mov r10d, r10d
+  lea r11, [rbp-68]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1128 3
+  lea r10, [rbp-104]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.emit_modrm.2
+.loc 1 1129 5
+  lea r10, [rbp-68]
+  lea r11, [rbp-64]
+  mov [r11], r10
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  or r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov [r11], r10d
+.L.end.emit_modrm.2:
+.loc 1 1130 3
+  mov r10, 8
+  mov r10d, r10d
+  lea r11, [rbp-92]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.emit_modrm.3
+.loc 1 1131 5
+  lea r10, [rbp-68]
+  lea r11, [rbp-56]
+  mov [r11], r10
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  or r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10d
+.L.end.emit_modrm.3:
+.loc 1 1132 3
+  mov r10, 8
+  mov r10d, r10d
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 4
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.emit_modrm.4
+.loc 1 1133 5
+  lea r10, [rbp-68]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  or r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10d
+.L.end.emit_modrm.4:
+.loc 1 1134 3
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 64
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.emit_modrm.7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset needs_rex8
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  jne .L.true.emit_modrm.7
+  mov r10, 0
+  jmp .L.end.emit_modrm.7
+.L.true.emit_modrm.7:
+  mov r10, 1
+.L.end.emit_modrm.7:
+  cmp r10, 0
+  jne .L.true.emit_modrm.6
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset needs_rex8
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  jne .L.true.emit_modrm.6
+  mov r10, 0
+  jmp .L.end.emit_modrm.6
+.L.true.emit_modrm.6:
+  mov r10, 1
+.L.end.emit_modrm.6:
+  cmp r10, 0
+  je .L.end.emit_modrm.5
+.loc 1 1135 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit8
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.emit_modrm.5:
+.loc 1 1137 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-100]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit8
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1138 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-96]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.emit_modrm.8
+.loc 1 1139 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit8
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.emit_modrm.8:
+.loc 1 1141 3
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.emit_modrm.9
+.loc 1 1142 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 192
+  mov r10d, r10d
+  lea r11, [rbp-92]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 7
+  mov r12d, r12d
+  and r11d, r12d
+  mov r12, 3
+  mov rcx, r12
+  shl r11d, cl
+  mov r11d, r11d
+  or r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 4
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 7
+  mov r12d, r12d
+  and r11d, r12d
+  mov r11d, r11d
+  or r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit8
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1143 5
+  jmp .L.return.emit_modrm
+.L.end.emit_modrm.9:
+.loc 1 1146 3
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.emit_modrm.10
+.loc 1 1147 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.140
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.emit_modrm.10:
+.loc 1 1149 25
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 7
+  mov r11d, r11d
+  and r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1150 10
+.loc 1 1151 3
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  mov r11, 0
+  movsx r11, r11d
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.emit_modrm.12
+  lea r10, [rbp-40]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 5
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.emit_modrm.12
+  mov r10, 1
+  jmp .L.end.emit_modrm.12
+.L.false.emit_modrm.12:
+  mov r10, 0
+.L.end.emit_modrm.12:
+  cmp r10, 0
+  je .L.else.emit_modrm.11
+.loc 1 1152 5
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov [r11], r10d
+  jmp .L.end.emit_modrm.11
+.L.else.emit_modrm.11:
+.loc 1 1153 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 128
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 16
+  mov r11, [r11]
+  cmp r10, r11
+  setle al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.emit_modrm.14
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  mov r11, 127
+  movsx r11, r11d
+  cmp r10, r11
+  setle al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.emit_modrm.14
+  mov r10, 1
+  jmp .L.end.emit_modrm.14
+.L.false.emit_modrm.14:
+  mov r10, 0
+.L.end.emit_modrm.14:
+  cmp r10, 0
+  je .L.else.emit_modrm.13
+.loc 1 1154 5
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov [r11], r10d
+  jmp .L.end.emit_modrm.13
+.L.else.emit_modrm.13:
+.loc 1 1156 5
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov [r11], r10d
+.L.end.emit_modrm.13:
+.L.end.emit_modrm.11:
+.loc 1 1158 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r11, 6
+  mov rcx, r11
+  shl r10d, cl
+  mov r10d, r10d
+  lea r11, [rbp-92]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 7
+  mov r12d, r12d
+  and r11d, r12d
+  mov r12, 3
+  mov rcx, r12
+  shl r11d, cl
+  mov r11d, r11d
+  or r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  or r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit8
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1161 3
+  lea r10, [rbp-40]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.emit_modrm.15
+.loc 1 1162 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 36
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit8
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.emit_modrm.15:
+.loc 1 1164 3
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.emit_modrm.16
+.loc 1 1165 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset text
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.emit_modrm.16
+.L.else.emit_modrm.16:
+.loc 1 1166 8
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.emit_modrm.17
+.loc 1 1167 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset text
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.emit_modrm.17:
+.L.end.emit_modrm.16:
+.L.return.emit_modrm:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+emit_opreg:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-64], rdx
+  mov [rbp-68], esi
+  mov [rbp-69], dil
+.loc 1 1173 17
+  mov r10, 64
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1174 3
+  lea r10, [rbp-69]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.emit_opreg.1
+.loc 1 1175 5
+  lea r10, [rbp-52]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  or r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10d
+.L.end.emit_opreg.1:
+.loc 1 1176 3
+  mov r10, 8
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 4
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.emit_opreg.2
+.loc 1 1177 5
+  lea r10, [rbp-52]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  or r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+.L.end.emit_opreg.2:
+.loc 1 1178 3
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 64
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.emit_opreg.4
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset needs_rex8
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  jne .L.true.emit_opreg.4
+  mov r10, 0
+  jmp .L.end.emit_opreg.4
+.L.true.emit_opreg.4:
+  mov r10, 1
+.L.end.emit_opreg.4:
+  cmp r10, 0
+  je .L.end.emit_opreg.3
+.loc 1 1179 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit8
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.emit_opreg.3:
+.loc 1 1180 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 4
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 7
+  mov r12d, r12d
+  and r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit8
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.emit_opreg:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+is_rm:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 1184 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.is_rm.1
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.is_rm.1
+  mov r10, 0
+  jmp .L.end.is_rm.1
+.L.true.is_rm.1:
+  mov r10, 1
+.L.end.is_rm.1:
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.is_rm
+.L.return.is_rm:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+is_int8:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 1188 3
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 128
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  cmp r10, r11
+  setle al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.is_int8.1
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, 127
+  movsx r11, r11d
+  cmp r10, r11
+  setle al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.is_int8.1
+  mov r10, 1
+  jmp .L.end.is_int8.1
+.L.false.is_int8.1:
+  mov r10, 0
+.L.end.is_int8.1:
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.is_int8
+.L.return.is_int8:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+is_int32:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 1192 3
+  mov r10, 0
+  movsx r10, r10d
+  movabs r11, 2147483648
+  sub r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  cmp r10, r11
+  setle al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.is_int32.1
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, 2147483647
+  movsx r11, r11d
+  cmp r10, r11
+  setle al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.is_int32.1
+  mov r10, 1
+  jmp .L.end.is_int32.1
+.L.false.is_int32.1:
+  mov r10, 0
+.L.end.is_int32.1:
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.is_int32
+.L.return.is_int32:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+operand_size:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rsi
+  mov [rbp-48], rdi
+.loc 1 1196 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  cmp r10, 0
+  je .L.end.operand_size.1
+.loc 1 1197 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.operand_size
+.L.end.operand_size.1:
+.loc 1 1198 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.operand_size.3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  cmp r10, 0
+  je .L.false.operand_size.3
+  mov r10, 1
+  jmp .L.end.operand_size.3
+.L.false.operand_size.3:
+  mov r10, 0
+.L.end.operand_size.3:
+  cmp r10, 0
+  je .L.end.operand_size.2
+.loc 1 1199 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.operand_size
+.L.end.operand_size.2:
+.loc 1 1200 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.141
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1201 3
+  mov r10, 0
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.operand_size
+.L.return.operand_size:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+asm_mov:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 1206 36
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset operand_size
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1208 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_rm
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.false.asm_mov.2
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.asm_mov.2
+  mov r10, 1
+  jmp .L.end.asm_mov.2
+.L.false.asm_mov.2:
+  mov r10, 0
+.L.end.asm_mov.2:
+  cmp r10, 0
+  je .L.end.asm_mov.1
+.loc 1 1209 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je  .L.else.asm_mov.3
+  mov r10, 136
+  mov r10d, r10d
+  jmp .L.end.asm_mov.3
+.L.else.asm_mov.3:
+  mov r10, 137
+  mov r10d, r10d
+.L.end.asm_mov.3:
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_modrm
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1210 5
+  jmp .L.return.asm_mov
+.L.end.asm_mov.1:
+.loc 1 1213 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.asm_mov.5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.asm_mov.5
+  mov r10, 1
+  jmp .L.end.asm_mov.5
+.L.false.asm_mov.5:
+  mov r10, 0
+.L.end.asm_mov.5:
+  cmp r10, 0
+  je .L.end.asm_mov.4
+.loc 1 1214 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je  .L.else.asm_mov.6
+  mov r10, 138
+  mov r10d, r10d
+  jmp .L.end.asm_mov.6
+.L.else.asm_mov.6:
+  mov r10, 139
+  mov r10d, r10d
+.L.end.asm_mov.6:
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_modrm
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1215 5
+  jmp .L.return.asm_mov
+.L.end.asm_mov.4:
+.loc 1 1218 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.asm_mov.8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 3
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.asm_mov.8
+  mov r10, 1
+  jmp .L.end.asm_mov.8
+.L.false.asm_mov.8:
+  mov r10, 0
+.L.end.asm_mov.8:
+  cmp r10, 0
+  je .L.end.asm_mov.7
+.loc 1 1220 5
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.asm_mov.9
+.loc 1 1221 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.142
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.asm_mov.9:
+.loc 1 1222 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 199
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_modrm
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1223 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset text_relocs
+  push r10
+  sub rsp, 8
+  mov r10, offset text
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 11
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset add_reloc
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1224 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset text
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1225 5
+  jmp .L.return.asm_mov
+.L.end.asm_mov.7:
+.loc 1 1228 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.asm_mov.10
+.loc 1 1229 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.143
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.asm_mov.10:
+.loc 1 1231 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.asm_mov.13
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.asm_mov.13
+  mov r10, 1
+  jmp .L.end.asm_mov.13
+.L.false.asm_mov.13:
+  mov r10, 0
+.L.end.asm_mov.13:
+  cmp r10, 0
+  je .L.false.asm_mov.12
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_int32
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.asm_mov.12
+  mov r10, 1
+  jmp .L.end.asm_mov.12
+.L.false.asm_mov.12:
+  mov r10, 0
+.L.end.asm_mov.12:
+  cmp r10, 0
+  je .L.end.asm_mov.11
+.loc 1 1232 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, 184
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_opreg
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1233 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset text
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1234 5
+  jmp .L.return.asm_mov
+.L.end.asm_mov.11:
+.loc 1 1237 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.asm_mov.15
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.asm_mov.15
+  mov r10, 1
+  jmp .L.end.asm_mov.15
+.L.false.asm_mov.15:
+  mov r10, 0
+.L.end.asm_mov.15:
+  cmp r10, 0
+  je .L.end.asm_mov.14
+.loc 1 1238 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, 184
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_opreg
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1239 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset text
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1240 5
+  jmp .L.return.asm_mov
+.L.end.asm_mov.14:
+.loc 1 1243 3
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.asm_mov.16
+.loc 1 1244 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 198
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_modrm
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1245 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset text
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1246 5
+  jmp .L.return.asm_mov
+.L.end.asm_mov.16:
+.loc 1 1249 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 199
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_modrm
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1250 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset text
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je  .L.else.asm_mov.17
+  mov r10, 2
+  mov r10d, r10d
+  jmp .L.end.asm_mov.17
+.L.else.asm_mov.17:
+  mov r10, 4
+  mov r10d, r10d
+.L.end.asm_mov.17:
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.asm_mov:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+asm_alu:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdx
+  mov [rbp-56], rsi
+  mov [rbp-60], edi
+.loc 1 1255 36
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset operand_size
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1257 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_rm
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.false.asm_alu.2
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.asm_alu.2
+  mov r10, 1
+  jmp .L.end.asm_alu.2
+.L.false.asm_alu.2:
+  mov r10, 0
+.L.end.asm_alu.2:
+  cmp r10, 0
+  je .L.end.asm_alu.1
+.loc 1 1258 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  imul r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  cmp r11d, r12d
+  sete al
+  movzb r11d, al
+  cmp r11, 0
+  je  .L.else.asm_alu.3
+  mov r11, 0
+  mov r11d, r11d
+  jmp .L.end.asm_alu.3
+.L.else.asm_alu.3:
+  mov r11, 1
+  mov r11d, r11d
+.L.end.asm_alu.3:
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_modrm
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1259 5
+  jmp .L.return.asm_alu
+.L.end.asm_alu.1:
+.loc 1 1262 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.asm_alu.5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.asm_alu.5
+  mov r10, 1
+  jmp .L.end.asm_alu.5
+.L.false.asm_alu.5:
+  mov r10, 0
+.L.end.asm_alu.5:
+  cmp r10, 0
+  je .L.end.asm_alu.4
+.loc 1 1263 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  imul r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  cmp r11d, r12d
+  sete al
+  movzb r11d, al
+  cmp r11, 0
+  je  .L.else.asm_alu.6
+  mov r11, 2
+  mov r11d, r11d
+  jmp .L.end.asm_alu.6
+.L.else.asm_alu.6:
+  mov r11, 3
+  mov r11d, r11d
+.L.end.asm_alu.6:
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_modrm
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1264 5
+  jmp .L.return.asm_alu
+.L.end.asm_alu.4:
+.loc 1 1267 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.asm_alu.7
+.loc 1 1268 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.144
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.asm_alu.7:
+.loc 1 1270 3
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.asm_alu.8
+.loc 1 1271 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 128
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_modrm
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1272 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset text
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.asm_alu.8
+.L.else.asm_alu.8:
+.loc 1 1273 10
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_int8
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.else.asm_alu.9
+.loc 1 1274 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 131
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_modrm
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1275 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset text
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.asm_alu.9
+.L.else.asm_alu.9:
+.loc 1 1277 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 129
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_modrm
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1278 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset text
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je  .L.else.asm_alu.10
+  mov r10, 2
+  mov r10d, r10d
+  jmp .L.end.asm_alu.10
+.L.else.asm_alu.10:
+  mov r10, 4
+  mov r10d, r10d
+.L.end.asm_alu.10:
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.asm_alu.9:
+.L.end.asm_alu.8:
+.L.return.asm_alu:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+asm_movx:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdx
+  mov [rbp-48], rsi
+  mov [rbp-49], dil
+.loc 1 1284 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.asm_movx.2
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_rm
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.asm_movx.2
+  mov r10, 0
+  jmp .L.end.asm_movx.2
+.L.true.asm_movx.2:
+  mov r10, 1
+.L.end.asm_movx.2:
+  cmp r10, 0
+  je .L.end.asm_movx.1
+.loc 1 1285 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.145
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.asm_movx.1:
+.loc 1 1287 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.asm_movx.3
+.loc 1 1288 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 15
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-49]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je  .L.else.asm_movx.4
+  mov r10, 190
+  mov r10d, r10d
+  jmp .L.end.asm_movx.4
+.L.else.asm_movx.4:
+  mov r10, 182
+  mov r10d, r10d
+.L.end.asm_movx.4:
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_modrm
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.asm_movx.3
+.L.else.asm_movx.3:
+.loc 1 1289 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.asm_movx.5
+.loc 1 1290 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 15
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-49]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je  .L.else.asm_movx.6
+  mov r10, 191
+  mov r10d, r10d
+  jmp .L.end.asm_movx.6
+.L.else.asm_movx.6:
+  mov r10, 183
+  mov r10d, r10d
+.L.end.asm_movx.6:
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_modrm
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.asm_movx.5
+.L.else.asm_movx.5:
+.loc 1 1291 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.asm_movx.9
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.asm_movx.9
+  mov r10, 1
+  jmp .L.end.asm_movx.9
+.L.false.asm_movx.9:
+  mov r10, 0
+.L.end.asm_movx.9:
+  cmp r10, 0
+  je .L.false.asm_movx.8
+  lea r10, [rbp-49]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.false.asm_movx.8
+  mov r10, 1
+  jmp .L.end.asm_movx.8
+.L.false.asm_movx.8:
+  mov r10, 0
+.L.end.asm_movx.8:
+  cmp r10, 0
+  je .L.else.asm_movx.7
+.loc 1 1292 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 99
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_modrm
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.asm_movx.7
+.L.else.asm_movx.7:
+.loc 1 1294 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.146
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.asm_movx.7:
+.L.end.asm_movx.5:
+.L.end.asm_movx.3:
+.L.return.asm_movx:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+asm_unary:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rsi
+  mov [rbp-44], edi
+.loc 1 1299 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_rm
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.asm_unary.2
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.asm_unary.2
+  mov r10, 0
+  jmp .L.end.asm_unary.2
+.L.true.asm_unary.2:
+  mov r10, 1
+.L.end.asm_unary.2:
+  cmp r10, 0
+  je .L.end.asm_unary.1
+.loc 1 1300 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.147
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.asm_unary.1:
+.loc 1 1301 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je  .L.else.asm_unary.3
+  mov r10, 246
+  mov r10d, r10d
+  jmp .L.end.asm_unary.3
+.L.else.asm_unary.3:
+  mov r10, 247
+  mov r10d, r10d
+.L.end.asm_unary.3:
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_modrm
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.asm_unary:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+asm_shift:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdx
+  mov [rbp-48], rsi
+  mov [rbp-52], edi
+.loc 1 1306 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_rm
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.asm_shift.4
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.asm_shift.4
+  mov r10, 0
+  jmp .L.end.asm_shift.4
+.L.true.asm_shift.4:
+  mov r10, 1
+.L.end.asm_shift.4:
+  cmp r10, 0
+  jne .L.true.asm_shift.3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.asm_shift.3
+  mov r10, 0
+  jmp .L.end.asm_shift.3
+.L.true.asm_shift.3:
+  mov r10, 1
+.L.end.asm_shift.3:
+  cmp r10, 0
+  jne .L.true.asm_shift.2
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.asm_shift.2
+  mov r10, 0
+  jmp .L.end.asm_shift.2
+.L.true.asm_shift.2:
+  mov r10, 1
+.L.end.asm_shift.2:
+  cmp r10, 0
+  je .L.end.asm_shift.1
+.loc 1 1307 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.148
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.asm_shift.1:
+.loc 1 1308 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je  .L.else.asm_shift.5
+  mov r10, 210
+  mov r10d, r10d
+  jmp .L.end.asm_shift.5
+.L.else.asm_shift.5:
+  mov r10, 211
+  mov r10d, r10d
+.L.end.asm_shift.5:
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_modrm
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.asm_shift:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+asm_jump:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdx
+  mov [rbp-52], esi
+  mov [rbp-56], edi
+.loc 1 1312 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 3
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.asm_jump.1
+.loc 1 1313 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.149
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.asm_jump.1:
+.loc 1 1315 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit8
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1316 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.asm_jump.2
+.loc 1 1317 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit8
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.asm_jump.2:
+.loc 1 1319 40
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 32
+  push r10
+  sub rsp, 8
+  mov r10, offset calloc
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1320 3
+  mov r10, offset text
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 1321 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 1322 3
+  mov r10, offset cur_line
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10
+.loc 1 1323 3
+  mov r10, offset fixups
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 1324 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, offset fixups
+  mov [r11], r10
+.loc 1 1325 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset text
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.asm_jump:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+cond_code:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-56], rdi
+.loc 1 1333 4
+.loc 1 1335 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-44]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.cond_code.1:
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  movabs r11, 128
+  movabs r12, 8
+  mov rax, r11
+  mov rdx, 0
+  div r12
+  mov r11, rax
+  cmp r10, r11
+  setb al
+  movzb r10, al
+  cmp r10, 0
+  je .L.break.cond_code.1
+.loc 1 1336 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.150
+  lea r11, [rbp-44]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.cond_code.2
+.loc 1 1337 7
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.cond_code
+.L.end.cond_code.2:
+.L.continue.cond_code.1:
+.loc 1 1335 55
+  lea r10, [rbp-44]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.cond_code.1
+.L.break.cond_code.1:
+.loc 1 1338 3
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.cond_code
+.L.return.cond_code:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+expect_operands:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-36], esi
+  mov [rbp-40], edi
+.loc 1 1342 3
+  lea r10, [rbp-40]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.expect_operands.1
+.loc 1 1343 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.183
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.expect_operands.1:
+.L.return.expect_operands:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+assemble_insn:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], edx
+  mov [rbp-56], rsi
+  mov [rbp-64], rdi
+.loc 1 1347 3
+  mov r10, offset cur_sec
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.assemble_insn.1
+.loc 1 1348 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.184
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.assemble_insn.1:
+.loc 1 1350 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.185
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_insn.2
+.loc 1 1351 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset expect_operands
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1352 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_mov
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1353 5
+  jmp .L.return.assemble_insn
+.L.end.assemble_insn.2:
+.loc 1 1356 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.186
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_insn.3
+.loc 1 1357 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset expect_operands
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1358 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.assemble_insn.6
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.assemble_insn.6
+  mov r10, 0
+  jmp .L.end.assemble_insn.6
+.L.true.assemble_insn.6:
+  mov r10, 1
+.L.end.assemble_insn.6:
+  cmp r10, 0
+  jne .L.true.assemble_insn.5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.assemble_insn.5
+  mov r10, 0
+  jmp .L.end.assemble_insn.5
+.L.true.assemble_insn.5:
+  mov r10, 1
+.L.end.assemble_insn.5:
+  cmp r10, 0
+  je .L.end.assemble_insn.4
+.loc 1 1359 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.187
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.assemble_insn.4:
+.loc 1 1360 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, 184
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_opreg
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1361 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset text
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1362 5
+  jmp .L.return.assemble_insn
+.L.end.assemble_insn.3:
+.loc 1 1365 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.188
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_insn.7
+.loc 1 1366 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset expect_operands
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1367 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.assemble_insn.9
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.assemble_insn.9
+  mov r10, 0
+  jmp .L.end.assemble_insn.9
+.L.true.assemble_insn.9:
+  mov r10, 1
+.L.end.assemble_insn.9:
+  cmp r10, 0
+  je .L.end.assemble_insn.8
+.loc 1 1368 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.189
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.assemble_insn.8:
+.loc 1 1369 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 141
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_modrm
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1370 5
+  jmp .L.return.assemble_insn
+.L.end.assemble_insn.7:
+.loc 1 1373 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.190
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_insn.10
+.loc 1 1374 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset expect_operands
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1375 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_movx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1376 5
+  jmp .L.return.assemble_insn
+.L.end.assemble_insn.10:
+.loc 1 1379 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.191
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.assemble_insn.12
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.192
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.assemble_insn.12
+  mov r10, 0
+  jmp .L.end.assemble_insn.12
+.L.true.assemble_insn.12:
+  mov r10, 1
+.L.end.assemble_insn.12:
+  cmp r10, 0
+  je .L.end.assemble_insn.11
+.loc 1 1380 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset expect_operands
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1381 5
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r11, 4
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 98
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.assemble_insn.14
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.assemble_insn.14
+  mov r10, 1
+  jmp .L.end.assemble_insn.14
+.L.false.assemble_insn.14:
+  mov r10, 0
+.L.end.assemble_insn.14:
+  cmp r10, 0
+  je .L.end.assemble_insn.13
+.loc 1 1382 7
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 32
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  add r11, 8
+  mov [r11], r10d
+.L.end.assemble_insn.13:
+.loc 1 1383 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_movx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1384 5
+  jmp .L.return.assemble_insn
+.L.end.assemble_insn.11:
+.loc 1 1387 79
+.loc 1 1388 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-44]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.assemble_insn.15:
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  movabs r11, 64
+  movabs r12, 8
+  mov rax, r11
+  mov rdx, 0
+  div r12
+  mov r11, rax
+  cmp r10, r11
+  setb al
+  movzb r10, al
+  cmp r10, 0
+  je .L.break.assemble_insn.15
+.loc 1 1389 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.193
+  lea r11, [rbp-44]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_insn.16
+.loc 1 1390 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset expect_operands
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1391 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_alu
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1392 7
+  jmp .L.return.assemble_insn
+.L.end.assemble_insn.16:
+.L.continue.assemble_insn.15:
+.loc 1 1388 51
+  lea r10, [rbp-44]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.assemble_insn.15
+.L.break.assemble_insn.15:
+.loc 1 1396 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.210
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_insn.17
+.loc 1 1397 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset expect_operands
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1398 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.assemble_insn.19
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset is_rm
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.assemble_insn.19
+  mov r10, 0
+  jmp .L.end.assemble_insn.19
+.L.true.assemble_insn.19:
+  mov r10, 1
+.L.end.assemble_insn.19:
+  cmp r10, 0
+  je .L.end.assemble_insn.18
+.loc 1 1399 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.211
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.assemble_insn.18:
+.loc 1 1400 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 15
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 175
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_modrm
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1401 5
+  jmp .L.return.assemble_insn
+.L.end.assemble_insn.17:
+.loc 1 1404 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.212
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_insn.20
+.loc 1 1405 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset expect_operands
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1406 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_unary
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1407 5
+  jmp .L.return.assemble_insn
+.L.end.assemble_insn.20:
+.loc 1 1410 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.213
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_insn.21
+.loc 1 1411 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset expect_operands
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1412 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_unary
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1413 5
+  jmp .L.return.assemble_insn
+.L.end.assemble_insn.21:
+.loc 1 1416 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.214
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_insn.22
+.loc 1 1417 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset expect_operands
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1418 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_unary
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1419 5
+  jmp .L.return.assemble_insn
+.L.end.assemble_insn.22:
+.loc 1 1422 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.215
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_insn.23
+.loc 1 1423 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset expect_operands
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1424 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_shift
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1425 5
+  jmp .L.return.assemble_insn
+.L.end.assemble_insn.23:
+.loc 1 1428 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.216
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_insn.24
+.loc 1 1429 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset expect_operands
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1430 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_shift
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1431 5
+  jmp .L.return.assemble_insn
+.L.end.assemble_insn.24:
+.loc 1 1434 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.217
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_insn.25
+.loc 1 1435 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset expect_operands
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1436 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_shift
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1437 5
+  jmp .L.return.assemble_insn
+.L.end.assemble_insn.25:
+.loc 1 1440 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.218
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  push r10
+  sub rsp, 8
+  mov r10, offset strncmp
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.assemble_insn.27
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r11, 3
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset cond_code
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.assemble_insn.27
+  mov r10, 1
+  jmp .L.end.assemble_insn.27
+.L.false.assemble_insn.27:
+  mov r10, 0
+.L.end.assemble_insn.27:
+  cmp r10, 0
+  je .L.end.assemble_insn.26
+.loc 1 1441 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset expect_operands
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1442 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset is_rm
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_insn.28
+.loc 1 1443 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.219
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.assemble_insn.28:
+.loc 1 1444 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 15
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 144
+  mov r10d, r10d
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r11, 3
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset cond_code
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_modrm
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1445 5
+  jmp .L.return.assemble_insn
+.L.end.assemble_insn.26:
+.loc 1 1448 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.220
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_insn.29
+.loc 1 1449 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset expect_operands
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1450 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 233
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_jump
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1451 5
+  jmp .L.return.assemble_insn
+.L.end.assemble_insn.29:
+.loc 1 1454 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 106
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.assemble_insn.31
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset cond_code
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.assemble_insn.31
+  mov r10, 1
+  jmp .L.end.assemble_insn.31
+.L.false.assemble_insn.31:
+  mov r10, 0
+.L.end.assemble_insn.31:
+  cmp r10, 0
+  je .L.end.assemble_insn.30
+.loc 1 1455 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset expect_operands
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1456 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 15
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 128
+  mov r10d, r10d
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset cond_code
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_jump
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1457 5
+  jmp .L.return.assemble_insn
+.L.end.assemble_insn.30:
+.loc 1 1460 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.221
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_insn.32
+.loc 1 1461 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset expect_operands
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1462 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.assemble_insn.34
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.assemble_insn.34
+  mov r10, 0
+  jmp .L.end.assemble_insn.34
+.L.true.assemble_insn.34:
+  mov r10, 1
+.L.end.assemble_insn.34:
+  cmp r10, 0
+  je .L.end.assemble_insn.33
+.loc 1 1463 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.222
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.assemble_insn.33:
+.loc 1 1464 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 255
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_modrm
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1465 5
+  jmp .L.return.assemble_insn
+.L.end.assemble_insn.32:
+.loc 1 1468 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.223
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.assemble_insn.36
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.224
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.assemble_insn.36
+  mov r10, 0
+  jmp .L.end.assemble_insn.36
+.L.true.assemble_insn.36:
+  mov r10, 1
+.L.end.assemble_insn.36:
+  cmp r10, 0
+  je .L.end.assemble_insn.35
+.loc 1 1469 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset expect_operands
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1470 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.assemble_insn.38
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.assemble_insn.38
+  mov r10, 0
+  jmp .L.end.assemble_insn.38
+.L.true.assemble_insn.38:
+  mov r10, 1
+.L.end.assemble_insn.38:
+  cmp r10, 0
+  je .L.end.assemble_insn.37
+.loc 1 1471 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.225
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.assemble_insn.37:
+.loc 1 1472 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 117
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je  .L.else.assemble_insn.39
+  mov r10, 80
+  mov r10d, r10d
+  jmp .L.end.assemble_insn.39
+.L.else.assemble_insn.39:
+  mov r10, 88
+  mov r10d, r10d
+.L.end.assemble_insn.39:
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_opreg
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1473 5
+  jmp .L.return.assemble_insn
+.L.end.assemble_insn.35:
+.loc 1 1476 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.226
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_insn.40
+.loc 1 1477 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset expect_operands
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1478 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 195
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit8
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1479 5
+  jmp .L.return.assemble_insn
+.L.end.assemble_insn.40:
+.loc 1 1482 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.227
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_insn.41
+.loc 1 1483 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset expect_operands
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1484 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 72
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit8
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1485 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 153
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit8
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1486 5
+  jmp .L.return.assemble_insn
+.L.end.assemble_insn.41:
+.loc 1 1489 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.228
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_insn.42
+.loc 1 1490 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset expect_operands
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1491 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 153
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset emit8
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1492 5
+  jmp .L.return.assemble_insn
+.L.end.assemble_insn.42:
+.loc 1 1495 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.229
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.assemble_insn:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+assemble_data:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-60], ecx
+  mov [rbp-72], rdx
+  mov [rbp-76], esi
+  mov [rbp-88], rdi
+.loc 1 1503 3
+  mov r10, offset cur_sec
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.assemble_data.1
+.loc 1 1504 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.230
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.assemble_data.1:
+.loc 1 1507 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset isdigit
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  jne .L.true.assemble_data.3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 45
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.assemble_data.3
+  mov r10, 0
+  jmp .L.end.assemble_data.3
+.L.true.assemble_data.3:
+  mov r10, 1
+.L.end.assemble_data.3:
+  cmp r10, 0
+  je .L.end.assemble_data.2
+.loc 1 1508 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset data
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset parse_number
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-76]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1509 5
+  jmp .L.return.assemble_data
+.L.end.assemble_data.2:
+.loc 1 1512 16
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1513 3
+.L.begin.assemble_data.4:
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  lea r12, [rbp-60]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.assemble_data.6
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 43
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.assemble_data.6
+  mov r10, 1
+  jmp .L.end.assemble_data.6
+.L.false.assemble_data.6:
+  mov r10, 0
+.L.end.assemble_data.6:
+  cmp r10, 0
+  je .L.false.assemble_data.5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 45
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.assemble_data.5
+  mov r10, 1
+  jmp .L.end.assemble_data.5
+.L.false.assemble_data.5:
+  mov r10, 0
+.L.end.assemble_data.5:
+  cmp r10, 0
+  je .L.break.assemble_data.4
+.loc 1 1514 5
+  lea r10, [rbp-56]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+.L.continue.assemble_data.4:
+  jmp .L.begin.assemble_data.4
+.L.break.assemble_data.4:
+.loc 1 1516 3
+  lea r10, [rbp-76]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.assemble_data.7
+.loc 1 1517 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.231
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.assemble_data.7:
+.loc 1 1519 18
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1520 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  lea r12, [rbp-60]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.assemble_data.8
+.loc 1 1521 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  lea r11, [rbp-60]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset parse_number
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.L.end.assemble_data.8:
+.loc 1 1522 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset data_relocs
+  push r10
+  sub rsp, 8
+  mov r10, offset data
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset get_symbol
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_reloc
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1523 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset data
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.assemble_data:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+assemble_directive:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-60], edx
+  mov [rbp-72], rsi
+  mov [rbp-80], rdi
+.loc 1 1527 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.232
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_directive.1
+.loc 1 1528 5
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, offset cur_sec
+  mov [r11], r10d
+.loc 1 1529 5
+  jmp .L.return.assemble_directive
+.L.end.assemble_directive.1:
+.loc 1 1532 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.233
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_directive.2
+.loc 1 1533 5
+  mov r10, 1
+  mov r10d, r10d
+  mov r11, offset cur_sec
+  mov [r11], r10d
+.loc 1 1534 5
+  jmp .L.return.assemble_directive
+.L.end.assemble_directive.2:
+.loc 1 1537 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.234
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_directive.3
+.loc 1 1538 5
+  mov r10, 2
+  mov r10d, r10d
+  mov r11, offset cur_sec
+  mov [r11], r10d
+.loc 1 1539 5
+  jmp .L.return.assemble_directive
+.L.end.assemble_directive.3:
+.loc 1 1542 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.235
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_directive.4
+.loc 1 1543 5
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset get_symbol
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  add r11, 32
+  mov [r11], r10b
+.loc 1 1544 5
+  jmp .L.return.assemble_directive
+.L.end.assemble_directive.4:
+.loc 1 1547 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.236
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_directive.5
+.loc 1 1548 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset parse_number
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1549 5
+  mov r10, offset align
+  mov r11, offset cur_sec
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.assemble_directive.6
+.loc 1 1550 7
+  lea r10, [rbp-56]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, offset align
+  mov r12, offset cur_sec
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.end.assemble_directive.6:
+.loc 1 1552 5
+  mov r10, offset cur_sec
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.assemble_directive.7
+.loc 1 1553 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset text
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_align
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.assemble_directive.7
+.L.else.assemble_directive.7:
+.loc 1 1554 10
+  mov r10, offset cur_sec
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.assemble_directive.8
+.loc 1 1555 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset data
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_align
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.assemble_directive.8
+.L.else.assemble_directive.8:
+.loc 1 1557 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset bss_size
+  mov r10, [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset align_to
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  mov r11, offset bss_size
+  mov [r11], r10
+.L.end.assemble_directive.8:
+.L.end.assemble_directive.7:
+.loc 1 1558 5
+  jmp .L.return.assemble_directive
+.L.end.assemble_directive.5:
+.loc 1 1561 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.237
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_directive.9
+.loc 1 1562 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset parse_number
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1563 5
+  mov r10, offset cur_sec
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.assemble_directive.10
+.loc 1 1564 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset text
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_zero
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.assemble_directive.10
+.L.else.assemble_directive.10:
+.loc 1 1565 10
+  mov r10, offset cur_sec
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.assemble_directive.11
+.loc 1 1566 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset data
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_zero
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.assemble_directive.11
+.L.else.assemble_directive.11:
+.loc 1 1568 7
+  mov r10, offset bss_size
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+.L.end.assemble_directive.11:
+.L.end.assemble_directive.10:
+.loc 1 1569 5
+  jmp .L.return.assemble_directive
+.L.end.assemble_directive.9:
+.loc 1 1572 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.238
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_directive.12
+.loc 1 1573 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset assemble_data
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1574 5
+  jmp .L.return.assemble_directive
+.L.end.assemble_directive.12:
+.loc 1 1577 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.239
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_directive.13
+.loc 1 1578 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset assemble_data
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1579 5
+  jmp .L.return.assemble_directive
+.L.end.assemble_directive.13:
+.loc 1 1582 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.240
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_directive.14
+.loc 1 1583 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset assemble_data
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1584 5
+  jmp .L.return.assemble_directive
+.L.end.assemble_directive.14:
+.loc 1 1587 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.241
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_directive.15
+.loc 1 1588 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset assemble_data
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1589 5
+  jmp .L.return.assemble_directive
+.L.end.assemble_directive.15:
+.loc 1 1592 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.242
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble_directive.16
+.loc 1 1594 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 34
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset strchr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1595 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.assemble_directive.18
+  mov r10, offset source_file
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.assemble_directive.18
+  mov r10, 1
+  jmp .L.end.assemble_directive.18
+.L.false.assemble_directive.18:
+  mov r10, 0
+.L.end.assemble_directive.18:
+  cmp r10, 0
+  je .L.end.assemble_directive.17
+.loc 1 1596 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  lea r11, [rbp-60]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  sub r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset strndup
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r11, offset source_file
+  mov [r11], r10
+.L.end.assemble_directive.17:
+.loc 1 1597 5
+  jmp .L.return.assemble_directive
+.L.end.assemble_directive.16:
+.loc 1 1600 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.243
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.assemble_directive.20
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.244
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.assemble_directive.20
+  mov r10, 0
+  jmp .L.end.assemble_directive.20
+.L.true.assemble_directive.20:
+  mov r10, 1
+.L.end.assemble_directive.20:
+  cmp r10, 0
+  je .L.end.assemble_directive.19
+.loc 1 1601 5
+  jmp .L.return.assemble_directive
+.L.end.assemble_directive.19:
+.loc 1 1603 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.245
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.assemble_directive:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+assemble_line:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 208
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-200], rsi
+  mov [rbp-208], rdi
+.loc 1 1608 3
+  lea r10, [rbp-208]
+  mov r10, [r10]
+  mov r11, offset cur_line
+  mov [r11], r10
+.loc 1 1610 3
+.L.begin.assemble_line.1:
+  lea r10, [rbp-208]
+  mov r10, [r10]
+  lea r11, [rbp-200]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.assemble_line.2
+  lea r10, [rbp-208]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 32
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.assemble_line.2
+  mov r10, 1
+  jmp .L.end.assemble_line.2
+.L.false.assemble_line.2:
+  mov r10, 0
+.L.end.assemble_line.2:
+  cmp r10, 0
+  je .L.break.assemble_line.1
+.loc 1 1611 5
+  lea r10, [rbp-208]
+  lea r11, [rbp-192]
+  mov [r11], r10
+  lea r10, [rbp-192]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-192]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-192]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+.L.continue.assemble_line.1:
+  jmp .L.begin.assemble_line.1
+.L.break.assemble_line.1:
+.loc 1 1612 3
+  lea r10, [rbp-208]
+  mov r10, [r10]
+  lea r11, [rbp-200]
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.assemble_line.3
+.loc 1 1613 5
+  jmp .L.return.assemble_line
+.L.end.assemble_line.3:
+.loc 1 1616 3
+  lea r10, [rbp-200]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  sub r11d, r12d
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 58
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.assemble_line.4
+.loc 1 1617 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-208]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-200]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  sub r10, r11
+  lea r11, [rbp-208]
+  mov r11, [r11]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset define_symbol
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1618 5
+  jmp .L.return.assemble_line
+.L.end.assemble_line.4:
+.loc 1 1622 16
+.loc 1 1623 14
+  lea r10, [rbp-208]
+  mov r10, [r10]
+  lea r11, [rbp-168]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1624 3
+.L.begin.assemble_line.5:
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  lea r11, [rbp-200]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.assemble_line.6
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 32
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.assemble_line.6
+  mov r10, 1
+  jmp .L.end.assemble_line.6
+.L.false.assemble_line.6:
+  mov r10, 0
+.L.end.assemble_line.6:
+  cmp r10, 0
+  je .L.break.assemble_line.5
+.loc 1 1625 5
+  lea r10, [rbp-168]
+  lea r11, [rbp-160]
+  mov [r11], r10
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-160]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+.L.continue.assemble_line.5:
+  jmp .L.begin.assemble_line.5
+.L.break.assemble_line.5:
+.loc 1 1627 18
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  lea r11, [rbp-208]
+  mov r11, [r11]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-148]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1628 3
+  movabs r10, 16
+  lea r11, [rbp-148]
+  mov r11d, dword ptr [r11]
+  movsx r11, r11d
+  cmp r10, r11
+  setbe al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.assemble_line.7
+.loc 1 1629 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.246
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.assemble_line.7:
+.loc 1 1630 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-184]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-208]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-148]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset memcpy
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1631 3
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-184]
+  lea r12, [rbp-148]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.loc 1 1633 3
+.L.begin.assemble_line.8:
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  lea r11, [rbp-200]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.assemble_line.9
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 32
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.assemble_line.9
+  mov r10, 1
+  jmp .L.end.assemble_line.9
+.L.false.assemble_line.9:
+  mov r10, 0
+.L.end.assemble_line.9:
+  cmp r10, 0
+  je .L.break.assemble_line.8
+.loc 1 1634 5
+  lea r10, [rbp-168]
+  lea r11, [rbp-144]
+  mov [r11], r10
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-144]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+.L.continue.assemble_line.8:
+  jmp .L.begin.assemble_line.8
+.L.break.assemble_line.8:
+.loc 1 1636 3
+  lea r10, [rbp-184]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 46
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.assemble_line.10
+.loc 1 1637 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-184]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-200]
+  mov r10, [r10]
+  lea r11, [rbp-168]
+  mov r11, [r11]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset assemble_directive
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1638 5
+  jmp .L.return.assemble_line
+.L.end.assemble_line.10:
+.loc 1 1642 17
+.loc 1 1643 15
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-68]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1644 3
+.L.begin.assemble_line.11:
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  lea r11, [rbp-200]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.break.assemble_line.11
+.loc 1 1645 5
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1646 5
+.L.begin.assemble_line.12:
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  lea r11, [rbp-200]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.assemble_line.13
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 44
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.assemble_line.13
+  mov r10, 1
+  jmp .L.end.assemble_line.13
+.L.false.assemble_line.13:
+  mov r10, 0
+.L.end.assemble_line.13:
+  cmp r10, 0
+  je .L.break.assemble_line.12
+.loc 1 1647 7
+  lea r10, [rbp-168]
+  lea r11, [rbp-56]
+  mov [r11], r10
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+.L.continue.assemble_line.12:
+  jmp .L.begin.assemble_line.12
+.L.break.assemble_line.12:
+.loc 1 1648 5
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.assemble_line.14
+.loc 1 1649 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.247
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.assemble_line.14:
+.loc 1 1650 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-136]
+  lea r11, [rbp-68]
+  lea r12, [rbp-48]
+  mov [r12], r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  add r11d, r12d
+  mov r11d, r11d
+  lea r12, [rbp-48]
+  mov r12, [r12]
+  mov [r12], r11d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, -1
+  mov r12d, r12d
+  add r11d, r12d
+  mov r11d, r11d
+  mov r12, 32
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset parse_operand
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1651 5
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  lea r11, [rbp-200]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.assemble_line.15
+.loc 1 1652 7
+  lea r10, [rbp-168]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+.L.end.assemble_line.15:
+.L.continue.assemble_line.11:
+  jmp .L.begin.assemble_line.11
+.L.break.assemble_line.11:
+.loc 1 1655 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-184]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-136]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset assemble_insn
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.assemble_line:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+resolve_fixups:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 1659 3
+  mov r10, offset fixups
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.resolve_fixups.1:
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.resolve_fixups.1
+.loc 1 1660 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  mov r11, offset cur_line
+  mov [r11], r10
+.loc 1 1661 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 16
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.resolve_fixups.2
+.loc 1 1662 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.248
+  push r10
+  sub rsp, 8
+  mov r10, offset asm_error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.resolve_fixups.2:
+.loc 1 1663 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset text
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov r11, [r11]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  sub r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset patch32
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.resolve_fixups.1:
+.loc 1 1659 34
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  jmp .L.begin.resolve_fixups.1
+.L.break.resolve_fixups.1:
+.L.return.resolve_fixups:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+add_string:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 1672 27
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1673 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strlen
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_put
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1674 3
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.add_string
+.L.return.add_string:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+write_symbol:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], r9
+  mov [rbp-44], r8d
+  mov [rbp-48], ecx
+  mov [rbp-52], edx
+  mov [rbp-56], esi
+  mov [rbp-64], rdi
+.loc 1 1678 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1679 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r11, 4
+  mov rcx, r11
+  shl r10d, cl
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  or r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1680 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1681 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1682 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1683 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.write_symbol:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+write_relocs:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-72], rsi
+  mov [rbp-80], rdi
+.loc 1 1687 3
+.L.begin.write_relocs.1:
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.write_relocs.1
+.loc 1 1688 5
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1689 30
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1690 14
+.loc 1 1692 5
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 16
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  sub r11d, r12d
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.write_relocs.3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_local_label
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.false.write_relocs.3
+  mov r10, 1
+  jmp .L.end.write_relocs.3
+.L.false.write_relocs.3:
+  mov r10, 0
+.L.end.write_relocs.3:
+  cmp r10, 0
+  je .L.end.write_relocs.2
+.loc 1 1693 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.249
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.write_relocs.2:
+.loc 1 1695 5
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 16
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  sub r11d, r12d
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.write_relocs.5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_local_label
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.false.write_relocs.5
+  mov r10, 1
+  jmp .L.end.write_relocs.5
+.L.false.write_relocs.5:
+  mov r10, 0
+.L.end.write_relocs.5:
+  cmp r10, 0
+  je .L.else.write_relocs.4
+.loc 1 1698 7
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 16
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov r11, offset source_file
+  mov r11, [r11]
+  cmp r11, 0
+  je  .L.else.write_relocs.6
+  mov r11, 1
+  mov r11d, r11d
+  jmp .L.end.write_relocs.6
+.L.else.write_relocs.6:
+  mov r11, 0
+  mov r11d, r11d
+.L.end.write_relocs.6:
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-44]
+  mov [r11], r10d
+.loc 1 1699 7
+  lea r10, [rbp-56]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 24
+  mov r11, [r11]
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+  jmp .L.end.write_relocs.4
+.L.else.write_relocs.4:
+.loc 1 1701 7
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 36
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-44]
+  mov [r11], r10d
+.L.end.write_relocs.4:
+.loc 1 1704 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1705 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  mov r11, 32
+  mov rcx, r11
+  shl r10, cl
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  add r11, 16
+  mov r11d, dword ptr [r11]
+  movsx r11, r11d
+  or r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1706 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.write_relocs.1:
+.loc 1 1687 15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov [r11], r10
+  jmp .L.begin.write_relocs.1
+.L.break.write_relocs.1:
+.L.return.write_relocs:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+write_shdr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rsi
+  mov [rbp-48], rdi
+.loc 1 1711 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1712 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1713 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1714 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1715 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1716 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1717 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 32
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1718 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 36
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1719 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 40
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1720 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 44
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.write_shdr:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+symbol_type:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 1724 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 16
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.symbol_type.1
+.loc 1 1725 5
+  mov r10, 2
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.symbol_type
+.L.end.symbol_type.1:
+.loc 1 1726 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 16
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  sub r11d, r12d
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.symbol_type.2
+.loc 1 1727 5
+  mov r10, 0
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.symbol_type
+.L.end.symbol_type.2:
+.loc 1 1728 3
+  mov r10, 1
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.symbol_type
+.L.return.symbol_type:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+write_elf:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 896
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-896], rdi
+.loc 1 1732 22
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-888]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-888]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-888]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1733 22
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-864]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-864]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-864]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1734 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-888]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1737 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-864]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset write_symbol
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1738 16
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-836]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1740 3
+  mov r10, offset source_file
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.write_elf.1
+.loc 1 1741 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-864]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-888]
+  push r10
+  sub rsp, 8
+  mov r10, offset source_file
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_string
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 65521
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset write_symbol
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1742 5
+  lea r10, [rbp-836]
+  lea r11, [rbp-832]
+  mov [r11], r10
+  lea r10, [rbp-832]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-832]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-832]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.end.write_elf.1:
+.loc 1 1745 3
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-820]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.write_elf.2:
+  lea r10, [rbp-820]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 3
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.write_elf.2
+.loc 1 1746 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-864]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-820]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset write_symbol
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1747 5
+  lea r10, [rbp-836]
+  lea r11, [rbp-808]
+  mov [r11], r10
+  lea r10, [rbp-808]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-808]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-808]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.continue.write_elf.2:
+.loc 1 1745 38
+  lea r10, [rbp-820]
+  lea r11, [rbp-816]
+  mov [r11], r10
+  lea r10, [rbp-816]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-816]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-816]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.write_elf.2
+.L.break.write_elf.2:
+.loc 1 1751 3
+  mov r10, offset sym_head
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-800]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.write_elf.3:
+  lea r10, [rbp-800]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.write_elf.3
+.loc 1 1752 5
+  lea r10, [rbp-800]
+  mov r10, [r10]
+  add r10, 32
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  jne .L.true.write_elf.6
+  lea r10, [rbp-800]
+  mov r10, [r10]
+  add r10, 16
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  sub r11d, r12d
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.write_elf.6
+  mov r10, 0
+  jmp .L.end.write_elf.6
+.L.true.write_elf.6:
+  mov r10, 1
+.L.end.write_elf.6:
+  cmp r10, 0
+  jne .L.true.write_elf.5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-800]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_local_label
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  jne .L.true.write_elf.5
+  mov r10, 0
+  jmp .L.end.write_elf.5
+.L.true.write_elf.5:
+  mov r10, 1
+.L.end.write_elf.5:
+  cmp r10, 0
+  je .L.end.write_elf.4
+.loc 1 1753 7
+  jmp .L.continue.write_elf.3
+.L.end.write_elf.4:
+.loc 1 1754 5
+  lea r10, [rbp-836]
+  lea r11, [rbp-792]
+  mov [r11], r10
+  lea r10, [rbp-792]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-792]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-792]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-800]
+  mov r11, [r11]
+  add r11, 36
+  mov [r11], r10d
+.loc 1 1755 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-864]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-888]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-800]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_string
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1756 29
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-800]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset symbol_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-800]
+  mov r11, [r11]
+  add r11, 16
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-800]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+.loc 1 1755 5
+  mov r10, offset write_symbol
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.write_elf.3:
+.loc 1 1751 42
+  lea r10, [rbp-800]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-800]
+  mov [r11], r10
+  jmp .L.begin.write_elf.3
+.L.break.write_elf.3:
+.loc 1 1759 27
+  lea r10, [rbp-836]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-780]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1761 3
+  mov r10, offset sym_head
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-776]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.write_elf.7:
+  lea r10, [rbp-776]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.write_elf.7
+.loc 1 1762 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-776]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_local_label
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  jne .L.true.write_elf.9
+  lea r10, [rbp-776]
+  mov r10, [r10]
+  add r10, 32
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  jne .L.true.write_elf.10
+  lea r10, [rbp-776]
+  mov r10, [r10]
+  add r10, 16
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  sub r11d, r12d
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.write_elf.10
+  mov r10, 0
+  jmp .L.end.write_elf.10
+.L.true.write_elf.10:
+  mov r10, 1
+.L.end.write_elf.10:
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.write_elf.9
+  mov r10, 0
+  jmp .L.end.write_elf.9
+.L.true.write_elf.9:
+  mov r10, 1
+.L.end.write_elf.9:
+  cmp r10, 0
+  je .L.end.write_elf.8
+.loc 1 1763 7
+  jmp .L.continue.write_elf.7
+.L.end.write_elf.8:
+.loc 1 1764 5
+  lea r10, [rbp-836]
+  lea r11, [rbp-768]
+  mov [r11], r10
+  lea r10, [rbp-768]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-768]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-768]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-776]
+  mov r11, [r11]
+  add r11, 36
+  mov [r11], r10d
+.loc 1 1765 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-864]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-888]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-776]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_string
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1766 29
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-776]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset symbol_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-776]
+  mov r10, [r10]
+  add r10, 16
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  sub r11d, r12d
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je  .L.else.write_elf.11
+  mov r10, 0
+  mov r10d, r10d
+  jmp .L.end.write_elf.11
+.L.else.write_elf.11:
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-776]
+  mov r11, [r11]
+  add r11, 16
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.L.end.write_elf.11:
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1767 23
+  lea r10, [rbp-776]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+.loc 1 1765 5
+  mov r10, offset write_symbol
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.write_elf.7:
+.loc 1 1761 42
+  lea r10, [rbp-776]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-776]
+  mov [r11], r10
+  jmp .L.begin.write_elf.7
+.L.break.write_elf.7:
+.loc 1 1770 25
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-760]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-760]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-760]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1771 25
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-736]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-736]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-736]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1772 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-760]
+  push r10
+  sub rsp, 8
+  mov r10, offset text_relocs
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset write_relocs
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1773 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-736]
+  push r10
+  sub rsp, 8
+  mov r10, offset data_relocs
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset write_relocs
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1775 24
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-712]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-712]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-712]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1776 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-712]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1777 49
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-712]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.250
+  push r10
+  sub rsp, 8
+  mov r10, offset add_string
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-684]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1778 49
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-712]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.251
+  push r10
+  sub rsp, 8
+  mov r10, offset add_string
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-680]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1779 47
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-712]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.252
+  push r10
+  sub rsp, 8
+  mov r10, offset add_string
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-676]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1780 59
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-712]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.253
+  push r10
+  sub rsp, 8
+  mov r10, offset add_string
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-672]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1781 59
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-712]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.254
+  push r10
+  sub rsp, 8
+  mov r10, offset add_string
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-668]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1782 53
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-712]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.255
+  push r10
+  sub rsp, 8
+  mov r10, offset add_string
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-664]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1783 53
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-712]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.256
+  push r10
+  sub rsp, 8
+  mov r10, offset add_string
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-660]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1784 57
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-712]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.257
+  push r10
+  sub rsp, 8
+  mov r10, offset add_string
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-656]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1785 59
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-712]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.258
+  push r10
+  sub rsp, 8
+  mov r10, offset add_string
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-652]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1789 19
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-648]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-648]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-648]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1790 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-648]
+  push r10
+  sub rsp, 8
+  mov r10, 64
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_zero
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1792 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-648]
+  push r10
+  sub rsp, 8
+  mov r10, 16
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_align
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1793 26
+  lea r10, [rbp-648]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-624]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1794 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-648]
+  push r10
+  sub rsp, 8
+  mov r10, offset text
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset text
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_put
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1796 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-648]
+  push r10
+  sub rsp, 8
+  mov r10, 16
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_align
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1797 26
+  lea r10, [rbp-648]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-616]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1798 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-648]
+  push r10
+  sub rsp, 8
+  mov r10, offset data
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset data
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_put
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1800 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-648]
+  push r10
+  sub rsp, 8
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_align
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1801 31
+  lea r10, [rbp-648]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-608]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1802 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-648]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-760]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-760]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_put
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1804 31
+  lea r10, [rbp-648]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-600]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1805 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-648]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-736]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-736]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_put
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1807 28
+  lea r10, [rbp-648]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-592]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1808 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-648]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-864]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-864]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_put
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1810 28
+  lea r10, [rbp-648]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-584]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1811 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-648]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-888]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-888]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_put
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1813 30
+  lea r10, [rbp-648]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-576]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1814 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-648]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-712]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-712]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_put
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1816 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-648]
+  push r10
+  sub rsp, 8
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_align
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1817 26
+  lea r10, [rbp-648]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-568]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1819 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-556]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.write_elf.12:
+  lea r10, [rbp-556]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 3
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.write_elf.12
+.loc 1 1820 5
+  mov r10, offset align
+  lea r11, [rbp-556]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.write_elf.13
+.loc 1 1821 7
+  mov r10, 1
+  mov r10d, r10d
+  mov r11, offset align
+  lea r12, [rbp-556]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.end.write_elf.13:
+.L.continue.write_elf.12:
+.loc 1 1819 26
+  lea r10, [rbp-556]
+  lea r11, [rbp-552]
+  mov [r11], r10
+  lea r10, [rbp-552]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-552]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-552]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.write_elf.12
+.L.break.write_elf.12:
+.loc 1 1823 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-648]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-544]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-544]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-544]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-544]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-544]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-544]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-544]
+  mov r12, 36
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-544]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-544]
+  mov r12, 44
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-544]
+  push r10
+  sub rsp, 8
+  mov r10, offset write_shdr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1824 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-648]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-684]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-496]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-496]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  or r10d, r11d
+  movsx r10, r10d
+  lea r11, [rbp-496]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-624]
+  mov r10, [r10]
+  lea r11, [rbp-496]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, offset text
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-496]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-496]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-496]
+  mov r12, 36
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, offset align
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-496]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-496]
+  mov r12, 44
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-496]
+  push r10
+  sub rsp, 8
+  mov r10, offset write_shdr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1825 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-648]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-680]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-448]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-448]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  or r10d, r11d
+  movsx r10, r10d
+  lea r11, [rbp-448]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-616]
+  mov r10, [r10]
+  lea r11, [rbp-448]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, offset data
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-448]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-448]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-448]
+  mov r12, 36
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, offset align
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-448]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-448]
+  mov r12, 44
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-448]
+  push r10
+  sub rsp, 8
+  mov r10, offset write_shdr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1826 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-648]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-676]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-400]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 8
+  mov r10d, r10d
+  lea r11, [rbp-400]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  or r10d, r11d
+  movsx r10, r10d
+  lea r11, [rbp-400]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-616]
+  mov r10, [r10]
+  mov r11, offset data
+  add r11, 8
+  mov r11, [r11]
+  add r10, r11
+  lea r11, [rbp-400]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, offset bss_size
+  mov r10, [r10]
+  lea r11, [rbp-400]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-400]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-400]
+  mov r12, 36
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, offset align
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-400]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-400]
+  mov r12, 44
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-400]
+  push r10
+  sub rsp, 8
+  mov r10, offset write_shdr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1827 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-648]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-672]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-352]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 4
+  mov r10d, r10d
+  lea r11, [rbp-352]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 64
+  movsx r10, r10d
+  lea r11, [rbp-352]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-608]
+  mov r10, [r10]
+  lea r11, [rbp-352]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-760]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-352]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 6
+  mov r10d, r10d
+  lea r11, [rbp-352]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-352]
+  mov r12, 36
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 8
+  mov r10d, r10d
+  lea r11, [rbp-352]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 24
+  mov r10d, r10d
+  lea r11, [rbp-352]
+  mov r12, 44
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-352]
+  push r10
+  sub rsp, 8
+  mov r10, offset write_shdr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1828 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-648]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-668]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-304]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 4
+  mov r10d, r10d
+  lea r11, [rbp-304]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 64
+  movsx r10, r10d
+  lea r11, [rbp-304]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-600]
+  mov r10, [r10]
+  lea r11, [rbp-304]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-736]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-304]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 6
+  mov r10d, r10d
+  lea r11, [rbp-304]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-304]
+  mov r12, 36
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 8
+  mov r10d, r10d
+  lea r11, [rbp-304]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 24
+  mov r10d, r10d
+  lea r11, [rbp-304]
+  mov r12, 44
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-304]
+  push r10
+  sub rsp, 8
+  mov r10, offset write_shdr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1829 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-648]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-664]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-256]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-256]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-256]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-592]
+  mov r10, [r10]
+  lea r11, [rbp-256]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-864]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-256]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 7
+  mov r10d, r10d
+  lea r11, [rbp-256]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-780]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-256]
+  mov r12, 36
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 8
+  mov r10d, r10d
+  lea r11, [rbp-256]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 24
+  mov r10d, r10d
+  lea r11, [rbp-256]
+  mov r12, 44
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-256]
+  push r10
+  sub rsp, 8
+  mov r10, offset write_shdr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1830 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-648]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-660]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-208]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-208]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-208]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-584]
+  mov r10, [r10]
+  lea r11, [rbp-208]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-888]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-208]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-208]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-208]
+  mov r12, 36
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-208]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-208]
+  mov r12, 44
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-208]
+  push r10
+  sub rsp, 8
+  mov r10, offset write_shdr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1831 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-648]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-656]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-160]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-160]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-160]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-576]
+  mov r10, [r10]
+  lea r11, [rbp-160]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-712]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-160]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-160]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-160]
+  mov r12, 36
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-160]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-160]
+  mov r12, 44
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-160]
+  push r10
+  sub rsp, 8
+  mov r10, offset write_shdr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1832 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-648]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-652]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-112]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-112]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-112]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  lea r10, [rbp-568]
+  mov r10, [r10]
+  lea r11, [rbp-112]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-112]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-112]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-112]
+  mov r12, 36
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-112]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-112]
+  mov r12, 44
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  lea r10, [rbp-112]
+  push r10
+  sub rsp, 8
+  mov r10, offset write_shdr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1835 21
+  lea r10, [rbp-648]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1836 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.269
+  push r10
+  sub rsp, 8
+  mov r10, 4
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset memcpy
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1837 3
+  mov r10, 2
+  movsx r10, r10b
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov r12, 4
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.loc 1 1838 3
+  mov r10, 1
+  movsx r10, r10b
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov r12, 5
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.loc 1 1839 3
+  mov r10, 1
+  movsx r10, r10b
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov r12, 6
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.loc 1 1841 19
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-56]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-56]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1842 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1843 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  push r10
+  sub rsp, 8
+  mov r10, 62
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1844 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1845 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1846 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1847 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-568]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1848 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1849 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  push r10
+  sub rsp, 8
+  mov r10, 64
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1850 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1851 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1852 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  push r10
+  sub rsp, 8
+  mov r10, 64
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1853 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  push r10
+  sub rsp, 8
+  mov r10, 10
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1854 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  push r10
+  sub rsp, 8
+  mov r10, 8
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_int
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1855 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r11, 16
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset memcpy
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1857 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-896]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset open_output
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1858 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-648]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-648]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset write_output
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1859 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-648]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset timer_count
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.write_elf:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl assemble
+assemble:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-56], rsi
+  mov [rbp-64], rdi
+.loc 1 1864 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset init_registers
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1866 18
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1867 3
+.L.begin.assemble.1:
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.break.assemble.1
+.loc 1 1868 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 10
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset strchr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1869 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.assemble.2
+.loc 1 1870 7
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strlen
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  mov r12, 1
+  movsx r12, r12d
+  imul r11, r12
+  add r10, r11
+  lea r11, [rbp-40]
+  mov [r11], r10
+.L.end.assemble.2:
+.loc 1 1871 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset assemble_line
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1872 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je  .L.else.assemble.3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  jmp .L.end.assemble.3
+.L.else.assemble.3:
+  lea r10, [rbp-40]
+  mov r10, [r10]
+.L.end.assemble.3:
+  lea r11, [rbp-48]
+  mov [r11], r10
+.L.continue.assemble.1:
+  jmp .L.begin.assemble.1
+.L.break.assemble.1:
+.loc 1 1875 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset resolve_fixups
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1876 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset write_elf
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.assemble:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,4795 @@
+.file 1 "cache.c"
+.intel_syntax noprefix
+.bss
+.align 1
+.globl cache_stats
+cache_stats:
+  .zero 1
+.align 8
+.globl cache_dir
+cache_dir:
+  .zero 8
+.data
+.align 1
+.L.data.11:
+  .byte 99
+  .byte 97
+  .byte 99
+  .byte 104
+  .byte 101
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 101
+  .byte 110
+  .byte 116
+  .byte 114
+  .byte 105
+  .byte 101
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 32
+  .byte 98
+  .byte 121
+  .byte 116
+  .byte 101
+  .byte 115
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 105
+  .byte 109
+  .byte 105
+  .byte 116
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 32
+  .byte 98
+  .byte 121
+  .byte 116
+  .byte 101
+  .byte 115
+  .byte 41
+  .byte 10
+  .zero 1
+.align 1
+.L.data.10:
+  .byte 40
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 46
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 37
+  .byte 37
+  .byte 32
+  .byte 104
+  .byte 105
+  .byte 116
+  .byte 32
+  .byte 114
+  .byte 97
+  .byte 116
+  .byte 101
+  .byte 41
+  .byte 10
+  .zero 1
+.align 1
+.L.data.9:
+  .byte 99
+  .byte 97
+  .byte 99
+  .byte 104
+  .byte 101
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 32
+  .byte 104
+  .byte 105
+  .byte 116
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 32
+  .byte 109
+  .byte 105
+  .byte 115
+  .byte 115
+  .byte 101
+  .byte 115
+  .byte 32
+  .zero 1
+.align 1
+.L.data.8:
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .byte 46
+  .byte 116
+  .byte 109
+  .byte 112
+  .zero 1
+.align 1
+.L.data.7:
+  .byte 46
+  .byte 115
+  .zero 1
+.align 1
+.L.data.6:
+  .byte 37
+  .byte 46
+  .byte 42
+  .byte 115
+  .zero 1
+.align 1
+.L.data.5:
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 10
+  .zero 1
+.align 1
+.L.data.4:
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 116
+  .byte 115
+  .zero 1
+.align 1
+.L.data.3:
+  .byte 37
+  .byte 48
+  .byte 49
+  .byte 54
+  .byte 108
+  .byte 120
+  .byte 37
+  .byte 48
+  .byte 49
+  .byte 54
+  .byte 108
+  .byte 120
+  .byte 46
+  .byte 115
+  .zero 1
+.align 1
+.L.data.2:
+  .byte 47
+  .byte 112
+  .byte 114
+  .byte 111
+  .byte 99
+  .byte 47
+  .byte 115
+  .byte 101
+  .byte 108
+  .byte 102
+  .byte 47
+  .byte 101
+  .byte 120
+  .byte 101
+  .zero 1
+.align 1
+.L.data.1:
+  .byte 37
+  .byte 115
+  .byte 47
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.0:
+  .byte 112
+  .byte 117
+  .byte 110
+  .byte 121
+  .byte 99
+  .byte 45
+  .byte 99
+  .byte 97
+  .byte 99
+  .byte 104
+  .byte 101
+  .byte 45
+  .byte 51
+  .zero 1
+.align 8
+cache_version:
+  .quad .L.data.0+0
+.align 8
+.globl cache_max_size
+cache_max_size:
+  .quad 268435456
+.text
+assert:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.L.return.assert:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+va_end:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.L.return.va_end:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+hash_bytes:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 112
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-88], rdx
+  mov [rbp-96], rsi
+  mov [rbp-104], rdi
+.loc 1 774 3
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.hash_bytes.1:
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.break.hash_bytes.1
+.loc 1 775 5
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-96]
+  mov r11, [r11]
+  lea r12, [rbp-80]
+  mov r12, [r12]
+  mov r13, 1
+  movsx r13, r13d
+  imul r12, r13
+  add r11, r12
+  movsx r11d, byte ptr [r11]
+  movzx r11, r11b
+  xor r10, r11
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 778 49
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  movabs r11, 4294967295
+  and r10, r11
+  mov r11, 315
+  movsx r11, r11d
+  imul r10, r11
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 779 55
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r11, 32
+  mov rcx, r11
+  shr r10, cl
+  mov r11, 315
+  movsx r11, r11d
+  imul r10, r11
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov r12, 32
+  mov rcx, r12
+  shr r11, cl
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 780 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r11, 32
+  mov rcx, r11
+  shl r10, cl
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  movabs r12, 4294967295
+  and r11, r12
+  or r10, r11
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 781 5
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  mov r11, 315
+  movsx r11, r11d
+  imul r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov r12, 32
+  mov rcx, r12
+  shr r11, cl
+  add r10, r11
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 784 5
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 0
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov r12, 24
+  mov rcx, r12
+  shl r11, cl
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+.L.continue.hash_bytes.1:
+.loc 1 774 29
+  lea r10, [rbp-80]
+  lea r11, [rbp-72]
+  mov [r11], r10
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+  jmp .L.begin.hash_bytes.1
+.L.break.hash_bytes.1:
+.L.return.hash_bytes:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+hash_long:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rsi
+  mov [rbp-48], rdi
+.loc 1 789 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset hash_bytes
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.hash_long:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+entry_path:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdi
+.loc 1 793 73
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 12
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset cache_dir
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strlen
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strlen
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  add r10, r11
+  mov r11, 2
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 794 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.1
+  push r10
+  sub rsp, 8
+  mov r10, offset cache_dir
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset sprintf
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 795 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.entry_path
+.L.return.entry_path:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl cache_key
+cache_key:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 224
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-208], rdx
+  mov [rbp-216], rsi
+  mov [rbp-224], rdi
+.loc 1 801 52
+  movabs r10, 7809847782465536322
+  lea r11, [rbp-200]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  movabs r10, 7113472399480571277
+  lea r11, [rbp-200]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 803 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-200]
+  push r10
+  sub rsp, 8
+  mov r10, offset cache_version
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset cache_version
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strlen
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset hash_bytes
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 806 17
+.loc 1 807 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.2
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-184]
+  push r10
+  sub rsp, 8
+  mov r10, offset stat
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.cache_key.1
+.loc 1 808 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-200]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-184]
+  add r10, 48
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hash_long
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 809 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-200]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-184]
+  add r10, 88
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hash_long
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 810 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-200]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-184]
+  add r10, 88
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hash_long
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.cache_key.1:
+.loc 1 815 3
+  mov r10, offset include_pch
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.cache_key.3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset include_pch
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-184]
+  push r10
+  sub rsp, 8
+  mov r10, offset stat
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.cache_key.3
+  mov r10, 1
+  jmp .L.end.cache_key.3
+.L.false.cache_key.3:
+  mov r10, 0
+.L.end.cache_key.3:
+  cmp r10, 0
+  je .L.end.cache_key.2
+.loc 1 816 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-200]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-184]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hash_long
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 817 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-200]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-184]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hash_long
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 818 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-200]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-184]
+  add r10, 48
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hash_long
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 819 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-200]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-184]
+  add r10, 88
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hash_long
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 820 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-200]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-184]
+  add r10, 88
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hash_long
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.cache_key.2:
+.loc 1 823 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-200]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-216]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-208]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hash_bytes
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 825 3
+.L.begin.cache_key.4:
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.cache_key.4
+.loc 1 826 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-200]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset hash_long
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 827 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-200]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  add r10, 16
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset hash_long
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 828 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-200]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 28
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset hash_long
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 829 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-200]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_column
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset hash_long
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 830 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-200]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 24
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset hash_long
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 831 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-200]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 24
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset hash_bytes
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.cache_key.4:
+.loc 1 825 31
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-224]
+  mov [r11], r10
+  jmp .L.begin.cache_key.4
+.L.break.cache_key.4:
+.loc 1 834 39
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 12
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 40
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 835 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.3
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-200]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-200]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset sprintf
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 836 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.cache_key
+.L.return.cache_key:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+update_stats:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 176
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-144], rcx
+  mov [rbp-152], rdx
+  mov [rbp-160], rsi
+  mov [rbp-168], rdi
+.loc 1 842 3
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-144]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r11, [rbp-152]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 844 61
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.4
+  push r10
+  sub rsp, 8
+  mov r10, offset entry_path
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  mov r11, 64
+  mov r11d, r11d
+  or r10d, r11d
+  push r10
+  sub rsp, 8
+  mov r10, 420
+  push r10
+  sub rsp, 8
+  mov r10, offset open
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-132]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 845 3
+  lea r10, [rbp-132]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.update_stats.1
+.loc 1 846 5
+  jmp .L.return.update_stats
+.L.end.update_stats.1:
+.loc 1 847 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-132]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset flock
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 849 20
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 1
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 2
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 3
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 5
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 6
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 7
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 9
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 10
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 11
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 12
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 13
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 14
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 15
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 17
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 18
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 19
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 20
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 21
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 22
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 23
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 25
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 26
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 27
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 28
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 29
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 30
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 31
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 33
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 34
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 35
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 36
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 37
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 38
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 39
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 41
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 42
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 43
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 44
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 45
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 46
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 47
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 48
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 49
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 50
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 51
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 52
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 53
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 54
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 55
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 56
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 57
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 58
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 59
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 60
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 61
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 62
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 63
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.loc 1 850 3
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-132]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-128]
+  push r10
+  sub rsp, 8
+  movabs r10, 64
+  mov r11, 1
+  movsx r11, r11d
+  sub r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset pread
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.update_stats.2
+.loc 1 851 5
+.loc 1 852 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  push r10
+  sub rsp, 8
+  mov r10, 10
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset strtol
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-152]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 853 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  push r10
+  sub rsp, 8
+  mov r10, 10
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset strtol
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-144]
+  mov r11, [r11]
+  mov [r11], r10
+.L.end.update_stats.2:
+.loc 1 856 3
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  cmp r10, 0
+  jne .L.true.update_stats.4
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  cmp r10, 0
+  jne .L.true.update_stats.4
+  mov r10, 0
+  jmp .L.end.update_stats.4
+.L.true.update_stats.4:
+  mov r10, 1
+.L.end.update_stats.4:
+  cmp r10, 0
+  je .L.end.update_stats.3
+.loc 1 857 5
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov [r11], r10
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-168]
+  mov r11, [r11]
+  add r10, r11
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 858 5
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-160]
+  mov r11, [r11]
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 859 56
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.5
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset sprintf
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 860 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-132]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-128]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset pwrite
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 861 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-132]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset ftruncate
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.update_stats.3:
+.loc 1 863 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-132]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset close
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.update_stats:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl cache_lookup
+cache_lookup:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 256
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-248], rdi
+.loc 1 869 20
+.loc 1 870 31
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-248]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset entry_path
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-224]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 871 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset cache_dir
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 493
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset mkdir
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 873 32
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset open
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-212]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 874 3
+  lea r10, [rbp-212]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.cache_lookup.1
+.loc 1 875 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-240]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-232]
+  push r10
+  sub rsp, 8
+  mov r10, offset update_stats
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 876 5
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.cache_lookup
+.L.end.cache_lookup.1:
+.loc 1 879 17
+.loc 1 880 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-212]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-208]
+  push r10
+  sub rsp, 8
+  mov r10, offset fstat
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 881 37
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-208]
+  add r10, 48
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset malloc
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 882 15
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 883 3
+.L.begin.cache_lookup.2:
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-208]
+  add r11, 48
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.break.cache_lookup.2
+.loc 1 884 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-212]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov r12, 1
+  movsx r12, r12d
+  imul r11, r12
+  add r10, r11
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-208]
+  add r10, 48
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  sub r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset read
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 885 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r11, 0
+  movsx r11, r11d
+  cmp r10, r11
+  setle al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.cache_lookup.3
+.loc 1 886 7
+  jmp .L.break.cache_lookup.2
+.L.end.cache_lookup.3:
+.loc 1 887 5
+  lea r10, [rbp-56]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+.L.continue.cache_lookup.2:
+  jmp .L.begin.cache_lookup.2
+.L.break.cache_lookup.2:
+.loc 1 889 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-212]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset close
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 891 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-208]
+  add r11, 48
+  mov r11, [r11]
+  cmp r10, r11
+  setne al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.cache_lookup.4
+.loc 1 892 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset free
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 893 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-240]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-232]
+  push r10
+  sub rsp, 8
+  mov r10, offset update_stats
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 894 5
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.cache_lookup
+.L.end.cache_lookup.4:
+.loc 1 897 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.6
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset emitf
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 898 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset free
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 901 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset utime
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 902 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-240]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-232]
+  push r10
+  sub rsp, 8
+  mov r10, offset update_stats
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 903 3
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.cache_lookup
+.L.return.cache_lookup:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+read_entries:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 256
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-248], rdi
+.loc 1 908 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-248]
+  mov r11, [r11]
+  mov [r11], r10d
+.loc 1 909 32
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset cache_dir
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset opendir
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-240]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 910 3
+  lea r10, [rbp-240]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.read_entries.1
+.loc 1 911 5
+  mov r10, 0
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.read_entries
+.L.end.read_entries.1:
+.loc 1 913 15
+  mov r10, 64
+  mov r10d, r10d
+  lea r11, [rbp-228]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 914 54
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  movabs r10, 24
+  lea r11, [rbp-228]
+  mov r11d, dword ptr [r11]
+  movsx r11, r11d
+  imul r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset malloc
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-224]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 916 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-240]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset readdir
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-216]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.read_entries.2:
+  lea r10, [rbp-216]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.read_entries.2
+.loc 1 917 5
+  lea r10, [rbp-216]
+  mov r10, [r10]
+  add r10, 19
+  lea r11, [rbp-208]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 918 31
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-208]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strlen
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-196]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 919 5
+  lea r10, [rbp-196]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 3
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.read_entries.4
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-208]
+  mov r10, [r10]
+  lea r11, [rbp-196]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  sub r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.7
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  jne .L.true.read_entries.4
+  mov r10, 0
+  jmp .L.end.read_entries.4
+.L.true.read_entries.4:
+  mov r10, 1
+.L.end.read_entries.4:
+  cmp r10, 0
+  je .L.end.read_entries.3
+.loc 1 920 7
+  jmp .L.continue.read_entries.2
+.L.end.read_entries.3:
+.loc 1 922 19
+.loc 1 923 34
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-208]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset entry_path
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 924 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-192]
+  push r10
+  sub rsp, 8
+  mov r10, offset stat
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.read_entries.5
+.loc 1 925 7
+  jmp .L.continue.read_entries.2
+.L.end.read_entries.5:
+.loc 1 927 5
+  lea r10, [rbp-248]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-228]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.read_entries.6
+.loc 1 928 7
+  lea r10, [rbp-228]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  imul r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+.loc 1 929 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  movabs r10, 24
+  lea r11, [rbp-228]
+  mov r11d, dword ptr [r11]
+  movsx r11, r11d
+  imul r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset realloc
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-224]
+  mov [r11], r10
+.L.end.read_entries.6:
+.loc 1 931 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-224]
+  mov r11, [r11]
+  lea r12, [rbp-248]
+  mov r12, [r12]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 24
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  add r11, 0
+  mov [r11], r10
+.loc 1 932 5
+  lea r10, [rbp-192]
+  add r10, 48
+  mov r10, [r10]
+  lea r11, [rbp-224]
+  mov r11, [r11]
+  lea r12, [rbp-248]
+  mov r12, [r12]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 24
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  add r11, 8
+  mov [r11], r10
+.loc 1 933 5
+  lea r10, [rbp-192]
+  add r10, 72
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-224]
+  mov r11, [r11]
+  lea r12, [rbp-248]
+  mov r12, [r12]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 24
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  add r11, 16
+  mov [r11], r10
+.loc 1 934 5
+  lea r10, [rbp-248]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-248]
+  mov r11, [r11]
+  mov [r11], r10d
+.L.continue.read_entries.2:
+.loc 1 916 46
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-240]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset readdir
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-216]
+  mov [r11], r10
+  jmp .L.begin.read_entries.2
+.L.break.read_entries.2:
+.loc 1 937 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-240]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset closedir
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 938 3
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.read_entries
+.L.return.read_entries:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+evict:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 160
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 944 10
+.loc 1 945 40
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-156]
+  push r10
+  sub rsp, 8
+  mov r10, offset read_entries
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-152]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 947 17
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-144]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 948 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-132]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.evict.1:
+  lea r10, [rbp-132]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-156]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.evict.1
+.loc 1 949 5
+  lea r10, [rbp-144]
+  lea r11, [rbp-120]
+  mov [r11], r10
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-152]
+  mov r11, [r11]
+  lea r12, [rbp-132]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 24
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  add r11, 8
+  mov r11, [r11]
+  add r10, r11
+  lea r11, [rbp-120]
+  mov r11, [r11]
+  mov [r11], r10
+.L.continue.evict.1:
+.loc 1 948 28
+  lea r10, [rbp-132]
+  lea r11, [rbp-128]
+  mov [r11], r10
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.evict.1
+.L.break.evict.1:
+.loc 1 950 3
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  mov r11, offset cache_max_size
+  mov r11, [r11]
+  cmp r10, r11
+  setle al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.evict.2
+.loc 1 951 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset free
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 952 5
+  jmp .L.return.evict
+.L.end.evict.2:
+.loc 1 957 3
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-108]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.evict.3:
+  lea r10, [rbp-108]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-156]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.evict.3
+.loc 1 958 5
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  lea r11, [rbp-108]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 24
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-96]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov al, [r10+0]
+  mov [r11+0], al
+  mov al, [r10+1]
+  mov [r11+1], al
+  mov al, [r10+2]
+  mov [r11+2], al
+  mov al, [r10+3]
+  mov [r11+3], al
+  mov al, [r10+4]
+  mov [r11+4], al
+  mov al, [r10+5]
+  mov [r11+5], al
+  mov al, [r10+6]
+  mov [r11+6], al
+  mov al, [r10+7]
+  mov [r11+7], al
+  mov al, [r10+8]
+  mov [r11+8], al
+  mov al, [r10+9]
+  mov [r11+9], al
+  mov al, [r10+10]
+  mov [r11+10], al
+  mov al, [r10+11]
+  mov [r11+11], al
+  mov al, [r10+12]
+  mov [r11+12], al
+  mov al, [r10+13]
+  mov [r11+13], al
+  mov al, [r10+14]
+  mov [r11+14], al
+  mov al, [r10+15]
+  mov [r11+15], al
+  mov al, [r10+16]
+  mov [r11+16], al
+  mov al, [r10+17]
+  mov [r11+17], al
+  mov al, [r10+18]
+  mov [r11+18], al
+  mov al, [r10+19]
+  mov [r11+19], al
+  mov al, [r10+20]
+  mov [r11+20], al
+  mov al, [r10+21]
+  mov [r11+21], al
+  mov al, [r10+22]
+  mov [r11+22], al
+  mov al, [r10+23]
+  mov [r11+23], al
+.loc 1 959 14
+  lea r10, [rbp-108]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-68]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 960 5
+.L.begin.evict.4:
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-68]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.evict.5
+  lea r10, [rbp-96]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-152]
+  mov r11, [r11]
+  lea r12, [rbp-68]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  sub r12d, r13d
+  mov r12d, r12d
+  mov r13, 24
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  add r11, 16
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.evict.5
+  mov r10, 1
+  jmp .L.end.evict.5
+.L.false.evict.5:
+  mov r10, 0
+.L.end.evict.5:
+  cmp r10, 0
+  je .L.break.evict.4
+.loc 1 961 7
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  lea r11, [rbp-68]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  sub r11d, r12d
+  mov r11d, r11d
+  mov r12, 24
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-152]
+  mov r11, [r11]
+  lea r12, [rbp-68]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 24
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov al, [r10+0]
+  mov [r11+0], al
+  mov al, [r10+1]
+  mov [r11+1], al
+  mov al, [r10+2]
+  mov [r11+2], al
+  mov al, [r10+3]
+  mov [r11+3], al
+  mov al, [r10+4]
+  mov [r11+4], al
+  mov al, [r10+5]
+  mov [r11+5], al
+  mov al, [r10+6]
+  mov [r11+6], al
+  mov al, [r10+7]
+  mov [r11+7], al
+  mov al, [r10+8]
+  mov [r11+8], al
+  mov al, [r10+9]
+  mov [r11+9], al
+  mov al, [r10+10]
+  mov [r11+10], al
+  mov al, [r10+11]
+  mov [r11+11], al
+  mov al, [r10+12]
+  mov [r11+12], al
+  mov al, [r10+13]
+  mov [r11+13], al
+  mov al, [r10+14]
+  mov [r11+14], al
+  mov al, [r10+15]
+  mov [r11+15], al
+  mov al, [r10+16]
+  mov [r11+16], al
+  mov al, [r10+17]
+  mov [r11+17], al
+  mov al, [r10+18]
+  mov [r11+18], al
+  mov al, [r10+19]
+  mov [r11+19], al
+  mov al, [r10+20]
+  mov [r11+20], al
+  mov al, [r10+21]
+  mov [r11+21], al
+  mov al, [r10+22]
+  mov [r11+22], al
+  mov al, [r10+23]
+  mov [r11+23], al
+.L.continue.evict.4:
+.loc 1 960 50
+  lea r10, [rbp-68]
+  lea r11, [rbp-64]
+  mov [r11], r10
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.evict.4
+.L.break.evict.4:
+.loc 1 962 5
+  lea r10, [rbp-96]
+  lea r11, [rbp-152]
+  mov r11, [r11]
+  lea r12, [rbp-68]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 24
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov al, [r10+0]
+  mov [r11+0], al
+  mov al, [r10+1]
+  mov [r11+1], al
+  mov al, [r10+2]
+  mov [r11+2], al
+  mov al, [r10+3]
+  mov [r11+3], al
+  mov al, [r10+4]
+  mov [r11+4], al
+  mov al, [r10+5]
+  mov [r11+5], al
+  mov al, [r10+6]
+  mov [r11+6], al
+  mov al, [r10+7]
+  mov [r11+7], al
+  mov al, [r10+8]
+  mov [r11+8], al
+  mov al, [r10+9]
+  mov [r11+9], al
+  mov al, [r10+10]
+  mov [r11+10], al
+  mov al, [r10+11]
+  mov [r11+11], al
+  mov al, [r10+12]
+  mov [r11+12], al
+  mov al, [r10+13]
+  mov [r11+13], al
+  mov al, [r10+14]
+  mov [r11+14], al
+  mov al, [r10+15]
+  mov [r11+15], al
+  mov al, [r10+16]
+  mov [r11+16], al
+  mov al, [r10+17]
+  mov [r11+17], al
+  mov al, [r10+18]
+  mov [r11+18], al
+  mov al, [r10+19]
+  mov [r11+19], al
+  mov al, [r10+20]
+  mov [r11+20], al
+  mov al, [r10+21]
+  mov [r11+21], al
+  mov al, [r10+22]
+  mov [r11+22], al
+  mov al, [r10+23]
+  mov [r11+23], al
+.L.continue.evict.3:
+.loc 1 957 28
+  lea r10, [rbp-108]
+  lea r11, [rbp-104]
+  mov [r11], r10
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.evict.3
+.L.break.evict.3:
+.loc 1 965 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.evict.6:
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-156]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.evict.7
+  mov r10, offset cache_max_size
+  mov r10, [r10]
+  mov r11, 10
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  mov r11, 9
+  movsx r11, r11d
+  imul r10, r11
+  lea r11, [rbp-144]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.evict.7
+  mov r10, 1
+  jmp .L.end.evict.7
+.L.false.evict.7:
+  mov r10, 0
+.L.end.evict.7:
+  cmp r10, 0
+  je .L.break.evict.6
+.loc 1 966 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 24
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset unlink
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.evict.8
+.loc 1 967 7
+  lea r10, [rbp-144]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-152]
+  mov r11, [r11]
+  lea r12, [rbp-52]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 24
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  add r11, 8
+  mov r11, [r11]
+  sub r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+.L.end.evict.8:
+.L.continue.evict.6:
+.loc 1 965 63
+  lea r10, [rbp-52]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.evict.6
+.L.break.evict.6:
+.loc 1 968 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset free
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.evict:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl cache_store
+cache_store:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 112
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-88], rdx
+  mov [rbp-96], rsi
+  mov [rbp-104], rdi
+.loc 1 975 31
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset entry_path
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 976 54
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 12
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strlen
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r11, 32
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 977 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.8
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset getpid
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset sprintf
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 979 57
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  mov r11, 64
+  mov r11d, r11d
+  or r10d, r11d
+  mov r10d, r10d
+  mov r11, 512
+  mov r11d, r11d
+  or r10d, r11d
+  push r10
+  sub rsp, 8
+  mov r10, 420
+  push r10
+  sub rsp, 8
+  mov r10, offset open
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-60]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 980 3
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.cache_store.1
+.loc 1 981 5
+  jmp .L.return.cache_store
+.L.end.cache_store.1:
+.loc 1 983 3
+.L.begin.cache_store.2:
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.break.cache_store.2
+.loc 1 984 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset write
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 985 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  movsx r11, r11d
+  cmp r10, r11
+  setle al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.cache_store.3
+.loc 1 986 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset close
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 987 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset unlink
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 988 7
+  jmp .L.return.cache_store
+.L.end.cache_store.3:
+.loc 1 990 5
+  lea r10, [rbp-96]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov r12, 1
+  movsx r12, r12d
+  imul r11, r12
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 991 5
+  lea r10, [rbp-88]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  sub r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+.L.continue.cache_store.2:
+  jmp .L.begin.cache_store.2
+.L.break.cache_store.2:
+.loc 1 993 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset close
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 995 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset rename
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.cache_store.4
+.loc 1 996 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset unlink
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 997 5
+  jmp .L.return.cache_store
+.L.end.cache_store.4:
+.loc 1 999 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset evict
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.cache_store:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl print_cache_stats
+print_cache_stats:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 112
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 1004 20
+.loc 1 1005 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-112]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-104]
+  push r10
+  sub rsp, 8
+  mov r10, offset update_stats
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1007 10
+.loc 1 1008 40
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-92]
+  push r10
+  sub rsp, 8
+  mov r10, offset read_entries
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-88]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1009 17
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1010 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-68]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.print_cache_stats.1:
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-92]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.print_cache_stats.1
+.loc 1 1011 5
+  lea r10, [rbp-80]
+  lea r11, [rbp-56]
+  mov [r11], r10
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  lea r12, [rbp-68]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 24
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  add r11, 8
+  mov r11, [r11]
+  add r10, r11
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10
+.L.continue.print_cache_stats.1:
+.loc 1 1010 28
+  lea r10, [rbp-68]
+  lea r11, [rbp-64]
+  mov [r11], r10
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.print_cache_stats.1
+.L.break.print_cache_stats.1:
+.loc 1 1012 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset free
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1014 31
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1015 49
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  cmp r10, 0
+  je  .L.else.print_cache_stats.2
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  mov r11, 1000
+  movsx r11, r11d
+  imul r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  jmp .L.end.print_cache_stats.2
+.L.else.print_cache_stats.2:
+  mov r10, 0
+  movsx r10, r10d
+.L.end.print_cache_stats.2:
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1016 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.9
+  push r10
+  sub rsp, 8
+  mov r10, offset cache_dir
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1017 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.10
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, 10
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, 10
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rdx
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1018 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.11
+  push r10
+  sub rsp, 8
+.loc 1 1019 11
+  mov r10, offset cache_dir
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-92]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset cache_max_size
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+.loc 1 1018 3
+  mov r10, offset fprintf
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.print_cache_stats:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
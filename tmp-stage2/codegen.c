@@ -0,0 +1,1545 @@
+typedef struct FILE FILE;
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+typedef struct {
+  int gp_offset;
+  int fp_offset;
+  void *overflow_arg_area;
+  void *reg_save_area;
+} va_list[1];
+
+struct timespec {
+  long tv_sec;
+  long tv_nsec;
+};
+
+struct rusage {
+  long ru_utime[2];
+  long ru_stime[2];
+  long ru_maxrss;
+  long ru_reserved[13];
+};
+
+struct stat {
+  unsigned long st_dev;
+  unsigned long st_ino;
+  unsigned long st_nlink;
+  unsigned int st_mode;
+  unsigned int st_uid;
+  unsigned int st_gid;
+  int __pad0;
+  unsigned long st_rdev;
+  long st_size;
+  long st_blksize;
+  long st_blocks;
+  struct timespec st_atim;
+  struct timespec st_mtim;
+  struct timespec st_ctim;
+  long __reserved[3];
+};
+
+struct sockaddr_un {
+  unsigned short sun_family;
+  char sun_path[108];
+};
+
+struct iovec {
+  void *iov_base;
+  long iov_len;
+};
+
+struct msghdr {
+  void *msg_name;
+  int msg_namelen;
+  struct iovec *msg_iov;
+  long msg_iovlen;
+  void *msg_control;
+  long msg_controllen;
+  int msg_flags;
+};
+
+struct pollfd {
+  int fd;
+  short events;
+  short revents;
+};
+
+typedef struct DIR DIR;
+
+struct dirent {
+  unsigned long d_ino;
+  long d_off;
+  unsigned short d_reclen;
+  unsigned char d_type;
+  char d_name[256];
+};
+
+enum { EINTR = 4 };
+enum { O_RDONLY = 0, O_WRONLY = 1, O_RDWR = 2, O_CREAT = 64, O_TRUNC = 512 };
+enum { LOCK_EX = 2 };
+enum { S_IFMT = 61440, S_IFREG = 32768 };
+enum { PROT_READ = 1, PROT_WRITE = 2 };
+enum { MAP_PRIVATE = 2, MAP_FIXED = 16, MAP_ANONYMOUS = 32, MAP_POPULATE = 32768 };
+enum { _SC_PAGESIZE = 30 };
+enum { AF_UNIX = 1, SOCK_STREAM = 1, SOL_SOCKET = 1, SCM_RIGHTS = 1 };
+enum { MSG_CTRUNC = 8, MSG_NOSIGNAL = 16384 };
+enum { POLLIN = 1 };
+enum { RUSAGE_SELF = 0 };
+enum { CLOCK_MONOTONIC = 1, CLOCK_PROCESS_CPUTIME_ID = 2 };
+
+void *malloc(long size);
+void *calloc(long nmemb, long size);
+void *realloc(void *buf, long size);
+int *__errno_location();
+char *strerror(int errnum);
+FILE *fopen(char *pathname, char *mode);
+long fread(void *ptr, long size, long nmemb, FILE *stream);
+int fclose(FILE *fp);
+int feof(FILE *stream);
+static void assert() {}
+int strcmp(char *s1, char *s2);
+int strncasecmp(char *s1, char *s2);
+int printf(char *fmt, ...);
+int sprintf(char *buf, char *fmt, ...);
+int fprintf(FILE *fp, char *fmt, ...);
+int vfprintf(FILE *fp, char *fmt, va_list ap);
+long strlen(char *p);
+int strncmp(char *p, char *q);
+void *memvpy(char *dst, char *src, long n);
+char *strndup(char *p, long n);
+int isspace(int c);
+int ispunct(int c);
+int isdigit(int c);
+char *strstr(char *haystack, char *needle);
+static void va_end(va_list ap) {}
+long strtoul(char *nptr, char **endptr, int base);
+char *strncpy(char *dest, char *src, long n);
+void exit(int code);
+int atoi(char *nptr);
+char *strrchr(char *s, int c);
+int fflush(FILE *stream);
+int fork(void);
+int waitpid(int pid, int *status, int options);
+int unlink(char *pathname);
+int creat(char *pathname, int mode);
+void *memset(void *s, int c, long n);
+int memcmp(void *s1, void *s2, long n);
+char *strchr(char *s, int c);
+long strtol(char *nptr, char **endptr, int base);
+long write(int fd, void *buf, long count);
+void *memcpy(void *dst, void *src, long n);
+int clock_gettime(int clockid, struct timespec *tp);
+int getrusage(int who, struct rusage *usage);
+void free(void *ptr);
+char *strcpy(char *dest, char *src);
+long read(int fd, void *buf, long count);
+int close(int fd);
+int dup2(int oldfd, int newfd);
+int pipe(int *pipefd);
+int chdir(char *path);
+char *getcwd(char *buf, long size);
+char *realpath(char *path, char *resolved_path);
+int stat(char *path, struct stat *buf);
+int socket(int domain, int type, int protocol);
+int bind(int fd, struct sockaddr *addr, int len);
+int listen(int fd, int backlog);
+int accept(int fd, struct sockaddr *addr, int *len);
+int connect(int fd, struct sockaddr *addr, int len);
+long send(int fd, void *buf, long len, int flags);
+long sendmsg(int fd, struct msghdr *msg, int flags);
+long recvmsg(int fd, struct msghdr *msg, int flags);
+int poll(struct pollfd *fds, long nfds, int timeout);
+int open(char *path, int flags, ...);
+int fstat(int fd, struct stat *buf);
+int flock(int fd, int op);
+void *mmap(void *addr, long len, int prot, int flags, int fd, long off);
+int munmap(void *addr, long len);
+long sysconf(int name);
+long pread(int fd, void *buf, long count, long offset);
+long pwrite(int fd, void *buf, long count, long offset);
+int ftruncate(int fd, long length);
+int getpid(void);
+int rename(char *oldpath, char *newpath);
+int mkdir(char *path, int mode);
+int utime(char *path, void *times);
+DIR *opendir(char *name);
+struct dirent *readdir(DIR *dirp);
+int closedir(DIR *dirp);
+
+typedef struct Type Type;
+typedef struct Member Member;
+typedef struct GvarInitializer GvarInitializer;
+
+//
+// tokenize.c
+//
+
+// Token
+typedef enum {
+  TK_RESERVED, // Keyworeds or punctuators
+  TK_IDENT,    // Identifiers
+  TK_STR,      // String literals
+  TK_NUM,      // Integer literals
+  TK_EOF,      // End-of-file markers
+} TokenKind;
+
+// Keywords, preprocessor directive names and punctuators are given
+// an ID by the tokenizer, so that they can be compared as integers.
+// The order must match `token_names` in tokenize.c.
+typedef enum {
+  ID_NONE,
+
+  // Keywords
+  KW_RETURN, KW_IF, KW_ELSE, KW_FOR, KW_WHILE, KW_INT, KW_SIZEOF,
+  KW_CHAR, KW_STRUCT, KW_UNION, KW_SHORT, KW_LONG, KW_VOID,
+  KW_TYPEDEF, KW_BOOL, KW_ENUM, KW_STATIC, KW_BREAK, KW_CONTINUE,
+  KW_GOTO, KW_SWITCH, KW_CASE, KW_DEFAULT, KW_EXTERN, KW_ALIGNOF,
+  KW_ALIGNAS, KW_DO, KW_SIGNED, KW_UNSIGNED, KW_CONST, KW_VOLATILE,
+
+  // Preprocessor directive names other than keywords
+  PP_INCLUDE, PP_DEFINE, PP_UNDEF, PP_IFDEF, PP_IFNDEF, PP_ELIF,
+  PP_ENDIF, PP_PRAGMA, PP_DEFINED, PP_ONCE,
+
+  // Punctuators, longest first
+  P_ELLIPSIS, P_SHL_ASSIGN, P_SHR_ASSIGN,
+  P_EQ, P_NE, P_LE, P_GE, P_ARROW, P_ADD_ASSIGN, P_SUB_ASSIGN,
+  P_MUL_ASSIGN, P_DIV_ASSIGN, P_INC, P_DEC, P_MOD_ASSIGN,
+  P_AND_ASSIGN, P_OR_ASSIGN, P_XOR_ASSIGN, P_LOGAND, P_LOGOR, P_SHL,
+  P_SHR, P_HASHHASH,
+  P_LPAREN, P_RPAREN, P_LBRACE, P_RBRACE, P_LBRACKET, P_RBRACKET,
+  P_SEMICOLON, P_COMMA, P_DOT, P_ASSIGN, P_LT, P_GT, P_PLUS, P_MINUS,
+  P_STAR, P_SLASH, P_PERCENT, P_AMP, P_PIPE, P_CARET, P_TILDE, P_NOT,
+  P_QUESTION, P_COLON, P_HASH,
+
+  NR_TOKEN_IDS,
+} TokenId;
+
+// Set of macro names, represented as a Patricia tree keyed by
+// name_id(). There is only one Hideset object for each set, so equal
+// sets are the same pointer. A Hideset must not be modified.
+typedef struct Hideset Hideset;
+struct Hideset {
+  Hideset *left;       // 0 if leaf
+  Hideset *right;
+  long prefix;         // Bits below `bit` shared by all names, or leaf's ID
+  long bit;            // The bit that tells which child has a name
+  char *name;          // If leaf, the name
+  unsigned long bloom; // One bit for each name, for quick rejection
+};
+
+// Source file of tokens. Tokens read from the same input share one.
+typedef struct {
+  char *name;     // Input filename
+  char *contents; // Entire input string
+  int file_no;    // File number for .loc directive
+
+  // Offsets of the beginnings of lines, recorded as the file is
+  // tokenized
+  int *lines;
+  int nr_lines;
+  int lines_cap;
+} File;
+
+// Payload of a literal token
+typedef struct {
+  long val;       // If TK_NUM, its value
+  Type *ty;       // If TK_NUM, its type
+  char *contents; // If TK_STR, its contents, not null-terminated
+  int cont_len;   // If TK_STR, its length excluding terminating '\0'
+} Literal;
+
+// Token type
+//
+// Fields the preprocessor and the parser look at for every token
+// come first. Those used only for some tokens or only for error
+// messages and debug info are kept out of line.
+typedef struct Token Token;
+struct Token {
+  TokenKind kind;   // Token kind
+  TokenId id;       // Keyword or punctuator ID, or ID_NONE
+  Token *next;      // Next token
+  char *loc;        // Token location
+  int len;          // Token length
+  int lineno;       // Line number
+  char *name;       // If identifier or keyword, its interned spelling
+  Hideset *hideset; // For macro expension
+  _Bool at_bol;      // True if this token is at beginning of line
+  _Bool has_space;   // True if this token follows a space character
+  _Bool is_raw;      // True if this token is read from a file
+  _Bool is_shared;   // True if this token is in a file's cached tokens
+
+  File *file;       // Source file
+  Literal *lit;     // If TK_NUM or TK_STR, its value
+};
+
+extern _Bool fast_lexer;
+
+void error(char *fmt, ...);
+void error_tok(Token *tok, char *fmt, ...);
+void warn_tok(Token *tok, char *fmt, ...);
+Token *skip(Token *tok, TokenId id);
+_Bool consume(Token **rest, Token *tok, TokenId id);
+char *intern(char *s, int len);
+long name_id(char *name);
+File *new_file(char *name, int file_no, char *contents);
+int get_column(Token *tok);
+void convert_keywords(Token *tok);
+Token *next_token(Token *tok);
+void free_token(Token *tok);
+Token *tokenize_lazy(char *filename, int file_no, char *p, Token *cont);
+Token *tokenize_cached(Token *src, char *filename, int file_no,
+                       Token *cont);
+Token *tokenize(char *filename, int file_no, char *p);
+
+//
+// preprocess.c
+//
+
+extern _Bool pp_report;
+
+// Identifies a file and its version.
+typedef struct {
+  unsigned long dev;
+  unsigned long ino;
+  long size;
+  long mtime_sec;
+  long mtime_nsec;
+} FileId;
+
+_Bool get_file_id(char *path, FileId *id);
+char *read_file_string(char *path, long *mapping);
+void free_file_string(char *buf, long mapping);
+int add_file(char *path);
+void save_file_ids(void);
+char *load_file_ids(void);
+void save_macros(void);
+void load_macros(void);
+Token *read_file(char *path);
+void print_pp_report(char *input);
+
+//
+// parse.c
+//
+
+// Variable
+typedef struct Var Var;
+struct Var {
+  Var *next;
+  char *name;    // Variable name
+  Type *ty;      // Type
+  Token *tok;    // representative token
+  _Bool is_local; // local or global
+  int align;     // alignment
+
+  _Bool is_static;
+  GvarInitializer *initializer;
+
+  // Local variable
+  int offset;
+
+  // Gloval variable
+  char *contents;
+  int cont_len;
+};
+
+// AST node
+typedef enum {
+  ND_ADD,       // +
+  ND_SUB,       // -
+  ND_MUL,       // *
+  ND_DIV,       // /
+  ND_MOD,       // %
+  ND_BITAND,    // &
+  ND_BITOR,     // |
+  ND_BITXOR,    // ^
+  ND_SHL,       // <<
+  ND_SHR,       // >>
+  ND_EQ,        // ==
+  ND_NE,        // !=
+  ND_LT,        // <
+  ND_LE,        // <=
+  ND_ASSIGN,    // =
+  ND_COND,      // ?:
+  ND_COMMA,     // ,
+  ND_MEMBER,    // . (struct member access)
+  ND_ADDR,      // unary &
+  ND_DEREF,     // unary *
+  ND_NOT,       // !
+  ND_BITNOT,    // ~
+  ND_LOGAND,    // &&
+  ND_LOGOR,     // ||
+  ND_RETURN,    // "return"
+  ND_IF,        // "if"
+  ND_FOR,       // "for" or "while"
+  ND_DO,        // "do"
+  ND_SWITCH,    // "switch"
+  ND_CASE,      // "case"
+  ND_BLOCK,     // { ... }
+  ND_BREAK,     // "break"
+  ND_CONTINUE,  // "continue"
+  ND_GOTO,      // "goto"
+  ND_LABEL,     // Labeled statement
+  ND_FUNCALL,   // Function call
+  ND_EXPR_STMT, // Expression statement
+  ND_STMT_EXPR, // Statement expression
+  ND_VAR,       // Variable
+  ND_NUM,       // Integer
+  ND_CAST,      // Type cast
+} NodeKind;
+
+// AST node type
+typedef struct Node Node;
+struct Node {
+  NodeKind kind; // Node kind
+  Node *next;    // Next node
+  Type *ty;      // Type, e.g. int or pointer to tin
+  Token *tok;    // Representative token
+
+  Node *lhs;     // Left-hand side
+  Node *rhs;     // Right-hand side
+
+  // "if" or "for" statement
+  Node *cond;
+  Node *then;
+  Node *els;
+  Node *init;
+  Node *inc;
+
+  // Assignment
+  _Bool is_init;
+
+  // Blcok or statement expression
+  Node *body;
+
+  // Struct member access
+  Member *member;
+
+  // Function call
+  char *funcname;
+  Type *func_ty;
+  Node *args;
+
+  // Goto or labeled statement
+  char *label_name;
+
+  // Switch-cases
+  Node *case_next;
+  Node *default_case;
+  int case_label;
+  int case_end_label;
+
+  // Variable
+  Var *var;
+
+  // Integer literal
+  long val;
+};
+
+// Global variable initializer. Global variables can be initialized
+// either by a constatnt expression or a pointer to another global
+// bariable with an addend.
+struct GvarInitializer {
+  GvarInitializer *next;
+  int offset;
+
+  // Scalar value
+  int sz;
+  long val;
+
+  // Byte string of `sz` bytes
+  char *bytes;
+
+  // Reference to another global variable
+  char *label;
+  long addend;
+};
+
+typedef struct Function Function;
+struct Function {
+  Function *next;
+  char *name;
+  Var *params;
+  _Bool is_static;
+  _Bool is_varargs;
+
+  Node *node;
+  Var *locals;
+  int stack_size;
+  long nr_nodes; // The number of AST nodes, as an estimate of work
+};
+
+typedef struct {
+  Var *globals;
+  Function *fns;
+} Program;
+
+Node *new_cast(Node *expr, Type *ty);
+long const_expr(Token **rest, Token *tok);
+void save_scopes(void);
+void load_scopes(void);
+Program *parse(Token *tok);
+
+//
+// type.c
+//
+
+typedef enum {
+  TY_VOID,
+  TY_BOOL,
+  TY_CHAR,
+  TY_SHORT,
+  TY_INT,
+  TY_LONG,
+  TY_ENUM,
+  TY_PTR,
+  TY_FUNC,
+  TY_ARRAY,
+  TY_STRUCT,
+} TypeKind;
+
+struct Type {
+  TypeKind kind;
+  int size;           // sizeof() value
+  int align;          // alignment
+  _Bool is_unsigned;   // unsigned or signed
+  _Bool is_incomplete; // incomplete type
+  _Bool is_const;
+
+  // Pointer
+  Type *base;
+
+  // Declaration
+  Token *name;
+  Token *name_pos;
+
+  // Array
+  int array_len;
+
+  // Struct
+  Member *members;
+
+  // Function type
+  Type *return_ty;
+  Type *params;
+  _Bool is_varargs;
+  Type *next;
+};
+
+// Struct member
+struct Member {
+  Member *next;
+  Type *ty;
+  Token *tok; // for error message
+  Token *name;
+  int align;
+  int offset;
+};
+
+extern Type *ty_void;
+extern Type *ty_bool;
+
+extern Type *ty_char;
+extern Type *ty_short;
+extern Type *ty_int;
+extern Type *ty_long;
+
+extern Type *ty_uchar;
+extern Type *ty_ushort;
+extern Type *ty_uint;
+extern Type *ty_ulong;
+
+_Bool is_integer(Type *ty);
+Type *copy_type(Type *ty);
+Type *pointer_to(Type *base);
+int align_to(int n, int align);
+Type *func_type(Type *return_ty);
+Type *array_of(Type *base, int size);
+Type *enum_type(void);
+Type *struct_type(void);
+int size_of(Type *ty);
+Type *copy_type(Type *ty);
+void add_type(Node *node);
+
+//
+// codegen.c
+//
+
+extern int codegen_jobs;
+
+void codegen(Program *prog);
+
+//
+// emit.c
+//
+
+void open_output(char *path);
+void flush_output(void);
+void write_output(char *p, long len);
+void capture_output(void);
+char *take_output(void);
+void emitf(char *fmt, ...);
+void println(char *fmt, ...);
+long output_size(void);
+char *output_since(long pos);
+
+//
+// assemble.c
+//
+
+void assemble(char *input, char *path);
+
+//
+// timer.c
+//
+
+typedef enum {
+  PH_READ,       // read_file_string
+  PH_TOKENIZE,   // tokenize
+  PH_PREPROCESS, // preprocess
+  PH_KEYWORDS,   // convert_keywords
+  PH_PARSE,      // parse
+  PH_LAYOUT,     // stack offset assignment
+  PH_EMIT_DATA,  // emit_data
+  PH_EMIT_TEXT,  // emit_text
+  PH_ASSEMBLE,   // assemble
+  NR_PHASES,
+} Phase;
+
+extern _Bool time_report;
+extern _Bool time_report_json;
+
+void timer_start(Phase ph);
+void timer_stop(void);
+void timer_count(Phase ph, long n);
+void timer_count_lines(long n);
+void reset_timer(void);
+Phase current_phase(void);
+char *phase_name(Phase ph);
+void print_time_report(char *input);
+
+//
+// alloc.c
+//
+
+typedef enum {
+  AK_TOKEN,       // Token
+  AK_HIDESET,     // Hideset
+  AK_MACRO,       // Macro, MacroParam, MacroArg and CondIncl
+  AK_NODE,        // Node
+  AK_TYPE,        // Type
+  AK_MEMBER,      // Member
+  AK_VAR,         // Var
+  AK_VAR_SCOPE,   // VarScope
+  AK_TAG_SCOPE,   // TagScope
+  AK_FUNCTION,    // Function and Program
+  AK_INITIALIZER, // Initializer
+  AK_GVAR_INIT,   // GvarInitializer
+  AK_STRING,      // Names, labels and string literals
+  AK_FILE,        // Source file contents
+  NR_ALLOC_KINDS,
+} AllocKind;
+
+typedef struct Arena Arena;
+
+extern _Bool mem_report;
+
+void reset_alloc_stats(void);
+void count_alloc(AllocKind kind, long size);
+void *alloc_obj(AllocKind kind, long size);
+char *alloc_str(char *s, long len);
+void free_arena(void);
+Arena *enter_arena(void);
+void leave_arena(Arena *arena);
+void release_arena(Arena *arena);
+void print_mem_report(char *input);
+
+//
+// server.c
+//
+
+Token *find_cached_file(char *path);
+void note_input_file(char *path);
+char *read_all(int fd);
+void run_server(char *path, int *argc, char ***argv);
+int run_client(char *path, int argc, char **argv);
+
+//
+// pch.c
+//
+
+void pch_put_long(long val);
+void pch_put_str(char *s);
+void pch_put_token(Token *tok);
+void pch_put_tokens(Token *tok);
+void pch_put_type(Type *ty);
+void pch_put_var(Var *var);
+void write_pch(char *path);
+
+long pch_get_long(void);
+char *pch_get_str(void);
+char *pch_get_name(void);
+Token *pch_get_token(void);
+Token *pch_get_tokens(void);
+Type *pch_get_type(void);
+Var *pch_get_var(void);
+void read_pch(char *path);
+
+//
+// cache.c
+//
+
+extern char *cache_dir;
+extern long cache_max_size;
+extern _Bool cache_stats;
+
+char *cache_key(Token *tok, char *hdr, long hdr_len);
+_Bool cache_lookup(char *key);
+void cache_store(char *key, char *p, long len);
+void print_cache_stats(void);
+
+//
+// hashmap.c
+//
+
+typedef struct {
+  char *key;
+  int keylen;
+  void *val;
+} HashEntry;
+
+typedef struct {
+  HashEntry *buckets;
+  int capacity;
+  int used;
+
+  // Statistics
+  long lookups;
+  long probes;
+} HashMap;
+
+void *hashmap_get(HashMap *map, char *key);
+void *hashmap_get2(HashMap *map, char *key, int keylen);
+void hashmap_put(HashMap *map, char *key, void *val);
+void hashmap_put2(HashMap *map, char *key, int keylen, void *val);
+void hashmap_delete(HashMap *map, char *key);
+void hashmap_delete2(HashMap *map, char *key, int keylen);
+
+//
+// main.c
+//
+
+extern _Bool preprocess_only;
+extern _Bool output_object;
+extern char *include_pch;
+
+// The number of worker processes to generate functions with.
+int codegen_jobs = 1;
+
+static int top;
+
+// Labels are numbered from 1 in each function and qualified with
+// the function name, so that functions can be generated separately.
+static int labelseq = 1;
+static int brkseq;
+static int contseq;
+static char *argreg8[] = {"dil", "sil", "dl", "cl", "r8b", "r9b"};
+static char *argreg16[] = {"di", "si", "dx", "cx", "r8w", "r9b"};
+static char *argreg32[] = {"edi", "esi", "edx", "ecx", "r8d", "r9d"};
+static char *argreg64[] = {"rdi", "rsi", "rdx", "rcx", "r8", "r9"};
+static char *funcname;
+
+// The last source location emitted by a .loc directive.
+static int loc_file_no;
+static int loc_lineno;
+
+static char *reg(int idx) {
+  static char *r[] = {"r10", "r11", "r12", "r13", "r14", "r15"};
+  if (idx < 0 || sizeof(r) / sizeof(*r) <= idx)
+    error("registor out of range: %d", idx);
+  return r[idx];
+}
+
+static char *regx(Type *ty, int idx) {
+  if (ty->base || size_of(ty) == 8)
+    return reg(idx);
+
+  static char *r[] = {"r10d", "r11d", "r12d", "r13d", "r14d", "r15d"};
+  if (idx < 0 || sizeof(r) / sizeof(*r) <= idx)
+    error("ragesiter out of range: %d", idx);
+  return r[idx];
+}
+
+static void gen_expr(Node *node);
+static void gen_stmt(Node *node);
+
+// Emits a .loc directive unless the line is the same as the one we
+// emitted last. The column is that of the first token on the line.
+static void emit_loc(Token *tok) {
+  if (tok->file->file_no == loc_file_no && tok->lineno == loc_lineno)
+    return;
+  loc_file_no = tok->file->file_no;
+  loc_lineno = tok->lineno;
+  println(".loc %d %d %d", tok->file->file_no, tok->lineno, get_column(tok));
+}
+
+// Pushes the given node's address to the stack.
+static void gen_addr(Node *node) {
+  switch (node->kind) {
+    case ND_VAR:
+      if (node->var->is_local)
+        println("  lea %s, [rbp-%d]", reg(top++), node->var->offset);
+      else
+        println("  mov %s, offset %s", reg(top++), node->var->name);
+      return;
+    case ND_DEREF:
+      gen_expr(node->lhs);
+      return;
+    case ND_MEMBER:
+      gen_addr(node->lhs);
+      println("  add %s, %d", reg(top - 1), node->member->offset);
+      return;
+    case ND_COMMA:
+      gen_expr(node->lhs);
+      top--;
+      gen_addr(node->rhs);
+      return;
+  }
+
+  error_tok(node->tok, "not an lvalue");
+}
+
+// Load a value form where the stack top is pointing to.
+static void load(Type *ty) {
+  if (ty->kind == TY_ARRAY || ty->kind == TY_STRUCT || ty->kind == TY_FUNC)  {
+    // If it is an array, do nothing because in general we can't load
+    // an entire array to a register. As a result, the result of an
+    // evaluation of an array becomes not the array itself but the
+    // address of the array. In other words, this is where "array is
+    // automatically covered to a pointer to the first element of
+    // the array in C" occurs.
+    return;
+  }
+
+  char *rs = reg(top -1);
+  char *rd = regx(ty, top - 1);
+  char *insn = ty->is_unsigned ? "movzx" : "movsx";
+
+  // When we load a char or a short value to a register, we always
+  // extend them to the size of int, so we can assume the lower half of
+  // a register always contains a valid value. The upper half of a
+  // register for char, short and int may contain garbage. When we load
+  // a long value to a register, it simply occupies the entire register.
+  int sz = size_of(ty);
+  if (sz == 1)
+    println("  %s %s, byte ptr [%s]", insn, rd, rs);
+  else if (sz == 2)
+    println("  %s %s, word ptr [%s]", insn, rd, rs);
+  else if (sz == 4)
+    println("  mov %s, dword ptr [%s]", rd, rs);
+  else
+    println("  mov %s, [%s]", rd, rs);
+}
+
+static void store(Type *ty) {
+  char *rd = reg(top - 1);
+  char *rs = reg(top - 2);
+  int sz = size_of(ty);
+
+  if (ty->kind == TY_STRUCT){
+    for (int i = 0; i < ty->size; i++) {
+      println("  mov al, [%s+%d]", rs, i);
+      println("  mov [%s+%d], al", rd, i);
+    }
+  } else if (sz == 1){
+    println("  mov [%s], %sb", rd, rs);
+  } else if (sz == 2) {
+    println("  mov [%s], %sw", rd, rs);
+  } else if (sz == 4){
+    println("  mov [%s], %sd", rd, rs);
+  } else {
+    println("  mov [%s], %s", rd, rs);
+  }
+
+  top--;
+}
+
+static void cast(Type *from, Type *to) {
+  if (to->kind == TY_VOID)
+    return;
+
+  char *r = reg(top - 1);
+
+  if (to->kind == TY_BOOL) {
+    println("  cmp %s, 0", r);
+    println("  setne %sb", r);
+    println("  movzx %s, %sb", r, r);
+    return;
+  }
+
+  char *insn = to->is_unsigned ? "movzx" : "movsx";
+
+  if (size_of(to) == 1) {
+    println("  %s %s, %sb", insn, r, r);
+  } else if (size_of(to) == 2) {
+    println("  %s %s, %sw", insn, r, r);
+  } else if (size_of(to) == 4) {
+    println("  mov %sd, %sd", r, r);
+  } else if (!from->base && size_of(from) < 8 && !from->is_unsigned) {
+    println("  movsx %s, %sd", r, r);
+  }
+}
+
+static void divmod(Node *node, char *rd, char *rs, char *r64, char *r32) {
+    if (size_of(node->ty) == 8) {
+      println("  mov rax, %s", rd);
+      if (node->ty->is_unsigned) {
+        println("  mov rdx, 0");
+        println("  div %s", rs);
+      } else {
+        println("  cqo");
+        println("  idiv %s", rs);
+      }
+      println("  mov %s, %s", rd, r64);
+    } else {
+      println("  mov eax, %s", rd);
+      if (node->ty->is_unsigned) {
+        println("  mov edx, 0");
+        println("  div %s", rs);
+      } else {
+        println("  cdq");
+        println("  idiv %s", rs);
+      }
+      println("  mov %s, %s", rd, r32);
+    }
+}
+
+// Generate code for a given node.
+static void gen_expr(Node *node) {
+  emit_loc(node->tok);
+
+  switch (node->kind) {
+    case ND_NUM:
+      if (node->ty->kind == TY_LONG)
+        println("  movabs %s, %ld", reg(top++), node->val);
+      else
+        println("  mov %s, %ld", reg(top++), node->val);
+      return;
+    case ND_VAR:
+    case ND_MEMBER:
+      gen_addr(node);
+      load(node->ty);
+      return;
+    case ND_DEREF:
+      gen_expr(node->lhs);
+      load(node->ty);
+      return;
+    case ND_ADDR:
+      gen_addr(node->lhs);
+      return;
+    case ND_ASSIGN:
+      if (node->ty->kind == TY_ARRAY)
+        error_tok(node->tok, "not an lvalue");
+      if (node->lhs->ty->is_const && !node->is_init)
+        error_tok(node->tok, "cannot assign to a const variable");
+
+      gen_expr(node->rhs);
+      gen_addr(node->lhs);
+      store(node->ty);
+      return;
+    case ND_STMT_EXPR:
+      for (Node *n = node->body; n; n = n->next)
+        gen_stmt(n);
+      top++;
+      return;
+    case ND_CAST:
+      gen_expr(node->lhs);
+      cast(node->lhs->ty, node->ty);
+      return;
+    case ND_COMMA:
+      gen_expr(node->lhs);
+      top--;
+      gen_expr(node->rhs);
+      return;
+    case ND_COND: {
+      int seq = labelseq++;
+      gen_expr(node->cond);
+      println("  cmp %s, 0", reg(--top));
+      println("  je  .L.else.%s.%d", funcname, seq);
+      gen_expr(node->then);
+      top--;
+      println("  jmp .L.end.%s.%d", funcname, seq);
+      println(".L.else.%s.%d:", funcname, seq);
+      gen_expr(node->els);
+      println(".L.end.%s.%d:", funcname, seq);
+      return;
+    }
+    case ND_NOT:
+      gen_expr(node->lhs);
+      println("  cmp %s, 0", reg(top - 1));
+      println("  sete %sb", reg(top - 1));
+      println("  movzx %s, %sb", reg(top - 1), reg(top - 1));
+      return;
+    case ND_BITNOT:
+      gen_expr(node->lhs);
+      println("  not %s", reg(top - 1));
+      return;
+    case ND_LOGAND: {
+      int seq = labelseq++;
+      gen_expr(node->lhs);
+      println("  cmp %s, 0", reg(--top));
+      println("  je .L.0.%s.%d", funcname, seq);
+      gen_expr(node->rhs);
+      println("  cmp %s, 0", reg(--top));
+      println("  je .L.0.%s.%d", funcname, seq);
+      println("  mov %s, 1", reg(top));
+      println("  jmp .L.end.%s.%d", funcname, seq);
+      println(".L.0.%s.%d:", funcname, seq);
+      println("  mov %s, 0", reg(top++));
+      println(".L.end.%s.%d:", funcname, seq);
+      return;
+    }
+    case ND_LOGOR: {
+      int seq = labelseq++;
+      gen_expr(node->lhs);
+      println("  cmp %s, 0", reg(--top));
+      println("  jne .L.1.%s.%d", funcname, seq);
+      gen_expr(node->rhs);
+      println("  cmp %s, 0", reg(--top));
+      println("  jne .L.1.%s.%d", funcname, seq);
+      println("  mov %s, 0", reg(top));
+      println("  jmp .L.end.%s.%d", funcname, seq);
+      println(".L.1.%s.%d:", funcname, seq);
+      println("  mov %s, 1", reg(top++));
+      println(".L.end.%s.%d:", funcname, seq);
+      return;
+    }
+    case ND_FUNCALL: {
+      if (node->lhs->kind == ND_VAR &&
+          !strcmp(node->lhs->var->name, "__builtin_va_start")) {
+        gen_expr(node->args);
+        println("  mov eax, [rbp-40]");
+        println("  mov [%s], eax", reg(top - 1));
+        println("  lea rax, [rbp-88]");
+        println("  mov [%s+16], rax", reg(top - 1));
+        return;
+      }
+      // Save all temporary registers to the stack before evaluating
+      // function arguments to allow each argument evaluation to use all
+      // temporary registers. This is a workround for a register
+      // exhaustion issue when evaluating a long expression containing
+      // multiple function calls.
+      int top_orig = top;
+      top = 0;
+
+      println("  push r10");
+      println("  push r11");
+      println("  push r12");
+      println("  push r13");
+      println("  push r14");
+      println("  push r15");
+
+      int nargs = 0;
+      for (Node *arg = node->args; arg; arg = arg->next) {
+        gen_expr(arg);
+        println("  push %s", reg(--top));
+        println("  sub rsp, 8");
+        nargs++;
+      }
+
+      gen_expr(node->lhs);
+
+      for (int i = nargs - 1; i >= 0; i--) {
+        println("  add rsp, 8");
+        println("  pop %s", argreg64[i]);
+      }
+
+      println("  mov rax, 0");
+      println("  call %s", reg(--top));
+
+      // The System V x86-64 ABI has a special rule ragarding a boolean
+      // return value that only the lower 8 bits are valid for it and
+      // the upper 56 bits may contain garbage. Here, we claer the upper
+      // 56 bits.
+      if (node->ty->kind == TY_BOOL)
+        println("  movzx eax, al");
+
+      top = top_orig;
+      println("  pop r15");
+      println("  pop r14");
+      println("  pop r13");
+      println("  pop r12");
+      println("  pop r11");
+      println("  pop r10");
+
+      println("  mov %s, rax", reg(top++));
+      return;
+  }
+  }
+
+  // Binary expressions
+  gen_expr(node->lhs);
+  gen_expr(node->rhs);
+
+  char *rd = regx(node->lhs->ty, top - 2);
+  char *rs = regx(node->lhs->ty, top - 1);
+  top--;
+
+  switch (node->kind) {
+  case ND_ADD:
+    println("  add %s, %s", rd, rs);
+    return;
+  case ND_SUB:
+    println("  sub %s, %s", rd, rs);
+    return;
+  case ND_MUL:
+    println("  imul %s, %s", rd, rs);
+    return;
+  case ND_DIV:
+    divmod(node, rd, rs, "rax", "eax");
+    return;
+  case ND_MOD:
+    divmod(node, rd, rs, "rdx", "edx");
+    return;
+  case ND_BITAND:
+    println("  and %s, %s", rd, rs);
+    return;
+  case ND_BITOR:
+    println("  or %s, %s", rd, rs);
+    return;
+  case ND_BITXOR:
+    println("  xor %s, %s", rd, rs);
+    return;
+  case ND_EQ:
+    println("  cmp %s, %s", rd, rs);
+    println("  sete al");
+    println("  movzb %s, al", rd);
+    return;
+  case ND_NE:
+    println("  cmp %s, %s", rd, rs);
+    println("  setne al");
+    println("  movzb %s, al", rd);
+    return;
+  case ND_LT:
+    println("  cmp %s, %s", rd, rs);
+    if (node->lhs->ty->is_unsigned)
+      println("  setb al");
+    else
+      println("  setl al");
+    println("  movzb %s, al", rd);
+    return;
+  case ND_LE:
+    println("  cmp %s, %s", rd, rs);
+    if (node->lhs->ty->is_unsigned)
+      println("  setbe al");
+    else
+      println("  setle al");
+    println("  movzb %s, al", rd);
+    return;
+  case ND_SHL:
+    println("  mov rcx, %s", reg(top));
+    println("  shl %s, cl", rd);
+    return;
+  case ND_SHR:
+    println("  mov rcx, %s", reg(top));
+    if (node->lhs->ty->is_unsigned)
+      println("  shr %s, cl", rd);
+    else
+      println("  sar %s, cl", rd);
+    return;
+  default:
+    error_tok(node->tok, "invalid expression");
+  }
+}
+
+static void gen_stmt(Node *node) {
+  emit_loc(node->tok);
+
+  switch (node->kind) {
+  case ND_IF: {
+    int seq = labelseq++;
+    if (node->els) {
+      gen_expr(node->cond);
+      println("  cmp %s, 0", reg(--top));
+      println("  je .L.else.%s.%d", funcname, seq);
+      gen_stmt(node->then);
+      println("  jmp .L.end.%s.%d", funcname, seq);
+      println(".L.else.%s.%d:", funcname, seq);
+      gen_stmt(node->els);
+      println(".L.end.%s.%d:", funcname, seq);
+    } else {
+      gen_expr(node->cond);
+      println("  cmp %s, 0", reg(--top));
+      println("  je .L.end.%s.%d", funcname, seq);
+      gen_stmt(node->then);
+      println(".L.end.%s.%d:", funcname, seq);
+    }
+    return;
+  }
+  case ND_FOR: {
+    int seq = labelseq++;
+    int brk = brkseq;
+    int cont = contseq;
+    brkseq = contseq = seq;
+
+    if (node->init)
+      gen_stmt(node->init);
+    println(".L.begin.%s.%d:", funcname, seq);
+    if (node->cond) {
+      gen_expr(node->cond);
+      println("  cmp %s, 0", reg(--top));
+      println("  je .L.break.%s.%d", funcname, seq);
+    }
+    gen_stmt(node->then);
+    println(".L.continue.%s.%d:", funcname, seq);
+    if(node->inc)
+      gen_stmt(node->inc);
+    println("  jmp .L.begin.%s.%d", funcname, seq);
+    println(".L.break.%s.%d:", funcname, seq);
+
+    brkseq = brk;
+    contseq = cont;
+    return;
+  }
+  case ND_DO: {
+    int seq = labelseq++;
+    int brk = brkseq;
+    int count = contseq;
+    brkseq = contseq = seq;
+
+    println(".L.begin.%s.%d:", funcname, seq);
+    gen_stmt(node->then);
+    println(".L.continue.%s.%d:", funcname, seq);
+    gen_expr(node->cond);
+    println("  cmp %s, 0", reg(--top));
+    println("  jne .L.begin.%s.%d", funcname, seq);
+    println(".L.break.%s.%d:", funcname, seq);
+
+    brkseq = brk;
+    contseq = count;
+    return;
+  }
+  case ND_SWITCH: {
+    int seq = labelseq++;
+    int brk = brkseq;
+    brkseq = seq;
+    node->case_label = seq;
+
+    gen_expr(node->cond);
+
+    for (Node *n = node->case_next; n; n = n->case_next) {
+      n->case_label = labelseq++;
+      n->case_end_label = seq;
+      println("  cmp %s, %ld", reg(top - 1), n->val);
+      println("  je .L.case.%s.%d", funcname, n->case_label);
+    }
+    top--;
+
+    if (node->default_case) {
+      int i = labelseq++;
+      node->default_case->case_end_label = seq;
+      node->default_case->case_label = i;
+      println("  jmp .L.case.%s.%d", funcname, i);
+    }
+
+    println("  jmp .L.break.%s.%d", funcname, seq);
+    gen_stmt(node->then);
+    println(".L.break.%s.%d:", funcname, seq);
+
+    brkseq = brk;
+    return;
+  }
+  case ND_CASE:
+    println(".L.case.%s.%d:", funcname, node->case_label);
+    gen_stmt(node->lhs);
+    return;
+  case ND_BLOCK:
+    for (Node *n = node->body; n; n = n->next)
+      gen_stmt(n);
+    return;
+  case ND_BREAK:
+    if (brkseq == 0)
+      error_tok(node->tok, "stray break");
+    println("  jmp .L.break.%s.%d", funcname, brkseq);
+    return;
+  case ND_CONTINUE:
+    if (contseq == 0)
+      error_tok(node->tok, "stray continue");
+    println("  jmp .L.continue.%s.%d", funcname, contseq);
+    return;
+  case ND_GOTO:
+    println("  jmp .L.label.%s.%s", funcname, node->label_name);
+    return;
+  case ND_LABEL:
+    println(".L.label.%s.%s:", funcname, node->label_name);
+    gen_stmt(node->lhs);
+    return;
+  case ND_RETURN:
+    if (node->lhs) {
+      gen_expr(node->lhs);
+      println("  mov rax, %s", reg(--top));
+    }
+    println("  jmp .L.return.%s", funcname);
+    return;
+  case ND_EXPR_STMT:
+    gen_expr(node->lhs);
+    top--;
+    return;
+  default:
+    error_tok(node->tok, "invalid statement");
+  }
+}
+
+static void emit_data(Program *prog) {
+  println(".bss");
+
+  for (Var *var = prog->globals; var; var = var->next) {
+    if (var->initializer)
+      continue;
+
+    println(".align %d", var->align);
+    if (!var->is_static)
+      println(".globl %s", var->name);
+    println("%s:", var->name);
+    println("  .zero %d", size_of(var->ty));
+  }
+
+  println(".data");
+
+  for (Var *var = prog->globals; var; var = var->next) {
+    if (!var->initializer)
+      continue;
+
+    println(".align %d", var->align);
+    if (!var->is_static)
+      println(".globl %s", var->name);
+    println("%s:", var->name);
+
+    int offset = 0;
+    for (GvarInitializer *init = var->initializer; init; init = init->next) {
+      if (offset < init->offset)
+        println("  .zero %d", init->offset - offset);
+      offset = init->offset + init->sz;
+
+      if (init->bytes)
+        for (int i = 0; i < init->sz; i++)
+          println("  .byte %d", init->bytes[i]);
+      else if (init->label)
+        println("  .quad %s%+ld", init->label, init->addend);
+      else if (init->sz == 1)
+        println("  .byte %ld", init->val);
+      else if (init->sz == 2)
+        println("  .short %ld", init->val);
+      else if (init->sz == 4)
+        println("  .long %ld", init->val);
+      else
+        println("  .quad %ld", init->val);
+    }
+
+    if (offset < size_of(var->ty))
+      println("  .zero %d", size_of(var->ty) - offset);
+  }
+}
+
+static char *get_argreg(int sz, int idx) {
+  if (sz == 1)
+    return argreg8[idx];
+  if (sz == 2)
+    return argreg16[idx];
+  if (sz == 4)
+    return argreg32[idx];
+  assert(sz == 8);
+  return argreg64[idx];
+}
+
+static void emit_function(Function *fn) {
+  if (!fn->is_static)
+    println(".globl %s", fn->name);
+  println("%s:", fn->name);
+  funcname = fn->name;
+  labelseq = 1;
+  loc_file_no = loc_lineno = 0;
+
+  //Prologue. r12-r15 are callee-saved registers.
+  println("  push rbp");
+  println("  mov rbp, rsp");
+  println("  sub rsp, %d", fn->stack_size);
+  println("  mov [rbp-8], r12");
+  println("  mov [rbp-16], r13");
+  println("  mov [rbp-24], r14");
+  println("  mov [rbp-32], r15");
+
+  // Save arg registers if funtion is variadic
+  if (fn->is_varargs) {
+    int n = 0;
+    for (Var *var = fn->params; var; var = var->next)
+      n++;
+
+    println("  mov [rbp-88], rdi");
+    println("  mov [rbp-80], rsi");
+    println("  mov [rbp-72], rdx");
+    println("  mov [rbp-64], rcx");
+    println("  mov [rbp-56], r8");
+    println("  mov [rbp-48], r9");
+    println("  mov dword ptr [rbp-40], %d", n * 8);
+  }
+
+  // Push arguments to the stack
+  int i = 0;
+  for (Var *var = fn->params; var; var = var->next)
+    i++;
+
+  for (Var *var = fn->params; var; var = var->next) {
+    char *r = get_argreg(size_of(var->ty), --i);
+    println("  mov [rbp-%d], %s", var->offset, r);
+  }
+
+  // Emit code
+  for (Node *n = fn->node; n; n = n->next) {
+    gen_stmt(n);
+    assert(top == 0);
+  }
+
+  // Epilogue
+  println(".L.return.%s:", funcname);
+  println("  mov r12, [rbp-8]");
+  println("  mov r13, [rbp-16]");
+  println("  mov r14, [rbp-24]");
+  println("  mov r15, [rbp-32]");
+  println("  mov rsp, rbp");
+  println("  pop rbp");
+  println("  ret");
+}
+
+// Forking a worker process and collecting its output costs about as
+// much as generating code for this many AST nodes, so each worker
+// is given at least this many.
+enum { MIN_JOB_NODES = 50000 };
+
+// Generates functions in parallel using up to `codegen_jobs` worker
+// processes, each of which takes a run of consecutive functions.
+// Their outputs are concatenated in the original order. Since labels
+// are local to each function, the output is byte-identical to the
+// one generated by a single process.
+static void emit_text_parallel(Function **fns, int nfns, long total) {
+  int njobs = codegen_jobs;
+  if (njobs > total / MIN_JOB_NODES)
+    njobs = total / MIN_JOB_NODES;
+
+  int *pids = calloc(njobs, sizeof(int));
+  int *fds = calloc(njobs, sizeof(int));
+  int nworkers = 0;
+  int begin = 0;
+
+  while (begin < nfns) {
+    // Take functions until this worker gets its share of nodes.
+    int end = begin;
+    long nodes = 0;
+    long share = total / njobs;
+    do {
+      nodes += fns[end++]->nr_nodes;
+    } while (end < nfns && nodes < share && nworkers < njobs - 1);
+    if (nworkers == njobs - 1)
+      end = nfns;
+
+    int pfd[2];
+    if (pipe(pfd))
+      error("pipe failed: %s", strerror(*__errno_location()));
+
+    int pid = fork();
+    if (pid < 0)
+      error("fork failed: %s", strerror(*__errno_location()));
+
+    if (pid == 0) {
+      close(pfd[0]);
+      for (int i = 0; i < nworkers; i++)
+        close(fds[i]);
+
+      // Drop the output inherited from the parent, and collect ours
+      // in memory so that we don't block on the pipe while others
+      // are still working.
+      take_output();
+      capture_output();
+
+      for (int i = begin; i < end; i++)
+        emit_function(fns[i]);
+
+      char *p = take_output();
+      dup2(pfd[1], 1);
+      open_output(0);
+      write_output(p, strlen(p));
+      exit(0);
+    }
+
+    close(pfd[1]);
+    pids[nworkers] = pid;
+    fds[nworkers] = pfd[0];
+    nworkers++;
+    begin = end;
+  }
+
+  _Bool failed = 0;
+  for (int i = 0; i < nworkers; i++) {
+    char *p = read_all(fds[i]);
+    close(fds[i]);
+
+    int status;
+    while (waitpid(pids[i], &status, 0) < 0)
+      if (*__errno_location() != EINTR)
+        error("waitpid failed: %s", strerror(*__errno_location()));
+
+    if (status != 0)
+      failed = 1;
+    else if (!failed)
+      emitf("%s", p);
+    free(p);
+  }
+
+  // A worker has reported the error.
+  if (failed)
+    exit(1);
+
+  free(pids);
+  free(fds);
+}
+
+static void emit_text(Program *prog) {
+  println(".text");
+
+  int nfns = 0;
+  long total = 0;
+  for (Function *fn = prog->fns; fn; fn = fn->next) {
+    nfns++;
+    total += fn->nr_nodes;
+  }
+
+  if (codegen_jobs > 1 && nfns > 1 && total >= MIN_JOB_NODES * 2) {
+    Function **fns = calloc(nfns, sizeof(Function *));
+    int i = 0;
+    for (Function *fn = prog->fns; fn; fn = fn->next)
+      fns[i++] = fn;
+    emit_text_parallel(fns, nfns, total);
+    free(fns);
+    return;
+  }
+
+  for (Function *fn = prog->fns; fn; fn = fn->next)
+    emit_function(fn);
+}
+
+void codegen(Program *prog) {
+  println(".intel_syntax noprefix");
+
+  long start = output_size();
+  timer_start(PH_EMIT_DATA);
+  emit_data(prog);
+  timer_stop();
+  timer_count(PH_EMIT_DATA, output_size() - start);
+
+  start = output_size();
+  timer_start(PH_EMIT_TEXT);
+  emit_text(prog);
+  timer_stop();
+  timer_count(PH_EMIT_TEXT, output_size() - start);
+}
@@ -0,0 +1,942 @@
+typedef struct FILE FILE;
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+typedef struct {
+  int gp_offset;
+  int fp_offset;
+  void *overflow_arg_area;
+  void *reg_save_area;
+} va_list[1];
+
+struct timespec {
+  long tv_sec;
+  long tv_nsec;
+};
+
+struct rusage {
+  long ru_utime[2];
+  long ru_stime[2];
+  long ru_maxrss;
+  long ru_reserved[13];
+};
+
+struct stat {
+  unsigned long st_dev;
+  unsigned long st_ino;
+  unsigned long st_nlink;
+  unsigned int st_mode;
+  unsigned int st_uid;
+  unsigned int st_gid;
+  int __pad0;
+  unsigned long st_rdev;
+  long st_size;
+  long st_blksize;
+  long st_blocks;
+  struct timespec st_atim;
+  struct timespec st_mtim;
+  struct timespec st_ctim;
+  long __reserved[3];
+};
+
+struct sockaddr_un {
+  unsigned short sun_family;
+  char sun_path[108];
+};
+
+struct iovec {
+  void *iov_base;
+  long iov_len;
+};
+
+struct msghdr {
+  void *msg_name;
+  int msg_namelen;
+  struct iovec *msg_iov;
+  long msg_iovlen;
+  void *msg_control;
+  long msg_controllen;
+  int msg_flags;
+};
+
+struct pollfd {
+  int fd;
+  short events;
+  short revents;
+};
+
+typedef struct DIR DIR;
+
+struct dirent {
+  unsigned long d_ino;
+  long d_off;
+  unsigned short d_reclen;
+  unsigned char d_type;
+  char d_name[256];
+};
+
+enum { EINTR = 4 };
+enum { O_RDONLY = 0, O_WRONLY = 1, O_RDWR = 2, O_CREAT = 64, O_TRUNC = 512 };
+enum { LOCK_EX = 2 };
+enum { S_IFMT = 61440, S_IFREG = 32768 };
+enum { PROT_READ = 1, PROT_WRITE = 2 };
+enum { MAP_PRIVATE = 2, MAP_FIXED = 16, MAP_ANONYMOUS = 32, MAP_POPULATE = 32768 };
+enum { _SC_PAGESIZE = 30 };
+enum { AF_UNIX = 1, SOCK_STREAM = 1, SOL_SOCKET = 1, SCM_RIGHTS = 1 };
+enum { MSG_CTRUNC = 8, MSG_NOSIGNAL = 16384 };
+enum { POLLIN = 1 };
+enum { RUSAGE_SELF = 0 };
+enum { CLOCK_MONOTONIC = 1, CLOCK_PROCESS_CPUTIME_ID = 2 };
+
+void *malloc(long size);
+void *calloc(long nmemb, long size);
+void *realloc(void *buf, long size);
+int *__errno_location();
+char *strerror(int errnum);
+FILE *fopen(char *pathname, char *mode);
+long fread(void *ptr, long size, long nmemb, FILE *stream);
+int fclose(FILE *fp);
+int feof(FILE *stream);
+static void assert() {}
+int strcmp(char *s1, char *s2);
+int strncasecmp(char *s1, char *s2);
+int printf(char *fmt, ...);
+int sprintf(char *buf, char *fmt, ...);
+int fprintf(FILE *fp, char *fmt, ...);
+int vfprintf(FILE *fp, char *fmt, va_list ap);
+long strlen(char *p);
+int strncmp(char *p, char *q);
+void *memvpy(char *dst, char *src, long n);
+char *strndup(char *p, long n);
+int isspace(int c);
+int ispunct(int c);
+int isdigit(int c);
+char *strstr(char *haystack, char *needle);
+static void va_end(va_list ap) {}
+long strtoul(char *nptr, char **endptr, int base);
+char *strncpy(char *dest, char *src, long n);
+void exit(int code);
+int atoi(char *nptr);
+char *strrchr(char *s, int c);
+int fflush(FILE *stream);
+int fork(void);
+int waitpid(int pid, int *status, int options);
+int unlink(char *pathname);
+int creat(char *pathname, int mode);
+void *memset(void *s, int c, long n);
+int memcmp(void *s1, void *s2, long n);
+char *strchr(char *s, int c);
+long strtol(char *nptr, char **endptr, int base);
+long write(int fd, void *buf, long count);
+void *memcpy(void *dst, void *src, long n);
+int clock_gettime(int clockid, struct timespec *tp);
+int getrusage(int who, struct rusage *usage);
+void free(void *ptr);
+char *strcpy(char *dest, char *src);
+long read(int fd, void *buf, long count);
+int close(int fd);
+int dup2(int oldfd, int newfd);
+int pipe(int *pipefd);
+int chdir(char *path);
+char *getcwd(char *buf, long size);
+char *realpath(char *path, char *resolved_path);
+int stat(char *path, struct stat *buf);
+int socket(int domain, int type, int protocol);
+int bind(int fd, struct sockaddr *addr, int len);
+int listen(int fd, int backlog);
+int accept(int fd, struct sockaddr *addr, int *len);
+int connect(int fd, struct sockaddr *addr, int len);
+long send(int fd, void *buf, long len, int flags);
+long sendmsg(int fd, struct msghdr *msg, int flags);
+long recvmsg(int fd, struct msghdr *msg, int flags);
+int poll(struct pollfd *fds, long nfds, int timeout);
+int open(char *path, int flags, ...);
+int fstat(int fd, struct stat *buf);
+int flock(int fd, int op);
+void *mmap(void *addr, long len, int prot, int flags, int fd, long off);
+int munmap(void *addr, long len);
+long sysconf(int name);
+long pread(int fd, void *buf, long count, long offset);
+long pwrite(int fd, void *buf, long count, long offset);
+int ftruncate(int fd, long length);
+int getpid(void);
+int rename(char *oldpath, char *newpath);
+int mkdir(char *path, int mode);
+int utime(char *path, void *times);
+DIR *opendir(char *name);
+struct dirent *readdir(DIR *dirp);
+int closedir(DIR *dirp);
+
+typedef struct Type Type;
+typedef struct Member Member;
+typedef struct GvarInitializer GvarInitializer;
+
+//
+// tokenize.c
+//
+
+// Token
+typedef enum {
+  TK_RESERVED, // Keyworeds or punctuators
+  TK_IDENT,    // Identifiers
+  TK_STR,      // String literals
+  TK_NUM,      // Integer literals
+  TK_EOF,      // End-of-file markers
+} TokenKind;
+
+// Keywords, preprocessor directive names and punctuators are given
+// an ID by the tokenizer, so that they can be compared as integers.
+// The order must match `token_names` in tokenize.c.
+typedef enum {
+  ID_NONE,
+
+  // Keywords
+  KW_RETURN, KW_IF, KW_ELSE, KW_FOR, KW_WHILE, KW_INT, KW_SIZEOF,
+  KW_CHAR, KW_STRUCT, KW_UNION, KW_SHORT, KW_LONG, KW_VOID,
+  KW_TYPEDEF, KW_BOOL, KW_ENUM, KW_STATIC, KW_BREAK, KW_CONTINUE,
+  KW_GOTO, KW_SWITCH, KW_CASE, KW_DEFAULT, KW_EXTERN, KW_ALIGNOF,
+  KW_ALIGNAS, KW_DO, KW_SIGNED, KW_UNSIGNED, KW_CONST, KW_VOLATILE,
+
+  // Preprocessor directive names other than keywords
+  PP_INCLUDE, PP_DEFINE, PP_UNDEF, PP_IFDEF, PP_IFNDEF, PP_ELIF,
+  PP_ENDIF, PP_PRAGMA, PP_DEFINED, PP_ONCE,
+
+  // Punctuators, longest first
+  P_ELLIPSIS, P_SHL_ASSIGN, P_SHR_ASSIGN,
+  P_EQ, P_NE, P_LE, P_GE, P_ARROW, P_ADD_ASSIGN, P_SUB_ASSIGN,
+  P_MUL_ASSIGN, P_DIV_ASSIGN, P_INC, P_DEC, P_MOD_ASSIGN,
+  P_AND_ASSIGN, P_OR_ASSIGN, P_XOR_ASSIGN, P_LOGAND, P_LOGOR, P_SHL,
+  P_SHR, P_HASHHASH,
+  P_LPAREN, P_RPAREN, P_LBRACE, P_RBRACE, P_LBRACKET, P_RBRACKET,
+  P_SEMICOLON, P_COMMA, P_DOT, P_ASSIGN, P_LT, P_GT, P_PLUS, P_MINUS,
+  P_STAR, P_SLASH, P_PERCENT, P_AMP, P_PIPE, P_CARET, P_TILDE, P_NOT,
+  P_QUESTION, P_COLON, P_HASH,
+
+  NR_TOKEN_IDS,
+} TokenId;
+
+// Set of macro names, represented as a Patricia tree keyed by
+// name_id(). There is only one Hideset object for each set, so equal
+// sets are the same pointer. A Hideset must not be modified.
+typedef struct Hideset Hideset;
+struct Hideset {
+  Hideset *left;       // 0 if leaf
+  Hideset *right;
+  long prefix;         // Bits below `bit` shared by all names, or leaf's ID
+  long bit;            // The bit that tells which child has a name
+  char *name;          // If leaf, the name
+  unsigned long bloom; // One bit for each name, for quick rejection
+};
+
+// Source file of tokens. Tokens read from the same input share one.
+typedef struct {
+  char *name;     // Input filename
+  char *contents; // Entire input string
+  int file_no;    // File number for .loc directive
+
+  // Offsets of the beginnings of lines, recorded as the file is
+  // tokenized
+  int *lines;
+  int nr_lines;
+  int lines_cap;
+} File;
+
+// Payload of a literal token
+typedef struct {
+  long val;       // If TK_NUM, its value
+  Type *ty;       // If TK_NUM, its type
+  char *contents; // If TK_STR, its contents, not null-terminated
+  int cont_len;   // If TK_STR, its length excluding terminating '\0'
+} Literal;
+
+// Token type
+//
+// Fields the preprocessor and the parser look at for every token
+// come first. Those used only for some tokens or only for error
+// messages and debug info are kept out of line.
+typedef struct Token Token;
+struct Token {
+  TokenKind kind;   // Token kind
+  TokenId id;       // Keyword or punctuator ID, or ID_NONE
+  Token *next;      // Next token
+  char *loc;        // Token location
+  int len;          // Token length
+  int lineno;       // Line number
+  char *name;       // If identifier or keyword, its interned spelling
+  Hideset *hideset; // For macro expension
+  _Bool at_bol;      // True if this token is at beginning of line
+  _Bool has_space;   // True if this token follows a space character
+  _Bool is_raw;      // True if this token is read from a file
+  _Bool is_shared;   // True if this token is in a file's cached tokens
+
+  File *file;       // Source file
+  Literal *lit;     // If TK_NUM or TK_STR, its value
+};
+
+extern _Bool fast_lexer;
+
+void error(char *fmt, ...);
+void error_tok(Token *tok, char *fmt, ...);
+void warn_tok(Token *tok, char *fmt, ...);
+Token *skip(Token *tok, TokenId id);
+_Bool consume(Token **rest, Token *tok, TokenId id);
+char *intern(char *s, int len);
+long name_id(char *name);
+File *new_file(char *name, int file_no, char *contents);
+int get_column(Token *tok);
+void convert_keywords(Token *tok);
+Token *next_token(Token *tok);
+void free_token(Token *tok);
+Token *tokenize_lazy(char *filename, int file_no, char *p, Token *cont);
+Token *tokenize_cached(Token *src, char *filename, int file_no,
+                       Token *cont);
+Token *tokenize(char *filename, int file_no, char *p);
+
+//
+// preprocess.c
+//
+
+extern _Bool pp_report;
+
+// Identifies a file and its version.
+typedef struct {
+  unsigned long dev;
+  unsigned long ino;
+  long size;
+  long mtime_sec;
+  long mtime_nsec;
+} FileId;
+
+_Bool get_file_id(char *path, FileId *id);
+char *read_file_string(char *path, long *mapping);
+void free_file_string(char *buf, long mapping);
+int add_file(char *path);
+void save_file_ids(void);
+char *load_file_ids(void);
+void save_macros(void);
+void load_macros(void);
+Token *read_file(char *path);
+void print_pp_report(char *input);
+
+//
+// parse.c
+//
+
+// Variable
+typedef struct Var Var;
+struct Var {
+  Var *next;
+  char *name;    // Variable name
+  Type *ty;      // Type
+  Token *tok;    // representative token
+  _Bool is_local; // local or global
+  int align;     // alignment
+
+  _Bool is_static;
+  GvarInitializer *initializer;
+
+  // Local variable
+  int offset;
+
+  // Gloval variable
+  char *contents;
+  int cont_len;
+};
+
+// AST node
+typedef enum {
+  ND_ADD,       // +
+  ND_SUB,       // -
+  ND_MUL,       // *
+  ND_DIV,       // /
+  ND_MOD,       // %
+  ND_BITAND,    // &
+  ND_BITOR,     // |
+  ND_BITXOR,    // ^
+  ND_SHL,       // <<
+  ND_SHR,       // >>
+  ND_EQ,        // ==
+  ND_NE,        // !=
+  ND_LT,        // <
+  ND_LE,        // <=
+  ND_ASSIGN,    // =
+  ND_COND,      // ?:
+  ND_COMMA,     // ,
+  ND_MEMBER,    // . (struct member access)
+  ND_ADDR,      // unary &
+  ND_DEREF,     // unary *
+  ND_NOT,       // !
+  ND_BITNOT,    // ~
+  ND_LOGAND,    // &&
+  ND_LOGOR,     // ||
+  ND_RETURN,    // "return"
+  ND_IF,        // "if"
+  ND_FOR,       // "for" or "while"
+  ND_DO,        // "do"
+  ND_SWITCH,    // "switch"
+  ND_CASE,      // "case"
+  ND_BLOCK,     // { ... }
+  ND_BREAK,     // "break"
+  ND_CONTINUE,  // "continue"
+  ND_GOTO,      // "goto"
+  ND_LABEL,     // Labeled statement
+  ND_FUNCALL,   // Function call
+  ND_EXPR_STMT, // Expression statement
+  ND_STMT_EXPR, // Statement expression
+  ND_VAR,       // Variable
+  ND_NUM,       // Integer
+  ND_CAST,      // Type cast
+} NodeKind;
+
+// AST node type
+typedef struct Node Node;
+struct Node {
+  NodeKind kind; // Node kind
+  Node *next;    // Next node
+  Type *ty;      // Type, e.g. int or pointer to tin
+  Token *tok;    // Representative token
+
+  Node *lhs;     // Left-hand side
+  Node *rhs;     // Right-hand side
+
+  // "if" or "for" statement
+  Node *cond;
+  Node *then;
+  Node *els;
+  Node *init;
+  Node *inc;
+
+  // Assignment
+  _Bool is_init;
+
+  // Blcok or statement expression
+  Node *body;
+
+  // Struct member access
+  Member *member;
+
+  // Function call
+  char *funcname;
+  Type *func_ty;
+  Node *args;
+
+  // Goto or labeled statement
+  char *label_name;
+
+  // Switch-cases
+  Node *case_next;
+  Node *default_case;
+  int case_label;
+  int case_end_label;
+
+  // Variable
+  Var *var;
+
+  // Integer literal
+  long val;
+};
+
+// Global variable initializer. Global variables can be initialized
+// either by a constatnt expression or a pointer to another global
+// bariable with an addend.
+struct GvarInitializer {
+  GvarInitializer *next;
+  int offset;
+
+  // Scalar value
+  int sz;
+  long val;
+
+  // Byte string of `sz` bytes
+  char *bytes;
+
+  // Reference to another global variable
+  char *label;
+  long addend;
+};
+
+typedef struct Function Function;
+struct Function {
+  Function *next;
+  char *name;
+  Var *params;
+  _Bool is_static;
+  _Bool is_varargs;
+
+  Node *node;
+  Var *locals;
+  int stack_size;
+  long nr_nodes; // The number of AST nodes, as an estimate of work
+};
+
+typedef struct {
+  Var *globals;
+  Function *fns;
+} Program;
+
+Node *new_cast(Node *expr, Type *ty);
+long const_expr(Token **rest, Token *tok);
+void save_scopes(void);
+void load_scopes(void);
+Program *parse(Token *tok);
+
+//
+// type.c
+//
+
+typedef enum {
+  TY_VOID,
+  TY_BOOL,
+  TY_CHAR,
+  TY_SHORT,
+  TY_INT,
+  TY_LONG,
+  TY_ENUM,
+  TY_PTR,
+  TY_FUNC,
+  TY_ARRAY,
+  TY_STRUCT,
+} TypeKind;
+
+struct Type {
+  TypeKind kind;
+  int size;           // sizeof() value
+  int align;          // alignment
+  _Bool is_unsigned;   // unsigned or signed
+  _Bool is_incomplete; // incomplete type
+  _Bool is_const;
+
+  // Pointer
+  Type *base;
+
+  // Declaration
+  Token *name;
+  Token *name_pos;
+
+  // Array
+  int array_len;
+
+  // Struct
+  Member *members;
+
+  // Function type
+  Type *return_ty;
+  Type *params;
+  _Bool is_varargs;
+  Type *next;
+};
+
+// Struct member
+struct Member {
+  Member *next;
+  Type *ty;
+  Token *tok; // for error message
+  Token *name;
+  int align;
+  int offset;
+};
+
+extern Type *ty_void;
+extern Type *ty_bool;
+
+extern Type *ty_char;
+extern Type *ty_short;
+extern Type *ty_int;
+extern Type *ty_long;
+
+extern Type *ty_uchar;
+extern Type *ty_ushort;
+extern Type *ty_uint;
+extern Type *ty_ulong;
+
+_Bool is_integer(Type *ty);
+Type *copy_type(Type *ty);
+Type *pointer_to(Type *base);
+int align_to(int n, int align);
+Type *func_type(Type *return_ty);
+Type *array_of(Type *base, int size);
+Type *enum_type(void);
+Type *struct_type(void);
+int size_of(Type *ty);
+Type *copy_type(Type *ty);
+void add_type(Node *node);
+
+//
+// codegen.c
+//
+
+extern int codegen_jobs;
+
+void codegen(Program *prog);
+
+//
+// emit.c
+//
+
+void open_output(char *path);
+void flush_output(void);
+void write_output(char *p, long len);
+void capture_output(void);
+char *take_output(void);
+void emitf(char *fmt, ...);
+void println(char *fmt, ...);
+long output_size(void);
+char *output_since(long pos);
+
+//
+// assemble.c
+//
+
+void assemble(char *input, char *path);
+
+//
+// timer.c
+//
+
+typedef enum {
+  PH_READ,       // read_file_string
+  PH_TOKENIZE,   // tokenize
+  PH_PREPROCESS, // preprocess
+  PH_KEYWORDS,   // convert_keywords
+  PH_PARSE,      // parse
+  PH_LAYOUT,     // stack offset assignment
+  PH_EMIT_DATA,  // emit_data
+  PH_EMIT_TEXT,  // emit_text
+  PH_ASSEMBLE,   // assemble
+  NR_PHASES,
+} Phase;
+
+extern _Bool time_report;
+extern _Bool time_report_json;
+
+void timer_start(Phase ph);
+void timer_stop(void);
+void timer_count(Phase ph, long n);
+void timer_count_lines(long n);
+void reset_timer(void);
+Phase current_phase(void);
+char *phase_name(Phase ph);
+void print_time_report(char *input);
+
+//
+// alloc.c
+//
+
+typedef enum {
+  AK_TOKEN,       // Token
+  AK_HIDESET,     // Hideset
+  AK_MACRO,       // Macro, MacroParam, MacroArg and CondIncl
+  AK_NODE,        // Node
+  AK_TYPE,        // Type
+  AK_MEMBER,      // Member
+  AK_VAR,         // Var
+  AK_VAR_SCOPE,   // VarScope
+  AK_TAG_SCOPE,   // TagScope
+  AK_FUNCTION,    // Function and Program
+  AK_INITIALIZER, // Initializer
+  AK_GVAR_INIT,   // GvarInitializer
+  AK_STRING,      // Names, labels and string literals
+  AK_FILE,        // Source file contents
+  NR_ALLOC_KINDS,
+} AllocKind;
+
+typedef struct Arena Arena;
+
+extern _Bool mem_report;
+
+void reset_alloc_stats(void);
+void count_alloc(AllocKind kind, long size);
+void *alloc_obj(AllocKind kind, long size);
+char *alloc_str(char *s, long len);
+void free_arena(void);
+Arena *enter_arena(void);
+void leave_arena(Arena *arena);
+void release_arena(Arena *arena);
+void print_mem_report(char *input);
+
+//
+// server.c
+//
+
+Token *find_cached_file(char *path);
+void note_input_file(char *path);
+char *read_all(int fd);
+void run_server(char *path, int *argc, char ***argv);
+int run_client(char *path, int argc, char **argv);
+
+//
+// pch.c
+//
+
+void pch_put_long(long val);
+void pch_put_str(char *s);
+void pch_put_token(Token *tok);
+void pch_put_tokens(Token *tok);
+void pch_put_type(Type *ty);
+void pch_put_var(Var *var);
+void write_pch(char *path);
+
+long pch_get_long(void);
+char *pch_get_str(void);
+char *pch_get_name(void);
+Token *pch_get_token(void);
+Token *pch_get_tokens(void);
+Type *pch_get_type(void);
+Var *pch_get_var(void);
+void read_pch(char *path);
+
+//
+// cache.c
+//
+
+extern char *cache_dir;
+extern long cache_max_size;
+extern _Bool cache_stats;
+
+char *cache_key(Token *tok, char *hdr, long hdr_len);
+_Bool cache_lookup(char *key);
+void cache_store(char *key, char *p, long len);
+void print_cache_stats(void);
+
+//
+// hashmap.c
+//
+
+typedef struct {
+  char *key;
+  int keylen;
+  void *val;
+} HashEntry;
+
+typedef struct {
+  HashEntry *buckets;
+  int capacity;
+  int used;
+
+  // Statistics
+  long lookups;
+  long probes;
+} HashMap;
+
+void *hashmap_get(HashMap *map, char *key);
+void *hashmap_get2(HashMap *map, char *key, int keylen);
+void hashmap_put(HashMap *map, char *key, void *val);
+void hashmap_put2(HashMap *map, char *key, int keylen, void *val);
+void hashmap_delete(HashMap *map, char *key);
+void hashmap_delete2(HashMap *map, char *key, int keylen);
+
+//
+// main.c
+//
+
+extern _Bool preprocess_only;
+extern _Bool output_object;
+extern char *include_pch;
+// This file implements the output buffer for generated assembly.
+//
+// Codegen produces a very large number of short lines. Instead of
+// calling printf for each of them, we format lines ourselves into
+// an append-only buffer and hand the buffer to the kernel with
+// write(2) in large chunks.
+
+
+enum { FLUSH_SIZE = 1 << 20 };
+
+static int out_fd = 1;
+static char *buf;
+static long buf_len;
+static long buf_cap;
+
+// Total number of bytes produced so far.
+static long total_len;
+
+// If 1, output is kept in the buffer until it is taken by
+// take_output() instead of being written out.
+static _Bool capturing;
+
+// Opens the output file. If path is 0, output goes to stdout.
+void open_output(char *path) {
+  if (!path) {
+    out_fd = 1;
+    return;
+  }
+
+  out_fd = creat(path, 0644);
+  if (out_fd < 0)
+    error("cannot open output file %s: %s", path, strerror(*__errno_location()));
+}
+
+static void write_all(char *p, long len) {
+  while (len > 0) {
+    long n = write(out_fd, p, len);
+    if (n < 0) {
+      if (*__errno_location() == EINTR)
+        continue;
+      error("write failed: %s", strerror(*__errno_location()));
+    }
+    p += n;
+    len -= n;
+  }
+}
+
+// Writes the buffered output out to the output file.
+void flush_output(void) {
+  write_all(buf, buf_len);
+  buf_len = 0;
+}
+
+// Writes a given data to the output file.
+void write_output(char *p, long len) {
+  flush_output();
+  write_all(p, len);
+}
+
+static void put(char *s, long len) {
+  if (buf_len + len > buf_cap) {
+    while (buf_len + len > buf_cap)
+      buf_cap = buf_cap ? buf_cap * 2 : FLUSH_SIZE * 2;
+    buf = realloc(buf, buf_cap);
+  }
+  memcpy(buf + buf_len, s, len);
+  buf_len += len;
+  total_len += len;
+}
+
+// Keeps subsequent output in memory.
+void capture_output(void) {
+  capturing = 1;
+}
+
+// Returns the captured output as a null-terminated string.
+char *take_output(void) {
+  put("", 1);
+  char *p = buf;
+  buf = 0;
+  buf_len = buf_cap = 0;
+  capturing = 0;
+  return p;
+}
+
+static void put_long(long val, _Bool plus) {
+  char tmp[24];
+  int i = sizeof(tmp);
+  unsigned long u = val;
+  if (val < 0)
+    u = -u;
+
+  do {
+    tmp[--i] = '0' + u % 10;
+    u /= 10;
+  } while (u);
+
+  if (val < 0)
+    tmp[--i] = '-';
+  else if (plus)
+    tmp[--i] = '+';
+  put(tmp + i, sizeof(tmp) - i);
+}
+
+// punyc doesn't support va_arg() yet, so we fetch integer-class
+// arguments right out of the va_list as defined by the x86-64 psABI:
+// the first six come from the register save area and the rest from
+// the overflow area on the stack.
+static long next_arg(va_list ap) {
+  if (ap->gp_offset < 48) {
+    long *p = (long *)((char *)ap->reg_save_area + ap->gp_offset);
+    ap->gp_offset += 8;
+    return *p;
+  }
+
+  long *p = ap->overflow_arg_area;
+  ap->overflow_arg_area = p + 1;
+  return *p;
+}
+
+// A tiny replacement for vprintf. Supported conversions are %s,
+// %.*s, %d, %ld, %+ld and %%, which are all that we need.
+static void format(char *fmt, va_list ap) {
+  char *p = fmt;
+
+  for (;;) {
+    char *start = p;
+    while (*p && *p != '%')
+      p++;
+    if (start < p)
+      put(start, p - start);
+    if (*p == '\0')
+      return;
+    p++;
+
+    if (*p == '%') {
+      put(p++, 1);
+      continue;
+    }
+
+    if (*p == 's') {
+      char *s = (char *)next_arg(ap);
+      put(s, strlen(s));
+      p++;
+      continue;
+    }
+
+    if (!strncmp(p, ".*s", 3)) {
+      int len = next_arg(ap);
+      put((char *)next_arg(ap), len);
+      p += 3;
+      continue;
+    }
+
+    if (*p == 'd') {
+      put_long((int)next_arg(ap), 0);
+      p++;
+      continue;
+    }
+
+    if (!strncmp(p, "ld", 2)) {
+      put_long(next_arg(ap), 0);
+      p += 2;
+      continue;
+    }
+
+    if (!strncmp(p, "+ld", 3)) {
+      put_long(next_arg(ap), 1);
+      p += 3;
+      continue;
+    }
+
+    error("internal error: unsupported format: %s", fmt);
+  }
+}
+
+// Appends formatted text to the output.
+void emitf(char *fmt, ...) {
+  va_list ap;
+  __builtin_va_start(ap, fmt);
+  format(fmt, ap);
+  va_end(ap);
+}
+
+// Appends a formatted line to the output.
+void println(char *fmt, ...) {
+  va_list ap;
+  __builtin_va_start(ap, fmt);
+  format(fmt, ap);
+  va_end(ap);
+  put("\n", 1);
+
+  if (buf_len >= FLUSH_SIZE && !capturing)
+    flush_output();
+}
+
+// Returns the number of bytes produced so far.
+long output_size(void) {
+  return total_len;
+}
+
+// Returns the output produced since output_size() returned `pos`.
+// This is valid only while output is being captured.
+char *output_since(long pos) {
+  assert(capturing);
+  return buf + buf_len - (total_len - pos);
+}
@@ -0,0 +1,2405 @@
+.file 1 "emit.c"
+.intel_syntax noprefix
+.bss
+.align 1
+capturing:
+  .zero 1
+.align 8
+total_len:
+  .zero 8
+.align 8
+buf_cap:
+  .zero 8
+.align 8
+buf_len:
+  .zero 8
+.align 8
+buf:
+  .zero 8
+.data
+.align 1
+.L.data.7:
+  .byte 10
+  .zero 1
+.align 1
+.L.data.6:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 110
+  .byte 97
+  .byte 108
+  .byte 32
+  .byte 101
+  .byte 114
+  .byte 114
+  .byte 111
+  .byte 114
+  .byte 58
+  .byte 32
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 117
+  .byte 112
+  .byte 112
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 109
+  .byte 97
+  .byte 116
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.5:
+  .byte 43
+  .byte 108
+  .byte 100
+  .zero 1
+.align 1
+.L.data.4:
+  .byte 108
+  .byte 100
+  .zero 1
+.align 1
+.L.data.3:
+  .byte 46
+  .byte 42
+  .byte 115
+  .zero 1
+.align 1
+.L.data.2:
+  .zero 1
+.align 1
+.L.data.1:
+  .byte 119
+  .byte 114
+  .byte 105
+  .byte 116
+  .byte 101
+  .byte 32
+  .byte 102
+  .byte 97
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 100
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.0:
+  .byte 99
+  .byte 97
+  .byte 110
+  .byte 110
+  .byte 111
+  .byte 116
+  .byte 32
+  .byte 111
+  .byte 112
+  .byte 101
+  .byte 110
+  .byte 32
+  .byte 111
+  .byte 117
+  .byte 116
+  .byte 112
+  .byte 117
+  .byte 116
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 4
+out_fd:
+  .long 1
+.text
+assert:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.L.return.assert:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+va_end:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.L.return.va_end:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl open_output
+open_output:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 760 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.open_output.1
+.loc 1 761 5
+  mov r10, 1
+  mov r10d, r10d
+  mov r11, offset out_fd
+  mov [r11], r10d
+.loc 1 762 5
+  jmp .L.return.open_output
+.L.end.open_output.1:
+.loc 1 765 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 420
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset creat
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  mov r11, offset out_fd
+  mov [r11], r10d
+.loc 1 766 3
+  mov r10, offset out_fd
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.open_output.2
+.loc 1 767 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.0
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset __errno_location
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset strerror
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.open_output.2:
+.L.return.open_output:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+write_all:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-64], rsi
+  mov [rbp-72], rdi
+.loc 1 771 3
+.L.begin.write_all.1:
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.break.write_all.1
+.loc 1 772 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset out_fd
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset write
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 773 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  movsx r11, r11d
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.write_all.2
+.loc 1 774 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset __errno_location
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.write_all.3
+.loc 1 775 9
+  jmp .L.continue.write_all.1
+.L.end.write_all.3:
+.loc 1 776 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.1
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset __errno_location
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset strerror
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.write_all.2:
+.loc 1 778 5
+  lea r10, [rbp-72]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov r12, 1
+  movsx r12, r12d
+  imul r11, r12
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 779 5
+  lea r10, [rbp-64]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  sub r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+.L.continue.write_all.1:
+  jmp .L.begin.write_all.1
+.L.break.write_all.1:
+.L.return.write_all:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl flush_output
+flush_output:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 785 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset buf
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_len
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset write_all
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 786 3
+  mov r10, 0
+  movsx r10, r10d
+  mov r11, offset buf_len
+  mov [r11], r10
+.L.return.flush_output:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl write_output
+write_output:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rsi
+  mov [rbp-48], rdi
+.loc 1 791 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset flush_output
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 792 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset write_all
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.write_output:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+put:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-56], rsi
+  mov [rbp-64], rdi
+.loc 1 796 3
+  mov r10, offset buf_cap
+  mov r10, [r10]
+  mov r11, offset buf_len
+  mov r11, [r11]
+  lea r12, [rbp-56]
+  mov r12, [r12]
+  add r11, r12
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.put.1
+.loc 1 797 5
+.L.begin.put.2:
+  mov r10, offset buf_cap
+  mov r10, [r10]
+  mov r11, offset buf_len
+  mov r11, [r11]
+  lea r12, [rbp-56]
+  mov r12, [r12]
+  add r11, r12
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.break.put.2
+.loc 1 798 7
+  mov r10, offset buf_cap
+  mov r10, [r10]
+  cmp r10, 0
+  je  .L.else.put.3
+  mov r10, offset buf_cap
+  mov r10, [r10]
+  mov r11, 2
+  movsx r11, r11d
+  imul r10, r11
+  jmp .L.end.put.3
+.L.else.put.3:
+  mov r10, 1048576
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  imul r10d, r11d
+  movsx r10, r10d
+.L.end.put.3:
+  mov r11, offset buf_cap
+  mov [r11], r10
+.L.continue.put.2:
+  jmp .L.begin.put.2
+.L.break.put.2:
+.loc 1 799 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset buf
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset buf_cap
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset realloc
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r11, offset buf
+  mov [r11], r10
+.L.end.put.1:
+.loc 1 801 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset buf
+  mov r10, [r10]
+  mov r11, offset buf_len
+  mov r11, [r11]
+  mov r12, 1
+  movsx r12, r12d
+  imul r11, r12
+  add r10, r11
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset memcpy
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 802 3
+  mov r10, offset buf_len
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 803 3
+  mov r10, offset total_len
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+.L.return.put:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl capture_output
+capture_output:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 808 3
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov r11, offset capturing
+  mov [r11], r10b
+.L.return.capture_output:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl take_output
+take_output:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 813 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.2
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset put
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 814 16
+  mov r10, offset buf
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 815 3
+  mov r10, 0
+  movsx r10, r10d
+  mov r11, offset buf
+  mov [r11], r10
+.loc 1 816 3
+  mov r10, 0
+  movsx r10, r10d
+  mov r11, offset buf_cap
+  mov [r11], r10
+  mov r11, offset buf_len
+  mov [r11], r10
+.loc 1 817 3
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov r11, offset capturing
+  mov [r11], r10b
+.loc 1 818 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.take_output
+.L.return.take_output:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+put_long:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 112
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-101], sil
+  mov [rbp-112], rdi
+.loc 1 822 15
+.loc 1 823 22
+  movabs r10, 24
+  mov r10d, r10d
+  lea r11, [rbp-76]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 824 24
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 825 3
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  mov r11, 0
+  movsx r11, r11d
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.put_long.1
+.loc 1 826 5
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  sub r10, r11
+  lea r11, [rbp-72]
+  mov [r11], r10
+.L.end.put_long.1:
+.loc 1 828 3
+.L.begin.put_long.2:
+.loc 1 829 5
+  mov r10, 48
+  movsx r10, r10d
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  mov r12, 10
+  movsx r12, r12d
+  mov rax, r11
+  mov rdx, 0
+  div r12
+  mov r11, rdx
+  add r10, r11
+  movsx r10, r10b
+  lea r11, [rbp-100]
+  lea r12, [rbp-76]
+  lea r13, [rbp-64]
+  mov [r13], r12
+  lea r12, [rbp-64]
+  mov r12, [r12]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  sub r12d, r13d
+  mov r12d, r12d
+  lea r13, [rbp-64]
+  mov r13, [r13]
+  mov [r13], r12d
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.loc 1 830 5
+  lea r10, [rbp-72]
+  lea r11, [rbp-56]
+  mov [r11], r10
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 10
+  movsx r11, r11d
+  mov rax, r10
+  mov rdx, 0
+  div r11
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10
+.L.continue.put_long.2:
+.loc 1 831 12
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  cmp r10, 0
+  jne .L.begin.put_long.2
+.L.break.put_long.2:
+.loc 1 833 3
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  mov r11, 0
+  movsx r11, r11d
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.else.put_long.3
+.loc 1 834 5
+  mov r10, 45
+  movsx r10, r10b
+  lea r11, [rbp-100]
+  lea r12, [rbp-76]
+  lea r13, [rbp-48]
+  mov [r13], r12
+  lea r12, [rbp-48]
+  mov r12, [r12]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  sub r12d, r13d
+  mov r12d, r12d
+  lea r13, [rbp-48]
+  mov r13, [r13]
+  mov [r13], r12d
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  jmp .L.end.put_long.3
+.L.else.put_long.3:
+.loc 1 835 8
+  lea r10, [rbp-101]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.put_long.4
+.loc 1 836 5
+  mov r10, 43
+  movsx r10, r10b
+  lea r11, [rbp-100]
+  lea r12, [rbp-76]
+  lea r13, [rbp-40]
+  mov [r13], r12
+  lea r12, [rbp-40]
+  mov r12, [r12]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  sub r12d, r13d
+  mov r12d, r12d
+  lea r13, [rbp-40]
+  mov r13, [r13]
+  mov [r13], r12d
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.L.end.put_long.4:
+.L.end.put_long.3:
+.loc 1 837 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-100]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  movabs r10, 24
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  movsx r11, r11d
+  sub r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset put
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.put_long:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+next_arg:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-64], rdi
+.loc 1 845 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 48
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.next_arg.1
+.loc 1 846 5
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 0
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 847 5
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 0
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10d
+.loc 1 848 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.next_arg
+.L.end.next_arg.1:
+.loc 1 851 34
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 852 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 853 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.next_arg
+.L.return.next_arg:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+format:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 144
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-136], rsi
+  mov [rbp-144], rdi
+.loc 1 859 16
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  lea r11, [rbp-128]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 861 3
+.L.begin.format.1:
+.loc 1 862 5
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  lea r11, [rbp-120]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 863 5
+.L.begin.format.2:
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.false.format.3
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 37
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.format.3
+  mov r10, 1
+  jmp .L.end.format.3
+.L.false.format.3:
+  mov r10, 0
+.L.end.format.3:
+  cmp r10, 0
+  je .L.break.format.2
+.loc 1 864 7
+  lea r10, [rbp-128]
+  lea r11, [rbp-112]
+  mov [r11], r10
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+.L.continue.format.2:
+  jmp .L.begin.format.2
+.L.break.format.2:
+.loc 1 865 5
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.format.4
+.loc 1 866 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  lea r11, [rbp-120]
+  mov r11, [r11]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset put
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.format.4:
+.loc 1 867 5
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.format.5
+.loc 1 868 7
+  jmp .L.return.format
+.L.end.format.5:
+.loc 1 869 5
+  lea r10, [rbp-128]
+  lea r11, [rbp-104]
+  mov [r11], r10
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+.loc 1 871 5
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 37
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.format.6
+.loc 1 872 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  lea r11, [rbp-96]
+  mov [r11], r10
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-96]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset put
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 873 7
+  jmp .L.continue.format.1
+.L.end.format.6:
+.loc 1 876 5
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 115
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.format.7
+.loc 1 877 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next_arg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-88]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 878 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strlen
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset put
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 879 7
+  lea r10, [rbp-128]
+  lea r11, [rbp-80]
+  mov [r11], r10
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+.loc 1 880 7
+  jmp .L.continue.format.1
+.L.end.format.7:
+.loc 1 883 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.3
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  push r10
+  sub rsp, 8
+  mov r10, offset strncmp
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.format.8
+.loc 1 884 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next_arg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-68]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 885 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next_arg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset put
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 886 7
+  lea r10, [rbp-128]
+  lea r11, [rbp-64]
+  mov [r11], r10
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 3
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 887 7
+  jmp .L.continue.format.1
+.L.end.format.8:
+.loc 1 890 5
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 100
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.format.9
+.loc 1 891 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next_arg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset put_long
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 892 7
+  lea r10, [rbp-128]
+  lea r11, [rbp-56]
+  mov [r11], r10
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+.loc 1 893 7
+  jmp .L.continue.format.1
+.L.end.format.9:
+.loc 1 896 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.4
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset strncmp
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.format.10
+.loc 1 897 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next_arg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset put_long
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 898 7
+  lea r10, [rbp-128]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 899 7
+  jmp .L.continue.format.1
+.L.end.format.10:
+.loc 1 902 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.5
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  push r10
+  sub rsp, 8
+  mov r10, offset strncmp
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.format.11
+.loc 1 903 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next_arg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset put_long
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 904 7
+  lea r10, [rbp-128]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 3
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 905 7
+  jmp .L.continue.format.1
+.L.end.format.11:
+.loc 1 908 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.6
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.format.1:
+  jmp .L.begin.format.1
+.L.break.format.1:
+.L.return.format:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl emitf
+emitf:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 128
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-88], rdi
+  mov [rbp-80], rsi
+  mov [rbp-72], rdx
+  mov [rbp-64], rcx
+  mov [rbp-56], r8
+  mov [rbp-48], r9
+  mov dword ptr [rbp-40], 8
+  mov [rbp-120], rdi
+.loc 1 914 13
+.loc 1 915 3
+  lea r10, [rbp-112]
+  mov eax, [rbp-40]
+  mov [r10], eax
+  lea rax, [rbp-88]
+  mov [r10+16], rax
+.loc 1 916 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-112]
+  push r10
+  sub rsp, 8
+  mov r10, offset format
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 917 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-112]
+  push r10
+  sub rsp, 8
+  mov r10, offset va_end
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.emitf:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl println
+println:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 128
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-88], rdi
+  mov [rbp-80], rsi
+  mov [rbp-72], rdx
+  mov [rbp-64], rcx
+  mov [rbp-56], r8
+  mov [rbp-48], r9
+  mov dword ptr [rbp-40], 8
+  mov [rbp-120], rdi
+.loc 1 922 13
+.loc 1 923 3
+  lea r10, [rbp-112]
+  mov eax, [rbp-40]
+  mov [r10], eax
+  lea rax, [rbp-88]
+  mov [r10+16], rax
+.loc 1 924 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-112]
+  push r10
+  sub rsp, 8
+  mov r10, offset format
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 925 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-112]
+  push r10
+  sub rsp, 8
+  mov r10, offset va_end
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 926 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.7
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset put
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 928 3
+  mov r10, 1048576
+  movsx r10, r10d
+  mov r11, offset buf_len
+  mov r11, [r11]
+  cmp r10, r11
+  setle al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.println.2
+  mov r10, offset capturing
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.println.2
+  mov r10, 1
+  jmp .L.end.println.2
+.L.false.println.2:
+  mov r10, 0
+.L.end.println.2:
+  cmp r10, 0
+  je .L.end.println.1
+.loc 1 929 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset flush_output
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.println.1:
+.L.return.println:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl output_size
+output_size:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 934 3
+  mov r10, offset total_len
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.output_size
+.L.return.output_size:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl output_since
+output_since:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 940 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset capturing
+  movsx r10d, byte ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 941 3
+  mov r10, offset buf
+  mov r10, [r10]
+  mov r11, offset buf_len
+  mov r11, [r11]
+  mov r12, 1
+  movsx r12, r12d
+  imul r11, r12
+  add r10, r11
+  mov r11, offset total_len
+  mov r11, [r11]
+  lea r12, [rbp-40]
+  mov r12, [r12]
+  sub r11, r12
+  mov r12, 1
+  movsx r12, r12d
+  imul r11, r12
+  sub r10, r11
+  mov rax, r10
+  jmp .L.return.output_since
+.L.return.output_since:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
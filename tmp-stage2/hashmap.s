@@ -0,0 +1,2101 @@
+.file 1 "hashmap.c"
+.intel_syntax noprefix
+.bss
+.data
+.align 1
+.L.data.1:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 110
+  .byte 97
+  .byte 108
+  .byte 32
+  .byte 101
+  .byte 114
+  .byte 114
+  .byte 111
+  .byte 114
+  .byte 58
+  .byte 32
+  .byte 104
+  .byte 97
+  .byte 115
+  .byte 104
+  .byte 109
+  .byte 97
+  .byte 112
+  .byte 32
+  .byte 105
+  .byte 115
+  .byte 32
+  .byte 102
+  .byte 117
+  .byte 108
+  .byte 108
+  .zero 1
+.align 1
+.L.data.0:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 110
+  .byte 97
+  .byte 108
+  .byte 32
+  .byte 101
+  .byte 114
+  .byte 114
+  .byte 111
+  .byte 114
+  .byte 58
+  .byte 32
+  .byte 104
+  .byte 97
+  .byte 115
+  .byte 104
+  .byte 109
+  .byte 97
+  .byte 112
+  .byte 32
+  .byte 105
+  .byte 115
+  .byte 32
+  .byte 102
+  .byte 117
+  .byte 108
+  .byte 108
+  .zero 1
+.align 8
+TOMBSTONE:
+  .quad -1
+.text
+assert:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.L.return.assert:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+va_end:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.L.return.va_end:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+fnv_hash:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-76], esi
+  mov [rbp-88], rdi
+.loc 1 755 42
+  movabs r10, -3750763034362895579
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 756 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-60]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.fnv_hash.1:
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.fnv_hash.1
+.loc 1 757 5
+  lea r10, [rbp-72]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  lea r12, [rbp-60]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  movsx r11d, byte ptr [r11]
+  movzx r11, r11b
+  xor r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 758 5
+  lea r10, [rbp-72]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  movabs r11, 1099511628211
+  imul r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+.L.continue.fnv_hash.1:
+.loc 1 756 28
+  lea r10, [rbp-60]
+  lea r11, [rbp-56]
+  mov [r11], r10
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.fnv_hash.1
+.L.break.fnv_hash.1:
+.loc 1 760 3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  mov r12, 32
+  mov rcx, r12
+  shr r11, cl
+  xor r10, r11
+  mov rax, r10
+  jmp .L.return.fnv_hash
+.L.return.fnv_hash:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+rehash:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 128
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-128], rdi
+.loc 1 767 16
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-120]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 768 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-116]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.rehash.1:
+  lea r10, [rbp-116]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  add r11, 8
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.rehash.1
+.loc 1 769 5
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-116]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 24
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.rehash.3
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-116]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 24
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r10, [r10]
+  mov r11, offset TOMBSTONE
+  mov r11, [r11]
+  cmp r10, r11
+  setne al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.rehash.3
+  mov r10, 1
+  jmp .L.end.rehash.3
+.L.false.rehash.3:
+  mov r10, 0
+.L.end.rehash.3:
+  cmp r10, 0
+  je .L.end.rehash.2
+.loc 1 770 7
+  lea r10, [rbp-120]
+  lea r11, [rbp-104]
+  mov [r11], r10
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.end.rehash.2:
+.L.continue.rehash.1:
+.loc 1 768 38
+  lea r10, [rbp-116]
+  lea r11, [rbp-112]
+  mov [r11], r10
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.rehash.1
+.L.break.rehash.1:
+.loc 1 772 26
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-92]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 773 3
+.L.begin.rehash.4:
+  mov r10, 50
+  mov r10d, r10d
+  lea r11, [rbp-120]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 100
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  lea r12, [rbp-92]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov eax, r11d
+  cdq
+  idiv r12d
+  mov r11d, eax
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.rehash.4
+.loc 1 774 5
+  lea r10, [rbp-92]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  imul r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-92]
+  mov [r11], r10d
+.L.continue.rehash.4:
+  jmp .L.begin.rehash.4
+.L.break.rehash.4:
+.loc 1 775 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-92]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 778 20
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-88]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-88]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-88]
+  mov r12, 12
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-88]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-88]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 779 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-92]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 24
+  push r10
+  sub rsp, 8
+  mov r10, offset calloc
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-88]
+  add r11, 0
+  mov [r11], r10
+.loc 1 780 3
+  lea r10, [rbp-92]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-88]
+  add r11, 8
+  mov [r11], r10d
+.loc 1 782 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.rehash.5:
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  add r11, 8
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.rehash.5
+.loc 1 783 5
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 24
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 784 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.rehash.7
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  mov r11, offset TOMBSTONE
+  mov r11, [r11]
+  cmp r10, r11
+  setne al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.rehash.7
+  mov r10, 1
+  jmp .L.end.rehash.7
+.L.false.rehash.7:
+  mov r10, 0
+.L.end.rehash.7:
+  cmp r10, 0
+  je .L.end.rehash.6
+.loc 1 785 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_put2
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.rehash.6:
+.L.continue.rehash.5:
+.loc 1 782 38
+  lea r10, [rbp-52]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.rehash.5
+.L.break.rehash.5:
+.loc 1 788 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  add r10, 12
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-120]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 789 3
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-88]
+  add r11, 16
+  mov [r11], r10
+.loc 1 790 3
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  lea r11, [rbp-88]
+  add r11, 24
+  mov [r11], r10
+.loc 1 791 3
+  lea r10, [rbp-88]
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  mov al, [r10+0]
+  mov [r11+0], al
+  mov al, [r10+1]
+  mov [r11+1], al
+  mov al, [r10+2]
+  mov [r11+2], al
+  mov al, [r10+3]
+  mov [r11+3], al
+  mov al, [r10+4]
+  mov [r11+4], al
+  mov al, [r10+5]
+  mov [r11+5], al
+  mov al, [r10+6]
+  mov [r11+6], al
+  mov al, [r10+7]
+  mov [r11+7], al
+  mov al, [r10+8]
+  mov [r11+8], al
+  mov al, [r10+9]
+  mov [r11+9], al
+  mov al, [r10+10]
+  mov [r11+10], al
+  mov al, [r10+11]
+  mov [r11+11], al
+  mov al, [r10+12]
+  mov [r11+12], al
+  mov al, [r10+13]
+  mov [r11+13], al
+  mov al, [r10+14]
+  mov [r11+14], al
+  mov al, [r10+15]
+  mov [r11+15], al
+  mov al, [r10+16]
+  mov [r11+16], al
+  mov al, [r10+17]
+  mov [r11+17], al
+  mov al, [r10+18]
+  mov [r11+18], al
+  mov al, [r10+19]
+  mov [r11+19], al
+  mov al, [r10+20]
+  mov [r11+20], al
+  mov al, [r10+21]
+  mov [r11+21], al
+  mov al, [r10+22]
+  mov [r11+22], al
+  mov al, [r10+23]
+  mov [r11+23], al
+  mov al, [r10+24]
+  mov [r11+24], al
+  mov al, [r10+25]
+  mov [r11+25], al
+  mov al, [r10+26]
+  mov [r11+26], al
+  mov al, [r10+27]
+  mov [r11+27], al
+  mov al, [r10+28]
+  mov [r11+28], al
+  mov al, [r10+29]
+  mov [r11+29], al
+  mov al, [r10+30]
+  mov [r11+30], al
+  mov al, [r10+31]
+  mov [r11+31], al
+.L.return.rehash:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+match:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-36], edx
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 795 3
+.loc 1 796 32
+.loc 1 795 44
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.match.3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  mov r11, offset TOMBSTONE
+  mov r11, [r11]
+  cmp r10, r11
+  setne al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.match.3
+  mov r10, 1
+  jmp .L.end.match.3
+.L.false.match.3:
+  mov r10, 0
+.L.end.match.3:
+  cmp r10, 0
+  je .L.false.match.2
+.loc 1 796 22
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.match.2
+  mov r10, 1
+  jmp .L.end.match.2
+.L.false.match.2:
+  mov r10, 0
+.L.end.match.2:
+  cmp r10, 0
+  je .L.false.match.1
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset memcmp
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.match.1
+  mov r10, 1
+  jmp .L.end.match.1
+.L.false.match.1:
+  mov r10, 0
+.L.end.match.1:
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.match
+.L.return.match:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+get_entry:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 112
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-84], edx
+  mov [rbp-96], rsi
+  mov [rbp-104], rdi
+.loc 1 800 3
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.get_entry.1
+.loc 1 801 5
+  mov r10, 0
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.get_entry
+.L.end.get_entry.1:
+.loc 1 803 45
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-84]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset fnv_hash
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 804 3
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 16
+  lea r11, [rbp-72]
+  mov [r11], r10
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+.loc 1 806 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-60]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.get_entry.2:
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  add r11, 8
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.get_entry.2
+.loc 1 807 5
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  lea r12, [rbp-60]
+  mov r12d, dword ptr [r12]
+  movsx r12, r12d
+  add r11, r12
+  lea r12, [rbp-104]
+  mov r12, [r12]
+  add r12, 8
+  mov r12d, dword ptr [r12]
+  movsx r12, r12d
+  mov rax, r11
+  mov rdx, 0
+  div r12
+  mov r11, rdx
+  mov r12, 24
+  movsx r12, r12d
+  imul r11, r12
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 808 5
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 24
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+.loc 1 809 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-84]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset match
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.get_entry.3
+.loc 1 810 7
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.get_entry
+.L.end.get_entry.3:
+.loc 1 811 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  mov r11, 0
+  movsx r11, r11d
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.get_entry.4
+.loc 1 812 7
+  mov r10, 0
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.get_entry
+.L.end.get_entry.4:
+.L.continue.get_entry.2:
+.loc 1 806 38
+  lea r10, [rbp-60]
+  lea r11, [rbp-56]
+  mov [r11], r10
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.get_entry.2
+.L.break.get_entry.2:
+.loc 1 814 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.0
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.get_entry:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+get_or_insert_entry:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 128
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-100], edx
+  mov [rbp-112], rsi
+  mov [rbp-120], rdi
+.loc 1 818 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.else.get_or_insert_entry.1
+.loc 1 819 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 16
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 24
+  push r10
+  sub rsp, 8
+  mov r10, offset calloc
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-120]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 820 5
+  mov r10, 16
+  mov r10d, r10d
+  lea r11, [rbp-120]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10d
+  jmp .L.end.get_or_insert_entry.1
+.L.else.get_or_insert_entry.1:
+.loc 1 821 10
+  mov r10, 70
+  mov r10d, r10d
+  lea r11, [rbp-120]
+  mov r11, [r11]
+  add r11, 12
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 100
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  lea r12, [rbp-120]
+  mov r12, [r12]
+  add r12, 8
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov eax, r11d
+  cdq
+  idiv r12d
+  mov r11d, eax
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.get_or_insert_entry.2
+.loc 1 822 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset rehash
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.get_or_insert_entry.2:
+.L.end.get_or_insert_entry.1:
+.loc 1 825 45
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-100]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset fnv_hash
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-96]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 826 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 16
+  lea r11, [rbp-88]
+  mov [r11], r10
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+.loc 1 830 22
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 832 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-68]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.get_or_insert_entry.3:
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-120]
+  mov r11, [r11]
+  add r11, 8
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.get_or_insert_entry.3
+.loc 1 833 5
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-96]
+  mov r11, [r11]
+  lea r12, [rbp-68]
+  mov r12d, dword ptr [r12]
+  movsx r12, r12d
+  add r11, r12
+  lea r12, [rbp-120]
+  mov r12, [r12]
+  add r12, 8
+  mov r12d, dword ptr [r12]
+  movsx r12, r12d
+  mov rax, r11
+  mov rdx, 0
+  div r12
+  mov r11, rdx
+  mov r12, 24
+  movsx r12, r12d
+  imul r11, r12
+  add r10, r11
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 834 5
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 24
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+.loc 1 836 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-100]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset match
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.get_or_insert_entry.4
+.loc 1 837 7
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.get_or_insert_entry
+.L.end.get_or_insert_entry.4:
+.loc 1 839 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  mov r11, offset TOMBSTONE
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.get_or_insert_entry.5
+.loc 1 840 7
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.get_or_insert_entry.6
+.loc 1 841 9
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov [r11], r10
+.L.end.get_or_insert_entry.6:
+.loc 1 842 7
+  jmp .L.continue.get_or_insert_entry.3
+.L.end.get_or_insert_entry.5:
+.loc 1 845 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  mov r11, 0
+  movsx r11, r11d
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.get_or_insert_entry.7
+.loc 1 846 7
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.else.get_or_insert_entry.8
+.loc 1 847 9
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov [r11], r10
+  jmp .L.end.get_or_insert_entry.8
+.L.else.get_or_insert_entry.8:
+.loc 1 849 9
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 12
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.end.get_or_insert_entry.8:
+.loc 1 850 7
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 851 7
+  lea r10, [rbp-100]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10d
+.loc 1 852 7
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.get_or_insert_entry
+.L.end.get_or_insert_entry.7:
+.L.continue.get_or_insert_entry.3:
+.loc 1 832 38
+  lea r10, [rbp-68]
+  lea r11, [rbp-64]
+  mov [r11], r10
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.get_or_insert_entry.3
+.L.break.get_or_insert_entry.3:
+.loc 1 856 3
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.get_or_insert_entry.9
+.loc 1 857 5
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 858 5
+  lea r10, [rbp-100]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10d
+.loc 1 859 5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.get_or_insert_entry
+.L.end.get_or_insert_entry.9:
+.loc 1 861 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.1
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.get_or_insert_entry:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl hashmap_get
+hashmap_get:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rsi
+  mov [rbp-48], rdi
+.loc 1 865 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strlen
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_get2
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.hashmap_get
+.L.return.hashmap_get:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl hashmap_get2
+hashmap_get2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-44], edx
+  mov [rbp-56], rsi
+  mov [rbp-64], rdi
+.loc 1 869 47
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset get_entry
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 870 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je  .L.else.hashmap_get2.1
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  jmp .L.end.hashmap_get2.1
+.L.else.hashmap_get2.1:
+  mov r10, 0
+  movsx r10, r10d
+.L.end.hashmap_get2.1:
+  mov rax, r10
+  jmp .L.return.hashmap_get2
+.L.return.hashmap_get2:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl hashmap_put
+hashmap_put:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdx
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 874 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strlen
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_put2
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.hashmap_put:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl hashmap_put2
+hashmap_put2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rcx
+  mov [rbp-52], edx
+  mov [rbp-64], rsi
+  mov [rbp-72], rdi
+.loc 1 878 57
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset get_or_insert_entry
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 879 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.L.return.hashmap_put2:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl hashmap_delete
+hashmap_delete:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rsi
+  mov [rbp-48], rdi
+.loc 1 883 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strlen
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_delete2
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.hashmap_delete:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl hashmap_delete2
+hashmap_delete2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-44], edx
+  mov [rbp-56], rsi
+  mov [rbp-64], rdi
+.loc 1 887 47
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset get_entry
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 888 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.hashmap_delete2.1
+.loc 1 889 5
+  mov r10, offset TOMBSTONE
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 890 5
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.L.end.hashmap_delete2.1:
+.L.return.hashmap_delete2:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,1124 @@
+typedef struct FILE FILE;
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+typedef struct {
+  int gp_offset;
+  int fp_offset;
+  void *overflow_arg_area;
+  void *reg_save_area;
+} va_list[1];
+
+struct timespec {
+  long tv_sec;
+  long tv_nsec;
+};
+
+struct rusage {
+  long ru_utime[2];
+  long ru_stime[2];
+  long ru_maxrss;
+  long ru_reserved[13];
+};
+
+struct stat {
+  unsigned long st_dev;
+  unsigned long st_ino;
+  unsigned long st_nlink;
+  unsigned int st_mode;
+  unsigned int st_uid;
+  unsigned int st_gid;
+  int __pad0;
+  unsigned long st_rdev;
+  long st_size;
+  long st_blksize;
+  long st_blocks;
+  struct timespec st_atim;
+  struct timespec st_mtim;
+  struct timespec st_ctim;
+  long __reserved[3];
+};
+
+struct sockaddr_un {
+  unsigned short sun_family;
+  char sun_path[108];
+};
+
+struct iovec {
+  void *iov_base;
+  long iov_len;
+};
+
+struct msghdr {
+  void *msg_name;
+  int msg_namelen;
+  struct iovec *msg_iov;
+  long msg_iovlen;
+  void *msg_control;
+  long msg_controllen;
+  int msg_flags;
+};
+
+struct pollfd {
+  int fd;
+  short events;
+  short revents;
+};
+
+typedef struct DIR DIR;
+
+struct dirent {
+  unsigned long d_ino;
+  long d_off;
+  unsigned short d_reclen;
+  unsigned char d_type;
+  char d_name[256];
+};
+
+enum { EINTR = 4 };
+enum { O_RDONLY = 0, O_WRONLY = 1, O_RDWR = 2, O_CREAT = 64, O_TRUNC = 512 };
+enum { LOCK_EX = 2 };
+enum { S_IFMT = 61440, S_IFREG = 32768 };
+enum { PROT_READ = 1, PROT_WRITE = 2 };
+enum { MAP_PRIVATE = 2, MAP_FIXED = 16, MAP_ANONYMOUS = 32, MAP_POPULATE = 32768 };
+enum { _SC_PAGESIZE = 30 };
+enum { AF_UNIX = 1, SOCK_STREAM = 1, SOL_SOCKET = 1, SCM_RIGHTS = 1 };
+enum { MSG_CTRUNC = 8, MSG_NOSIGNAL = 16384 };
+enum { POLLIN = 1 };
+enum { RUSAGE_SELF = 0 };
+enum { CLOCK_MONOTONIC = 1, CLOCK_PROCESS_CPUTIME_ID = 2 };
+
+void *malloc(long size);
+void *calloc(long nmemb, long size);
+void *realloc(void *buf, long size);
+int *__errno_location();
+char *strerror(int errnum);
+FILE *fopen(char *pathname, char *mode);
+long fread(void *ptr, long size, long nmemb, FILE *stream);
+int fclose(FILE *fp);
+int feof(FILE *stream);
+static void assert() {}
+int strcmp(char *s1, char *s2);
+int strncasecmp(char *s1, char *s2);
+int printf(char *fmt, ...);
+int sprintf(char *buf, char *fmt, ...);
+int fprintf(FILE *fp, char *fmt, ...);
+int vfprintf(FILE *fp, char *fmt, va_list ap);
+long strlen(char *p);
+int strncmp(char *p, char *q);
+void *memvpy(char *dst, char *src, long n);
+char *strndup(char *p, long n);
+int isspace(int c);
+int ispunct(int c);
+int isdigit(int c);
+char *strstr(char *haystack, char *needle);
+static void va_end(va_list ap) {}
+long strtoul(char *nptr, char **endptr, int base);
+char *strncpy(char *dest, char *src, long n);
+void exit(int code);
+int atoi(char *nptr);
+char *strrchr(char *s, int c);
+int fflush(FILE *stream);
+int fork(void);
+int waitpid(int pid, int *status, int options);
+int unlink(char *pathname);
+int creat(char *pathname, int mode);
+void *memset(void *s, int c, long n);
+int memcmp(void *s1, void *s2, long n);
+char *strchr(char *s, int c);
+long strtol(char *nptr, char **endptr, int base);
+long write(int fd, void *buf, long count);
+void *memcpy(void *dst, void *src, long n);
+int clock_gettime(int clockid, struct timespec *tp);
+int getrusage(int who, struct rusage *usage);
+void free(void *ptr);
+char *strcpy(char *dest, char *src);
+long read(int fd, void *buf, long count);
+int close(int fd);
+int dup2(int oldfd, int newfd);
+int pipe(int *pipefd);
+int chdir(char *path);
+char *getcwd(char *buf, long size);
+char *realpath(char *path, char *resolved_path);
+int stat(char *path, struct stat *buf);
+int socket(int domain, int type, int protocol);
+int bind(int fd, struct sockaddr *addr, int len);
+int listen(int fd, int backlog);
+int accept(int fd, struct sockaddr *addr, int *len);
+int connect(int fd, struct sockaddr *addr, int len);
+long send(int fd, void *buf, long len, int flags);
+long sendmsg(int fd, struct msghdr *msg, int flags);
+long recvmsg(int fd, struct msghdr *msg, int flags);
+int poll(struct pollfd *fds, long nfds, int timeout);
+int open(char *path, int flags, ...);
+int fstat(int fd, struct stat *buf);
+int flock(int fd, int op);
+void *mmap(void *addr, long len, int prot, int flags, int fd, long off);
+int munmap(void *addr, long len);
+long sysconf(int name);
+long pread(int fd, void *buf, long count, long offset);
+long pwrite(int fd, void *buf, long count, long offset);
+int ftruncate(int fd, long length);
+int getpid(void);
+int rename(char *oldpath, char *newpath);
+int mkdir(char *path, int mode);
+int utime(char *path, void *times);
+DIR *opendir(char *name);
+struct dirent *readdir(DIR *dirp);
+int closedir(DIR *dirp);
+
+typedef struct Type Type;
+typedef struct Member Member;
+typedef struct GvarInitializer GvarInitializer;
+
+//
+// tokenize.c
+//
+
+// Token
+typedef enum {
+  TK_RESERVED, // Keyworeds or punctuators
+  TK_IDENT,    // Identifiers
+  TK_STR,      // String literals
+  TK_NUM,      // Integer literals
+  TK_EOF,      // End-of-file markers
+} TokenKind;
+
+// Keywords, preprocessor directive names and punctuators are given
+// an ID by the tokenizer, so that they can be compared as integers.
+// The order must match `token_names` in tokenize.c.
+typedef enum {
+  ID_NONE,
+
+  // Keywords
+  KW_RETURN, KW_IF, KW_ELSE, KW_FOR, KW_WHILE, KW_INT, KW_SIZEOF,
+  KW_CHAR, KW_STRUCT, KW_UNION, KW_SHORT, KW_LONG, KW_VOID,
+  KW_TYPEDEF, KW_BOOL, KW_ENUM, KW_STATIC, KW_BREAK, KW_CONTINUE,
+  KW_GOTO, KW_SWITCH, KW_CASE, KW_DEFAULT, KW_EXTERN, KW_ALIGNOF,
+  KW_ALIGNAS, KW_DO, KW_SIGNED, KW_UNSIGNED, KW_CONST, KW_VOLATILE,
+
+  // Preprocessor directive names other than keywords
+  PP_INCLUDE, PP_DEFINE, PP_UNDEF, PP_IFDEF, PP_IFNDEF, PP_ELIF,
+  PP_ENDIF, PP_PRAGMA, PP_DEFINED, PP_ONCE,
+
+  // Punctuators, longest first
+  P_ELLIPSIS, P_SHL_ASSIGN, P_SHR_ASSIGN,
+  P_EQ, P_NE, P_LE, P_GE, P_ARROW, P_ADD_ASSIGN, P_SUB_ASSIGN,
+  P_MUL_ASSIGN, P_DIV_ASSIGN, P_INC, P_DEC, P_MOD_ASSIGN,
+  P_AND_ASSIGN, P_OR_ASSIGN, P_XOR_ASSIGN, P_LOGAND, P_LOGOR, P_SHL,
+  P_SHR, P_HASHHASH,
+  P_LPAREN, P_RPAREN, P_LBRACE, P_RBRACE, P_LBRACKET, P_RBRACKET,
+  P_SEMICOLON, P_COMMA, P_DOT, P_ASSIGN, P_LT, P_GT, P_PLUS, P_MINUS,
+  P_STAR, P_SLASH, P_PERCENT, P_AMP, P_PIPE, P_CARET, P_TILDE, P_NOT,
+  P_QUESTION, P_COLON, P_HASH,
+
+  NR_TOKEN_IDS,
+} TokenId;
+
+// Set of macro names, represented as a Patricia tree keyed by
+// name_id(). There is only one Hideset object for each set, so equal
+// sets are the same pointer. A Hideset must not be modified.
+typedef struct Hideset Hideset;
+struct Hideset {
+  Hideset *left;       // 0 if leaf
+  Hideset *right;
+  long prefix;         // Bits below `bit` shared by all names, or leaf's ID
+  long bit;            // The bit that tells which child has a name
+  char *name;          // If leaf, the name
+  unsigned long bloom; // One bit for each name, for quick rejection
+};
+
+// Source file of tokens. Tokens read from the same input share one.
+typedef struct {
+  char *name;     // Input filename
+  char *contents; // Entire input string
+  int file_no;    // File number for .loc directive
+
+  // Offsets of the beginnings of lines, recorded as the file is
+  // tokenized
+  int *lines;
+  int nr_lines;
+  int lines_cap;
+} File;
+
+// Payload of a literal token
+typedef struct {
+  long val;       // If TK_NUM, its value
+  Type *ty;       // If TK_NUM, its type
+  char *contents; // If TK_STR, its contents, not null-terminated
+  int cont_len;   // If TK_STR, its length excluding terminating '\0'
+} Literal;
+
+// Token type
+//
+// Fields the preprocessor and the parser look at for every token
+// come first. Those used only for some tokens or only for error
+// messages and debug info are kept out of line.
+typedef struct Token Token;
+struct Token {
+  TokenKind kind;   // Token kind
+  TokenId id;       // Keyword or punctuator ID, or ID_NONE
+  Token *next;      // Next token
+  char *loc;        // Token location
+  int len;          // Token length
+  int lineno;       // Line number
+  char *name;       // If identifier or keyword, its interned spelling
+  Hideset *hideset; // For macro expension
+  _Bool at_bol;      // True if this token is at beginning of line
+  _Bool has_space;   // True if this token follows a space character
+  _Bool is_raw;      // True if this token is read from a file
+  _Bool is_shared;   // True if this token is in a file's cached tokens
+
+  File *file;       // Source file
+  Literal *lit;     // If TK_NUM or TK_STR, its value
+};
+
+extern _Bool fast_lexer;
+
+void error(char *fmt, ...);
+void error_tok(Token *tok, char *fmt, ...);
+void warn_tok(Token *tok, char *fmt, ...);
+Token *skip(Token *tok, TokenId id);
+_Bool consume(Token **rest, Token *tok, TokenId id);
+char *intern(char *s, int len);
+long name_id(char *name);
+File *new_file(char *name, int file_no, char *contents);
+int get_column(Token *tok);
+void convert_keywords(Token *tok);
+Token *next_token(Token *tok);
+void free_token(Token *tok);
+Token *tokenize_lazy(char *filename, int file_no, char *p, Token *cont);
+Token *tokenize_cached(Token *src, char *filename, int file_no,
+                       Token *cont);
+Token *tokenize(char *filename, int file_no, char *p);
+
+//
+// preprocess.c
+//
+
+extern _Bool pp_report;
+
+// Identifies a file and its version.
+typedef struct {
+  unsigned long dev;
+  unsigned long ino;
+  long size;
+  long mtime_sec;
+  long mtime_nsec;
+} FileId;
+
+_Bool get_file_id(char *path, FileId *id);
+char *read_file_string(char *path, long *mapping);
+void free_file_string(char *buf, long mapping);
+int add_file(char *path);
+void save_file_ids(void);
+char *load_file_ids(void);
+void save_macros(void);
+void load_macros(void);
+Token *read_file(char *path);
+void print_pp_report(char *input);
+
+//
+// parse.c
+//
+
+// Variable
+typedef struct Var Var;
+struct Var {
+  Var *next;
+  char *name;    // Variable name
+  Type *ty;      // Type
+  Token *tok;    // representative token
+  _Bool is_local; // local or global
+  int align;     // alignment
+
+  _Bool is_static;
+  GvarInitializer *initializer;
+
+  // Local variable
+  int offset;
+
+  // Gloval variable
+  char *contents;
+  int cont_len;
+};
+
+// AST node
+typedef enum {
+  ND_ADD,       // +
+  ND_SUB,       // -
+  ND_MUL,       // *
+  ND_DIV,       // /
+  ND_MOD,       // %
+  ND_BITAND,    // &
+  ND_BITOR,     // |
+  ND_BITXOR,    // ^
+  ND_SHL,       // <<
+  ND_SHR,       // >>
+  ND_EQ,        // ==
+  ND_NE,        // !=
+  ND_LT,        // <
+  ND_LE,        // <=
+  ND_ASSIGN,    // =
+  ND_COND,      // ?:
+  ND_COMMA,     // ,
+  ND_MEMBER,    // . (struct member access)
+  ND_ADDR,      // unary &
+  ND_DEREF,     // unary *
+  ND_NOT,       // !
+  ND_BITNOT,    // ~
+  ND_LOGAND,    // &&
+  ND_LOGOR,     // ||
+  ND_RETURN,    // "return"
+  ND_IF,        // "if"
+  ND_FOR,       // "for" or "while"
+  ND_DO,        // "do"
+  ND_SWITCH,    // "switch"
+  ND_CASE,      // "case"
+  ND_BLOCK,     // { ... }
+  ND_BREAK,     // "break"
+  ND_CONTINUE,  // "continue"
+  ND_GOTO,      // "goto"
+  ND_LABEL,     // Labeled statement
+  ND_FUNCALL,   // Function call
+  ND_EXPR_STMT, // Expression statement
+  ND_STMT_EXPR, // Statement expression
+  ND_VAR,       // Variable
+  ND_NUM,       // Integer
+  ND_CAST,      // Type cast
+} NodeKind;
+
+// AST node type
+typedef struct Node Node;
+struct Node {
+  NodeKind kind; // Node kind
+  Node *next;    // Next node
+  Type *ty;      // Type, e.g. int or pointer to tin
+  Token *tok;    // Representative token
+
+  Node *lhs;     // Left-hand side
+  Node *rhs;     // Right-hand side
+
+  // "if" or "for" statement
+  Node *cond;
+  Node *then;
+  Node *els;
+  Node *init;
+  Node *inc;
+
+  // Assignment
+  _Bool is_init;
+
+  // Blcok or statement expression
+  Node *body;
+
+  // Struct member access
+  Member *member;
+
+  // Function call
+  char *funcname;
+  Type *func_ty;
+  Node *args;
+
+  // Goto or labeled statement
+  char *label_name;
+
+  // Switch-cases
+  Node *case_next;
+  Node *default_case;
+  int case_label;
+  int case_end_label;
+
+  // Variable
+  Var *var;
+
+  // Integer literal
+  long val;
+};
+
+// Global variable initializer. Global variables can be initialized
+// either by a constatnt expression or a pointer to another global
+// bariable with an addend.
+struct GvarInitializer {
+  GvarInitializer *next;
+  int offset;
+
+  // Scalar value
+  int sz;
+  long val;
+
+  // Byte string of `sz` bytes
+  char *bytes;
+
+  // Reference to another global variable
+  char *label;
+  long addend;
+};
+
+typedef struct Function Function;
+struct Function {
+  Function *next;
+  char *name;
+  Var *params;
+  _Bool is_static;
+  _Bool is_varargs;
+
+  Node *node;
+  Var *locals;
+  int stack_size;
+  long nr_nodes; // The number of AST nodes, as an estimate of work
+};
+
+typedef struct {
+  Var *globals;
+  Function *fns;
+} Program;
+
+Node *new_cast(Node *expr, Type *ty);
+long const_expr(Token **rest, Token *tok);
+void save_scopes(void);
+void load_scopes(void);
+Program *parse(Token *tok);
+
+//
+// type.c
+//
+
+typedef enum {
+  TY_VOID,
+  TY_BOOL,
+  TY_CHAR,
+  TY_SHORT,
+  TY_INT,
+  TY_LONG,
+  TY_ENUM,
+  TY_PTR,
+  TY_FUNC,
+  TY_ARRAY,
+  TY_STRUCT,
+} TypeKind;
+
+struct Type {
+  TypeKind kind;
+  int size;           // sizeof() value
+  int align;          // alignment
+  _Bool is_unsigned;   // unsigned or signed
+  _Bool is_incomplete; // incomplete type
+  _Bool is_const;
+
+  // Pointer
+  Type *base;
+
+  // Declaration
+  Token *name;
+  Token *name_pos;
+
+  // Array
+  int array_len;
+
+  // Struct
+  Member *members;
+
+  // Function type
+  Type *return_ty;
+  Type *params;
+  _Bool is_varargs;
+  Type *next;
+};
+
+// Struct member
+struct Member {
+  Member *next;
+  Type *ty;
+  Token *tok; // for error message
+  Token *name;
+  int align;
+  int offset;
+};
+
+extern Type *ty_void;
+extern Type *ty_bool;
+
+extern Type *ty_char;
+extern Type *ty_short;
+extern Type *ty_int;
+extern Type *ty_long;
+
+extern Type *ty_uchar;
+extern Type *ty_ushort;
+extern Type *ty_uint;
+extern Type *ty_ulong;
+
+_Bool is_integer(Type *ty);
+Type *copy_type(Type *ty);
+Type *pointer_to(Type *base);
+int align_to(int n, int align);
+Type *func_type(Type *return_ty);
+Type *array_of(Type *base, int size);
+Type *enum_type(void);
+Type *struct_type(void);
+int size_of(Type *ty);
+Type *copy_type(Type *ty);
+void add_type(Node *node);
+
+//
+// codegen.c
+//
+
+extern int codegen_jobs;
+
+void codegen(Program *prog);
+
+//
+// emit.c
+//
+
+void open_output(char *path);
+void flush_output(void);
+void write_output(char *p, long len);
+void capture_output(void);
+char *take_output(void);
+void emitf(char *fmt, ...);
+void println(char *fmt, ...);
+long output_size(void);
+char *output_since(long pos);
+
+//
+// assemble.c
+//
+
+void assemble(char *input, char *path);
+
+//
+// timer.c
+//
+
+typedef enum {
+  PH_READ,       // read_file_string
+  PH_TOKENIZE,   // tokenize
+  PH_PREPROCESS, // preprocess
+  PH_KEYWORDS,   // convert_keywords
+  PH_PARSE,      // parse
+  PH_LAYOUT,     // stack offset assignment
+  PH_EMIT_DATA,  // emit_data
+  PH_EMIT_TEXT,  // emit_text
+  PH_ASSEMBLE,   // assemble
+  NR_PHASES,
+} Phase;
+
+extern _Bool time_report;
+extern _Bool time_report_json;
+
+void timer_start(Phase ph);
+void timer_stop(void);
+void timer_count(Phase ph, long n);
+void timer_count_lines(long n);
+void reset_timer(void);
+Phase current_phase(void);
+char *phase_name(Phase ph);
+void print_time_report(char *input);
+
+//
+// alloc.c
+//
+
+typedef enum {
+  AK_TOKEN,       // Token
+  AK_HIDESET,     // Hideset
+  AK_MACRO,       // Macro, MacroParam, MacroArg and CondIncl
+  AK_NODE,        // Node
+  AK_TYPE,        // Type
+  AK_MEMBER,      // Member
+  AK_VAR,         // Var
+  AK_VAR_SCOPE,   // VarScope
+  AK_TAG_SCOPE,   // TagScope
+  AK_FUNCTION,    // Function and Program
+  AK_INITIALIZER, // Initializer
+  AK_GVAR_INIT,   // GvarInitializer
+  AK_STRING,      // Names, labels and string literals
+  AK_FILE,        // Source file contents
+  NR_ALLOC_KINDS,
+} AllocKind;
+
+typedef struct Arena Arena;
+
+extern _Bool mem_report;
+
+void reset_alloc_stats(void);
+void count_alloc(AllocKind kind, long size);
+void *alloc_obj(AllocKind kind, long size);
+char *alloc_str(char *s, long len);
+void free_arena(void);
+Arena *enter_arena(void);
+void leave_arena(Arena *arena);
+void release_arena(Arena *arena);
+void print_mem_report(char *input);
+
+//
+// server.c
+//
+
+Token *find_cached_file(char *path);
+void note_input_file(char *path);
+char *read_all(int fd);
+void run_server(char *path, int *argc, char ***argv);
+int run_client(char *path, int argc, char **argv);
+
+//
+// pch.c
+//
+
+void pch_put_long(long val);
+void pch_put_str(char *s);
+void pch_put_token(Token *tok);
+void pch_put_tokens(Token *tok);
+void pch_put_type(Type *ty);
+void pch_put_var(Var *var);
+void write_pch(char *path);
+
+long pch_get_long(void);
+char *pch_get_str(void);
+char *pch_get_name(void);
+Token *pch_get_token(void);
+Token *pch_get_tokens(void);
+Type *pch_get_type(void);
+Var *pch_get_var(void);
+void read_pch(char *path);
+
+//
+// cache.c
+//
+
+extern char *cache_dir;
+extern long cache_max_size;
+extern _Bool cache_stats;
+
+char *cache_key(Token *tok, char *hdr, long hdr_len);
+_Bool cache_lookup(char *key);
+void cache_store(char *key, char *p, long len);
+void print_cache_stats(void);
+
+//
+// hashmap.c
+//
+
+typedef struct {
+  char *key;
+  int keylen;
+  void *val;
+} HashEntry;
+
+typedef struct {
+  HashEntry *buckets;
+  int capacity;
+  int used;
+
+  // Statistics
+  long lookups;
+  long probes;
+} HashMap;
+
+void *hashmap_get(HashMap *map, char *key);
+void *hashmap_get2(HashMap *map, char *key, int keylen);
+void hashmap_put(HashMap *map, char *key, void *val);
+void hashmap_put2(HashMap *map, char *key, int keylen, void *val);
+void hashmap_delete(HashMap *map, char *key);
+void hashmap_delete2(HashMap *map, char *key, int keylen);
+
+//
+// main.c
+//
+
+extern _Bool preprocess_only;
+extern _Bool output_object;
+extern char *include_pch;
+
+_Bool preprocess_only;
+_Bool output_object;
+char *include_pch;
+
+static char **input_files;
+static int nr_input_files;
+static char *output_path;
+static int nr_jobs = 1;
+static _Bool emit_pch;
+
+static void usage(void) {
+  fprintf(stderr, "punyc [ -E | -c ] [ -j <jobs> ] [ -o <path> ] [ -ftime-report[=json] ] [ -fmem-report ] [ -fpp-report ] [ -fno-fast-lexer ] [ -fcache-dir=<dir> [ -fcache-size=<bytes> ] [ -fcache-stats ] ] [ -include-pch <file> ] <file>...\n");
+  fprintf(stderr, "punyc --emit-pch -o <file> <header>\n");
+  fprintf(stderr, "punyc --server <socket>\n");
+  fprintf(stderr, "punyc --client <socket> <args>...\n");
+  exit(1);
+}
+
+static void add_input_file(char *path) {
+  input_files = realloc(input_files, sizeof(char *) * (nr_input_files + 1));
+  input_files[nr_input_files++] = path;
+}
+
+static void parse_args(int argc, char **argv) {
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--help"))
+      usage();
+
+    if (!strcmp(argv[i], "-E")) {
+      preprocess_only = 1;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-c")) {
+      output_object = 1;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-ftime-report")) {
+      time_report = 1;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-ftime-report=json")) {
+      time_report = 1;
+      time_report_json = 1;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fno-fast-lexer")) {
+      fast_lexer = 0;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fmem-report")) {
+      mem_report = 1;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fpp-report")) {
+      pp_report = 1;
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-fcache-dir=", 12)) {
+      cache_dir = argv[i] + 12;
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-fcache-size=", 13)) {
+      cache_max_size = strtol(argv[i] + 13, 0, 10);
+      if (cache_max_size <= 0)
+        error("invalid cache size: %s", argv[i] + 13);
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fcache-stats")) {
+      cache_stats = 1;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "--emit-pch")) {
+      emit_pch = 1;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-include-pch")) {
+      if (++i == argc)
+        usage();
+      include_pch = argv[i];
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-o")) {
+      if (++i == argc)
+        usage();
+      output_path = argv[i];
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-j", 2)) {
+      char *arg = argv[i] + 2;
+      if (*arg == '\0') {
+        if (++i == argc)
+          usage();
+        arg = argv[i];
+      }
+      nr_jobs = atoi(arg);
+      if (nr_jobs < 1)
+        error("invalid number of jobs: %s", arg);
+      continue;
+    }
+
+    if (argv[i][0] == '-' && argv[i][1] != '\0')
+      error("unknown argument: %s", argv[i]);
+
+    add_input_file(argv[i]);
+  }
+
+  if (cache_stats && !cache_dir)
+    error("-fcache-stats requires -fcache-dir");
+
+  if (nr_input_files == 0 && !cache_stats)
+    error("no input files");
+
+  if (emit_pch && (nr_input_files != 1 || !output_path))
+    error("--emit-pch requires a single header and -o");
+}
+
+static void print_tokens(Token *tok) {
+  int line = 1;
+  for (; tok->kind != TK_EOF; tok = tok->next) {
+    if (line > 1 && tok->at_bol)
+      emitf("\n");
+    if (tok->has_space && !tok->at_bol)
+      emitf(" ");
+    emitf(" %.*s", tok->len, tok->loc);
+    line++;
+  }
+  emitf("\n");
+}
+
+// Returns 1 if the -o argument names a directory rather than
+// a single output file.
+static _Bool output_is_dir(void) {
+  if (nr_input_files > 1)
+    return 1;
+  if (output_object && !preprocess_only && !output_path)
+    return 1;
+  return output_path && output_path[strlen(output_path) - 1] == '/';
+}
+
+static char *output_ext(void) {
+  if (preprocess_only)
+    return ".i";
+  if (output_object)
+    return ".o";
+  return ".s";
+}
+
+// Returns "<dir>/<basename of path without extension><ext>".
+static char *output_filename(char *dir, char *path) {
+  char *base = strrchr(path, '/');
+  base = base ? base + 1 : path;
+
+  char *dot = strrchr(base, '.');
+  int len = dot ? dot - base : strlen(base);
+  char *ext = output_ext();
+
+  char *buf = malloc(strlen(dir) + len + strlen(ext) + 2);
+  if (dir[strlen(dir) - 1] == '/')
+    sprintf(buf, "%s%.*s%s", dir, len, base, ext);
+  else
+    sprintf(buf, "%s/%.*s%s", dir, len, base, ext);
+  return buf;
+}
+
+// Returns the output filename for a given input, or 0 if the
+// output should go to stdout.
+static char *get_output(char *input) {
+  if (!output_is_dir())
+    return output_path;
+  return output_filename(output_path ? output_path : ".", input);
+}
+
+static void print_reports(char *input) {
+  if (time_report)
+    print_time_report(input);
+  if (mem_report)
+    print_mem_report(input);
+  if (pp_report)
+    print_pp_report(input);
+}
+
+// Parses preprocessed tokens and emits assembly.
+static void gen_asm(Token *tok) {
+  timer_start(PH_PARSE);
+  Program *prog = parse(tok);
+  timer_stop();
+
+  // Assign offsets to local variables.
+  timer_start(PH_LAYOUT);
+  for (Function *fn = prog->fns; fn; fn = fn->next) {
+    // Besides local variables, callee-saved registers take 32 bytes
+    // and the variable-argument save area takes 56 bytes in the stack.
+    int offset = fn->is_varargs ? 88: 32;
+
+    for (Var *var = fn->locals; var; var = var->next) {
+      offset = align_to(offset, var->align);
+      offset += size_of(var->ty);
+      var->offset = offset;
+      timer_count(PH_LAYOUT, 1);
+    }
+    fn->stack_size = align_to(offset, 16);
+  }
+  timer_stop();
+
+  // Traverse the AST to emit assembly.
+  codegen(prog);
+}
+
+// Saves the declarations and macros of a given header to a
+// precompiled header.
+static void compile_pch(char *input, char *output) {
+  // The preprocessor emits .file directives, which we don't need.
+  capture_output();
+
+  if (include_pch)
+    read_pch(include_pch);
+
+  Token *tok = read_file(input);
+
+  timer_start(PH_PARSE);
+  Program *prog = parse(tok);
+  timer_stop();
+
+  if (prog->fns || prog->globals)
+    error("%s: a precompiled header cannot contain definitions", input);
+
+  take_output();
+  write_pch(output);
+  print_reports(input);
+  free_arena();
+}
+
+// Compiles a single translation unit.
+static void compile(char *input, char *output) {
+  _Bool assemble_output = output_object && !preprocess_only;
+  if (assemble_output)
+    capture_output();
+  else
+    open_output(output);
+
+  // Keep the output in memory so that it can be stored to the cache.
+  if (cache_dir && !preprocess_only)
+    capture_output();
+  long start = output_size();
+
+  if (include_pch)
+    read_pch(include_pch);
+
+  // Tokenize and parse.
+  Token *tok = read_file(input);
+
+  if (preprocess_only) {
+    print_tokens(tok);
+    flush_output();
+    print_reports(input);
+    free_arena();
+    return;
+  }
+
+  if (cache_dir) {
+    // The preprocessor has emitted .file directives so far.
+    long mid = output_size();
+    char *key = cache_key(tok, output_since(start), mid - start);
+    if (!cache_lookup(key)) {
+      gen_asm(tok);
+      cache_store(key, output_since(mid), output_size() - mid);
+    }
+  } else {
+    gen_asm(tok);
+  }
+
+  if (assemble_output) {
+    timer_start(PH_ASSEMBLE);
+    assemble(take_output(), output);
+    timer_stop();
+  } else {
+    flush_output();
+  }
+
+  print_reports(input);
+  free_arena();
+}
+
+// Compiles all input files using up to `nr_jobs` worker processes.
+//
+// The compiler keeps its state in global variables and reports
+// errors by calling exit(), so each translation unit is compiled
+// in its own forked process. A failure in one file is reported
+// and doesn't abort the others.
+static int run_jobs(void) {
+  char **outputs = calloc(nr_input_files, sizeof(char *));
+  int *pids = calloc(nr_input_files, sizeof(int));
+  int next = 0;
+  int running = 0;
+  int failed = 0;
+
+  // Inputs with the same basename in different directories would
+  // overwrite each other's output.
+  HashMap seen = {};
+  for (int i = 0; i < nr_input_files; i++) {
+    outputs[i] = get_output(input_files[i]);
+    char *prev = hashmap_get(&seen, outputs[i]);
+    if (prev)
+      error("%s and %s would both be written to %s", prev, input_files[i],
+            outputs[i]);
+    hashmap_put(&seen, outputs[i], input_files[i]);
+  }
+
+  fflush(stdout);
+  fflush(stderr);
+
+  while (next < nr_input_files || running > 0) {
+    // Start a new worker if we have a free slot.
+    if (next < nr_input_files && running < nr_jobs) {
+      int pid = fork();
+      if (pid < 0)
+        error("fork failed: %s", strerror(*__errno_location()));
+
+      if (pid == 0) {
+        compile(input_files[next], outputs[next]);
+        exit(0);
+      }
+
+      pids[next++] = pid;
+      running++;
+      continue;
+    }
+
+    // Otherwise, wait for any worker to finish.
+    int status;
+    int pid = waitpid(-1, &status, 0);
+    if (pid < 0)
+      error("waitpid failed: %s", strerror(*__errno_location()));
+    running--;
+
+    for (int i = 0; i < next; i++) {
+      if (pids[i] != pid)
+        continue;
+      if (status != 0) {
+        fprintf(stderr, "%s: compilation failed\n", input_files[i]);
+        unlink(outputs[i]);
+        failed++;
+      }
+      break;
+    }
+  }
+
+  return failed ? 1 : 0;
+}
+
+int main(int argc, char **argv) {
+  // In server mode, we come back here in a worker process forked
+  // for each request, with the arguments sent by a client.
+  if (argc == 3 && !strcmp(argv[1], "--server"))
+    run_server(argv[2], &argc, &argv);
+  else if (argc >= 3 && !strcmp(argv[1], "--client"))
+    return run_client(argv[2], argc - 2, argv + 2);
+
+  parse_args(argc, argv);
+
+  int ret = 0;
+  if (emit_pch)
+    compile_pch(input_files[0], output_path);
+  else if (nr_input_files > 1)
+    ret = run_jobs();
+  else if (nr_input_files == 1) {
+    // With a single input, -j runs codegen in parallel instead.
+    codegen_jobs = nr_jobs;
+    compile(input_files[0], get_output(input_files[0]));
+  }
+
+  if (cache_stats)
+    print_cache_stats();
+  return ret;
+}
@@ -0,0 +1,6633 @@
+.file 1 "main.c"
+.intel_syntax noprefix
+.bss
+.align 1
+emit_pch:
+  .zero 1
+.align 8
+output_path:
+  .zero 8
+.align 4
+nr_input_files:
+  .zero 4
+.align 8
+input_files:
+  .zero 8
+.align 8
+.globl include_pch
+include_pch:
+  .zero 8
+.align 1
+.globl output_object
+output_object:
+  .zero 1
+.align 1
+.globl preprocess_only
+preprocess_only:
+  .zero 1
+.data
+.align 1
+.L.data.41:
+  .byte 45
+  .byte 45
+  .byte 99
+  .byte 108
+  .byte 105
+  .byte 101
+  .byte 110
+  .byte 116
+  .zero 1
+.align 1
+.L.data.40:
+  .byte 45
+  .byte 45
+  .byte 115
+  .byte 101
+  .byte 114
+  .byte 118
+  .byte 101
+  .byte 114
+  .zero 1
+.align 1
+.L.data.39:
+  .byte 37
+  .byte 115
+  .byte 58
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 109
+  .byte 112
+  .byte 105
+  .byte 108
+  .byte 97
+  .byte 116
+  .byte 105
+  .byte 111
+  .byte 110
+  .byte 32
+  .byte 102
+  .byte 97
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 100
+  .byte 10
+  .zero 1
+.align 1
+.L.data.38:
+  .byte 119
+  .byte 97
+  .byte 105
+  .byte 116
+  .byte 112
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 102
+  .byte 97
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 100
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.37:
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 107
+  .byte 32
+  .byte 102
+  .byte 97
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 100
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.36:
+  .byte 37
+  .byte 115
+  .byte 32
+  .byte 97
+  .byte 110
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 32
+  .byte 119
+  .byte 111
+  .byte 117
+  .byte 108
+  .byte 100
+  .byte 32
+  .byte 98
+  .byte 111
+  .byte 116
+  .byte 104
+  .byte 32
+  .byte 98
+  .byte 101
+  .byte 32
+  .byte 119
+  .byte 114
+  .byte 105
+  .byte 116
+  .byte 116
+  .byte 101
+  .byte 110
+  .byte 32
+  .byte 116
+  .byte 111
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.35:
+  .byte 37
+  .byte 115
+  .byte 58
+  .byte 32
+  .byte 97
+  .byte 32
+  .byte 112
+  .byte 114
+  .byte 101
+  .byte 99
+  .byte 111
+  .byte 109
+  .byte 112
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 104
+  .byte 101
+  .byte 97
+  .byte 100
+  .byte 101
+  .byte 114
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 110
+  .byte 110
+  .byte 111
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 97
+  .byte 105
+  .byte 110
+  .byte 32
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 105
+  .byte 110
+  .byte 105
+  .byte 116
+  .byte 105
+  .byte 111
+  .byte 110
+  .byte 115
+  .zero 1
+.align 1
+.L.data.34:
+  .byte 46
+  .zero 1
+.align 1
+.L.data.33:
+  .byte 37
+  .byte 115
+  .byte 47
+  .byte 37
+  .byte 46
+  .byte 42
+  .byte 115
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.32:
+  .byte 37
+  .byte 115
+  .byte 37
+  .byte 46
+  .byte 42
+  .byte 115
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.31:
+  .byte 46
+  .byte 115
+  .zero 1
+.align 1
+.L.data.30:
+  .byte 46
+  .byte 111
+  .zero 1
+.align 1
+.L.data.29:
+  .byte 46
+  .byte 105
+  .zero 1
+.align 1
+.L.data.28:
+  .byte 10
+  .zero 1
+.align 1
+.L.data.27:
+  .byte 32
+  .byte 37
+  .byte 46
+  .byte 42
+  .byte 115
+  .zero 1
+.align 1
+.L.data.26:
+  .byte 32
+  .zero 1
+.align 1
+.L.data.25:
+  .byte 10
+  .zero 1
+.align 1
+.L.data.24:
+  .byte 45
+  .byte 45
+  .byte 101
+  .byte 109
+  .byte 105
+  .byte 116
+  .byte 45
+  .byte 112
+  .byte 99
+  .byte 104
+  .byte 32
+  .byte 114
+  .byte 101
+  .byte 113
+  .byte 117
+  .byte 105
+  .byte 114
+  .byte 101
+  .byte 115
+  .byte 32
+  .byte 97
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 110
+  .byte 103
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 104
+  .byte 101
+  .byte 97
+  .byte 100
+  .byte 101
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 110
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 111
+  .zero 1
+.align 1
+.L.data.23:
+  .byte 110
+  .byte 111
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 112
+  .byte 117
+  .byte 116
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 115
+  .zero 1
+.align 1
+.L.data.22:
+  .byte 45
+  .byte 102
+  .byte 99
+  .byte 97
+  .byte 99
+  .byte 104
+  .byte 101
+  .byte 45
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 116
+  .byte 115
+  .byte 32
+  .byte 114
+  .byte 101
+  .byte 113
+  .byte 117
+  .byte 105
+  .byte 114
+  .byte 101
+  .byte 115
+  .byte 32
+  .byte 45
+  .byte 102
+  .byte 99
+  .byte 97
+  .byte 99
+  .byte 104
+  .byte 101
+  .byte 45
+  .byte 100
+  .byte 105
+  .byte 114
+  .zero 1
+.align 1
+.L.data.21:
+  .byte 117
+  .byte 110
+  .byte 107
+  .byte 110
+  .byte 111
+  .byte 119
+  .byte 110
+  .byte 32
+  .byte 97
+  .byte 114
+  .byte 103
+  .byte 117
+  .byte 109
+  .byte 101
+  .byte 110
+  .byte 116
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.20:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 98
+  .byte 101
+  .byte 114
+  .byte 32
+  .byte 111
+  .byte 102
+  .byte 32
+  .byte 106
+  .byte 111
+  .byte 98
+  .byte 115
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.19:
+  .byte 45
+  .byte 106
+  .zero 1
+.align 1
+.L.data.18:
+  .byte 45
+  .byte 111
+  .zero 1
+.align 1
+.L.data.17:
+  .byte 45
+  .byte 105
+  .byte 110
+  .byte 99
+  .byte 108
+  .byte 117
+  .byte 100
+  .byte 101
+  .byte 45
+  .byte 112
+  .byte 99
+  .byte 104
+  .zero 1
+.align 1
+.L.data.16:
+  .byte 45
+  .byte 45
+  .byte 101
+  .byte 109
+  .byte 105
+  .byte 116
+  .byte 45
+  .byte 112
+  .byte 99
+  .byte 104
+  .zero 1
+.align 1
+.L.data.15:
+  .byte 45
+  .byte 102
+  .byte 99
+  .byte 97
+  .byte 99
+  .byte 104
+  .byte 101
+  .byte 45
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 116
+  .byte 115
+  .zero 1
+.align 1
+.L.data.14:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 99
+  .byte 104
+  .byte 101
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.13:
+  .byte 45
+  .byte 102
+  .byte 99
+  .byte 97
+  .byte 99
+  .byte 104
+  .byte 101
+  .byte 45
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 61
+  .zero 1
+.align 1
+.L.data.12:
+  .byte 45
+  .byte 102
+  .byte 99
+  .byte 97
+  .byte 99
+  .byte 104
+  .byte 101
+  .byte 45
+  .byte 100
+  .byte 105
+  .byte 114
+  .byte 61
+  .zero 1
+.align 1
+.L.data.11:
+  .byte 45
+  .byte 102
+  .byte 112
+  .byte 112
+  .byte 45
+  .byte 114
+  .byte 101
+  .byte 112
+  .byte 111
+  .byte 114
+  .byte 116
+  .zero 1
+.align 1
+.L.data.10:
+  .byte 45
+  .byte 102
+  .byte 109
+  .byte 101
+  .byte 109
+  .byte 45
+  .byte 114
+  .byte 101
+  .byte 112
+  .byte 111
+  .byte 114
+  .byte 116
+  .zero 1
+.align 1
+.L.data.9:
+  .byte 45
+  .byte 102
+  .byte 110
+  .byte 111
+  .byte 45
+  .byte 102
+  .byte 97
+  .byte 115
+  .byte 116
+  .byte 45
+  .byte 108
+  .byte 101
+  .byte 120
+  .byte 101
+  .byte 114
+  .zero 1
+.align 1
+.L.data.8:
+  .byte 45
+  .byte 102
+  .byte 116
+  .byte 105
+  .byte 109
+  .byte 101
+  .byte 45
+  .byte 114
+  .byte 101
+  .byte 112
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 61
+  .byte 106
+  .byte 115
+  .byte 111
+  .byte 110
+  .zero 1
+.align 1
+.L.data.7:
+  .byte 45
+  .byte 102
+  .byte 116
+  .byte 105
+  .byte 109
+  .byte 101
+  .byte 45
+  .byte 114
+  .byte 101
+  .byte 112
+  .byte 111
+  .byte 114
+  .byte 116
+  .zero 1
+.align 1
+.L.data.6:
+  .byte 45
+  .byte 99
+  .zero 1
+.align 1
+.L.data.5:
+  .byte 45
+  .byte 69
+  .zero 1
+.align 1
+.L.data.4:
+  .byte 45
+  .byte 45
+  .byte 104
+  .byte 101
+  .byte 108
+  .byte 112
+  .zero 1
+.align 1
+.L.data.3:
+  .byte 112
+  .byte 117
+  .byte 110
+  .byte 121
+  .byte 99
+  .byte 32
+  .byte 45
+  .byte 45
+  .byte 99
+  .byte 108
+  .byte 105
+  .byte 101
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 60
+  .byte 115
+  .byte 111
+  .byte 99
+  .byte 107
+  .byte 101
+  .byte 116
+  .byte 62
+  .byte 32
+  .byte 60
+  .byte 97
+  .byte 114
+  .byte 103
+  .byte 115
+  .byte 62
+  .byte 46
+  .byte 46
+  .byte 46
+  .byte 10
+  .zero 1
+.align 1
+.L.data.2:
+  .byte 112
+  .byte 117
+  .byte 110
+  .byte 121
+  .byte 99
+  .byte 32
+  .byte 45
+  .byte 45
+  .byte 115
+  .byte 101
+  .byte 114
+  .byte 118
+  .byte 101
+  .byte 114
+  .byte 32
+  .byte 60
+  .byte 115
+  .byte 111
+  .byte 99
+  .byte 107
+  .byte 101
+  .byte 116
+  .byte 62
+  .byte 10
+  .zero 1
+.align 1
+.L.data.1:
+  .byte 112
+  .byte 117
+  .byte 110
+  .byte 121
+  .byte 99
+  .byte 32
+  .byte 45
+  .byte 45
+  .byte 101
+  .byte 109
+  .byte 105
+  .byte 116
+  .byte 45
+  .byte 112
+  .byte 99
+  .byte 104
+  .byte 32
+  .byte 45
+  .byte 111
+  .byte 32
+  .byte 60
+  .byte 102
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 62
+  .byte 32
+  .byte 60
+  .byte 104
+  .byte 101
+  .byte 97
+  .byte 100
+  .byte 101
+  .byte 114
+  .byte 62
+  .byte 10
+  .zero 1
+.align 1
+.L.data.0:
+  .byte 112
+  .byte 117
+  .byte 110
+  .byte 121
+  .byte 99
+  .byte 32
+  .byte 91
+  .byte 32
+  .byte 45
+  .byte 69
+  .byte 32
+  .byte 124
+  .byte 32
+  .byte 45
+  .byte 99
+  .byte 32
+  .byte 93
+  .byte 32
+  .byte 91
+  .byte 32
+  .byte 45
+  .byte 106
+  .byte 32
+  .byte 60
+  .byte 106
+  .byte 111
+  .byte 98
+  .byte 115
+  .byte 62
+  .byte 32
+  .byte 93
+  .byte 32
+  .byte 91
+  .byte 32
+  .byte 45
+  .byte 111
+  .byte 32
+  .byte 60
+  .byte 112
+  .byte 97
+  .byte 116
+  .byte 104
+  .byte 62
+  .byte 32
+  .byte 93
+  .byte 32
+  .byte 91
+  .byte 32
+  .byte 45
+  .byte 102
+  .byte 116
+  .byte 105
+  .byte 109
+  .byte 101
+  .byte 45
+  .byte 114
+  .byte 101
+  .byte 112
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 91
+  .byte 61
+  .byte 106
+  .byte 115
+  .byte 111
+  .byte 110
+  .byte 93
+  .byte 32
+  .byte 93
+  .byte 32
+  .byte 91
+  .byte 32
+  .byte 45
+  .byte 102
+  .byte 109
+  .byte 101
+  .byte 109
+  .byte 45
+  .byte 114
+  .byte 101
+  .byte 112
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 93
+  .byte 32
+  .byte 91
+  .byte 32
+  .byte 45
+  .byte 102
+  .byte 112
+  .byte 112
+  .byte 45
+  .byte 114
+  .byte 101
+  .byte 112
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 93
+  .byte 32
+  .byte 91
+  .byte 32
+  .byte 45
+  .byte 102
+  .byte 110
+  .byte 111
+  .byte 45
+  .byte 102
+  .byte 97
+  .byte 115
+  .byte 116
+  .byte 45
+  .byte 108
+  .byte 101
+  .byte 120
+  .byte 101
+  .byte 114
+  .byte 32
+  .byte 93
+  .byte 32
+  .byte 91
+  .byte 32
+  .byte 45
+  .byte 102
+  .byte 99
+  .byte 97
+  .byte 99
+  .byte 104
+  .byte 101
+  .byte 45
+  .byte 100
+  .byte 105
+  .byte 114
+  .byte 61
+  .byte 60
+  .byte 100
+  .byte 105
+  .byte 114
+  .byte 62
+  .byte 32
+  .byte 91
+  .byte 32
+  .byte 45
+  .byte 102
+  .byte 99
+  .byte 97
+  .byte 99
+  .byte 104
+  .byte 101
+  .byte 45
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 61
+  .byte 60
+  .byte 98
+  .byte 121
+  .byte 116
+  .byte 101
+  .byte 115
+  .byte 62
+  .byte 32
+  .byte 93
+  .byte 32
+  .byte 91
+  .byte 32
+  .byte 45
+  .byte 102
+  .byte 99
+  .byte 97
+  .byte 99
+  .byte 104
+  .byte 101
+  .byte 45
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 116
+  .byte 115
+  .byte 32
+  .byte 93
+  .byte 32
+  .byte 93
+  .byte 32
+  .byte 91
+  .byte 32
+  .byte 45
+  .byte 105
+  .byte 110
+  .byte 99
+  .byte 108
+  .byte 117
+  .byte 100
+  .byte 101
+  .byte 45
+  .byte 112
+  .byte 99
+  .byte 104
+  .byte 32
+  .byte 60
+  .byte 102
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 62
+  .byte 32
+  .byte 93
+  .byte 32
+  .byte 60
+  .byte 102
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 62
+  .byte 46
+  .byte 46
+  .byte 46
+  .byte 10
+  .zero 1
+.align 4
+nr_jobs:
+  .long 1
+.text
+assert:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.L.return.assert:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+va_end:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.L.return.va_end:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+usage:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 748 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.0
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 749 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.1
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 750 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.2
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 751 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.3
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 752 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset exit
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.usage:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+add_input_file:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdi
+.loc 1 756 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset input_files
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  mov r11, offset nr_input_files
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  add r11d, r12d
+  movsx r11, r11d
+  imul r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset realloc
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r11, offset input_files
+  mov [r11], r10
+.loc 1 757 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r11, offset input_files
+  mov r11, [r11]
+  mov r12, offset nr_input_files
+  lea r13, [rbp-40]
+  mov [r13], r12
+  lea r12, [rbp-40]
+  mov r12, [r12]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  add r12d, r13d
+  mov r12d, r12d
+  lea r13, [rbp-40]
+  mov r13, [r13]
+  mov [r13], r12d
+  lea r12, [rbp-40]
+  mov r12, [r12]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, -1
+  mov r13d, r13d
+  add r12d, r13d
+  mov r12d, r12d
+  mov r13, 8
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.return.add_input_file:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+parse_args:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-88], rsi
+  mov [rbp-92], edi
+.loc 1 761 3
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-76]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.parse_args.1:
+  lea r10, [rbp-76]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-92]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.parse_args.1
+.loc 1 762 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.4
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.parse_args.2
+.loc 1 763 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset usage
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.parse_args.2:
+.loc 1 765 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.5
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.parse_args.3
+.loc 1 766 7
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov r11, offset preprocess_only
+  mov [r11], r10b
+.loc 1 767 7
+  jmp .L.continue.parse_args.1
+.L.end.parse_args.3:
+.loc 1 770 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.6
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.parse_args.4
+.loc 1 771 7
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov r11, offset output_object
+  mov [r11], r10b
+.loc 1 772 7
+  jmp .L.continue.parse_args.1
+.L.end.parse_args.4:
+.loc 1 775 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.7
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.parse_args.5
+.loc 1 776 7
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov r11, offset time_report
+  mov [r11], r10b
+.loc 1 777 7
+  jmp .L.continue.parse_args.1
+.L.end.parse_args.5:
+.loc 1 780 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.8
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.parse_args.6
+.loc 1 781 7
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov r11, offset time_report
+  mov [r11], r10b
+.loc 1 782 7
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov r11, offset time_report_json
+  mov [r11], r10b
+.loc 1 783 7
+  jmp .L.continue.parse_args.1
+.L.end.parse_args.6:
+.loc 1 786 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.9
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.parse_args.7
+.loc 1 787 7
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov r11, offset fast_lexer
+  mov [r11], r10b
+.loc 1 788 7
+  jmp .L.continue.parse_args.1
+.L.end.parse_args.7:
+.loc 1 791 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.10
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.parse_args.8
+.loc 1 792 7
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov r11, offset mem_report
+  mov [r11], r10b
+.loc 1 793 7
+  jmp .L.continue.parse_args.1
+.L.end.parse_args.8:
+.loc 1 796 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.11
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.parse_args.9
+.loc 1 797 7
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov r11, offset pp_report
+  mov [r11], r10b
+.loc 1 798 7
+  jmp .L.continue.parse_args.1
+.L.end.parse_args.9:
+.loc 1 801 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.12
+  push r10
+  sub rsp, 8
+  mov r10, 12
+  push r10
+  sub rsp, 8
+  mov r10, offset strncmp
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.parse_args.10
+.loc 1 802 7
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  mov r11, 12
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r11, offset cache_dir
+  mov [r11], r10
+.loc 1 803 7
+  jmp .L.continue.parse_args.1
+.L.end.parse_args.10:
+.loc 1 806 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.13
+  push r10
+  sub rsp, 8
+  mov r10, 13
+  push r10
+  sub rsp, 8
+  mov r10, offset strncmp
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.parse_args.11
+.loc 1 807 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  mov r11, 13
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 10
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset strtol
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r11, offset cache_max_size
+  mov [r11], r10
+.loc 1 808 7
+  mov r10, offset cache_max_size
+  mov r10, [r10]
+  mov r11, 0
+  movsx r11, r11d
+  cmp r10, r11
+  setle al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.parse_args.12
+.loc 1 809 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.14
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  mov r11, 13
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.parse_args.12:
+.loc 1 810 7
+  jmp .L.continue.parse_args.1
+.L.end.parse_args.11:
+.loc 1 813 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.15
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.parse_args.13
+.loc 1 814 7
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov r11, offset cache_stats
+  mov [r11], r10b
+.loc 1 815 7
+  jmp .L.continue.parse_args.1
+.L.end.parse_args.13:
+.loc 1 818 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.16
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.parse_args.14
+.loc 1 819 7
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov r11, offset emit_pch
+  mov [r11], r10b
+.loc 1 820 7
+  jmp .L.continue.parse_args.1
+.L.end.parse_args.14:
+.loc 1 823 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.17
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.parse_args.15
+.loc 1 824 7
+  lea r10, [rbp-76]
+  lea r11, [rbp-64]
+  mov [r11], r10
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov [r11], r10d
+  mov r10d, r10d
+  lea r11, [rbp-92]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.parse_args.16
+.loc 1 825 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset usage
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.parse_args.16:
+.loc 1 826 7
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  mov r11, offset include_pch
+  mov [r11], r10
+.loc 1 827 7
+  jmp .L.continue.parse_args.1
+.L.end.parse_args.15:
+.loc 1 830 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.18
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.parse_args.17
+.loc 1 831 7
+  lea r10, [rbp-76]
+  lea r11, [rbp-56]
+  mov [r11], r10
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10d
+  mov r10d, r10d
+  lea r11, [rbp-92]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.parse_args.18
+.loc 1 832 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset usage
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.parse_args.18:
+.loc 1 833 7
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  mov r11, offset output_path
+  mov [r11], r10
+.loc 1 834 7
+  jmp .L.continue.parse_args.1
+.L.end.parse_args.17:
+.loc 1 837 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.19
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset strncmp
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.parse_args.19
+.loc 1 838 7
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 839 7
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.parse_args.20
+.loc 1 840 9
+  lea r10, [rbp-76]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+  mov r10d, r10d
+  lea r11, [rbp-92]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.parse_args.21
+.loc 1 841 11
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset usage
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.parse_args.21:
+.loc 1 842 9
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov [r11], r10
+.L.end.parse_args.20:
+.loc 1 844 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset atoi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  mov r11, offset nr_jobs
+  mov [r11], r10d
+.loc 1 845 7
+  mov r10, offset nr_jobs
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.parse_args.22
+.loc 1 846 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.20
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.parse_args.22:
+.loc 1 847 7
+  jmp .L.continue.parse_args.1
+.L.end.parse_args.19:
+.loc 1 850 5
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 45
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.parse_args.24
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.parse_args.24
+  mov r10, 1
+  jmp .L.end.parse_args.24
+.L.false.parse_args.24:
+  mov r10, 0
+.L.end.parse_args.24:
+  cmp r10, 0
+  je .L.end.parse_args.23
+.loc 1 851 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.21
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.parse_args.23:
+.loc 1 853 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_input_file
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.parse_args.1:
+.loc 1 761 29
+  lea r10, [rbp-76]
+  lea r11, [rbp-72]
+  mov [r11], r10
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.parse_args.1
+.L.break.parse_args.1:
+.loc 1 856 3
+  mov r10, offset cache_stats
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.false.parse_args.26
+  mov r10, offset cache_dir
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.parse_args.26
+  mov r10, 1
+  jmp .L.end.parse_args.26
+.L.false.parse_args.26:
+  mov r10, 0
+.L.end.parse_args.26:
+  cmp r10, 0
+  je .L.end.parse_args.25
+.loc 1 857 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.22
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.parse_args.25:
+.loc 1 859 3
+  mov r10, offset nr_input_files
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.parse_args.28
+  mov r10, offset cache_stats
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.parse_args.28
+  mov r10, 1
+  jmp .L.end.parse_args.28
+.L.false.parse_args.28:
+  mov r10, 0
+.L.end.parse_args.28:
+  cmp r10, 0
+  je .L.end.parse_args.27
+.loc 1 860 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.23
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.parse_args.27:
+.loc 1 862 3
+  mov r10, offset emit_pch
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.false.parse_args.30
+  mov r10, offset nr_input_files
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.parse_args.31
+  mov r10, offset output_path
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.parse_args.31
+  mov r10, 0
+  jmp .L.end.parse_args.31
+.L.true.parse_args.31:
+  mov r10, 1
+.L.end.parse_args.31:
+  cmp r10, 0
+  je .L.false.parse_args.30
+  mov r10, 1
+  jmp .L.end.parse_args.30
+.L.false.parse_args.30:
+  mov r10, 0
+.L.end.parse_args.30:
+  cmp r10, 0
+  je .L.end.parse_args.29
+.loc 1 863 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.24
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.parse_args.29:
+.L.return.parse_args:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+print_tokens:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-56], rdi
+.loc 1 867 15
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-44]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 868 3
+.L.begin.print_tokens.1:
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.print_tokens.1
+.loc 1 869 5
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-44]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.print_tokens.3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 48
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.false.print_tokens.3
+  mov r10, 1
+  jmp .L.end.print_tokens.3
+.L.false.print_tokens.3:
+  mov r10, 0
+.L.end.print_tokens.3:
+  cmp r10, 0
+  je .L.end.print_tokens.2
+.loc 1 870 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.25
+  push r10
+  sub rsp, 8
+  mov r10, offset emitf
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.print_tokens.2:
+.loc 1 871 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 49
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.false.print_tokens.5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 48
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.print_tokens.5
+  mov r10, 1
+  jmp .L.end.print_tokens.5
+.L.false.print_tokens.5:
+  mov r10, 0
+.L.end.print_tokens.5:
+  cmp r10, 0
+  je .L.end.print_tokens.4
+.loc 1 872 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.26
+  push r10
+  sub rsp, 8
+  mov r10, offset emitf
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.print_tokens.4:
+.loc 1 873 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.27
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 24
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset emitf
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 874 5
+  lea r10, [rbp-44]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.continue.print_tokens.1:
+.loc 1 868 31
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov [r11], r10
+  jmp .L.begin.print_tokens.1
+.L.break.print_tokens.1:
+.loc 1 876 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.28
+  push r10
+  sub rsp, 8
+  mov r10, offset emitf
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.print_tokens:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+output_is_dir:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 882 3
+  mov r10, 1
+  mov r10d, r10d
+  mov r11, offset nr_input_files
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.output_is_dir.1
+.loc 1 883 5
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.output_is_dir
+.L.end.output_is_dir.1:
+.loc 1 884 3
+  mov r10, offset output_object
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.false.output_is_dir.4
+  mov r10, offset preprocess_only
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.output_is_dir.4
+  mov r10, 1
+  jmp .L.end.output_is_dir.4
+.L.false.output_is_dir.4:
+  mov r10, 0
+.L.end.output_is_dir.4:
+  cmp r10, 0
+  je .L.false.output_is_dir.3
+  mov r10, offset output_path
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.output_is_dir.3
+  mov r10, 1
+  jmp .L.end.output_is_dir.3
+.L.false.output_is_dir.3:
+  mov r10, 0
+.L.end.output_is_dir.3:
+  cmp r10, 0
+  je .L.end.output_is_dir.2
+.loc 1 885 5
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.output_is_dir
+.L.end.output_is_dir.2:
+.loc 1 886 3
+  mov r10, offset output_path
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.output_is_dir.5
+  mov r10, offset output_path
+  mov r10, [r10]
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset output_path
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strlen
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  mov r12, 1
+  movsx r12, r12d
+  sub r11, r12
+  mov r12, 1
+  movsx r12, r12d
+  imul r11, r12
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 47
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.output_is_dir.5
+  mov r10, 1
+  jmp .L.end.output_is_dir.5
+.L.false.output_is_dir.5:
+  mov r10, 0
+.L.end.output_is_dir.5:
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.output_is_dir
+.L.return.output_is_dir:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+output_ext:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 890 3
+  mov r10, offset preprocess_only
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.output_ext.1
+.loc 1 891 5
+  mov r10, offset .L.data.29
+  mov rax, r10
+  jmp .L.return.output_ext
+.L.end.output_ext.1:
+.loc 1 892 3
+  mov r10, offset output_object
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.output_ext.2
+.loc 1 893 5
+  mov r10, offset .L.data.30
+  mov rax, r10
+  jmp .L.return.output_ext
+.L.end.output_ext.2:
+.loc 1 894 3
+  mov r10, offset .L.data.31
+  mov rax, r10
+  jmp .L.return.output_ext
+.L.return.output_ext:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+output_filename:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-80], rsi
+  mov [rbp-88], rdi
+.loc 1 899 34
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 47
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset strrchr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 900 3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  cmp r10, 0
+  je  .L.else.output_filename.1
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  jmp .L.end.output_filename.1
+.L.else.output_filename.1:
+  lea r10, [rbp-80]
+  mov r10, [r10]
+.L.end.output_filename.1:
+  lea r11, [rbp-72]
+  mov [r11], r10
+.loc 1 902 33
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 46
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset strrchr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 903 44
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  cmp r10, 0
+  je  .L.else.output_filename.2
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  jmp .L.end.output_filename.2
+.L.else.output_filename.2:
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strlen
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.output_filename.2:
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 904 27
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset output_ext
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 906 58
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strlen
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strlen
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  add r10, r11
+  mov r11, 2
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset malloc
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 907 3
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strlen
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  mov r12, 1
+  movsx r12, r12d
+  sub r11, r12
+  mov r12, 1
+  movsx r12, r12d
+  imul r11, r12
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 47
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.output_filename.3
+.loc 1 908 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.32
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset sprintf
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.output_filename.3
+.L.else.output_filename.3:
+.loc 1 910 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.33
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset sprintf
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.output_filename.3:
+.loc 1 911 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.output_filename
+.L.return.output_filename:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+get_output:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 917 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset output_is_dir
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.get_output.1
+.loc 1 918 5
+  mov r10, offset output_path
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.get_output
+.L.end.get_output.1:
+.loc 1 919 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset output_path
+  mov r10, [r10]
+  cmp r10, 0
+  je  .L.else.get_output.2
+  mov r10, offset output_path
+  mov r10, [r10]
+  jmp .L.end.get_output.2
+.L.else.get_output.2:
+  mov r10, offset .L.data.34
+.L.end.get_output.2:
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset output_filename
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.get_output
+.L.return.get_output:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+print_reports:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 923 3
+  mov r10, offset time_report
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.print_reports.1
+.loc 1 924 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset print_time_report
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.print_reports.1:
+.loc 1 925 3
+  mov r10, offset mem_report
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.print_reports.2
+.loc 1 926 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset print_mem_report
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.print_reports.2:
+.loc 1 927 3
+  mov r10, offset pp_report
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.print_reports.3
+.loc 1 928 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset print_pp_report
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.print_reports.3:
+.L.return.print_reports:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+gen_asm:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-80], rdi
+.loc 1 933 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset timer_start
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 934 29
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset parse
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 935 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset timer_stop
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 938 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset timer_start
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 939 3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.gen_asm.1:
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.gen_asm.1
+.loc 1 942 5
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 25
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je  .L.else.gen_asm.2
+  mov r10, 88
+  mov r10d, r10d
+  jmp .L.end.gen_asm.2
+.L.else.gen_asm.2:
+  mov r10, 32
+  mov r10d, r10d
+.L.end.gen_asm.2:
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 944 5
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.gen_asm.3:
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.gen_asm.3
+.loc 1 945 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 36
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset align_to
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov [r11], r10d
+.loc 1 946 7
+  lea r10, [rbp-52]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+.loc 1 947 7
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 56
+  mov [r11], r10d
+.loc 1 948 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset timer_count
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.gen_asm.3:
+.loc 1 944 38
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  jmp .L.begin.gen_asm.3
+.L.break.gen_asm.3:
+.loc 1 950 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 16
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset align_to
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 48
+  mov [r11], r10d
+.L.continue.gen_asm.1:
+.loc 1 939 38
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov [r11], r10
+  jmp .L.begin.gen_asm.1
+.L.break.gen_asm.1:
+.loc 1 952 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset timer_stop
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 955 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset codegen
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.gen_asm:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+compile_pch:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-56], rsi
+  mov [rbp-64], rdi
+.loc 1 962 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset capture_output
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 964 3
+  mov r10, offset include_pch
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.compile_pch.1
+.loc 1 965 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset include_pch
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset read_pch
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.compile_pch.1:
+.loc 1 967 32
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset read_file
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 969 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset timer_start
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 970 29
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset parse
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 971 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset timer_stop
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 973 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  cmp r10, 0
+  jne .L.true.compile_pch.3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  cmp r10, 0
+  jne .L.true.compile_pch.3
+  mov r10, 0
+  jmp .L.end.compile_pch.3
+.L.true.compile_pch.3:
+  mov r10, 1
+.L.end.compile_pch.3:
+  cmp r10, 0
+  je .L.end.compile_pch.2
+.loc 1 974 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.35
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.compile_pch.2:
+.loc 1 976 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset take_output
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 977 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset write_pch
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 978 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset print_reports
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 979 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset free_arena
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.compile_pch:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+compile:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-80], rsi
+  mov [rbp-88], rdi
+.loc 1 984 60
+  mov r10, offset output_object
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.false.compile.1
+  mov r10, offset preprocess_only
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.compile.1
+  mov r10, 1
+  jmp .L.end.compile.1
+.L.false.compile.1:
+  mov r10, 0
+.L.end.compile.1:
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-65]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.loc 1 985 3
+  lea r10, [rbp-65]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.else.compile.2
+.loc 1 986 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset capture_output
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.compile.2
+.L.else.compile.2:
+.loc 1 988 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset open_output
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.compile.2:
+.loc 1 991 3
+  mov r10, offset cache_dir
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.compile.4
+  mov r10, offset preprocess_only
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.compile.4
+  mov r10, 1
+  jmp .L.end.compile.4
+.L.false.compile.4:
+  mov r10, 0
+.L.end.compile.4:
+  cmp r10, 0
+  je .L.end.compile.3
+.loc 1 992 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset capture_output
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.compile.3:
+.loc 1 993 29
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset output_size
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 995 3
+  mov r10, offset include_pch
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.compile.5
+.loc 1 996 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset include_pch
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset read_pch
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.compile.5:
+.loc 1 999 32
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset read_file
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1001 3
+  mov r10, offset preprocess_only
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.compile.6
+.loc 1 1002 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset print_tokens
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1003 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset flush_output
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1004 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset print_reports
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1005 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset free_arena
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1006 5
+  jmp .L.return.compile
+.L.end.compile.6:
+.loc 1 1009 3
+  mov r10, offset cache_dir
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.else.compile.7
+.loc 1 1011 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset output_size
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1012 65
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset output_since
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  sub r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset cache_key
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1013 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset cache_lookup
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.compile.8
+.loc 1 1014 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_asm
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1015 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset output_since
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset output_size
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  sub r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset cache_store
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.compile.8:
+  jmp .L.end.compile.7
+.L.else.compile.7:
+.loc 1 1018 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_asm
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.compile.7:
+.loc 1 1021 3
+  lea r10, [rbp-65]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.else.compile.9
+.loc 1 1022 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset timer_start
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1023 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset take_output
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset assemble
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1024 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset timer_stop
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.compile.9
+.L.else.compile.9:
+.loc 1 1026 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset flush_output
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.compile.9:
+.loc 1 1029 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset print_reports
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1030 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset free_arena
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.compile:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+run_jobs:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 192
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 1040 58
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset nr_input_files
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset calloc
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-184]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1041 50
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset nr_input_files
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset calloc
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-176]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1042 15
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-164]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1043 18
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-160]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1044 17
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-156]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1048 20
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-152]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-152]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-152]
+  mov r12, 12
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-152]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-152]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1049 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-116]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.run_jobs.1:
+  lea r10, [rbp-116]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, offset nr_input_files
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.run_jobs.1
+.loc 1 1050 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset input_files
+  mov r10, [r10]
+  lea r11, [rbp-116]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_output
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-184]
+  mov r11, [r11]
+  lea r12, [rbp-116]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 8
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1051 48
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-152]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-184]
+  mov r10, [r10]
+  lea r11, [rbp-116]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_get
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-104]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1052 5
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.run_jobs.2
+.loc 1 1053 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.36
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset input_files
+  mov r10, [r10]
+  lea r11, [rbp-116]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+.loc 1 1054 20
+  lea r10, [rbp-184]
+  mov r10, [r10]
+  lea r11, [rbp-116]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+.loc 1 1053 7
+  mov r10, offset error
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.run_jobs.2:
+.loc 1 1055 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-152]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-184]
+  mov r10, [r10]
+  lea r11, [rbp-116]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset input_files
+  mov r10, [r10]
+  lea r11, [rbp-116]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_put
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.run_jobs.1:
+.loc 1 1049 39
+  lea r10, [rbp-116]
+  lea r11, [rbp-112]
+  mov [r11], r10
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.run_jobs.1
+.L.break.run_jobs.1:
+.loc 1 1058 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stdout
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset fflush
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1059 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset fflush
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1061 3
+.L.begin.run_jobs.3:
+  lea r10, [rbp-164]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, offset nr_input_files
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.run_jobs.4
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-160]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.run_jobs.4
+  mov r10, 0
+  jmp .L.end.run_jobs.4
+.L.true.run_jobs.4:
+  mov r10, 1
+.L.end.run_jobs.4:
+  cmp r10, 0
+  je .L.break.run_jobs.3
+.loc 1 1063 5
+  lea r10, [rbp-164]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, offset nr_input_files
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.run_jobs.6
+  lea r10, [rbp-160]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, offset nr_jobs
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.run_jobs.6
+  mov r10, 1
+  jmp .L.end.run_jobs.6
+.L.false.run_jobs.6:
+  mov r10, 0
+.L.end.run_jobs.6:
+  cmp r10, 0
+  je .L.end.run_jobs.5
+.loc 1 1064 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset fork
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-92]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1065 7
+  lea r10, [rbp-92]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.run_jobs.7
+.loc 1 1066 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.37
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset __errno_location
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset strerror
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.run_jobs.7:
+.loc 1 1068 7
+  lea r10, [rbp-92]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.run_jobs.8
+.loc 1 1069 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset input_files
+  mov r10, [r10]
+  lea r11, [rbp-164]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-184]
+  mov r10, [r10]
+  lea r11, [rbp-164]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset compile
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1070 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset exit
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.run_jobs.8:
+.loc 1 1073 7
+  lea r10, [rbp-92]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-176]
+  mov r11, [r11]
+  lea r12, [rbp-164]
+  lea r13, [rbp-88]
+  mov [r13], r12
+  lea r12, [rbp-88]
+  mov r12, [r12]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  add r12d, r13d
+  mov r12d, r12d
+  lea r13, [rbp-88]
+  mov r13, [r13]
+  mov [r13], r12d
+  lea r12, [rbp-88]
+  mov r12, [r12]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, -1
+  mov r13d, r13d
+  add r12d, r13d
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1074 7
+  lea r10, [rbp-160]
+  lea r11, [rbp-80]
+  mov [r11], r10
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.loc 1 1075 7
+  jmp .L.continue.run_jobs.3
+.L.end.run_jobs.5:
+.loc 1 1079 15
+.loc 1 1080 38
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset waitpid
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-68]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1081 5
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.run_jobs.9
+.loc 1 1082 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.38
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset __errno_location
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset strerror
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.run_jobs.9:
+.loc 1 1083 5
+  lea r10, [rbp-160]
+  lea r11, [rbp-64]
+  mov [r11], r10
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+.loc 1 1085 5
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.run_jobs.10:
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-164]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.run_jobs.10
+.loc 1 1086 7
+  lea r10, [rbp-176]
+  mov r10, [r10]
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-68]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.run_jobs.11
+.loc 1 1087 9
+  jmp .L.continue.run_jobs.10
+.L.end.run_jobs.11:
+.loc 1 1088 7
+  lea r10, [rbp-72]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.run_jobs.12
+.loc 1 1089 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.39
+  push r10
+  sub rsp, 8
+  mov r10, offset input_files
+  mov r10, [r10]
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1090 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-184]
+  mov r10, [r10]
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset unlink
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1091 9
+  lea r10, [rbp-156]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.end.run_jobs.12:
+.loc 1 1093 7
+  jmp .L.break.run_jobs.10
+.L.continue.run_jobs.10:
+.loc 1 1085 31
+  lea r10, [rbp-52]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.run_jobs.10
+.L.break.run_jobs.10:
+.L.continue.run_jobs.3:
+  jmp .L.begin.run_jobs.3
+.L.break.run_jobs.3:
+.loc 1 1097 3
+  lea r10, [rbp-156]
+  mov r10d, dword ptr [r10]
+  cmp r10, 0
+  je  .L.else.run_jobs.13
+  mov r10, 1
+  mov r10d, r10d
+  jmp .L.end.run_jobs.13
+.L.else.run_jobs.13:
+  mov r10, 0
+  mov r10d, r10d
+.L.end.run_jobs.13:
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.run_jobs
+.L.return.run_jobs:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl main
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-52], edi
+.loc 1 1103 3
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 3
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.main.2
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.40
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.main.2
+  mov r10, 1
+  jmp .L.end.main.2
+.L.false.main.2:
+  mov r10, 0
+.L.end.main.2:
+  cmp r10, 0
+  je .L.else.main.1
+.loc 1 1104 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-52]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  mov r10, offset run_server
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.main.1
+.L.else.main.1:
+.loc 1 1105 8
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.main.4
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.41
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.main.4
+  mov r10, 1
+  jmp .L.end.main.4
+.L.false.main.4:
+  mov r10, 0
+.L.end.main.4:
+  cmp r10, 0
+  je .L.end.main.3
+.loc 1 1106 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset run_client
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.main
+.L.end.main.3:
+.L.end.main.1:
+.loc 1 1108 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset parse_args
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1110 14
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1111 3
+  mov r10, offset emit_pch
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.else.main.5
+.loc 1 1112 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset input_files
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset output_path
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset compile_pch
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.main.5
+.L.else.main.5:
+.loc 1 1113 8
+  mov r10, 1
+  mov r10d, r10d
+  mov r11, offset nr_input_files
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.main.6
+.loc 1 1114 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset run_jobs
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov [r11], r10d
+  jmp .L.end.main.6
+.L.else.main.6:
+.loc 1 1115 8
+  mov r10, offset nr_input_files
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.main.7
+.loc 1 1117 5
+  mov r10, offset nr_jobs
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, offset codegen_jobs
+  mov [r11], r10d
+.loc 1 1118 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset input_files
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset input_files
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_output
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset compile
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.main.7:
+.L.end.main.6:
+.L.end.main.5:
+.loc 1 1121 3
+  mov r10, offset cache_stats
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.main.8
+.loc 1 1122 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset print_cache_stats
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.main.8:
+.loc 1 1123 3
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.main
+.L.return.main:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
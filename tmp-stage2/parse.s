@@ -0,0 +1,31348 @@
+.file 1 "parse.c"
+.intel_syntax noprefix
+.bss
+.align 8
+current_switch:
+  .zero 8
+.align 8
+nr_nodes:
+  .zero 8
+.align 8
+current_fn:
+  .zero 8
+.align 4
+scope_depth:
+  .zero 4
+.align 8
+tag_scope:
+  .zero 8
+.align 8
+var_scope:
+  .zero 8
+.align 8
+globals:
+  .zero 8
+.align 8
+locals:
+  .zero 8
+.data
+.align 1
+.L.data.35:
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 110
+  .byte 97
+  .byte 109
+  .byte 101
+  .byte 32
+  .byte 111
+  .byte 109
+  .byte 105
+  .byte 116
+  .byte 116
+  .byte 101
+  .byte 100
+  .zero 1
+.align 1
+.L.data.34:
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 110
+  .byte 97
+  .byte 109
+  .byte 101
+  .byte 32
+  .byte 111
+  .byte 109
+  .byte 105
+  .byte 116
+  .byte 116
+  .byte 101
+  .byte 100
+  .zero 1
+.align 1
+.L.data.33:
+  .byte 95
+  .byte 95
+  .byte 98
+  .byte 117
+  .byte 105
+  .byte 108
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 95
+  .byte 118
+  .byte 97
+  .byte 95
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 114
+  .byte 116
+  .zero 1
+.align 1
+.L.data.32:
+  .byte 101
+  .byte 120
+  .byte 112
+  .byte 101
+  .byte 99
+  .byte 116
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 101
+  .byte 120
+  .byte 112
+  .byte 114
+  .byte 101
+  .byte 115
+  .byte 115
+  .byte 105
+  .byte 111
+  .byte 110
+  .zero 1
+.align 1
+.L.data.31:
+  .byte 117
+  .byte 110
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 105
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 118
+  .byte 97
+  .byte 114
+  .byte 105
+  .byte 97
+  .byte 98
+  .byte 108
+  .byte 101
+  .zero 1
+.align 1
+.L.data.30:
+  .byte 105
+  .byte 109
+  .byte 112
+  .byte 108
+  .byte 105
+  .byte 99
+  .byte 105
+  .byte 116
+  .byte 32
+  .byte 100
+  .byte 101
+  .byte 99
+  .byte 108
+  .byte 97
+  .byte 114
+  .byte 97
+  .byte 116
+  .byte 105
+  .byte 111
+  .byte 110
+  .byte 32
+  .byte 111
+  .byte 102
+  .byte 32
+  .byte 97
+  .byte 32
+  .byte 102
+  .byte 117
+  .byte 110
+  .byte 99
+  .byte 116
+  .byte 105
+  .byte 111
+  .byte 110
+  .zero 1
+.align 1
+.L.data.29:
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 116
+  .byte 101
+  .byte 109
+  .byte 101
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 101
+  .byte 120
+  .byte 112
+  .byte 114
+  .byte 101
+  .byte 115
+  .byte 115
+  .byte 105
+  .byte 111
+  .byte 110
+  .byte 32
+  .byte 114
+  .byte 101
+  .byte 116
+  .byte 117
+  .byte 114
+  .byte 110
+  .byte 105
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 118
+  .byte 111
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 105
+  .byte 115
+  .byte 32
+  .byte 110
+  .byte 111
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 117
+  .byte 112
+  .byte 112
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 101
+  .byte 100
+  .zero 1
+.align 1
+.L.data.28:
+  .byte 110
+  .byte 111
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 32
+  .byte 102
+  .byte 117
+  .byte 110
+  .byte 99
+  .byte 116
+  .byte 105
+  .byte 111
+  .byte 110
+  .zero 1
+.align 1
+.L.data.27:
+  .zero 1
+.align 1
+.L.data.26:
+  .byte 110
+  .byte 111
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .zero 1
+.align 1
+.L.data.25:
+  .byte 110
+  .byte 111
+  .byte 32
+  .byte 115
+  .byte 117
+  .byte 99
+  .byte 104
+  .byte 32
+  .byte 109
+  .byte 101
+  .byte 109
+  .byte 98
+  .byte 101
+  .byte 114
+  .zero 1
+.align 1
+.L.data.24:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 111
+  .byte 112
+  .byte 101
+  .byte 114
+  .byte 97
+  .byte 110
+  .byte 100
+  .byte 115
+  .zero 1
+.align 1
+.L.data.23:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 111
+  .byte 112
+  .byte 101
+  .byte 114
+  .byte 97
+  .byte 110
+  .byte 100
+  .byte 115
+  .zero 1
+.align 1
+.L.data.22:
+  .zero 1
+.align 1
+.L.data.21:
+  .byte 110
+  .byte 111
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 101
+  .byte 120
+  .byte 112
+  .byte 114
+  .byte 101
+  .byte 115
+  .byte 115
+  .byte 105
+  .byte 111
+  .byte 110
+  .zero 1
+.align 1
+.L.data.20:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 105
+  .byte 116
+  .byte 105
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 114
+  .zero 1
+.align 1
+.L.data.19:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 105
+  .byte 116
+  .byte 105
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 114
+  .zero 1
+.align 1
+.L.data.18:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 97
+  .byte 121
+  .byte 32
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 97
+  .byte 117
+  .byte 108
+  .byte 116
+  .zero 1
+.align 1
+.L.data.17:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 97
+  .byte 121
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .zero 1
+.align 1
+.L.data.16:
+  .byte 101
+  .byte 120
+  .byte 99
+  .byte 101
+  .byte 115
+  .byte 115
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 101
+  .byte 109
+  .byte 101
+  .byte 110
+  .byte 116
+  .byte 115
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 105
+  .byte 116
+  .byte 105
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 114
+  .zero 1
+.align 1
+.L.data.15:
+  .byte 118
+  .byte 97
+  .byte 114
+  .byte 105
+  .byte 97
+  .byte 98
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 100
+  .byte 101
+  .byte 108
+  .byte 97
+  .byte 114
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 118
+  .byte 111
+  .byte 105
+  .byte 100
+  .zero 1
+.align 1
+.L.data.14:
+  .byte 118
+  .byte 97
+  .byte 114
+  .byte 105
+  .byte 97
+  .byte 98
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 100
+  .byte 101
+  .byte 99
+  .byte 108
+  .byte 97
+  .byte 114
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 118
+  .byte 111
+  .byte 105
+  .byte 100
+  .zero 1
+.align 1
+.L.data.13:
+  .byte 110
+  .byte 111
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 110
+  .byte 32
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 116
+  .byte 97
+  .byte 103
+  .zero 1
+.align 1
+.L.data.12:
+  .byte 117
+  .byte 110
+  .byte 107
+  .byte 110
+  .byte 111
+  .byte 119
+  .byte 110
+  .byte 32
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .zero 1
+.align 1
+.L.data.11:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .zero 1
+.align 1
+.L.data.10:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 110
+  .byte 97
+  .byte 108
+  .byte 32
+  .byte 101
+  .byte 114
+  .byte 114
+  .byte 111
+  .byte 114
+  .zero 1
+.align 1
+.L.data.9:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 97
+  .byte 115
+  .byte 32
+  .byte 105
+  .byte 115
+  .byte 32
+  .byte 110
+  .byte 111
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 111
+  .byte 119
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 32
+  .byte 116
+  .byte 104
+  .byte 105
+  .byte 115
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 101
+  .byte 120
+  .byte 116
+  .zero 1
+.align 1
+.L.data.8:
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 97
+  .byte 110
+  .byte 100
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 116
+  .byte 105
+  .byte 99
+  .byte 32
+  .byte 109
+  .byte 97
+  .byte 121
+  .byte 32
+  .byte 110
+  .byte 111
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 101
+  .byte 32
+  .byte 117
+  .byte 115
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 116
+  .byte 111
+  .byte 103
+  .byte 101
+  .byte 116
+  .byte 104
+  .byte 101
+  .byte 114
+  .byte 46
+  .zero 1
+.align 1
+.L.data.7:
+  .byte 115
+  .byte 116
+  .byte 111
+  .byte 114
+  .byte 97
+  .byte 103
+  .byte 101
+  .byte 32
+  .byte 99
+  .byte 108
+  .byte 97
+  .byte 115
+  .byte 115
+  .byte 32
+  .byte 115
+  .byte 112
+  .byte 101
+  .byte 99
+  .byte 105
+  .byte 102
+  .byte 105
+  .byte 101
+  .byte 114
+  .byte 32
+  .byte 105
+  .byte 115
+  .byte 32
+  .byte 110
+  .byte 111
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 111
+  .byte 119
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 32
+  .byte 116
+  .byte 104
+  .byte 105
+  .byte 115
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 101
+  .byte 120
+  .byte 116
+  .zero 1
+.align 1
+.L.data.6:
+  .byte 112
+  .byte 97
+  .byte 114
+  .byte 97
+  .byte 109
+  .byte 101
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 32
+  .byte 110
+  .byte 97
+  .byte 109
+  .byte 101
+  .byte 32
+  .byte 111
+  .byte 109
+  .byte 105
+  .byte 116
+  .byte 116
+  .byte 101
+  .byte 100
+  .zero 1
+.align 1
+.L.data.5:
+  .byte 102
+  .byte 117
+  .byte 110
+  .byte 99
+  .byte 116
+  .byte 105
+  .byte 111
+  .byte 110
+  .byte 32
+  .byte 110
+  .byte 97
+  .byte 109
+  .byte 101
+  .byte 32
+  .byte 111
+  .byte 109
+  .byte 105
+  .byte 116
+  .byte 116
+  .byte 101
+  .byte 100
+  .zero 1
+.align 1
+.L.data.4:
+  .byte 101
+  .byte 120
+  .byte 112
+  .byte 101
+  .byte 99
+  .byte 116
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 97
+  .byte 32
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 98
+  .byte 101
+  .byte 114
+  .zero 1
+.align 1
+.L.data.3:
+  .byte 101
+  .byte 120
+  .byte 112
+  .byte 101
+  .byte 99
+  .byte 116
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 97
+  .byte 110
+  .byte 32
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 102
+  .byte 105
+  .byte 101
+  .byte 114
+  .zero 1
+.align 1
+.L.data.2:
+  .byte 101
+  .byte 120
+  .byte 112
+  .byte 101
+  .byte 99
+  .byte 116
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 39
+  .byte 125
+  .byte 39
+  .zero 1
+.align 1
+.L.data.1:
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 100
+  .byte 97
+  .byte 116
+  .byte 97
+  .byte 46
+  .byte 37
+  .byte 100
+  .zero 1
+.align 4
+.L.data.0:
+  .long 0
+.text
+assert:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.L.return.assert:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+va_end:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.L.return.va_end:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+enter_scope:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 875 3
+  mov r10, offset scope_depth
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.return.enter_scope:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+leave_scope:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 879 3
+  mov r10, offset scope_depth
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+.loc 1 881 3
+.L.begin.leave_scope.1:
+  mov r10, offset var_scope
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.leave_scope.2
+  mov r10, offset scope_depth
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, offset var_scope
+  mov r11, [r11]
+  add r11, 16
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.leave_scope.2
+  mov r10, 1
+  jmp .L.end.leave_scope.2
+.L.false.leave_scope.2:
+  mov r10, 0
+.L.end.leave_scope.2:
+  cmp r10, 0
+  je .L.break.leave_scope.1
+.loc 1 882 5
+  mov r10, offset var_scope
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  mov r11, offset var_scope
+  mov [r11], r10
+.L.continue.leave_scope.1:
+  jmp .L.begin.leave_scope.1
+.L.break.leave_scope.1:
+.loc 1 884 3
+.L.begin.leave_scope.3:
+  mov r10, offset tag_scope
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.leave_scope.4
+  mov r10, offset scope_depth
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, offset tag_scope
+  mov r11, [r11]
+  add r11, 16
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.leave_scope.4
+  mov r10, 1
+  jmp .L.end.leave_scope.4
+.L.false.leave_scope.4:
+  mov r10, 0
+.L.end.leave_scope.4:
+  cmp r10, 0
+  je .L.break.leave_scope.3
+.loc 1 885 5
+  mov r10, offset tag_scope
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  mov r11, offset tag_scope
+  mov [r11], r10
+.L.continue.leave_scope.3:
+  jmp .L.begin.leave_scope.3
+.L.break.leave_scope.3:
+.L.return.leave_scope:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+find_var:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdi
+.loc 1 890 3
+  mov r10, offset var_scope
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.find_var.1:
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.find_var.1
+.loc 1 891 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 32
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.find_var.2
+.loc 1 892 7
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.find_var
+.L.end.find_var.2:
+.L.continue.find_var.1:
+.loc 1 890 38
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  jmp .L.begin.find_var.1
+.L.break.find_var.1:
+.loc 1 893 3
+  mov r10, 0
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.find_var
+.L.return.find_var:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+find_tag:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdi
+.loc 1 897 3
+  mov r10, offset tag_scope
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.find_tag.1:
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.find_tag.1
+.loc 1 898 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 32
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.find_tag.2
+.loc 1 899 7
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.find_tag
+.L.end.find_tag.2:
+.L.continue.find_tag.1:
+.loc 1 897 38
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  jmp .L.begin.find_tag.1
+.L.break.find_tag.1:
+.loc 1 900 3
+  mov r10, 0
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.find_tag
+.L.return.find_tag:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+new_node:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-56], rsi
+  mov [rbp-60], edi
+.loc 1 904 48
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 184
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 905 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset timer_count
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 906 3
+  mov r10, offset nr_nodes
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+.loc 1 907 3
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10d
+.loc 1 908 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10
+.loc 1 909 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.new_node
+.L.return.new_node:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+new_binary:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rcx
+  mov [rbp-56], rdx
+  mov [rbp-64], rsi
+  mov [rbp-68], edi
+.loc 1 913 35
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 914 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+.loc 1 915 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.loc 1 916 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.new_binary
+.L.return.new_binary:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+new_unary:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdx
+  mov [rbp-56], rsi
+  mov [rbp-60], edi
+.loc 1 920 35
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 921 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+.loc 1 922 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.new_unary
+.L.return.new_unary:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+new_num:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 926 37
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 39
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 927 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 176
+  mov [r11], r10
+.loc 1 928 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.new_num
+.L.return.new_num:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+new_ulong:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 932 37
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 39
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 933 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 176
+  mov [r11], r10
+.loc 1 934 3
+  mov r10, offset ty_ulong
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 935 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.new_ulong
+.L.return.new_ulong:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+new_var_node:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 939 37
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 38
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 940 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 168
+  mov [r11], r10
+.loc 1 941 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.new_var_node
+.L.return.new_var_node:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl new_cast
+new_cast:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-56], rsi
+  mov [rbp-64], rdi
+.loc 1 945 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 947 48
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 184
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 948 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset timer_count
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 949 3
+  mov r10, offset nr_nodes
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+.loc 1 950 3
+  mov r10, 40
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10d
+.loc 1 951 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10
+.loc 1 952 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+.loc 1 953 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset copy_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 954 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.new_cast
+.L.return.new_cast:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+push_scope:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdi
+.loc 1 958 59
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 56
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 959 3
+  mov r10, offset var_scope
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 960 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 961 3
+  mov r10, offset scope_depth
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10d
+.loc 1 962 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, offset var_scope
+  mov [r11], r10
+.loc 1 963 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.push_scope
+.L.return.push_scope:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+new_init:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rcx
+  mov [rbp-56], rdx
+  mov [rbp-60], esi
+  mov [rbp-72], rdi
+.loc 1 967 69
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 10
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 40
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 968 3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 969 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 970 3
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10d
+.loc 1 971 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10
+.loc 1 972 3
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  cmp r10, 0
+  je .L.end.new_init.1
+.loc 1 973 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 10
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  movabs r11, 8
+  imul r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+.L.end.new_init.1:
+.loc 1 974 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.new_init
+.L.return.new_init:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+new_lvar:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 978 44
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 80
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 979 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 980 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 981 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 36
+  mov [r11], r10d
+.loc 1 982 3
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10b
+.loc 1 983 3
+  mov r10, offset locals
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 984 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, offset locals
+  mov [r11], r10
+.loc 1 985 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset push_scope
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  add r11, 24
+  mov [r11], r10
+.loc 1 986 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.new_lvar
+.L.return.new_lvar:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+new_gvar:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-41], cl
+  mov [rbp-42], dl
+  mov [rbp-56], rsi
+  mov [rbp-64], rdi
+.loc 1 990 44
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 80
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 991 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 992 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 993 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 36
+  mov [r11], r10d
+.loc 1 994 3
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10b
+.loc 1 995 3
+  lea r10, [rbp-42]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10b
+.loc 1 996 3
+  lea r10, [rbp-41]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.new_gvar.1
+.loc 1 997 5
+  mov r10, offset globals
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 998 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, offset globals
+  mov [r11], r10
+.L.end.new_gvar.1:
+.loc 1 1000 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset push_scope
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  add r11, 24
+  mov [r11], r10
+.loc 1 1001 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.new_gvar
+.L.return.new_gvar:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+new_label:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 1005 21
+.loc 1 1006 39
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 12
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 20
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1007 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.1
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.0
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  push r10
+  sub rsp, 8
+  mov r10, offset sprintf
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1008 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.new_label
+.L.return.new_label:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+new_string_literal:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-52], esi
+  mov [rbp-64], rdi
+.loc 1 1012 40
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset ty_char
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset array_of
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1013 45
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset new_label
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset new_gvar
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1014 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset gvar_init_string
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 48
+  mov [r11], r10
+.loc 1 1015 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.new_string_literal
+.L.return.new_string_literal:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+is_end:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 1019 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 68
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.is_end.1
+.loc 1 1020 31
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 72
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.is_end.2
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 68
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.is_end.2
+  mov r10, 1
+  jmp .L.end.is_end.2
+.L.false.is_end.2:
+  mov r10, 0
+.L.end.is_end.2:
+  cmp r10, 0
+  jne .L.true.is_end.1
+  mov r10, 0
+  jmp .L.end.is_end.1
+.L.true.is_end.1:
+  mov r10, 1
+.L.end.is_end.1:
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.is_end
+.L.return.is_end:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+expect_end:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 1024 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 68
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.expect_end.1
+.loc 1 1025 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.expect_end
+.L.end.expect_end.1:
+.loc 1 1026 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 72
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.expect_end.3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 68
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.expect_end.3
+  mov r10, 1
+  jmp .L.end.expect_end.3
+.L.false.expect_end.3:
+  mov r10, 0
+.L.end.expect_end.3:
+  cmp r10, 0
+  je .L.end.expect_end.2
+.loc 1 1027 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.expect_end
+.L.end.expect_end.2:
+.loc 1 1028 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.2
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.expect_end:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+get_ident:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 1032 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.get_ident.1
+.loc 1 1033 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.3
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.get_ident.1:
+.loc 1 1034 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.get_ident
+.L.return.get_ident:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+find_typedef:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdi
+.loc 1 1038 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.find_typedef.1
+.loc 1 1039 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset find_var
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1040 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.find_typedef.2
+.loc 1 1041 7
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.find_typedef
+.L.end.find_typedef.2:
+.L.end.find_typedef.1:
+.loc 1 1043 3
+  mov r10, 0
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.find_typedef
+.L.return.find_typedef:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+get_number:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 1047 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 3
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.get_number.1
+.loc 1 1048 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.4
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.get_number.1:
+.loc 1 1049 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 64
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.get_number
+.L.return.get_number:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+push_tag_scope:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 1053 59
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 32
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1054 3
+  mov r10, offset tag_scope
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 1055 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 1056 3
+  mov r10, offset scope_depth
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10d
+.loc 1 1057 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10
+.loc 1 1058 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, offset tag_scope
+  mov [r11], r10
+.L.return.push_tag_scope:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+funcdef:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-80], rsi
+  mov [rbp-88], rdi
+.loc 1 1063 3
+  mov r10, 0
+  movsx r10, r10d
+  mov r11, offset locals
+  mov [r11], r10
+.loc 1 1065 20
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-72]
+  mov r12, 1
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-72]
+  mov r12, 2
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-72]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1066 40
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  push r10
+  sub rsp, 8
+  mov r10, offset typespec
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1067 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset declarator
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov [r11], r10
+.loc 1 1069 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.funcdef.1
+.loc 1 1070 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.5
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.funcdef.1:
+.loc 1 1072 58
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 9
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 64
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1073 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_ident
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 1074 3
+  lea r10, [rbp-72]
+  add r10, 1
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10b
+.loc 1 1075 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 72
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 25
+  mov [r11], r10b
+.loc 1 1077 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset enter_scope
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1078 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 64
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.funcdef.2:
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.funcdef.2
+.loc 1 1079 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.funcdef.3
+.loc 1 1080 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.6
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.funcdef.3:
+.loc 1 1081 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_ident
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_lvar
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.funcdef.2:
+.loc 1 1078 33
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 80
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  jmp .L.begin.funcdef.2
+.L.break.funcdef.2:
+.loc 1 1083 3
+  mov r10, offset locals
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 1085 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 67
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-80]
+  mov [r11], r10
+.loc 1 1086 24
+  mov r10, offset nr_nodes
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1087 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset compound_stmt
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  add r10, 96
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+.loc 1 1088 3
+  mov r10, offset nr_nodes
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  sub r10, r11
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 56
+  mov [r11], r10
+.loc 1 1089 3
+  mov r10, offset locals
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.loc 1 1090 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset leave_scope
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1091 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.funcdef
+.L.return.funcdef:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+typespec:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 160
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-136], rdx
+  mov [rbp-144], rsi
+  mov [rbp-152], rdi
+.loc 1 1124 4
+.loc 1 1126 20
+  mov r10, offset ty_int
+  mov r10, [r10]
+  lea r11, [rbp-128]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1127 18
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-120]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1128 21
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-113]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.loc 1 1130 3
+.L.begin.typespec.1:
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_typename
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.break.typespec.1
+.loc 1 1132 5
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 14
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.typespec.4
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 17
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.typespec.4
+  mov r10, 0
+  jmp .L.end.typespec.4
+.L.true.typespec.4:
+  mov r10, 1
+.L.end.typespec.4:
+  cmp r10, 0
+  jne .L.true.typespec.3
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 24
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.typespec.3
+  mov r10, 0
+  jmp .L.end.typespec.3
+.L.true.typespec.3:
+  mov r10, 1
+.L.end.typespec.3:
+  cmp r10, 0
+  je .L.end.typespec.2
+.loc 1 1133 7
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.typespec.5
+.loc 1 1134 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.7
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.typespec.5:
+.loc 1 1136 7
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 14
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.typespec.6
+.loc 1 1137 9
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-136]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10b
+  jmp .L.end.typespec.6
+.L.else.typespec.6:
+.loc 1 1138 12
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 17
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.typespec.7
+.loc 1 1139 9
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-136]
+  mov r11, [r11]
+  add r11, 1
+  mov [r11], r10b
+  jmp .L.end.typespec.7
+.L.else.typespec.7:
+.loc 1 1141 9
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-136]
+  mov r11, [r11]
+  add r11, 2
+  mov [r11], r10b
+.L.end.typespec.7:
+.L.end.typespec.6:
+.loc 1 1143 7
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-136]
+  mov r11, [r11]
+  add r11, 0
+  movsx r11d, byte ptr [r11]
+  mov r11d, r11d
+  lea r12, [rbp-136]
+  mov r12, [r12]
+  add r12, 1
+  movsx r12d, byte ptr [r12]
+  mov r12d, r12d
+  add r11d, r12d
+  mov r11d, r11d
+  lea r12, [rbp-136]
+  mov r12, [r12]
+  add r12, 2
+  movsx r12d, byte ptr [r12]
+  mov r12d, r12d
+  add r11d, r12d
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.typespec.8
+.loc 1 1144 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.8
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.typespec.8:
+.loc 1 1145 7
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-144]
+  mov [r11], r10
+.loc 1 1146 7
+  jmp .L.continue.typespec.1
+.L.end.typespec.2:
+.loc 1 1149 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-144]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 30
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset consume
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.typespec.9
+.loc 1 1150 7
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-113]
+  mov [r11], r10b
+.loc 1 1151 7
+  jmp .L.continue.typespec.1
+.L.end.typespec.9:
+.loc 1 1154 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-144]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 31
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset consume
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.typespec.10
+.loc 1 1155 7
+  jmp .L.continue.typespec.1
+.L.end.typespec.10:
+.loc 1 1158 5
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 26
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.typespec.11
+.loc 1 1159 7
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.typespec.12
+.loc 1 1160 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.9
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.typespec.12:
+.loc 1 1161 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 65
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-144]
+  mov [r11], r10
+.loc 1 1163 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_typename
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.else.typespec.13
+.loc 1 1164 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-144]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset typename
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-136]
+  mov r11, [r11]
+  add r11, 4
+  mov [r11], r10d
+  jmp .L.end.typespec.13
+.L.else.typespec.13:
+.loc 1 1166 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-144]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset const_expr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-136]
+  mov r11, [r11]
+  add r11, 4
+  mov [r11], r10d
+.L.end.typespec.13:
+.loc 1 1167 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 66
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-144]
+  mov [r11], r10
+.loc 1 1168 7
+  jmp .L.continue.typespec.1
+.L.end.typespec.11:
+.loc 1 1172 34
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset find_typedef
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-112]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1173 5
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 9
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.typespec.17
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.typespec.17
+  mov r10, 0
+  jmp .L.end.typespec.17
+.L.true.typespec.17:
+  mov r10, 1
+.L.end.typespec.17:
+  cmp r10, 0
+  jne .L.true.typespec.16
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 16
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.typespec.16
+  mov r10, 0
+  jmp .L.end.typespec.16
+.L.true.typespec.16:
+  mov r10, 1
+.L.end.typespec.16:
+  cmp r10, 0
+  jne .L.true.typespec.15
+.loc 1 1174 9
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  cmp r10, 0
+  jne .L.true.typespec.15
+  mov r10, 0
+  jmp .L.end.typespec.15
+.L.true.typespec.15:
+  mov r10, 1
+.L.end.typespec.15:
+  cmp r10, 0
+  je .L.end.typespec.14
+.loc 1 1175 7
+  lea r10, [rbp-120]
+  mov r10d, dword ptr [r10]
+  cmp r10, 0
+  je .L.end.typespec.18
+.loc 1 1176 9
+  jmp .L.break.typespec.1
+.L.end.typespec.18:
+.loc 1 1178 7
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 9
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.typespec.19
+.loc 1 1179 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-144]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset struct_decl
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-128]
+  mov [r11], r10
+  jmp .L.end.typespec.19
+.L.else.typespec.19:
+.loc 1 1180 14
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.typespec.20
+.loc 1 1181 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-144]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset union_decl
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-128]
+  mov [r11], r10
+  jmp .L.end.typespec.20
+.L.else.typespec.20:
+.loc 1 1182 14
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 16
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.typespec.21
+.loc 1 1183 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-144]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset enum_specifier
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-128]
+  mov [r11], r10
+  jmp .L.end.typespec.21
+.L.else.typespec.21:
+.loc 1 1185 9
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  lea r11, [rbp-128]
+  mov [r11], r10
+.loc 1 1186 9
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-144]
+  mov [r11], r10
+.L.end.typespec.21:
+.L.end.typespec.20:
+.L.end.typespec.19:
+.loc 1 1189 7
+  lea r10, [rbp-120]
+  lea r11, [rbp-104]
+  mov [r11], r10
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4096
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  mov [r11], r10d
+.loc 1 1190 7
+  jmp .L.continue.typespec.1
+.L.end.typespec.14:
+.loc 1 1194 5
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 13
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.typespec.22
+.loc 1 1195 7
+  lea r10, [rbp-120]
+  lea r11, [rbp-96]
+  mov [r11], r10
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-96]
+  mov r11, [r11]
+  mov [r11], r10d
+  jmp .L.end.typespec.22
+.L.else.typespec.22:
+.loc 1 1196 10
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 15
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.typespec.23
+.loc 1 1197 7
+  lea r10, [rbp-120]
+  lea r11, [rbp-88]
+  mov [r11], r10
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  mov [r11], r10d
+  jmp .L.end.typespec.23
+.L.else.typespec.23:
+.loc 1 1198 10
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.typespec.24
+.loc 1 1199 7
+  lea r10, [rbp-120]
+  lea r11, [rbp-80]
+  mov [r11], r10
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 16
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  mov [r11], r10d
+  jmp .L.end.typespec.24
+.L.else.typespec.24:
+.loc 1 1200 10
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 11
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.typespec.25
+.loc 1 1201 7
+  lea r10, [rbp-120]
+  lea r11, [rbp-72]
+  mov [r11], r10
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 64
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  mov [r11], r10d
+  jmp .L.end.typespec.25
+.L.else.typespec.25:
+.loc 1 1202 10
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 6
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.typespec.26
+.loc 1 1203 7
+  lea r10, [rbp-120]
+  lea r11, [rbp-64]
+  mov [r11], r10
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 256
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov [r11], r10d
+  jmp .L.end.typespec.26
+.L.else.typespec.26:
+.loc 1 1204 10
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 12
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.typespec.27
+.loc 1 1205 7
+  lea r10, [rbp-120]
+  lea r11, [rbp-56]
+  mov [r11], r10
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1024
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10d
+  jmp .L.end.typespec.27
+.L.else.typespec.27:
+.loc 1 1206 10
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 28
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.typespec.28
+.loc 1 1207 7
+  lea r10, [rbp-120]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 8192
+  mov r11d, r11d
+  or r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10d
+  jmp .L.end.typespec.28
+.L.else.typespec.28:
+.loc 1 1208 10
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 29
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.typespec.29
+.loc 1 1209 7
+  lea r10, [rbp-120]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 16384
+  mov r11d, r11d
+  or r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+  jmp .L.end.typespec.29
+.L.else.typespec.29:
+.loc 1 1211 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.10
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.typespec.29:
+.L.end.typespec.28:
+.L.end.typespec.27:
+.L.end.typespec.26:
+.L.end.typespec.25:
+.L.end.typespec.24:
+.L.end.typespec.23:
+.L.end.typespec.22:
+.loc 1 1213 5
+  lea r10, [rbp-120]
+  mov r10d, dword ptr [r10]
+  cmp r10, 17408
+  je .L.case.typespec.31
+  cmp r10, 17664
+  je .L.case.typespec.32
+  cmp r10, 18432
+  je .L.case.typespec.33
+  cmp r10, 18688
+  je .L.case.typespec.34
+  cmp r10, 9216
+  je .L.case.typespec.35
+  cmp r10, 9472
+  je .L.case.typespec.36
+  cmp r10, 10240
+  je .L.case.typespec.37
+  cmp r10, 10496
+  je .L.case.typespec.38
+  cmp r10, 1024
+  je .L.case.typespec.39
+  cmp r10, 1280
+  je .L.case.typespec.40
+  cmp r10, 2048
+  je .L.case.typespec.41
+  cmp r10, 2304
+  je .L.case.typespec.42
+  cmp r10, 16384
+  je .L.case.typespec.43
+  cmp r10, 16640
+  je .L.case.typespec.44
+  cmp r10, 256
+  je .L.case.typespec.45
+  cmp r10, 8192
+  je .L.case.typespec.46
+  cmp r10, 8448
+  je .L.case.typespec.47
+  cmp r10, 16448
+  je .L.case.typespec.48
+  cmp r10, 16704
+  je .L.case.typespec.49
+  cmp r10, 64
+  je .L.case.typespec.50
+  cmp r10, 320
+  je .L.case.typespec.51
+  cmp r10, 8256
+  je .L.case.typespec.52
+  cmp r10, 8512
+  je .L.case.typespec.53
+  cmp r10, 16400
+  je .L.case.typespec.54
+  cmp r10, 16
+  je .L.case.typespec.55
+  cmp r10, 8208
+  je .L.case.typespec.56
+  cmp r10, 4
+  je .L.case.typespec.57
+  cmp r10, 1
+  je .L.case.typespec.58
+  jmp .L.case.typespec.59
+  jmp .L.break.typespec.30
+.loc 1 1214 5
+.L.case.typespec.58:
+.loc 1 1215 7
+  mov r10, offset ty_void
+  mov r10, [r10]
+  lea r11, [rbp-128]
+  mov [r11], r10
+.loc 1 1216 7
+  jmp .L.break.typespec.30
+.loc 1 1217 5
+.L.case.typespec.57:
+.loc 1 1218 7
+  mov r10, offset ty_bool
+  mov r10, [r10]
+  lea r11, [rbp-128]
+  mov [r11], r10
+.loc 1 1219 7
+  jmp .L.break.typespec.30
+.loc 1 1220 5
+.L.case.typespec.55:
+.loc 1 1221 5
+.L.case.typespec.56:
+.loc 1 1222 7
+  mov r10, offset ty_char
+  mov r10, [r10]
+  lea r11, [rbp-128]
+  mov [r11], r10
+.loc 1 1223 7
+  jmp .L.break.typespec.30
+.loc 1 1224 5
+.L.case.typespec.54:
+.loc 1 1225 7
+  mov r10, offset ty_uchar
+  mov r10, [r10]
+  lea r11, [rbp-128]
+  mov [r11], r10
+.loc 1 1226 7
+  jmp .L.break.typespec.30
+.loc 1 1227 5
+.L.case.typespec.50:
+.loc 1 1228 5
+.L.case.typespec.51:
+.loc 1 1229 5
+.L.case.typespec.52:
+.loc 1 1230 5
+.L.case.typespec.53:
+.loc 1 1231 7
+  mov r10, offset ty_short
+  mov r10, [r10]
+  lea r11, [rbp-128]
+  mov [r11], r10
+.loc 1 1232 7
+  jmp .L.break.typespec.30
+.loc 1 1233 5
+.L.case.typespec.48:
+.loc 1 1234 5
+.L.case.typespec.49:
+.loc 1 1235 7
+  mov r10, offset ty_ushort
+  mov r10, [r10]
+  lea r11, [rbp-128]
+  mov [r11], r10
+.loc 1 1236 7
+  jmp .L.break.typespec.30
+.loc 1 1237 5
+.L.case.typespec.45:
+.loc 1 1238 5
+.L.case.typespec.46:
+.loc 1 1239 5
+.L.case.typespec.47:
+.loc 1 1240 7
+  mov r10, offset ty_int
+  mov r10, [r10]
+  lea r11, [rbp-128]
+  mov [r11], r10
+.loc 1 1241 7
+  jmp .L.break.typespec.30
+.loc 1 1242 5
+.L.case.typespec.43:
+.loc 1 1243 5
+.L.case.typespec.44:
+.loc 1 1244 7
+  mov r10, offset ty_uint
+  mov r10, [r10]
+  lea r11, [rbp-128]
+  mov [r11], r10
+.loc 1 1245 7
+  jmp .L.break.typespec.30
+.loc 1 1246 5
+.L.case.typespec.35:
+.loc 1 1247 5
+.L.case.typespec.36:
+.loc 1 1248 5
+.L.case.typespec.37:
+.loc 1 1249 5
+.L.case.typespec.38:
+.loc 1 1250 5
+.L.case.typespec.39:
+.loc 1 1251 5
+.L.case.typespec.40:
+.loc 1 1252 5
+.L.case.typespec.41:
+.loc 1 1253 5
+.L.case.typespec.42:
+.loc 1 1254 7
+  mov r10, offset ty_long
+  mov r10, [r10]
+  lea r11, [rbp-128]
+  mov [r11], r10
+.loc 1 1255 7
+  jmp .L.break.typespec.30
+.loc 1 1256 5
+.L.case.typespec.31:
+.loc 1 1257 5
+.L.case.typespec.32:
+.loc 1 1258 5
+.L.case.typespec.33:
+.loc 1 1259 5
+.L.case.typespec.34:
+.loc 1 1260 7
+  mov r10, offset ty_ulong
+  mov r10, [r10]
+  lea r11, [rbp-128]
+  mov [r11], r10
+.loc 1 1261 7
+  jmp .L.break.typespec.30
+.loc 1 1262 5
+.L.case.typespec.59:
+.loc 1 1263 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.11
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.break.typespec.30:
+.loc 1 1266 5
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-144]
+  mov [r11], r10
+.L.continue.typespec.1:
+  jmp .L.begin.typespec.1
+.L.break.typespec.1:
+.loc 1 1269 3
+  lea r10, [rbp-113]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.typespec.60
+.loc 1 1270 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset copy_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-128]
+  mov [r11], r10
+.loc 1 1271 5
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  add r11, 14
+  mov [r11], r10b
+.L.end.typespec.60:
+.loc 1 1274 3
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  lea r11, [rbp-152]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1275 3
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.typespec
+.L.return.typespec:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+func_params:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 176
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-160], rdx
+  mov [rbp-168], rsi
+  mov [rbp-176], rdi
+.loc 1 1281 3
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 13
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.func_params.2
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 66
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.func_params.2
+  mov r10, 1
+  jmp .L.end.func_params.2
+.L.false.func_params.2:
+  mov r10, 0
+.L.end.func_params.2:
+  cmp r10, 0
+  je .L.end.func_params.1
+.loc 1 1282 5
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-176]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1283 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset func_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.func_params
+.L.end.func_params.1:
+.loc 1 1286 17
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-152]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-152]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-152]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-152]
+  mov r12, 12
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-152]
+  mov r12, 13
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-152]
+  mov r12, 14
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-152]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-152]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-152]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-152]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-152]
+  mov r12, 48
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-152]
+  mov r12, 56
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-152]
+  mov r12, 64
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-152]
+  mov r12, 72
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-152]
+  mov r12, 80
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1287 20
+  lea r10, [rbp-152]
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1288 23
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-49]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.loc 1 1290 3
+.L.begin.func_params.3:
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 66
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.func_params.3
+.loc 1 1291 5
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  lea r11, [rbp-152]
+  cmp r10, r11
+  setne al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.func_params.4
+.loc 1 1292 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 72
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-168]
+  mov [r11], r10
+.L.end.func_params.4:
+.loc 1 1294 5
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 42
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.func_params.5
+.loc 1 1295 7
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-49]
+  mov [r11], r10b
+.loc 1 1296 7
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-168]
+  mov [r11], r10
+.loc 1 1297 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 66
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1298 7
+  jmp .L.break.func_params.3
+.L.end.func_params.5:
+.loc 1 1301 39
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-168]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset typespec
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1302 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-168]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset declarator
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov [r11], r10
+.loc 1 1306 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 9
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.func_params.6
+.loc 1 1307 7
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1308 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pointer_to
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov [r11], r10
+.loc 1 1309 7
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10
+.L.end.func_params.6:
+.loc 1 1312 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset copy_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 80
+  mov [r11], r10
+  lea r11, [rbp-64]
+  mov [r11], r10
+.L.continue.func_params.3:
+  jmp .L.begin.func_params.3
+.L.break.func_params.3:
+.loc 1 1315 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset func_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-160]
+  mov [r11], r10
+.loc 1 1316 3
+  lea r10, [rbp-152]
+  add r10, 80
+  mov r10, [r10]
+  lea r11, [rbp-160]
+  mov r11, [r11]
+  add r11, 64
+  mov [r11], r10
+.loc 1 1317 3
+  lea r10, [rbp-49]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-160]
+  mov r11, [r11]
+  add r11, 72
+  mov [r11], r10b
+.loc 1 1318 3
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-176]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1319 3
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.func_params
+.L.return.func_params:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+array_dimensions:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdx
+  mov [rbp-56], rsi
+  mov [rbp-64], rdi
+.loc 1 1324 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 70
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.array_dimensions.1
+.loc 1 1325 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset type_suffix
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov [r11], r10
+.loc 1 1326 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset array_of
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov [r11], r10
+.loc 1 1327 5
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 13
+  mov [r11], r10b
+.loc 1 1328 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.array_dimensions
+.L.end.array_dimensions.1:
+.loc 1 1331 33
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset const_expr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1332 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 70
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov [r11], r10
+.loc 1 1333 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset type_suffix
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov [r11], r10
+.loc 1 1334 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset array_of
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.array_dimensions
+.L.return.array_dimensions:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+type_suffix:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdx
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 1341 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 65
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.type_suffix.1
+.loc 1 1342 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset func_params
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.type_suffix
+.L.end.type_suffix.1:
+.loc 1 1344 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 69
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.type_suffix.2
+.loc 1 1345 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset array_dimensions
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.type_suffix
+.L.end.type_suffix.2:
+.loc 1 1347 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1348 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.type_suffix
+.L.return.type_suffix:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+pointers:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdx
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 1353 3
+.L.begin.pointers.1:
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 79
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset consume
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.break.pointers.1
+.loc 1 1354 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pointer_to
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 1355 5
+.L.begin.pointers.2:
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 30
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.pointers.3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 31
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.pointers.3
+  mov r10, 0
+  jmp .L.end.pointers.3
+.L.true.pointers.3:
+  mov r10, 1
+.L.end.pointers.3:
+  cmp r10, 0
+  je .L.break.pointers.2
+.loc 1 1356 7
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 30
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.pointers.4
+.loc 1 1357 9
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 14
+  mov [r11], r10b
+.L.end.pointers.4:
+.loc 1 1358 7
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov [r11], r10
+.L.continue.pointers.2:
+  jmp .L.begin.pointers.2
+.L.break.pointers.2:
+.L.continue.pointers.1:
+  jmp .L.begin.pointers.1
+.L.break.pointers.1:
+.loc 1 1361 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1362 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.pointers
+.L.return.pointers:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+declarator:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-72], rdx
+  mov [rbp-80], rsi
+  mov [rbp-88], rdi
+.loc 1 1367 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pointers
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-72]
+  mov [r11], r10
+.loc 1 1369 3
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 65
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.declarator.1
+.loc 1 1370 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 88
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1371 60
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset declarator
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1372 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 66
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-80]
+  mov [r11], r10
+.loc 1 1373 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset type_suffix
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov al, [r10+0]
+  mov [r11+0], al
+  mov al, [r10+1]
+  mov [r11+1], al
+  mov al, [r10+2]
+  mov [r11+2], al
+  mov al, [r10+3]
+  mov [r11+3], al
+  mov al, [r10+4]
+  mov [r11+4], al
+  mov al, [r10+5]
+  mov [r11+5], al
+  mov al, [r10+6]
+  mov [r11+6], al
+  mov al, [r10+7]
+  mov [r11+7], al
+  mov al, [r10+8]
+  mov [r11+8], al
+  mov al, [r10+9]
+  mov [r11+9], al
+  mov al, [r10+10]
+  mov [r11+10], al
+  mov al, [r10+11]
+  mov [r11+11], al
+  mov al, [r10+12]
+  mov [r11+12], al
+  mov al, [r10+13]
+  mov [r11+13], al
+  mov al, [r10+14]
+  mov [r11+14], al
+  mov al, [r10+15]
+  mov [r11+15], al
+  mov al, [r10+16]
+  mov [r11+16], al
+  mov al, [r10+17]
+  mov [r11+17], al
+  mov al, [r10+18]
+  mov [r11+18], al
+  mov al, [r10+19]
+  mov [r11+19], al
+  mov al, [r10+20]
+  mov [r11+20], al
+  mov al, [r10+21]
+  mov [r11+21], al
+  mov al, [r10+22]
+  mov [r11+22], al
+  mov al, [r10+23]
+  mov [r11+23], al
+  mov al, [r10+24]
+  mov [r11+24], al
+  mov al, [r10+25]
+  mov [r11+25], al
+  mov al, [r10+26]
+  mov [r11+26], al
+  mov al, [r10+27]
+  mov [r11+27], al
+  mov al, [r10+28]
+  mov [r11+28], al
+  mov al, [r10+29]
+  mov [r11+29], al
+  mov al, [r10+30]
+  mov [r11+30], al
+  mov al, [r10+31]
+  mov [r11+31], al
+  mov al, [r10+32]
+  mov [r11+32], al
+  mov al, [r10+33]
+  mov [r11+33], al
+  mov al, [r10+34]
+  mov [r11+34], al
+  mov al, [r10+35]
+  mov [r11+35], al
+  mov al, [r10+36]
+  mov [r11+36], al
+  mov al, [r10+37]
+  mov [r11+37], al
+  mov al, [r10+38]
+  mov [r11+38], al
+  mov al, [r10+39]
+  mov [r11+39], al
+  mov al, [r10+40]
+  mov [r11+40], al
+  mov al, [r10+41]
+  mov [r11+41], al
+  mov al, [r10+42]
+  mov [r11+42], al
+  mov al, [r10+43]
+  mov [r11+43], al
+  mov al, [r10+44]
+  mov [r11+44], al
+  mov al, [r10+45]
+  mov [r11+45], al
+  mov al, [r10+46]
+  mov [r11+46], al
+  mov al, [r10+47]
+  mov [r11+47], al
+  mov al, [r10+48]
+  mov [r11+48], al
+  mov al, [r10+49]
+  mov [r11+49], al
+  mov al, [r10+50]
+  mov [r11+50], al
+  mov al, [r10+51]
+  mov [r11+51], al
+  mov al, [r10+52]
+  mov [r11+52], al
+  mov al, [r10+53]
+  mov [r11+53], al
+  mov al, [r10+54]
+  mov [r11+54], al
+  mov al, [r10+55]
+  mov [r11+55], al
+  mov al, [r10+56]
+  mov [r11+56], al
+  mov al, [r10+57]
+  mov [r11+57], al
+  mov al, [r10+58]
+  mov [r11+58], al
+  mov al, [r10+59]
+  mov [r11+59], al
+  mov al, [r10+60]
+  mov [r11+60], al
+  mov al, [r10+61]
+  mov [r11+61], al
+  mov al, [r10+62]
+  mov [r11+62], al
+  mov al, [r10+63]
+  mov [r11+63], al
+  mov al, [r10+64]
+  mov [r11+64], al
+  mov al, [r10+65]
+  mov [r11+65], al
+  mov al, [r10+66]
+  mov [r11+66], al
+  mov al, [r10+67]
+  mov [r11+67], al
+  mov al, [r10+68]
+  mov [r11+68], al
+  mov al, [r10+69]
+  mov [r11+69], al
+  mov al, [r10+70]
+  mov [r11+70], al
+  mov al, [r10+71]
+  mov [r11+71], al
+  mov al, [r10+72]
+  mov [r11+72], al
+  mov al, [r10+73]
+  mov [r11+73], al
+  mov al, [r10+74]
+  mov [r11+74], al
+  mov al, [r10+75]
+  mov [r11+75], al
+  mov al, [r10+76]
+  mov [r11+76], al
+  mov al, [r10+77]
+  mov [r11+77], al
+  mov al, [r10+78]
+  mov [r11+78], al
+  mov al, [r10+79]
+  mov [r11+79], al
+  mov al, [r10+80]
+  mov [r11+80], al
+  mov al, [r10+81]
+  mov [r11+81], al
+  mov al, [r10+82]
+  mov [r11+82], al
+  mov al, [r10+83]
+  mov [r11+83], al
+  mov al, [r10+84]
+  mov [r11+84], al
+  mov al, [r10+85]
+  mov [r11+85], al
+  mov al, [r10+86]
+  mov [r11+86], al
+  mov al, [r10+87]
+  mov [r11+87], al
+.loc 1 1374 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.declarator
+.L.end.declarator.1:
+.loc 1 1377 18
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1378 24
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1380 3
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.declarator.2
+.loc 1 1381 5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov [r11], r10
+.loc 1 1382 5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov [r11], r10
+.L.end.declarator.2:
+.loc 1 1385 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset type_suffix
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-72]
+  mov [r11], r10
+.loc 1 1386 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10
+.loc 1 1387 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+.loc 1 1388 3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.declarator
+.L.return.declarator:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+abstract_declarator:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-56], rdx
+  mov [rbp-64], rsi
+  mov [rbp-72], rdi
+.loc 1 1393 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pointers
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov [r11], r10
+.loc 1 1395 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 65
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.abstract_declarator.1
+.loc 1 1396 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 88
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1397 69
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset abstract_declarator
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1398 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 66
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov [r11], r10
+.loc 1 1399 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset type_suffix
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov al, [r10+0]
+  mov [r11+0], al
+  mov al, [r10+1]
+  mov [r11+1], al
+  mov al, [r10+2]
+  mov [r11+2], al
+  mov al, [r10+3]
+  mov [r11+3], al
+  mov al, [r10+4]
+  mov [r11+4], al
+  mov al, [r10+5]
+  mov [r11+5], al
+  mov al, [r10+6]
+  mov [r11+6], al
+  mov al, [r10+7]
+  mov [r11+7], al
+  mov al, [r10+8]
+  mov [r11+8], al
+  mov al, [r10+9]
+  mov [r11+9], al
+  mov al, [r10+10]
+  mov [r11+10], al
+  mov al, [r10+11]
+  mov [r11+11], al
+  mov al, [r10+12]
+  mov [r11+12], al
+  mov al, [r10+13]
+  mov [r11+13], al
+  mov al, [r10+14]
+  mov [r11+14], al
+  mov al, [r10+15]
+  mov [r11+15], al
+  mov al, [r10+16]
+  mov [r11+16], al
+  mov al, [r10+17]
+  mov [r11+17], al
+  mov al, [r10+18]
+  mov [r11+18], al
+  mov al, [r10+19]
+  mov [r11+19], al
+  mov al, [r10+20]
+  mov [r11+20], al
+  mov al, [r10+21]
+  mov [r11+21], al
+  mov al, [r10+22]
+  mov [r11+22], al
+  mov al, [r10+23]
+  mov [r11+23], al
+  mov al, [r10+24]
+  mov [r11+24], al
+  mov al, [r10+25]
+  mov [r11+25], al
+  mov al, [r10+26]
+  mov [r11+26], al
+  mov al, [r10+27]
+  mov [r11+27], al
+  mov al, [r10+28]
+  mov [r11+28], al
+  mov al, [r10+29]
+  mov [r11+29], al
+  mov al, [r10+30]
+  mov [r11+30], al
+  mov al, [r10+31]
+  mov [r11+31], al
+  mov al, [r10+32]
+  mov [r11+32], al
+  mov al, [r10+33]
+  mov [r11+33], al
+  mov al, [r10+34]
+  mov [r11+34], al
+  mov al, [r10+35]
+  mov [r11+35], al
+  mov al, [r10+36]
+  mov [r11+36], al
+  mov al, [r10+37]
+  mov [r11+37], al
+  mov al, [r10+38]
+  mov [r11+38], al
+  mov al, [r10+39]
+  mov [r11+39], al
+  mov al, [r10+40]
+  mov [r11+40], al
+  mov al, [r10+41]
+  mov [r11+41], al
+  mov al, [r10+42]
+  mov [r11+42], al
+  mov al, [r10+43]
+  mov [r11+43], al
+  mov al, [r10+44]
+  mov [r11+44], al
+  mov al, [r10+45]
+  mov [r11+45], al
+  mov al, [r10+46]
+  mov [r11+46], al
+  mov al, [r10+47]
+  mov [r11+47], al
+  mov al, [r10+48]
+  mov [r11+48], al
+  mov al, [r10+49]
+  mov [r11+49], al
+  mov al, [r10+50]
+  mov [r11+50], al
+  mov al, [r10+51]
+  mov [r11+51], al
+  mov al, [r10+52]
+  mov [r11+52], al
+  mov al, [r10+53]
+  mov [r11+53], al
+  mov al, [r10+54]
+  mov [r11+54], al
+  mov al, [r10+55]
+  mov [r11+55], al
+  mov al, [r10+56]
+  mov [r11+56], al
+  mov al, [r10+57]
+  mov [r11+57], al
+  mov al, [r10+58]
+  mov [r11+58], al
+  mov al, [r10+59]
+  mov [r11+59], al
+  mov al, [r10+60]
+  mov [r11+60], al
+  mov al, [r10+61]
+  mov [r11+61], al
+  mov al, [r10+62]
+  mov [r11+62], al
+  mov al, [r10+63]
+  mov [r11+63], al
+  mov al, [r10+64]
+  mov [r11+64], al
+  mov al, [r10+65]
+  mov [r11+65], al
+  mov al, [r10+66]
+  mov [r11+66], al
+  mov al, [r10+67]
+  mov [r11+67], al
+  mov al, [r10+68]
+  mov [r11+68], al
+  mov al, [r10+69]
+  mov [r11+69], al
+  mov al, [r10+70]
+  mov [r11+70], al
+  mov al, [r10+71]
+  mov [r11+71], al
+  mov al, [r10+72]
+  mov [r11+72], al
+  mov al, [r10+73]
+  mov [r11+73], al
+  mov al, [r10+74]
+  mov [r11+74], al
+  mov al, [r10+75]
+  mov [r11+75], al
+  mov al, [r10+76]
+  mov [r11+76], al
+  mov al, [r10+77]
+  mov [r11+77], al
+  mov al, [r10+78]
+  mov [r11+78], al
+  mov al, [r10+79]
+  mov [r11+79], al
+  mov al, [r10+80]
+  mov [r11+80], al
+  mov al, [r10+81]
+  mov [r11+81], al
+  mov al, [r10+82]
+  mov [r11+82], al
+  mov al, [r10+83]
+  mov [r11+83], al
+  mov al, [r10+84]
+  mov [r11+84], al
+  mov al, [r10+85]
+  mov [r11+85], al
+  mov al, [r10+86]
+  mov [r11+86], al
+  mov al, [r10+87]
+  mov [r11+87], al
+.loc 1 1400 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.abstract_declarator
+.L.end.abstract_declarator.1:
+.loc 1 1403 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset type_suffix
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.abstract_declarator
+.L.return.abstract_declarator:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+typename:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 1408 36
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset typespec
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1409 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset abstract_declarator
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.typename
+.L.return.typename:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+consume_end:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rsi
+  mov [rbp-48], rdi
+.loc 1 1416 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 68
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.consume_end.1
+.loc 1 1417 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1418 5
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.consume_end
+.L.end.consume_end.1:
+.loc 1 1421 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 72
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.consume_end.3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 68
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.consume_end.3
+  mov r10, 1
+  jmp .L.end.consume_end.3
+.L.false.consume_end.3:
+  mov r10, 0
+.L.end.consume_end.3:
+  cmp r10, 0
+  je .L.end.consume_end.2
+.loc 1 1422 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1423 5
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.consume_end
+.L.end.consume_end.2:
+.loc 1 1426 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1427 3
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.consume_end
+.L.return.consume_end:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+enum_specifier:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 112
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-104], rsi
+  mov [rbp-112], rdi
+.loc 1 1435 25
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset enum_type
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-96]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1438 17
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-88]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1439 3
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.enum_specifier.1
+.loc 1 1440 5
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  lea r11, [rbp-88]
+  mov [r11], r10
+.loc 1 1441 5
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-104]
+  mov [r11], r10
+.L.end.enum_specifier.1:
+.loc 1 1444 3
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.enum_specifier.3
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 67
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.enum_specifier.3
+  mov r10, 1
+  jmp .L.end.enum_specifier.3
+.L.false.enum_specifier.3:
+  mov r10, 0
+.L.end.enum_specifier.3:
+  cmp r10, 0
+  je .L.end.enum_specifier.2
+.loc 1 1445 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset find_tag
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1446 5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.enum_specifier.4
+.loc 1 1447 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.12
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.enum_specifier.4:
+.loc 1 1448 5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 6
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.enum_specifier.5
+.loc 1 1449 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.13
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.enum_specifier.5:
+.loc 1 1450 5
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1451 5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.enum_specifier
+.L.end.enum_specifier.2:
+.loc 1 1454 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 67
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-104]
+  mov [r11], r10
+.loc 1 1457 12
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1458 14
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-68]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1459 3
+.L.begin.enum_specifier.6:
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_end
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.break.enum_specifier.6
+.loc 1 1460 5
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-72]
+  lea r12, [rbp-64]
+  mov [r12], r11
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  add r11d, r12d
+  mov r11d, r11d
+  lea r12, [rbp-64]
+  mov r12, [r12]
+  mov [r12], r11d
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, -1
+  mov r12d, r12d
+  add r11d, r12d
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.enum_specifier.7
+.loc 1 1461 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 72
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-104]
+  mov [r11], r10
+.L.end.enum_specifier.7:
+.loc 1 1463 32
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_ident
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1464 5
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-104]
+  mov [r11], r10
+.loc 1 1466 5
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 74
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.enum_specifier.8
+.loc 1 1467 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-104]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset const_expr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-68]
+  mov [r11], r10d
+.L.end.enum_specifier.8:
+.loc 1 1469 36
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset push_scope
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1470 5
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.loc 1 1471 5
+  lea r10, [rbp-68]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 48
+  mov [r11], r10d
+.L.continue.enum_specifier.6:
+  jmp .L.begin.enum_specifier.6
+.L.break.enum_specifier.6:
+.loc 1 1474 3
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.enum_specifier.9
+.loc 1 1475 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset push_tag_scope
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.enum_specifier.9:
+.loc 1 1476 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset expect_end
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1477 3
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.enum_specifier
+.L.return.enum_specifier:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+declaration:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 304
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-296], rsi
+  mov [rbp-304], rdi
+.loc 1 1482 20
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-288]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-288]
+  mov r12, 1
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-288]
+  mov r12, 2
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-288]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1483 44
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-296]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-296]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-288]
+  push r10
+  sub rsp, 8
+  mov r10, offset typespec
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-280]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1485 17
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-272]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-272]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-272]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-272]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-272]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-272]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-272]
+  mov r12, 48
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-272]
+  mov r12, 56
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-272]
+  mov r12, 64
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-272]
+  mov r12, 72
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-272]
+  mov r12, 80
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-272]
+  mov r12, 88
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-272]
+  mov r12, 96
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-272]
+  mov r12, 104
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-272]
+  mov r12, 112
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-272]
+  mov r12, 120
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-272]
+  mov r12, 128
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-272]
+  mov r12, 136
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-272]
+  mov r12, 144
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-272]
+  mov r12, 152
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-272]
+  mov r12, 160
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-272]
+  mov r12, 164
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-272]
+  mov r12, 168
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-272]
+  mov r12, 176
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1486 20
+  lea r10, [rbp-272]
+  lea r11, [rbp-88]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1487 14
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-76]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1489 3
+.L.begin.declaration.1:
+  lea r10, [rbp-296]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 71
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.declaration.1
+.loc 1 1490 5
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-76]
+  lea r12, [rbp-72]
+  mov [r12], r11
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  add r11d, r12d
+  mov r11d, r11d
+  lea r12, [rbp-72]
+  mov r12, [r12]
+  mov [r12], r11d
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, -1
+  mov r12d, r12d
+  add r11d, r12d
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.declaration.2
+.loc 1 1491 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-296]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 72
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-296]
+  mov [r11], r10
+.L.end.declaration.2:
+.loc 1 1493 45
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-296]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-296]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset declarator
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1494 5
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.declaration.3
+.loc 1 1495 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.14
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.declaration.3:
+.loc 1 1496 5
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.declaration.4
+.loc 1 1497 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-296]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.15
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.declaration.4:
+.loc 1 1499 5
+  lea r10, [rbp-288]
+  add r10, 0
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.declaration.5
+.loc 1 1500 7
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_ident
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset push_scope
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  add r11, 32
+  mov [r11], r10
+.loc 1 1501 7
+  jmp .L.continue.declaration.1
+.L.end.declaration.5:
+.loc 1 1504 5
+  lea r10, [rbp-288]
+  add r10, 1
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.declaration.6
+.loc 1 1506 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset new_label
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset new_gvar
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1507 7
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_ident
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset push_scope
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  add r11, 24
+  mov [r11], r10
+.loc 1 1509 7
+  lea r10, [rbp-296]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 74
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.declaration.7
+.loc 1 1510 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-296]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-296]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gvar_initializer
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 48
+  mov [r11], r10
+.L.end.declaration.7:
+.loc 1 1511 7
+  jmp .L.continue.declaration.1
+.L.end.declaration.6:
+.loc 1 1514 49
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_ident
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_lvar
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1515 5
+  lea r10, [rbp-288]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  cmp r10, 0
+  je .L.end.declaration.8
+.loc 1 1516 7
+  lea r10, [rbp-288]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 36
+  mov [r11], r10d
+.L.end.declaration.8:
+.loc 1 1518 5
+  lea r10, [rbp-296]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 74
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.declaration.9
+.loc 1 1519 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-296]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-296]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset lvar_initializer
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+  lea r11, [rbp-88]
+  mov [r11], r10
+.L.end.declaration.9:
+.L.continue.declaration.1:
+  jmp .L.begin.declaration.1
+.L.break.declaration.1:
+.loc 1 1522 39
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 30
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-296]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1523 3
+  lea r10, [rbp-272]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 96
+  mov [r11], r10
+.loc 1 1524 3
+  lea r10, [rbp-296]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-304]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1525 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.declaration
+.L.return.declaration:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+skip_excess_elements:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rsi
+  mov [rbp-48], rdi
+.loc 1 1529 3
+.L.begin.skip_excess_elements.1:
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset consume_end
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.break.skip_excess_elements.1
+.loc 1 1530 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 72
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 1531 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 67
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.skip_excess_elements.2
+.loc 1 1532 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset skip_excess_elements
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.skip_excess_elements.2
+.L.else.skip_excess_elements.2:
+.loc 1 1534 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset assign
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.skip_excess_elements.2:
+.L.continue.skip_excess_elements.1:
+  jmp .L.begin.skip_excess_elements.1
+.L.break.skip_excess_elements.1:
+.loc 1 1536 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+.L.return.skip_excess_elements:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+skip_end:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 1540 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset consume_end
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.skip_end.1
+.loc 1 1541 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.skip_end
+.L.end.skip_end.1:
+.loc 1 1542 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.16
+  push r10
+  sub rsp, 8
+  mov r10, offset warn_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1543 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset skip_excess_elements
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1544 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.skip_end
+.L.return.skip_end:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+string_initializer:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-80], rdx
+  mov [rbp-88], rsi
+  mov [rbp-96], rdi
+.loc 1 1550 26
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 64
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1551 3
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 13
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.string_initializer.1
+.loc 1 1552 5
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 24
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 4
+  mov [r11], r10d
+.loc 1 1553 5
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 24
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10d
+.loc 1 1554 5
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 13
+  mov [r11], r10b
+.L.end.string_initializer.1:
+.loc 1 1557 58
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 40
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_init
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1560 40
+.loc 1 1559 13
+.loc 1 1560 5
+.loc 1 1559 28
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 40
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  add r11, 24
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  add r11d, r12d
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je  .L.else.string_initializer.2
+.loc 1 1560 11
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 40
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  jmp .L.end.string_initializer.2
+.L.else.string_initializer.2:
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 24
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+.L.end.string_initializer.2:
+  mov r10d, r10d
+.loc 1 1559 13
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1562 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.string_initializer.3:
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.string_initializer.3
+.loc 1 1563 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  add r11, 24
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je  .L.else.string_initializer.4
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  jmp .L.end.string_initializer.4
+.L.else.string_initializer.4:
+  mov r10, 0
+  mov r10d, r10d
+.L.end.string_initializer.4:
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_num
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1564 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_init
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 32
+  mov r11, [r11]
+  lea r12, [rbp-52]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 8
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.continue.string_initializer.3:
+.loc 1 1562 28
+  lea r10, [rbp-52]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.string_initializer.3
+.L.break.string_initializer.3:
+.loc 1 1566 3
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-96]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1567 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.string_initializer
+.L.return.string_initializer:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+array_initializer:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 112
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-88], rdx
+  mov [rbp-96], rsi
+  mov [rbp-104], rdi
+.loc 1 1573 49
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 67
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset consume
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-77]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.loc 1 1575 3
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 13
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.array_initializer.1
+.loc 1 1576 5
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-76]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1577 5
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.array_initializer.2:
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_end
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.break.array_initializer.2
+.loc 1 1578 7
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.array_initializer.3
+.loc 1 1579 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 72
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-72]
+  mov [r11], r10
+.L.end.array_initializer.3:
+.loc 1 1580 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset initializer
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.array_initializer.2:
+.loc 1 1577 44
+  lea r10, [rbp-76]
+  lea r11, [rbp-64]
+  mov [r11], r10
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.array_initializer.2
+.L.break.array_initializer.2:
+.loc 1 1583 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  imul r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 4
+  mov [r11], r10d
+.loc 1 1584 5
+  lea r10, [rbp-76]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10d
+.loc 1 1585 5
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 13
+  mov [r11], r10b
+.L.end.array_initializer.1:
+.loc 1 1588 58
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 40
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_init
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1590 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-44]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.array_initializer.4:
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 40
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.array_initializer.5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_end
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.array_initializer.5
+  mov r10, 1
+  jmp .L.end.array_initializer.5
+.L.false.array_initializer.5:
+  mov r10, 0
+.L.end.array_initializer.5:
+  cmp r10, 0
+  je .L.break.array_initializer.4
+.loc 1 1591 5
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-44]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.array_initializer.6
+.loc 1 1592 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 72
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-96]
+  mov [r11], r10
+.L.end.array_initializer.6:
+.loc 1 1593 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset initializer
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 32
+  mov r11, [r11]
+  lea r12, [rbp-44]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 8
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.continue.array_initializer.4:
+.loc 1 1590 54
+  lea r10, [rbp-44]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.array_initializer.4
+.L.break.array_initializer.4:
+.loc 1 1596 3
+  lea r10, [rbp-77]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.array_initializer.7
+.loc 1 1597 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset skip_end
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-96]
+  mov [r11], r10
+.L.end.array_initializer.7:
+.loc 1 1598 3
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1599 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.array_initializer
+.L.return.array_initializer:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+struct_initializer:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 144
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-120], rdx
+  mov [rbp-128], rsi
+  mov [rbp-136], rdi
+.loc 1 1605 3
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 67
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.struct_initializer.1
+.loc 1 1606 5
+.loc 1 1607 36
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-112]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset assign
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-104]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1608 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1609 5
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.struct_initializer.2
+.loc 1 1610 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_init
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-96]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1611 7
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  lea r11, [rbp-136]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1612 7
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.struct_initializer
+.L.end.struct_initializer.2:
+.L.end.struct_initializer.1:
+.loc 1 1616 14
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-84]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1617 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 48
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.struct_initializer.3:
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.struct_initializer.3
+.loc 1 1618 5
+  lea r10, [rbp-84]
+  lea r11, [rbp-72]
+  mov [r11], r10
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.continue.struct_initializer.3:
+.loc 1 1617 40
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov [r11], r10
+  jmp .L.begin.struct_initializer.3
+.L.break.struct_initializer.3:
+.loc 1 1620 48
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-84]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_init
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1621 49
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 67
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset consume
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-53]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.loc 1 1623 12
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1624 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 48
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.struct_initializer.4:
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.struct_initializer.5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_end
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.struct_initializer.5
+  mov r10, 1
+  jmp .L.end.struct_initializer.5
+.L.false.struct_initializer.5:
+  mov r10, 0
+.L.end.struct_initializer.5:
+  cmp r10, 0
+  je .L.break.struct_initializer.4
+.loc 1 1625 5
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.struct_initializer.6
+.loc 1 1626 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 72
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-128]
+  mov [r11], r10
+.L.end.struct_initializer.6:
+.loc 1 1627 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset initializer
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 32
+  mov r11, [r11]
+  lea r12, [rbp-52]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 8
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.continue.struct_initializer.4:
+.loc 1 1624 56
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-52]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.struct_initializer.4
+.L.break.struct_initializer.4:
+.loc 1 1630 3
+  lea r10, [rbp-53]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.struct_initializer.7
+.loc 1 1631 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset skip_end
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-128]
+  mov [r11], r10
+.L.end.struct_initializer.7:
+.loc 1 1632 3
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  lea r11, [rbp-136]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1633 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.struct_initializer
+.L.return.struct_initializer:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+initializer:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-64], rdx
+  mov [rbp-72], rsi
+  mov [rbp-80], rdi
+.loc 1 1640 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 9
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.initializer.3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.initializer.3
+  mov r10, 1
+  jmp .L.end.initializer.3
+.L.false.initializer.3:
+  mov r10, 0
+.L.end.initializer.3:
+  cmp r10, 0
+  je .L.false.initializer.2
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.initializer.2
+  mov r10, 1
+  jmp .L.end.initializer.2
+.L.false.initializer.2:
+  mov r10, 0
+.L.end.initializer.2:
+  cmp r10, 0
+  je .L.end.initializer.1
+.loc 1 1641 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset string_initializer
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.initializer
+.L.end.initializer.1:
+.loc 1 1643 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 9
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.initializer.4
+.loc 1 1644 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset array_initializer
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.initializer
+.L.end.initializer.4:
+.loc 1 1646 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.initializer.5
+.loc 1 1647 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset struct_initializer
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.initializer
+.L.end.initializer.5:
+.loc 1 1649 21
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1650 49
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 67
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset consume
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-41]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.loc 1 1651 64
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset assign
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_init
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1652 3
+  lea r10, [rbp-41]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.initializer.6
+.loc 1 1653 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset skip_end
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-72]
+  mov [r11], r10
+.L.end.initializer.6:
+.loc 1 1654 3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1655 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.initializer
+.L.return.initializer:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+create_lvar_init:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 176
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-132], r8d
+  mov [rbp-144], rcx
+  mov [rbp-152], rdx
+  mov [rbp-160], rsi
+  mov [rbp-168], rdi
+.loc 1 1660 3
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 9
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.create_lvar_init.1
+.loc 1 1661 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-128]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1662 5
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-124]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.create_lvar_init.2:
+  lea r10, [rbp-124]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-144]
+  mov r11, [r11]
+  add r11, 40
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.create_lvar_init.2
+.loc 1 1663 7
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  cmp r10, 0
+  je  .L.else.create_lvar_init.3
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  lea r11, [rbp-124]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  jmp .L.end.create_lvar_init.3
+.L.else.create_lvar_init.3:
+  mov r10, 0
+  movsx r10, r10d
+.L.end.create_lvar_init.3:
+  lea r11, [rbp-112]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1664 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-132]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-128]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  lea r12, [rbp-124]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset create_lvar_init
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-168]
+  mov [r11], r10
+.L.continue.create_lvar_init.2:
+.loc 1 1662 40
+  lea r10, [rbp-124]
+  lea r11, [rbp-120]
+  mov [r11], r10
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-120]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.create_lvar_init.2
+.L.break.create_lvar_init.2:
+.loc 1 1666 5
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.create_lvar_init
+.L.end.create_lvar_init.1:
+.loc 1 1669 3
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.create_lvar_init.5
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.create_lvar_init.6
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 16
+  mov r10d, dword ptr [r10]
+  cmp r10, 0
+  jne .L.true.create_lvar_init.6
+  mov r10, 0
+  jmp .L.end.create_lvar_init.6
+.L.true.create_lvar_init.6:
+  mov r10, 1
+.L.end.create_lvar_init.6:
+  cmp r10, 0
+  je .L.false.create_lvar_init.5
+  mov r10, 1
+  jmp .L.end.create_lvar_init.5
+.L.false.create_lvar_init.5:
+  mov r10, 0
+.L.end.create_lvar_init.5:
+  cmp r10, 0
+  je .L.end.create_lvar_init.4
+.loc 1 1670 5
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-100]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1671 5
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 48
+  mov r10, [r10]
+  lea r11, [rbp-96]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.create_lvar_init.7:
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.create_lvar_init.7
+.loc 1 1672 7
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  cmp r10, 0
+  je  .L.else.create_lvar_init.8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  lea r11, [rbp-100]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  jmp .L.end.create_lvar_init.8
+.L.else.create_lvar_init.8:
+  mov r10, 0
+  movsx r10, r10d
+.L.end.create_lvar_init.8:
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1673 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-132]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-96]
+  mov r11, [r11]
+  add r11, 36
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset create_lvar_init
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-168]
+  mov [r11], r10
+.L.continue.create_lvar_init.7:
+.loc 1 1671 42
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-96]
+  mov [r11], r10
+  lea r10, [rbp-100]
+  lea r11, [rbp-88]
+  mov [r11], r10
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.create_lvar_init.7
+.L.break.create_lvar_init.7:
+.loc 1 1675 5
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.create_lvar_init
+.L.end.create_lvar_init.4:
+.loc 1 1679 48
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  cmp r10, 0
+  je  .L.else.create_lvar_init.9
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  jmp .L.end.create_lvar_init.9
+.L.else.create_lvar_init.9:
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+.L.end.create_lvar_init.9:
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1680 51
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  cmp r10, 0
+  je  .L.else.create_lvar_init.10
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  jmp .L.end.create_lvar_init.10
+.L.else.create_lvar_init.10:
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_num
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.create_lvar_init.10:
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1681 62
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 18
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_var_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_unary
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1682 35
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-132]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_num
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1690 26
+.loc 1 1685 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 14
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1686 25
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 19
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1687 34
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+.loc 1 1688 45
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pointer_to
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+.loc 1 1687 26
+  mov r10, offset new_cast
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+.loc 1 1689 26
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+.loc 1 1686 16
+  mov r10, offset new_unary
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+.loc 1 1690 16
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+.loc 1 1685 5
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1691 3
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 88
+  mov [r11], r10b
+.loc 1 1692 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1693 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 36
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_unary
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-168]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 1694 3
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.create_lvar_init
+.L.return.create_lvar_init:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+lvar_initializer:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 256
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-240], rdx
+  mov [rbp-248], rsi
+  mov [rbp-256], rdi
+.loc 1 1709 54
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-256]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-248]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-240]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset initializer
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-232]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1710 17
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-224]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 48
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 56
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 64
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 72
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 80
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-224]
+  mov r12, 88
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 96
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 104
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 112
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 120
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 128
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 136
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 144
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 152
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-224]
+  mov r12, 160
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-224]
+  mov r12, 164
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 168
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 176
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1711 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-224]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-232]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-240]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-240]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset create_lvar_init
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1713 40
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 30
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-248]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1714 3
+  lea r10, [rbp-224]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 96
+  mov [r11], r10
+.loc 1 1715 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.lvar_initializer
+.L.return.lvar_initializer:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+new_gvar_init_val:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-44], ecx
+  mov [rbp-48], edx
+  mov [rbp-52], esi
+  mov [rbp-64], rdi
+.loc 1 1720 75
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 11
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 48
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1721 3
+  lea r10, [rbp-48]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 12
+  mov [r11], r10d
+.loc 1 1722 3
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 1723 3
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10d
+.loc 1 1724 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 1725 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.new_gvar_init_val
+.L.return.new_gvar_init_val:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+new_gvar_init_label:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rcx
+  mov [rbp-56], rdx
+  mov [rbp-60], esi
+  mov [rbp-72], rdi
+.loc 1 1730 75
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 11
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 48
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1731 3
+  mov r10, 8
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 12
+  mov [r11], r10d
+.loc 1 1732 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+.loc 1 1733 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.loc 1 1734 3
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10d
+.loc 1 1735 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 1736 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.new_gvar_init_label
+.L.return.new_gvar_init_label:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+create_gvar_init:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 128
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-92], ecx
+  mov [rbp-104], rdx
+  mov [rbp-112], rsi
+  mov [rbp-120], rdi
+.loc 1 1741 3
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 9
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.create_gvar_init.1
+.loc 1 1742 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-88]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1743 5
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-84]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.create_gvar_init.2:
+  lea r10, [rbp-84]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  add r11, 40
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.create_gvar_init.2
+.loc 1 1744 7
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  lea r11, [rbp-84]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.create_gvar_init.3
+.loc 1 1745 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  lea r11, [rbp-84]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-92]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-88]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  lea r12, [rbp-84]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  imul r11d, r12d
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset create_gvar_init
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-120]
+  mov [r11], r10
+.L.end.create_gvar_init.3:
+.L.continue.create_gvar_init.2:
+.loc 1 1743 40
+  lea r10, [rbp-84]
+  lea r11, [rbp-80]
+  mov [r11], r10
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.create_gvar_init.2
+.L.break.create_gvar_init.2:
+.loc 1 1746 5
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.create_gvar_init
+.L.end.create_gvar_init.1:
+.loc 1 1749 3
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.create_gvar_init.4
+.loc 1 1750 5
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-68]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1751 5
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 48
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.create_gvar_init.5:
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.create_gvar_init.5
+.loc 1 1752 7
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  lea r11, [rbp-68]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.create_gvar_init.6
+.loc 1 1753 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  lea r11, [rbp-68]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-92]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 36
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset create_gvar_init
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-120]
+  mov [r11], r10
+.L.end.create_gvar_init.6:
+.L.continue.create_gvar_init.5:
+.loc 1 1751 42
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov [r11], r10
+  lea r10, [rbp-68]
+  lea r11, [rbp-56]
+  mov [r11], r10
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.create_gvar_init.5
+.L.break.create_gvar_init.5:
+.loc 1 1754 5
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.create_gvar_init
+.L.end.create_gvar_init.4:
+.loc 1 1757 15
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1758 40
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval2
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1759 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.create_gvar_init.7
+.loc 1 1760 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-92]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_gvar_init_label
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.create_gvar_init
+.L.end.create_gvar_init.7:
+.loc 1 1761 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-92]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset new_gvar_init_val
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.create_gvar_init
+.L.return.create_gvar_init:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+gvar_initializer:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 128
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-112], rdx
+  mov [rbp-120], rsi
+  mov [rbp-128], rdi
+.loc 1 1771 3
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 9
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.gvar_initializer.3
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.gvar_initializer.3
+  mov r10, 1
+  jmp .L.end.gvar_initializer.3
+.L.false.gvar_initializer.3:
+  mov r10, 0
+.L.end.gvar_initializer.3:
+  cmp r10, 0
+  je .L.false.gvar_initializer.2
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.gvar_initializer.2
+  mov r10, 1
+  jmp .L.end.gvar_initializer.2
+.L.false.gvar_initializer.2:
+  mov r10, 0
+.L.end.gvar_initializer.2:
+  cmp r10, 0
+  je .L.end.gvar_initializer.1
+.loc 1 1772 5
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 64
+  mov r10, [r10]
+  lea r11, [rbp-104]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1773 5
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  add r10, 13
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.gvar_initializer.4
+.loc 1 1774 7
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 24
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  add r11, 4
+  mov [r11], r10d
+.loc 1 1775 7
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 24
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10d
+.loc 1 1776 7
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  add r11, 13
+  mov [r11], r10b
+.L.end.gvar_initializer.4:
+.loc 1 1778 5
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1779 78
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  add r10, 40
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  add r11, 24
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je  .L.else.gvar_initializer.5
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  add r10, 40
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  jmp .L.end.gvar_initializer.5
+.L.else.gvar_initializer.5:
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 24
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+.L.end.gvar_initializer.5:
+  mov r10d, r10d
+  lea r11, [rbp-92]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1780 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-92]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset gvar_init_string
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.gvar_initializer
+.L.end.gvar_initializer.1:
+.loc 1 1783 49
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset initializer
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-88]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1784 28
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-80]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-80]
+  mov r12, 12
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-80]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-80]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-80]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-80]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1785 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset create_gvar_init
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1786 3
+  lea r10, [rbp-80]
+  add r10, 0
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.gvar_initializer
+.L.return.gvar_initializer:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+gvar_init_string:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-44], esi
+  mov [rbp-56], rdi
+.loc 1 1792 75
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 11
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 48
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1793 3
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 12
+  mov [r11], r10d
+.loc 1 1794 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10
+.loc 1 1795 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.gvar_init_string
+.L.return.gvar_init_string:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+is_typename:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 1799 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  cmp r10, 13
+  je .L.case.is_typename.2
+  cmp r10, 15
+  je .L.case.is_typename.3
+  cmp r10, 8
+  je .L.case.is_typename.4
+  cmp r10, 11
+  je .L.case.is_typename.5
+  cmp r10, 6
+  je .L.case.is_typename.6
+  cmp r10, 12
+  je .L.case.is_typename.7
+  cmp r10, 9
+  je .L.case.is_typename.8
+  cmp r10, 10
+  je .L.case.is_typename.9
+  cmp r10, 14
+  je .L.case.is_typename.10
+  cmp r10, 16
+  je .L.case.is_typename.11
+  cmp r10, 17
+  je .L.case.is_typename.12
+  cmp r10, 24
+  je .L.case.is_typename.13
+  cmp r10, 26
+  je .L.case.is_typename.14
+  cmp r10, 28
+  je .L.case.is_typename.15
+  cmp r10, 29
+  je .L.case.is_typename.16
+  cmp r10, 30
+  je .L.case.is_typename.17
+  cmp r10, 31
+  je .L.case.is_typename.18
+  jmp .L.break.is_typename.1
+.loc 1 1800 3
+.L.case.is_typename.2:
+.L.case.is_typename.3:
+.L.case.is_typename.4:
+.L.case.is_typename.5:
+.L.case.is_typename.6:
+.loc 1 1801 3
+.L.case.is_typename.7:
+.L.case.is_typename.8:
+.L.case.is_typename.9:
+.L.case.is_typename.10:
+.loc 1 1802 3
+.L.case.is_typename.11:
+.L.case.is_typename.12:
+.L.case.is_typename.13:
+.L.case.is_typename.14:
+.loc 1 1803 3
+.L.case.is_typename.15:
+.L.case.is_typename.16:
+.L.case.is_typename.17:
+.L.case.is_typename.18:
+.loc 1 1804 5
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.is_typename
+.L.break.is_typename.1:
+.loc 1 1806 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset find_typedef
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.is_typename
+.L.return.is_typename:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+stmt:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 176
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-160], rsi
+  mov [rbp-168], rdi
+.loc 1 1825 3
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  cmp r10, 67
+  je .L.case.stmt.2
+  cmp r10, 71
+  je .L.case.stmt.3
+  cmp r10, 20
+  je .L.case.stmt.4
+  cmp r10, 19
+  je .L.case.stmt.5
+  cmp r10, 18
+  je .L.case.stmt.6
+  cmp r10, 27
+  je .L.case.stmt.7
+  cmp r10, 5
+  je .L.case.stmt.8
+  cmp r10, 4
+  je .L.case.stmt.9
+  cmp r10, 23
+  je .L.case.stmt.10
+  cmp r10, 22
+  je .L.case.stmt.11
+  cmp r10, 21
+  je .L.case.stmt.12
+  cmp r10, 2
+  je .L.case.stmt.13
+  cmp r10, 1
+  je .L.case.stmt.14
+  jmp .L.break.stmt.1
+.loc 1 1826 3
+.L.case.stmt.14:
+.loc 1 1827 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 24
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-152]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1828 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 71
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset consume
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.stmt.15
+.loc 1 1829 7
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.stmt
+.L.end.stmt.15:
+.loc 1 1831 38
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset expr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-144]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1832 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 71
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-168]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1834 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1835 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset current_fn
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_cast
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-152]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+.loc 1 1836 5
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.stmt
+.loc 1 1839 3
+.L.case.stmt.13:
+.loc 1 1840 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 25
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-136]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1841 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 65
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-160]
+  mov [r11], r10
+.loc 1 1842 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset expr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-136]
+  mov r11, [r11]
+  add r11, 48
+  mov [r11], r10
+.loc 1 1843 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 66
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-160]
+  mov [r11], r10
+.loc 1 1844 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset stmt
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-136]
+  mov r11, [r11]
+  add r11, 56
+  mov [r11], r10
+.loc 1 1845 5
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 3
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.stmt.16
+.loc 1 1846 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset stmt
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-136]
+  mov r11, [r11]
+  add r11, 64
+  mov [r11], r10
+.L.end.stmt.16:
+.loc 1 1847 5
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  lea r11, [rbp-168]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1848 5
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.stmt
+.loc 1 1851 3
+.L.case.stmt.12:
+.loc 1 1852 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 28
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-128]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1853 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 65
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-160]
+  mov [r11], r10
+.loc 1 1854 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset expr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  add r11, 48
+  mov [r11], r10
+.loc 1 1855 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 66
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-160]
+  mov [r11], r10
+.loc 1 1857 30
+  mov r10, offset current_switch
+  mov r10, [r10]
+  lea r11, [rbp-120]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1858 5
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  mov r11, offset current_switch
+  mov [r11], r10
+.loc 1 1859 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset stmt
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  add r11, 56
+  mov [r11], r10
+.loc 1 1860 5
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  mov r11, offset current_switch
+  mov [r11], r10
+.loc 1 1861 5
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.stmt
+.loc 1 1864 3
+.L.case.stmt.11:
+.loc 1 1865 5
+  mov r10, offset current_switch
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.stmt.17
+.loc 1 1866 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.17
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.stmt.17:
+.loc 1 1868 40
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 29
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-112]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1869 42
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset const_expr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-100]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1870 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 88
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-160]
+  mov [r11], r10
+.loc 1 1871 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset stmt
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+.loc 1 1872 5
+  lea r10, [rbp-100]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  add r11, 176
+  mov [r11], r10
+.loc 1 1873 5
+  mov r10, offset current_switch
+  mov r10, [r10]
+  add r10, 144
+  mov r10, [r10]
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  add r11, 144
+  mov [r11], r10
+.loc 1 1874 5
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  mov r11, offset current_switch
+  mov r11, [r11]
+  add r11, 144
+  mov [r11], r10
+.loc 1 1875 5
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.stmt
+.loc 1 1878 3
+.L.case.stmt.10:
+.loc 1 1879 5
+  mov r10, offset current_switch
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.stmt.18
+.loc 1 1880 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.18
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.stmt.18:
+.loc 1 1882 40
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 29
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-96]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1883 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 88
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-160]
+  mov [r11], r10
+.loc 1 1884 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset stmt
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-96]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+.loc 1 1885 5
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov r11, offset current_switch
+  mov r11, [r11]
+  add r11, 152
+  mov [r11], r10
+.loc 1 1886 5
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.stmt
+.loc 1 1889 3
+.L.case.stmt.9:
+.loc 1 1890 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 26
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-88]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1891 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 65
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-160]
+  mov [r11], r10
+.loc 1 1893 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset enter_scope
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1895 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_typename
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.else.stmt.19
+.loc 1 1896 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset declaration
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 72
+  mov [r11], r10
+  jmp .L.end.stmt.19
+.L.else.stmt.19:
+.loc 1 1898 7
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 71
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.stmt.20
+.loc 1 1899 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset expr_stmt
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 72
+  mov [r11], r10
+.L.end.stmt.20:
+.loc 1 1900 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 71
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-160]
+  mov [r11], r10
+.L.end.stmt.19:
+.loc 1 1903 5
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 71
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.stmt.21
+.loc 1 1904 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset expr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 48
+  mov [r11], r10
+.L.end.stmt.21:
+.loc 1 1905 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 71
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-160]
+  mov [r11], r10
+.loc 1 1907 5
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 66
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.stmt.22
+.loc 1 1908 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset expr_stmt
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 80
+  mov [r11], r10
+.L.end.stmt.22:
+.loc 1 1909 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 66
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-160]
+  mov [r11], r10
+.loc 1 1911 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset stmt
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 56
+  mov [r11], r10
+.loc 1 1912 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset leave_scope
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1913 5
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.stmt
+.loc 1 1916 3
+.L.case.stmt.8:
+.loc 1 1917 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 26
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1918 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 65
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-160]
+  mov [r11], r10
+.loc 1 1919 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset expr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 48
+  mov [r11], r10
+.loc 1 1920 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 66
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-160]
+  mov [r11], r10
+.loc 1 1921 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset stmt
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 56
+  mov [r11], r10
+.loc 1 1922 5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.stmt
+.loc 1 1925 3
+.L.case.stmt.7:
+.loc 1 1926 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 27
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1927 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset stmt
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  add r11, 56
+  mov [r11], r10
+.loc 1 1928 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 5
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-160]
+  mov [r11], r10
+.loc 1 1929 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 65
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-160]
+  mov [r11], r10
+.loc 1 1930 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset expr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  add r11, 48
+  mov [r11], r10
+.loc 1 1931 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 66
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-160]
+  mov [r11], r10
+.loc 1 1932 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 71
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-168]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1933 5
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.stmt
+.loc 1 1936 3
+.L.case.stmt.6:
+.loc 1 1937 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 71
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-168]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1938 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 31
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.stmt
+.loc 1 1941 3
+.L.case.stmt.5:
+.loc 1 1942 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 71
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-168]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1943 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 32
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.stmt
+.loc 1 1946 3
+.L.case.stmt.4:
+.loc 1 1947 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 33
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1948 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_ident
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 136
+  mov [r11], r10
+.loc 1 1949 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 71
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-168]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1950 5
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.stmt
+.loc 1 1953 3
+.L.case.stmt.3:
+.loc 1 1954 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 30
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1955 5
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-168]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1956 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.stmt
+.loc 1 1959 3
+.L.case.stmt.2:
+.loc 1 1960 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset compound_stmt
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.stmt
+.L.break.stmt.1:
+.loc 1 1963 3
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.stmt.24
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 88
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.stmt.24
+  mov r10, 1
+  jmp .L.end.stmt.24
+.L.false.stmt.24:
+  mov r10, 0
+.L.end.stmt.24:
+  cmp r10, 0
+  je .L.end.stmt.23
+.loc 1 1964 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 34
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1965 5
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 136
+  mov [r11], r10
+.loc 1 1966 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset stmt
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+.loc 1 1967 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.stmt
+.L.end.stmt.23:
+.loc 1 1970 36
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset expr_stmt
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1971 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 71
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-168]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1972 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.stmt
+.L.return.stmt:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+compound_stmt:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 256
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-240], rsi
+  mov [rbp-248], rdi
+.loc 1 1977 39
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 30
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-240]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-232]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1978 17
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-224]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 48
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 56
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 64
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 72
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 80
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-224]
+  mov r12, 88
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 96
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 104
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 112
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 120
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 128
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 136
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 144
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 152
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-224]
+  mov r12, 160
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-224]
+  mov r12, 164
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 168
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 176
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1979 20
+  lea r10, [rbp-224]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1981 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset enter_scope
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1983 3
+.L.begin.compound_stmt.1:
+  lea r10, [rbp-240]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 68
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.compound_stmt.1
+.loc 1 1984 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-240]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_typename
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.else.compound_stmt.2
+.loc 1 1985 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-240]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-240]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset declaration
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+  lea r11, [rbp-40]
+  mov [r11], r10
+  jmp .L.end.compound_stmt.2
+.L.else.compound_stmt.2:
+.loc 1 1987 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-240]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-240]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset stmt
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+  lea r11, [rbp-40]
+  mov [r11], r10
+.L.end.compound_stmt.2:
+.loc 1 1988 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.compound_stmt.1:
+  jmp .L.begin.compound_stmt.1
+.L.break.compound_stmt.1:
+.loc 1 1991 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset leave_scope
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1993 3
+  lea r10, [rbp-224]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-232]
+  mov r11, [r11]
+  add r11, 96
+  mov [r11], r10
+.loc 1 1994 3
+  lea r10, [rbp-240]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-248]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1995 3
+  lea r10, [rbp-232]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.compound_stmt
+.L.return.compound_stmt:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+expr_stmt:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 2000 43
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 36
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2001 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset expr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+.loc 1 2002 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.expr_stmt
+.L.return.expr_stmt:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+expr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 2007 33
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset assign
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2009 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 72
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.expr.1
+.loc 1 2010 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 16
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset expr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.expr
+.L.end.expr.1:
+.loc 1 2012 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 2013 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.expr
+.L.return.expr:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+eval:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 2017 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset eval2
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.eval
+.L.return.eval:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+eval2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 2027 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2029 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  cmp r10, 38
+  je .L.case.eval2.2
+  cmp r10, 18
+  je .L.case.eval2.3
+  cmp r10, 39
+  je .L.case.eval2.4
+  cmp r10, 40
+  je .L.case.eval2.5
+  cmp r10, 22
+  je .L.case.eval2.6
+  cmp r10, 23
+  je .L.case.eval2.7
+  cmp r10, 21
+  je .L.case.eval2.8
+  cmp r10, 20
+  je .L.case.eval2.9
+  cmp r10, 16
+  je .L.case.eval2.10
+  cmp r10, 15
+  je .L.case.eval2.11
+  cmp r10, 13
+  je .L.case.eval2.12
+  cmp r10, 12
+  je .L.case.eval2.13
+  cmp r10, 11
+  je .L.case.eval2.14
+  cmp r10, 10
+  je .L.case.eval2.15
+  cmp r10, 9
+  je .L.case.eval2.16
+  cmp r10, 8
+  je .L.case.eval2.17
+  cmp r10, 7
+  je .L.case.eval2.18
+  cmp r10, 6
+  je .L.case.eval2.19
+  cmp r10, 5
+  je .L.case.eval2.20
+  cmp r10, 3
+  je .L.case.eval2.21
+  cmp r10, 2
+  je .L.case.eval2.22
+  cmp r10, 1
+  je .L.case.eval2.23
+  cmp r10, 0
+  je .L.case.eval2.24
+  jmp .L.break.eval2.1
+.loc 1 2030 5
+.L.case.eval2.24:
+.loc 1 2031 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval2
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.eval2
+.loc 1 2032 5
+.L.case.eval2.23:
+.loc 1 2033 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval2
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  sub r10, r11
+  mov rax, r10
+  jmp .L.return.eval2
+.loc 1 2034 5
+.L.case.eval2.22:
+.loc 1 2035 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  imul r10, r11
+  mov rax, r10
+  jmp .L.return.eval2
+.loc 1 2036 5
+.L.case.eval2.21:
+.loc 1 2037 7
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 12
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.eval2.25
+.loc 1 2038 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  mov rax, r10
+  mov rdx, 0
+  div r11
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.eval2
+.L.end.eval2.25:
+.loc 1 2039 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.eval2
+.loc 1 2040 5
+.L.case.eval2.20:
+.loc 1 2041 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  and r10, r11
+  mov rax, r10
+  jmp .L.return.eval2
+.loc 1 2042 5
+.L.case.eval2.19:
+.loc 1 2043 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  or r10, r11
+  mov rax, r10
+  jmp .L.return.eval2
+.loc 1 2044 5
+.L.case.eval2.18:
+.loc 1 2045 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  xor r10, r11
+  mov rax, r10
+  jmp .L.return.eval2
+.loc 1 2046 5
+.L.case.eval2.17:
+.loc 1 2047 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  mov rcx, r11
+  shl r10, cl
+  mov rax, r10
+  jmp .L.return.eval2
+.loc 1 2048 5
+.L.case.eval2.16:
+.loc 1 2049 7
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 12
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.eval2.26
+.loc 1 2050 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  mov rcx, r11
+  shr r10, cl
+  mov rax, r10
+  jmp .L.return.eval2
+.L.end.eval2.26:
+.loc 1 2051 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  mov rcx, r11
+  sar r10, cl
+  mov rax, r10
+  jmp .L.return.eval2
+.loc 1 2052 5
+.L.case.eval2.15:
+.loc 1 2053 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.eval2
+.loc 1 2054 5
+.L.case.eval2.14:
+.loc 1 2055 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  cmp r10, r11
+  setne al
+  movzb r10, al
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.eval2
+.loc 1 2056 5
+.L.case.eval2.13:
+.loc 1 2057 7
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 12
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.eval2.27
+.loc 1 2058 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  cmp r10, r11
+  setb al
+  movzb r10, al
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.eval2
+.L.end.eval2.27:
+.loc 1 2059 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.eval2
+.loc 1 2060 5
+.L.case.eval2.12:
+.loc 1 2061 7
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 12
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.eval2.28
+.loc 1 2062 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  cmp r10, r11
+  setbe al
+  movzb r10, al
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.eval2
+.L.end.eval2.28:
+.loc 1 2063 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  cmp r10, r11
+  setle al
+  movzb r10, al
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.eval2
+.loc 1 2064 5
+.L.case.eval2.11:
+.loc 1 2065 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 48
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je  .L.else.eval2.29
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.eval2.29
+.L.else.eval2.29:
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 64
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.eval2.29:
+  mov rax, r10
+  jmp .L.return.eval2
+.loc 1 2066 5
+.L.case.eval2.10:
+.loc 1 2067 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.eval2
+.loc 1 2068 5
+.L.case.eval2.9:
+.loc 1 2069 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.eval2
+.loc 1 2070 5
+.L.case.eval2.8:
+.loc 1 2071 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  not r10
+  mov rax, r10
+  jmp .L.return.eval2
+.loc 1 2072 5
+.L.case.eval2.7:
+.loc 1 2073 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  jne .L.true.eval2.30
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  jne .L.true.eval2.30
+  mov r10, 0
+  jmp .L.end.eval2.30
+.L.true.eval2.30:
+  mov r10, 1
+.L.end.eval2.30:
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.eval2
+.loc 1 2074 5
+.L.case.eval2.6:
+.loc 1 2075 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.false.eval2.31
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.false.eval2.31
+  mov r10, 1
+  jmp .L.end.eval2.31
+.L.false.eval2.31:
+  mov r10, 0
+.L.end.eval2.31:
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.eval2
+.loc 1 2076 5
+.L.case.eval2.5:
+.loc 1 2077 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval2
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2078 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_integer
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.eval2.33
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.eval2.33
+  mov r10, 0
+  jmp .L.end.eval2.33
+.L.true.eval2.33:
+  mov r10, 1
+.L.end.eval2.33:
+  cmp r10, 0
+  je .L.end.eval2.32
+.loc 1 2079 9
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.eval2
+.L.end.eval2.32:
+.loc 1 2081 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 4
+  je .L.case.eval2.35
+  cmp r10, 2
+  je .L.case.eval2.36
+  cmp r10, 1
+  je .L.case.eval2.37
+  jmp .L.break.eval2.34
+.loc 1 2082 7
+.L.case.eval2.37:
+.loc 1 2083 9
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 12
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.eval2.38
+.loc 1 2084 11
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.eval2
+.L.end.eval2.38:
+.loc 1 2085 9
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  movsx r10, r10b
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.eval2
+.loc 1 2086 7
+.L.case.eval2.36:
+.loc 1 2087 9
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 12
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.eval2.39
+.loc 1 2088 11
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  movzx r10, r10w
+  mov rax, r10
+  jmp .L.return.eval2
+.L.end.eval2.39:
+.loc 1 2089 9
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  movsx r10, r10w
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.eval2
+.loc 1 2090 7
+.L.case.eval2.35:
+.loc 1 2091 9
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 12
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.eval2.40
+.loc 1 2092 11
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.eval2
+.L.end.eval2.40:
+.loc 1 2093 9
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, r10d
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.eval2
+.L.break.eval2.34:
+.loc 1 2096 5
+.L.case.eval2.4:
+.loc 1 2097 7
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 176
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.eval2
+.loc 1 2098 5
+.L.case.eval2.3:
+.loc 1 2099 7
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.eval2.44
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  cmp r10, 0
+  jne .L.true.eval2.44
+  mov r10, 0
+  jmp .L.end.eval2.44
+.L.true.eval2.44:
+  mov r10, 1
+.L.end.eval2.44:
+  cmp r10, 0
+  jne .L.true.eval2.43
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 38
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.eval2.43
+  mov r10, 0
+  jmp .L.end.eval2.43
+.L.true.eval2.43:
+  mov r10, 1
+.L.end.eval2.43:
+  cmp r10, 0
+  jne .L.true.eval2.42
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  add r10, 168
+  mov r10, [r10]
+  add r10, 32
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  jne .L.true.eval2.42
+  mov r10, 0
+  jmp .L.end.eval2.42
+.L.true.eval2.42:
+  mov r10, 1
+.L.end.eval2.42:
+  cmp r10, 0
+  je .L.end.eval2.41
+.loc 1 2100 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.19
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.eval2.41:
+.loc 1 2101 7
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  add r10, 168
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 2102 7
+  mov r10, 0
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.eval2
+.loc 1 2103 5
+.L.case.eval2.2:
+.loc 1 2104 7
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.eval2.47
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  cmp r10, 0
+  jne .L.true.eval2.47
+  mov r10, 0
+  jmp .L.end.eval2.47
+.L.true.eval2.47:
+  mov r10, 1
+.L.end.eval2.47:
+  cmp r10, 0
+  jne .L.true.eval2.46
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 168
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 9
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.eval2.46
+  mov r10, 0
+  jmp .L.end.eval2.46
+.L.true.eval2.46:
+  mov r10, 1
+.L.end.eval2.46:
+  cmp r10, 0
+  je .L.end.eval2.45
+.loc 1 2105 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.20
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.eval2.45:
+.loc 1 2106 7
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 168
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 2107 7
+  mov r10, 0
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.eval2
+.L.break.eval2.1:
+.loc 1 2110 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.21
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.eval2:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl const_expr
+const_expr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 2114 38
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset conditional
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2115 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset eval
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.const_expr
+.L.return.const_expr:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+to_assign:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-72], rdi
+.loc 1 2121 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2122 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2124 55
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.22
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pointer_to
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset new_lvar
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2125 27
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2128 70
+.loc 1 2127 17
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 14
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_var_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+.loc 1 2128 37
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 18
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_unary
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+.loc 1 2127 17
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2137 20
+.loc 1 2131 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 14
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+.loc 1 2132 25
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 19
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_var_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_unary
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+.loc 1 2133 26
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+.loc 1 2134 36
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 19
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_var_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_unary
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+.loc 1 2135 35
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+.loc 1 2136 27
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+.loc 1 2133 16
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+.loc 1 2137 16
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+.loc 1 2131 5
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2139 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 16
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.to_assign
+.L.return.to_assign:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+assign:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 2146 38
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset conditional
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2148 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 74
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.assign.1
+.loc 1 2149 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 14
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset assign
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.assign
+.L.end.assign.1:
+.loc 1 2151 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 50
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.assign.2
+.loc 1 2152 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset assign
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_add
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset to_assign
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.assign
+.L.end.assign.2:
+.loc 1 2154 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 51
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.assign.3
+.loc 1 2155 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset assign
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_sub
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset to_assign
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.assign
+.L.end.assign.3:
+.loc 1 2157 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 52
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.assign.4
+.loc 1 2158 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset assign
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset to_assign
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.assign
+.L.end.assign.4:
+.loc 1 2160 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 53
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.assign.5
+.loc 1 2161 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset assign
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset to_assign
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.assign
+.L.end.assign.5:
+.loc 1 2163 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 56
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.assign.6
+.loc 1 2164 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset assign
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset to_assign
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.assign
+.L.end.assign.6:
+.loc 1 2166 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 57
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.assign.7
+.loc 1 2167 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset assign
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset to_assign
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.assign
+.L.end.assign.7:
+.loc 1 2169 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 58
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.assign.8
+.loc 1 2170 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset assign
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset to_assign
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.assign
+.L.end.assign.8:
+.loc 1 2172 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 59
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.assign.9
+.loc 1 2173 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset assign
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset to_assign
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.assign
+.L.end.assign.9:
+.loc 1 2175 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 43
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.assign.10
+.loc 1 2176 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset assign
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset to_assign
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.assign
+.L.end.assign.10:
+.loc 1 2178 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 44
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.assign.11
+.loc 1 2179 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 9
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset assign
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset to_assign
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.assign
+.L.end.assign.11:
+.loc 1 2181 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 2182 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.assign
+.L.return.assign:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+conditional:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-56], rsi
+  mov [rbp-64], rdi
+.loc 1 2187 32
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset logor
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2189 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 87
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.conditional.1
+.loc 1 2190 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 2191 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.conditional
+.L.end.conditional.1:
+.loc 1 2194 38
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 15
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2195 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 48
+  mov [r11], r10
+.loc 1 2196 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset expr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 56
+  mov [r11], r10
+.loc 1 2197 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 88
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov [r11], r10
+.loc 1 2198 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset conditional
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 64
+  mov [r11], r10
+.loc 1 2199 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.conditional
+.L.return.conditional:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+logor:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 2204 33
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset logand
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2205 3
+.L.begin.logor.1:
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 61
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.logor.1
+.loc 1 2206 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 23
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 2207 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset logand
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.L.continue.logor.1:
+  jmp .L.begin.logor.1
+.L.break.logor.1:
+.loc 1 2209 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 2210 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.logor
+.L.return.logor:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+logand:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 2215 32
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset bitor
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2216 3
+.L.begin.logand.1:
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 60
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.logand.1
+.loc 1 2217 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 22
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 2218 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset bitor
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.L.continue.logand.1:
+  jmp .L.begin.logand.1
+.L.break.logand.1:
+.loc 1 2220 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 2221 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.logand
+.L.return.logand:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+bitor:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 2226 33
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset bitxor
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2227 3
+.L.begin.bitor.1:
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 83
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.bitor.1
+.loc 1 2228 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 2229 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset bitxor
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.L.continue.bitor.1:
+  jmp .L.begin.bitor.1
+.L.break.bitor.1:
+.loc 1 2231 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 2232 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.bitor
+.L.return.bitor:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+bitxor:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 2237 33
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset bitand
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2238 3
+.L.begin.bitxor.1:
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 84
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.bitxor.1
+.loc 1 2239 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 2240 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset bitand
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.L.continue.bitxor.1:
+  jmp .L.begin.bitxor.1
+.L.break.bitxor.1:
+.loc 1 2242 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 2243 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.bitxor
+.L.return.bitxor:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+bitand:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 2248 35
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset equality
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2249 3
+.L.begin.bitand.1:
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 82
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.bitand.1
+.loc 1 2250 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 2251 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset equality
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.L.continue.bitand.1:
+  jmp .L.begin.bitand.1
+.L.break.bitand.1:
+.loc 1 2253 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 2254 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.bitand
+.L.return.bitand:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+equality:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 2259 37
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset relational
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2261 3
+.L.begin.equality.1:
+.loc 1 2262 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 45
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.equality.2
+.loc 1 2263 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 10
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 2264 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset relational
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.loc 1 2265 7
+  jmp .L.continue.equality.1
+.L.end.equality.2:
+.loc 1 2268 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 46
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.equality.3
+.loc 1 2269 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 11
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 2270 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset relational
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.loc 1 2271 7
+  jmp .L.continue.equality.1
+.L.end.equality.3:
+.loc 1 2274 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 2275 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.equality
+.L.continue.equality.1:
+  jmp .L.begin.equality.1
+.L.break.equality.1:
+.L.return.equality:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+relational:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 2281 32
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset shift
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2283 3
+.L.begin.relational.1:
+.loc 1 2284 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 75
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.relational.2
+.loc 1 2285 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 12
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 2286 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset shift
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.loc 1 2287 7
+  jmp .L.continue.relational.1
+.L.end.relational.2:
+.loc 1 2290 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 47
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.relational.3
+.loc 1 2291 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 13
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 2292 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset shift
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.loc 1 2293 7
+  jmp .L.continue.relational.1
+.L.end.relational.3:
+.loc 1 2296 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 76
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.relational.4
+.loc 1 2297 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 12
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 2298 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset shift
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+.loc 1 2299 7
+  jmp .L.continue.relational.1
+.L.end.relational.4:
+.loc 1 2302 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 48
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.relational.5
+.loc 1 2303 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 13
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 2304 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset shift
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+.loc 1 2305 7
+  jmp .L.continue.relational.1
+.L.end.relational.5:
+.loc 1 2308 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 2309 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.relational
+.L.continue.relational.1:
+  jmp .L.begin.relational.1
+.L.break.relational.1:
+.L.return.relational:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+shift:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 2315 30
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2317 3
+.L.begin.shift.1:
+.loc 1 2318 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 62
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.shift.2
+.loc 1 2319 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 2320 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.loc 1 2321 7
+  jmp .L.continue.shift.1
+.L.end.shift.2:
+.loc 1 2324 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 63
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.shift.3
+.loc 1 2325 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 9
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 2326 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.loc 1 2327 7
+  jmp .L.continue.shift.1
+.L.end.shift.3:
+.loc 1 2330 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 2331 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.shift
+.L.continue.shift.1:
+  jmp .L.begin.shift.1
+.L.break.shift.1:
+.L.return.shift:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+new_add:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdx
+  mov [rbp-56], rsi
+  mov [rbp-64], rdi
+.loc 1 2341 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2342 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2345 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_integer
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.false.new_add.2
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_integer
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.false.new_add.2
+  mov r10, 1
+  jmp .L.end.new_add.2
+.L.false.new_add.2:
+  mov r10, 0
+.L.end.new_add.2:
+  cmp r10, 0
+  je .L.end.new_add.1
+.loc 1 2346 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.new_add
+.L.end.new_add.1:
+.loc 1 2348 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.new_add.4
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.new_add.4
+  mov r10, 1
+  jmp .L.end.new_add.4
+.L.false.new_add.4:
+  mov r10, 0
+.L.end.new_add.4:
+  cmp r10, 0
+  je .L.end.new_add.3
+.loc 1 2349 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.23
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.new_add.3:
+.loc 1 2352 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.new_add.6
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.new_add.6
+  mov r10, 1
+  jmp .L.end.new_add.6
+.L.false.new_add.6:
+  mov r10, 0
+.L.end.new_add.6:
+  cmp r10, 0
+  je .L.end.new_add.5
+.loc 1 2353 5
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2354 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov [r11], r10
+.loc 1 2355 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov [r11], r10
+.L.end.new_add.5:
+.loc 1 2359 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_num
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov [r11], r10
+.loc 1 2360 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.new_add
+.L.return.new_add:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+new_sub:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdx
+  mov [rbp-56], rsi
+  mov [rbp-64], rdi
+.loc 1 2365 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2366 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2369 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_integer
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.false.new_sub.2
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_integer
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.false.new_sub.2
+  mov r10, 1
+  jmp .L.end.new_sub.2
+.L.false.new_sub.2:
+  mov r10, 0
+.L.end.new_sub.2:
+  cmp r10, 0
+  je .L.end.new_sub.1
+.loc 1 2370 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.new_sub
+.L.end.new_sub.1:
+.loc 1 2373 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.new_sub.4
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_integer
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.false.new_sub.4
+  mov r10, 1
+  jmp .L.end.new_sub.4
+.L.false.new_sub.4:
+  mov r10, 0
+.L.end.new_sub.4:
+  cmp r10, 0
+  je .L.end.new_sub.3
+.loc 1 2374 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_num
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov [r11], r10
+.loc 1 2375 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.new_sub
+.L.end.new_sub.3:
+.loc 1 2379 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.new_sub.6
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.new_sub.6
+  mov r10, 1
+  jmp .L.end.new_sub.6
+.L.false.new_sub.6:
+  mov r10, 0
+.L.end.new_sub.6:
+  cmp r10, 0
+  je .L.end.new_sub.5
+.loc 1 2380 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2381 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_num
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.new_sub
+.L.end.new_sub.5:
+.loc 1 2384 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.24
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.new_sub:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+add:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-56], rsi
+  mov [rbp-64], rdi
+.loc 1 2389 30
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset mul
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2391 3
+.L.begin.add.1:
+.loc 1 2392 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2394 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 77
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.add.2
+.loc 1 2395 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset mul
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_add
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov [r11], r10
+.loc 1 2396 7
+  jmp .L.continue.add.1
+.L.end.add.2:
+.loc 1 2399 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 78
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.add.3
+.loc 1 2400 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset mul
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_sub
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov [r11], r10
+.loc 1 2401 7
+  jmp .L.continue.add.1
+.L.end.add.3:
+.loc 1 2404 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 2405 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.add
+.L.continue.add.1:
+  jmp .L.begin.add.1
+.L.break.add.1:
+.L.return.add:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+mul:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 2411 31
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset cast
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2413 3
+.L.begin.mul.1:
+.loc 1 2414 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 79
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.mul.2
+.loc 1 2415 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 2416 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset cast
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.loc 1 2417 7
+  jmp .L.continue.mul.1
+.L.end.mul.2:
+.loc 1 2420 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 80
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.mul.3
+.loc 1 2421 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 2422 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset cast
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.loc 1 2423 7
+  jmp .L.continue.mul.1
+.L.end.mul.3:
+.loc 1 2426 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 81
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.mul.4
+.loc 1 2427 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 2428 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset cast
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.loc 1 2429 7
+  jmp .L.continue.mul.1
+.L.end.mul.4:
+.loc 1 2432 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 2433 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.mul
+.L.continue.mul.1:
+  jmp .L.begin.mul.1
+.L.break.mul.1:
+.L.return.mul:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+compound_literal:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-72], rcx
+  mov [rbp-80], rdx
+  mov [rbp-88], rsi
+  mov [rbp-96], rdi
+.loc 1 2439 3
+  mov r10, offset scope_depth
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.compound_literal.1
+.loc 1 2440 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset new_label
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset new_gvar
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2441 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gvar_initializer
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 48
+  mov [r11], r10
+.loc 1 2442 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_var_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.compound_literal
+.L.end.compound_literal.1:
+.loc 1 2445 39
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset new_label
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_lvar
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2446 42
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 37
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2447 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset lvar_initializer
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  add r10, 96
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 96
+  mov [r11], r10
+.loc 1 2448 37
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_var_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2449 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 16
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.compound_literal
+.L.return.compound_literal:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+cast:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-64], rsi
+  mov [rbp-72], rdi
+.loc 1 2456 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 65
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.cast.2
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_typename
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.false.cast.2
+  mov r10, 1
+  jmp .L.end.cast.2
+.L.false.cast.2:
+  mov r10, 0
+.L.end.cast.2:
+  cmp r10, 0
+  je .L.end.cast.1
+.loc 1 2457 5
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2458 41
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset typename
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2459 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 66
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov [r11], r10
+.loc 1 2461 5
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 67
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.cast.3
+.loc 1 2462 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset compound_literal
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.cast
+.L.end.cast.3:
+.loc 1 2464 46
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 40
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_unary
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2465 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset cast
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+.loc 1 2466 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2467 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 2468 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.cast
+.L.end.cast.1:
+.loc 1 2471 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset unary
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.cast
+.L.return.cast:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+unary:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rsi
+  mov [rbp-48], rdi
+.loc 1 2478 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 77
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.unary.1
+.loc 1 2479 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset cast
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.unary
+.L.end.unary.1:
+.loc 1 2481 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 78
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.unary.2
+.loc 1 2482 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_num
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset cast
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.unary
+.L.end.unary.2:
+.loc 1 2484 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 82
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.unary.3
+.loc 1 2485 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 18
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset cast
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_unary
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.unary
+.L.end.unary.3:
+.loc 1 2487 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 79
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.unary.4
+.loc 1 2488 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 19
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset cast
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_unary
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.unary
+.L.end.unary.4:
+.loc 1 2490 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 86
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.unary.5
+.loc 1 2491 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 20
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset cast
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_unary
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.unary
+.L.end.unary.5:
+.loc 1 2493 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 85
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.unary.6
+.loc 1 2494 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 21
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset cast
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_unary
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.unary
+.L.end.unary.6:
+.loc 1 2497 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 54
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.unary.7
+.loc 1 2498 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset unary
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_num
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_add
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset to_assign
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.unary
+.L.end.unary.7:
+.loc 1 2501 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 55
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.unary.8
+.loc 1 2502 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset unary
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_num
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_sub
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset to_assign
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.unary
+.L.end.unary.8:
+.loc 1 2504 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset postfix
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.unary
+.L.return.unary:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+struct_members:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 144
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-128], rsi
+  mov [rbp-136], rdi
+.loc 1 2509 19
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-120]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-120]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-120]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-120]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-120]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-120]
+  mov r12, 36
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 2510 22
+  lea r10, [rbp-120]
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2512 3
+.L.begin.struct_members.1:
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 68
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.struct_members.1
+.loc 1 2513 5
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-72]
+  mov r12, 1
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-72]
+  mov r12, 2
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-72]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 2514 46
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  push r10
+  sub rsp, 8
+  mov r10, offset typespec
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2515 16
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 2517 5
+.L.begin.struct_members.2:
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 71
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset consume
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.break.struct_members.2
+.loc 1 2518 7
+  lea r10, [rbp-52]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  cmp r10, 0
+  je .L.end.struct_members.3
+.loc 1 2519 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 72
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-128]
+  mov [r11], r10
+.L.end.struct_members.3:
+.loc 1 2521 57
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 40
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2522 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset declarator
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 2523 7
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10
+.loc 1 2524 7
+  lea r10, [rbp-72]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  cmp r10, 0
+  je  .L.else.struct_members.4
+  lea r10, [rbp-72]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  jmp .L.end.struct_members.4
+.L.else.struct_members.4:
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+.L.end.struct_members.4:
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10d
+.loc 1 2525 7
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+  lea r11, [rbp-80]
+  mov [r11], r10
+.L.continue.struct_members.2:
+  jmp .L.begin.struct_members.2
+.L.break.struct_members.2:
+.L.continue.struct_members.1:
+  jmp .L.begin.struct_members.1
+.L.break.struct_members.1:
+.loc 1 2529 3
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-136]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 2530 3
+  lea r10, [rbp-120]
+  add r10, 0
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.struct_members
+.L.return.struct_members:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+struct_union_decl:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-80], rsi
+  mov [rbp-88], rdi
+.loc 1 2536 17
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2537 3
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.struct_union_decl.1
+.loc 1 2538 5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov [r11], r10
+.loc 1 2539 5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov [r11], r10
+.L.end.struct_union_decl.1:
+.loc 1 2542 3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.struct_union_decl.3
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 67
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.struct_union_decl.3
+  mov r10, 1
+  jmp .L.end.struct_union_decl.3
+.L.false.struct_union_decl.3:
+  mov r10, 0
+.L.end.struct_union_decl.3:
+  cmp r10, 0
+  je .L.end.struct_union_decl.2
+.loc 1 2543 5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 2545 33
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset find_tag
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2546 5
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.struct_union_decl.4
+.loc 1 2547 7
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.struct_union_decl
+.L.end.struct_union_decl.4:
+.loc 1 2549 29
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset struct_type
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2550 5
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 13
+  mov [r11], r10b
+.loc 1 2551 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset push_tag_scope
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2552 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.struct_union_decl
+.L.end.struct_union_decl.2:
+.loc 1 2555 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 67
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-80]
+  mov [r11], r10
+.loc 1 2558 27
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset struct_type
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2559 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset struct_members
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 48
+  mov [r11], r10
+.loc 1 2561 3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.struct_union_decl.5
+.loc 1 2564 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset find_tag
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2565 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.struct_union_decl.7
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 16
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, offset scope_depth
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.struct_union_decl.7
+  mov r10, 1
+  jmp .L.end.struct_union_decl.7
+.L.false.struct_union_decl.7:
+  mov r10, 0
+.L.end.struct_union_decl.7:
+  cmp r10, 0
+  je .L.end.struct_union_decl.6
+.loc 1 2566 7
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 24
+  mov r11, [r11]
+  mov al, [r10+0]
+  mov [r11+0], al
+  mov al, [r10+1]
+  mov [r11+1], al
+  mov al, [r10+2]
+  mov [r11+2], al
+  mov al, [r10+3]
+  mov [r11+3], al
+  mov al, [r10+4]
+  mov [r11+4], al
+  mov al, [r10+5]
+  mov [r11+5], al
+  mov al, [r10+6]
+  mov [r11+6], al
+  mov al, [r10+7]
+  mov [r11+7], al
+  mov al, [r10+8]
+  mov [r11+8], al
+  mov al, [r10+9]
+  mov [r11+9], al
+  mov al, [r10+10]
+  mov [r11+10], al
+  mov al, [r10+11]
+  mov [r11+11], al
+  mov al, [r10+12]
+  mov [r11+12], al
+  mov al, [r10+13]
+  mov [r11+13], al
+  mov al, [r10+14]
+  mov [r11+14], al
+  mov al, [r10+15]
+  mov [r11+15], al
+  mov al, [r10+16]
+  mov [r11+16], al
+  mov al, [r10+17]
+  mov [r11+17], al
+  mov al, [r10+18]
+  mov [r11+18], al
+  mov al, [r10+19]
+  mov [r11+19], al
+  mov al, [r10+20]
+  mov [r11+20], al
+  mov al, [r10+21]
+  mov [r11+21], al
+  mov al, [r10+22]
+  mov [r11+22], al
+  mov al, [r10+23]
+  mov [r11+23], al
+  mov al, [r10+24]
+  mov [r11+24], al
+  mov al, [r10+25]
+  mov [r11+25], al
+  mov al, [r10+26]
+  mov [r11+26], al
+  mov al, [r10+27]
+  mov [r11+27], al
+  mov al, [r10+28]
+  mov [r11+28], al
+  mov al, [r10+29]
+  mov [r11+29], al
+  mov al, [r10+30]
+  mov [r11+30], al
+  mov al, [r10+31]
+  mov [r11+31], al
+  mov al, [r10+32]
+  mov [r11+32], al
+  mov al, [r10+33]
+  mov [r11+33], al
+  mov al, [r10+34]
+  mov [r11+34], al
+  mov al, [r10+35]
+  mov [r11+35], al
+  mov al, [r10+36]
+  mov [r11+36], al
+  mov al, [r10+37]
+  mov [r11+37], al
+  mov al, [r10+38]
+  mov [r11+38], al
+  mov al, [r10+39]
+  mov [r11+39], al
+  mov al, [r10+40]
+  mov [r11+40], al
+  mov al, [r10+41]
+  mov [r11+41], al
+  mov al, [r10+42]
+  mov [r11+42], al
+  mov al, [r10+43]
+  mov [r11+43], al
+  mov al, [r10+44]
+  mov [r11+44], al
+  mov al, [r10+45]
+  mov [r11+45], al
+  mov al, [r10+46]
+  mov [r11+46], al
+  mov al, [r10+47]
+  mov [r11+47], al
+  mov al, [r10+48]
+  mov [r11+48], al
+  mov al, [r10+49]
+  mov [r11+49], al
+  mov al, [r10+50]
+  mov [r11+50], al
+  mov al, [r10+51]
+  mov [r11+51], al
+  mov al, [r10+52]
+  mov [r11+52], al
+  mov al, [r10+53]
+  mov [r11+53], al
+  mov al, [r10+54]
+  mov [r11+54], al
+  mov al, [r10+55]
+  mov [r11+55], al
+  mov al, [r10+56]
+  mov [r11+56], al
+  mov al, [r10+57]
+  mov [r11+57], al
+  mov al, [r10+58]
+  mov [r11+58], al
+  mov al, [r10+59]
+  mov [r11+59], al
+  mov al, [r10+60]
+  mov [r11+60], al
+  mov al, [r10+61]
+  mov [r11+61], al
+  mov al, [r10+62]
+  mov [r11+62], al
+  mov al, [r10+63]
+  mov [r11+63], al
+  mov al, [r10+64]
+  mov [r11+64], al
+  mov al, [r10+65]
+  mov [r11+65], al
+  mov al, [r10+66]
+  mov [r11+66], al
+  mov al, [r10+67]
+  mov [r11+67], al
+  mov al, [r10+68]
+  mov [r11+68], al
+  mov al, [r10+69]
+  mov [r11+69], al
+  mov al, [r10+70]
+  mov [r11+70], al
+  mov al, [r10+71]
+  mov [r11+71], al
+  mov al, [r10+72]
+  mov [r11+72], al
+  mov al, [r10+73]
+  mov [r11+73], al
+  mov al, [r10+74]
+  mov [r11+74], al
+  mov al, [r10+75]
+  mov [r11+75], al
+  mov al, [r10+76]
+  mov [r11+76], al
+  mov al, [r10+77]
+  mov [r11+77], al
+  mov al, [r10+78]
+  mov [r11+78], al
+  mov al, [r10+79]
+  mov [r11+79], al
+  mov al, [r10+80]
+  mov [r11+80], al
+  mov al, [r10+81]
+  mov [r11+81], al
+  mov al, [r10+82]
+  mov [r11+82], al
+  mov al, [r10+83]
+  mov [r11+83], al
+  mov al, [r10+84]
+  mov [r11+84], al
+  mov al, [r10+85]
+  mov [r11+85], al
+  mov al, [r10+86]
+  mov [r11+86], al
+  mov al, [r10+87]
+  mov [r11+87], al
+.loc 1 2567 7
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.struct_union_decl
+.L.end.struct_union_decl.6:
+.loc 1 2570 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset push_tag_scope
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.struct_union_decl.5:
+.loc 1 2573 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.struct_union_decl
+.L.return.struct_union_decl:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+struct_decl:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-72], rsi
+  mov [rbp-80], rdi
+.loc 1 2578 42
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset struct_union_decl
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2581 17
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 2582 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 48
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.struct_decl.1:
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.struct_decl.1
+.loc 1 2583 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 32
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset align_to
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov [r11], r10d
+.loc 1 2584 5
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 36
+  mov [r11], r10d
+.loc 1 2585 5
+  lea r10, [rbp-52]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+.loc 1 2587 5
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 32
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.struct_decl.2
+.loc 1 2588 7
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 32
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10d
+.L.end.struct_decl.2:
+.L.continue.struct_decl.1:
+.loc 1 2582 40
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  jmp .L.begin.struct_decl.1
+.L.break.struct_decl.1:
+.loc 1 2590 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset align_to
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 4
+  mov [r11], r10d
+.loc 1 2591 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.struct_decl
+.L.return.struct_decl:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+union_decl:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-56], rsi
+  mov [rbp-64], rdi
+.loc 1 2596 42
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset struct_union_decl
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2601 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 48
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.union_decl.1:
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.union_decl.1
+.loc 1 2602 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov r11, [r11]
+  add r11, 8
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.union_decl.2
+.loc 1 2603 7
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10d
+.L.end.union_decl.2:
+.loc 1 2604 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.union_decl.3
+.loc 1 2605 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 4
+  mov [r11], r10d
+.L.end.union_decl.3:
+.L.continue.union_decl.1:
+.loc 1 2601 40
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  jmp .L.begin.union_decl.1
+.L.break.union_decl.1:
+.loc 1 2607 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset align_to
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 4
+  mov [r11], r10d
+.loc 1 2608 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.union_decl
+.L.return.union_decl:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+get_struct_member:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 2612 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 48
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.get_struct_member.1:
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.get_struct_member.1
+.loc 1 2613 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 32
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.get_struct_member.2
+.loc 1 2614 7
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.get_struct_member
+.L.end.get_struct_member.2:
+.L.continue.get_struct_member.1:
+.loc 1 2612 40
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  jmp .L.begin.get_struct_member.1
+.L.break.get_struct_member.1:
+.loc 1 2615 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.25
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.get_struct_member:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+struct_ref:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 2619 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2620 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.struct_ref.1
+.loc 1 2621 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.26
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.struct_ref.1:
+.loc 1 2623 46
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 17
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_unary
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2624 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_struct_member
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 104
+  mov [r11], r10
+.loc 1 2625 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.struct_ref
+.L.return.struct_ref:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+new_inc_dec:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-73], dl
+  mov [rbp-88], rsi
+  mov [rbp-96], rdi
+.loc 1 2631 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2632 47
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.27
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pointer_to
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset new_lvar
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2633 31
+  lea r10, [rbp-73]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je  .L.else.new_inc_dec.1
+  mov r10, 1
+  mov r10d, r10d
+  jmp .L.end.new_inc_dec.1
+.L.else.new_inc_dec.1:
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+.L.end.new_inc_dec.1:
+  mov r10d, r10d
+  lea r11, [rbp-60]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 2636 62
+.loc 1 2635 17
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 14
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_var_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+.loc 1 2636 37
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 18
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_unary
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+.loc 1 2635 17
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2643 20
+.loc 1 2639 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 14
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+.loc 1 2640 25
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 19
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_var_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_unary
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+.loc 1 2641 23
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 19
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_var_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_unary
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+.loc 1 2642 31
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_num
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+.loc 1 2641 16
+  mov r10, offset new_add
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+.loc 1 2643 16
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+.loc 1 2639 5
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2646 52
+.loc 1 2645 17
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 19
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_var_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_unary
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+.loc 1 2646 32
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-60]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_num
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+.loc 1 2645 17
+  mov r10, offset new_add
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2648 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 16
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 16
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_binary
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.new_inc_dec
+.L.return.new_inc_dec:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+postfix:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-80], rsi
+  mov [rbp-88], rdi
+.loc 1 2657 21
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2658 34
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset primary
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2660 3
+.L.begin.postfix.1:
+.loc 1 2661 5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 65
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.postfix.2
+.loc 1 2662 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2664 26
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2665 7
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.postfix.4
+.loc 1 2666 31
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 7
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.postfix.5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.postfix.5
+  mov r10, 0
+  jmp .L.end.postfix.5
+.L.true.postfix.5:
+  mov r10, 1
+.L.end.postfix.5:
+  cmp r10, 0
+  je .L.false.postfix.4
+  mov r10, 1
+  jmp .L.end.postfix.4
+.L.false.postfix.4:
+  mov r10, 0
+.L.end.postfix.4:
+  cmp r10, 0
+  je .L.end.postfix.3
+.loc 1 2667 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.28
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.postfix.3:
+.loc 1 2669 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 35
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_unary
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov [r11], r10
+.loc 1 2670 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset func_args
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 128
+  mov [r11], r10
+.loc 1 2671 7
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je  .L.else.postfix.6
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  jmp .L.end.postfix.6
+.L.else.postfix.6:
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+.L.end.postfix.6:
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 120
+  mov [r11], r10
+.loc 1 2672 7
+  jmp .L.continue.postfix.1
+.L.end.postfix.2:
+.loc 1 2675 5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 69
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.postfix.7
+.loc 1 2677 7
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2678 40
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset expr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2679 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 70
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-80]
+  mov [r11], r10
+.loc 1 2680 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 19
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_add
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_unary
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov [r11], r10
+.loc 1 2681 7
+  jmp .L.continue.postfix.1
+.L.end.postfix.7:
+.loc 1 2684 5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 73
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.postfix.8
+.loc 1 2685 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset struct_ref
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov [r11], r10
+.loc 1 2686 7
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov [r11], r10
+.loc 1 2687 7
+  jmp .L.continue.postfix.1
+.L.end.postfix.8:
+.loc 1 2690 5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 49
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.postfix.9
+.loc 1 2692 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 19
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_unary
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov [r11], r10
+.loc 1 2693 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset struct_ref
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov [r11], r10
+.loc 1 2694 7
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov [r11], r10
+.loc 1 2695 7
+  jmp .L.continue.postfix.1
+.L.end.postfix.9:
+.loc 1 2698 5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 54
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.postfix.10
+.loc 1 2699 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset new_inc_dec
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov [r11], r10
+.loc 1 2700 7
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov [r11], r10
+.loc 1 2701 7
+  jmp .L.continue.postfix.1
+.L.end.postfix.10:
+.loc 1 2704 5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 55
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.postfix.11
+.loc 1 2705 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset new_inc_dec
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov [r11], r10
+.loc 1 2706 7
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov [r11], r10
+.loc 1 2707 7
+  jmp .L.continue.postfix.1
+.L.end.postfix.11:
+.loc 1 2710 5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 2711 5
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.postfix
+.L.continue.postfix.1:
+  jmp .L.begin.postfix.1
+.L.break.postfix.1:
+.L.return.postfix:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+func_args:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 240
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-232], rsi
+  mov [rbp-240], rdi
+.loc 1 2717 17
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-224]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 48
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 56
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 64
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 72
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 80
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-224]
+  mov r12, 88
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 96
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 104
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 112
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 120
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 128
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 136
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 144
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 152
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-224]
+  mov r12, 160
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-224]
+  mov r12, 164
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 168
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-224]
+  mov r12, 176
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2718 20
+  lea r10, [rbp-224]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2720 3
+.L.begin.func_args.1:
+  lea r10, [rbp-232]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 66
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.func_args.1
+.loc 1 2721 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  lea r11, [rbp-224]
+  cmp r10, r11
+  setne al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.func_args.2
+.loc 1 2722 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-232]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 72
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-232]
+  mov [r11], r10
+.L.end.func_args.2:
+.loc 1 2723 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-232]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-232]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset assign
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+  lea r11, [rbp-40]
+  mov [r11], r10
+.L.continue.func_args.1:
+  jmp .L.begin.func_args.1
+.L.break.func_args.1:
+.loc 1 2726 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-232]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 66
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-240]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 2727 3
+  lea r10, [rbp-224]
+  add r10, 8
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.func_args
+.L.return.func_args:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+primary:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 128
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-120], rsi
+  mov [rbp-128], rdi
+.loc 1 2739 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 65
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.primary.2
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 67
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.primary.2
+  mov r10, 1
+  jmp .L.end.primary.2
+.L.false.primary.2:
+  mov r10, 0
+.L.end.primary.2:
+  cmp r10, 0
+  je .L.end.primary.1
+.loc 1 2741 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 37
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-112]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2742 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset compound_stmt
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  add r10, 96
+  mov r10, [r10]
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  add r11, 96
+  mov [r11], r10
+.loc 1 2743 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 66
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 2745 27
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  add r10, 96
+  mov r10, [r10]
+  lea r11, [rbp-104]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2746 5
+.L.begin.primary.3:
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.primary.3
+.loc 1 2747 7
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-104]
+  mov [r11], r10
+.L.continue.primary.3:
+  jmp .L.begin.primary.3
+.L.break.primary.3:
+.loc 1 2749 5
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 36
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.primary.4
+.loc 1 2750 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.29
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.primary.4:
+.loc 1 2751 5
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.primary
+.L.end.primary.1:
+.loc 1 2754 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 65
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.primary.5
+.loc 1 2755 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset expr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-96]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2756 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 66
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 2757 5
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.primary
+.L.end.primary.5:
+.loc 1 2760 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 7
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.primary.8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 65
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.primary.8
+  mov r10, 1
+  jmp .L.end.primary.8
+.L.false.primary.8:
+  mov r10, 0
+.L.end.primary.8:
+  cmp r10, 0
+  je .L.false.primary.7
+.loc 1 2761 18
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_typename
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.false.primary.7
+  mov r10, 1
+  jmp .L.end.primary.7
+.L.false.primary.7:
+  mov r10, 0
+.L.end.primary.7:
+  cmp r10, 0
+  je .L.end.primary.6
+.loc 1 2762 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset typename
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-88]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2763 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 66
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 2764 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_ulong
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.primary
+.L.end.primary.6:
+.loc 1 2767 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 7
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.primary.9
+.loc 1 2768 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset unary
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2769 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2770 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_ulong
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.primary
+.L.end.primary.9:
+.loc 1 2773 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 25
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.primary.10
+.loc 1 2774 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 65
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-120]
+  mov [r11], r10
+.loc 1 2775 35
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset typename
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2776 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 66
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 2777 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_ulong
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.primary
+.L.end.primary.10:
+.loc 1 2780 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.primary.11
+.loc 1 2783 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset find_var
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2784 5
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 2785 5
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.primary.12
+.loc 1 2786 7
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.primary.13
+.loc 1 2787 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_var_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.primary
+.L.end.primary.13:
+.loc 1 2788 7
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.primary.14
+.loc 1 2789 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 48
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_num
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.primary
+.L.end.primary.14:
+.L.end.primary.12:
+.loc 1 2792 5
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 65
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.primary.15
+.loc 1 2793 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.30
+  push r10
+  sub rsp, 8
+  mov r10, offset warn_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2794 62
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset ty_int
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset func_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset new_gvar
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2795 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_var_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.primary
+.L.end.primary.15:
+.loc 1 2798 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.31
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.primary.11:
+.loc 1 2801 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.primary.16
+.loc 1 2802 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 64
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 64
+  mov r10, [r10]
+  add r10, 24
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset new_string_literal
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2803 5
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 2804 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_var_node
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.primary
+.L.end.primary.16:
+.loc 1 2807 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 3
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.primary.17
+.loc 1 2808 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.32
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.primary.17:
+.loc 1 2810 43
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 64
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_num
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2811 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 64
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 2812 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 2813 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.primary
+.L.return.primary:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl save_scopes
+save_scopes:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 2818 13
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-88]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2819 3
+  mov r10, offset var_scope
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.save_scopes.1:
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.save_scopes.1
+.loc 1 2820 5
+  lea r10, [rbp-88]
+  lea r11, [rbp-72]
+  mov [r11], r10
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+.L.continue.save_scopes.1:
+.loc 1 2819 38
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov [r11], r10
+  jmp .L.begin.save_scopes.1
+.L.break.save_scopes.1:
+.loc 1 2821 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2823 3
+  mov r10, offset var_scope
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.save_scopes.2:
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.save_scopes.2
+.loc 1 2824 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_str
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2825 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_var
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2826 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2827 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2828 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 48
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.save_scopes.2:
+.loc 1 2823 38
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov [r11], r10
+  jmp .L.begin.save_scopes.2
+.L.break.save_scopes.2:
+.loc 1 2831 3
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-88]
+  mov [r11], r10
+.loc 1 2832 3
+  mov r10, offset tag_scope
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.save_scopes.3:
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.save_scopes.3
+.loc 1 2833 5
+  lea r10, [rbp-88]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+.L.continue.save_scopes.3:
+.loc 1 2832 38
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov [r11], r10
+  jmp .L.begin.save_scopes.3
+.L.break.save_scopes.3:
+.loc 1 2834 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2836 3
+  mov r10, offset tag_scope
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.save_scopes.4:
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.save_scopes.4
+.loc 1 2837 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_str
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2838 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.save_scopes.4:
+.loc 1 2836 38
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  jmp .L.begin.save_scopes.4
+.L.break.save_scopes.4:
+.L.return.save_scopes:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl load_scopes
+load_scopes:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 176
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 2844 21
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-168]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-168]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-168]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-168]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-168]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-168]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-168]
+  mov r12, 48
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 2845 24
+  lea r10, [rbp-168]
+  lea r11, [rbp-112]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2847 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-104]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.load_scopes.1:
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.break.load_scopes.1
+.loc 1 2848 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 56
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+  lea r11, [rbp-112]
+  mov [r11], r10
+.loc 1 2849 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_name
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 2850 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_var
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10
+.loc 1 2851 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_type
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+.loc 1 2852 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_type
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.loc 1 2853 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  add r11, 48
+  mov [r11], r10d
+.L.continue.load_scopes.1:
+.loc 1 2847 40
+  lea r10, [rbp-104]
+  lea r11, [rbp-96]
+  mov [r11], r10
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-96]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  jmp .L.begin.load_scopes.1
+.L.break.load_scopes.1:
+.loc 1 2855 3
+  mov r10, offset var_scope
+  mov r10, [r10]
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 2856 3
+  lea r10, [rbp-168]
+  add r10, 0
+  mov r10, [r10]
+  mov r11, offset var_scope
+  mov [r11], r10
+.loc 1 2858 22
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-88]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-88]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-88]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-88]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2859 26
+  lea r10, [rbp-88]
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2861 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.load_scopes.2:
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.break.load_scopes.2
+.loc 1 2862 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 32
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+  lea r11, [rbp-56]
+  mov [r11], r10
+.loc 1 2863 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_name
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 2864 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_type
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10
+.L.continue.load_scopes.2:
+.loc 1 2861 40
+  lea r10, [rbp-48]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  jmp .L.begin.load_scopes.2
+.L.break.load_scopes.2:
+.loc 1 2866 3
+  mov r10, offset tag_scope
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 2867 3
+  lea r10, [rbp-88]
+  add r10, 0
+  mov r10, [r10]
+  mov r11, offset tag_scope
+  mov [r11], r10
+.L.return.load_scopes:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl parse
+parse:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 160
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-160], rdi
+.loc 1 2873 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.33
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset ty_void
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset func_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset new_gvar
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2876 21
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-152]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-152]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-152]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-152]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-152]
+  mov r12, 25
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-152]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-152]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-152]
+  mov r12, 48
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-152]
+  mov r12, 56
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2877 24
+  lea r10, [rbp-152]
+  lea r11, [rbp-88]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2878 3
+  mov r10, 0
+  movsx r10, r10d
+  mov r11, offset globals
+  mov [r11], r10
+.loc 1 2880 3
+.L.begin.parse.1:
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.parse.1
+.loc 1 2881 5
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2882 22
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-72]
+  mov r12, 1
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-72]
+  mov r12, 2
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-72]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 2883 46
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  push r10
+  sub rsp, 8
+  mov r10, offset typespec
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2884 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 71
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset consume
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.parse.2
+.loc 1 2885 7
+  jmp .L.continue.parse.1
+.L.end.parse.2:
+.loc 1 2886 45
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset declarator
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2889 5
+  lea r10, [rbp-72]
+  add r10, 0
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.parse.3
+.loc 1 2890 7
+.L.begin.parse.4:
+.loc 1 2891 9
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.parse.5
+.loc 1 2892 11
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.34
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.parse.5:
+.loc 1 2893 9
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_ident
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset push_scope
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  add r11, 32
+  mov [r11], r10
+.loc 1 2895 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 71
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset consume
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.parse.6
+.loc 1 2896 11
+  jmp .L.break.parse.4
+.L.end.parse.6:
+.loc 1 2897 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 72
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-160]
+  mov [r11], r10
+.loc 1 2898 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset declarator
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov [r11], r10
+.L.continue.parse.4:
+  jmp .L.begin.parse.4
+.L.break.parse.4:
+.loc 1 2900 7
+  jmp .L.continue.parse.1
+.L.end.parse.3:
+.loc 1 2904 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.parse.7
+.loc 1 2905 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_ident
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset new_gvar
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r11, offset current_fn
+  mov [r11], r10
+.loc 1 2906 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 71
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset consume
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.parse.8
+.loc 1 2907 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset funcdef
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+  lea r11, [rbp-88]
+  mov [r11], r10
+.L.end.parse.8:
+.loc 1 2908 7
+  jmp .L.continue.parse.1
+.L.end.parse.7:
+.loc 1 2912 5
+.L.begin.parse.9:
+.loc 1 2913 9
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.parse.10
+.loc 1 2914 11
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.35
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.parse.10:
+.loc 1 2916 84
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_ident
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  add r10, 1
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  add r10, 2
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset new_gvar
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2917 7
+  lea r10, [rbp-72]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  cmp r10, 0
+  je .L.end.parse.11
+.loc 1 2918 9
+  lea r10, [rbp-72]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 36
+  mov [r11], r10d
+.L.end.parse.11:
+.loc 1 2920 7
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 74
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.parse.12
+.loc 1 2921 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gvar_initializer
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 48
+  mov [r11], r10
+.L.end.parse.12:
+.loc 1 2923 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 71
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset consume
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.parse.13
+.loc 1 2924 9
+  jmp .L.break.parse.9
+.L.end.parse.13:
+.loc 1 2925 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 72
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-160]
+  mov [r11], r10
+.loc 1 2926 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-160]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset declarator
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov [r11], r10
+.L.continue.parse.9:
+  jmp .L.begin.parse.9
+.L.break.parse.9:
+.L.continue.parse.1:
+  jmp .L.begin.parse.1
+.L.break.parse.1:
+.loc 1 2930 58
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 9
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 16
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2931 3
+  mov r10, offset globals
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 2932 3
+  lea r10, [rbp-152]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 2933 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.parse
+.L.return.parse:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,7280 @@
+.file 1 "pch.c"
+.intel_syntax noprefix
+.bss
+.align 8
+.L.data.1:
+  .zero 88
+.align 4
+file_map_cap:
+  .zero 4
+.align 8
+file_map:
+  .zero 8
+.align 8
+objs_cap:
+  .zero 8
+.align 8
+objs:
+  .zero 8
+.align 8
+in_path:
+  .zero 8
+.align 8
+in_pos:
+  .zero 8
+.align 8
+in_len:
+  .zero 8
+.align 8
+in:
+  .zero 8
+.align 8
+nr_objs:
+  .zero 8
+.align 8
+obj_ids:
+  .zero 32
+.align 8
+out_cap:
+  .zero 8
+.align 8
+out_len:
+  .zero 8
+.align 8
+out:
+  .zero 8
+.data
+.align 1
+.L.data.10:
+  .byte 37
+  .byte 115
+  .byte 58
+  .byte 32
+  .byte 112
+  .byte 114
+  .byte 101
+  .byte 99
+  .byte 111
+  .byte 109
+  .byte 112
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 104
+  .byte 101
+  .byte 97
+  .byte 100
+  .byte 101
+  .byte 114
+  .byte 32
+  .byte 105
+  .byte 115
+  .byte 32
+  .byte 111
+  .byte 117
+  .byte 116
+  .byte 32
+  .byte 111
+  .byte 102
+  .byte 32
+  .byte 100
+  .byte 97
+  .byte 116
+  .byte 101
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 32
+  .byte 104
+  .byte 97
+  .byte 115
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 110
+  .byte 103
+  .byte 101
+  .byte 100
+  .zero 1
+.align 1
+.L.data.9:
+  .byte 37
+  .byte 115
+  .byte 58
+  .byte 32
+  .byte 112
+  .byte 114
+  .byte 101
+  .byte 99
+  .byte 111
+  .byte 109
+  .byte 112
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 104
+  .byte 101
+  .byte 97
+  .byte 100
+  .byte 101
+  .byte 114
+  .byte 32
+  .byte 119
+  .byte 97
+  .byte 115
+  .byte 32
+  .byte 99
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 116
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 98
+  .byte 121
+  .byte 32
+  .byte 97
+  .byte 32
+  .byte 100
+  .byte 105
+  .byte 102
+  .byte 102
+  .byte 101
+  .byte 114
+  .byte 101
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 109
+  .byte 112
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 114
+  .zero 1
+.align 1
+.L.data.8:
+  .byte 47
+  .byte 112
+  .byte 114
+  .byte 111
+  .byte 99
+  .byte 47
+  .byte 115
+  .byte 101
+  .byte 108
+  .byte 102
+  .byte 47
+  .byte 101
+  .byte 120
+  .byte 101
+  .zero 1
+.align 1
+.L.data.7:
+  .byte 37
+  .byte 115
+  .byte 58
+  .byte 32
+  .byte 110
+  .byte 111
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 32
+  .byte 112
+  .byte 114
+  .byte 101
+  .byte 99
+  .byte 111
+  .byte 109
+  .byte 112
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 104
+  .byte 101
+  .byte 97
+  .byte 100
+  .byte 101
+  .byte 114
+  .zero 1
+.align 1
+.L.data.6:
+  .byte 99
+  .byte 97
+  .byte 110
+  .byte 110
+  .byte 111
+  .byte 116
+  .byte 32
+  .byte 111
+  .byte 112
+  .byte 101
+  .byte 110
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.5:
+  .byte 37
+  .byte 115
+  .byte 58
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 114
+  .byte 114
+  .byte 117
+  .byte 112
+  .byte 116
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 112
+  .byte 114
+  .byte 101
+  .byte 99
+  .byte 111
+  .byte 109
+  .byte 112
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 104
+  .byte 101
+  .byte 97
+  .byte 100
+  .byte 101
+  .byte 114
+  .zero 1
+.align 1
+.L.data.4:
+  .byte 37
+  .byte 115
+  .byte 58
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 114
+  .byte 114
+  .byte 117
+  .byte 112
+  .byte 116
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 112
+  .byte 114
+  .byte 101
+  .byte 99
+  .byte 111
+  .byte 109
+  .byte 112
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 104
+  .byte 101
+  .byte 97
+  .byte 100
+  .byte 101
+  .byte 114
+  .zero 1
+.align 1
+.L.data.3:
+  .byte 37
+  .byte 115
+  .byte 58
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 114
+  .byte 114
+  .byte 117
+  .byte 112
+  .byte 116
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 112
+  .byte 114
+  .byte 101
+  .byte 99
+  .byte 111
+  .byte 109
+  .byte 112
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 104
+  .byte 101
+  .byte 97
+  .byte 100
+  .byte 101
+  .byte 114
+  .zero 1
+.align 1
+.L.data.2:
+  .byte 47
+  .byte 112
+  .byte 114
+  .byte 111
+  .byte 99
+  .byte 47
+  .byte 115
+  .byte 101
+  .byte 108
+  .byte 102
+  .byte 47
+  .byte 101
+  .byte 120
+  .byte 101
+  .zero 1
+.align 1
+.L.data.0:
+  .byte 80
+  .byte 85
+  .byte 78
+  .byte 89
+  .byte 67
+  .byte 80
+  .byte 67
+  .byte 72
+  .zero 1
+.align 8
+pch_magic:
+  .quad .L.data.0+0
+.text
+assert:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.L.return.assert:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+va_end:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.L.return.va_end:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+builtin_types:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 783 25
+.loc 1 784 3
+  mov r10, offset ty_void
+  mov r10, [r10]
+  mov r11, offset .L.data.1
+  mov r12, 0
+  mov r12d, r12d
+  mov r13, 8
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 785 3
+  mov r10, offset ty_bool
+  mov r10, [r10]
+  mov r11, offset .L.data.1
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 8
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 786 3
+  mov r10, offset ty_char
+  mov r10, [r10]
+  mov r11, offset .L.data.1
+  mov r12, 2
+  mov r12d, r12d
+  mov r13, 8
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 787 3
+  mov r10, offset ty_short
+  mov r10, [r10]
+  mov r11, offset .L.data.1
+  mov r12, 3
+  mov r12d, r12d
+  mov r13, 8
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 788 3
+  mov r10, offset ty_int
+  mov r10, [r10]
+  mov r11, offset .L.data.1
+  mov r12, 4
+  mov r12d, r12d
+  mov r13, 8
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 789 3
+  mov r10, offset ty_long
+  mov r10, [r10]
+  mov r11, offset .L.data.1
+  mov r12, 5
+  mov r12d, r12d
+  mov r13, 8
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 790 3
+  mov r10, offset ty_uchar
+  mov r10, [r10]
+  mov r11, offset .L.data.1
+  mov r12, 6
+  mov r12d, r12d
+  mov r13, 8
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 791 3
+  mov r10, offset ty_ushort
+  mov r10, [r10]
+  mov r11, offset .L.data.1
+  mov r12, 7
+  mov r12d, r12d
+  mov r13, 8
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 792 3
+  mov r10, offset ty_uint
+  mov r10, [r10]
+  mov r11, offset .L.data.1
+  mov r12, 8
+  mov r12d, r12d
+  mov r13, 8
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 793 3
+  mov r10, offset ty_ulong
+  mov r10, [r10]
+  mov r11, offset .L.data.1
+  mov r12, 9
+  mov r12d, r12d
+  mov r13, 8
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 794 3
+  mov r10, 0
+  movsx r10, r10d
+  mov r11, offset .L.data.1
+  mov r12, 10
+  mov r12d, r12d
+  mov r13, 8
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 795 3
+  mov r10, offset .L.data.1
+  mov rax, r10
+  jmp .L.return.builtin_types
+.L.return.builtin_types:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+put_bytes:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 803 3
+  mov r10, offset out_cap
+  mov r10, [r10]
+  mov r11, offset out_len
+  mov r11, [r11]
+  lea r12, [rbp-48]
+  mov r12, [r12]
+  add r11, r12
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.put_bytes.1
+.loc 1 804 5
+.L.begin.put_bytes.2:
+  mov r10, offset out_cap
+  mov r10, [r10]
+  mov r11, offset out_len
+  mov r11, [r11]
+  lea r12, [rbp-48]
+  mov r12, [r12]
+  add r11, r12
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.break.put_bytes.2
+.loc 1 805 7
+  mov r10, offset out_cap
+  mov r10, [r10]
+  cmp r10, 0
+  je  .L.else.put_bytes.3
+  mov r10, offset out_cap
+  mov r10, [r10]
+  mov r11, 2
+  movsx r11, r11d
+  imul r10, r11
+  jmp .L.end.put_bytes.3
+.L.else.put_bytes.3:
+  mov r10, 4096
+  movsx r10, r10d
+.L.end.put_bytes.3:
+  mov r11, offset out_cap
+  mov [r11], r10
+.L.continue.put_bytes.2:
+  jmp .L.begin.put_bytes.2
+.L.break.put_bytes.2:
+.loc 1 806 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset out
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset out_cap
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset realloc
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r11, offset out
+  mov [r11], r10
+.L.end.put_bytes.1:
+.loc 1 808 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset out
+  mov r10, [r10]
+  mov r11, offset out_len
+  mov r11, [r11]
+  mov r12, 1
+  movsx r12, r12d
+  imul r11, r12
+  add r10, r11
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset memcpy
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 809 3
+  mov r10, offset out_len
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+.L.return.put_bytes:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl pch_put_long
+pch_put_long:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 813 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset put_bytes
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.pch_put_long:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+add_id:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-56], rdi
+.loc 1 818 46
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 12
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 819 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset memcpy
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 820 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset obj_ids
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset nr_objs
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_put2
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.add_id:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+put_ref:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdi
+.loc 1 827 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.put_ref.1
+.loc 1 828 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 829 5
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.put_ref
+.L.end.put_ref.1:
+.loc 1 832 64
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset obj_ids
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_get2
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 833 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.put_ref.2
+.loc 1 834 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 835 5
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.put_ref
+.L.end.put_ref.2:
+.loc 1 838 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_id
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 839 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, -1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 840 3
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.put_ref
+.L.return.put_ref:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+put_blob:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rsi
+  mov [rbp-48], rdi
+.loc 1 844 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 845 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset put_bytes
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.put_blob:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl pch_put_str
+pch_put_str:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 849 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset put_ref
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.pch_put_str.1
+.loc 1 850 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strlen
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset put_blob
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.pch_put_str.1:
+.L.return.pch_put_str:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+put_file:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 854 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset put_ref
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.put_file.1
+.loc 1 855 5
+  jmp .L.return.put_file
+.L.end.put_file.1:
+.loc 1 856 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_str
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 857 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_str
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 858 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 16
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.put_file:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+put_literal:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 862 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset put_ref
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.put_literal.1
+.loc 1 863 5
+  jmp .L.return.put_literal
+.L.end.put_literal.1:
+.loc 1 864 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 865 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 866 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  mov r11, 0
+  movsx r11, r11d
+  cmp r10, r11
+  setne al
+  movzb r10, al
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 867 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.put_literal.2
+.loc 1 868 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 24
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset put_blob
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.put_literal.2:
+.L.return.put_literal:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+put_token_fields:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 872 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 873 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 874 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset put_file
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 875 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 56
+  mov r11, [r11]
+  add r11, 8
+  mov r11, [r11]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 876 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 24
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 877 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  mov r11, 0
+  movsx r11, r11d
+  cmp r10, r11
+  setne al
+  movzb r10, al
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 878 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 64
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset put_literal
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 879 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 28
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 880 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 48
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 881 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 49
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.put_token_fields:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl pch_put_token
+pch_put_token:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 886 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset put_ref
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.pch_put_token.1
+.loc 1 887 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset put_token_fields
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.pch_put_token.1:
+.L.return.pch_put_token:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl pch_put_tokens
+pch_put_tokens:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-72], rdi
+.loc 1 892 13
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 893 3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.pch_put_tokens.1:
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.pch_put_tokens.1
+.loc 1 894 5
+  lea r10, [rbp-64]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+.L.continue.pch_put_tokens.1:
+.loc 1 893 27
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov [r11], r10
+  jmp .L.begin.pch_put_tokens.1
+.L.break.pch_put_tokens.1:
+.loc 1 896 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 897 3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.pch_put_tokens.2:
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.pch_put_tokens.2
+.loc 1 898 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset put_token_fields
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.pch_put_tokens.2:
+.loc 1 897 27
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  jmp .L.begin.pch_put_tokens.2
+.L.break.pch_put_tokens.2:
+.L.return.pch_put_tokens:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+put_member:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 902 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset put_ref
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.put_member.1
+.loc 1 903 5
+  jmp .L.return.put_member
+.L.end.put_member.1:
+.loc 1 904 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset put_member
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 905 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 906 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_token
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 907 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_token
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 908 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 32
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 909 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 36
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.put_member:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl pch_put_type
+pch_put_type:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 913 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset put_ref
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.pch_put_type.1
+.loc 1 914 5
+  jmp .L.return.pch_put_type
+.L.end.pch_put_type.1:
+.loc 1 915 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 916 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 917 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 918 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 12
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 919 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 13
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 920 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 14
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 921 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 922 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_token
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 923 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_token
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 924 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 40
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 925 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 48
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset put_member
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 926 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 927 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 64
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 928 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 72
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 929 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 80
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.pch_put_type:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl pch_put_var
+pch_put_var:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 933 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset put_ref
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.pch_put_var.1
+.loc 1 934 5
+  jmp .L.return.pch_put_var
+.L.end.pch_put_var.1:
+.loc 1 935 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_str
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 936 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 937 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_token
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 938 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 36
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 939 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 40
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.pch_put_var:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+put_compiler_id:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 176
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 943 22
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-176]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-176]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-176]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-176]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-176]
+  mov r12, 28
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-176]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-176]
+  mov r12, 36
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-176]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-176]
+  mov r12, 48
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-176]
+  mov r12, 56
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-176]
+  mov r12, 64
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-176]
+  mov r12, 72
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-176]
+  mov r12, 80
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-176]
+  mov r12, 88
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-176]
+  mov r12, 96
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-176]
+  mov r12, 104
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-176]
+  mov r12, 112
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-176]
+  mov r12, 120
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-176]
+  mov r12, 128
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-176]
+  mov r12, 136
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 944 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.2
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-176]
+  push r10
+  sub rsp, 8
+  mov r10, offset stat
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 945 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-176]
+  add r10, 48
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 946 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-176]
+  add r10, 88
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 947 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-176]
+  add r10, 88
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.put_compiler_id:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl write_pch
+write_pch:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-56], rdi
+.loc 1 952 3
+  mov r10, 0
+  movsx r10, r10d
+  mov r11, offset nr_objs
+  mov [r11], r10
+.loc 1 953 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_magic
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_magic
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strlen
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset put_bytes
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 954 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 955 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset put_compiler_id
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 957 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset builtin_types
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.write_pch.1:
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.write_pch.1
+.loc 1 958 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_id
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.write_pch.1:
+.loc 1 957 42
+  lea r10, [rbp-48]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  jmp .L.begin.write_pch.1
+.L.break.write_pch.1:
+.loc 1 960 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset save_file_ids
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 961 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset save_macros
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 962 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset save_scopes
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 964 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset open_output
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 965 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset out
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset out_len
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset write_output
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.write_pch:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+get_bytes:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 973 3
+  mov r10, offset in_len
+  mov r10, [r10]
+  mov r11, offset in_pos
+  mov r11, [r11]
+  lea r12, [rbp-48]
+  mov r12, [r12]
+  add r11, r12
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.get_bytes.1
+.loc 1 974 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.3
+  push r10
+  sub rsp, 8
+  mov r10, offset in_path
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.get_bytes.1:
+.loc 1 975 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset in
+  mov r10, [r10]
+  mov r11, offset in_pos
+  mov r11, [r11]
+  mov r12, 1
+  movsx r12, r12d
+  imul r11, r12
+  add r10, r11
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset memcpy
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 976 3
+  mov r10, offset in_pos
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+.L.return.get_bytes:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl pch_get_long
+pch_get_long:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 980 11
+.loc 1 981 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset get_bytes
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 982 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.pch_get_long
+.L.return.pch_get_long:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+add_obj:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdi
+.loc 1 986 3
+  mov r10, offset nr_objs
+  mov r10, [r10]
+  mov r11, offset objs_cap
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.add_obj.1
+.loc 1 987 5
+  mov r10, offset objs_cap
+  mov r10, [r10]
+  cmp r10, 0
+  je  .L.else.add_obj.2
+  mov r10, offset objs_cap
+  mov r10, [r10]
+  mov r11, 2
+  movsx r11, r11d
+  imul r10, r11
+  jmp .L.end.add_obj.2
+.L.else.add_obj.2:
+  mov r10, 1024
+  movsx r10, r10d
+.L.end.add_obj.2:
+  mov r11, offset objs_cap
+  mov [r11], r10
+.loc 1 988 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset objs
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  mov r11, offset objs_cap
+  mov r11, [r11]
+  imul r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset realloc
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r11, offset objs
+  mov [r11], r10
+.L.end.add_obj.1:
+.loc 1 990 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r11, offset objs
+  mov r11, [r11]
+  mov r12, offset nr_objs
+  lea r13, [rbp-40]
+  mov [r13], r12
+  lea r12, [rbp-40]
+  mov r12, [r12]
+  mov r12, [r12]
+  mov r13, 1
+  movsx r13, r13d
+  add r12, r13
+  lea r13, [rbp-40]
+  mov r13, [r13]
+  mov [r13], r12
+  lea r12, [rbp-40]
+  mov r12, [r12]
+  mov r12, [r12]
+  mov r13, -1
+  movsx r13, r13d
+  add r12, r13
+  mov r13, 8
+  movsx r13, r13d
+  imul r12, r13
+  add r11, r12
+  mov [r11], r10
+.L.return.add_obj:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+get_ref:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdi
+.loc 1 997 3
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10b
+.loc 1 999 27
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1000 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, 0
+  movsx r11, r11d
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.get_ref.1
+.loc 1 1001 5
+  mov r10, 0
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.get_ref
+.L.end.get_ref.1:
+.loc 1 1003 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.get_ref.2
+.loc 1 1004 5
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10b
+.loc 1 1005 5
+  mov r10, 0
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.get_ref
+.L.end.get_ref.2:
+.loc 1 1008 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  jne .L.true.get_ref.4
+  mov r10, offset nr_objs
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  jne .L.true.get_ref.4
+  mov r10, 0
+  jmp .L.end.get_ref.4
+.L.true.get_ref.4:
+  mov r10, 1
+.L.end.get_ref.4:
+  cmp r10, 0
+  je .L.end.get_ref.3
+.loc 1 1009 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.4
+  push r10
+  sub rsp, 8
+  mov r10, offset in_path
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.get_ref.3:
+.loc 1 1010 3
+  mov r10, offset objs
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov r12, 1
+  movsx r12, r12d
+  sub r11, r12
+  mov r12, 8
+  movsx r12, r12d
+  imul r11, r12
+  add r10, r11
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.get_ref
+.L.return.get_ref:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+get_blob:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-56], rdi
+.loc 1 1014 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1015 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 0
+  movsx r11, r11d
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  jne .L.true.get_blob.2
+  mov r10, offset in_len
+  mov r10, [r10]
+  mov r11, offset in_pos
+  mov r11, [r11]
+  lea r12, [rbp-56]
+  mov r12, [r12]
+  mov r12, [r12]
+  add r11, r12
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  jne .L.true.get_blob.2
+  mov r10, 0
+  jmp .L.end.get_blob.2
+.L.true.get_blob.2:
+  mov r10, 1
+.L.end.get_blob.2:
+  cmp r10, 0
+  je .L.end.get_blob.1
+.loc 1 1016 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.5
+  push r10
+  sub rsp, 8
+  mov r10, offset in_path
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.get_blob.1:
+.loc 1 1017 41
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset in
+  mov r10, [r10]
+  mov r11, offset in_pos
+  mov r11, [r11]
+  mov r12, 1
+  movsx r12, r12d
+  imul r11, r12
+  add r10, r11
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_str
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1018 3
+  mov r10, offset in_pos
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov r11, [r11]
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1019 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.get_blob
+.L.return.get_blob:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl pch_get_str
+pch_get_str:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 1023 14
+.loc 1 1024 28
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-49]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_ref
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1025 3
+  lea r10, [rbp-49]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.pch_get_str.1
+.loc 1 1026 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.pch_get_str
+.L.end.pch_get_str.1:
+.loc 1 1028 11
+.loc 1 1029 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_blob
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov [r11], r10
+.loc 1 1030 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_obj
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1031 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.pch_get_str
+.L.return.pch_get_str:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl pch_get_name
+pch_get_name:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 1036 26
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_str
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1037 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je  .L.else.pch_get_name.1
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strlen
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset intern
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.pch_get_name.1
+.L.else.pch_get_name.1:
+  mov r10, 0
+  movsx r10, r10d
+.L.end.pch_get_name.1:
+  mov rax, r10
+  jmp .L.return.pch_get_name
+.L.return.pch_get_name:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+map_file_no:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-52], edi
+.loc 1 1041 3
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.map_file_no.1
+.loc 1 1042 5
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.map_file_no
+.L.end.map_file_no.1:
+.loc 1 1044 3
+  mov r10, offset file_map_cap
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.map_file_no.2
+.loc 1 1045 5
+  mov r10, offset file_map_cap
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1046 5
+.L.begin.map_file_no.3:
+  mov r10, offset file_map_cap
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.map_file_no.3
+.loc 1 1047 7
+  mov r10, offset file_map_cap
+  mov r10d, dword ptr [r10]
+  cmp r10, 0
+  je  .L.else.map_file_no.4
+  mov r10, offset file_map_cap
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  imul r10d, r11d
+  mov r10d, r10d
+  jmp .L.end.map_file_no.4
+.L.else.map_file_no.4:
+  mov r10, 16
+  mov r10d, r10d
+.L.end.map_file_no.4:
+  mov r10d, r10d
+  mov r11, offset file_map_cap
+  mov [r11], r10d
+.L.continue.map_file_no.3:
+  jmp .L.begin.map_file_no.3
+.L.break.map_file_no.3:
+.loc 1 1048 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset file_map
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  mov r11, offset file_map_cap
+  mov r11d, dword ptr [r11]
+  movsx r11, r11d
+  imul r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset realloc
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r11, offset file_map
+  mov [r11], r10
+.loc 1 1049 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset file_map
+  mov r10, [r10]
+  lea r11, [rbp-36]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  mov r11, offset file_map_cap
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  lea r12, [rbp-36]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  sub r11d, r12d
+  movsx r11, r11d
+  imul r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset memset
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.map_file_no.2:
+.loc 1 1052 3
+  mov r10, offset file_map
+  mov r10, [r10]
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.map_file_no.5
+.loc 1 1053 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_file
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  mov r11, offset file_map
+  mov r11, [r11]
+  lea r12, [rbp-52]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.end.map_file_no.5:
+.loc 1 1054 3
+  mov r10, offset file_map
+  mov r10, [r10]
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.map_file_no
+.L.return.map_file_no:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+get_file:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 1058 14
+.loc 1 1059 31
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-41]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_ref
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1060 3
+  lea r10, [rbp-41]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.get_file.1
+.loc 1 1061 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.get_file
+.L.end.get_file.1:
+.loc 1 1063 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 13
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 40
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 1064 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_obj
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1065 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_str
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 1066 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_str
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 1067 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset map_file_no
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10d
+.loc 1 1068 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.get_file
+.L.return.get_file:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+get_literal:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 1072 14
+.loc 1 1073 33
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-49]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_ref
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1074 3
+  lea r10, [rbp-49]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.get_literal.1
+.loc 1 1075 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.get_literal
+.L.end.get_literal.1:
+.loc 1 1077 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 32
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov [r11], r10
+.loc 1 1078 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_obj
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1079 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 1080 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_type
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 1081 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.get_literal.2
+.loc 1 1082 5
+.loc 1 1083 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_blob
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 1084 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10d
+.L.end.get_literal.2:
+.loc 1 1086 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.get_literal
+.L.return.get_literal:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+get_token_fields:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 1090 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10d
+.loc 1 1091 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 4
+  mov [r11], r10d
+.loc 1 1092 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset get_file
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 56
+  mov [r11], r10
+.loc 1 1093 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  mov r12, 1
+  movsx r12, r12d
+  imul r11, r12
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 1094 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10d
+.loc 1 1095 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.get_token_fields.1
+.loc 1 1096 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 24
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset intern
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+.L.end.get_token_fields.1:
+.loc 1 1097 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset get_literal
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 64
+  mov [r11], r10
+.loc 1 1098 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 28
+  mov [r11], r10d
+.loc 1 1099 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 48
+  mov [r11], r10b
+.loc 1 1100 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 49
+  mov [r11], r10b
+.L.return.get_token_fields:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl pch_get_token
+pch_get_token:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 1104 14
+.loc 1 1105 31
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-41]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_ref
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1106 3
+  lea r10, [rbp-41]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.pch_get_token.1
+.loc 1 1107 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.pch_get_token
+.L.end.pch_get_token.1:
+.loc 1 1109 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 72
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 1110 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_obj
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1111 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_token_fields
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1112 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.pch_get_token
+.L.return.pch_get_token:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl pch_get_tokens
+pch_get_tokens:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 128
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 1116 18
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-128]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-128]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-128]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-128]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-128]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-128]
+  mov r12, 28
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-128]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-128]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 48
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 49
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 50
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-128]
+  mov r12, 51
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-128]
+  mov r12, 56
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-128]
+  mov r12, 64
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1117 21
+  lea r10, [rbp-128]
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1119 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.pch_get_tokens.1:
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.break.pch_get_tokens.1
+.loc 1 1120 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 72
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+  lea r11, [rbp-56]
+  mov [r11], r10
+.loc 1 1121 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_token_fields
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.pch_get_tokens.1:
+.loc 1 1119 40
+  lea r10, [rbp-48]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  jmp .L.begin.pch_get_tokens.1
+.L.break.pch_get_tokens.1:
+.loc 1 1123 3
+  lea r10, [rbp-128]
+  add r10, 8
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.pch_get_tokens
+.L.return.pch_get_tokens:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+get_member:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 1127 14
+.loc 1 1128 32
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-41]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_ref
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1129 3
+  lea r10, [rbp-41]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.get_member.1
+.loc 1 1130 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.get_member
+.L.end.get_member.1:
+.loc 1 1132 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 5
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 40
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 1133 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_obj
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1134 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset get_member
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 1135 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_type
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 1136 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_token
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 1137 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_token
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10
+.loc 1 1138 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10d
+.loc 1 1139 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 36
+  mov [r11], r10d
+.loc 1 1140 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.get_member
+.L.return.get_member:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl pch_get_type
+pch_get_type:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 1144 14
+.loc 1 1145 29
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-41]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_ref
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1146 3
+  lea r10, [rbp-41]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.pch_get_type.1
+.loc 1 1147 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.pch_get_type
+.L.end.pch_get_type.1:
+.loc 1 1149 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 88
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 1150 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_obj
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1151 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10d
+.loc 1 1152 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 4
+  mov [r11], r10d
+.loc 1 1153 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10d
+.loc 1 1154 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 12
+  mov [r11], r10b
+.loc 1 1155 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 13
+  mov [r11], r10b
+.loc 1 1156 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 14
+  mov [r11], r10b
+.loc 1 1157 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_type
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 1158 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_token
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10
+.loc 1 1159 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_token
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+.loc 1 1160 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10d
+.loc 1 1161 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset get_member
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 48
+  mov [r11], r10
+.loc 1 1162 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_type
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 56
+  mov [r11], r10
+.loc 1 1163 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_type
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 64
+  mov [r11], r10
+.loc 1 1164 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 72
+  mov [r11], r10b
+.loc 1 1165 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_type
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 80
+  mov [r11], r10
+.loc 1 1166 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.pch_get_type
+.L.return.pch_get_type:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl pch_get_var
+pch_get_var:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 1170 14
+.loc 1 1171 29
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-41]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_ref
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1172 3
+  lea r10, [rbp-41]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.pch_get_var.1
+.loc 1 1173 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.pch_get_var
+.L.end.pch_get_var.1:
+.loc 1 1175 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 80
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 1176 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_obj
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1177 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_str
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 1178 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_type
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 1179 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_token
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10
+.loc 1 1180 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 36
+  mov [r11], r10d
+.loc 1 1181 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10b
+.loc 1 1182 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.pch_get_var
+.L.return.pch_get_var:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl read_pch
+read_pch:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 368
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-360], rdi
+.loc 1 1187 3
+  lea r10, [rbp-360]
+  mov r10, [r10]
+  mov r11, offset in_path
+  mov [r11], r10
+.loc 1 1188 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-360]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset read_file_string
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r11, offset in
+  mov [r11], r10
+.loc 1 1189 3
+  mov r10, offset in
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.read_pch.1
+.loc 1 1190 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.6
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-360]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset __errno_location
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset strerror
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.read_pch.1:
+.loc 1 1191 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_magic
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strlen
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movabs r11, 8
+  mov r12, 4
+  movsx r12, r12d
+  imul r11, r12
+  add r10, r11
+  mov r11, offset in_len
+  mov [r11], r10
+.loc 1 1194 17
+.loc 1 1195 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-360]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-352]
+  push r10
+  sub rsp, 8
+  mov r10, offset stat
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1196 3
+  lea r10, [rbp-352]
+  add r10, 48
+  mov r10, [r10]
+  mov r11, offset in_len
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  jne .L.true.read_pch.3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset in
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_magic
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_magic
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strlen
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset memcmp
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  jne .L.true.read_pch.3
+  mov r10, 0
+  jmp .L.end.read_pch.3
+.L.true.read_pch.3:
+  mov r10, 1
+.L.end.read_pch.3:
+  cmp r10, 0
+  je .L.end.read_pch.2
+.loc 1 1197 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.7
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-360]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.read_pch.2:
+.loc 1 1198 3
+  lea r10, [rbp-352]
+  add r10, 48
+  mov r10, [r10]
+  mov r11, offset in_len
+  mov [r11], r10
+.loc 1 1199 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_magic
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strlen
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r11, offset in_pos
+  mov [r11], r10
+.loc 1 1203 32
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-208]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1204 23
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-200]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-200]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-200]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-200]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-200]
+  mov r12, 28
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-200]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-200]
+  mov r12, 36
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-200]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-200]
+  mov r12, 48
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-200]
+  mov r12, 56
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-200]
+  mov r12, 64
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-200]
+  mov r12, 72
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-200]
+  mov r12, 80
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-200]
+  mov r12, 88
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-200]
+  mov r12, 96
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-200]
+  mov r12, 104
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-200]
+  mov r12, 112
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-200]
+  mov r12, 120
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-200]
+  mov r12, 128
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-200]
+  mov r12, 136
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1205 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.8
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-200]
+  push r10
+  sub rsp, 8
+  mov r10, offset stat
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1206 3
+.loc 1 1207 44
+.loc 1 1206 63
+  lea r10, [rbp-208]
+  mov r10, [r10]
+  mov r11, 7
+  movsx r11, r11d
+  cmp r10, r11
+  setne al
+  movzb r10, al
+  cmp r10, 0
+  jne .L.true.read_pch.7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-200]
+  add r11, 48
+  mov r11, [r11]
+  cmp r10, r11
+  setne al
+  movzb r10, al
+  cmp r10, 0
+  jne .L.true.read_pch.7
+  mov r10, 0
+  jmp .L.end.read_pch.7
+.L.true.read_pch.7:
+  mov r10, 1
+.L.end.read_pch.7:
+  cmp r10, 0
+  jne .L.true.read_pch.6
+.loc 1 1207 22
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-200]
+  add r11, 88
+  add r11, 0
+  mov r11, [r11]
+  cmp r10, r11
+  setne al
+  movzb r10, al
+  cmp r10, 0
+  jne .L.true.read_pch.6
+  mov r10, 0
+  jmp .L.end.read_pch.6
+.L.true.read_pch.6:
+  mov r10, 1
+.L.end.read_pch.6:
+  cmp r10, 0
+  jne .L.true.read_pch.5
+.loc 1 1208 22
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-200]
+  add r11, 88
+  add r11, 8
+  mov r11, [r11]
+  cmp r10, r11
+  setne al
+  movzb r10, al
+  cmp r10, 0
+  jne .L.true.read_pch.5
+  mov r10, 0
+  jmp .L.end.read_pch.5
+.L.true.read_pch.5:
+  mov r10, 1
+.L.end.read_pch.5:
+  cmp r10, 0
+  je .L.end.read_pch.4
+.loc 1 1209 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.9
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-360]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.read_pch.4:
+.loc 1 1211 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset builtin_types
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.read_pch.8:
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.read_pch.8
+.loc 1 1212 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_obj
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.read_pch.8:
+.loc 1 1211 42
+  lea r10, [rbp-56]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  jmp .L.begin.read_pch.8
+.L.break.read_pch.8:
+.loc 1 1215 34
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset load_file_ids
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1216 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.read_pch.9
+.loc 1 1217 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.10
+  push r10
+  sub rsp, 8
+.loc 1 1218 11
+  lea r10, [rbp-360]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+.loc 1 1217 5
+  mov r10, offset error
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.read_pch.9:
+.loc 1 1220 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset load_macros
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1221 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset load_scopes
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.read_pch:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
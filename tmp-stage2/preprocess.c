@@ -0,0 +1,2182 @@
+typedef struct FILE FILE;
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+typedef struct {
+  int gp_offset;
+  int fp_offset;
+  void *overflow_arg_area;
+  void *reg_save_area;
+} va_list[1];
+
+struct timespec {
+  long tv_sec;
+  long tv_nsec;
+};
+
+struct rusage {
+  long ru_utime[2];
+  long ru_stime[2];
+  long ru_maxrss;
+  long ru_reserved[13];
+};
+
+struct stat {
+  unsigned long st_dev;
+  unsigned long st_ino;
+  unsigned long st_nlink;
+  unsigned int st_mode;
+  unsigned int st_uid;
+  unsigned int st_gid;
+  int __pad0;
+  unsigned long st_rdev;
+  long st_size;
+  long st_blksize;
+  long st_blocks;
+  struct timespec st_atim;
+  struct timespec st_mtim;
+  struct timespec st_ctim;
+  long __reserved[3];
+};
+
+struct sockaddr_un {
+  unsigned short sun_family;
+  char sun_path[108];
+};
+
+struct iovec {
+  void *iov_base;
+  long iov_len;
+};
+
+struct msghdr {
+  void *msg_name;
+  int msg_namelen;
+  struct iovec *msg_iov;
+  long msg_iovlen;
+  void *msg_control;
+  long msg_controllen;
+  int msg_flags;
+};
+
+struct pollfd {
+  int fd;
+  short events;
+  short revents;
+};
+
+typedef struct DIR DIR;
+
+struct dirent {
+  unsigned long d_ino;
+  long d_off;
+  unsigned short d_reclen;
+  unsigned char d_type;
+  char d_name[256];
+};
+
+enum { EINTR = 4 };
+enum { O_RDONLY = 0, O_WRONLY = 1, O_RDWR = 2, O_CREAT = 64, O_TRUNC = 512 };
+enum { LOCK_EX = 2 };
+enum { S_IFMT = 61440, S_IFREG = 32768 };
+enum { PROT_READ = 1, PROT_WRITE = 2 };
+enum { MAP_PRIVATE = 2, MAP_FIXED = 16, MAP_ANONYMOUS = 32, MAP_POPULATE = 32768 };
+enum { _SC_PAGESIZE = 30 };
+enum { AF_UNIX = 1, SOCK_STREAM = 1, SOL_SOCKET = 1, SCM_RIGHTS = 1 };
+enum { MSG_CTRUNC = 8, MSG_NOSIGNAL = 16384 };
+enum { POLLIN = 1 };
+enum { RUSAGE_SELF = 0 };
+enum { CLOCK_MONOTONIC = 1, CLOCK_PROCESS_CPUTIME_ID = 2 };
+
+void *malloc(long size);
+void *calloc(long nmemb, long size);
+void *realloc(void *buf, long size);
+int *__errno_location();
+char *strerror(int errnum);
+FILE *fopen(char *pathname, char *mode);
+long fread(void *ptr, long size, long nmemb, FILE *stream);
+int fclose(FILE *fp);
+int feof(FILE *stream);
+static void assert() {}
+int strcmp(char *s1, char *s2);
+int strncasecmp(char *s1, char *s2);
+int printf(char *fmt, ...);
+int sprintf(char *buf, char *fmt, ...);
+int fprintf(FILE *fp, char *fmt, ...);
+int vfprintf(FILE *fp, char *fmt, va_list ap);
+long strlen(char *p);
+int strncmp(char *p, char *q);
+void *memvpy(char *dst, char *src, long n);
+char *strndup(char *p, long n);
+int isspace(int c);
+int ispunct(int c);
+int isdigit(int c);
+char *strstr(char *haystack, char *needle);
+static void va_end(va_list ap) {}
+long strtoul(char *nptr, char **endptr, int base);
+char *strncpy(char *dest, char *src, long n);
+void exit(int code);
+int atoi(char *nptr);
+char *strrchr(char *s, int c);
+int fflush(FILE *stream);
+int fork(void);
+int waitpid(int pid, int *status, int options);
+int unlink(char *pathname);
+int creat(char *pathname, int mode);
+void *memset(void *s, int c, long n);
+int memcmp(void *s1, void *s2, long n);
+char *strchr(char *s, int c);
+long strtol(char *nptr, char **endptr, int base);
+long write(int fd, void *buf, long count);
+void *memcpy(void *dst, void *src, long n);
+int clock_gettime(int clockid, struct timespec *tp);
+int getrusage(int who, struct rusage *usage);
+void free(void *ptr);
+char *strcpy(char *dest, char *src);
+long read(int fd, void *buf, long count);
+int close(int fd);
+int dup2(int oldfd, int newfd);
+int pipe(int *pipefd);
+int chdir(char *path);
+char *getcwd(char *buf, long size);
+char *realpath(char *path, char *resolved_path);
+int stat(char *path, struct stat *buf);
+int socket(int domain, int type, int protocol);
+int bind(int fd, struct sockaddr *addr, int len);
+int listen(int fd, int backlog);
+int accept(int fd, struct sockaddr *addr, int *len);
+int connect(int fd, struct sockaddr *addr, int len);
+long send(int fd, void *buf, long len, int flags);
+long sendmsg(int fd, struct msghdr *msg, int flags);
+long recvmsg(int fd, struct msghdr *msg, int flags);
+int poll(struct pollfd *fds, long nfds, int timeout);
+int open(char *path, int flags, ...);
+int fstat(int fd, struct stat *buf);
+int flock(int fd, int op);
+void *mmap(void *addr, long len, int prot, int flags, int fd, long off);
+int munmap(void *addr, long len);
+long sysconf(int name);
+long pread(int fd, void *buf, long count, long offset);
+long pwrite(int fd, void *buf, long count, long offset);
+int ftruncate(int fd, long length);
+int getpid(void);
+int rename(char *oldpath, char *newpath);
+int mkdir(char *path, int mode);
+int utime(char *path, void *times);
+DIR *opendir(char *name);
+struct dirent *readdir(DIR *dirp);
+int closedir(DIR *dirp);
+
+typedef struct Type Type;
+typedef struct Member Member;
+typedef struct GvarInitializer GvarInitializer;
+
+//
+// tokenize.c
+//
+
+// Token
+typedef enum {
+  TK_RESERVED, // Keyworeds or punctuators
+  TK_IDENT,    // Identifiers
+  TK_STR,      // String literals
+  TK_NUM,      // Integer literals
+  TK_EOF,      // End-of-file markers
+} TokenKind;
+
+// Keywords, preprocessor directive names and punctuators are given
+// an ID by the tokenizer, so that they can be compared as integers.
+// The order must match `token_names` in tokenize.c.
+typedef enum {
+  ID_NONE,
+
+  // Keywords
+  KW_RETURN, KW_IF, KW_ELSE, KW_FOR, KW_WHILE, KW_INT, KW_SIZEOF,
+  KW_CHAR, KW_STRUCT, KW_UNION, KW_SHORT, KW_LONG, KW_VOID,
+  KW_TYPEDEF, KW_BOOL, KW_ENUM, KW_STATIC, KW_BREAK, KW_CONTINUE,
+  KW_GOTO, KW_SWITCH, KW_CASE, KW_DEFAULT, KW_EXTERN, KW_ALIGNOF,
+  KW_ALIGNAS, KW_DO, KW_SIGNED, KW_UNSIGNED, KW_CONST, KW_VOLATILE,
+
+  // Preprocessor directive names other than keywords
+  PP_INCLUDE, PP_DEFINE, PP_UNDEF, PP_IFDEF, PP_IFNDEF, PP_ELIF,
+  PP_ENDIF, PP_PRAGMA, PP_DEFINED, PP_ONCE,
+
+  // Punctuators, longest first
+  P_ELLIPSIS, P_SHL_ASSIGN, P_SHR_ASSIGN,
+  P_EQ, P_NE, P_LE, P_GE, P_ARROW, P_ADD_ASSIGN, P_SUB_ASSIGN,
+  P_MUL_ASSIGN, P_DIV_ASSIGN, P_INC, P_DEC, P_MOD_ASSIGN,
+  P_AND_ASSIGN, P_OR_ASSIGN, P_XOR_ASSIGN, P_LOGAND, P_LOGOR, P_SHL,
+  P_SHR, P_HASHHASH,
+  P_LPAREN, P_RPAREN, P_LBRACE, P_RBRACE, P_LBRACKET, P_RBRACKET,
+  P_SEMICOLON, P_COMMA, P_DOT, P_ASSIGN, P_LT, P_GT, P_PLUS, P_MINUS,
+  P_STAR, P_SLASH, P_PERCENT, P_AMP, P_PIPE, P_CARET, P_TILDE, P_NOT,
+  P_QUESTION, P_COLON, P_HASH,
+
+  NR_TOKEN_IDS,
+} TokenId;
+
+// Set of macro names, represented as a Patricia tree keyed by
+// name_id(). There is only one Hideset object for each set, so equal
+// sets are the same pointer. A Hideset must not be modified.
+typedef struct Hideset Hideset;
+struct Hideset {
+  Hideset *left;       // 0 if leaf
+  Hideset *right;
+  long prefix;         // Bits below `bit` shared by all names, or leaf's ID
+  long bit;            // The bit that tells which child has a name
+  char *name;          // If leaf, the name
+  unsigned long bloom; // One bit for each name, for quick rejection
+};
+
+// Source file of tokens. Tokens read from the same input share one.
+typedef struct {
+  char *name;     // Input filename
+  char *contents; // Entire input string
+  int file_no;    // File number for .loc directive
+
+  // Offsets of the beginnings of lines, recorded as the file is
+  // tokenized
+  int *lines;
+  int nr_lines;
+  int lines_cap;
+} File;
+
+// Payload of a literal token
+typedef struct {
+  long val;       // If TK_NUM, its value
+  Type *ty;       // If TK_NUM, its type
+  char *contents; // If TK_STR, its contents, not null-terminated
+  int cont_len;   // If TK_STR, its length excluding terminating '\0'
+} Literal;
+
+// Token type
+//
+// Fields the preprocessor and the parser look at for every token
+// come first. Those used only for some tokens or only for error
+// messages and debug info are kept out of line.
+typedef struct Token Token;
+struct Token {
+  TokenKind kind;   // Token kind
+  TokenId id;       // Keyword or punctuator ID, or ID_NONE
+  Token *next;      // Next token
+  char *loc;        // Token location
+  int len;          // Token length
+  int lineno;       // Line number
+  char *name;       // If identifier or keyword, its interned spelling
+  Hideset *hideset; // For macro expension
+  _Bool at_bol;      // True if this token is at beginning of line
+  _Bool has_space;   // True if this token follows a space character
+  _Bool is_raw;      // True if this token is read from a file
+  _Bool is_shared;   // True if this token is in a file's cached tokens
+
+  File *file;       // Source file
+  Literal *lit;     // If TK_NUM or TK_STR, its value
+};
+
+extern _Bool fast_lexer;
+
+void error(char *fmt, ...);
+void error_tok(Token *tok, char *fmt, ...);
+void warn_tok(Token *tok, char *fmt, ...);
+Token *skip(Token *tok, TokenId id);
+_Bool consume(Token **rest, Token *tok, TokenId id);
+char *intern(char *s, int len);
+long name_id(char *name);
+File *new_file(char *name, int file_no, char *contents);
+int get_column(Token *tok);
+void convert_keywords(Token *tok);
+Token *next_token(Token *tok);
+void free_token(Token *tok);
+Token *tokenize_lazy(char *filename, int file_no, char *p, Token *cont);
+Token *tokenize_cached(Token *src, char *filename, int file_no,
+                       Token *cont);
+Token *tokenize(char *filename, int file_no, char *p);
+
+//
+// preprocess.c
+//
+
+extern _Bool pp_report;
+
+// Identifies a file and its version.
+typedef struct {
+  unsigned long dev;
+  unsigned long ino;
+  long size;
+  long mtime_sec;
+  long mtime_nsec;
+} FileId;
+
+_Bool get_file_id(char *path, FileId *id);
+char *read_file_string(char *path, long *mapping);
+void free_file_string(char *buf, long mapping);
+int add_file(char *path);
+void save_file_ids(void);
+char *load_file_ids(void);
+void save_macros(void);
+void load_macros(void);
+Token *read_file(char *path);
+void print_pp_report(char *input);
+
+//
+// parse.c
+//
+
+// Variable
+typedef struct Var Var;
+struct Var {
+  Var *next;
+  char *name;    // Variable name
+  Type *ty;      // Type
+  Token *tok;    // representative token
+  _Bool is_local; // local or global
+  int align;     // alignment
+
+  _Bool is_static;
+  GvarInitializer *initializer;
+
+  // Local variable
+  int offset;
+
+  // Gloval variable
+  char *contents;
+  int cont_len;
+};
+
+// AST node
+typedef enum {
+  ND_ADD,       // +
+  ND_SUB,       // -
+  ND_MUL,       // *
+  ND_DIV,       // /
+  ND_MOD,       // %
+  ND_BITAND,    // &
+  ND_BITOR,     // |
+  ND_BITXOR,    // ^
+  ND_SHL,       // <<
+  ND_SHR,       // >>
+  ND_EQ,        // ==
+  ND_NE,        // !=
+  ND_LT,        // <
+  ND_LE,        // <=
+  ND_ASSIGN,    // =
+  ND_COND,      // ?:
+  ND_COMMA,     // ,
+  ND_MEMBER,    // . (struct member access)
+  ND_ADDR,      // unary &
+  ND_DEREF,     // unary *
+  ND_NOT,       // !
+  ND_BITNOT,    // ~
+  ND_LOGAND,    // &&
+  ND_LOGOR,     // ||
+  ND_RETURN,    // "return"
+  ND_IF,        // "if"
+  ND_FOR,       // "for" or "while"
+  ND_DO,        // "do"
+  ND_SWITCH,    // "switch"
+  ND_CASE,      // "case"
+  ND_BLOCK,     // { ... }
+  ND_BREAK,     // "break"
+  ND_CONTINUE,  // "continue"
+  ND_GOTO,      // "goto"
+  ND_LABEL,     // Labeled statement
+  ND_FUNCALL,   // Function call
+  ND_EXPR_STMT, // Expression statement
+  ND_STMT_EXPR, // Statement expression
+  ND_VAR,       // Variable
+  ND_NUM,       // Integer
+  ND_CAST,      // Type cast
+} NodeKind;
+
+// AST node type
+typedef struct Node Node;
+struct Node {
+  NodeKind kind; // Node kind
+  Node *next;    // Next node
+  Type *ty;      // Type, e.g. int or pointer to tin
+  Token *tok;    // Representative token
+
+  Node *lhs;     // Left-hand side
+  Node *rhs;     // Right-hand side
+
+  // "if" or "for" statement
+  Node *cond;
+  Node *then;
+  Node *els;
+  Node *init;
+  Node *inc;
+
+  // Assignment
+  _Bool is_init;
+
+  // Blcok or statement expression
+  Node *body;
+
+  // Struct member access
+  Member *member;
+
+  // Function call
+  char *funcname;
+  Type *func_ty;
+  Node *args;
+
+  // Goto or labeled statement
+  char *label_name;
+
+  // Switch-cases
+  Node *case_next;
+  Node *default_case;
+  int case_label;
+  int case_end_label;
+
+  // Variable
+  Var *var;
+
+  // Integer literal
+  long val;
+};
+
+// Global variable initializer. Global variables can be initialized
+// either by a constatnt expression or a pointer to another global
+// bariable with an addend.
+struct GvarInitializer {
+  GvarInitializer *next;
+  int offset;
+
+  // Scalar value
+  int sz;
+  long val;
+
+  // Byte string of `sz` bytes
+  char *bytes;
+
+  // Reference to another global variable
+  char *label;
+  long addend;
+};
+
+typedef struct Function Function;
+struct Function {
+  Function *next;
+  char *name;
+  Var *params;
+  _Bool is_static;
+  _Bool is_varargs;
+
+  Node *node;
+  Var *locals;
+  int stack_size;
+  long nr_nodes; // The number of AST nodes, as an estimate of work
+};
+
+typedef struct {
+  Var *globals;
+  Function *fns;
+} Program;
+
+Node *new_cast(Node *expr, Type *ty);
+long const_expr(Token **rest, Token *tok);
+void save_scopes(void);
+void load_scopes(void);
+Program *parse(Token *tok);
+
+//
+// type.c
+//
+
+typedef enum {
+  TY_VOID,
+  TY_BOOL,
+  TY_CHAR,
+  TY_SHORT,
+  TY_INT,
+  TY_LONG,
+  TY_ENUM,
+  TY_PTR,
+  TY_FUNC,
+  TY_ARRAY,
+  TY_STRUCT,
+} TypeKind;
+
+struct Type {
+  TypeKind kind;
+  int size;           // sizeof() value
+  int align;          // alignment
+  _Bool is_unsigned;   // unsigned or signed
+  _Bool is_incomplete; // incomplete type
+  _Bool is_const;
+
+  // Pointer
+  Type *base;
+
+  // Declaration
+  Token *name;
+  Token *name_pos;
+
+  // Array
+  int array_len;
+
+  // Struct
+  Member *members;
+
+  // Function type
+  Type *return_ty;
+  Type *params;
+  _Bool is_varargs;
+  Type *next;
+};
+
+// Struct member
+struct Member {
+  Member *next;
+  Type *ty;
+  Token *tok; // for error message
+  Token *name;
+  int align;
+  int offset;
+};
+
+extern Type *ty_void;
+extern Type *ty_bool;
+
+extern Type *ty_char;
+extern Type *ty_short;
+extern Type *ty_int;
+extern Type *ty_long;
+
+extern Type *ty_uchar;
+extern Type *ty_ushort;
+extern Type *ty_uint;
+extern Type *ty_ulong;
+
+_Bool is_integer(Type *ty);
+Type *copy_type(Type *ty);
+Type *pointer_to(Type *base);
+int align_to(int n, int align);
+Type *func_type(Type *return_ty);
+Type *array_of(Type *base, int size);
+Type *enum_type(void);
+Type *struct_type(void);
+int size_of(Type *ty);
+Type *copy_type(Type *ty);
+void add_type(Node *node);
+
+//
+// codegen.c
+//
+
+extern int codegen_jobs;
+
+void codegen(Program *prog);
+
+//
+// emit.c
+//
+
+void open_output(char *path);
+void flush_output(void);
+void write_output(char *p, long len);
+void capture_output(void);
+char *take_output(void);
+void emitf(char *fmt, ...);
+void println(char *fmt, ...);
+long output_size(void);
+char *output_since(long pos);
+
+//
+// assemble.c
+//
+
+void assemble(char *input, char *path);
+
+//
+// timer.c
+//
+
+typedef enum {
+  PH_READ,       // read_file_string
+  PH_TOKENIZE,   // tokenize
+  PH_PREPROCESS, // preprocess
+  PH_KEYWORDS,   // convert_keywords
+  PH_PARSE,      // parse
+  PH_LAYOUT,     // stack offset assignment
+  PH_EMIT_DATA,  // emit_data
+  PH_EMIT_TEXT,  // emit_text
+  PH_ASSEMBLE,   // assemble
+  NR_PHASES,
+} Phase;
+
+extern _Bool time_report;
+extern _Bool time_report_json;
+
+void timer_start(Phase ph);
+void timer_stop(void);
+void timer_count(Phase ph, long n);
+void timer_count_lines(long n);
+void reset_timer(void);
+Phase current_phase(void);
+char *phase_name(Phase ph);
+void print_time_report(char *input);
+
+//
+// alloc.c
+//
+
+typedef enum {
+  AK_TOKEN,       // Token
+  AK_HIDESET,     // Hideset
+  AK_MACRO,       // Macro, MacroParam, MacroArg and CondIncl
+  AK_NODE,        // Node
+  AK_TYPE,        // Type
+  AK_MEMBER,      // Member
+  AK_VAR,         // Var
+  AK_VAR_SCOPE,   // VarScope
+  AK_TAG_SCOPE,   // TagScope
+  AK_FUNCTION,    // Function and Program
+  AK_INITIALIZER, // Initializer
+  AK_GVAR_INIT,   // GvarInitializer
+  AK_STRING,      // Names, labels and string literals
+  AK_FILE,        // Source file contents
+  NR_ALLOC_KINDS,
+} AllocKind;
+
+typedef struct Arena Arena;
+
+extern _Bool mem_report;
+
+void reset_alloc_stats(void);
+void count_alloc(AllocKind kind, long size);
+void *alloc_obj(AllocKind kind, long size);
+char *alloc_str(char *s, long len);
+void free_arena(void);
+Arena *enter_arena(void);
+void leave_arena(Arena *arena);
+void release_arena(Arena *arena);
+void print_mem_report(char *input);
+
+//
+// server.c
+//
+
+Token *find_cached_file(char *path);
+void note_input_file(char *path);
+char *read_all(int fd);
+void run_server(char *path, int *argc, char ***argv);
+int run_client(char *path, int argc, char **argv);
+
+//
+// pch.c
+//
+
+void pch_put_long(long val);
+void pch_put_str(char *s);
+void pch_put_token(Token *tok);
+void pch_put_tokens(Token *tok);
+void pch_put_type(Type *ty);
+void pch_put_var(Var *var);
+void write_pch(char *path);
+
+long pch_get_long(void);
+char *pch_get_str(void);
+char *pch_get_name(void);
+Token *pch_get_token(void);
+Token *pch_get_tokens(void);
+Type *pch_get_type(void);
+Var *pch_get_var(void);
+void read_pch(char *path);
+
+//
+// cache.c
+//
+
+extern char *cache_dir;
+extern long cache_max_size;
+extern _Bool cache_stats;
+
+char *cache_key(Token *tok, char *hdr, long hdr_len);
+_Bool cache_lookup(char *key);
+void cache_store(char *key, char *p, long len);
+void print_cache_stats(void);
+
+//
+// hashmap.c
+//
+
+typedef struct {
+  char *key;
+  int keylen;
+  void *val;
+} HashEntry;
+
+typedef struct {
+  HashEntry *buckets;
+  int capacity;
+  int used;
+
+  // Statistics
+  long lookups;
+  long probes;
+} HashMap;
+
+void *hashmap_get(HashMap *map, char *key);
+void *hashmap_get2(HashMap *map, char *key, int keylen);
+void hashmap_put(HashMap *map, char *key, void *val);
+void hashmap_put2(HashMap *map, char *key, int keylen, void *val);
+void hashmap_delete(HashMap *map, char *key);
+void hashmap_delete2(HashMap *map, char *key, int keylen);
+
+//
+// main.c
+//
+
+extern _Bool preprocess_only;
+extern _Bool output_object;
+extern char *include_pch;
+// This file implements the C preprocessor.
+//
+// The preprocessor takes a list of tokens as an input and returns a
+// new list of tokens as an output.
+//
+// The preprocessing language is designed in such a way that that's
+// guaranteed to stop even if there is a recursive macro.
+// Informally speaking, a macro is applied only once for each token.
+// That is, if a macro token T appears in a result of direct or
+// indirect macro expansion of T, T won't be expaneded any further.
+// If T is defined as U, and U is defined as T, then token T is
+// expanded to U and then to T and the macro expansion stops at that
+// point.
+//
+// To achieve the above behavior, we attach for each token a set of
+// macro names from which the token is expanded. The set is called
+// "hideset". Hideset is initially empty, and every time we expand a
+// macro, the macro name is added to the resulting tokens' hidesets.
+//
+// The above macro expansion algorithm is explained in this document,
+// which is used as a basis for the standard's wordking:
+// https://github.com/rui314/chibicc/wiki/cpp.algo.pdf
+
+
+typedef struct MacroParam MacroParam;
+struct MacroParam {
+  MacroParam *next;
+  char *name;
+};
+
+typedef struct MacroArg MacroArg;
+struct MacroArg {
+  MacroArg *next;
+  char *name;
+  Token *tok; // The first token of the argument
+  Token *end; // The token following the argument
+};
+
+typedef struct Macro Macro;
+struct Macro {
+  char *name;
+  _Bool is_objlike; // Object-like or function-like
+  MacroParam *params;
+  Token *body;
+  Hideset *hideset; // The hideset containing just this macro
+};
+
+// A macro expansion in progress. The resulting tokens are produced
+// on demand by next(), just like tokens of a lazily tokenized file,
+// so that neither the macro body nor the arguments are copied in
+// advance. A token is copied only once, when it is produced with
+// the new hideset.
+typedef struct Expansion Expansion;
+struct Expansion {
+  Expansion *next;
+  Macro *macro;
+  MacroArg *args;
+  Hideset *hideset; // The hideset added to the resulting tokens
+  Token *body;      // The next token of the macro body
+  Token *arg;       // If not 0, the next token of an argument
+  Token *arg_end;   // The token following the argument
+  Token *last;      // The last token produced so far
+  Token *cont;      // The token following the macro invocation
+
+  // Adjacent tokens usually have the same hideset, so we reuse the
+  // last result of hideset_union().
+  Hideset *last_hs;
+  Hideset *result_hs;
+};
+
+// What we know about a file that has been included. Different paths
+// to the same file share a FileInfo.
+typedef struct FileInfo FileInfo;
+struct FileInfo {
+  FileId id;
+  _Bool pragma_once; // The file contains "#pragma once"
+  char *guard;      // The file's include guard macro
+  char *contents;   // The file's contents once it has been read
+
+  // The tokens of an included file are kept and shared by all
+  // includes of the file. While an include is in progress, `cont`
+  // is the token following it, and the FileInfo is in `includes`.
+  Token *tokens;
+  Token *eof;
+  Token *cont;
+  FileInfo *next_include;
+};
+
+// A memoized result of a hideset operation
+typedef enum { HS_UNION, HS_INTERSECTION } HidesetOpKind;
+
+typedef struct {
+  long op;
+  Hideset *hs1;
+  Hideset *hs2;
+  Hideset *result;
+  _Bool done;
+} HidesetOp;
+
+// `#if` can be nested, so we use a stack to manane nested `#if`s.
+typedef struct CondIncl CondIncl;
+struct CondIncl {
+  CondIncl *next;
+  enum { IN_THEN, IN_ELSE, IN_ELIF } ctx;
+  Token *tok;
+  _Bool included;
+
+  // If this is an #ifndef at the beginning of an included file, the
+  // macro name, the file and the token following the file. If the
+  // matching #endif turns out to end the file, the macro is the
+  // file's include guard.
+  char *guard;
+  FileInfo *guard_file;
+  Token *guard_end;
+};
+
+_Bool pp_report;
+
+static int file_no;
+
+// Maps macro names to Macros. Since an identifier token has the
+// same length as its name, find_macro() doesn't need strlen().
+static HashMap macros;
+static CondIncl *cond_incl;
+
+// Macro expansions that have not reached the end, and recycled ones
+static Expansion *expansions;
+static Expansion *free_expansions;
+
+// Map FileIds and paths to FileInfos.
+static HashMap file_ids;
+static HashMap file_paths;
+
+static int nr_include_guards;
+static int nr_pragma_once;
+static long nr_skipped_includes;
+static int nr_token_cache_files;
+static long nr_token_cache_hits;
+
+// Files whose shared tokens are being included, innermost first
+static FileInfo *includes;
+
+// Interned Hidesets, and memoized HidesetOps
+static HashMap hidesets;
+static HashMap hideset_ops;
+static long nr_hidesets;
+static long nr_hideset_ops;
+static long nr_hideset_op_hits;
+
+// The first token of the file that has just been included, if the
+// file starts with "#ifndef".
+static Token *guard_start;
+static FileInfo *guard_file;
+static Token *guard_end;
+
+static Token *read_file2(char *path);
+static Macro *find_macro(Token *tok);
+static Token *preprocess(Token *tok);
+static Token *next(Token *tok);
+
+// Maps a regular file to memory. The mapping is followed by at least
+// two zero bytes so that the result can be used just like a string
+// returned by read_stream().
+static char *map_file(int fd, long size, long *mapping) {
+  long page = sysconf(_SC_PAGESIZE);
+  long len = (size + 2 + page - 1) / page * page;
+
+  // Reserve zero-filled memory first, and then map the file over
+  // it, so that the bytes after the end of the file are accessible.
+  // (Touching a page entirely past EOF of a file mapping raises
+  // SIGBUS.)
+  char *buf = mmap(0, len, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (buf == ((void *)-1))
+    return 0;
+
+  if (mmap(buf, size, PROT_READ | PROT_WRITE,
+           MAP_PRIVATE | MAP_FIXED | MAP_POPULATE, fd, 0) == ((void *)-1)) {
+    munmap(buf, len);
+    return 0;
+  }
+
+  count_alloc(AK_FILE, len);
+  *mapping = len;
+  return buf;
+}
+
+// Reads everything from a non-seekable file such as a pipe.
+static char *read_stream(int fd, long *len) {
+  int buflen = 4096;
+  int nread = 0;
+  char *buf = malloc(buflen);
+
+  for (;;) {
+    int end = buflen - 2; // extra 2 bytes for the trailing "\n\0"
+    int n = read(fd, buf + nread, end - nread);
+    if (n < 0 && *__errno_location() == EINTR)
+      continue;
+    if (n <= 0)
+      break;
+    nread += n;
+    if (nread == end) {
+      buflen *= 2;
+      buf = realloc(buf, buflen);
+    }
+  }
+
+  buf[nread] = '\0';
+  count_alloc(AK_FILE, buflen);
+  *len = nread;
+  return buf;
+}
+
+// Gets the identity of a given file. Returns 0 if the file
+// cannot be stat'ed.
+_Bool get_file_id(char *path, FileId *id) {
+  struct stat st;
+  if (stat(path, &st))
+    return 0;
+
+  memset(id, 0, sizeof(FileId));
+  id->dev = st.st_dev;
+  id->ino = st.st_ino;
+  id->size = st.st_size;
+  id->mtime_sec = st.st_mtim.tv_sec;
+  id->mtime_nsec = st.st_mtim.tv_nsec;
+  return 1;
+}
+
+// Returns the FileInfo of a given file, or 0 if the file cannot
+// be stat'ed. Each path is stat'ed only once.
+static FileInfo *get_file_info(char *path) {
+  FileInfo *fi = hashmap_get(&file_paths, path);
+  if (fi)
+    return fi;
+
+  FileId id;
+  if (!strcmp(path, "-") || !get_file_id(path, &id))
+    return 0;
+
+  fi = hashmap_get2(&file_ids, (char *)&id, sizeof(id));
+  if (!fi) {
+    fi = alloc_obj(AK_FILE, sizeof(FileInfo));
+    fi->id = id;
+    hashmap_put2(&file_ids, (char *)&fi->id, sizeof(FileId), fi);
+  }
+  hashmap_put(&file_paths, path, fi);
+  return fi;
+}
+
+// Returns the contents of a given file. If `mapping` is not 0,
+// it's set to the size of the memory mapping that holds the contents,
+// or to 0 if they were read into memory from malloc().
+char *read_file_string(char *path, long *mapping) {
+  // By convention, read from stdin if a given filename is "-".
+  int fd = 0;
+  if (strcmp(path, "-")) {
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+      return 0;
+  }
+
+  timer_start(PH_READ);
+
+  // Regular files are mapped to memory rather than copied.
+  struct stat st;
+  char *buf = 0;
+  long len = 0;
+  long mapped = 0;
+  if (fd != 0 && !fstat(fd, &st) && (st.st_mode & S_IFMT) == S_IFREG &&
+      st.st_size > 0) {
+    len = st.st_size;
+    buf = map_file(fd, len, &mapped);
+  }
+  if (!buf)
+    buf = read_stream(fd, &len);
+
+  if (fd != 0)
+    close(fd);
+
+  // Canonicalize the last line by appending "\n"
+  // if it does not end with a newline.
+  if (len == 0 || buf[len - 1] != '\n')
+    buf[len++] = '\n';
+  buf[len] = '\0';
+  timer_count(PH_READ, len);
+  timer_stop();
+
+  if (mapping)
+    *mapping = mapped;
+  return buf;
+}
+
+// Releases the contents of a file returned by read_file_string().
+void free_file_string(char *buf, long mapping) {
+  if (mapping)
+    munmap(buf, mapping);
+  else
+    free(buf);
+}
+
+// Assigns a new file number to a given file, and emits a .file
+// directive for the assembler.
+int add_file(char *path) {
+  file_no++;
+  if (!preprocess_only)
+    println(".file %d \"%s\"", file_no, path);
+  return file_no;
+}
+
+// Starts including the shared tokens of a file. The last token
+// is followed by `cont`, which next() takes care of.
+static Token *include_shared(FileInfo *fi, Token *cont) {
+  if (fi->tokens == fi->eof)
+    return cont;
+  fi->cont = cont;
+  fi->next_include = includes;
+  includes = fi;
+  return fi->tokens;
+}
+
+// Reads and tokenizes a given file. The last token of the file is
+// followed by `cont`, or by an EOF token if `cont` is 0. Returns
+// 0 if the file cannot be read.
+//
+// A file is tokenized lazily when it's read for the first time, so
+// that a file read only once doesn't take more memory than that. If
+// it's included again (e.g. an X-macro table), it's tokenized as a
+// whole, and the tokens are kept and shared by that and later
+// includes. The shared tokens are never modified; ones passed on to
+// the output are copied.
+static Token *tokenize_file(char *path, Token *cont) {
+  FileInfo *fi = get_file_info(path);
+  if (fi && fi->tokens) {
+    nr_token_cache_hits++;
+    note_input_file(path);
+
+    // The tokens refer to the file number assigned when the file was
+    // read, so we don't need a new one unless we make a copy. A file
+    // including itself needs a copy, as its last token can't be
+    // followed by two different tokens.
+    if (!fi->cont)
+      return include_shared(fi, cont);
+    add_file(path);
+    return tokenize_cached(fi->tokens, path, file_no, cont);
+  }
+
+  // A file read before is still in memory.
+  Token *cached = find_cached_file(path);
+  char *input = 0;
+  if (!cached) {
+    input = (fi && fi->contents) ? fi->contents : read_file_string(path, 0);
+    if (!input)
+      return 0;
+  }
+
+  note_input_file(path);
+  add_file(path);
+
+  if (!fi || !cont || !fi->contents) {
+    if (fi)
+      fi->contents = cached ? cached->file->contents : input;
+    if (cached)
+      return tokenize_cached(cached, path, file_no, cont);
+    return tokenize_lazy(path, file_no, input, cont);
+  }
+
+  if (cached)
+    fi->tokens = tokenize_cached(cached, path, file_no, 0);
+  else
+    fi->tokens = tokenize(path, file_no, input);
+  nr_token_cache_files++;
+
+  Token *tok = fi->tokens;
+  for (;; tok = next_token(tok)) {
+    tok->is_raw = 0;
+    tok->is_shared = 1;
+    if (tok->kind == TK_EOF)
+      break;
+  }
+  fi->eof = tok;
+  return include_shared(fi, cont);
+}
+
+static _Bool is_hash(Token *tok) {
+  return tok->at_bol && tok->id == P_HASH;
+}
+
+// Some preprocessor directives suc as #include allow extraneous
+// tokens before newline. This function skips such tokens.
+static Token *skip_line(Token *tok) {
+  if (tok->at_bol)
+    return tok;
+  warn_tok(tok, "extra token");
+  while (tok->at_bol)
+    tok = next(tok);
+  return tok;
+}
+
+static Token *copy_token(Token *tok) {
+  Token *t = alloc_obj(AK_TOKEN, sizeof(Token));
+  *t = *tok;
+  t->next = 0;
+  t->is_shared = 0;
+  return t;
+}
+
+static Token *new_eof(Token *tok) {
+  Token *t = copy_token(tok);
+  t->kind = TK_EOF;
+  t->id = ID_NONE;
+  t->len = 0;
+  t->lit = 0;
+  return t;
+}
+
+// Returns a hideset node. Nodes are hash-consed: there is only one
+// node for each combination of children, prefix and bit.
+static Hideset *new_hideset(Hideset *left, Hideset *right, long prefix,
+                            long bit, char *name) {
+  // Hidesets are keyed by their first four members.
+  int keylen = sizeof(Hideset *) * 2 + sizeof(long) * 2;
+  Hideset key = {};
+  key.left = left;
+  key.right = right;
+  key.prefix = prefix;
+  key.bit = bit;
+
+  Hideset *hs = hashmap_get2(&hidesets, (char *)&key, keylen);
+  if (hs)
+    return hs;
+
+  hs = alloc_obj(AK_HIDESET, sizeof(Hideset));
+  *hs = key;
+  if (left) {
+    hs->bloom = left->bloom | right->bloom;
+  } else {
+    hs->name = name;
+    hs->bloom = 1UL << (prefix & 63);
+  }
+  hashmap_put2(&hidesets, (char *)hs, keylen, hs);
+  nr_hidesets++;
+  return hs;
+}
+
+static Hideset *new_leaf(char *name) {
+  return new_hideset(0, 0, name_id(name), 0, name);
+}
+
+static _Bool is_leaf(Hideset *hs) {
+  return !hs->left;
+}
+
+// Returns the bits of `id` below `bit`.
+static long mask_bits(long id, long bit) {
+  return id & (bit - 1);
+}
+
+static _Bool has_prefix(long id, long prefix, long bit) {
+  return mask_bits(id, bit) == prefix;
+}
+
+// Returns a node for the union of two disjoint trees whose prefixes
+// differ.
+static Hideset *join(long p1, Hideset *hs1, long p2, Hideset *hs2) {
+  long x = p1 ^ p2;
+  long bit = x & -x;
+  if (p1 & bit)
+    return new_hideset(hs2, hs1, mask_bits(p1, bit), bit, 0);
+  return new_hideset(hs1, hs2, mask_bits(p1, bit), bit, 0);
+}
+
+// Returns a node with given children, either of which may be empty.
+static Hideset *new_branch(Hideset *left, Hideset *right, long prefix,
+                           long bit) {
+  if (!left)
+    return right;
+  if (!right)
+    return left;
+  return new_hideset(left, right, prefix, bit, 0);
+}
+
+// Looks up a memoized result of `op` applied to `hs1` and `hs2`.
+static HidesetOp *find_hideset_op(HidesetOpKind op, Hideset *hs1,
+                                  Hideset *hs2) {
+  HidesetOp key = {};
+  key.op = op;
+  key.hs1 = hs1;
+  key.hs2 = hs2;
+  int keylen = sizeof(long) + sizeof(Hideset *) * 2;
+  nr_hideset_ops++;
+
+  HidesetOp *ent = hashmap_get2(&hideset_ops, (char *)&key, keylen);
+  if (ent) {
+    nr_hideset_op_hits++;
+    return ent;
+  }
+
+  ent = alloc_obj(AK_HIDESET, sizeof(HidesetOp));
+  *ent = key;
+  hashmap_put2(&hideset_ops, (char *)ent, keylen, ent);
+  return ent;
+}
+
+static _Bool hideset_contains(Hideset *hs, char *name) {
+  if (!hs || !name)
+    return 0;
+
+  long id = name_id(name);
+  if (!(hs->bloom & (1UL << (id & 63))))
+    return 0;
+
+  while (!is_leaf(hs)) {
+    if (!has_prefix(id, hs->prefix, hs->bit))
+      return 0;
+    hs = (id & hs->bit) ? hs->right : hs->left;
+  }
+  return hs->name == name;
+}
+
+static Hideset *hideset_add(Hideset *hs, char *name) {
+  if (!hs)
+    return new_leaf(name);
+
+  long id = name_id(name);
+  if (is_leaf(hs)) {
+    if (hs->name == name)
+      return hs;
+    return join(id, new_leaf(name), hs->prefix, hs);
+  }
+
+  if (!has_prefix(id, hs->prefix, hs->bit))
+    return join(id, new_leaf(name), hs->prefix, hs);
+  if (id & hs->bit)
+    return new_hideset(hs->left, hideset_add(hs->right, name), hs->prefix,
+                       hs->bit, 0);
+  return new_hideset(hideset_add(hs->left, name), hs->right, hs->prefix,
+                     hs->bit, 0);
+}
+
+static Hideset *hideset_union(Hideset *hs1, Hideset *hs2) {
+  if (!hs1 || hs1 == hs2)
+    return hs2;
+  if (!hs2)
+    return hs1;
+
+  HidesetOp *ent = find_hideset_op(HS_UNION, hs1, hs2);
+  if (ent->done)
+    return ent->result;
+
+  long p = hs1->prefix;
+  long m = hs1->bit;
+  long q = hs2->prefix;
+  long n = hs2->bit;
+  Hideset *hs;
+
+  if (is_leaf(hs1))
+    hs = hideset_add(hs2, hs1->name);
+  else if (is_leaf(hs2))
+    hs = hideset_add(hs1, hs2->name);
+  else if (m == n && p == q)
+    hs = new_hideset(hideset_union(hs1->left, hs2->left),
+                     hideset_union(hs1->right, hs2->right), p, m, 0);
+  else if (m < n && has_prefix(q, p, m))
+    hs = (q & m)
+      ? new_hideset(hs1->left, hideset_union(hs1->right, hs2), p, m, 0)
+      : new_hideset(hideset_union(hs1->left, hs2), hs1->right, p, m, 0);
+  else if (n < m && has_prefix(p, q, n))
+    hs = (p & n)
+      ? new_hideset(hs2->left, hideset_union(hs1, hs2->right), q, n, 0)
+      : new_hideset(hideset_union(hs1, hs2->left), hs2->right, q, n, 0);
+  else
+    hs = join(p, hs1, q, hs2);
+
+  ent->result = hs;
+  ent->done = 1;
+  return hs;
+}
+
+static Hideset *hideset_intersection(Hideset *hs1, Hideset *hs2) {
+  if (!hs1 || !hs2 || !(hs1->bloom & hs2->bloom))
+    return 0;
+  if (hs1 == hs2)
+    return hs1;
+  if (is_leaf(hs1))
+    return hideset_contains(hs2, hs1->name) ? hs1 : 0;
+  if (is_leaf(hs2))
+    return hideset_contains(hs1, hs2->name) ? hs2 : 0;
+
+  HidesetOp *ent = find_hideset_op(HS_INTERSECTION, hs1, hs2);
+  if (ent->done)
+    return ent->result;
+
+  long p = hs1->prefix;
+  long m = hs1->bit;
+  long q = hs2->prefix;
+  long n = hs2->bit;
+  Hideset *hs = 0;
+
+  if (m == n && p == q)
+    hs = new_branch(hideset_intersection(hs1->left, hs2->left),
+                    hideset_intersection(hs1->right, hs2->right), p, m);
+  else if (m < n && has_prefix(q, p, m))
+    hs = hideset_intersection((q & m) ? hs1->right : hs1->left, hs2);
+  else if (n < m && has_prefix(p, q, n))
+    hs = hideset_intersection(hs1, (p & n) ? hs2->right : hs2->left);
+
+  ent->result = hs;
+  ent->done = 1;
+  return hs;
+}
+
+// Skips `n` tokens which are no longer needed, and returns the
+// token following them.
+static Token *drop_tokens(Token *tok, int n) {
+  for (; n > 0; n--) {
+    Token *t = next(tok);
+    free_token(tok);
+    tok = t;
+  }
+  return tok;
+}
+
+static Token *skip_cond_incl2(Token *tok) {
+  while (tok->kind != TK_EOF) {
+    if (is_hash(tok) &&
+        (next(tok)->id == KW_IF || next(tok)->id == PP_IFDEF ||
+         next(tok)->id == PP_IFNDEF)) {
+      tok = skip_cond_incl2(drop_tokens(tok, 2));
+      continue;
+    }
+    if (is_hash(tok) && next(tok)->id == PP_ENDIF)
+      return drop_tokens(tok, 2);
+    tok = drop_tokens(tok, 1);
+  }
+  return tok;
+}
+
+// Skip until next `#else`, `#elif`, or `#endif`.
+// Nested `#if` and `#endif` are skipped.
+static Token *skip_cond_incl(Token *tok) {
+  while (tok->kind != TK_EOF) {
+    if (is_hash(tok) &&
+        (next(tok)->id == KW_IF || next(tok)->id == PP_IFDEF ||
+         next(tok)->id == PP_IFNDEF)) {
+      tok = skip_cond_incl2(drop_tokens(tok, 2));
+      continue;
+    }
+
+    if (is_hash(tok) &&
+        next(tok)->id == KW_ELSE || next(tok)->id == PP_ELIF ||
+        next(tok)->id == PP_ENDIF)
+      break;
+    tok = drop_tokens(tok, 1);
+  }
+  return tok;
+}
+
+// Double-quote a given string and returns it.
+static char *quote_string(char *str) {
+  int bufsize = 3;
+  for (int i = 0; str[i]; i++) {
+    if (str[i] == '\\' || str[i] == '"')
+      bufsize++;
+    bufsize++;
+  }
+
+  char *buf = alloc_obj(AK_STRING, bufsize);
+  char *p = buf;
+  *p++ = '"';
+  for (int i = 0; str[i]; i++) {
+    if (str[i] == '\\' || str[i] == '"')
+      *p++ = '\\';
+    *p++ = str[i];
+  }
+  *p++ = '"';
+  *p++ = '\0';
+  return buf;
+}
+
+static Token *new_str_token(char *str, Token *tmpl) {
+  char *buf = quote_string(str);
+  return tokenize(tmpl->file->name, tmpl->file->file_no, buf);
+}
+
+// Copy all tokens until the next newline, terminate them with
+// an EOF token and then returns them. This function is used to
+// create a new list of tokens for `#if` arguments.
+static Token *copy_line(Token **rest, Token *tok) {
+  Token head = {};
+  Token *cur = &head;
+
+  while (!tok->at_bol) {
+    cur = cur->next = copy_token(tok);
+    tok = drop_tokens(tok, 1);
+  }
+
+  cur->next = new_eof(tok);
+  *rest = tok;
+  return head.next;
+}
+
+static Token *new_num_token(int val, Token *tmpl) {
+  char *buf = alloc_obj(AK_STRING, 20);
+  sprintf(buf, "%d\n", val);
+  return tokenize(tmpl->file->name, tmpl->file->file_no, buf);
+}
+
+static Token *read_const_expr(Token **rest, Token *tok) {
+  tok = copy_line(rest, tok);
+
+  Token head = {};
+  Token *cur = &head;
+
+  while (tok->kind != TK_EOF) {
+    // "defined(foo)" or "defined foo" becomes "1" if macro "foo"
+    // is defined. Otherwise "0".
+    if (tok->id == PP_DEFINED) {
+      Token *start = tok;
+      _Bool has_paren = consume(&tok, tok->next, P_LPAREN);
+
+      if (tok->kind != TK_IDENT)
+        error_tok(start, "macro name must be an identifier");
+      Macro *m = find_macro(tok);
+      tok = tok->next;
+
+      if (has_paren)
+        tok = skip(tok, P_RPAREN);
+
+      cur = cur->next = new_num_token(m ? 1: 0, start);
+      continue;
+    }
+
+    cur = cur->next = tok;
+    tok = tok->next;
+  }
+
+  cur->next = tok;
+  return head.next;
+}
+
+// Read and evaluate a constant expression.
+static long eval_const_expr(Token **rest, Token *tok) {
+  Token *expr = read_const_expr(rest, tok);
+  expr = preprocess(expr);
+
+  // The starndard requires we replace remaaining non-macro
+  // identifiers with "0" before evaluating a constant expression.
+  // I dont't knwo the rationale behind it, but I guess there's a
+  // historical reason.
+  for (Token *t = expr; t->kind != TK_EOF; t = t->next) {
+    if (t->kind == TK_IDENT) {
+      Token *next = t->next;
+      *t = *new_num_token(0, t);
+      t->next = next;
+    }
+  }
+
+  Token *rest2;
+  long val = const_expr(&rest2, expr);
+  if (rest2->kind != TK_EOF)
+    error_tok(rest2, "extra token");
+  return val;
+}
+
+static CondIncl *push_cond_incl(Token *tok, _Bool included) {
+  CondIncl *ci = alloc_obj(AK_MACRO, sizeof(CondIncl));
+  ci->next = cond_incl;
+  ci->ctx = IN_THEN;
+  ci->tok = tok;
+  ci->included = included;
+  cond_incl = ci;
+  return ci;
+}
+
+static Macro *find_macro(Token *tok) {
+  if (tok->kind != TK_IDENT)
+    return 0;
+  return hashmap_get2(&macros, tok->name, tok->len);
+}
+
+static Macro *add_macro(char *name, _Bool is_objlike, Token *body) {
+  Macro *m = alloc_obj(AK_MACRO, sizeof(Macro));
+  m->name = name;
+  m->is_objlike = is_objlike;
+  m->body = body;
+  m->hideset = new_leaf(name);
+  hashmap_put(&macros, name, m);
+  return m;
+}
+
+static MacroParam *read_macro_params(Token **rest, Token *tok) {
+  MacroParam head = {};
+  MacroParam *cur = &head;
+
+  while (tok->id != P_RPAREN) {
+    // skip() doesn't read more tokens of a lazily tokenized file.
+    if (cur != &head) {
+      skip(tok, P_COMMA);
+      tok = next(tok);
+    }
+
+    if (tok->kind != TK_IDENT)
+      error_tok(tok, "expected an identifier");
+    MacroParam *m = alloc_obj(AK_MACRO, sizeof(MacroParam));
+    m->name = tok->name;
+    cur = cur->next = m;
+    tok = next(tok);
+  }
+  *rest = next(tok);
+  return head.next;
+}
+
+static void read_macro_definition(Token **rest, Token *tok) {
+  if (tok->kind != TK_IDENT)
+    error_tok(tok, "macro name must be an identifier");
+  char *name = tok->name;
+  tok = next(tok);
+
+  if (!tok->has_space && tok->id == P_LPAREN) {
+    // Function-like macro
+    MacroParam *params = read_macro_params(&tok, next(tok));
+    Macro *m = add_macro(name, 0, copy_line(rest, tok));
+    m->params = params;
+  } else {
+    // Object-like macro
+    add_macro(name, 1, copy_line(rest, tok));
+  }
+}
+
+static MacroArg *read_macro_arg_one(Token **rest, Token *tok) {
+  MacroArg *arg = alloc_obj(AK_MACRO, sizeof(MacroArg));
+  arg->tok = tok;
+  int level = 0;
+
+  while (level > 0 || tok->id != P_COMMA && tok->id != P_RPAREN) {
+    if (tok->kind == TK_EOF)
+      error_tok(tok, "premature end of input");
+
+    if (tok->id == P_LPAREN)
+      level++;
+
+    if (tok->id == P_RPAREN)
+      level--;
+
+    tok = next(tok);
+  }
+
+  arg->end = tok;
+  *rest = tok;
+  return arg;
+}
+
+static MacroArg *read_macro_args(Token **rest, Token *tok, MacroParam *params) {
+  Token *start = tok;
+  tok = next(next(tok));
+
+  MacroArg head = {};
+  MacroArg *cur = &head;
+
+  MacroParam *pp = params;
+  for (; pp; pp = pp->next) {
+    if (cur != &head) {
+      skip(tok, P_COMMA);
+      tok = next(tok);
+    }
+    cur = cur->next = read_macro_arg_one(&tok, tok);
+    cur->name = pp->name;
+  }
+
+  if (pp)
+    error_tok(start, "too many arguments");
+  skip(tok, P_RPAREN);
+  *rest = tok;
+  return head.next;
+}
+
+// Returns the argument if `tok` is a macro parameter. Macro arguments
+// can be empty. For example, the second argument of foo(a,,c) is the
+// empty list of tokens, whose `tok` and `end` are the same.
+static MacroArg *find_arg(MacroArg *args, Token *tok) {
+  for (MacroArg *ap = args; ap; ap = ap->next)
+    if (tok->name == ap->name)
+      return ap;
+  return 0;
+}
+
+// Concatenates all tokens in `tok` up to `end` and returns a new
+// string.
+static char *join_tokens(Token *tok, Token *end) {
+  // Compute the length of the resulting token.
+  int len = 1;
+  for (Token *t = tok; t != end; t = next(t)) {
+    if (t != tok && t->has_space)
+      len++;
+    len += t->len;
+  }
+
+  char *buf = alloc_obj(AK_STRING, len);
+
+  // Copy token texts.
+  int pos = 0;
+  for (Token *t = tok; t != end; t = next(t)) {
+    if (t != tok && t->has_space)
+      buf[pos++] = ' ';
+    strncpy(buf + pos, t->loc, t->len);
+    pos += t->len;
+  }
+  buf[pos] = '\0';
+  return buf;
+}
+
+// Concatenates all tokens in `arg` and returns a new string token.
+// This function is used for the stringizing operator (#).
+static Token *stringize(Token *hash, MacroArg *arg) {
+  // Create a new string token. We need to set some value to its
+  // source location for error reporting function, so we use a macro
+  // name token as a template
+  char *s = join_tokens(arg->tok, arg->end);
+  return new_str_token(s, hash);
+}
+
+// Concatenate two tokens to create a new token.
+static Token *paste(Token *lhs, Token *rhs) {
+  // Paste the two tokens.
+  char *buf = alloc_obj(AK_STRING, lhs->len + rhs->len + 1);
+  sprintf(buf, "%.*s%.*s", lhs->len, lhs->loc, rhs->len, rhs->loc);
+
+  // Tokenize the resulting string.
+  Token *tok = tokenize(lhs->file->name, lhs->file->file_no, buf);
+  if(tok->next->kind != TK_EOF)
+    error_tok(lhs, "pasting forms '%s', an invalid token", buf);
+  return tok;
+}
+
+// Starts reading the tokens of an argument.
+static void start_arg(Expansion *e, Token *tok, Token *end) {
+  if (tok != end) {
+    e->arg = tok;
+    e->arg_end = end;
+  }
+}
+
+// Returns the next token of a macro body with func-like macro
+// parameters replaced with given arguments, or 0 at the end.
+// Unless `*is_new` is set, the token is one of the macro body or
+// an argument, which must not be modified.
+static Token *read_subst(Expansion *e, _Bool *is_new) {
+  *is_new = 0;
+
+  for (;;) {
+    if (e->arg) {
+      Token *tok = e->arg;
+      e->arg = (next(tok) == e->arg_end) ? 0 : next(tok);
+      return tok;
+    }
+
+    Token *tok = e->body;
+    if (tok->kind == TK_EOF)
+      return 0;
+    e->body = tok->next;
+
+    // If the current token is a mcro parameter, replaces
+    // it with actuals.
+    MacroArg *arg = find_arg(e->args, tok);
+    if (arg) {
+      // x##y becomes y if x is the empty argument list.
+      if (arg->tok == arg->end && e->body->id == P_HASHHASH)
+        e->body = e->body->next;
+      start_arg(e, arg->tok, arg->end);
+      continue;
+    }
+
+    // "#" followed by a parameter is replaced with stringized actuals.
+    if (tok->id == P_HASH) {
+      arg = find_arg(e->args, tok->next);
+      if (arg) {
+        e->body = tok->next->next;
+        *is_new = 1;
+        return stringize(tok, arg);
+      }
+    }
+    return tok;
+  }
+}
+
+// Produces the next token of a macro expansion, or returns 0 at
+// the end.
+static Token *expand_next(Expansion *e) {
+  _Bool is_new;
+  Token *tok = read_subst(e, &is_new);
+  if (!tok)
+    return 0;
+
+  // Replace x##y with xy. The left-hand side is the token we have
+  // just read, which must be a whole argument or its last token.
+  while (!e->macro->is_objlike && !e->arg && e->body->id == P_HASHHASH) {
+    Token *rhs = e->body->next;
+    if (rhs->kind == TK_EOF)
+      error_tok(e->body, "'##' cannot appear at the end of a macro");
+    MacroArg *arg = find_arg(e->args, rhs);
+    e->body = rhs->next;
+
+    if (!arg) {
+      tok = paste(tok, rhs);
+      is_new = 1;
+      continue;
+    }
+
+    // x##y becomes x if y is the empty argument list.
+    if (arg->tok == arg->end)
+      continue;
+
+    tok = paste(tok, arg->tok);
+    is_new = 1;
+    start_arg(e, next(arg->tok), arg->end);
+  }
+
+  if (!is_new)
+    tok = copy_token(tok);
+  tok->next = 0;
+
+  if (tok->hideset != e->last_hs) {
+    e->last_hs = tok->hideset;
+    e->result_hs = hideset_union(tok->hideset, e->hideset);
+  }
+  tok->hideset = e->result_hs;
+  return tok;
+}
+
+// Starts expanding a macro and returns the first resulting token.
+// The last resulting token is followed by `cont`.
+static Token *start_expansion(Macro *m, MacroArg *args, Hideset *hs,
+                              Token *cont) {
+  Expansion *e = free_expansions;
+  if (e)
+    free_expansions = e->next;
+  else
+    e = alloc_obj(AK_MACRO, sizeof(Expansion));
+
+  memset(e, 0, sizeof(Expansion));
+  e->macro = m;
+  e->args = args;
+  e->hideset = hs;
+  e->body = m->body;
+  e->cont = cont;
+  e->result_hs = hs;
+
+  e->last = expand_next(e);
+  if (!e->last) {
+    e->next = free_expansions;
+    free_expansions = e;
+    return cont;
+  }
+  e->next = expansions;
+  expansions = e;
+  return e->last;
+}
+
+// Returns the token following `tok`. If `tok` is the last token
+// produced so far by a macro expansion, the next one is produced.
+// If it's the last one read so far from a file, more are read.
+// If it's the last one of an included file's shared tokens, the
+// token following the include is returned.
+static Token *next(Token *tok) {
+  Token *t = tok->next;
+  if (t && (t->kind != TK_EOF || !t->is_shared))
+    return t;
+
+  if (t) {
+    for (FileInfo *fi = includes; fi; fi = fi->next_include)
+      if (fi->eof == t)
+        return fi->cont;
+    return t;
+  }
+
+  for (Expansion **ep = &expansions; *ep; ep = &(*ep)->next) {
+    Expansion *e = *ep;
+    if (e->last != tok)
+      continue;
+
+    tok->next = expand_next(e);
+    if (tok->next) {
+      e->last = tok->next;
+      return tok->next;
+    }
+
+    // This expansion is done.
+    tok->next = e->cont;
+    *ep = e->next;
+    e->next = free_expansions;
+    free_expansions = e;
+    return tok->next;
+  }
+  return next_token(tok);
+}
+
+static _Bool expand_macro(Token **rest, Token *tok) {
+  if (hideset_contains(tok->hideset, tok->name))
+    return 0;
+
+  Macro *m = find_macro(tok);
+  if (!m)
+    return 0;
+
+  // Object-like macro application
+  if (m->is_objlike) {
+    Hideset *hs = hideset_union(tok->hideset, m->hideset);
+    *rest = start_expansion(m, 0, hs, next(tok));
+    return 1;
+  }
+
+  // If a funclike macro token is not followed by an argument list,
+  // treat it as a normal identifier.
+  if (next(tok)->id != P_LPAREN)
+    return 0;
+
+  // Function-like macro application
+  Token *macro_token = tok;
+  MacroArg *args = read_macro_args(&tok, tok, m->params);
+  Token *rparen = tok;
+
+  // Tokens that consist a func-like macro invocation may have different
+  // hidesets, and if that's the case, it's not clear what the hideset
+  // for the new tokens should be. We take the intersection of the
+  // macro token and the closing parenthesis and use it as a new hideset
+  // as explained in the Dave Prossor's algorithm
+  // (https://github.com/rui314/8cc/wiki/cpp.algo.pdf)
+  Hideset *hs = hideset_intersection(macro_token->hideset, rparen->hideset);
+  hs = hideset_union(hs, m->hideset);
+
+  *rest = start_expansion(m, args, hs, next(rparen));
+  return 1;
+}
+
+// Visit all tokens in `tok` while evaluating preprocessing
+// macros and directives.
+static Token *preprocess(Token *tok) {
+  Token head = {};
+  Token *cur = &head;
+
+  while (tok->kind != TK_EOF) {
+    // Includes end where the tokens following them begin.
+    while (includes && tok == includes->cont) {
+      includes->cont = 0;
+      includes = includes->next_include;
+    }
+
+    // If it is a macro, expand it.
+    if (expand_macro(&tok, tok))
+      continue;
+
+    // Pass through if it is not a "#". Shared tokens are copied.
+    if (!is_hash(tok)) {
+      cur = cur->next = tok->is_shared ? copy_token(tok) : tok;
+      tok = next(tok);
+      continue;
+    }
+
+    Token *start = tok;
+    tok = next(tok);
+
+    if (tok->id == PP_INCLUDE) {
+      Token *name = next(tok);
+      if (name->kind != TK_STR)
+        error_tok(name, "expected a filename");
+
+      char *path = alloc_str(name->lit->contents, name->lit->cont_len);
+      Token *rest = skip_line(next(name));
+      free_token(start);
+      free_token(tok);
+
+      // A file with "#pragma once" is never included twice. A file
+      // wrapped in an include guard yields no tokens once the guard
+      // macro is defined. Either way, we don't even read it.
+      FileInfo *fi = get_file_info(path);
+      if (fi && (fi->pragma_once ||
+                 (fi->guard && hashmap_get(&macros, fi->guard)))) {
+        nr_skipped_includes++;
+        free_token(name);
+        tok = rest;
+        continue;
+      }
+
+      Token *tok2 = tokenize_file(path, rest);
+      if (!tok2)
+        error_tok(name, "%s", strerror(*__errno_location()));
+      free_token(name);
+
+      if (fi && is_hash(tok2) && next(tok2)->id == PP_IFNDEF) {
+        guard_start = tok2;
+        guard_file = fi;
+        guard_end = rest;
+      }
+      tok = tok2;
+      continue;
+    }
+
+    if (tok->id == PP_DEFINE) {
+      read_macro_definition(&tok, drop_tokens(start, 2));
+      continue;
+    }
+
+    if (tok->id == PP_UNDEF) {
+      tok = drop_tokens(start, 2);
+      if (tok->kind != TK_IDENT)
+        error_tok(tok, "macro name must be an identifier");
+      char *name = tok->name;
+      tok = skip_line(drop_tokens(tok, 1));
+      hashmap_delete(&macros, name);
+      continue;
+    }
+
+    if (tok->id == KW_IF) {
+      long val = eval_const_expr(&tok, next(tok));
+      push_cond_incl(start, val);
+      if (!val)
+        tok = skip_cond_incl(tok);
+      continue;
+    }
+
+    if (tok->id == PP_IFDEF) {
+      _Bool defined = find_macro(next(tok));
+      push_cond_incl(tok, defined);
+      tok = skip_line(next(next(tok)));
+      if (!defined)
+        tok = skip_cond_incl(tok);
+      continue;
+    }
+
+    if (tok->id == PP_IFNDEF) {
+      Token *name = next(tok);
+      _Bool defined = find_macro(name);
+      CondIncl *ci = push_cond_incl(tok, !defined);
+      if (start == guard_start && name->kind == TK_IDENT) {
+        ci->guard = name->name;
+        ci->guard_file = guard_file;
+        ci->guard_end = guard_end;
+      }
+      guard_start = 0;
+      tok = skip_line(next(next(tok)));
+      if (defined)
+        tok = skip_cond_incl(tok);
+      continue;
+    }
+
+    if (tok->id == KW_ELSE) {
+      if (!cond_incl || cond_incl->ctx == IN_ELSE)
+        error_tok(start, "stray #else");
+      cond_incl->ctx = IN_ELSE;
+      tok = skip_line(drop_tokens(start, 2));
+
+      if (cond_incl->included)
+        tok = skip_cond_incl(tok);
+      continue;
+    }
+
+    if (tok->id == PP_ELIF) {
+      if (!cond_incl || cond_incl->ctx == IN_ELSE)
+        error_tok(start, "stray #elif");
+      cond_incl->ctx = IN_ELIF;
+
+      if (!cond_incl->included && eval_const_expr(&tok, next(tok)))
+        cond_incl->included = 1;
+      else
+        tok = skip_cond_incl(tok);
+      continue;
+    }
+
+    if (tok->id == PP_ENDIF) {
+      if (!cond_incl)
+        error_tok(start, "stray #endif");
+      CondIncl *ci = cond_incl;
+      cond_incl = ci->next;
+      _Bool same_file = (start->file == ci->tok->file);
+      tok = skip_line(drop_tokens(start, 2));
+
+      if (ci->guard && ci->ctx == IN_THEN && same_file &&
+          tok == ci->guard_end) {
+        if (!ci->guard_file->guard)
+          nr_include_guards++;
+        ci->guard_file->guard = ci->guard;
+      }
+      continue;
+    }
+
+    if (tok->id == PP_PRAGMA) {
+      File *file = start->file;
+      tok = drop_tokens(start, 2);
+
+      if (!tok->at_bol && tok->id == PP_ONCE) {
+        FileInfo *fi = get_file_info(file->name);
+        if (fi && !fi->pragma_once) {
+          fi->pragma_once = 1;
+          nr_pragma_once++;
+        }
+        tok = skip_line(drop_tokens(tok, 1));
+        continue;
+      }
+
+      // Other pragmas are ignored.
+      while (tok->kind != TK_EOF && !tok->at_bol)
+        tok = drop_tokens(tok, 1);
+      continue;
+    }
+
+    // `#`-only line is legal. It's called a null directive.
+    if (tok->at_bol)
+      continue;
+
+    error_tok(tok, "invalid preprocessor directive");
+  }
+
+  cur->next = tok;
+  return head.next;
+}
+
+// Saves the files read so far to a precompiled header, which goes
+// out of date once any of them changes.
+void save_file_ids(void) {
+  long n = 0;
+  for (int i = 0; i < file_paths.capacity; i++)
+    if (file_paths.buckets[i].val)
+      n++;
+  pch_put_long(n);
+
+  for (int i = 0; i < file_paths.capacity; i++) {
+    FileInfo *fi = file_paths.buckets[i].val;
+    if (!fi)
+      continue;
+
+    // A relative path would be resolved against a different directory
+    // by a compiler running elsewhere.
+    char *path = file_paths.buckets[i].key;
+    char *real = realpath(path, 0);
+    if (real) {
+      path = alloc_str(real, strlen(real));
+      free(real);
+    }
+    pch_put_str(path);
+
+    pch_put_long(fi->id.dev);
+    pch_put_long(fi->id.ino);
+    pch_put_long(fi->id.size);
+    pch_put_long(fi->id.mtime_sec);
+    pch_put_long(fi->id.mtime_nsec);
+  }
+}
+
+// Reads files saved by save_file_ids() and returns one that has
+// changed since, or 0 if none has.
+char *load_file_ids(void) {
+  char *changed = 0;
+  for (long n = pch_get_long(); n > 0; n--) {
+    char *path = pch_get_str();
+    FileId id = {};
+    id.dev = pch_get_long();
+    id.ino = pch_get_long();
+    id.size = pch_get_long();
+    id.mtime_sec = pch_get_long();
+    id.mtime_nsec = pch_get_long();
+
+    FileId cur;
+    if (!changed && (!get_file_id(path, &cur) ||
+                     memcmp(&id, &cur, sizeof(FileId))))
+      changed = path;
+  }
+  return changed;
+}
+
+// Saves macros to a precompiled header.
+void save_macros(void) {
+  long n = 0;
+  for (int i = 0; i < macros.capacity; i++)
+    if (macros.buckets[i].val)
+      n++;
+  pch_put_long(n);
+
+  for (int i = 0; i < macros.capacity; i++) {
+    Macro *m = macros.buckets[i].val;
+    if (!m)
+      continue;
+    pch_put_str(m->name);
+    pch_put_long(m->is_objlike);
+    pch_put_tokens(m->body);
+
+    long nparams = 0;
+    for (MacroParam *mp = m->params; mp; mp = mp->next)
+      nparams++;
+    pch_put_long(nparams);
+    for (MacroParam *mp = m->params; mp; mp = mp->next)
+      pch_put_str(mp->name);
+  }
+}
+
+// Restores macros from a precompiled header.
+void load_macros(void) {
+  for (long n = pch_get_long(); n > 0; n--) {
+    char *name = pch_get_name();
+    _Bool is_objlike = pch_get_long();
+    Macro *m = add_macro(name, is_objlike, pch_get_tokens());
+
+    MacroParam head = {};
+    MacroParam *cur = &head;
+    for (long i = pch_get_long(); i > 0; i--) {
+      cur = cur->next = alloc_obj(AK_MACRO, sizeof(MacroParam));
+      cur->name = pch_get_name();
+    }
+    m->params = head.next;
+  }
+}
+
+// Prints out statistics of the preprocessor to stderr.
+void print_pp_report(char *input) {
+  int n = 0;
+  for (int i = 0; i < macros.capacity; i++)
+    if (macros.buckets[i].val)
+      n++;
+
+  long lookups = macros.lookups;
+  long avg = lookups ? macros.probes * 100 / lookups : 0;
+  fprintf(stderr, "preprocessor report for %s\n", input);
+  fprintf(stderr, "macros: %d defined, %d buckets\n", n, macros.capacity);
+  fprintf(stderr, "macro lookups: %ld, probes: %ld (%ld.%02ld per lookup)\n",
+          lookups, macros.probes, avg / 100, avg % 100);
+  fprintf(stderr, "include guards: %d, #pragma once: %d, ",
+          nr_include_guards, nr_pragma_once);
+  fprintf(stderr, "includes skipped: %ld\n", nr_skipped_includes);
+  fprintf(stderr, "token cache: %d files, %ld hits\n",
+          nr_token_cache_files, nr_token_cache_hits);
+  fprintf(stderr, "hidesets: %ld, set operations: %ld (%ld memoized)\n",
+          nr_hidesets, nr_hideset_ops, nr_hideset_op_hits);
+}
+
+// Entry point function of the preprocessor.
+Token *read_file(char *path) {
+  Token *tok = tokenize_file(path, 0);
+  if (!tok)
+    error("cannot open %s: %s", path, strerror(*__errno_location()));
+  timer_start(PH_PREPROCESS);
+  tok = preprocess(tok);
+  timer_stop();
+  if (cond_incl)
+    error_tok(cond_incl->tok, "unterminated conditional directive");
+  convert_keywords(tok);
+  return tok;
+}
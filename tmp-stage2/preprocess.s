@@ -0,0 +1,19375 @@
+.file 1 "preprocess.c"
+.intel_syntax noprefix
+.bss
+.align 8
+guard_end:
+  .zero 8
+.align 8
+guard_file:
+  .zero 8
+.align 8
+guard_start:
+  .zero 8
+.align 8
+nr_hideset_op_hits:
+  .zero 8
+.align 8
+nr_hideset_ops:
+  .zero 8
+.align 8
+nr_hidesets:
+  .zero 8
+.align 8
+hideset_ops:
+  .zero 32
+.align 8
+hidesets:
+  .zero 32
+.align 8
+includes:
+  .zero 8
+.align 8
+nr_token_cache_hits:
+  .zero 8
+.align 4
+nr_token_cache_files:
+  .zero 4
+.align 8
+nr_skipped_includes:
+  .zero 8
+.align 4
+nr_pragma_once:
+  .zero 4
+.align 4
+nr_include_guards:
+  .zero 4
+.align 8
+file_paths:
+  .zero 32
+.align 8
+file_ids:
+  .zero 32
+.align 8
+free_expansions:
+  .zero 8
+.align 8
+expansions:
+  .zero 8
+.align 8
+cond_incl:
+  .zero 8
+.align 8
+macros:
+  .zero 32
+.align 4
+file_no:
+  .zero 4
+.align 1
+.globl pp_report
+pp_report:
+  .zero 1
+.data
+.align 1
+.L.data.29:
+  .byte 117
+  .byte 110
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 109
+  .byte 105
+  .byte 110
+  .byte 97
+  .byte 116
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 100
+  .byte 105
+  .byte 116
+  .byte 105
+  .byte 111
+  .byte 110
+  .byte 97
+  .byte 108
+  .byte 32
+  .byte 100
+  .byte 105
+  .byte 114
+  .byte 101
+  .byte 99
+  .byte 116
+  .byte 105
+  .byte 118
+  .byte 101
+  .zero 1
+.align 1
+.L.data.28:
+  .byte 99
+  .byte 97
+  .byte 110
+  .byte 110
+  .byte 111
+  .byte 116
+  .byte 32
+  .byte 111
+  .byte 112
+  .byte 101
+  .byte 110
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.27:
+  .byte 104
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 115
+  .byte 101
+  .byte 116
+  .byte 115
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 115
+  .byte 101
+  .byte 116
+  .byte 32
+  .byte 111
+  .byte 112
+  .byte 101
+  .byte 114
+  .byte 97
+  .byte 116
+  .byte 105
+  .byte 111
+  .byte 110
+  .byte 115
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 32
+  .byte 40
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 32
+  .byte 109
+  .byte 101
+  .byte 109
+  .byte 111
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 100
+  .byte 41
+  .byte 10
+  .zero 1
+.align 1
+.L.data.26:
+  .byte 116
+  .byte 111
+  .byte 107
+  .byte 101
+  .byte 110
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 99
+  .byte 104
+  .byte 101
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 32
+  .byte 104
+  .byte 105
+  .byte 116
+  .byte 115
+  .byte 10
+  .zero 1
+.align 1
+.L.data.25:
+  .byte 105
+  .byte 110
+  .byte 99
+  .byte 108
+  .byte 117
+  .byte 100
+  .byte 101
+  .byte 115
+  .byte 32
+  .byte 115
+  .byte 107
+  .byte 105
+  .byte 112
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 10
+  .zero 1
+.align 1
+.L.data.24:
+  .byte 105
+  .byte 110
+  .byte 99
+  .byte 108
+  .byte 117
+  .byte 100
+  .byte 101
+  .byte 32
+  .byte 103
+  .byte 117
+  .byte 97
+  .byte 114
+  .byte 100
+  .byte 115
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 35
+  .byte 112
+  .byte 114
+  .byte 97
+  .byte 103
+  .byte 109
+  .byte 97
+  .byte 32
+  .byte 111
+  .byte 110
+  .byte 99
+  .byte 101
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 44
+  .byte 32
+  .zero 1
+.align 1
+.L.data.23:
+  .byte 109
+  .byte 97
+  .byte 99
+  .byte 114
+  .byte 111
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 111
+  .byte 107
+  .byte 117
+  .byte 112
+  .byte 115
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 112
+  .byte 114
+  .byte 111
+  .byte 98
+  .byte 101
+  .byte 115
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 32
+  .byte 40
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 46
+  .byte 37
+  .byte 48
+  .byte 50
+  .byte 108
+  .byte 100
+  .byte 32
+  .byte 112
+  .byte 101
+  .byte 114
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 111
+  .byte 107
+  .byte 117
+  .byte 112
+  .byte 41
+  .byte 10
+  .zero 1
+.align 1
+.L.data.22:
+  .byte 109
+  .byte 97
+  .byte 99
+  .byte 114
+  .byte 111
+  .byte 115
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 105
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 98
+  .byte 117
+  .byte 99
+  .byte 107
+  .byte 101
+  .byte 116
+  .byte 115
+  .byte 10
+  .zero 1
+.align 1
+.L.data.21:
+  .byte 112
+  .byte 114
+  .byte 101
+  .byte 112
+  .byte 114
+  .byte 111
+  .byte 99
+  .byte 101
+  .byte 115
+  .byte 115
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 114
+  .byte 101
+  .byte 112
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 10
+  .zero 1
+.align 1
+.L.data.20:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 112
+  .byte 114
+  .byte 101
+  .byte 112
+  .byte 114
+  .byte 111
+  .byte 99
+  .byte 101
+  .byte 115
+  .byte 115
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 100
+  .byte 105
+  .byte 114
+  .byte 101
+  .byte 99
+  .byte 116
+  .byte 105
+  .byte 118
+  .byte 101
+  .zero 1
+.align 1
+.L.data.19:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 97
+  .byte 121
+  .byte 32
+  .byte 35
+  .byte 101
+  .byte 110
+  .byte 100
+  .byte 105
+  .byte 102
+  .zero 1
+.align 1
+.L.data.18:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 97
+  .byte 121
+  .byte 32
+  .byte 35
+  .byte 101
+  .byte 108
+  .byte 105
+  .byte 102
+  .zero 1
+.align 1
+.L.data.17:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 97
+  .byte 121
+  .byte 32
+  .byte 35
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .zero 1
+.align 1
+.L.data.16:
+  .byte 109
+  .byte 97
+  .byte 99
+  .byte 114
+  .byte 111
+  .byte 32
+  .byte 110
+  .byte 97
+  .byte 109
+  .byte 101
+  .byte 32
+  .byte 109
+  .byte 117
+  .byte 115
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 101
+  .byte 32
+  .byte 97
+  .byte 110
+  .byte 32
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 102
+  .byte 105
+  .byte 101
+  .byte 114
+  .zero 1
+.align 1
+.L.data.15:
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.14:
+  .byte 101
+  .byte 120
+  .byte 112
+  .byte 101
+  .byte 99
+  .byte 116
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 97
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 110
+  .byte 97
+  .byte 109
+  .byte 101
+  .zero 1
+.align 1
+.L.data.13:
+  .byte 39
+  .byte 35
+  .byte 35
+  .byte 39
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 110
+  .byte 110
+  .byte 111
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 112
+  .byte 112
+  .byte 101
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 104
+  .byte 101
+  .byte 32
+  .byte 101
+  .byte 110
+  .byte 100
+  .byte 32
+  .byte 111
+  .byte 102
+  .byte 32
+  .byte 97
+  .byte 32
+  .byte 109
+  .byte 97
+  .byte 99
+  .byte 114
+  .byte 111
+  .zero 1
+.align 1
+.L.data.12:
+  .byte 112
+  .byte 97
+  .byte 115
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 109
+  .byte 115
+  .byte 32
+  .byte 39
+  .byte 37
+  .byte 115
+  .byte 39
+  .byte 44
+  .byte 32
+  .byte 97
+  .byte 110
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 116
+  .byte 111
+  .byte 107
+  .byte 101
+  .byte 110
+  .zero 1
+.align 1
+.L.data.11:
+  .byte 37
+  .byte 46
+  .byte 42
+  .byte 115
+  .byte 37
+  .byte 46
+  .byte 42
+  .byte 115
+  .zero 1
+.align 1
+.L.data.10:
+  .byte 116
+  .byte 111
+  .byte 111
+  .byte 32
+  .byte 109
+  .byte 97
+  .byte 110
+  .byte 121
+  .byte 32
+  .byte 97
+  .byte 114
+  .byte 103
+  .byte 117
+  .byte 109
+  .byte 101
+  .byte 110
+  .byte 116
+  .byte 115
+  .zero 1
+.align 1
+.L.data.9:
+  .byte 112
+  .byte 114
+  .byte 101
+  .byte 109
+  .byte 97
+  .byte 116
+  .byte 117
+  .byte 114
+  .byte 101
+  .byte 32
+  .byte 101
+  .byte 110
+  .byte 100
+  .byte 32
+  .byte 111
+  .byte 102
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 112
+  .byte 117
+  .byte 116
+  .zero 1
+.align 1
+.L.data.8:
+  .byte 109
+  .byte 97
+  .byte 99
+  .byte 114
+  .byte 111
+  .byte 32
+  .byte 110
+  .byte 97
+  .byte 109
+  .byte 101
+  .byte 32
+  .byte 109
+  .byte 117
+  .byte 115
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 101
+  .byte 32
+  .byte 97
+  .byte 110
+  .byte 32
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 102
+  .byte 105
+  .byte 101
+  .byte 114
+  .zero 1
+.align 1
+.L.data.7:
+  .byte 101
+  .byte 120
+  .byte 112
+  .byte 101
+  .byte 99
+  .byte 116
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 97
+  .byte 110
+  .byte 32
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 102
+  .byte 105
+  .byte 101
+  .byte 114
+  .zero 1
+.align 1
+.L.data.6:
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 114
+  .byte 97
+  .byte 32
+  .byte 116
+  .byte 111
+  .byte 107
+  .byte 101
+  .byte 110
+  .zero 1
+.align 1
+.L.data.5:
+  .byte 109
+  .byte 97
+  .byte 99
+  .byte 114
+  .byte 111
+  .byte 32
+  .byte 110
+  .byte 97
+  .byte 109
+  .byte 101
+  .byte 32
+  .byte 109
+  .byte 117
+  .byte 115
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 101
+  .byte 32
+  .byte 97
+  .byte 110
+  .byte 32
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 102
+  .byte 105
+  .byte 101
+  .byte 114
+  .zero 1
+.align 1
+.L.data.4:
+  .byte 37
+  .byte 100
+  .byte 10
+  .zero 1
+.align 1
+.L.data.3:
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 114
+  .byte 97
+  .byte 32
+  .byte 116
+  .byte 111
+  .byte 107
+  .byte 101
+  .byte 110
+  .zero 1
+.align 1
+.L.data.2:
+  .byte 46
+  .byte 102
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 34
+  .byte 37
+  .byte 115
+  .byte 34
+  .zero 1
+.align 1
+.L.data.1:
+  .byte 45
+  .zero 1
+.align 1
+.L.data.0:
+  .byte 45
+  .zero 1
+.text
+assert:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.L.return.assert:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+va_end:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.L.return.va_end:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+map_file:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-64], rdx
+  mov [rbp-72], rsi
+  mov [rbp-76], edi
+.loc 1 900 36
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 30
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset sysconf
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 901 49
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r11, 2
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  sub r10, r11
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  imul r10, r11
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 908 55
+.loc 1 907 15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  or r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+.loc 1 908 32
+  mov r10, 2
+  mov r10d, r10d
+  mov r11, 32
+  mov r11d, r11d
+  or r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 907 15
+  mov r10, offset mmap
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 909 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  sub r11d, r12d
+  movsx r11, r11d
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.map_file.1
+.loc 1 910 5
+  mov r10, 0
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.map_file
+.L.end.map_file.1:
+.loc 1 912 3
+.loc 1 913 59
+.loc 1 912 11
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  or r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+.loc 1 913 36
+  mov r10, 2
+  mov r10d, r10d
+  mov r11, 16
+  mov r11d, r11d
+  or r10d, r11d
+  mov r10d, r10d
+  mov r11, 32768
+  mov r11d, r11d
+  or r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-76]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 912 7
+  mov r10, offset mmap
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 913 63
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  sub r11d, r12d
+  movsx r11, r11d
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.map_file.2
+.loc 1 914 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset munmap
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 915 5
+  mov r10, 0
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.map_file
+.L.end.map_file.2:
+.loc 1 918 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 13
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset count_alloc
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 919 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 920 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.map_file
+.L.return.map_file:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+read_stream:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-80], rsi
+  mov [rbp-84], edi
+.loc 1 925 20
+  mov r10, 4096
+  mov r10d, r10d
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 926 16
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-68]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 927 29
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset malloc
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 929 3
+.L.begin.read_stream.1:
+.loc 1 930 5
+  lea r10, [rbp-72]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 931 47
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-84]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  lea r11, [rbp-68]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-68]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset read
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 932 5
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.read_stream.3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset __errno_location
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.read_stream.3
+  mov r10, 1
+  jmp .L.end.read_stream.3
+.L.false.read_stream.3:
+  mov r10, 0
+.L.end.read_stream.3:
+  cmp r10, 0
+  je .L.end.read_stream.2
+.loc 1 933 7
+  jmp .L.continue.read_stream.1
+.L.end.read_stream.2:
+.loc 1 934 5
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.read_stream.4
+.loc 1 935 7
+  jmp .L.break.read_stream.1
+.L.end.read_stream.4:
+.loc 1 936 5
+  lea r10, [rbp-68]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10d
+.loc 1 937 5
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.read_stream.5
+.loc 1 938 7
+  lea r10, [rbp-72]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  imul r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+.loc 1 939 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset realloc
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov [r11], r10
+.L.end.read_stream.5:
+.L.continue.read_stream.1:
+  jmp .L.begin.read_stream.1
+.L.break.read_stream.1:
+.loc 1 943 3
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  lea r12, [rbp-68]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.loc 1 944 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 13
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset count_alloc
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 945 3
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 946 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.read_stream
+.L.return.read_stream:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl get_file_id
+get_file_id:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 192
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-184], rsi
+  mov [rbp-192], rdi
+.loc 1 952 17
+.loc 1 953 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-192]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-176]
+  push r10
+  sub rsp, 8
+  mov r10, offset stat
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.get_file_id.1
+.loc 1 954 5
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.get_file_id
+.L.end.get_file_id.1:
+.loc 1 956 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-184]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 40
+  push r10
+  sub rsp, 8
+  mov r10, offset memset
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 957 3
+  lea r10, [rbp-176]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-184]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 958 3
+  lea r10, [rbp-176]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-184]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 959 3
+  lea r10, [rbp-176]
+  add r10, 48
+  mov r10, [r10]
+  lea r11, [rbp-184]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 960 3
+  lea r10, [rbp-176]
+  add r10, 88
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-184]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10
+.loc 1 961 3
+  lea r10, [rbp-176]
+  add r10, 88
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-184]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+.loc 1 962 3
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.get_file_id
+.L.return.get_file_id:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+get_file_info:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-88], rdi
+.loc 1 968 48
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset file_paths
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_get
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 969 3
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.get_file_info.1
+.loc 1 970 5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.get_file_info
+.L.end.get_file_info.1:
+.loc 1 972 12
+.loc 1 973 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.0
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.get_file_info.3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_file_id
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.get_file_info.3
+  mov r10, 0
+  jmp .L.end.get_file_info.3
+.L.true.get_file_info.3:
+  mov r10, 1
+.L.end.get_file_info.3:
+  cmp r10, 0
+  je .L.end.get_file_info.2
+.loc 1 974 5
+  mov r10, 0
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.get_file_info
+.L.end.get_file_info.2:
+.loc 1 976 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset file_ids
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  push r10
+  sub rsp, 8
+  movabs r10, 40
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_get2
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-80]
+  mov [r11], r10
+.loc 1 977 3
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.get_file_info.4
+.loc 1 978 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 13
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 96
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-80]
+  mov [r11], r10
+.loc 1 979 5
+  lea r10, [rbp-72]
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 0
+  mov al, [r10+0]
+  mov [r11+0], al
+  mov al, [r10+1]
+  mov [r11+1], al
+  mov al, [r10+2]
+  mov [r11+2], al
+  mov al, [r10+3]
+  mov [r11+3], al
+  mov al, [r10+4]
+  mov [r11+4], al
+  mov al, [r10+5]
+  mov [r11+5], al
+  mov al, [r10+6]
+  mov [r11+6], al
+  mov al, [r10+7]
+  mov [r11+7], al
+  mov al, [r10+8]
+  mov [r11+8], al
+  mov al, [r10+9]
+  mov [r11+9], al
+  mov al, [r10+10]
+  mov [r11+10], al
+  mov al, [r10+11]
+  mov [r11+11], al
+  mov al, [r10+12]
+  mov [r11+12], al
+  mov al, [r10+13]
+  mov [r11+13], al
+  mov al, [r10+14]
+  mov [r11+14], al
+  mov al, [r10+15]
+  mov [r11+15], al
+  mov al, [r10+16]
+  mov [r11+16], al
+  mov al, [r10+17]
+  mov [r11+17], al
+  mov al, [r10+18]
+  mov [r11+18], al
+  mov al, [r10+19]
+  mov [r11+19], al
+  mov al, [r10+20]
+  mov [r11+20], al
+  mov al, [r10+21]
+  mov [r11+21], al
+  mov al, [r10+22]
+  mov [r11+22], al
+  mov al, [r10+23]
+  mov [r11+23], al
+  mov al, [r10+24]
+  mov [r11+24], al
+  mov al, [r10+25]
+  mov [r11+25], al
+  mov al, [r10+26]
+  mov [r11+26], al
+  mov al, [r10+27]
+  mov [r11+27], al
+  mov al, [r10+28]
+  mov [r11+28], al
+  mov al, [r10+29]
+  mov [r11+29], al
+  mov al, [r10+30]
+  mov [r11+30], al
+  mov al, [r10+31]
+  mov [r11+31], al
+  mov al, [r10+32]
+  mov [r11+32], al
+  mov al, [r10+33]
+  mov [r11+33], al
+  mov al, [r10+34]
+  mov [r11+34], al
+  mov al, [r10+35]
+  mov [r11+35], al
+  mov al, [r10+36]
+  mov [r11+36], al
+  mov al, [r10+37]
+  mov [r11+37], al
+  mov al, [r10+38]
+  mov [r11+38], al
+  mov al, [r10+39]
+  mov [r11+39], al
+.loc 1 980 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset file_ids
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 0
+  push r10
+  sub rsp, 8
+  movabs r10, 40
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_put2
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.get_file_info.4:
+.loc 1 982 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset file_paths
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_put
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 983 3
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.get_file_info
+.L.return.get_file_info:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl read_file_string
+read_file_string:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 240
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-224], rsi
+  mov [rbp-232], rdi
+.loc 1 991 13
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-212]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 992 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-232]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.1
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.read_file_string.1
+.loc 1 993 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-232]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset open
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-212]
+  mov [r11], r10d
+.loc 1 994 5
+  lea r10, [rbp-212]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.read_file_string.2
+.loc 1 995 7
+  mov r10, 0
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.read_file_string
+.L.end.read_file_string.2:
+.L.end.read_file_string.1:
+.loc 1 998 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset timer_start
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1001 17
+.loc 1 1002 16
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1003 15
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1004 18
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1005 3
+  lea r10, [rbp-212]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.read_file_string.6
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-212]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-208]
+  push r10
+  sub rsp, 8
+  mov r10, offset fstat
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.read_file_string.6
+  mov r10, 1
+  jmp .L.end.read_file_string.6
+.L.false.read_file_string.6:
+  mov r10, 0
+.L.end.read_file_string.6:
+  cmp r10, 0
+  je .L.false.read_file_string.5
+  lea r10, [rbp-208]
+  add r10, 24
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 61440
+  mov r11d, r11d
+  and r10d, r11d
+  mov r10d, r10d
+  mov r11, 32768
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.read_file_string.5
+  mov r10, 1
+  jmp .L.end.read_file_string.5
+.L.false.read_file_string.5:
+  mov r10, 0
+.L.end.read_file_string.5:
+  cmp r10, 0
+  je .L.false.read_file_string.4
+.loc 1 1006 18
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-208]
+  add r11, 48
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.read_file_string.4
+  mov r10, 1
+  jmp .L.end.read_file_string.4
+.L.false.read_file_string.4:
+  mov r10, 0
+.L.end.read_file_string.4:
+  cmp r10, 0
+  je .L.end.read_file_string.3
+.loc 1 1007 5
+  lea r10, [rbp-208]
+  add r10, 48
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov [r11], r10
+.loc 1 1008 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-212]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  mov r10, offset map_file
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov [r11], r10
+.L.end.read_file_string.3:
+.loc 1 1010 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.read_file_string.7
+.loc 1 1011 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-212]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  push r10
+  sub rsp, 8
+  mov r10, offset read_stream
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov [r11], r10
+.L.end.read_file_string.7:
+.loc 1 1013 3
+  lea r10, [rbp-212]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.read_file_string.8
+.loc 1 1014 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-212]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset close
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.read_file_string.8:
+.loc 1 1018 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  movsx r11, r11d
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  jne .L.true.read_file_string.10
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov r12, 1
+  movsx r12, r12d
+  sub r11, r12
+  mov r12, 1
+  movsx r12, r12d
+  imul r11, r12
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.read_file_string.10
+  mov r10, 0
+  jmp .L.end.read_file_string.10
+.L.true.read_file_string.10:
+  mov r10, 1
+.L.end.read_file_string.10:
+  cmp r10, 0
+  je .L.end.read_file_string.9
+.loc 1 1019 5
+  mov r10, 10
+  movsx r10, r10b
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  lea r12, [rbp-56]
+  lea r13, [rbp-40]
+  mov [r13], r12
+  lea r12, [rbp-40]
+  mov r12, [r12]
+  mov r12, [r12]
+  mov r13, 1
+  movsx r13, r13d
+  add r12, r13
+  lea r13, [rbp-40]
+  mov r13, [r13]
+  mov [r13], r12
+  lea r12, [rbp-40]
+  mov r12, [r12]
+  mov r12, [r12]
+  mov r13, -1
+  movsx r13, r13d
+  add r12, r13
+  mov r13, 1
+  movsx r13, r13d
+  imul r12, r13
+  add r11, r12
+  mov [r11], r10b
+.L.end.read_file_string.9:
+.loc 1 1020 3
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  lea r12, [rbp-56]
+  mov r12, [r12]
+  mov r13, 1
+  movsx r13, r13d
+  imul r12, r13
+  add r11, r12
+  mov [r11], r10b
+.loc 1 1021 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset timer_count
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1022 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset timer_stop
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1024 3
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.read_file_string.11
+.loc 1 1025 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-224]
+  mov r11, [r11]
+  mov [r11], r10
+.L.end.read_file_string.11:
+.loc 1 1026 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.read_file_string
+.L.return.read_file_string:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl free_file_string
+free_file_string:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rsi
+  mov [rbp-48], rdi
+.loc 1 1031 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.else.free_file_string.1
+.loc 1 1032 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset munmap
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.free_file_string.1
+.L.else.free_file_string.1:
+.loc 1 1034 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset free
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.free_file_string.1:
+.L.return.free_file_string:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl add_file
+add_file:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdi
+.loc 1 1040 3
+  mov r10, offset file_no
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.loc 1 1041 3
+  mov r10, offset preprocess_only
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.add_file.1
+.loc 1 1042 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.2
+  push r10
+  sub rsp, 8
+  mov r10, offset file_no
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.add_file.1:
+.loc 1 1043 3
+  mov r10, offset file_no
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.add_file
+.L.return.add_file:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+include_shared:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rsi
+  mov [rbp-48], rdi
+.loc 1 1049 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 64
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 72
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.include_shared.1
+.loc 1 1050 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.include_shared
+.L.end.include_shared.1:
+.loc 1 1051 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 80
+  mov [r11], r10
+.loc 1 1052 3
+  mov r10, offset includes
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 88
+  mov [r11], r10
+.loc 1 1053 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r11, offset includes
+  mov [r11], r10
+.loc 1 1054 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 64
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.include_shared
+.L.return.include_shared:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+tokenize_file:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-88], rsi
+  mov [rbp-96], rdi
+.loc 1 1068 37
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_file_info
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1069 3
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.tokenize_file.2
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 64
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.tokenize_file.2
+  mov r10, 1
+  jmp .L.end.tokenize_file.2
+.L.false.tokenize_file.2:
+  mov r10, 0
+.L.end.tokenize_file.2:
+  cmp r10, 0
+  je .L.end.tokenize_file.1
+.loc 1 1070 5
+  mov r10, offset nr_token_cache_hits
+  lea r11, [rbp-72]
+  mov [r11], r10
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+.loc 1 1071 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset note_input_file
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1077 5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 80
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.tokenize_file.3
+.loc 1 1078 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset include_shared
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.tokenize_file
+.L.end.tokenize_file.3:
+.loc 1 1079 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_file
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1080 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 64
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset file_no
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset tokenize_cached
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.tokenize_file
+.L.end.tokenize_file.1:
+.loc 1 1084 41
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset find_cached_file
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1085 18
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1086 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.tokenize_file.4
+.loc 1 1087 5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.tokenize_file.6
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.tokenize_file.6
+  mov r10, 1
+  jmp .L.end.tokenize_file.6
+.L.false.tokenize_file.6:
+  mov r10, 0
+.L.end.tokenize_file.6:
+  cmp r10, 0
+  je  .L.else.tokenize_file.5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  jmp .L.end.tokenize_file.5
+.L.else.tokenize_file.5:
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset read_file_string
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.tokenize_file.5:
+  lea r11, [rbp-56]
+  mov [r11], r10
+.loc 1 1088 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.tokenize_file.7
+.loc 1 1089 7
+  mov r10, 0
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.tokenize_file
+.L.end.tokenize_file.7:
+.L.end.tokenize_file.4:
+.loc 1 1092 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset note_input_file
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1093 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_file
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1095 3
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.tokenize_file.10
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.tokenize_file.10
+  mov r10, 0
+  jmp .L.end.tokenize_file.10
+.L.true.tokenize_file.10:
+  mov r10, 1
+.L.end.tokenize_file.10:
+  cmp r10, 0
+  jne .L.true.tokenize_file.9
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.tokenize_file.9
+  mov r10, 0
+  jmp .L.end.tokenize_file.9
+.L.true.tokenize_file.9:
+  mov r10, 1
+.L.end.tokenize_file.9:
+  cmp r10, 0
+  je .L.end.tokenize_file.8
+.loc 1 1096 5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.tokenize_file.11
+.loc 1 1097 7
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  cmp r10, 0
+  je  .L.else.tokenize_file.12
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  jmp .L.end.tokenize_file.12
+.L.else.tokenize_file.12:
+  lea r10, [rbp-56]
+  mov r10, [r10]
+.L.end.tokenize_file.12:
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 56
+  mov [r11], r10
+.L.end.tokenize_file.11:
+.loc 1 1098 5
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.tokenize_file.13
+.loc 1 1099 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset file_no
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset tokenize_cached
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.tokenize_file
+.L.end.tokenize_file.13:
+.loc 1 1100 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset file_no
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset tokenize_lazy
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.tokenize_file
+.L.end.tokenize_file.8:
+.loc 1 1103 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.else.tokenize_file.14
+.loc 1 1104 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset file_no
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset tokenize_cached
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 64
+  mov [r11], r10
+  jmp .L.end.tokenize_file.14
+.L.else.tokenize_file.14:
+.loc 1 1106 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset file_no
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset tokenize
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 64
+  mov [r11], r10
+.L.end.tokenize_file.14:
+.loc 1 1107 3
+  mov r10, offset nr_token_cache_files
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.loc 1 1109 26
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 64
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1110 3
+.L.begin.tokenize_file.15:
+.loc 1 1111 5
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 50
+  mov [r11], r10b
+.loc 1 1112 5
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 51
+  mov [r11], r10b
+.loc 1 1113 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.tokenize_file.16
+.loc 1 1114 7
+  jmp .L.break.tokenize_file.15
+.L.end.tokenize_file.16:
+.L.continue.tokenize_file.15:
+.loc 1 1110 11
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next_token
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+  jmp .L.begin.tokenize_file.15
+.L.break.tokenize_file.15:
+.loc 1 1116 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 72
+  mov [r11], r10
+.loc 1 1117 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset include_shared
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.tokenize_file
+.L.return.tokenize_file:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+is_hash:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 1121 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 48
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.false.is_hash.1
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 89
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.is_hash.1
+  mov r10, 1
+  jmp .L.end.is_hash.1
+.L.false.is_hash.1:
+  mov r10, 0
+.L.end.is_hash.1:
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.is_hash
+.L.return.is_hash:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+skip_line:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 1127 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 48
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.skip_line.1
+.loc 1 1128 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.skip_line
+.L.end.skip_line.1:
+.loc 1 1129 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.3
+  push r10
+  sub rsp, 8
+  mov r10, offset warn_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1130 3
+.L.begin.skip_line.2:
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 48
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.break.skip_line.2
+.loc 1 1131 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.L.continue.skip_line.2:
+  jmp .L.begin.skip_line.2
+.L.break.skip_line.2:
+.loc 1 1132 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.skip_line
+.L.return.skip_line:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+copy_token:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdi
+.loc 1 1136 48
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 72
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1137 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov al, [r10+0]
+  mov [r11+0], al
+  mov al, [r10+1]
+  mov [r11+1], al
+  mov al, [r10+2]
+  mov [r11+2], al
+  mov al, [r10+3]
+  mov [r11+3], al
+  mov al, [r10+4]
+  mov [r11+4], al
+  mov al, [r10+5]
+  mov [r11+5], al
+  mov al, [r10+6]
+  mov [r11+6], al
+  mov al, [r10+7]
+  mov [r11+7], al
+  mov al, [r10+8]
+  mov [r11+8], al
+  mov al, [r10+9]
+  mov [r11+9], al
+  mov al, [r10+10]
+  mov [r11+10], al
+  mov al, [r10+11]
+  mov [r11+11], al
+  mov al, [r10+12]
+  mov [r11+12], al
+  mov al, [r10+13]
+  mov [r11+13], al
+  mov al, [r10+14]
+  mov [r11+14], al
+  mov al, [r10+15]
+  mov [r11+15], al
+  mov al, [r10+16]
+  mov [r11+16], al
+  mov al, [r10+17]
+  mov [r11+17], al
+  mov al, [r10+18]
+  mov [r11+18], al
+  mov al, [r10+19]
+  mov [r11+19], al
+  mov al, [r10+20]
+  mov [r11+20], al
+  mov al, [r10+21]
+  mov [r11+21], al
+  mov al, [r10+22]
+  mov [r11+22], al
+  mov al, [r10+23]
+  mov [r11+23], al
+  mov al, [r10+24]
+  mov [r11+24], al
+  mov al, [r10+25]
+  mov [r11+25], al
+  mov al, [r10+26]
+  mov [r11+26], al
+  mov al, [r10+27]
+  mov [r11+27], al
+  mov al, [r10+28]
+  mov [r11+28], al
+  mov al, [r10+29]
+  mov [r11+29], al
+  mov al, [r10+30]
+  mov [r11+30], al
+  mov al, [r10+31]
+  mov [r11+31], al
+  mov al, [r10+32]
+  mov [r11+32], al
+  mov al, [r10+33]
+  mov [r11+33], al
+  mov al, [r10+34]
+  mov [r11+34], al
+  mov al, [r10+35]
+  mov [r11+35], al
+  mov al, [r10+36]
+  mov [r11+36], al
+  mov al, [r10+37]
+  mov [r11+37], al
+  mov al, [r10+38]
+  mov [r11+38], al
+  mov al, [r10+39]
+  mov [r11+39], al
+  mov al, [r10+40]
+  mov [r11+40], al
+  mov al, [r10+41]
+  mov [r11+41], al
+  mov al, [r10+42]
+  mov [r11+42], al
+  mov al, [r10+43]
+  mov [r11+43], al
+  mov al, [r10+44]
+  mov [r11+44], al
+  mov al, [r10+45]
+  mov [r11+45], al
+  mov al, [r10+46]
+  mov [r11+46], al
+  mov al, [r10+47]
+  mov [r11+47], al
+  mov al, [r10+48]
+  mov [r11+48], al
+  mov al, [r10+49]
+  mov [r11+49], al
+  mov al, [r10+50]
+  mov [r11+50], al
+  mov al, [r10+51]
+  mov [r11+51], al
+  mov al, [r10+52]
+  mov [r11+52], al
+  mov al, [r10+53]
+  mov [r11+53], al
+  mov al, [r10+54]
+  mov [r11+54], al
+  mov al, [r10+55]
+  mov [r11+55], al
+  mov al, [r10+56]
+  mov [r11+56], al
+  mov al, [r10+57]
+  mov [r11+57], al
+  mov al, [r10+58]
+  mov [r11+58], al
+  mov al, [r10+59]
+  mov [r11+59], al
+  mov al, [r10+60]
+  mov [r11+60], al
+  mov al, [r10+61]
+  mov [r11+61], al
+  mov al, [r10+62]
+  mov [r11+62], al
+  mov al, [r10+63]
+  mov [r11+63], al
+  mov al, [r10+64]
+  mov [r11+64], al
+  mov al, [r10+65]
+  mov [r11+65], al
+  mov al, [r10+66]
+  mov [r11+66], al
+  mov al, [r10+67]
+  mov [r11+67], al
+  mov al, [r10+68]
+  mov [r11+68], al
+  mov al, [r10+69]
+  mov [r11+69], al
+  mov al, [r10+70]
+  mov [r11+70], al
+  mov al, [r10+71]
+  mov [r11+71], al
+.loc 1 1138 3
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 1139 3
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 51
+  mov [r11], r10b
+.loc 1 1140 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.copy_token
+.L.return.copy_token:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+new_eof:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdi
+.loc 1 1144 29
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset copy_token
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1145 3
+  mov r10, 4
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10d
+.loc 1 1146 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 4
+  mov [r11], r10d
+.loc 1 1147 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10d
+.loc 1 1148 3
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 64
+  mov [r11], r10
+.loc 1 1149 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.new_eof
+.L.return.new_eof:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+new_hideset:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 144
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-112], r8
+  mov [rbp-120], rcx
+  mov [rbp-128], rdx
+  mov [rbp-136], rsi
+  mov [rbp-144], rdi
+.loc 1 1157 56
+  movabs r10, 8
+  mov r11, 2
+  movsx r11, r11d
+  imul r10, r11
+  movabs r11, 8
+  mov r12, 2
+  movsx r12, r12d
+  imul r11, r12
+  add r10, r11
+  mov r10d, r10d
+  lea r11, [rbp-100]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1158 19
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-96]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-96]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-96]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-96]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-96]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-96]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1159 3
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  lea r11, [rbp-96]
+  add r11, 0
+  mov [r11], r10
+.loc 1 1160 3
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  lea r11, [rbp-96]
+  add r11, 8
+  mov [r11], r10
+.loc 1 1161 3
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  lea r11, [rbp-96]
+  add r11, 16
+  mov [r11], r10
+.loc 1 1162 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  lea r11, [rbp-96]
+  add r11, 24
+  mov [r11], r10
+.loc 1 1164 62
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset hidesets
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-96]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-100]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_get2
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1165 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.new_hideset.1
+.loc 1 1166 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.new_hideset
+.L.end.new_hideset.1:
+.loc 1 1168 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 48
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov [r11], r10
+.loc 1 1169 3
+  lea r10, [rbp-96]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov al, [r10+0]
+  mov [r11+0], al
+  mov al, [r10+1]
+  mov [r11+1], al
+  mov al, [r10+2]
+  mov [r11+2], al
+  mov al, [r10+3]
+  mov [r11+3], al
+  mov al, [r10+4]
+  mov [r11+4], al
+  mov al, [r10+5]
+  mov [r11+5], al
+  mov al, [r10+6]
+  mov [r11+6], al
+  mov al, [r10+7]
+  mov [r11+7], al
+  mov al, [r10+8]
+  mov [r11+8], al
+  mov al, [r10+9]
+  mov [r11+9], al
+  mov al, [r10+10]
+  mov [r11+10], al
+  mov al, [r10+11]
+  mov [r11+11], al
+  mov al, [r10+12]
+  mov [r11+12], al
+  mov al, [r10+13]
+  mov [r11+13], al
+  mov al, [r10+14]
+  mov [r11+14], al
+  mov al, [r10+15]
+  mov [r11+15], al
+  mov al, [r10+16]
+  mov [r11+16], al
+  mov al, [r10+17]
+  mov [r11+17], al
+  mov al, [r10+18]
+  mov [r11+18], al
+  mov al, [r10+19]
+  mov [r11+19], al
+  mov al, [r10+20]
+  mov [r11+20], al
+  mov al, [r10+21]
+  mov [r11+21], al
+  mov al, [r10+22]
+  mov [r11+22], al
+  mov al, [r10+23]
+  mov [r11+23], al
+  mov al, [r10+24]
+  mov [r11+24], al
+  mov al, [r10+25]
+  mov [r11+25], al
+  mov al, [r10+26]
+  mov [r11+26], al
+  mov al, [r10+27]
+  mov [r11+27], al
+  mov al, [r10+28]
+  mov [r11+28], al
+  mov al, [r10+29]
+  mov [r11+29], al
+  mov al, [r10+30]
+  mov [r11+30], al
+  mov al, [r10+31]
+  mov [r11+31], al
+  mov al, [r10+32]
+  mov [r11+32], al
+  mov al, [r10+33]
+  mov [r11+33], al
+  mov al, [r10+34]
+  mov [r11+34], al
+  mov al, [r10+35]
+  mov [r11+35], al
+  mov al, [r10+36]
+  mov [r11+36], al
+  mov al, [r10+37]
+  mov [r11+37], al
+  mov al, [r10+38]
+  mov [r11+38], al
+  mov al, [r10+39]
+  mov [r11+39], al
+  mov al, [r10+40]
+  mov [r11+40], al
+  mov al, [r10+41]
+  mov [r11+41], al
+  mov al, [r10+42]
+  mov [r11+42], al
+  mov al, [r10+43]
+  mov [r11+43], al
+  mov al, [r10+44]
+  mov [r11+44], al
+  mov al, [r10+45]
+  mov [r11+45], al
+  mov al, [r10+46]
+  mov [r11+46], al
+  mov al, [r10+47]
+  mov [r11+47], al
+.loc 1 1170 3
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.else.new_hideset.2
+.loc 1 1171 5
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  lea r11, [rbp-136]
+  mov r11, [r11]
+  add r11, 40
+  mov r11, [r11]
+  or r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+  jmp .L.end.new_hideset.2
+.L.else.new_hideset.2:
+.loc 1 1173 5
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+.loc 1 1174 5
+  movabs r10, 1
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  mov r12, 63
+  movsx r12, r12d
+  and r11, r12
+  mov rcx, r11
+  shl r10, cl
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.L.end.new_hideset.2:
+.loc 1 1176 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset hidesets
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-100]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_put2
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1177 3
+  mov r10, offset nr_hidesets
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+.loc 1 1178 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.new_hideset
+.L.return.new_hideset:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+new_leaf:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 1182 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset name_id
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_hideset
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.new_leaf
+.L.return.new_leaf:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+is_leaf:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 1186 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.is_leaf
+.L.return.is_leaf:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+mask_bits:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rsi
+  mov [rbp-48], rdi
+.loc 1 1191 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov r12, 1
+  movsx r12, r12d
+  sub r11, r12
+  and r10, r11
+  mov rax, r10
+  jmp .L.return.mask_bits
+.L.return.mask_bits:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+has_prefix:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdx
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 1195 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset mask_bits
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.has_prefix
+.L.return.has_prefix:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+join:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-56], rcx
+  mov [rbp-64], rdx
+  mov [rbp-72], rsi
+  mov [rbp-80], rdi
+.loc 1 1201 19
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  xor r10, r11
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1202 20
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r11, 0
+  movsx r11, r11d
+  lea r12, [rbp-48]
+  mov r12, [r12]
+  sub r11, r12
+  and r10, r11
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1203 3
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  and r10, r11
+  cmp r10, 0
+  je .L.end.join.1
+.loc 1 1204 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset mask_bits
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset new_hideset
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.join
+.L.end.join.1:
+.loc 1 1205 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset mask_bits
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset new_hideset
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.join
+.L.return.join:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+new_branch:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rcx
+  mov [rbp-48], rdx
+  mov [rbp-56], rsi
+  mov [rbp-64], rdi
+.loc 1 1211 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.new_branch.1
+.loc 1 1212 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.new_branch
+.L.end.new_branch.1:
+.loc 1 1213 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.new_branch.2
+.loc 1 1214 5
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.new_branch
+.L.end.new_branch.2:
+.loc 1 1215 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset new_hideset
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.new_branch
+.L.return.new_branch:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+find_hideset_op:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 128
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-112], rdx
+  mov [rbp-120], rsi
+  mov [rbp-124], edi
+.loc 1 1221 21
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-104]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-104]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-104]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-104]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-104]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.loc 1 1222 3
+  lea r10, [rbp-124]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  lea r11, [rbp-104]
+  add r11, 0
+  mov [r11], r10
+.loc 1 1223 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  lea r11, [rbp-104]
+  add r11, 8
+  mov [r11], r10
+.loc 1 1224 3
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  lea r11, [rbp-104]
+  add r11, 16
+  mov [r11], r10
+.loc 1 1225 52
+  movabs r10, 8
+  movabs r11, 8
+  mov r12, 2
+  movsx r12, r12d
+  imul r11, r12
+  add r10, r11
+  mov r10d, r10d
+  lea r11, [rbp-60]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1226 3
+  mov r10, offset nr_hideset_ops
+  lea r11, [rbp-56]
+  mov [r11], r10
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+.loc 1 1228 68
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset hideset_ops
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-104]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_get2
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1229 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.find_hideset_op.1
+.loc 1 1230 5
+  mov r10, offset nr_hideset_op_hits
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+.loc 1 1231 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.find_hideset_op
+.L.end.find_hideset_op.1:
+.loc 1 1234 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 40
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov [r11], r10
+.loc 1 1235 3
+  lea r10, [rbp-104]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov al, [r10+0]
+  mov [r11+0], al
+  mov al, [r10+1]
+  mov [r11+1], al
+  mov al, [r10+2]
+  mov [r11+2], al
+  mov al, [r10+3]
+  mov [r11+3], al
+  mov al, [r10+4]
+  mov [r11+4], al
+  mov al, [r10+5]
+  mov [r11+5], al
+  mov al, [r10+6]
+  mov [r11+6], al
+  mov al, [r10+7]
+  mov [r11+7], al
+  mov al, [r10+8]
+  mov [r11+8], al
+  mov al, [r10+9]
+  mov [r11+9], al
+  mov al, [r10+10]
+  mov [r11+10], al
+  mov al, [r10+11]
+  mov [r11+11], al
+  mov al, [r10+12]
+  mov [r11+12], al
+  mov al, [r10+13]
+  mov [r11+13], al
+  mov al, [r10+14]
+  mov [r11+14], al
+  mov al, [r10+15]
+  mov [r11+15], al
+  mov al, [r10+16]
+  mov [r11+16], al
+  mov al, [r10+17]
+  mov [r11+17], al
+  mov al, [r10+18]
+  mov [r11+18], al
+  mov al, [r10+19]
+  mov [r11+19], al
+  mov al, [r10+20]
+  mov [r11+20], al
+  mov al, [r10+21]
+  mov [r11+21], al
+  mov al, [r10+22]
+  mov [r11+22], al
+  mov al, [r10+23]
+  mov [r11+23], al
+  mov al, [r10+24]
+  mov [r11+24], al
+  mov al, [r10+25]
+  mov [r11+25], al
+  mov al, [r10+26]
+  mov [r11+26], al
+  mov al, [r10+27]
+  mov [r11+27], al
+  mov al, [r10+28]
+  mov [r11+28], al
+  mov al, [r10+29]
+  mov [r11+29], al
+  mov al, [r10+30]
+  mov [r11+30], al
+  mov al, [r10+31]
+  mov [r11+31], al
+  mov al, [r10+32]
+  mov [r11+32], al
+  mov al, [r10+33]
+  mov [r11+33], al
+  mov al, [r10+34]
+  mov [r11+34], al
+  mov al, [r10+35]
+  mov [r11+35], al
+  mov al, [r10+36]
+  mov [r11+36], al
+  mov al, [r10+37]
+  mov [r11+37], al
+  mov al, [r10+38]
+  mov [r11+38], al
+  mov al, [r10+39]
+  mov [r11+39], al
+.loc 1 1236 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset hideset_ops
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_put2
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1237 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.find_hideset_op
+.L.return.find_hideset_op:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+hideset_contains:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 1241 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.hideset_contains.2
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.hideset_contains.2
+  mov r10, 0
+  jmp .L.end.hideset_contains.2
+.L.true.hideset_contains.2:
+  mov r10, 1
+.L.end.hideset_contains.2:
+  cmp r10, 0
+  je .L.end.hideset_contains.1
+.loc 1 1242 5
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.hideset_contains
+.L.end.hideset_contains.1:
+.loc 1 1244 26
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset name_id
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1245 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  movabs r11, 1
+  lea r12, [rbp-40]
+  mov r12, [r12]
+  mov r13, 63
+  movsx r13, r13d
+  and r12, r13
+  mov rcx, r12
+  shl r11, cl
+  and r10, r11
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.hideset_contains.3
+.loc 1 1246 5
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.hideset_contains
+.L.end.hideset_contains.3:
+.loc 1 1248 3
+.L.begin.hideset_contains.4:
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_leaf
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.break.hideset_contains.4
+.loc 1 1249 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset has_prefix
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.hideset_contains.5
+.loc 1 1250 7
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.hideset_contains
+.L.end.hideset_contains.5:
+.loc 1 1251 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 24
+  mov r11, [r11]
+  and r10, r11
+  cmp r10, 0
+  je  .L.else.hideset_contains.6
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  jmp .L.end.hideset_contains.6
+.L.else.hideset_contains.6:
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+.L.end.hideset_contains.6:
+  lea r11, [rbp-56]
+  mov [r11], r10
+.L.continue.hideset_contains.4:
+  jmp .L.begin.hideset_contains.4
+.L.break.hideset_contains.4:
+.loc 1 1253 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.hideset_contains
+.L.return.hideset_contains:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+hideset_add:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 1257 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.hideset_add.1
+.loc 1 1258 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_leaf
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.hideset_add
+.L.end.hideset_add.1:
+.loc 1 1260 26
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset name_id
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1261 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_leaf
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.hideset_add.2
+.loc 1 1262 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.hideset_add.3
+.loc 1 1263 7
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.hideset_add
+.L.end.hideset_add.3:
+.loc 1 1264 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_leaf
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset join
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.hideset_add
+.L.end.hideset_add.2:
+.loc 1 1267 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset has_prefix
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.hideset_add.4
+.loc 1 1268 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_leaf
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset join
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.hideset_add
+.L.end.hideset_add.4:
+.loc 1 1269 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 24
+  mov r11, [r11]
+  and r10, r11
+  cmp r10, 0
+  je .L.end.hideset_add.5
+.loc 1 1270 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hideset_add
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+.loc 1 1271 28
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1270 12
+  mov r10, offset new_hideset
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.hideset_add
+.L.end.hideset_add.5:
+.loc 1 1272 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hideset_add
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+.loc 1 1273 26
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1272 10
+  mov r10, offset new_hideset
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.hideset_add
+.L.return.hideset_add:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+hideset_union:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-88], rsi
+  mov [rbp-96], rdi
+.loc 1 1277 3
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.hideset_union.2
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  jne .L.true.hideset_union.2
+  mov r10, 0
+  jmp .L.end.hideset_union.2
+.L.true.hideset_union.2:
+  mov r10, 1
+.L.end.hideset_union.2:
+  cmp r10, 0
+  je .L.end.hideset_union.1
+.loc 1 1278 5
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.hideset_union
+.L.end.hideset_union.1:
+.loc 1 1279 3
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.hideset_union.3
+.loc 1 1280 5
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.hideset_union
+.L.end.hideset_union.3:
+.loc 1 1282 55
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset find_hideset_op
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1283 3
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 32
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.hideset_union.4
+.loc 1 1284 5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.hideset_union
+.L.end.hideset_union.4:
+.loc 1 1286 23
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1287 20
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1288 23
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1289 20
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1290 14
+.loc 1 1292 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_leaf
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.else.hideset_union.5
+.loc 1 1293 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hideset_add
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+  jmp .L.end.hideset_union.5
+.L.else.hideset_union.5:
+.loc 1 1294 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_leaf
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.else.hideset_union.6
+.loc 1 1295 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hideset_add
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+  jmp .L.end.hideset_union.6
+.L.else.hideset_union.6:
+.loc 1 1296 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.hideset_union.8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.hideset_union.8
+  mov r10, 1
+  jmp .L.end.hideset_union.8
+.L.false.hideset_union.8:
+  mov r10, 0
+.L.end.hideset_union.8:
+  cmp r10, 0
+  je .L.else.hideset_union.7
+.loc 1 1297 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hideset_union
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+.loc 1 1298 35
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hideset_union
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+.loc 1 1297 10
+  mov r10, offset new_hideset
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+  jmp .L.end.hideset_union.7
+.L.else.hideset_union.7:
+.loc 1 1299 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.hideset_union.10
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset has_prefix
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.false.hideset_union.10
+  mov r10, 1
+  jmp .L.end.hideset_union.10
+.L.false.hideset_union.10:
+  mov r10, 0
+.L.end.hideset_union.10:
+  cmp r10, 0
+  je .L.else.hideset_union.9
+.loc 1 1300 5
+.loc 1 1301 7
+.loc 1 1300 13
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  and r10, r11
+  cmp r10, 0
+  je  .L.else.hideset_union.11
+.loc 1 1301 20
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hideset_union
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset new_hideset
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.hideset_union.11
+.L.else.hideset_union.11:
+.loc 1 1302 20
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hideset_union
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset new_hideset
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.hideset_union.11:
+  lea r11, [rbp-40]
+  mov [r11], r10
+  jmp .L.end.hideset_union.9
+.L.else.hideset_union.9:
+.loc 1 1303 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.hideset_union.13
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset has_prefix
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.false.hideset_union.13
+  mov r10, 1
+  jmp .L.end.hideset_union.13
+.L.false.hideset_union.13:
+  mov r10, 0
+.L.end.hideset_union.13:
+  cmp r10, 0
+  je .L.else.hideset_union.12
+.loc 1 1304 5
+.loc 1 1305 7
+.loc 1 1304 13
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  and r10, r11
+  cmp r10, 0
+  je  .L.else.hideset_union.14
+.loc 1 1305 20
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hideset_union
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset new_hideset
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.hideset_union.14
+.L.else.hideset_union.14:
+.loc 1 1306 20
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hideset_union
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset new_hideset
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.hideset_union.14:
+  lea r11, [rbp-40]
+  mov [r11], r10
+  jmp .L.end.hideset_union.12
+.L.else.hideset_union.12:
+.loc 1 1308 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset join
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.L.end.hideset_union.12:
+.L.end.hideset_union.9:
+.L.end.hideset_union.7:
+.L.end.hideset_union.6:
+.L.end.hideset_union.5:
+.loc 1 1310 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10
+.loc 1 1311 3
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10b
+.loc 1 1312 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.hideset_union
+.L.return.hideset_union:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+hideset_intersection:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-88], rsi
+  mov [rbp-96], rdi
+.loc 1 1316 3
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.hideset_intersection.3
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.hideset_intersection.3
+  mov r10, 0
+  jmp .L.end.hideset_intersection.3
+.L.true.hideset_intersection.3:
+  mov r10, 1
+.L.end.hideset_intersection.3:
+  cmp r10, 0
+  jne .L.true.hideset_intersection.2
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 40
+  mov r11, [r11]
+  and r10, r11
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.hideset_intersection.2
+  mov r10, 0
+  jmp .L.end.hideset_intersection.2
+.L.true.hideset_intersection.2:
+  mov r10, 1
+.L.end.hideset_intersection.2:
+  cmp r10, 0
+  je .L.end.hideset_intersection.1
+.loc 1 1317 5
+  mov r10, 0
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.hideset_intersection
+.L.end.hideset_intersection.1:
+.loc 1 1318 3
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.hideset_intersection.4
+.loc 1 1319 5
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.hideset_intersection
+.L.end.hideset_intersection.4:
+.loc 1 1320 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_leaf
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.hideset_intersection.5
+.loc 1 1321 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hideset_contains
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je  .L.else.hideset_intersection.6
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  jmp .L.end.hideset_intersection.6
+.L.else.hideset_intersection.6:
+  mov r10, 0
+  movsx r10, r10d
+.L.end.hideset_intersection.6:
+  mov rax, r10
+  jmp .L.return.hideset_intersection
+.L.end.hideset_intersection.5:
+.loc 1 1322 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_leaf
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.hideset_intersection.7
+.loc 1 1323 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hideset_contains
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je  .L.else.hideset_intersection.8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  jmp .L.end.hideset_intersection.8
+.L.else.hideset_intersection.8:
+  mov r10, 0
+  movsx r10, r10d
+.L.end.hideset_intersection.8:
+  mov rax, r10
+  jmp .L.return.hideset_intersection
+.L.end.hideset_intersection.7:
+.loc 1 1325 62
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset find_hideset_op
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1326 3
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 32
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.hideset_intersection.9
+.loc 1 1327 5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.hideset_intersection
+.L.end.hideset_intersection.9:
+.loc 1 1329 23
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1330 20
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1331 23
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1332 20
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1333 18
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1335 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.hideset_intersection.11
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.hideset_intersection.11
+  mov r10, 1
+  jmp .L.end.hideset_intersection.11
+.L.false.hideset_intersection.11:
+  mov r10, 0
+.L.end.hideset_intersection.11:
+  cmp r10, 0
+  je .L.else.hideset_intersection.10
+.loc 1 1336 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hideset_intersection
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+.loc 1 1337 41
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hideset_intersection
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+.loc 1 1336 10
+  mov r10, offset new_branch
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+  jmp .L.end.hideset_intersection.10
+.L.else.hideset_intersection.10:
+.loc 1 1338 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.hideset_intersection.13
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset has_prefix
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.false.hideset_intersection.13
+  mov r10, 1
+  jmp .L.end.hideset_intersection.13
+.L.false.hideset_intersection.13:
+  mov r10, 0
+.L.end.hideset_intersection.13:
+  cmp r10, 0
+  je .L.else.hideset_intersection.12
+.loc 1 1339 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  and r10, r11
+  cmp r10, 0
+  je  .L.else.hideset_intersection.14
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  jmp .L.end.hideset_intersection.14
+.L.else.hideset_intersection.14:
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+.L.end.hideset_intersection.14:
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hideset_intersection
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+  jmp .L.end.hideset_intersection.12
+.L.else.hideset_intersection.12:
+.loc 1 1340 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.hideset_intersection.16
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset has_prefix
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.false.hideset_intersection.16
+  mov r10, 1
+  jmp .L.end.hideset_intersection.16
+.L.false.hideset_intersection.16:
+  mov r10, 0
+.L.end.hideset_intersection.16:
+  cmp r10, 0
+  je .L.end.hideset_intersection.15
+.loc 1 1341 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  and r10, r11
+  cmp r10, 0
+  je  .L.else.hideset_intersection.17
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  jmp .L.end.hideset_intersection.17
+.L.else.hideset_intersection.17:
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+.L.end.hideset_intersection.17:
+  push r10
+  sub rsp, 8
+  mov r10, offset hideset_intersection
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.L.end.hideset_intersection.15:
+.L.end.hideset_intersection.12:
+.L.end.hideset_intersection.10:
+.loc 1 1343 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10
+.loc 1 1344 3
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10b
+.loc 1 1345 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.hideset_intersection
+.L.return.hideset_intersection:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+drop_tokens:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-52], esi
+  mov [rbp-64], rdi
+.loc 1 1351 3
+.L.begin.drop_tokens.1:
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.drop_tokens.1
+.loc 1 1352 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1353 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset free_token
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1354 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov [r11], r10
+.L.continue.drop_tokens.1:
+.loc 1 1351 17
+  lea r10, [rbp-52]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.drop_tokens.1
+.L.break.drop_tokens.1:
+.loc 1 1356 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.drop_tokens
+.L.return.drop_tokens:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+skip_cond_incl2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 1360 3
+.L.begin.skip_cond_incl2.1:
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.skip_cond_incl2.1
+.loc 1 1361 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_hash
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.false.skip_cond_incl2.3
+.loc 1 1362 62
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.skip_cond_incl2.5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 35
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.skip_cond_incl2.5
+  mov r10, 0
+  jmp .L.end.skip_cond_incl2.5
+.L.true.skip_cond_incl2.5:
+  mov r10, 1
+.L.end.skip_cond_incl2.5:
+  cmp r10, 0
+  jne .L.true.skip_cond_incl2.4
+.loc 1 1363 24
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 36
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.skip_cond_incl2.4
+  mov r10, 0
+  jmp .L.end.skip_cond_incl2.4
+.L.true.skip_cond_incl2.4:
+  mov r10, 1
+.L.end.skip_cond_incl2.4:
+  cmp r10, 0
+  je .L.false.skip_cond_incl2.3
+  mov r10, 1
+  jmp .L.end.skip_cond_incl2.3
+.L.false.skip_cond_incl2.3:
+  mov r10, 0
+.L.end.skip_cond_incl2.3:
+  cmp r10, 0
+  je .L.end.skip_cond_incl2.2
+.loc 1 1364 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset drop_tokens
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset skip_cond_incl2
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 1365 7
+  jmp .L.continue.skip_cond_incl2.1
+.L.end.skip_cond_incl2.2:
+.loc 1 1367 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_hash
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.false.skip_cond_incl2.7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 38
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.skip_cond_incl2.7
+  mov r10, 1
+  jmp .L.end.skip_cond_incl2.7
+.L.false.skip_cond_incl2.7:
+  mov r10, 0
+.L.end.skip_cond_incl2.7:
+  cmp r10, 0
+  je .L.end.skip_cond_incl2.6
+.loc 1 1368 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset drop_tokens
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.skip_cond_incl2
+.L.end.skip_cond_incl2.6:
+.loc 1 1369 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset drop_tokens
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.L.continue.skip_cond_incl2.1:
+  jmp .L.begin.skip_cond_incl2.1
+.L.break.skip_cond_incl2.1:
+.loc 1 1371 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.skip_cond_incl2
+.L.return.skip_cond_incl2:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+skip_cond_incl:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 1377 3
+.L.begin.skip_cond_incl.1:
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.skip_cond_incl.1
+.loc 1 1378 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_hash
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.false.skip_cond_incl.3
+.loc 1 1379 62
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.skip_cond_incl.5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 35
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.skip_cond_incl.5
+  mov r10, 0
+  jmp .L.end.skip_cond_incl.5
+.L.true.skip_cond_incl.5:
+  mov r10, 1
+.L.end.skip_cond_incl.5:
+  cmp r10, 0
+  jne .L.true.skip_cond_incl.4
+.loc 1 1380 24
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 36
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.skip_cond_incl.4
+  mov r10, 0
+  jmp .L.end.skip_cond_incl.4
+.L.true.skip_cond_incl.4:
+  mov r10, 1
+.L.end.skip_cond_incl.4:
+  cmp r10, 0
+  je .L.false.skip_cond_incl.3
+  mov r10, 1
+  jmp .L.end.skip_cond_incl.3
+.L.false.skip_cond_incl.3:
+  mov r10, 0
+.L.end.skip_cond_incl.3:
+  cmp r10, 0
+  je .L.end.skip_cond_incl.2
+.loc 1 1381 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset drop_tokens
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset skip_cond_incl2
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 1382 7
+  jmp .L.continue.skip_cond_incl.1
+.L.end.skip_cond_incl.2:
+.loc 1 1385 5
+.loc 1 1386 62
+.loc 1 1385 22
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_hash
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.false.skip_cond_incl.9
+.loc 1 1386 23
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 3
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.skip_cond_incl.9
+  mov r10, 1
+  jmp .L.end.skip_cond_incl.9
+.L.false.skip_cond_incl.9:
+  mov r10, 0
+.L.end.skip_cond_incl.9:
+  cmp r10, 0
+  jne .L.true.skip_cond_incl.8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 37
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.skip_cond_incl.8
+  mov r10, 0
+  jmp .L.end.skip_cond_incl.8
+.L.true.skip_cond_incl.8:
+  mov r10, 1
+.L.end.skip_cond_incl.8:
+  cmp r10, 0
+  jne .L.true.skip_cond_incl.7
+.loc 1 1387 23
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 38
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.skip_cond_incl.7
+  mov r10, 0
+  jmp .L.end.skip_cond_incl.7
+.L.true.skip_cond_incl.7:
+  mov r10, 1
+.L.end.skip_cond_incl.7:
+  cmp r10, 0
+  je .L.end.skip_cond_incl.6
+.loc 1 1388 7
+  jmp .L.break.skip_cond_incl.1
+.L.end.skip_cond_incl.6:
+.loc 1 1389 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset drop_tokens
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.L.continue.skip_cond_incl.1:
+  jmp .L.begin.skip_cond_incl.1
+.L.break.skip_cond_incl.1:
+.loc 1 1391 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.skip_cond_incl
+.L.return.skip_cond_incl:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+quote_string:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 144
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-144], rdi
+.loc 1 1396 18
+  mov r10, 3
+  mov r10d, r10d
+  lea r11, [rbp-136]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1397 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-132]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.quote_string.1:
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  lea r11, [rbp-132]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.break.quote_string.1
+.loc 1 1398 5
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  lea r11, [rbp-132]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 92
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.quote_string.3
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  lea r11, [rbp-132]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 34
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.quote_string.3
+  mov r10, 0
+  jmp .L.end.quote_string.3
+.L.true.quote_string.3:
+  mov r10, 1
+.L.end.quote_string.3:
+  cmp r10, 0
+  je .L.end.quote_string.2
+.loc 1 1399 7
+  lea r10, [rbp-136]
+  lea r11, [rbp-120]
+  mov [r11], r10
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-120]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.end.quote_string.2:
+.loc 1 1400 5
+  lea r10, [rbp-136]
+  lea r11, [rbp-112]
+  mov [r11], r10
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.continue.quote_string.1:
+.loc 1 1397 27
+  lea r10, [rbp-132]
+  lea r11, [rbp-128]
+  mov [r11], r10
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.quote_string.1
+.L.break.quote_string.1:
+.loc 1 1403 44
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 12
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-136]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-104]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1404 16
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  lea r11, [rbp-96]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1405 3
+  mov r10, 34
+  movsx r10, r10b
+  lea r11, [rbp-96]
+  lea r12, [rbp-88]
+  mov [r12], r11
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  mov r11, [r11]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  lea r12, [rbp-88]
+  mov r12, [r12]
+  mov [r12], r11
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  mov r11, [r11]
+  mov r12, -1
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.loc 1 1406 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-76]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.quote_string.4:
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.break.quote_string.4
+.loc 1 1407 5
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 92
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.quote_string.6
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 34
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.quote_string.6
+  mov r10, 0
+  jmp .L.end.quote_string.6
+.L.true.quote_string.6:
+  mov r10, 1
+.L.end.quote_string.6:
+  cmp r10, 0
+  je .L.end.quote_string.5
+.loc 1 1408 7
+  mov r10, 92
+  movsx r10, r10b
+  lea r11, [rbp-96]
+  lea r12, [rbp-64]
+  mov [r12], r11
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov r11, [r11]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  lea r12, [rbp-64]
+  mov r12, [r12]
+  mov [r12], r11
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov r11, [r11]
+  mov r12, -1
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.L.end.quote_string.5:
+.loc 1 1409 5
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10b
+  lea r11, [rbp-96]
+  lea r12, [rbp-56]
+  mov [r12], r11
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov r11, [r11]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  lea r12, [rbp-56]
+  mov r12, [r12]
+  mov [r12], r11
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov r11, [r11]
+  mov r12, -1
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.L.continue.quote_string.4:
+.loc 1 1406 27
+  lea r10, [rbp-76]
+  lea r11, [rbp-72]
+  mov [r11], r10
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.quote_string.4
+.L.break.quote_string.4:
+.loc 1 1411 3
+  mov r10, 34
+  movsx r10, r10b
+  lea r11, [rbp-96]
+  lea r12, [rbp-48]
+  mov [r12], r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov r11, [r11]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  lea r12, [rbp-48]
+  mov r12, [r12]
+  mov [r12], r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov r11, [r11]
+  mov r12, -1
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.loc 1 1412 3
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-96]
+  lea r12, [rbp-40]
+  mov [r12], r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov r11, [r11]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  lea r12, [rbp-40]
+  mov r12, [r12]
+  mov [r12], r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov r11, [r11]
+  mov r12, -1
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.loc 1 1413 3
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.quote_string
+.L.return.quote_string:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+new_str_token:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 1417 32
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset quote_string
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1418 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  add r10, 16
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset tokenize
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.new_str_token
+.L.return.new_str_token:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+copy_line:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 128
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-120], rsi
+  mov [rbp-128], rdi
+.loc 1 1425 18
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-112]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-112]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-112]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-112]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-112]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-112]
+  mov r12, 28
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-112]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-112]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-112]
+  mov r12, 48
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-112]
+  mov r12, 49
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-112]
+  mov r12, 50
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-112]
+  mov r12, 51
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-112]
+  mov r12, 56
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-112]
+  mov r12, 64
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1426 21
+  lea r10, [rbp-112]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1428 3
+.L.begin.copy_line.1:
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 48
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.break.copy_line.1
+.loc 1 1429 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset copy_token
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 1430 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset drop_tokens
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-120]
+  mov [r11], r10
+.L.continue.copy_line.1:
+  jmp .L.begin.copy_line.1
+.L.break.copy_line.1:
+.loc 1 1433 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_eof
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 1434 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1435 3
+  lea r10, [rbp-112]
+  add r10, 8
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.copy_line
+.L.return.copy_line:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+new_num_token:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-52], edi
+.loc 1 1439 39
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 12
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 20
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1440 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.4
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset sprintf
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1441 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  add r10, 16
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset tokenize
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.new_num_token
+.L.return.new_num_token:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+read_const_expr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 160
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-144], rsi
+  mov [rbp-152], rdi
+.loc 1 1445 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset copy_line
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-144]
+  mov [r11], r10
+.loc 1 1447 18
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-136]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-136]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-136]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-136]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-136]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-136]
+  mov r12, 28
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-136]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-136]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-136]
+  mov r12, 48
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-136]
+  mov r12, 49
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-136]
+  mov r12, 50
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-136]
+  mov r12, 51
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-136]
+  mov r12, 56
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-136]
+  mov r12, 64
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1448 21
+  lea r10, [rbp-136]
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1450 3
+.L.begin.read_const_expr.1:
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.read_const_expr.1
+.loc 1 1453 5
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 40
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.read_const_expr.2
+.loc 1 1454 7
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1455 59
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-144]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 65
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset consume
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-41]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.loc 1 1457 7
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.read_const_expr.3
+.loc 1 1458 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.5
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.read_const_expr.3:
+.loc 1 1459 33
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset find_macro
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1460 7
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-144]
+  mov [r11], r10
+.loc 1 1462 7
+  lea r10, [rbp-41]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.read_const_expr.4
+.loc 1 1463 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 66
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-144]
+  mov [r11], r10
+.L.end.read_const_expr.4:
+.loc 1 1465 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je  .L.else.read_const_expr.5
+  mov r10, 1
+  mov r10d, r10d
+  jmp .L.end.read_const_expr.5
+.L.else.read_const_expr.5:
+  mov r10, 0
+  mov r10d, r10d
+.L.end.read_const_expr.5:
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_num_token
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+  lea r11, [rbp-64]
+  mov [r11], r10
+.loc 1 1466 7
+  jmp .L.continue.read_const_expr.1
+.L.end.read_const_expr.2:
+.loc 1 1469 5
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+  lea r11, [rbp-64]
+  mov [r11], r10
+.loc 1 1470 5
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-144]
+  mov [r11], r10
+.L.continue.read_const_expr.1:
+  jmp .L.begin.read_const_expr.1
+.L.break.read_const_expr.1:
+.loc 1 1473 3
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 1474 3
+  lea r10, [rbp-136]
+  add r10, 8
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.read_const_expr
+.L.return.read_const_expr:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+eval_const_expr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-80], rsi
+  mov [rbp-88], rdi
+.loc 1 1479 43
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset read_const_expr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1480 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset preprocess
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-72]
+  mov [r11], r10
+.loc 1 1486 3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.eval_const_expr.1:
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.eval_const_expr.1
+.loc 1 1487 5
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.eval_const_expr.2
+.loc 1 1488 7
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1489 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_num_token
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov al, [r10+0]
+  mov [r11+0], al
+  mov al, [r10+1]
+  mov [r11+1], al
+  mov al, [r10+2]
+  mov [r11+2], al
+  mov al, [r10+3]
+  mov [r11+3], al
+  mov al, [r10+4]
+  mov [r11+4], al
+  mov al, [r10+5]
+  mov [r11+5], al
+  mov al, [r10+6]
+  mov [r11+6], al
+  mov al, [r10+7]
+  mov [r11+7], al
+  mov al, [r10+8]
+  mov [r11+8], al
+  mov al, [r10+9]
+  mov [r11+9], al
+  mov al, [r10+10]
+  mov [r11+10], al
+  mov al, [r10+11]
+  mov [r11+11], al
+  mov al, [r10+12]
+  mov [r11+12], al
+  mov al, [r10+13]
+  mov [r11+13], al
+  mov al, [r10+14]
+  mov [r11+14], al
+  mov al, [r10+15]
+  mov [r11+15], al
+  mov al, [r10+16]
+  mov [r11+16], al
+  mov al, [r10+17]
+  mov [r11+17], al
+  mov al, [r10+18]
+  mov [r11+18], al
+  mov al, [r10+19]
+  mov [r11+19], al
+  mov al, [r10+20]
+  mov [r11+20], al
+  mov al, [r10+21]
+  mov [r11+21], al
+  mov al, [r10+22]
+  mov [r11+22], al
+  mov al, [r10+23]
+  mov [r11+23], al
+  mov al, [r10+24]
+  mov [r11+24], al
+  mov al, [r10+25]
+  mov [r11+25], al
+  mov al, [r10+26]
+  mov [r11+26], al
+  mov al, [r10+27]
+  mov [r11+27], al
+  mov al, [r10+28]
+  mov [r11+28], al
+  mov al, [r10+29]
+  mov [r11+29], al
+  mov al, [r10+30]
+  mov [r11+30], al
+  mov al, [r10+31]
+  mov [r11+31], al
+  mov al, [r10+32]
+  mov [r11+32], al
+  mov al, [r10+33]
+  mov [r11+33], al
+  mov al, [r10+34]
+  mov [r11+34], al
+  mov al, [r10+35]
+  mov [r11+35], al
+  mov al, [r10+36]
+  mov [r11+36], al
+  mov al, [r10+37]
+  mov [r11+37], al
+  mov al, [r10+38]
+  mov [r11+38], al
+  mov al, [r10+39]
+  mov [r11+39], al
+  mov al, [r10+40]
+  mov [r11+40], al
+  mov al, [r10+41]
+  mov [r11+41], al
+  mov al, [r10+42]
+  mov [r11+42], al
+  mov al, [r10+43]
+  mov [r11+43], al
+  mov al, [r10+44]
+  mov [r11+44], al
+  mov al, [r10+45]
+  mov [r11+45], al
+  mov al, [r10+46]
+  mov [r11+46], al
+  mov al, [r10+47]
+  mov [r11+47], al
+  mov al, [r10+48]
+  mov [r11+48], al
+  mov al, [r10+49]
+  mov [r11+49], al
+  mov al, [r10+50]
+  mov [r11+50], al
+  mov al, [r10+51]
+  mov [r11+51], al
+  mov al, [r10+52]
+  mov [r11+52], al
+  mov al, [r10+53]
+  mov [r11+53], al
+  mov al, [r10+54]
+  mov [r11+54], al
+  mov al, [r10+55]
+  mov [r11+55], al
+  mov al, [r10+56]
+  mov [r11+56], al
+  mov al, [r10+57]
+  mov [r11+57], al
+  mov al, [r10+58]
+  mov [r11+58], al
+  mov al, [r10+59]
+  mov [r11+59], al
+  mov al, [r10+60]
+  mov [r11+60], al
+  mov al, [r10+61]
+  mov [r11+61], al
+  mov al, [r10+62]
+  mov [r11+62], al
+  mov al, [r10+63]
+  mov [r11+63], al
+  mov al, [r10+64]
+  mov [r11+64], al
+  mov al, [r10+65]
+  mov [r11+65], al
+  mov al, [r10+66]
+  mov [r11+66], al
+  mov al, [r10+67]
+  mov [r11+67], al
+  mov al, [r10+68]
+  mov [r11+68], al
+  mov al, [r10+69]
+  mov [r11+69], al
+  mov al, [r10+70]
+  mov [r11+70], al
+  mov al, [r10+71]
+  mov [r11+71], al
+.loc 1 1490 7
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.L.end.eval_const_expr.2:
+.L.continue.eval_const_expr.1:
+.loc 1 1486 44
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov [r11], r10
+  jmp .L.begin.eval_const_expr.1
+.L.break.eval_const_expr.1:
+.loc 1 1494 15
+.loc 1 1495 38
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset const_expr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1496 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.eval_const_expr.3
+.loc 1 1497 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.6
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.eval_const_expr.3:
+.loc 1 1498 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.eval_const_expr
+.L.return.eval_const_expr:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+push_cond_incl:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-41], sil
+  mov [rbp-56], rdi
+.loc 1 1502 55
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 56
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1503 3
+  mov r10, offset cond_incl
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 1504 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10d
+.loc 1 1505 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 1506 3
+  lea r10, [rbp-41]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10b
+.loc 1 1507 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, offset cond_incl
+  mov [r11], r10
+.loc 1 1508 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.push_cond_incl
+.L.return.push_cond_incl:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+find_macro:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 1512 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.find_macro.1
+.loc 1 1513 5
+  mov r10, 0
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.find_macro
+.L.end.find_macro.1:
+.loc 1 1514 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset macros
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 24
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_get2
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.find_macro
+.L.return.find_macro:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+add_macro:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdx
+  mov [rbp-49], sil
+  mov [rbp-64], rdi
+.loc 1 1518 48
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 40
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1519 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 1520 3
+  lea r10, [rbp-49]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10b
+.loc 1 1521 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10
+.loc 1 1522 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_leaf
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+.loc 1 1523 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset macros
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_put
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1524 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.add_macro
+.L.return.add_macro:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+read_macro_params:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-72], rsi
+  mov [rbp-80], rdi
+.loc 1 1528 23
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-64]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1529 26
+  lea r10, [rbp-64]
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1531 3
+.L.begin.read_macro_params.1:
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 66
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.read_macro_params.1
+.loc 1 1533 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  cmp r10, r11
+  setne al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.read_macro_params.2
+.loc 1 1534 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 72
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1535 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-72]
+  mov [r11], r10
+.L.end.read_macro_params.2:
+.loc 1 1538 5
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.read_macro_params.3
+.loc 1 1539 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.7
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.read_macro_params.3:
+.loc 1 1540 60
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 16
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1541 5
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 1542 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+  lea r11, [rbp-48]
+  mov [r11], r10
+.loc 1 1543 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-72]
+  mov [r11], r10
+.L.continue.read_macro_params.1:
+  jmp .L.begin.read_macro_params.1
+.L.break.read_macro_params.1:
+.loc 1 1545 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1546 3
+  lea r10, [rbp-64]
+  add r10, 0
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.read_macro_params
+.L.return.read_macro_params:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+read_macro_definition:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-64], rsi
+  mov [rbp-72], rdi
+.loc 1 1550 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.read_macro_definition.1
+.loc 1 1551 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.8
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.read_macro_definition.1:
+.loc 1 1552 25
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1553 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov [r11], r10
+.loc 1 1555 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 49
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.read_macro_definition.3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 65
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.read_macro_definition.3
+  mov r10, 1
+  jmp .L.end.read_macro_definition.3
+.L.false.read_macro_definition.3:
+  mov r10, 0
+.L.end.read_macro_definition.3:
+  cmp r10, 0
+  je .L.else.read_macro_definition.2
+.loc 1 1557 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset read_macro_params
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1558 56
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset copy_line
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset add_macro
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1559 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+  jmp .L.end.read_macro_definition.2
+.L.else.read_macro_definition.2:
+.loc 1 1562 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset copy_line
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset add_macro
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.read_macro_definition.2:
+.L.return.read_macro_definition:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+read_macro_arg_one:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-72], rsi
+  mov [rbp-80], rdi
+.loc 1 1567 56
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 32
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1568 3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 1569 16
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1571 3
+.L.begin.read_macro_arg_one.1:
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.read_macro_arg_one.2
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 72
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.read_macro_arg_one.3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 66
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.read_macro_arg_one.3
+  mov r10, 1
+  jmp .L.end.read_macro_arg_one.3
+.L.false.read_macro_arg_one.3:
+  mov r10, 0
+.L.end.read_macro_arg_one.3:
+  cmp r10, 0
+  jne .L.true.read_macro_arg_one.2
+  mov r10, 0
+  jmp .L.end.read_macro_arg_one.2
+.L.true.read_macro_arg_one.2:
+  mov r10, 1
+.L.end.read_macro_arg_one.2:
+  cmp r10, 0
+  je .L.break.read_macro_arg_one.1
+.loc 1 1572 5
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.read_macro_arg_one.4
+.loc 1 1573 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.9
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.read_macro_arg_one.4:
+.loc 1 1575 5
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 65
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.read_macro_arg_one.5
+.loc 1 1576 7
+  lea r10, [rbp-52]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.end.read_macro_arg_one.5:
+.loc 1 1578 5
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 66
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.read_macro_arg_one.6
+.loc 1 1579 7
+  lea r10, [rbp-52]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+.L.end.read_macro_arg_one.6:
+.loc 1 1581 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-72]
+  mov [r11], r10
+.L.continue.read_macro_arg_one.1:
+  jmp .L.begin.read_macro_arg_one.1
+.L.break.read_macro_arg_one.1:
+.loc 1 1584 3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10
+.loc 1 1585 3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1586 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.read_macro_arg_one
+.L.return.read_macro_arg_one:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+read_macro_args:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 112
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-96], rdx
+  mov [rbp-104], rsi
+  mov [rbp-112], rdi
+.loc 1 1590 21
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  lea r11, [rbp-88]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1591 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-104]
+  mov [r11], r10
+.loc 1 1593 21
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-80]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-80]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-80]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1594 24
+  lea r10, [rbp-80]
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1596 26
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1597 3
+.L.begin.read_macro_args.1:
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.read_macro_args.1
+.loc 1 1598 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  cmp r10, r11
+  setne al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.read_macro_args.2
+.loc 1 1599 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 72
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1600 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-104]
+  mov [r11], r10
+.L.end.read_macro_args.2:
+.loc 1 1602 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-104]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset read_macro_arg_one
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+  lea r11, [rbp-48]
+  mov [r11], r10
+.loc 1 1603 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.L.continue.read_macro_args.1:
+.loc 1 1597 14
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  jmp .L.begin.read_macro_args.1
+.L.break.read_macro_args.1:
+.loc 1 1606 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.read_macro_args.3
+.loc 1 1607 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.10
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.read_macro_args.3:
+.loc 1 1608 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 66
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset skip
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1609 3
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1610 3
+  lea r10, [rbp-80]
+  add r10, 0
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.read_macro_args
+.L.return.read_macro_args:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+find_arg:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 1617 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.find_arg.1:
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.find_arg.1
+.loc 1 1618 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.find_arg.2
+.loc 1 1619 7
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.find_arg
+.L.end.find_arg.2:
+.L.continue.find_arg.1:
+.loc 1 1617 33
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  jmp .L.begin.find_arg.1
+.L.break.find_arg.1:
+.loc 1 1620 3
+  mov r10, 0
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.find_arg
+.L.return.find_arg:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+join_tokens:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 128
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-112], rsi
+  mov [rbp-120], rdi
+.loc 1 1627 14
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-100]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1628 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  lea r11, [rbp-96]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.join_tokens.1:
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  cmp r10, r11
+  setne al
+  movzb r10, al
+  cmp r10, 0
+  je .L.break.join_tokens.1
+.loc 1 1629 5
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  lea r11, [rbp-120]
+  mov r11, [r11]
+  cmp r10, r11
+  setne al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.join_tokens.3
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 49
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.false.join_tokens.3
+  mov r10, 1
+  jmp .L.end.join_tokens.3
+.L.false.join_tokens.3:
+  mov r10, 0
+.L.end.join_tokens.3:
+  cmp r10, 0
+  je .L.end.join_tokens.2
+.loc 1 1630 7
+  lea r10, [rbp-100]
+  lea r11, [rbp-88]
+  mov [r11], r10
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.end.join_tokens.2:
+.loc 1 1631 5
+  lea r10, [rbp-100]
+  lea r11, [rbp-80]
+  mov [r11], r10
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-96]
+  mov r11, [r11]
+  add r11, 24
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  mov [r11], r10d
+.L.continue.join_tokens.1:
+.loc 1 1628 34
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-96]
+  mov [r11], r10
+  jmp .L.begin.join_tokens.1
+.L.break.join_tokens.1:
+.loc 1 1634 40
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 12
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-100]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1637 14
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-60]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1638 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.join_tokens.4:
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  cmp r10, r11
+  setne al
+  movzb r10, al
+  cmp r10, 0
+  je .L.break.join_tokens.4
+.loc 1 1639 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-120]
+  mov r11, [r11]
+  cmp r10, r11
+  setne al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.join_tokens.6
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 49
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.false.join_tokens.6
+  mov r10, 1
+  jmp .L.end.join_tokens.6
+.L.false.join_tokens.6:
+  mov r10, 0
+.L.end.join_tokens.6:
+  cmp r10, 0
+  je .L.end.join_tokens.5
+.loc 1 1640 7
+  mov r10, 32
+  movsx r10, r10b
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  lea r12, [rbp-60]
+  lea r13, [rbp-48]
+  mov [r13], r12
+  lea r12, [rbp-48]
+  mov r12, [r12]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  add r12d, r13d
+  mov r12d, r12d
+  lea r13, [rbp-48]
+  mov r13, [r13]
+  mov [r13], r12d
+  lea r12, [rbp-48]
+  mov r12, [r12]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, -1
+  mov r13d, r13d
+  add r12d, r13d
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.L.end.join_tokens.5:
+.loc 1 1641 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  lea r11, [rbp-60]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 24
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset strncpy
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1642 5
+  lea r10, [rbp-60]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 24
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+.L.continue.join_tokens.4:
+.loc 1 1638 34
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov [r11], r10
+  jmp .L.begin.join_tokens.4
+.L.break.join_tokens.4:
+.loc 1 1644 3
+  mov r10, 0
+  movsx r10, r10b
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  lea r12, [rbp-60]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.loc 1 1645 3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.join_tokens
+.L.return.join_tokens:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+stringize:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 1654 44
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset join_tokens
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1655 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_str_token
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.stringize
+.L.return.stringize:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+paste:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-56], rsi
+  mov [rbp-64], rdi
+.loc 1 1661 60
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 12
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 24
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 24
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1662 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.11
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 24
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 24
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset sprintf
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1665 66
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  add r10, 16
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset tokenize
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1666 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.paste.1
+.loc 1 1667 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.12
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.paste.1:
+.loc 1 1668 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.paste
+.L.return.paste:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+start_arg:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdx
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 1673 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  cmp r10, r11
+  setne al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.start_arg.1
+.loc 1 1674 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.loc 1 1675 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 48
+  mov [r11], r10
+.L.end.start_arg.1:
+.L.return.start_arg:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+read_subst:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-64], rsi
+  mov [rbp-72], rdi
+.loc 1 1684 3
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov [r11], r10b
+.loc 1 1686 3
+.L.begin.read_subst.1:
+.loc 1 1687 5
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.read_subst.2
+.loc 1 1688 7
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1689 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  add r11, 48
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je  .L.else.read_subst.3
+  mov r10, 0
+  movsx r10, r10d
+  jmp .L.end.read_subst.3
+.L.else.read_subst.3:
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.read_subst.3:
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.loc 1 1690 7
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.read_subst
+.L.end.read_subst.2:
+.loc 1 1693 25
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1694 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.read_subst.4
+.loc 1 1695 7
+  mov r10, 0
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.read_subst
+.L.end.read_subst.4:
+.loc 1 1696 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+.loc 1 1700 43
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset find_arg
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1701 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.read_subst.5
+.loc 1 1703 7
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 24
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.read_subst.7
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 64
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.read_subst.7
+  mov r10, 1
+  jmp .L.end.read_subst.7
+.L.false.read_subst.7:
+  mov r10, 0
+.L.end.read_subst.7:
+  cmp r10, 0
+  je .L.end.read_subst.6
+.loc 1 1704 9
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+.L.end.read_subst.6:
+.loc 1 1705 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset start_arg
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1706 7
+  jmp .L.continue.read_subst.1
+.L.end.read_subst.5:
+.loc 1 1710 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 89
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.read_subst.8
+.loc 1 1711 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset find_arg
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 1712 7
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.read_subst.9
+.loc 1 1713 9
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+.loc 1 1714 9
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov [r11], r10b
+.loc 1 1715 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset stringize
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.read_subst
+.L.end.read_subst.9:
+.L.end.read_subst.8:
+.loc 1 1718 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.read_subst
+.L.continue.read_subst.1:
+  jmp .L.begin.read_subst.1
+.L.break.read_subst.1:
+.L.return.read_subst:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+expand_next:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-72], rdi
+.loc 1 1725 15
+.loc 1 1726 38
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-57]
+  push r10
+  sub rsp, 8
+  mov r10, offset read_subst
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1727 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.expand_next.1
+.loc 1 1728 5
+  mov r10, 0
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.expand_next
+.L.end.expand_next.1:
+.loc 1 1732 3
+.L.begin.expand_next.2:
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  add r10, 8
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.expand_next.4
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.expand_next.4
+  mov r10, 1
+  jmp .L.end.expand_next.4
+.L.false.expand_next.4:
+  mov r10, 0
+.L.end.expand_next.4:
+  cmp r10, 0
+  je .L.false.expand_next.3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 64
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.expand_next.3
+  mov r10, 1
+  jmp .L.end.expand_next.3
+.L.false.expand_next.3:
+  mov r10, 0
+.L.end.expand_next.3:
+  cmp r10, 0
+  je .L.break.expand_next.2
+.loc 1 1733 5
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1734 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.expand_next.5
+.loc 1 1735 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.13
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.expand_next.5:
+.loc 1 1736 43
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset find_arg
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1737 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+.loc 1 1739 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.expand_next.6
+.loc 1 1740 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset paste
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov [r11], r10
+.loc 1 1741 7
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-57]
+  mov [r11], r10b
+.loc 1 1742 7
+  jmp .L.continue.expand_next.2
+.L.end.expand_next.6:
+.loc 1 1746 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 24
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.expand_next.7
+.loc 1 1747 7
+  jmp .L.continue.expand_next.2
+.L.end.expand_next.7:
+.loc 1 1749 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset paste
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov [r11], r10
+.loc 1 1750 5
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-57]
+  mov [r11], r10b
+.loc 1 1751 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset start_arg
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.expand_next.2:
+  jmp .L.begin.expand_next.2
+.L.break.expand_next.2:
+.loc 1 1754 3
+  lea r10, [rbp-57]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.expand_next.8
+.loc 1 1755 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset copy_token
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov [r11], r10
+.L.end.expand_next.8:
+.loc 1 1756 3
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 1758 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  add r11, 72
+  mov r11, [r11]
+  cmp r10, r11
+  setne al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.expand_next.9
+.loc 1 1759 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  add r11, 72
+  mov [r11], r10
+.loc 1 1760 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hideset_union
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  add r11, 80
+  mov [r11], r10
+.L.end.expand_next.9:
+.loc 1 1762 3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 80
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.loc 1 1763 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.expand_next
+.L.return.expand_next:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+start_expansion:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rcx
+  mov [rbp-56], rdx
+  mov [rbp-64], rsi
+  mov [rbp-72], rdi
+.loc 1 1770 33
+  mov r10, offset free_expansions
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1771 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.else.start_expansion.1
+.loc 1 1772 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  mov r11, offset free_expansions
+  mov [r11], r10
+  jmp .L.end.start_expansion.1
+.L.else.start_expansion.1:
+.loc 1 1774 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 88
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.L.end.start_expansion.1:
+.loc 1 1776 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 88
+  push r10
+  sub rsp, 8
+  mov r10, offset memset
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1777 3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 1778 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 1779 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10
+.loc 1 1780 3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+.loc 1 1781 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 64
+  mov [r11], r10
+.loc 1 1782 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 80
+  mov [r11], r10
+.loc 1 1784 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset expand_next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 56
+  mov [r11], r10
+.loc 1 1785 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.start_expansion.2
+.loc 1 1786 5
+  mov r10, offset free_expansions
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 1787 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, offset free_expansions
+  mov [r11], r10
+.loc 1 1788 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.start_expansion
+.L.end.start_expansion.2:
+.loc 1 1790 3
+  mov r10, offset expansions
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 1791 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, offset expansions
+  mov [r11], r10
+.loc 1 1792 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.start_expansion
+.L.return.start_expansion:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+next:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-72], rdi
+.loc 1 1801 23
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1802 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.next.2
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.next.3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 51
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.next.3
+  mov r10, 0
+  jmp .L.end.next.3
+.L.true.next.3:
+  mov r10, 1
+.L.end.next.3:
+  cmp r10, 0
+  je .L.false.next.2
+  mov r10, 1
+  jmp .L.end.next.2
+.L.false.next.2:
+  mov r10, 0
+.L.end.next.2:
+  cmp r10, 0
+  je .L.end.next.1
+.loc 1 1803 5
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.next
+.L.end.next.1:
+.loc 1 1805 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.next.4
+.loc 1 1806 5
+  mov r10, offset includes
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.next.5:
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.next.5
+.loc 1 1807 7
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 72
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.next.6
+.loc 1 1808 9
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 80
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.next
+.L.end.next.6:
+.L.continue.next.5:
+.loc 1 1806 39
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 88
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov [r11], r10
+  jmp .L.begin.next.5
+.L.break.next.5:
+.loc 1 1809 5
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.next
+.L.end.next.4:
+.loc 1 1812 3
+  mov r10, offset expansions
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.next.7:
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.next.7
+.loc 1 1813 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1814 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  cmp r10, r11
+  setne al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.next.8
+.loc 1 1815 7
+  jmp .L.continue.next.7
+.L.end.next.8:
+.loc 1 1817 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset expand_next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 1818 5
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.next.9
+.loc 1 1819 7
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 56
+  mov [r11], r10
+.loc 1 1820 7
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.next
+.L.end.next.9:
+.loc 1 1824 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 64
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 1825 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1826 5
+  mov r10, offset free_expansions
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 1827 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, offset free_expansions
+  mov [r11], r10
+.loc 1 1828 5
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.next
+.L.continue.next.7:
+.loc 1 1812 43
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  add r10, 0
+  lea r11, [rbp-48]
+  mov [r11], r10
+  jmp .L.begin.next.7
+.L.break.next.7:
+.loc 1 1830 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next_token
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.next
+.L.return.next:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+expand_macro:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-88], rsi
+  mov [rbp-96], rdi
+.loc 1 1834 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hideset_contains
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.expand_macro.1
+.loc 1 1835 5
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.expand_macro
+.L.end.expand_macro.1:
+.loc 1 1837 29
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset find_macro
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1838 3
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.expand_macro.2
+.loc 1 1839 5
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.expand_macro
+.L.end.expand_macro.2:
+.loc 1 1842 3
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 8
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.expand_macro.3
+.loc 1 1843 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hideset_union
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1844 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset start_expansion
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-96]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1845 5
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.expand_macro
+.L.end.expand_macro.3:
+.loc 1 1850 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 65
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.expand_macro.4
+.loc 1 1851 5
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.expand_macro
+.L.end.expand_macro.4:
+.loc 1 1854 27
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1855 57
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset read_macro_args
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1856 22
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1864 76
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hideset_intersection
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1865 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hideset_union
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 1867 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset start_expansion
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-96]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1868 3
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.expand_macro
+.L.return.expand_macro:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+preprocess:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 272
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-272], rdi
+.loc 1 1874 18
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-264]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-264]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-264]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-264]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-264]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-264]
+  mov r12, 28
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-264]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-264]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-264]
+  mov r12, 48
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-264]
+  mov r12, 49
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-264]
+  mov r12, 50
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-264]
+  mov r12, 51
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-264]
+  mov r12, 56
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-264]
+  mov r12, 64
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1875 21
+  lea r10, [rbp-264]
+  lea r11, [rbp-192]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1877 3
+.L.begin.preprocess.1:
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.preprocess.1
+.loc 1 1879 5
+.L.begin.preprocess.2:
+  mov r10, offset includes
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.preprocess.3
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  mov r11, offset includes
+  mov r11, [r11]
+  add r11, 80
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.preprocess.3
+  mov r10, 1
+  jmp .L.end.preprocess.3
+.L.false.preprocess.3:
+  mov r10, 0
+.L.end.preprocess.3:
+  cmp r10, 0
+  je .L.break.preprocess.2
+.loc 1 1880 7
+  mov r10, 0
+  movsx r10, r10d
+  mov r11, offset includes
+  mov r11, [r11]
+  add r11, 80
+  mov [r11], r10
+.loc 1 1881 7
+  mov r10, offset includes
+  mov r10, [r10]
+  add r10, 88
+  mov r10, [r10]
+  mov r11, offset includes
+  mov [r11], r10
+.L.continue.preprocess.2:
+  jmp .L.begin.preprocess.2
+.L.break.preprocess.2:
+.loc 1 1885 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset expand_macro
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.preprocess.4
+.loc 1 1886 7
+  jmp .L.continue.preprocess.1
+.L.end.preprocess.4:
+.loc 1 1889 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_hash
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.preprocess.5
+.loc 1 1890 7
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  add r10, 51
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je  .L.else.preprocess.6
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset copy_token
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.preprocess.6
+.L.else.preprocess.6:
+  lea r10, [rbp-272]
+  mov r10, [r10]
+.L.end.preprocess.6:
+  lea r11, [rbp-192]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+  lea r11, [rbp-192]
+  mov [r11], r10
+.loc 1 1891 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov [r11], r10
+.loc 1 1892 7
+  jmp .L.continue.preprocess.1
+.L.end.preprocess.5:
+.loc 1 1895 23
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  lea r11, [rbp-184]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1896 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov [r11], r10
+.loc 1 1898 5
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 32
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.preprocess.7
+.loc 1 1899 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-176]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1900 7
+  lea r10, [rbp-176]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.preprocess.8
+.loc 1 1901 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-176]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.14
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.preprocess.8:
+.loc 1 1903 71
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-176]
+  mov r10, [r10]
+  add r10, 64
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-176]
+  mov r10, [r10]
+  add r10, 64
+  mov r10, [r10]
+  add r10, 24
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_str
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-168]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1904 42
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-176]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset skip_line
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-160]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1905 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-184]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset free_token
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1906 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset free_token
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1911 41
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_file_info
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-152]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1912 7
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.preprocess.10
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  add r10, 40
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  jne .L.true.preprocess.11
+.loc 1 1913 29
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  add r10, 48
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.preprocess.12
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset macros
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  add r10, 48
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_get
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.false.preprocess.12
+  mov r10, 1
+  jmp .L.end.preprocess.12
+.L.false.preprocess.12:
+  mov r10, 0
+.L.end.preprocess.12:
+  cmp r10, 0
+  jne .L.true.preprocess.11
+  mov r10, 0
+  jmp .L.end.preprocess.11
+.L.true.preprocess.11:
+  mov r10, 1
+.L.end.preprocess.11:
+  cmp r10, 0
+  je .L.false.preprocess.10
+  mov r10, 1
+  jmp .L.end.preprocess.10
+.L.false.preprocess.10:
+  mov r10, 0
+.L.end.preprocess.10:
+  cmp r10, 0
+  je .L.end.preprocess.9
+.loc 1 1914 9
+  mov r10, offset nr_skipped_includes
+  lea r11, [rbp-144]
+  mov [r11], r10
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-144]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+.loc 1 1915 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-176]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset free_token
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1916 9
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  lea r11, [rbp-272]
+  mov [r11], r10
+.loc 1 1917 9
+  jmp .L.continue.preprocess.1
+.L.end.preprocess.9:
+.loc 1 1920 46
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset tokenize_file
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-136]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1921 7
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.preprocess.13
+.loc 1 1922 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-176]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.15
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset __errno_location
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset strerror
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.preprocess.13:
+.loc 1 1923 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-176]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset free_token
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1925 7
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.preprocess.16
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset is_hash
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.false.preprocess.16
+  mov r10, 1
+  jmp .L.end.preprocess.16
+.L.false.preprocess.16:
+  mov r10, 0
+.L.end.preprocess.16:
+  cmp r10, 0
+  je .L.false.preprocess.15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 36
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.preprocess.15
+  mov r10, 1
+  jmp .L.end.preprocess.15
+.L.false.preprocess.15:
+  mov r10, 0
+.L.end.preprocess.15:
+  cmp r10, 0
+  je .L.end.preprocess.14
+.loc 1 1926 9
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  mov r11, offset guard_start
+  mov [r11], r10
+.loc 1 1927 9
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  mov r11, offset guard_file
+  mov [r11], r10
+.loc 1 1928 9
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  mov r11, offset guard_end
+  mov [r11], r10
+.L.end.preprocess.14:
+.loc 1 1930 7
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  lea r11, [rbp-272]
+  mov [r11], r10
+.loc 1 1931 7
+  jmp .L.continue.preprocess.1
+.L.end.preprocess.7:
+.loc 1 1934 5
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 33
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.preprocess.17
+.loc 1 1935 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-184]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset drop_tokens
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset read_macro_definition
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1936 7
+  jmp .L.continue.preprocess.1
+.L.end.preprocess.17:
+.loc 1 1939 5
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 34
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.preprocess.18
+.loc 1 1940 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-184]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset drop_tokens
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov [r11], r10
+.loc 1 1941 7
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.preprocess.19
+.loc 1 1942 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.16
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.preprocess.19:
+.loc 1 1943 29
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  lea r11, [rbp-128]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1944 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset drop_tokens
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset skip_line
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov [r11], r10
+.loc 1 1945 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset macros
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_delete
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1946 7
+  jmp .L.continue.preprocess.1
+.L.end.preprocess.18:
+.loc 1 1949 5
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.preprocess.20
+.loc 1 1950 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset eval_const_expr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-120]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1951 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-184]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset push_cond_incl
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1952 7
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.preprocess.21
+.loc 1 1953 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset skip_cond_incl
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov [r11], r10
+.L.end.preprocess.21:
+.loc 1 1954 7
+  jmp .L.continue.preprocess.1
+.L.end.preprocess.20:
+.loc 1 1957 5
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 35
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.preprocess.22
+.loc 1 1958 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset find_macro
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-105]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.loc 1 1959 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-105]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset push_cond_incl
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1960 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset skip_line
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov [r11], r10
+.loc 1 1961 7
+  lea r10, [rbp-105]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.preprocess.23
+.loc 1 1962 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset skip_cond_incl
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov [r11], r10
+.L.end.preprocess.23:
+.loc 1 1963 7
+  jmp .L.continue.preprocess.1
+.L.end.preprocess.22:
+.loc 1 1966 5
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 36
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.preprocess.24
+.loc 1 1967 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-104]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1968 39
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset find_macro
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-89]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.loc 1 1969 51
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-89]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset push_cond_incl
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-88]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1970 7
+  lea r10, [rbp-184]
+  mov r10, [r10]
+  mov r11, offset guard_start
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.preprocess.26
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.preprocess.26
+  mov r10, 1
+  jmp .L.end.preprocess.26
+.L.false.preprocess.26:
+  mov r10, 0
+.L.end.preprocess.26:
+  cmp r10, 0
+  je .L.end.preprocess.25
+.loc 1 1971 9
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+.loc 1 1972 9
+  mov r10, offset guard_file
+  mov r10, [r10]
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.loc 1 1973 9
+  mov r10, offset guard_end
+  mov r10, [r10]
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  add r11, 48
+  mov [r11], r10
+.L.end.preprocess.25:
+.loc 1 1975 7
+  mov r10, 0
+  movsx r10, r10d
+  mov r11, offset guard_start
+  mov [r11], r10
+.loc 1 1976 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset skip_line
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov [r11], r10
+.loc 1 1977 7
+  lea r10, [rbp-89]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.preprocess.27
+.loc 1 1978 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset skip_cond_incl
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov [r11], r10
+.L.end.preprocess.27:
+.loc 1 1979 7
+  jmp .L.continue.preprocess.1
+.L.end.preprocess.24:
+.loc 1 1982 5
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 3
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.preprocess.28
+.loc 1 1983 7
+  mov r10, offset cond_incl
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.preprocess.30
+  mov r10, offset cond_incl
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.preprocess.30
+  mov r10, 0
+  jmp .L.end.preprocess.30
+.L.true.preprocess.30:
+  mov r10, 1
+.L.end.preprocess.30:
+  cmp r10, 0
+  je .L.end.preprocess.29
+.loc 1 1984 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-184]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.17
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.preprocess.29:
+.loc 1 1985 7
+  mov r10, 1
+  mov r10d, r10d
+  mov r11, offset cond_incl
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10d
+.loc 1 1986 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-184]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset drop_tokens
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset skip_line
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov [r11], r10
+.loc 1 1988 7
+  mov r10, offset cond_incl
+  mov r10, [r10]
+  add r10, 24
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.preprocess.31
+.loc 1 1989 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset skip_cond_incl
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov [r11], r10
+.L.end.preprocess.31:
+.loc 1 1990 7
+  jmp .L.continue.preprocess.1
+.L.end.preprocess.28:
+.loc 1 1993 5
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 37
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.preprocess.32
+.loc 1 1994 7
+  mov r10, offset cond_incl
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.preprocess.34
+  mov r10, offset cond_incl
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.preprocess.34
+  mov r10, 0
+  jmp .L.end.preprocess.34
+.L.true.preprocess.34:
+  mov r10, 1
+.L.end.preprocess.34:
+  cmp r10, 0
+  je .L.end.preprocess.33
+.loc 1 1995 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-184]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.18
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.preprocess.33:
+.loc 1 1996 7
+  mov r10, 2
+  mov r10d, r10d
+  mov r11, offset cond_incl
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10d
+.loc 1 1998 7
+  mov r10, offset cond_incl
+  mov r10, [r10]
+  add r10, 24
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.preprocess.36
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset next
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset eval_const_expr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.false.preprocess.36
+  mov r10, 1
+  jmp .L.end.preprocess.36
+.L.false.preprocess.36:
+  mov r10, 0
+.L.end.preprocess.36:
+  cmp r10, 0
+  je .L.else.preprocess.35
+.loc 1 1999 9
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov r11, offset cond_incl
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10b
+  jmp .L.end.preprocess.35
+.L.else.preprocess.35:
+.loc 1 2001 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset skip_cond_incl
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov [r11], r10
+.L.end.preprocess.35:
+.loc 1 2002 7
+  jmp .L.continue.preprocess.1
+.L.end.preprocess.32:
+.loc 1 2005 5
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 38
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.preprocess.37
+.loc 1 2006 7
+  mov r10, offset cond_incl
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.preprocess.38
+.loc 1 2007 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-184]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.19
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.preprocess.38:
+.loc 1 2008 31
+  mov r10, offset cond_incl
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2009 7
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  mov r11, offset cond_incl
+  mov [r11], r10
+.loc 1 2010 55
+  lea r10, [rbp-184]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 16
+  mov r11, [r11]
+  add r11, 56
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-65]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.loc 1 2011 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-184]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset drop_tokens
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset skip_line
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov [r11], r10
+.loc 1 2013 7
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.preprocess.42
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.preprocess.42
+  mov r10, 1
+  jmp .L.end.preprocess.42
+.L.false.preprocess.42:
+  mov r10, 0
+.L.end.preprocess.42:
+  cmp r10, 0
+  je .L.false.preprocess.41
+  lea r10, [rbp-65]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.false.preprocess.41
+  mov r10, 1
+  jmp .L.end.preprocess.41
+.L.false.preprocess.41:
+  mov r10, 0
+.L.end.preprocess.41:
+  cmp r10, 0
+  je .L.false.preprocess.40
+.loc 1 2014 15
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 48
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.false.preprocess.40
+  mov r10, 1
+  jmp .L.end.preprocess.40
+.L.false.preprocess.40:
+  mov r10, 0
+.L.end.preprocess.40:
+  cmp r10, 0
+  je .L.end.preprocess.39
+.loc 1 2015 9
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  add r10, 48
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.preprocess.43
+.loc 1 2016 11
+  mov r10, offset nr_include_guards
+  lea r11, [rbp-64]
+  mov [r11], r10
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.end.preprocess.43:
+.loc 1 2017 9
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 40
+  mov r11, [r11]
+  add r11, 48
+  mov [r11], r10
+.L.end.preprocess.39:
+.loc 1 2019 7
+  jmp .L.continue.preprocess.1
+.L.end.preprocess.37:
+.loc 1 2022 5
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 39
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.preprocess.44
+.loc 1 2023 7
+  lea r10, [rbp-184]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2024 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-184]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset drop_tokens
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov [r11], r10
+.loc 1 2026 7
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  add r10, 48
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.preprocess.46
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 41
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.preprocess.46
+  mov r10, 1
+  jmp .L.end.preprocess.46
+.L.false.preprocess.46:
+  mov r10, 0
+.L.end.preprocess.46:
+  cmp r10, 0
+  je .L.end.preprocess.45
+.loc 1 2027 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_file_info
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2028 9
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.false.preprocess.48
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 40
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.preprocess.48
+  mov r10, 1
+  jmp .L.end.preprocess.48
+.L.false.preprocess.48:
+  mov r10, 0
+.L.end.preprocess.48:
+  cmp r10, 0
+  je .L.end.preprocess.47
+.loc 1 2029 11
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10b
+.loc 1 2030 11
+  mov r10, offset nr_pragma_once
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.end.preprocess.47:
+.loc 1 2032 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset drop_tokens
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset skip_line
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov [r11], r10
+.loc 1 2033 9
+  jmp .L.continue.preprocess.1
+.L.end.preprocess.45:
+.loc 1 2037 7
+.L.begin.preprocess.49:
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.false.preprocess.50
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  add r10, 48
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.preprocess.50
+  mov r10, 1
+  jmp .L.end.preprocess.50
+.L.false.preprocess.50:
+  mov r10, 0
+.L.end.preprocess.50:
+  cmp r10, 0
+  je .L.break.preprocess.49
+.loc 1 2038 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset drop_tokens
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov [r11], r10
+.L.continue.preprocess.49:
+  jmp .L.begin.preprocess.49
+.L.break.preprocess.49:
+.loc 1 2039 7
+  jmp .L.continue.preprocess.1
+.L.end.preprocess.44:
+.loc 1 2043 5
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  add r10, 48
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.preprocess.51
+.loc 1 2044 7
+  jmp .L.continue.preprocess.1
+.L.end.preprocess.51:
+.loc 1 2046 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.20
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.preprocess.1:
+  jmp .L.begin.preprocess.1
+.L.break.preprocess.1:
+.loc 1 2049 3
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  lea r11, [rbp-192]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 2050 3
+  lea r10, [rbp-264]
+  add r10, 8
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.preprocess
+.L.return.preprocess:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl save_file_ids
+save_file_ids:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 112
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 2056 13
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-104]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2057 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-92]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.save_file_ids.1:
+  lea r10, [rbp-92]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, offset file_paths
+  add r11, 8
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.save_file_ids.1
+.loc 1 2058 5
+  mov r10, offset file_paths
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-92]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 24
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 16
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.save_file_ids.2
+.loc 1 2059 7
+  lea r10, [rbp-104]
+  lea r11, [rbp-80]
+  mov [r11], r10
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+.L.end.save_file_ids.2:
+.L.continue.save_file_ids.1:
+.loc 1 2057 44
+  lea r10, [rbp-92]
+  lea r11, [rbp-88]
+  mov [r11], r10
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.save_file_ids.1
+.L.break.save_file_ids.1:
+.loc 1 2060 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2062 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-68]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.save_file_ids.3:
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, offset file_paths
+  add r11, 8
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.save_file_ids.3
+.loc 1 2063 5
+  mov r10, offset file_paths
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-68]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 24
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2064 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.save_file_ids.4
+.loc 1 2065 7
+  jmp .L.continue.save_file_ids.3
+.L.end.save_file_ids.4:
+.loc 1 2069 43
+  mov r10, offset file_paths
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-68]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 24
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2070 35
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset realpath
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2071 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.save_file_ids.5
+.loc 1 2072 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strlen
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_str
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov [r11], r10
+.loc 1 2073 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset free
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.save_file_ids.5:
+.loc 1 2075 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_str
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2077 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2078 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2079 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2080 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2081 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.save_file_ids.3:
+.loc 1 2062 44
+  lea r10, [rbp-68]
+  lea r11, [rbp-64]
+  mov [r11], r10
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.save_file_ids.3
+.L.break.save_file_ids.3:
+.L.return.save_file_ids:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl load_file_ids
+load_file_ids:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 144
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 2088 20
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-144]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2089 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-136]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.load_file_ids.1:
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-136]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.break.load_file_ids.1
+.loc 1 2090 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_str
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-120]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2091 19
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-112]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-112]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-112]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-112]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-112]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2092 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-112]
+  add r11, 0
+  mov [r11], r10
+.loc 1 2093 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-112]
+  add r11, 8
+  mov [r11], r10
+.loc 1 2094 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-112]
+  add r11, 16
+  mov [r11], r10
+.loc 1 2095 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-112]
+  add r11, 24
+  mov [r11], r10
+.loc 1 2096 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-112]
+  add r11, 32
+  mov [r11], r10
+.loc 1 2098 15
+.loc 1 2099 5
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.load_file_ids.3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_file_id
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.load_file_ids.4
+.loc 1 2100 28
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-112]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  push r10
+  sub rsp, 8
+  movabs r10, 40
+  push r10
+  sub rsp, 8
+  mov r10, offset memcmp
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  jne .L.true.load_file_ids.4
+  mov r10, 0
+  jmp .L.end.load_file_ids.4
+.L.true.load_file_ids.4:
+  mov r10, 1
+.L.end.load_file_ids.4:
+  cmp r10, 0
+  je .L.false.load_file_ids.3
+  mov r10, 1
+  jmp .L.end.load_file_ids.3
+.L.false.load_file_ids.3:
+  mov r10, 0
+.L.end.load_file_ids.3:
+  cmp r10, 0
+  je .L.end.load_file_ids.2
+.loc 1 2101 7
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  lea r11, [rbp-144]
+  mov [r11], r10
+.L.end.load_file_ids.2:
+.L.continue.load_file_ids.1:
+.loc 1 2089 40
+  lea r10, [rbp-136]
+  lea r11, [rbp-128]
+  mov [r11], r10
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  jmp .L.begin.load_file_ids.1
+.L.break.load_file_ids.1:
+.loc 1 2103 3
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.load_file_ids
+.L.return.load_file_ids:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl save_macros
+save_macros:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 128
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 2108 13
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-120]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2109 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-108]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.save_macros.1:
+  lea r10, [rbp-108]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, offset macros
+  add r11, 8
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.save_macros.1
+.loc 1 2110 5
+  mov r10, offset macros
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-108]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 24
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 16
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.save_macros.2
+.loc 1 2111 7
+  lea r10, [rbp-120]
+  lea r11, [rbp-96]
+  mov [r11], r10
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-96]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+.L.end.save_macros.2:
+.L.continue.save_macros.1:
+.loc 1 2109 40
+  lea r10, [rbp-108]
+  lea r11, [rbp-104]
+  mov [r11], r10
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.save_macros.1
+.L.break.save_macros.1:
+.loc 1 2112 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2114 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-84]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.save_macros.3:
+  lea r10, [rbp-84]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, offset macros
+  add r11, 8
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.save_macros.3
+.loc 1 2115 5
+  mov r10, offset macros
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-84]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 24
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2116 5
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.save_macros.4
+.loc 1 2117 7
+  jmp .L.continue.save_macros.3
+.L.end.save_macros.4:
+.loc 1 2118 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_str
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2119 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 8
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2120 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_tokens
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2122 21
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2123 5
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.save_macros.5:
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.save_macros.5
+.loc 1 2124 7
+  lea r10, [rbp-64]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+.L.continue.save_macros.5:
+.loc 1 2123 42
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov [r11], r10
+  jmp .L.begin.save_macros.5
+.L.break.save_macros.5:
+.loc 1 2125 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_long
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2126 5
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.save_macros.6:
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.save_macros.6
+.loc 1 2127 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pch_put_str
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.save_macros.6:
+.loc 1 2126 42
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  jmp .L.begin.save_macros.6
+.L.break.save_macros.6:
+.L.continue.save_macros.3:
+.loc 1 2114 40
+  lea r10, [rbp-84]
+  lea r11, [rbp-80]
+  mov [r11], r10
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.save_macros.3
+.L.break.save_macros.3:
+.L.return.save_macros:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl load_macros
+load_macros:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 112
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 2133 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-112]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.load_macros.1:
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.break.load_macros.1
+.loc 1 2134 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_name
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-96]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2135 38
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-81]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.loc 1 2136 61
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-81]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_tokens
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset add_macro
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2138 25
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-72]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2139 28
+  lea r10, [rbp-72]
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2140 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_long
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.load_macros.2:
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.break.load_macros.2
+.loc 1 2141 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 16
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+  lea r11, [rbp-56]
+  mov [r11], r10
+.loc 1 2142 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset pch_get_name
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.L.continue.load_macros.2:
+.loc 1 2140 42
+  lea r10, [rbp-48]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  jmp .L.begin.load_macros.2
+.L.break.load_macros.2:
+.loc 1 2144 5
+  lea r10, [rbp-72]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.L.continue.load_macros.1:
+.loc 1 2133 40
+  lea r10, [rbp-112]
+  lea r11, [rbp-104]
+  mov [r11], r10
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  jmp .L.begin.load_macros.1
+.L.break.load_macros.1:
+.L.return.load_macros:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl print_pp_report
+print_pp_report:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-80], rdi
+.loc 1 2150 12
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 2151 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-68]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.print_pp_report.1:
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, offset macros
+  add r11, 8
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.print_pp_report.1
+.loc 1 2152 5
+  mov r10, offset macros
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-68]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 24
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  add r10, 16
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.print_pp_report.2
+.loc 1 2153 7
+  lea r10, [rbp-72]
+  lea r11, [rbp-56]
+  mov [r11], r10
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.end.print_pp_report.2:
+.L.continue.print_pp_report.1:
+.loc 1 2151 40
+  lea r10, [rbp-68]
+  lea r11, [rbp-64]
+  mov [r11], r10
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.print_pp_report.1
+.L.break.print_pp_report.1:
+.loc 1 2155 32
+  mov r10, offset macros
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2156 57
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  cmp r10, 0
+  je  .L.else.print_pp_report.3
+  mov r10, offset macros
+  add r10, 24
+  mov r10, [r10]
+  mov r11, 100
+  movsx r11, r11d
+  imul r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  jmp .L.end.print_pp_report.3
+.L.else.print_pp_report.3:
+  mov r10, 0
+  movsx r10, r10d
+.L.end.print_pp_report.3:
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2157 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.21
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2158 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.22
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset macros
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2159 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.23
+  push r10
+  sub rsp, 8
+.loc 1 2160 11
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset macros
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, 100
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, 100
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rdx
+  push r10
+  sub rsp, 8
+.loc 1 2159 3
+  mov r10, offset fprintf
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2161 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.24
+  push r10
+  sub rsp, 8
+.loc 1 2162 11
+  mov r10, offset nr_include_guards
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset nr_pragma_once
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+.loc 1 2161 3
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2163 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.25
+  push r10
+  sub rsp, 8
+  mov r10, offset nr_skipped_includes
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2164 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.26
+  push r10
+  sub rsp, 8
+.loc 1 2165 11
+  mov r10, offset nr_token_cache_files
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset nr_token_cache_hits
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+.loc 1 2164 3
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2166 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.27
+  push r10
+  sub rsp, 8
+.loc 1 2167 11
+  mov r10, offset nr_hidesets
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset nr_hideset_ops
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset nr_hideset_op_hits
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+.loc 1 2166 3
+  mov r10, offset fprintf
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.print_pp_report:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl read_file
+read_file:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdi
+.loc 1 2172 38
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset tokenize_file
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 2173 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.read_file.1
+.loc 1 2174 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.28
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset __errno_location
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset strerror
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.read_file.1:
+.loc 1 2175 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset timer_start
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2176 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset preprocess
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 2177 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset timer_stop
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2178 3
+  mov r10, offset cond_incl
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.read_file.2
+.loc 1 2179 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset cond_incl
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.29
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.read_file.2:
+.loc 1 2180 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset convert_keywords
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 2181 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.read_file
+.L.return.read_file:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
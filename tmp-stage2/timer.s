@@ -0,0 +1,3457 @@
+.file 1 "timer.c"
+.intel_syntax noprefix
+.bss
+.align 8
+last_cpu:
+  .zero 8
+.align 8
+last_wall:
+  .zero 8
+.align 4
+depth:
+  .zero 4
+.align 4
+stack:
+  .zero 32
+.align 8
+nr_lines:
+  .zero 8
+.align 8
+phase_count:
+  .zero 72
+.align 8
+phase_cpu:
+  .zero 72
+.align 8
+phase_wall:
+  .zero 72
+.align 1
+.globl time_report_json
+time_report_json:
+  .zero 1
+.align 1
+.globl time_report
+time_report:
+  .zero 1
+.data
+.align 1
+.L.data.62:
+  .byte 34
+  .byte 108
+  .byte 105
+  .byte 110
+  .byte 101
+  .byte 115
+  .byte 95
+  .byte 112
+  .byte 101
+  .byte 114
+  .byte 95
+  .byte 115
+  .byte 101
+  .byte 99
+  .byte 34
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 116
+  .byte 111
+  .byte 107
+  .byte 101
+  .byte 110
+  .byte 115
+  .byte 95
+  .byte 112
+  .byte 101
+  .byte 114
+  .byte 95
+  .byte 115
+  .byte 101
+  .byte 99
+  .byte 34
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 125
+  .byte 10
+  .zero 1
+.align 1
+.L.data.61:
+  .byte 34
+  .byte 108
+  .byte 105
+  .byte 110
+  .byte 101
+  .byte 115
+  .byte 34
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 116
+  .byte 111
+  .byte 107
+  .byte 101
+  .byte 110
+  .byte 115
+  .byte 34
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 44
+  .byte 32
+  .zero 1
+.align 1
+.L.data.60:
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 119
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 110
+  .byte 115
+  .byte 34
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 99
+  .byte 112
+  .byte 117
+  .byte 95
+  .byte 110
+  .byte 115
+  .byte 34
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 44
+  .byte 32
+  .zero 1
+.align 1
+.L.data.59:
+  .byte 34
+  .byte 99
+  .byte 111
+  .byte 117
+  .byte 110
+  .byte 116
+  .byte 34
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 117
+  .byte 110
+  .byte 105
+  .byte 116
+  .byte 34
+  .byte 58
+  .byte 32
+  .byte 34
+  .byte 37
+  .byte 115
+  .byte 34
+  .byte 125
+  .zero 1
+.align 1
+.L.data.58:
+  .zero 1
+.align 1
+.L.data.57:
+  .byte 44
+  .byte 32
+  .zero 1
+.align 1
+.L.data.56:
+  .byte 37
+  .byte 115
+  .byte 123
+  .byte 34
+  .byte 110
+  .byte 97
+  .byte 109
+  .byte 101
+  .byte 34
+  .byte 58
+  .byte 32
+  .byte 34
+  .byte 37
+  .byte 115
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 119
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 110
+  .byte 115
+  .byte 34
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 99
+  .byte 112
+  .byte 117
+  .byte 95
+  .byte 110
+  .byte 115
+  .byte 34
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 44
+  .byte 32
+  .zero 1
+.align 1
+.L.data.55:
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 112
+  .byte 104
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 115
+  .byte 34
+  .byte 58
+  .byte 32
+  .byte 91
+  .zero 1
+.align 1
+.L.data.54:
+  .byte 123
+  .byte 34
+  .byte 102
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 34
+  .byte 58
+  .byte 32
+  .zero 1
+.align 1
+.L.data.53:
+  .byte 34
+  .zero 1
+.align 1
+.L.data.52:
+  .byte 37
+  .byte 99
+  .zero 1
+.align 1
+.L.data.51:
+  .byte 92
+  .byte 117
+  .byte 37
+  .byte 48
+  .byte 52
+  .byte 120
+  .zero 1
+.align 1
+.L.data.50:
+  .byte 92
+  .byte 37
+  .byte 99
+  .zero 1
+.align 1
+.L.data.49:
+  .byte 34
+  .zero 1
+.align 1
+.L.data.48:
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 32
+  .byte 108
+  .byte 105
+  .byte 110
+  .byte 101
+  .byte 115
+  .byte 47
+  .byte 115
+  .byte 101
+  .byte 99
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 32
+  .byte 116
+  .byte 111
+  .byte 107
+  .byte 101
+  .byte 110
+  .byte 115
+  .byte 47
+  .byte 115
+  .byte 101
+  .byte 99
+  .byte 10
+  .zero 1
+.align 1
+.L.data.47:
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 32
+  .byte 108
+  .byte 105
+  .byte 110
+  .byte 101
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 32
+  .byte 116
+  .byte 111
+  .byte 107
+  .byte 101
+  .byte 110
+  .byte 115
+  .byte 58
+  .byte 32
+  .zero 1
+.align 1
+.L.data.46:
+  .byte 10
+  .zero 1
+.align 1
+.L.data.45:
+  .byte 116
+  .byte 111
+  .byte 116
+  .byte 97
+  .byte 108
+  .zero 1
+.align 1
+.L.data.44:
+  .byte 37
+  .byte 45
+  .byte 49
+  .byte 50
+  .byte 115
+  .zero 1
+.align 1
+.L.data.43:
+  .byte 32
+  .byte 37
+  .byte 49
+  .byte 48
+  .byte 108
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 45
+  .byte 55
+  .byte 115
+  .byte 32
+  .byte 37
+  .byte 49
+  .byte 50
+  .byte 108
+  .byte 100
+  .byte 10
+  .zero 1
+.align 1
+.L.data.42:
+  .byte 32
+  .byte 37
+  .byte 53
+  .byte 108
+  .byte 100
+  .byte 46
+  .byte 37
+  .byte 108
+  .byte 100
+  .zero 1
+.align 1
+.L.data.41:
+  .byte 37
+  .byte 45
+  .byte 49
+  .byte 50
+  .byte 115
+  .zero 1
+.align 1
+.L.data.40:
+  .byte 112
+  .byte 104
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 119
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 40
+  .byte 109
+  .byte 115
+  .byte 41
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 99
+  .byte 112
+  .byte 117
+  .byte 40
+  .byte 109
+  .byte 115
+  .byte 41
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 37
+  .byte 37
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 117
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 117
+  .byte 110
+  .byte 105
+  .byte 116
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 114
+  .byte 97
+  .byte 116
+  .byte 101
+  .byte 40
+  .byte 47
+  .byte 115
+  .byte 41
+  .byte 10
+  .zero 1
+.align 1
+.L.data.39:
+  .byte 116
+  .byte 105
+  .byte 109
+  .byte 101
+  .byte 32
+  .byte 114
+  .byte 101
+  .byte 112
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 10
+  .zero 1
+.align 1
+.L.data.38:
+  .byte 32
+  .byte 37
+  .byte 57
+  .byte 108
+  .byte 100
+  .byte 46
+  .byte 37
+  .byte 48
+  .byte 51
+  .byte 108
+  .byte 100
+  .zero 1
+.align 1
+.L.data.37:
+  .byte 111
+  .byte 116
+  .byte 104
+  .byte 101
+  .byte 114
+  .zero 1
+.align 1
+.L.data.36:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 110
+  .byte 97
+  .byte 108
+  .byte 32
+  .byte 101
+  .byte 114
+  .byte 114
+  .byte 111
+  .byte 114
+  .byte 58
+  .byte 32
+  .byte 112
+  .byte 104
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 115
+  .byte 32
+  .byte 110
+  .byte 101
+  .byte 115
+  .byte 116
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 116
+  .byte 111
+  .byte 111
+  .byte 32
+  .byte 100
+  .byte 101
+  .byte 101
+  .byte 112
+  .byte 108
+  .byte 121
+  .zero 1
+.align 1
+.L.data.35:
+  .byte 98
+  .byte 121
+  .byte 116
+  .byte 101
+  .byte 115
+  .zero 1
+.align 1
+.L.data.34:
+  .byte 98
+  .byte 121
+  .byte 116
+  .byte 101
+  .byte 115
+  .zero 1
+.align 1
+.L.data.33:
+  .byte 98
+  .byte 121
+  .byte 116
+  .byte 101
+  .byte 115
+  .zero 1
+.align 1
+.L.data.32:
+  .byte 118
+  .byte 97
+  .byte 114
+  .byte 115
+  .zero 1
+.align 1
+.L.data.31:
+  .byte 110
+  .byte 111
+  .byte 100
+  .byte 101
+  .byte 115
+  .zero 1
+.align 1
+.L.data.30:
+  .byte 116
+  .byte 111
+  .byte 107
+  .byte 101
+  .byte 110
+  .byte 115
+  .zero 1
+.align 1
+.L.data.29:
+  .byte 116
+  .byte 111
+  .byte 107
+  .byte 101
+  .byte 110
+  .byte 115
+  .zero 1
+.align 1
+.L.data.28:
+  .byte 116
+  .byte 111
+  .byte 107
+  .byte 101
+  .byte 110
+  .byte 115
+  .zero 1
+.align 1
+.L.data.27:
+  .byte 98
+  .byte 121
+  .byte 116
+  .byte 101
+  .byte 115
+  .zero 1
+.align 1
+.L.data.26:
+  .byte 98
+  .byte 121
+  .byte 116
+  .byte 101
+  .byte 115
+  .zero 1
+.align 1
+.L.data.25:
+  .byte 98
+  .byte 121
+  .byte 116
+  .byte 101
+  .byte 115
+  .zero 1
+.align 1
+.L.data.24:
+  .byte 98
+  .byte 121
+  .byte 116
+  .byte 101
+  .byte 115
+  .zero 1
+.align 1
+.L.data.23:
+  .byte 118
+  .byte 97
+  .byte 114
+  .byte 115
+  .zero 1
+.align 1
+.L.data.22:
+  .byte 110
+  .byte 111
+  .byte 100
+  .byte 101
+  .byte 115
+  .zero 1
+.align 1
+.L.data.21:
+  .byte 116
+  .byte 111
+  .byte 107
+  .byte 101
+  .byte 110
+  .byte 115
+  .zero 1
+.align 1
+.L.data.20:
+  .byte 116
+  .byte 111
+  .byte 107
+  .byte 101
+  .byte 110
+  .byte 115
+  .zero 1
+.align 1
+.L.data.19:
+  .byte 116
+  .byte 111
+  .byte 107
+  .byte 101
+  .byte 110
+  .byte 115
+  .zero 1
+.align 1
+.L.data.18:
+  .byte 98
+  .byte 121
+  .byte 116
+  .byte 101
+  .byte 115
+  .zero 1
+.align 8
+phase_unit:
+  .quad .L.data.27+0
+  .quad .L.data.28+0
+  .quad .L.data.29+0
+  .quad .L.data.30+0
+  .quad .L.data.31+0
+  .quad .L.data.32+0
+  .quad .L.data.33+0
+  .quad .L.data.34+0
+  .quad .L.data.35+0
+.align 1
+.L.data.17:
+  .byte 97
+  .byte 115
+  .byte 115
+  .byte 101
+  .byte 109
+  .byte 98
+  .byte 108
+  .byte 101
+  .zero 1
+.align 1
+.L.data.16:
+  .byte 101
+  .byte 109
+  .byte 105
+  .byte 116
+  .byte 95
+  .byte 116
+  .byte 101
+  .byte 120
+  .byte 116
+  .zero 1
+.align 1
+.L.data.15:
+  .byte 101
+  .byte 109
+  .byte 105
+  .byte 116
+  .byte 95
+  .byte 100
+  .byte 97
+  .byte 116
+  .byte 97
+  .zero 1
+.align 1
+.L.data.14:
+  .byte 108
+  .byte 97
+  .byte 121
+  .byte 111
+  .byte 117
+  .byte 116
+  .zero 1
+.align 1
+.L.data.13:
+  .byte 112
+  .byte 97
+  .byte 114
+  .byte 115
+  .byte 101
+  .zero 1
+.align 1
+.L.data.12:
+  .byte 107
+  .byte 101
+  .byte 121
+  .byte 119
+  .byte 111
+  .byte 114
+  .byte 100
+  .byte 115
+  .zero 1
+.align 1
+.L.data.11:
+  .byte 112
+  .byte 114
+  .byte 101
+  .byte 112
+  .byte 114
+  .byte 111
+  .byte 99
+  .byte 101
+  .byte 115
+  .byte 115
+  .zero 1
+.align 1
+.L.data.10:
+  .byte 116
+  .byte 111
+  .byte 107
+  .byte 101
+  .byte 110
+  .byte 105
+  .byte 122
+  .byte 101
+  .zero 1
+.align 1
+.L.data.9:
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 100
+  .zero 1
+.align 1
+.L.data.8:
+  .byte 97
+  .byte 115
+  .byte 115
+  .byte 101
+  .byte 109
+  .byte 98
+  .byte 108
+  .byte 101
+  .zero 1
+.align 1
+.L.data.7:
+  .byte 101
+  .byte 109
+  .byte 105
+  .byte 116
+  .byte 95
+  .byte 116
+  .byte 101
+  .byte 120
+  .byte 116
+  .zero 1
+.align 1
+.L.data.6:
+  .byte 101
+  .byte 109
+  .byte 105
+  .byte 116
+  .byte 95
+  .byte 100
+  .byte 97
+  .byte 116
+  .byte 97
+  .zero 1
+.align 1
+.L.data.5:
+  .byte 108
+  .byte 97
+  .byte 121
+  .byte 111
+  .byte 117
+  .byte 116
+  .zero 1
+.align 1
+.L.data.4:
+  .byte 112
+  .byte 97
+  .byte 114
+  .byte 115
+  .byte 101
+  .zero 1
+.align 1
+.L.data.3:
+  .byte 107
+  .byte 101
+  .byte 121
+  .byte 119
+  .byte 111
+  .byte 114
+  .byte 100
+  .byte 115
+  .zero 1
+.align 1
+.L.data.2:
+  .byte 112
+  .byte 114
+  .byte 101
+  .byte 112
+  .byte 114
+  .byte 111
+  .byte 99
+  .byte 101
+  .byte 115
+  .byte 115
+  .zero 1
+.align 1
+.L.data.1:
+  .byte 116
+  .byte 111
+  .byte 107
+  .byte 101
+  .byte 110
+  .byte 105
+  .byte 122
+  .byte 101
+  .zero 1
+.align 1
+.L.data.0:
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 100
+  .zero 1
+.align 8
+phase_names:
+  .quad .L.data.9+0
+  .quad .L.data.10+0
+  .quad .L.data.11+0
+  .quad .L.data.12+0
+  .quad .L.data.13+0
+  .quad .L.data.14+0
+  .quad .L.data.15+0
+  .quad .L.data.16+0
+  .quad .L.data.17+0
+.text
+assert:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.L.return.assert:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+va_end:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.L.return.va_end:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+now:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-52], edi
+.loc 1 776 21
+.loc 1 777 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  push r10
+  sub rsp, 8
+  mov r10, offset clock_gettime
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 778 3
+  lea r10, [rbp-48]
+  add r10, 0
+  mov r10, [r10]
+  mov r11, 1000000000
+  movsx r11, r11d
+  imul r10, r11
+  lea r11, [rbp-48]
+  add r11, 8
+  mov r11, [r11]
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.now
+.L.return.now:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+charge:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 783 35
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset now
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 784 43
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset now
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 786 3
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, offset depth
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.charge.1
+.loc 1 787 5
+  mov r10, offset stack
+  mov r11, offset depth
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  sub r11d, r12d
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 788 5
+  mov r10, offset phase_wall
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  mov r12, offset last_wall
+  mov r12, [r12]
+  sub r11, r12
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 789 5
+  mov r10, offset phase_cpu
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov r12, offset last_cpu
+  mov r12, [r12]
+  sub r11, r12
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+.L.end.charge.1:
+.loc 1 791 3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r11, offset last_wall
+  mov [r11], r10
+.loc 1 792 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r11, offset last_cpu
+  mov [r11], r10
+.L.return.charge:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl timer_start
+timer_start:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-44], edi
+.loc 1 796 3
+  mov r10, offset time_report
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.timer_start.2
+  mov r10, offset mem_report
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.timer_start.2
+  mov r10, 1
+  jmp .L.end.timer_start.2
+.L.false.timer_start.2:
+  mov r10, 0
+.L.end.timer_start.2:
+  cmp r10, 0
+  je .L.end.timer_start.1
+.loc 1 797 5
+  jmp .L.return.timer_start
+.L.end.timer_start.1:
+.loc 1 798 3
+  mov r10, offset depth
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.timer_start.3
+.loc 1 799 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.36
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.timer_start.3:
+.loc 1 800 3
+  mov r10, offset time_report
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.timer_start.4
+.loc 1 801 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset charge
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.timer_start.4:
+.loc 1 802 3
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, offset stack
+  mov r12, offset depth
+  lea r13, [rbp-40]
+  mov [r13], r12
+  lea r12, [rbp-40]
+  mov r12, [r12]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  add r12d, r13d
+  mov r12d, r12d
+  lea r13, [rbp-40]
+  mov r13, [r13]
+  mov [r13], r12d
+  lea r12, [rbp-40]
+  mov r12, [r12]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, -1
+  mov r13d, r13d
+  add r12d, r13d
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.return.timer_start:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl timer_stop
+timer_stop:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 806 3
+  mov r10, offset time_report
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.timer_stop.2
+  mov r10, offset mem_report
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.false.timer_stop.2
+  mov r10, 1
+  jmp .L.end.timer_stop.2
+.L.false.timer_stop.2:
+  mov r10, 0
+.L.end.timer_stop.2:
+  cmp r10, 0
+  je .L.end.timer_stop.1
+.loc 1 807 5
+  jmp .L.return.timer_stop
+.L.end.timer_stop.1:
+.loc 1 808 3
+  mov r10, offset time_report
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.timer_stop.3
+.loc 1 809 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset charge
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.timer_stop.3:
+.loc 1 810 3
+  mov r10, offset depth
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+.L.return.timer_stop:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl current_phase
+current_phase:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 815 3
+  mov r10, offset depth
+  mov r10d, dword ptr [r10]
+  cmp r10, 0
+  je  .L.else.current_phase.1
+  mov r10, offset stack
+  mov r11, offset depth
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  sub r11d, r12d
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  jmp .L.end.current_phase.1
+.L.else.current_phase.1:
+  mov r10, 9
+  mov r10d, r10d
+.L.end.current_phase.1:
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.current_phase
+.L.return.current_phase:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl phase_name
+phase_name:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-36], edi
+.loc 1 819 3
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 9
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je  .L.else.phase_name.1
+  mov r10, offset .L.data.37
+  jmp .L.end.phase_name.1
+.L.else.phase_name.1:
+  mov r10, offset phase_names
+  lea r11, [rbp-36]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+.L.end.phase_name.1:
+  mov rax, r10
+  jmp .L.return.phase_name
+.L.return.phase_name:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl timer_count
+timer_count:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-52], edi
+.loc 1 823 3
+  mov r10, offset phase_count
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+.L.return.timer_count:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl timer_count_lines
+timer_count_lines:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdi
+.loc 1 827 3
+  mov r10, offset nr_lines
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+.L.return.timer_count_lines:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl reset_timer
+reset_timer:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 832 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset phase_wall
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 72
+  push r10
+  sub rsp, 8
+  mov r10, offset memset
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 833 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset phase_cpu
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 72
+  push r10
+  sub rsp, 8
+  mov r10, offset memset
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 834 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset phase_count
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 72
+  push r10
+  sub rsp, 8
+  mov r10, offset memset
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 835 3
+  mov r10, 0
+  movsx r10, r10d
+  mov r11, offset nr_lines
+  mov [r11], r10
+.L.return.reset_timer:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+rate:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rsi
+  mov [rbp-48], rdi
+.loc 1 840 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je  .L.else.rate.1
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r11, 1000000000
+  movsx r11, r11d
+  imul r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  jmp .L.end.rate.1
+.L.else.rate.1:
+  mov r10, 0
+  movsx r10, r10d
+.L.end.rate.1:
+  mov rax, r10
+  jmp .L.return.rate
+.L.return.rate:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+print_ms:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdi
+.loc 1 844 22
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r11, 1000
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 845 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.38
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, 1000
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, 1000
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rdx
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.print_ms:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+print_table:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-64], rdx
+  mov [rbp-72], rsi
+  mov [rbp-80], rdi
+.loc 1 849 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.39
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 850 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.40
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 852 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.print_table.1:
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 9
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.print_table.1
+.loc 1 853 5
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  cmp r10, 0
+  je  .L.else.print_table.2
+  mov r10, offset phase_wall
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  mov r11, 1000
+  movsx r11, r11d
+  imul r10, r11
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  jmp .L.end.print_table.2
+.L.else.print_table.2:
+  mov r10, 0
+  movsx r10, r10d
+.L.end.print_table.2:
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 854 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.41
+  push r10
+  sub rsp, 8
+  mov r10, offset phase_names
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 855 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset phase_wall
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset print_ms
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 856 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset phase_cpu
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset print_ms
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 857 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.42
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, 10
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, 10
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rdx
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 858 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.43
+  push r10
+  sub rsp, 8
+  mov r10, offset phase_count
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset phase_unit
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+.loc 1 859 17
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset phase_count
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset phase_wall
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset rate
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+.loc 1 858 5
+  mov r10, offset fprintf
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.print_table.1:
+.loc 1 852 34
+  lea r10, [rbp-52]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.print_table.1
+.L.break.print_table.1:
+.loc 1 862 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.44
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.45
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 863 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset print_ms
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 864 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset print_ms
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 865 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.46
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 867 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.47
+  push r10
+  sub rsp, 8
+  mov r10, offset nr_lines
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+.loc 1 868 22
+  mov r10, offset phase_count
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+.loc 1 867 3
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 869 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.48
+  push r10
+  sub rsp, 8
+.loc 1 870 15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset nr_lines
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset rate
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+.loc 1 871 15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset phase_count
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset rate
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+.loc 1 869 3
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.print_table:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+print_json_string:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-56], rdi
+.loc 1 876 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.49
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 877 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.print_json_string.1:
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.break.print_json_string.1
+.loc 1 878 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 92
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.print_json_string.3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 34
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.print_json_string.3
+  mov r10, 0
+  jmp .L.end.print_json_string.3
+.L.true.print_json_string.3:
+  mov r10, 1
+.L.end.print_json_string.3:
+  cmp r10, 0
+  je .L.else.print_json_string.2
+.loc 1 879 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.50
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.print_json_string.2
+.L.else.print_json_string.2:
+.loc 1 880 10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  movzx r10, r10b
+  mov r10d, r10d
+  mov r11, 32
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.print_json_string.4
+.loc 1 881 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.51
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.print_json_string.4
+.L.else.print_json_string.4:
+.loc 1 883 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.52
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.print_json_string.4:
+.L.end.print_json_string.2:
+.L.continue.print_json_string.1:
+.loc 1 877 27
+  lea r10, [rbp-48]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  jmp .L.begin.print_json_string.1
+.L.break.print_json_string.1:
+.loc 1 885 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.53
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.print_json_string:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+print_json:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-56], rdx
+  mov [rbp-64], rsi
+  mov [rbp-72], rdi
+.loc 1 889 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.54
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 890 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset print_json_string
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 891 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.55
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 893 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-44]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.print_json.1:
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 9
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.print_json.1
+.loc 1 894 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.56
+  push r10
+  sub rsp, 8
+.loc 1 895 15
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  cmp r10, 0
+  je  .L.else.print_json.2
+  mov r10, offset .L.data.57
+  jmp .L.end.print_json.2
+.L.else.print_json.2:
+  mov r10, offset .L.data.58
+.L.end.print_json.2:
+  push r10
+  sub rsp, 8
+  mov r10, offset phase_names
+  lea r11, [rbp-44]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset phase_wall
+  lea r11, [rbp-44]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset phase_cpu
+  lea r11, [rbp-44]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+.loc 1 894 5
+  mov r10, offset fprintf
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 896 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.59
+  push r10
+  sub rsp, 8
+.loc 1 897 24
+  mov r10, offset phase_count
+  lea r11, [rbp-44]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset phase_unit
+  lea r11, [rbp-44]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+.loc 1 896 5
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.print_json.1:
+.loc 1 893 34
+  lea r10, [rbp-44]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.print_json.1
+.L.break.print_json.1:
+.loc 1 900 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.60
+  push r10
+  sub rsp, 8
+.loc 1 901 11
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+.loc 1 900 3
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 902 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.61
+  push r10
+  sub rsp, 8
+.loc 1 903 11
+  mov r10, offset nr_lines
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset phase_count
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+.loc 1 902 3
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 904 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.62
+  push r10
+  sub rsp, 8
+.loc 1 905 15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset nr_lines
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset rate
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+.loc 1 906 15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset phase_count
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset rate
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+.loc 1 904 3
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.print_json:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl print_time_report
+print_time_report:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-88], rdi
+.loc 1 911 22
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 912 21
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 913 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-60]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.print_time_report.1:
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 9
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.print_time_report.1
+.loc 1 914 5
+  lea r10, [rbp-80]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, offset phase_wall
+  lea r12, [rbp-60]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 8
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov r11, [r11]
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 915 5
+  lea r10, [rbp-72]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, offset phase_cpu
+  lea r12, [rbp-60]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 8
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov r11, [r11]
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+.L.continue.print_time_report.1:
+.loc 1 913 34
+  lea r10, [rbp-60]
+  lea r11, [rbp-56]
+  mov [r11], r10
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.print_time_report.1
+.L.break.print_time_report.1:
+.loc 1 918 3
+  mov r10, offset time_report_json
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.else.print_time_report.2
+.loc 1 919 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset print_json
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.print_time_report.2
+.L.else.print_time_report.2:
+.loc 1 921 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset print_table
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.print_time_report.2:
+.L.return.print_time_report:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
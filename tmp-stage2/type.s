@@ -0,0 +1,3226 @@
+.file 1 "type.c"
+.intel_syntax noprefix
+.bss
+.data
+.align 1
+.L.data.13:
+  .byte 100
+  .byte 101
+  .byte 114
+  .byte 101
+  .byte 102
+  .byte 101
+  .byte 114
+  .byte 101
+  .byte 110
+  .byte 99
+  .byte 105
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 97
+  .byte 32
+  .byte 118
+  .byte 111
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 112
+  .byte 111
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 101
+  .byte 114
+  .zero 1
+.align 1
+.L.data.12:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 112
+  .byte 111
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 32
+  .byte 100
+  .byte 101
+  .byte 114
+  .byte 101
+  .byte 102
+  .byte 101
+  .byte 114
+  .byte 101
+  .byte 110
+  .byte 99
+  .byte 101
+  .zero 1
+.align 1
+.L.data.11:
+  .byte 105
+  .byte 110
+  .byte 99
+  .byte 111
+  .byte 109
+  .byte 112
+  .byte 108
+  .byte 101
+  .byte 116
+  .byte 101
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .zero 1
+.align 1
+.L.data.10:
+  .byte 118
+  .byte 111
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .zero 1
+.align 8
+.L.data.9:
+  .long 5
+  .long 8
+  .long 8
+  .byte 1
+  .zero 75
+.align 8
+.globl ty_ulong
+ty_ulong:
+  .quad .L.data.9+0
+.align 8
+.L.data.8:
+  .long 4
+  .long 4
+  .long 4
+  .byte 1
+  .zero 75
+.align 8
+.globl ty_uint
+ty_uint:
+  .quad .L.data.8+0
+.align 8
+.L.data.7:
+  .long 3
+  .long 2
+  .long 2
+  .byte 1
+  .zero 75
+.align 8
+.globl ty_ushort
+ty_ushort:
+  .quad .L.data.7+0
+.align 8
+.L.data.6:
+  .long 2
+  .long 1
+  .long 1
+  .byte 1
+  .zero 75
+.align 8
+.globl ty_uchar
+ty_uchar:
+  .quad .L.data.6+0
+.align 8
+.L.data.5:
+  .long 5
+  .long 8
+  .long 8
+  .zero 76
+.align 8
+.globl ty_long
+ty_long:
+  .quad .L.data.5+0
+.align 8
+.L.data.4:
+  .long 4
+  .long 4
+  .long 4
+  .zero 76
+.align 8
+.globl ty_int
+ty_int:
+  .quad .L.data.4+0
+.align 8
+.L.data.3:
+  .long 3
+  .long 2
+  .long 2
+  .zero 76
+.align 8
+.globl ty_short
+ty_short:
+  .quad .L.data.3+0
+.align 8
+.L.data.2:
+  .long 2
+  .long 1
+  .long 1
+  .zero 76
+.align 8
+.globl ty_char
+ty_char:
+  .quad .L.data.2+0
+.align 8
+.L.data.1:
+  .long 1
+  .long 1
+  .long 1
+  .zero 76
+.align 8
+.globl ty_bool
+ty_bool:
+  .quad .L.data.1+0
+.align 8
+.L.data.0:
+  .long 0
+  .long 1
+  .long 1
+  .zero 76
+.align 8
+.globl ty_void
+ty_void:
+  .quad .L.data.0+0
+.text
+assert:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.L.return.assert:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+va_end:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.L.return.va_end:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+new_type:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-44], edx
+  mov [rbp-48], esi
+  mov [rbp-52], edi
+.loc 1 751 46
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 88
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 752 3
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10d
+.loc 1 753 3
+  lea r10, [rbp-48]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 4
+  mov [r11], r10d
+.loc 1 754 3
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10d
+.loc 1 755 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.new_type
+.L.return.new_type:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl is_integer
+is_integer:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdi
+.loc 1 759 24
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 760 3
+.loc 1 761 39
+.loc 1 760 56
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.is_integer.5
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.is_integer.5
+  mov r10, 0
+  jmp .L.end.is_integer.5
+.L.true.is_integer.5:
+  mov r10, 1
+.L.end.is_integer.5:
+  cmp r10, 0
+  jne .L.true.is_integer.4
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 3
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.is_integer.4
+  mov r10, 0
+  jmp .L.end.is_integer.4
+.L.true.is_integer.4:
+  mov r10, 1
+.L.end.is_integer.4:
+  cmp r10, 0
+  jne .L.true.is_integer.3
+.loc 1 761 12
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.is_integer.3
+  mov r10, 0
+  jmp .L.end.is_integer.3
+.L.true.is_integer.3:
+  mov r10, 1
+.L.end.is_integer.3:
+  cmp r10, 0
+  jne .L.true.is_integer.2
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 5
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.is_integer.2
+  mov r10, 0
+  jmp .L.end.is_integer.2
+.L.true.is_integer.2:
+  mov r10, 1
+.L.end.is_integer.2:
+  cmp r10, 0
+  jne .L.true.is_integer.1
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 6
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.is_integer.1
+  mov r10, 0
+  jmp .L.end.is_integer.1
+.L.true.is_integer.1:
+  mov r10, 1
+.L.end.is_integer.1:
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.is_integer
+.L.return.is_integer:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl copy_type
+copy_type:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdi
+.loc 1 765 47
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 88
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 766 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov al, [r10+0]
+  mov [r11+0], al
+  mov al, [r10+1]
+  mov [r11+1], al
+  mov al, [r10+2]
+  mov [r11+2], al
+  mov al, [r10+3]
+  mov [r11+3], al
+  mov al, [r10+4]
+  mov [r11+4], al
+  mov al, [r10+5]
+  mov [r11+5], al
+  mov al, [r10+6]
+  mov [r11+6], al
+  mov al, [r10+7]
+  mov [r11+7], al
+  mov al, [r10+8]
+  mov [r11+8], al
+  mov al, [r10+9]
+  mov [r11+9], al
+  mov al, [r10+10]
+  mov [r11+10], al
+  mov al, [r10+11]
+  mov [r11+11], al
+  mov al, [r10+12]
+  mov [r11+12], al
+  mov al, [r10+13]
+  mov [r11+13], al
+  mov al, [r10+14]
+  mov [r11+14], al
+  mov al, [r10+15]
+  mov [r11+15], al
+  mov al, [r10+16]
+  mov [r11+16], al
+  mov al, [r10+17]
+  mov [r11+17], al
+  mov al, [r10+18]
+  mov [r11+18], al
+  mov al, [r10+19]
+  mov [r11+19], al
+  mov al, [r10+20]
+  mov [r11+20], al
+  mov al, [r10+21]
+  mov [r11+21], al
+  mov al, [r10+22]
+  mov [r11+22], al
+  mov al, [r10+23]
+  mov [r11+23], al
+  mov al, [r10+24]
+  mov [r11+24], al
+  mov al, [r10+25]
+  mov [r11+25], al
+  mov al, [r10+26]
+  mov [r11+26], al
+  mov al, [r10+27]
+  mov [r11+27], al
+  mov al, [r10+28]
+  mov [r11+28], al
+  mov al, [r10+29]
+  mov [r11+29], al
+  mov al, [r10+30]
+  mov [r11+30], al
+  mov al, [r10+31]
+  mov [r11+31], al
+  mov al, [r10+32]
+  mov [r11+32], al
+  mov al, [r10+33]
+  mov [r11+33], al
+  mov al, [r10+34]
+  mov [r11+34], al
+  mov al, [r10+35]
+  mov [r11+35], al
+  mov al, [r10+36]
+  mov [r11+36], al
+  mov al, [r10+37]
+  mov [r11+37], al
+  mov al, [r10+38]
+  mov [r11+38], al
+  mov al, [r10+39]
+  mov [r11+39], al
+  mov al, [r10+40]
+  mov [r11+40], al
+  mov al, [r10+41]
+  mov [r11+41], al
+  mov al, [r10+42]
+  mov [r11+42], al
+  mov al, [r10+43]
+  mov [r11+43], al
+  mov al, [r10+44]
+  mov [r11+44], al
+  mov al, [r10+45]
+  mov [r11+45], al
+  mov al, [r10+46]
+  mov [r11+46], al
+  mov al, [r10+47]
+  mov [r11+47], al
+  mov al, [r10+48]
+  mov [r11+48], al
+  mov al, [r10+49]
+  mov [r11+49], al
+  mov al, [r10+50]
+  mov [r11+50], al
+  mov al, [r10+51]
+  mov [r11+51], al
+  mov al, [r10+52]
+  mov [r11+52], al
+  mov al, [r10+53]
+  mov [r11+53], al
+  mov al, [r10+54]
+  mov [r11+54], al
+  mov al, [r10+55]
+  mov [r11+55], al
+  mov al, [r10+56]
+  mov [r11+56], al
+  mov al, [r10+57]
+  mov [r11+57], al
+  mov al, [r10+58]
+  mov [r11+58], al
+  mov al, [r10+59]
+  mov [r11+59], al
+  mov al, [r10+60]
+  mov [r11+60], al
+  mov al, [r10+61]
+  mov [r11+61], al
+  mov al, [r10+62]
+  mov [r11+62], al
+  mov al, [r10+63]
+  mov [r11+63], al
+  mov al, [r10+64]
+  mov [r11+64], al
+  mov al, [r10+65]
+  mov [r11+65], al
+  mov al, [r10+66]
+  mov [r11+66], al
+  mov al, [r10+67]
+  mov [r11+67], al
+  mov al, [r10+68]
+  mov [r11+68], al
+  mov al, [r10+69]
+  mov [r11+69], al
+  mov al, [r10+70]
+  mov [r11+70], al
+  mov al, [r10+71]
+  mov [r11+71], al
+  mov al, [r10+72]
+  mov [r11+72], al
+  mov al, [r10+73]
+  mov [r11+73], al
+  mov al, [r10+74]
+  mov [r11+74], al
+  mov al, [r10+75]
+  mov [r11+75], al
+  mov al, [r10+76]
+  mov [r11+76], al
+  mov al, [r10+77]
+  mov [r11+77], al
+  mov al, [r10+78]
+  mov [r11+78], al
+  mov al, [r10+79]
+  mov [r11+79], al
+  mov al, [r10+80]
+  mov [r11+80], al
+  mov al, [r10+81]
+  mov [r11+81], al
+  mov al, [r10+82]
+  mov [r11+82], al
+  mov al, [r10+83]
+  mov [r11+83], al
+  mov al, [r10+84]
+  mov [r11+84], al
+  mov al, [r10+85]
+  mov [r11+85], al
+  mov al, [r10+86]
+  mov [r11+86], al
+  mov al, [r10+87]
+  mov [r11+87], al
+.loc 1 767 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.copy_type
+.L.return.copy_type:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl align_to
+align_to:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-36], esi
+  mov [rbp-40], edi
+.loc 1 771 3
+  lea r10, [rbp-40]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  sub r11d, r12d
+  not r11
+  mov r11d, r11d
+  and r10d, r11d
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.align_to
+.L.return.align_to:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl pointer_to
+pointer_to:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdi
+.loc 1 775 36
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 8
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset new_type
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 776 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 777 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.pointer_to
+.L.return.pointer_to:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl func_type
+func_type:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdi
+.loc 1 781 46
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 88
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 782 3
+  mov r10, 8
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10d
+.loc 1 783 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 56
+  mov [r11], r10
+.loc 1 784 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.func_type
+.L.return.func_type:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl array_of
+array_of:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-44], esi
+  mov [rbp-56], rdi
+.loc 1 788 66
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 9
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-44]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  imul r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset new_type
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 789 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 790 3
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10d
+.loc 1 791 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.array_of
+.L.return.array_of:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl enum_type
+enum_type:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 795 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset new_type
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.enum_type
+.L.return.enum_type:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl struct_type
+struct_type:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 799 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 10
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset new_type
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.struct_type
+.L.return.struct_type:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl size_of
+size_of:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 803 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.size_of.1
+.loc 1 804 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.10
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.size_of.1:
+.loc 1 805 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 13
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.size_of.2
+.loc 1 806 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.11
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.size_of.2:
+.loc 1 807 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.size_of
+.L.return.size_of:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+get_common_type:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rsi
+  mov [rbp-48], rdi
+.loc 1 811 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.get_common_type.1
+.loc 1 812 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pointer_to
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.get_common_type
+.L.end.get_common_type.1:
+.loc 1 814 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.get_common_type.2
+.loc 1 815 5
+  mov r10, offset ty_int
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov [r11], r10
+.L.end.get_common_type.2:
+.loc 1 816 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.get_common_type.3
+.loc 1 817 5
+  mov r10, offset ty_int
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov [r11], r10
+.L.end.get_common_type.3:
+.loc 1 819 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.get_common_type.4
+.loc 1 820 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je  .L.else.get_common_type.5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  jmp .L.end.get_common_type.5
+.L.else.get_common_type.5:
+  lea r10, [rbp-48]
+  mov r10, [r10]
+.L.end.get_common_type.5:
+  mov rax, r10
+  jmp .L.return.get_common_type
+.L.end.get_common_type.4:
+.loc 1 822 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 12
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.get_common_type.6
+.loc 1 823 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.get_common_type
+.L.end.get_common_type.6:
+.loc 1 824 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.get_common_type
+.L.return.get_common_type:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+usual_arith_conv:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 828 53
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_common_type
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 829 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_cast
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 830 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_cast
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+.L.return.usual_arith_conv:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl add_type
+add_type:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 288
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-280], rdi
+.loc 1 834 3
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.true.add_type.2
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  cmp r10, 0
+  jne .L.true.add_type.2
+  mov r10, 0
+  jmp .L.end.add_type.2
+.L.true.add_type.2:
+  mov r10, 1
+.L.end.add_type.2:
+  cmp r10, 0
+  je .L.end.add_type.1
+.loc 1 835 5
+  jmp .L.return.add_type
+.L.end.add_type.1:
+.loc 1 837 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 838 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 839 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 48
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 840 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 841 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 64
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 842 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 72
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 843 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 80
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 845 3
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 96
+  mov r10, [r10]
+  lea r11, [rbp-272]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.add_type.3:
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.add_type.3
+.loc 1 846 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.add_type.3:
+.loc 1 845 33
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-272]
+  mov [r11], r10
+  jmp .L.begin.add_type.3
+.L.break.add_type.3:
+.loc 1 847 3
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 128
+  mov r10, [r10]
+  lea r11, [rbp-264]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.add_type.4:
+  lea r10, [rbp-264]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.add_type.4
+.loc 1 848 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-264]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_type
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.add_type.4:
+.loc 1 847 33
+  lea r10, [rbp-264]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-264]
+  mov [r11], r10
+  jmp .L.begin.add_type.4
+.L.break.add_type.4:
+.loc 1 850 3
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  cmp r10, 35
+  je .L.case.add_type.6
+  cmp r10, 37
+  je .L.case.add_type.7
+  cmp r10, 19
+  je .L.case.add_type.8
+  cmp r10, 18
+  je .L.case.add_type.9
+  cmp r10, 17
+  je .L.case.add_type.10
+  cmp r10, 16
+  je .L.case.add_type.11
+  cmp r10, 15
+  je .L.case.add_type.12
+  cmp r10, 38
+  je .L.case.add_type.13
+  cmp r10, 23
+  je .L.case.add_type.14
+  cmp r10, 22
+  je .L.case.add_type.15
+  cmp r10, 20
+  je .L.case.add_type.16
+  cmp r10, 21
+  je .L.case.add_type.17
+  cmp r10, 8
+  je .L.case.add_type.18
+  cmp r10, 9
+  je .L.case.add_type.19
+  cmp r10, 14
+  je .L.case.add_type.20
+  cmp r10, 10
+  je .L.case.add_type.21
+  cmp r10, 11
+  je .L.case.add_type.22
+  cmp r10, 12
+  je .L.case.add_type.23
+  cmp r10, 13
+  je .L.case.add_type.24
+  cmp r10, 0
+  je .L.case.add_type.25
+  cmp r10, 1
+  je .L.case.add_type.26
+  cmp r10, 2
+  je .L.case.add_type.27
+  cmp r10, 3
+  je .L.case.add_type.28
+  cmp r10, 4
+  je .L.case.add_type.29
+  cmp r10, 5
+  je .L.case.add_type.30
+  cmp r10, 6
+  je .L.case.add_type.31
+  cmp r10, 7
+  je .L.case.add_type.32
+  cmp r10, 39
+  je .L.case.add_type.33
+  jmp .L.break.add_type.5
+.loc 1 851 5
+.L.case.add_type.33:
+.loc 1 852 7
+  mov r10, offset ty_int
+  mov r10, [r10]
+  lea r11, [rbp-280]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 853 7
+  jmp .L.return.add_type
+.loc 1 854 5
+.L.case.add_type.25:
+.loc 1 855 5
+.L.case.add_type.26:
+.loc 1 856 5
+.L.case.add_type.27:
+.loc 1 857 5
+.L.case.add_type.28:
+.loc 1 858 5
+.L.case.add_type.29:
+.loc 1 859 5
+.L.case.add_type.30:
+.loc 1 860 5
+.L.case.add_type.31:
+.loc 1 861 5
+.L.case.add_type.32:
+.loc 1 862 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 40
+  push r10
+  sub rsp, 8
+  mov r10, offset usual_arith_conv
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 863 7
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-280]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 864 7
+  jmp .L.return.add_type
+.loc 1 865 5
+.L.case.add_type.21:
+.loc 1 866 5
+.L.case.add_type.22:
+.loc 1 867 5
+.L.case.add_type.23:
+.loc 1 868 5
+.L.case.add_type.24:
+.loc 1 869 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 40
+  push r10
+  sub rsp, 8
+  mov r10, offset usual_arith_conv
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 870 7
+  mov r10, offset ty_int
+  mov r10, [r10]
+  lea r11, [rbp-280]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 871 7
+  jmp .L.return.add_type
+.loc 1 872 5
+.L.case.add_type.20:
+.loc 1 873 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_cast
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-280]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.loc 1 874 7
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-280]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 875 7
+  jmp .L.return.add_type
+.loc 1 876 5
+.L.case.add_type.16:
+.loc 1 877 5
+.L.case.add_type.17:
+.loc 1 878 5
+.L.case.add_type.18:
+.loc 1 879 5
+.L.case.add_type.19:
+.loc 1 880 7
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-280]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 881 7
+  jmp .L.return.add_type
+.loc 1 882 5
+.L.case.add_type.14:
+.loc 1 883 5
+.L.case.add_type.15:
+.loc 1 884 7
+  mov r10, offset ty_int
+  mov r10, [r10]
+  lea r11, [rbp-280]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 885 7
+  jmp .L.return.add_type
+.loc 1 886 5
+.L.case.add_type.13:
+.loc 1 887 7
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 168
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-280]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 888 7
+  jmp .L.return.add_type
+.loc 1 889 5
+.L.case.add_type.12:
+.loc 1 890 7
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.add_type.35
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 64
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.true.add_type.35
+  mov r10, 0
+  jmp .L.end.add_type.35
+.L.true.add_type.35:
+  mov r10, 1
+.L.end.add_type.35:
+  cmp r10, 0
+  je .L.else.add_type.34
+.loc 1 891 9
+  mov r10, offset ty_void
+  mov r10, [r10]
+  lea r11, [rbp-280]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+  jmp .L.end.add_type.34
+.L.else.add_type.34:
+.loc 1 893 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 56
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 64
+  push r10
+  sub rsp, 8
+  mov r10, offset usual_arith_conv
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 894 9
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-280]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.L.end.add_type.34:
+.loc 1 896 7
+  jmp .L.return.add_type
+.loc 1 897 5
+.L.case.add_type.11:
+.loc 1 898 7
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-280]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 899 7
+  jmp .L.return.add_type
+.loc 1 900 5
+.L.case.add_type.10:
+.loc 1 901 7
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 104
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-280]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 902 7
+  jmp .L.return.add_type
+.loc 1 903 5
+.L.case.add_type.9:
+.loc 1 904 7
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-256]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 905 7
+  lea r10, [rbp-256]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 9
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.add_type.36
+.loc 1 906 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-256]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pointer_to
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-280]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+  jmp .L.end.add_type.36
+.L.else.add_type.36:
+.loc 1 908 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-256]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset pointer_to
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-280]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.L.end.add_type.36:
+.loc 1 909 7
+  jmp .L.return.add_type
+.loc 1 911 5
+.L.case.add_type.8:
+.loc 1 912 7
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.add_type.37
+.loc 1 913 9
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  lea r11, [rbp-280]
+  mov r11, [r11]
+  mov al, [r10+0]
+  mov [r11+0], al
+  mov al, [r10+1]
+  mov [r11+1], al
+  mov al, [r10+2]
+  mov [r11+2], al
+  mov al, [r10+3]
+  mov [r11+3], al
+  mov al, [r10+4]
+  mov [r11+4], al
+  mov al, [r10+5]
+  mov [r11+5], al
+  mov al, [r10+6]
+  mov [r11+6], al
+  mov al, [r10+7]
+  mov [r11+7], al
+  mov al, [r10+8]
+  mov [r11+8], al
+  mov al, [r10+9]
+  mov [r11+9], al
+  mov al, [r10+10]
+  mov [r11+10], al
+  mov al, [r10+11]
+  mov [r11+11], al
+  mov al, [r10+12]
+  mov [r11+12], al
+  mov al, [r10+13]
+  mov [r11+13], al
+  mov al, [r10+14]
+  mov [r11+14], al
+  mov al, [r10+15]
+  mov [r11+15], al
+  mov al, [r10+16]
+  mov [r11+16], al
+  mov al, [r10+17]
+  mov [r11+17], al
+  mov al, [r10+18]
+  mov [r11+18], al
+  mov al, [r10+19]
+  mov [r11+19], al
+  mov al, [r10+20]
+  mov [r11+20], al
+  mov al, [r10+21]
+  mov [r11+21], al
+  mov al, [r10+22]
+  mov [r11+22], al
+  mov al, [r10+23]
+  mov [r11+23], al
+  mov al, [r10+24]
+  mov [r11+24], al
+  mov al, [r10+25]
+  mov [r11+25], al
+  mov al, [r10+26]
+  mov [r11+26], al
+  mov al, [r10+27]
+  mov [r11+27], al
+  mov al, [r10+28]
+  mov [r11+28], al
+  mov al, [r10+29]
+  mov [r11+29], al
+  mov al, [r10+30]
+  mov [r11+30], al
+  mov al, [r10+31]
+  mov [r11+31], al
+  mov al, [r10+32]
+  mov [r11+32], al
+  mov al, [r10+33]
+  mov [r11+33], al
+  mov al, [r10+34]
+  mov [r11+34], al
+  mov al, [r10+35]
+  mov [r11+35], al
+  mov al, [r10+36]
+  mov [r11+36], al
+  mov al, [r10+37]
+  mov [r11+37], al
+  mov al, [r10+38]
+  mov [r11+38], al
+  mov al, [r10+39]
+  mov [r11+39], al
+  mov al, [r10+40]
+  mov [r11+40], al
+  mov al, [r10+41]
+  mov [r11+41], al
+  mov al, [r10+42]
+  mov [r11+42], al
+  mov al, [r10+43]
+  mov [r11+43], al
+  mov al, [r10+44]
+  mov [r11+44], al
+  mov al, [r10+45]
+  mov [r11+45], al
+  mov al, [r10+46]
+  mov [r11+46], al
+  mov al, [r10+47]
+  mov [r11+47], al
+  mov al, [r10+48]
+  mov [r11+48], al
+  mov al, [r10+49]
+  mov [r11+49], al
+  mov al, [r10+50]
+  mov [r11+50], al
+  mov al, [r10+51]
+  mov [r11+51], al
+  mov al, [r10+52]
+  mov [r11+52], al
+  mov al, [r10+53]
+  mov [r11+53], al
+  mov al, [r10+54]
+  mov [r11+54], al
+  mov al, [r10+55]
+  mov [r11+55], al
+  mov al, [r10+56]
+  mov [r11+56], al
+  mov al, [r10+57]
+  mov [r11+57], al
+  mov al, [r10+58]
+  mov [r11+58], al
+  mov al, [r10+59]
+  mov [r11+59], al
+  mov al, [r10+60]
+  mov [r11+60], al
+  mov al, [r10+61]
+  mov [r11+61], al
+  mov al, [r10+62]
+  mov [r11+62], al
+  mov al, [r10+63]
+  mov [r11+63], al
+  mov al, [r10+64]
+  mov [r11+64], al
+  mov al, [r10+65]
+  mov [r11+65], al
+  mov al, [r10+66]
+  mov [r11+66], al
+  mov al, [r10+67]
+  mov [r11+67], al
+  mov al, [r10+68]
+  mov [r11+68], al
+  mov al, [r10+69]
+  mov [r11+69], al
+  mov al, [r10+70]
+  mov [r11+70], al
+  mov al, [r10+71]
+  mov [r11+71], al
+  mov al, [r10+72]
+  mov [r11+72], al
+  mov al, [r10+73]
+  mov [r11+73], al
+  mov al, [r10+74]
+  mov [r11+74], al
+  mov al, [r10+75]
+  mov [r11+75], al
+  mov al, [r10+76]
+  mov [r11+76], al
+  mov al, [r10+77]
+  mov [r11+77], al
+  mov al, [r10+78]
+  mov [r11+78], al
+  mov al, [r10+79]
+  mov [r11+79], al
+  mov al, [r10+80]
+  mov [r11+80], al
+  mov al, [r10+81]
+  mov [r11+81], al
+  mov al, [r10+82]
+  mov [r11+82], al
+  mov al, [r10+83]
+  mov [r11+83], al
+  mov al, [r10+84]
+  mov [r11+84], al
+  mov al, [r10+85]
+  mov [r11+85], al
+  mov al, [r10+86]
+  mov [r11+86], al
+  mov al, [r10+87]
+  mov [r11+87], al
+  mov al, [r10+88]
+  mov [r11+88], al
+  mov al, [r10+89]
+  mov [r11+89], al
+  mov al, [r10+90]
+  mov [r11+90], al
+  mov al, [r10+91]
+  mov [r11+91], al
+  mov al, [r10+92]
+  mov [r11+92], al
+  mov al, [r10+93]
+  mov [r11+93], al
+  mov al, [r10+94]
+  mov [r11+94], al
+  mov al, [r10+95]
+  mov [r11+95], al
+  mov al, [r10+96]
+  mov [r11+96], al
+  mov al, [r10+97]
+  mov [r11+97], al
+  mov al, [r10+98]
+  mov [r11+98], al
+  mov al, [r10+99]
+  mov [r11+99], al
+  mov al, [r10+100]
+  mov [r11+100], al
+  mov al, [r10+101]
+  mov [r11+101], al
+  mov al, [r10+102]
+  mov [r11+102], al
+  mov al, [r10+103]
+  mov [r11+103], al
+  mov al, [r10+104]
+  mov [r11+104], al
+  mov al, [r10+105]
+  mov [r11+105], al
+  mov al, [r10+106]
+  mov [r11+106], al
+  mov al, [r10+107]
+  mov [r11+107], al
+  mov al, [r10+108]
+  mov [r11+108], al
+  mov al, [r10+109]
+  mov [r11+109], al
+  mov al, [r10+110]
+  mov [r11+110], al
+  mov al, [r10+111]
+  mov [r11+111], al
+  mov al, [r10+112]
+  mov [r11+112], al
+  mov al, [r10+113]
+  mov [r11+113], al
+  mov al, [r10+114]
+  mov [r11+114], al
+  mov al, [r10+115]
+  mov [r11+115], al
+  mov al, [r10+116]
+  mov [r11+116], al
+  mov al, [r10+117]
+  mov [r11+117], al
+  mov al, [r10+118]
+  mov [r11+118], al
+  mov al, [r10+119]
+  mov [r11+119], al
+  mov al, [r10+120]
+  mov [r11+120], al
+  mov al, [r10+121]
+  mov [r11+121], al
+  mov al, [r10+122]
+  mov [r11+122], al
+  mov al, [r10+123]
+  mov [r11+123], al
+  mov al, [r10+124]
+  mov [r11+124], al
+  mov al, [r10+125]
+  mov [r11+125], al
+  mov al, [r10+126]
+  mov [r11+126], al
+  mov al, [r10+127]
+  mov [r11+127], al
+  mov al, [r10+128]
+  mov [r11+128], al
+  mov al, [r10+129]
+  mov [r11+129], al
+  mov al, [r10+130]
+  mov [r11+130], al
+  mov al, [r10+131]
+  mov [r11+131], al
+  mov al, [r10+132]
+  mov [r11+132], al
+  mov al, [r10+133]
+  mov [r11+133], al
+  mov al, [r10+134]
+  mov [r11+134], al
+  mov al, [r10+135]
+  mov [r11+135], al
+  mov al, [r10+136]
+  mov [r11+136], al
+  mov al, [r10+137]
+  mov [r11+137], al
+  mov al, [r10+138]
+  mov [r11+138], al
+  mov al, [r10+139]
+  mov [r11+139], al
+  mov al, [r10+140]
+  mov [r11+140], al
+  mov al, [r10+141]
+  mov [r11+141], al
+  mov al, [r10+142]
+  mov [r11+142], al
+  mov al, [r10+143]
+  mov [r11+143], al
+  mov al, [r10+144]
+  mov [r11+144], al
+  mov al, [r10+145]
+  mov [r11+145], al
+  mov al, [r10+146]
+  mov [r11+146], al
+  mov al, [r10+147]
+  mov [r11+147], al
+  mov al, [r10+148]
+  mov [r11+148], al
+  mov al, [r10+149]
+  mov [r11+149], al
+  mov al, [r10+150]
+  mov [r11+150], al
+  mov al, [r10+151]
+  mov [r11+151], al
+  mov al, [r10+152]
+  mov [r11+152], al
+  mov al, [r10+153]
+  mov [r11+153], al
+  mov al, [r10+154]
+  mov [r11+154], al
+  mov al, [r10+155]
+  mov [r11+155], al
+  mov al, [r10+156]
+  mov [r11+156], al
+  mov al, [r10+157]
+  mov [r11+157], al
+  mov al, [r10+158]
+  mov [r11+158], al
+  mov al, [r10+159]
+  mov [r11+159], al
+  mov al, [r10+160]
+  mov [r11+160], al
+  mov al, [r10+161]
+  mov [r11+161], al
+  mov al, [r10+162]
+  mov [r11+162], al
+  mov al, [r10+163]
+  mov [r11+163], al
+  mov al, [r10+164]
+  mov [r11+164], al
+  mov al, [r10+165]
+  mov [r11+165], al
+  mov al, [r10+166]
+  mov [r11+166], al
+  mov al, [r10+167]
+  mov [r11+167], al
+  mov al, [r10+168]
+  mov [r11+168], al
+  mov al, [r10+169]
+  mov [r11+169], al
+  mov al, [r10+170]
+  mov [r11+170], al
+  mov al, [r10+171]
+  mov [r11+171], al
+  mov al, [r10+172]
+  mov [r11+172], al
+  mov al, [r10+173]
+  mov [r11+173], al
+  mov al, [r10+174]
+  mov [r11+174], al
+  mov al, [r10+175]
+  mov [r11+175], al
+  mov al, [r10+176]
+  mov [r11+176], al
+  mov al, [r10+177]
+  mov [r11+177], al
+  mov al, [r10+178]
+  mov [r11+178], al
+  mov al, [r10+179]
+  mov [r11+179], al
+  mov al, [r10+180]
+  mov [r11+180], al
+  mov al, [r10+181]
+  mov [r11+181], al
+  mov al, [r10+182]
+  mov [r11+182], al
+  mov al, [r10+183]
+  mov [r11+183], al
+.loc 1 914 9
+  jmp .L.return.add_type
+.L.end.add_type.37:
+.loc 1 917 7
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.add_type.38
+.loc 1 918 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.12
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.add_type.38:
+.loc 1 919 7
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.add_type.39
+.loc 1 920 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.13
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.add_type.39:
+.loc 1 922 7
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-280]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 923 7
+  jmp .L.return.add_type
+.loc 1 924 5
+.L.case.add_type.7:
+.loc 1 925 7
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 96
+  mov r10, [r10]
+  lea r11, [rbp-248]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 926 7
+.L.begin.add_type.40:
+  lea r10, [rbp-248]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.add_type.40
+.loc 1 927 9
+  lea r10, [rbp-248]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-248]
+  mov [r11], r10
+.L.continue.add_type.40:
+  jmp .L.begin.add_type.40
+.L.break.add_type.40:
+.loc 1 928 7
+  lea r10, [rbp-248]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-280]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 929 7
+  jmp .L.return.add_type
+.loc 1 931 5
+.L.case.add_type.6:
+.loc 1 932 7
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 120
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  lea r11, [rbp-280]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 934 39
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 120
+  mov r10, [r10]
+  add r10, 64
+  mov r10, [r10]
+  lea r11, [rbp-240]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 935 21
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-232]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-232]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-232]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-232]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-232]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-232]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-232]
+  mov r12, 48
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-232]
+  mov r12, 56
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-232]
+  mov r12, 64
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-232]
+  mov r12, 72
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-232]
+  mov r12, 80
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-232]
+  mov r12, 88
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-232]
+  mov r12, 96
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-232]
+  mov r12, 104
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-232]
+  mov r12, 112
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-232]
+  mov r12, 120
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-232]
+  mov r12, 128
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-232]
+  mov r12, 136
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-232]
+  mov r12, 144
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-232]
+  mov r12, 152
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-232]
+  mov r12, 160
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-232]
+  mov r12, 164
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-232]
+  mov r12, 168
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-232]
+  mov r12, 176
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 936 24
+  lea r10, [rbp-232]
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 938 7
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 128
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.add_type.41:
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.add_type.41
+.loc 1 939 9
+  lea r10, [rbp-240]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.add_type.42
+.loc 1 940 11
+  jmp .L.return.add_type
+.L.end.add_type.42:
+.loc 1 941 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-240]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_cast
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+  lea r11, [rbp-48]
+  mov [r11], r10
+.loc 1 942 9
+  lea r10, [rbp-240]
+  mov r10, [r10]
+  add r10, 80
+  mov r10, [r10]
+  lea r11, [rbp-240]
+  mov [r11], r10
+.L.continue.add_type.41:
+.loc 1 938 41
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  jmp .L.begin.add_type.41
+.L.break.add_type.41:
+.loc 1 944 7
+  lea r10, [rbp-232]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-280]
+  mov r11, [r11]
+  add r11, 128
+  mov [r11], r10
+.loc 1 945 7
+  jmp .L.return.add_type
+.L.break.add_type.5:
+.L.return.add_type:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
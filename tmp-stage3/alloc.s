@@ -0,0 +1,2326 @@
+.file 1 "alloc.c"
+.intel_syntax noprefix
+.bss
+.align 8
+phase_bytes:
+  .zero 80
+.align 8
+phase_allocs:
+  .zero 80
+.align 8
+kind_bytes:
+  .zero 112
+.align 8
+kind_allocs:
+  .zero 112
+.align 8
+arena_used:
+  .zero 8
+.align 8
+arena_reserved:
+  .zero 8
+.align 8
+nr_chunks:
+  .zero 8
+.align 8
+arena_left:
+  .zero 8
+.align 8
+arena_ptr:
+  .zero 8
+.align 8
+chunks:
+  .zero 8
+.align 1
+.globl mem_report
+mem_report:
+  .zero 1
+.data
+.align 1
+.L.data.35:
+  .byte 112
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 32
+  .byte 82
+  .byte 83
+  .byte 83
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 32
+  .byte 75
+  .byte 105
+  .byte 66
+  .byte 10
+  .zero 1
+.align 1
+.L.data.34:
+  .byte 10
+  .byte 97
+  .byte 114
+  .byte 101
+  .byte 110
+  .byte 97
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 117
+  .byte 110
+  .byte 107
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 32
+  .byte 75
+  .byte 105
+  .byte 66
+  .byte 32
+  .byte 114
+  .byte 101
+  .byte 115
+  .byte 101
+  .byte 114
+  .byte 118
+  .byte 101
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 32
+  .byte 75
+  .byte 105
+  .byte 66
+  .byte 32
+  .byte 117
+  .byte 115
+  .byte 101
+  .byte 100
+  .byte 10
+  .zero 1
+.align 1
+.L.data.33:
+  .byte 10
+  .byte 112
+  .byte 104
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 111
+  .byte 99
+  .byte 115
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 98
+  .byte 121
+  .byte 116
+  .byte 101
+  .byte 115
+  .byte 32
+  .byte 32
+  .byte 97
+  .byte 118
+  .byte 103
+  .byte 40
+  .byte 66
+  .byte 41
+  .byte 10
+  .zero 1
+.align 1
+.L.data.32:
+  .byte 116
+  .byte 111
+  .byte 116
+  .byte 97
+  .byte 108
+  .zero 1
+.align 1
+.L.data.31:
+  .byte 107
+  .byte 105
+  .byte 110
+  .byte 100
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 111
+  .byte 99
+  .byte 115
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 32
+  .byte 98
+  .byte 121
+  .byte 116
+  .byte 101
+  .byte 115
+  .byte 32
+  .byte 32
+  .byte 97
+  .byte 118
+  .byte 103
+  .byte 40
+  .byte 66
+  .byte 41
+  .byte 10
+  .zero 1
+.align 1
+.L.data.30:
+  .byte 109
+  .byte 101
+  .byte 109
+  .byte 111
+  .byte 114
+  .byte 121
+  .byte 32
+  .byte 114
+  .byte 101
+  .byte 112
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 10
+  .zero 1
+.align 1
+.L.data.29:
+  .byte 37
+  .byte 45
+  .byte 49
+  .byte 50
+  .byte 115
+  .byte 32
+  .byte 37
+  .byte 49
+  .byte 50
+  .byte 108
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 49
+  .byte 52
+  .byte 108
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 56
+  .byte 108
+  .byte 100
+  .byte 10
+  .zero 1
+.align 1
+.L.data.28:
+  .byte 111
+  .byte 117
+  .byte 116
+  .byte 32
+  .byte 111
+  .byte 102
+  .byte 32
+  .byte 109
+  .byte 101
+  .byte 109
+  .byte 111
+  .byte 114
+  .byte 121
+  .zero 1
+.align 1
+.L.data.27:
+  .byte 102
+  .byte 105
+  .byte 108
+  .byte 101
+  .zero 1
+.align 1
+.L.data.26:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 105
+  .byte 110
+  .byte 103
+  .zero 1
+.align 1
+.L.data.25:
+  .byte 103
+  .byte 118
+  .byte 97
+  .byte 114
+  .byte 95
+  .byte 105
+  .byte 110
+  .byte 105
+  .byte 116
+  .zero 1
+.align 1
+.L.data.24:
+  .byte 105
+  .byte 110
+  .byte 105
+  .byte 116
+  .byte 105
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 114
+  .zero 1
+.align 1
+.L.data.23:
+  .byte 102
+  .byte 117
+  .byte 110
+  .byte 99
+  .byte 116
+  .byte 105
+  .byte 111
+  .byte 110
+  .zero 1
+.align 1
+.L.data.22:
+  .byte 116
+  .byte 97
+  .byte 103
+  .byte 95
+  .byte 115
+  .byte 99
+  .byte 111
+  .byte 112
+  .byte 101
+  .zero 1
+.align 1
+.L.data.21:
+  .byte 118
+  .byte 97
+  .byte 114
+  .byte 95
+  .byte 115
+  .byte 99
+  .byte 111
+  .byte 112
+  .byte 101
+  .zero 1
+.align 1
+.L.data.20:
+  .byte 118
+  .byte 97
+  .byte 114
+  .zero 1
+.align 1
+.L.data.19:
+  .byte 109
+  .byte 101
+  .byte 109
+  .byte 98
+  .byte 101
+  .byte 114
+  .zero 1
+.align 1
+.L.data.18:
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .zero 1
+.align 1
+.L.data.17:
+  .byte 110
+  .byte 111
+  .byte 100
+  .byte 101
+  .zero 1
+.align 1
+.L.data.16:
+  .byte 109
+  .byte 97
+  .byte 99
+  .byte 114
+  .byte 111
+  .zero 1
+.align 1
+.L.data.15:
+  .byte 104
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 115
+  .byte 101
+  .byte 116
+  .zero 1
+.align 1
+.L.data.14:
+  .byte 116
+  .byte 111
+  .byte 107
+  .byte 101
+  .byte 110
+  .zero 1
+.align 1
+.L.data.13:
+  .byte 102
+  .byte 105
+  .byte 108
+  .byte 101
+  .zero 1
+.align 1
+.L.data.12:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 105
+  .byte 110
+  .byte 103
+  .zero 1
+.align 1
+.L.data.11:
+  .byte 103
+  .byte 118
+  .byte 97
+  .byte 114
+  .byte 95
+  .byte 105
+  .byte 110
+  .byte 105
+  .byte 116
+  .zero 1
+.align 1
+.L.data.10:
+  .byte 105
+  .byte 110
+  .byte 105
+  .byte 116
+  .byte 105
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 114
+  .zero 1
+.align 1
+.L.data.9:
+  .byte 102
+  .byte 117
+  .byte 110
+  .byte 99
+  .byte 116
+  .byte 105
+  .byte 111
+  .byte 110
+  .zero 1
+.align 1
+.L.data.8:
+  .byte 116
+  .byte 97
+  .byte 103
+  .byte 95
+  .byte 115
+  .byte 99
+  .byte 111
+  .byte 112
+  .byte 101
+  .zero 1
+.align 1
+.L.data.7:
+  .byte 118
+  .byte 97
+  .byte 114
+  .byte 95
+  .byte 115
+  .byte 99
+  .byte 111
+  .byte 112
+  .byte 101
+  .zero 1
+.align 1
+.L.data.6:
+  .byte 118
+  .byte 97
+  .byte 114
+  .zero 1
+.align 1
+.L.data.5:
+  .byte 109
+  .byte 101
+  .byte 109
+  .byte 98
+  .byte 101
+  .byte 114
+  .zero 1
+.align 1
+.L.data.4:
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .zero 1
+.align 1
+.L.data.3:
+  .byte 110
+  .byte 111
+  .byte 100
+  .byte 101
+  .zero 1
+.align 1
+.L.data.2:
+  .byte 109
+  .byte 97
+  .byte 99
+  .byte 114
+  .byte 111
+  .zero 1
+.align 1
+.L.data.1:
+  .byte 104
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 115
+  .byte 101
+  .byte 116
+  .zero 1
+.align 1
+.L.data.0:
+  .byte 116
+  .byte 111
+  .byte 107
+  .byte 101
+  .byte 110
+  .zero 1
+.align 8
+kind_name:
+  .quad .L.data.14+0
+  .quad .L.data.15+0
+  .quad .L.data.16+0
+  .quad .L.data.17+0
+  .quad .L.data.18+0
+  .quad .L.data.19+0
+  .quad .L.data.20+0
+  .quad .L.data.21+0
+  .quad .L.data.22+0
+  .quad .L.data.23+0
+  .quad .L.data.24+0
+  .quad .L.data.25+0
+  .quad .L.data.26+0
+  .quad .L.data.27+0
+.text
+assert:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.L.return.assert:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+va_end:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.L.return.va_end:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl count_alloc
+count_alloc:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-80], rsi
+  mov [rbp-84], edi
+.loc 1 793 29
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset current_phase
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-68]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 794 3
+  mov r10, offset kind_allocs
+  lea r11, [rbp-84]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-64]
+  mov [r11], r10
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+.loc 1 795 3
+  mov r10, offset kind_bytes
+  lea r11, [rbp-84]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-56]
+  mov [r11], r10
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r10, r11
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 796 3
+  mov r10, offset phase_allocs
+  lea r11, [rbp-68]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+.loc 1 797 3
+  mov r10, offset phase_bytes
+  lea r11, [rbp-68]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+.L.return.count_alloc:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl reset_alloc_stats
+reset_alloc_stats:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 802 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset kind_allocs
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 112
+  push r10
+  sub rsp, 8
+  mov r10, offset memset
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 803 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset kind_bytes
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 112
+  push r10
+  sub rsp, 8
+  mov r10, offset memset
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 804 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset phase_allocs
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 80
+  push r10
+  sub rsp, 8
+  mov r10, offset memset
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 805 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset phase_bytes
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 80
+  push r10
+  sub rsp, 8
+  mov r10, offset memset
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.reset_alloc_stats:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+new_chunk:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-64], rdi
+.loc 1 812 45
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 16
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset calloc
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 813 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.new_chunk.1
+.loc 1 814 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.28
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.new_chunk.1:
+.loc 1 815 3
+  mov r10, offset chunks
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 816 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 817 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, offset chunks
+  mov [r11], r10
+.loc 1 818 3
+  mov r10, offset nr_chunks
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+.loc 1 819 3
+  mov r10, offset arena_reserved
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  movabs r11, 16
+  lea r12, [rbp-64]
+  mov r12, [r12]
+  add r11, r12
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 820 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 16
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.new_chunk
+.L.return.new_chunk:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl alloc_obj
+alloc_obj:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-72], rsi
+  mov [rbp-76], edi
+.loc 1 825 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-76]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset count_alloc
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 828 3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r11, 7
+  movsx r11, r11d
+  add r10, r11
+  mov r11, 7
+  not r11
+  movsx r11, r11d
+  and r10, r11
+  lea r11, [rbp-72]
+  mov [r11], r10
+.loc 1 829 3
+  mov r10, offset arena_used
+  lea r11, [rbp-64]
+  mov [r11], r10
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  add r10, r11
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 831 3
+  mov r10, 65536
+  movsx r10, r10d
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.alloc_obj.1
+.loc 1 832 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_chunk
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.alloc_obj
+.L.end.alloc_obj.1:
+.loc 1 834 3
+  mov r10, offset arena_left
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.alloc_obj.2
+.loc 1 835 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1048576
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset new_chunk
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r11, offset arena_ptr
+  mov [r11], r10
+.loc 1 836 5
+  mov r10, 1048576
+  movsx r10, r10d
+  mov r11, offset arena_left
+  mov [r11], r10
+.L.end.alloc_obj.2:
+.loc 1 839 22
+  mov r10, offset arena_ptr
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 840 3
+  mov r10, offset arena_ptr
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  mov r12, 1
+  movsx r12, r12d
+  imul r11, r12
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 841 3
+  mov r10, offset arena_left
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  sub r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 842 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.alloc_obj
+.L.return.alloc_obj:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl alloc_str
+alloc_str:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 847 42
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 12
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 848 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset memcpy
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 849 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.alloc_str
+.L.return.alloc_str:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+free_chunks:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdi
+.loc 1 853 3
+.L.begin.free_chunks.1:
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.free_chunks.1
+.loc 1 854 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 855 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset free
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 856 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov [r11], r10
+.L.continue.free_chunks.1:
+  jmp .L.begin.free_chunks.1
+.L.break.free_chunks.1:
+.L.return.free_chunks:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl free_arena
+free_arena:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 862 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset chunks
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset free_chunks
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 863 3
+  mov r10, 0
+  movsx r10, r10d
+  mov r11, offset chunks
+  mov [r11], r10
+.loc 1 864 3
+  mov r10, 0
+  movsx r10, r10d
+  mov r11, offset arena_ptr
+  mov [r11], r10
+.loc 1 865 3
+  mov r10, 0
+  movsx r10, r10d
+  mov r11, offset arena_left
+  mov [r11], r10
+.L.return.free_arena:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl enter_arena
+enter_arena:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 870 42
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 24
+  push r10
+  sub rsp, 8
+  mov r10, offset calloc
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 871 3
+  mov r10, offset chunks
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 872 3
+  mov r10, offset arena_ptr
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 873 3
+  mov r10, offset arena_left
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 874 3
+  mov r10, 0
+  movsx r10, r10d
+  mov r11, offset chunks
+  mov [r11], r10
+.loc 1 875 3
+  mov r10, 0
+  movsx r10, r10d
+  mov r11, offset arena_ptr
+  mov [r11], r10
+.loc 1 876 3
+  mov r10, 0
+  movsx r10, r10d
+  mov r11, offset arena_left
+  mov [r11], r10
+.loc 1 877 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.enter_arena
+.L.return.enter_arena:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl leave_arena
+leave_arena:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdi
+.loc 1 883 20
+  mov r10, offset chunks
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 884 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  mov r11, offset chunks
+  mov [r11], r10
+.loc 1 885 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  mov r11, offset arena_ptr
+  mov [r11], r10
+.loc 1 886 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  mov r11, offset arena_left
+  mov [r11], r10
+.loc 1 887 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 888 3
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 889 3
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.L.return.leave_arena:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl release_arena
+release_arena:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 894 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset free_chunks
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 895 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset free
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.release_arena:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+print_row:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdx
+  mov [rbp-56], rsi
+  mov [rbp-64], rdi
+.loc 1 899 41
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  cmp r10, 0
+  je  .L.else.print_row.1
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  jmp .L.end.print_row.1
+.L.else.print_row.1:
+  mov r10, 0
+  movsx r10, r10d
+.L.end.print_row.1:
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 900 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.29
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop r9
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.print_row:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl print_mem_report
+print_mem_report:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 256
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-248], rdi
+.loc 1 905 24
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-240]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 906 23
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-232]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 908 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.30
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-248]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 909 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.31
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 910 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-220]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.print_mem_report.1:
+  lea r10, [rbp-220]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 14
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.print_mem_report.1
+.loc 1 911 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset kind_name
+  lea r11, [rbp-220]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset kind_allocs
+  lea r11, [rbp-220]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset kind_bytes
+  lea r11, [rbp-220]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset print_row
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 912 5
+  lea r10, [rbp-240]
+  lea r11, [rbp-208]
+  mov [r11], r10
+  lea r10, [rbp-208]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, offset kind_allocs
+  lea r12, [rbp-220]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 8
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov r11, [r11]
+  add r10, r11
+  lea r11, [rbp-208]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 913 5
+  lea r10, [rbp-232]
+  lea r11, [rbp-200]
+  mov [r11], r10
+  lea r10, [rbp-200]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, offset kind_bytes
+  lea r12, [rbp-220]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 8
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov r11, [r11]
+  add r10, r11
+  lea r11, [rbp-200]
+  mov r11, [r11]
+  mov [r11], r10
+.L.continue.print_mem_report.1:
+.loc 1 910 39
+  lea r10, [rbp-220]
+  lea r11, [rbp-216]
+  mov [r11], r10
+  lea r10, [rbp-216]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-216]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-216]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.print_mem_report.1
+.L.break.print_mem_report.1:
+.loc 1 915 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.32
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-240]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-232]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset print_row
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 917 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.33
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 918 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-188]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.print_mem_report.2:
+  lea r10, [rbp-188]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 9
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.print_mem_report.2
+.loc 1 919 5
+  mov r10, offset phase_allocs
+  lea r11, [rbp-188]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.print_mem_report.3
+.loc 1 920 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-188]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset phase_name
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset phase_allocs
+  lea r11, [rbp-188]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset phase_bytes
+  lea r11, [rbp-188]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset print_row
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.print_mem_report.3:
+.L.continue.print_mem_report.2:
+.loc 1 918 35
+  lea r10, [rbp-188]
+  lea r11, [rbp-184]
+  mov [r11], r10
+  lea r10, [rbp-184]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-184]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-184]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.print_mem_report.2
+.L.break.print_mem_report.2:
+.loc 1 922 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.34
+  push r10
+  sub rsp, 8
+.loc 1 923 11
+  mov r10, offset nr_chunks
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset arena_reserved
+  mov r10, [r10]
+  mov r11, 1024
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset arena_used
+  mov r10, [r10]
+  mov r11, 1024
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  push r10
+  sub rsp, 8
+.loc 1 922 3
+  mov r10, offset fprintf
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 925 19
+.loc 1 926 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-176]
+  push r10
+  sub rsp, 8
+  mov r10, offset getrusage
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 927 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.35
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-176]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.print_mem_report:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,1877 @@
+typedef struct FILE FILE;
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+typedef struct {
+  int gp_offset;
+  int fp_offset;
+  void *overflow_arg_area;
+  void *reg_save_area;
+} va_list[1];
+
+struct timespec {
+  long tv_sec;
+  long tv_nsec;
+};
+
+struct rusage {
+  long ru_utime[2];
+  long ru_stime[2];
+  long ru_maxrss;
+  long ru_reserved[13];
+};
+
+struct stat {
+  unsigned long st_dev;
+  unsigned long st_ino;
+  unsigned long st_nlink;
+  unsigned int st_mode;
+  unsigned int st_uid;
+  unsigned int st_gid;
+  int __pad0;
+  unsigned long st_rdev;
+  long st_size;
+  long st_blksize;
+  long st_blocks;
+  struct timespec st_atim;
+  struct timespec st_mtim;
+  struct timespec st_ctim;
+  long __reserved[3];
+};
+
+struct sockaddr_un {
+  unsigned short sun_family;
+  char sun_path[108];
+};
+
+struct iovec {
+  void *iov_base;
+  long iov_len;
+};
+
+struct msghdr {
+  void *msg_name;
+  int msg_namelen;
+  struct iovec *msg_iov;
+  long msg_iovlen;
+  void *msg_control;
+  long msg_controllen;
+  int msg_flags;
+};
+
+struct pollfd {
+  int fd;
+  short events;
+  short revents;
+};
+
+typedef struct DIR DIR;
+
+struct dirent {
+  unsigned long d_ino;
+  long d_off;
+  unsigned short d_reclen;
+  unsigned char d_type;
+  char d_name[256];
+};
+
+enum { EINTR = 4 };
+enum { O_RDONLY = 0, O_WRONLY = 1, O_RDWR = 2, O_CREAT = 64, O_TRUNC = 512 };
+enum { LOCK_EX = 2 };
+enum { S_IFMT = 61440, S_IFREG = 32768 };
+enum { PROT_READ = 1, PROT_WRITE = 2 };
+enum { MAP_PRIVATE = 2, MAP_FIXED = 16, MAP_ANONYMOUS = 32, MAP_POPULATE = 32768 };
+enum { _SC_PAGESIZE = 30 };
+enum { AF_UNIX = 1, SOCK_STREAM = 1, SOL_SOCKET = 1, SCM_RIGHTS = 1 };
+enum { MSG_CTRUNC = 8, MSG_NOSIGNAL = 16384 };
+enum { POLLIN = 1 };
+enum { RUSAGE_SELF = 0 };
+enum { CLOCK_MONOTONIC = 1, CLOCK_PROCESS_CPUTIME_ID = 2 };
+
+void *malloc(long size);
+void *calloc(long nmemb, long size);
+void *realloc(void *buf, long size);
+int *__errno_location();
+char *strerror(int errnum);
+FILE *fopen(char *pathname, char *mode);
+long fread(void *ptr, long size, long nmemb, FILE *stream);
+int fclose(FILE *fp);
+int feof(FILE *stream);
+static void assert() {}
+int strcmp(char *s1, char *s2);
+int strncasecmp(char *s1, char *s2);
+int printf(char *fmt, ...);
+int sprintf(char *buf, char *fmt, ...);
+int fprintf(FILE *fp, char *fmt, ...);
+int vfprintf(FILE *fp, char *fmt, va_list ap);
+long strlen(char *p);
+int strncmp(char *p, char *q);
+void *memvpy(char *dst, char *src, long n);
+char *strndup(char *p, long n);
+int isspace(int c);
+int ispunct(int c);
+int isdigit(int c);
+char *strstr(char *haystack, char *needle);
+static void va_end(va_list ap) {}
+long strtoul(char *nptr, char **endptr, int base);
+char *strncpy(char *dest, char *src, long n);
+void exit(int code);
+int atoi(char *nptr);
+char *strrchr(char *s, int c);
+int fflush(FILE *stream);
+int fork(void);
+int waitpid(int pid, int *status, int options);
+int unlink(char *pathname);
+int creat(char *pathname, int mode);
+void *memset(void *s, int c, long n);
+int memcmp(void *s1, void *s2, long n);
+char *strchr(char *s, int c);
+long strtol(char *nptr, char **endptr, int base);
+long write(int fd, void *buf, long count);
+void *memcpy(void *dst, void *src, long n);
+int clock_gettime(int clockid, struct timespec *tp);
+int getrusage(int who, struct rusage *usage);
+void free(void *ptr);
+char *strcpy(char *dest, char *src);
+long read(int fd, void *buf, long count);
+int close(int fd);
+int dup2(int oldfd, int newfd);
+int pipe(int *pipefd);
+int chdir(char *path);
+char *getcwd(char *buf, long size);
+char *realpath(char *path, char *resolved_path);
+int stat(char *path, struct stat *buf);
+int socket(int domain, int type, int protocol);
+int bind(int fd, struct sockaddr *addr, int len);
+int listen(int fd, int backlog);
+int accept(int fd, struct sockaddr *addr, int *len);
+int connect(int fd, struct sockaddr *addr, int len);
+long send(int fd, void *buf, long len, int flags);
+long sendmsg(int fd, struct msghdr *msg, int flags);
+long recvmsg(int fd, struct msghdr *msg, int flags);
+int poll(struct pollfd *fds, long nfds, int timeout);
+int open(char *path, int flags, ...);
+int fstat(int fd, struct stat *buf);
+int flock(int fd, int op);
+void *mmap(void *addr, long len, int prot, int flags, int fd, long off);
+int munmap(void *addr, long len);
+long sysconf(int name);
+long pread(int fd, void *buf, long count, long offset);
+long pwrite(int fd, void *buf, long count, long offset);
+int ftruncate(int fd, long length);
+int getpid(void);
+int rename(char *oldpath, char *newpath);
+int mkdir(char *path, int mode);
+int utime(char *path, void *times);
+DIR *opendir(char *name);
+struct dirent *readdir(DIR *dirp);
+int closedir(DIR *dirp);
+
+typedef struct Type Type;
+typedef struct Member Member;
+typedef struct GvarInitializer GvarInitializer;
+
+//
+// tokenize.c
+//
+
+// Token
+typedef enum {
+  TK_RESERVED, // Keyworeds or punctuators
+  TK_IDENT,    // Identifiers
+  TK_STR,      // String literals
+  TK_NUM,      // Integer literals
+  TK_EOF,      // End-of-file markers
+} TokenKind;
+
+// Keywords, preprocessor directive names and punctuators are given
+// an ID by the tokenizer, so that they can be compared as integers.
+// The order must match `token_names` in tokenize.c.
+typedef enum {
+  ID_NONE,
+
+  // Keywords
+  KW_RETURN, KW_IF, KW_ELSE, KW_FOR, KW_WHILE, KW_INT, KW_SIZEOF,
+  KW_CHAR, KW_STRUCT, KW_UNION, KW_SHORT, KW_LONG, KW_VOID,
+  KW_TYPEDEF, KW_BOOL, KW_ENUM, KW_STATIC, KW_BREAK, KW_CONTINUE,
+  KW_GOTO, KW_SWITCH, KW_CASE, KW_DEFAULT, KW_EXTERN, KW_ALIGNOF,
+  KW_ALIGNAS, KW_DO, KW_SIGNED, KW_UNSIGNED, KW_CONST, KW_VOLATILE,
+
+  // Preprocessor directive names other than keywords
+  PP_INCLUDE, PP_DEFINE, PP_UNDEF, PP_IFDEF, PP_IFNDEF, PP_ELIF,
+  PP_ENDIF, PP_PRAGMA, PP_DEFINED, PP_ONCE,
+
+  // Punctuators, longest first
+  P_ELLIPSIS, P_SHL_ASSIGN, P_SHR_ASSIGN,
+  P_EQ, P_NE, P_LE, P_GE, P_ARROW, P_ADD_ASSIGN, P_SUB_ASSIGN,
+  P_MUL_ASSIGN, P_DIV_ASSIGN, P_INC, P_DEC, P_MOD_ASSIGN,
+  P_AND_ASSIGN, P_OR_ASSIGN, P_XOR_ASSIGN, P_LOGAND, P_LOGOR, P_SHL,
+  P_SHR, P_HASHHASH,
+  P_LPAREN, P_RPAREN, P_LBRACE, P_RBRACE, P_LBRACKET, P_RBRACKET,
+  P_SEMICOLON, P_COMMA, P_DOT, P_ASSIGN, P_LT, P_GT, P_PLUS, P_MINUS,
+  P_STAR, P_SLASH, P_PERCENT, P_AMP, P_PIPE, P_CARET, P_TILDE, P_NOT,
+  P_QUESTION, P_COLON, P_HASH,
+
+  NR_TOKEN_IDS,
+} TokenId;
+
+// Set of macro names, represented as a Patricia tree keyed by
+// name_id(). There is only one Hideset object for each set, so equal
+// sets are the same pointer. A Hideset must not be modified.
+typedef struct Hideset Hideset;
+struct Hideset {
+  Hideset *left;       // 0 if leaf
+  Hideset *right;
+  long prefix;         // Bits below `bit` shared by all names, or leaf's ID
+  long bit;            // The bit that tells which child has a name
+  char *name;          // If leaf, the name
+  unsigned long bloom; // One bit for each name, for quick rejection
+};
+
+// Source file of tokens. Tokens read from the same input share one.
+typedef struct {
+  char *name;     // Input filename
+  char *contents; // Entire input string
+  int file_no;    // File number for .loc directive
+
+  // Offsets of the beginnings of lines, recorded as the file is
+  // tokenized
+  int *lines;
+  int nr_lines;
+  int lines_cap;
+} File;
+
+// Payload of a literal token
+typedef struct {
+  long val;       // If TK_NUM, its value
+  Type *ty;       // If TK_NUM, its type
+  char *contents; // If TK_STR, its contents, not null-terminated
+  int cont_len;   // If TK_STR, its length excluding terminating '\0'
+} Literal;
+
+// Token type
+//
+// Fields the preprocessor and the parser look at for every token
+// come first. Those used only for some tokens or only for error
+// messages and debug info are kept out of line.
+typedef struct Token Token;
+struct Token {
+  TokenKind kind;   // Token kind
+  TokenId id;       // Keyword or punctuator ID, or ID_NONE
+  Token *next;      // Next token
+  char *loc;        // Token location
+  int len;          // Token length
+  int lineno;       // Line number
+  char *name;       // If identifier or keyword, its interned spelling
+  Hideset *hideset; // For macro expension
+  _Bool at_bol;      // True if this token is at beginning of line
+  _Bool has_space;   // True if this token follows a space character
+  _Bool is_raw;      // True if this token is read from a file
+  _Bool is_shared;   // True if this token is in a file's cached tokens
+
+  File *file;       // Source file
+  Literal *lit;     // If TK_NUM or TK_STR, its value
+};
+
+extern _Bool fast_lexer;
+
+void error(char *fmt, ...);
+void error_tok(Token *tok, char *fmt, ...);
+void warn_tok(Token *tok, char *fmt, ...);
+Token *skip(Token *tok, TokenId id);
+_Bool consume(Token **rest, Token *tok, TokenId id);
+char *intern(char *s, int len);
+long name_id(char *name);
+File *new_file(char *name, int file_no, char *contents);
+int get_column(Token *tok);
+void convert_keywords(Token *tok);
+Token *next_token(Token *tok);
+void free_token(Token *tok);
+Token *tokenize_lazy(char *filename, int file_no, char *p, Token *cont);
+Token *tokenize_cached(Token *src, char *filename, int file_no,
+                       Token *cont);
+Token *tokenize(char *filename, int file_no, char *p);
+
+//
+// preprocess.c
+//
+
+extern _Bool pp_report;
+
+// Identifies a file and its version.
+typedef struct {
+  unsigned long dev;
+  unsigned long ino;
+  long size;
+  long mtime_sec;
+  long mtime_nsec;
+} FileId;
+
+_Bool get_file_id(char *path, FileId *id);
+char *read_file_string(char *path, long *mapping);
+void free_file_string(char *buf, long mapping);
+int add_file(char *path);
+void save_file_ids(void);
+char *load_file_ids(void);
+void save_macros(void);
+void load_macros(void);
+Token *read_file(char *path);
+void print_pp_report(char *input);
+
+//
+// parse.c
+//
+
+// Variable
+typedef struct Var Var;
+struct Var {
+  Var *next;
+  char *name;    // Variable name
+  Type *ty;      // Type
+  Token *tok;    // representative token
+  _Bool is_local; // local or global
+  int align;     // alignment
+
+  _Bool is_static;
+  GvarInitializer *initializer;
+
+  // Local variable
+  int offset;
+
+  // Gloval variable
+  char *contents;
+  int cont_len;
+};
+
+// AST node
+typedef enum {
+  ND_ADD,       // +
+  ND_SUB,       // -
+  ND_MUL,       // *
+  ND_DIV,       // /
+  ND_MOD,       // %
+  ND_BITAND,    // &
+  ND_BITOR,     // |
+  ND_BITXOR,    // ^
+  ND_SHL,       // <<
+  ND_SHR,       // >>
+  ND_EQ,        // ==
+  ND_NE,        // !=
+  ND_LT,        // <
+  ND_LE,        // <=
+  ND_ASSIGN,    // =
+  ND_COND,      // ?:
+  ND_COMMA,     // ,
+  ND_MEMBER,    // . (struct member access)
+  ND_ADDR,      // unary &
+  ND_DEREF,     // unary *
+  ND_NOT,       // !
+  ND_BITNOT,    // ~
+  ND_LOGAND,    // &&
+  ND_LOGOR,     // ||
+  ND_RETURN,    // "return"
+  ND_IF,        // "if"
+  ND_FOR,       // "for" or "while"
+  ND_DO,        // "do"
+  ND_SWITCH,    // "switch"
+  ND_CASE,      // "case"
+  ND_BLOCK,     // { ... }
+  ND_BREAK,     // "break"
+  ND_CONTINUE,  // "continue"
+  ND_GOTO,      // "goto"
+  ND_LABEL,     // Labeled statement
+  ND_FUNCALL,   // Function call
+  ND_EXPR_STMT, // Expression statement
+  ND_STMT_EXPR, // Statement expression
+  ND_VAR,       // Variable
+  ND_NUM,       // Integer
+  ND_CAST,      // Type cast
+} NodeKind;
+
+// AST node type
+typedef struct Node Node;
+struct Node {
+  NodeKind kind; // Node kind
+  Node *next;    // Next node
+  Type *ty;      // Type, e.g. int or pointer to tin
+  Token *tok;    // Representative token
+
+  Node *lhs;     // Left-hand side
+  Node *rhs;     // Right-hand side
+
+  // "if" or "for" statement
+  Node *cond;
+  Node *then;
+  Node *els;
+  Node *init;
+  Node *inc;
+
+  // Assignment
+  _Bool is_init;
+
+  // Blcok or statement expression
+  Node *body;
+
+  // Struct member access
+  Member *member;
+
+  // Function call
+  char *funcname;
+  Type *func_ty;
+  Node *args;
+
+  // Goto or labeled statement
+  char *label_name;
+
+  // Switch-cases
+  Node *case_next;
+  Node *default_case;
+  int case_label;
+  int case_end_label;
+
+  // Variable
+  Var *var;
+
+  // Integer literal
+  long val;
+};
+
+// Global variable initializer. Global variables can be initialized
+// either by a constatnt expression or a pointer to another global
+// bariable with an addend.
+struct GvarInitializer {
+  GvarInitializer *next;
+  int offset;
+
+  // Scalar value
+  int sz;
+  long val;
+
+  // Byte string of `sz` bytes
+  char *bytes;
+
+  // Reference to another global variable
+  char *label;
+  long addend;
+};
+
+typedef struct Function Function;
+struct Function {
+  Function *next;
+  char *name;
+  Var *params;
+  _Bool is_static;
+  _Bool is_varargs;
+
+  Node *node;
+  Var *locals;
+  int stack_size;
+  long nr_nodes; // The number of AST nodes, as an estimate of work
+};
+
+typedef struct {
+  Var *globals;
+  Function *fns;
+} Program;
+
+Node *new_cast(Node *expr, Type *ty);
+long const_expr(Token **rest, Token *tok);
+void save_scopes(void);
+void load_scopes(void);
+Program *parse(Token *tok);
+
+//
+// type.c
+//
+
+typedef enum {
+  TY_VOID,
+  TY_BOOL,
+  TY_CHAR,
+  TY_SHORT,
+  TY_INT,
+  TY_LONG,
+  TY_ENUM,
+  TY_PTR,
+  TY_FUNC,
+  TY_ARRAY,
+  TY_STRUCT,
+} TypeKind;
+
+struct Type {
+  TypeKind kind;
+  int size;           // sizeof() value
+  int align;          // alignment
+  _Bool is_unsigned;   // unsigned or signed
+  _Bool is_incomplete; // incomplete type
+  _Bool is_const;
+
+  // Pointer
+  Type *base;
+
+  // Declaration
+  Token *name;
+  Token *name_pos;
+
+  // Array
+  int array_len;
+
+  // Struct
+  Member *members;
+
+  // Function type
+  Type *return_ty;
+  Type *params;
+  _Bool is_varargs;
+  Type *next;
+};
+
+// Struct member
+struct Member {
+  Member *next;
+  Type *ty;
+  Token *tok; // for error message
+  Token *name;
+  int align;
+  int offset;
+};
+
+extern Type *ty_void;
+extern Type *ty_bool;
+
+extern Type *ty_char;
+extern Type *ty_short;
+extern Type *ty_int;
+extern Type *ty_long;
+
+extern Type *ty_uchar;
+extern Type *ty_ushort;
+extern Type *ty_uint;
+extern Type *ty_ulong;
+
+_Bool is_integer(Type *ty);
+Type *copy_type(Type *ty);
+Type *pointer_to(Type *base);
+int align_to(int n, int align);
+Type *func_type(Type *return_ty);
+Type *array_of(Type *base, int size);
+Type *enum_type(void);
+Type *struct_type(void);
+int size_of(Type *ty);
+Type *copy_type(Type *ty);
+void add_type(Node *node);
+
+//
+// codegen.c
+//
+
+extern int codegen_jobs;
+
+void codegen(Program *prog);
+
+//
+// emit.c
+//
+
+void open_output(char *path);
+void flush_output(void);
+void write_output(char *p, long len);
+void capture_output(void);
+char *take_output(void);
+void emitf(char *fmt, ...);
+void println(char *fmt, ...);
+long output_size(void);
+char *output_since(long pos);
+
+//
+// assemble.c
+//
+
+void assemble(char *input, char *path);
+
+//
+// timer.c
+//
+
+typedef enum {
+  PH_READ,       // read_file_string
+  PH_TOKENIZE,   // tokenize
+  PH_PREPROCESS, // preprocess
+  PH_KEYWORDS,   // convert_keywords
+  PH_PARSE,      // parse
+  PH_LAYOUT,     // stack offset assignment
+  PH_EMIT_DATA,  // emit_data
+  PH_EMIT_TEXT,  // emit_text
+  PH_ASSEMBLE,   // assemble
+  NR_PHASES,
+} Phase;
+
+extern _Bool time_report;
+extern _Bool time_report_json;
+
+void timer_start(Phase ph);
+void timer_stop(void);
+void timer_count(Phase ph, long n);
+void timer_count_lines(long n);
+void reset_timer(void);
+Phase current_phase(void);
+char *phase_name(Phase ph);
+void print_time_report(char *input);
+
+//
+// alloc.c
+//
+
+typedef enum {
+  AK_TOKEN,       // Token
+  AK_HIDESET,     // Hideset
+  AK_MACRO,       // Macro, MacroParam, MacroArg and CondIncl
+  AK_NODE,        // Node
+  AK_TYPE,        // Type
+  AK_MEMBER,      // Member
+  AK_VAR,         // Var
+  AK_VAR_SCOPE,   // VarScope
+  AK_TAG_SCOPE,   // TagScope
+  AK_FUNCTION,    // Function and Program
+  AK_INITIALIZER, // Initializer
+  AK_GVAR_INIT,   // GvarInitializer
+  AK_STRING,      // Names, labels and string literals
+  AK_FILE,        // Source file contents
+  NR_ALLOC_KINDS,
+} AllocKind;
+
+typedef struct Arena Arena;
+
+extern _Bool mem_report;
+
+void reset_alloc_stats(void);
+void count_alloc(AllocKind kind, long size);
+void *alloc_obj(AllocKind kind, long size);
+char *alloc_str(char *s, long len);
+void free_arena(void);
+Arena *enter_arena(void);
+void leave_arena(Arena *arena);
+void release_arena(Arena *arena);
+void print_mem_report(char *input);
+
+//
+// server.c
+//
+
+Token *find_cached_file(char *path);
+void note_input_file(char *path);
+char *read_all(int fd);
+void run_server(char *path, int *argc, char ***argv);
+int run_client(char *path, int argc, char **argv);
+
+//
+// pch.c
+//
+
+void pch_put_long(long val);
+void pch_put_str(char *s);
+void pch_put_token(Token *tok);
+void pch_put_tokens(Token *tok);
+void pch_put_type(Type *ty);
+void pch_put_var(Var *var);
+void write_pch(char *path);
+
+long pch_get_long(void);
+char *pch_get_str(void);
+char *pch_get_name(void);
+Token *pch_get_token(void);
+Token *pch_get_tokens(void);
+Type *pch_get_type(void);
+Var *pch_get_var(void);
+void read_pch(char *path);
+
+//
+// cache.c
+//
+
+extern char *cache_dir;
+extern long cache_max_size;
+extern _Bool cache_stats;
+
+char *cache_key(Token *tok, char *hdr, long hdr_len);
+_Bool cache_lookup(char *key);
+void cache_store(char *key, char *p, long len);
+void print_cache_stats(void);
+
+//
+// hashmap.c
+//
+
+typedef struct {
+  char *key;
+  int keylen;
+  void *val;
+} HashEntry;
+
+typedef struct {
+  HashEntry *buckets;
+  int capacity;
+  int used;
+
+  // Statistics
+  long lookups;
+  long probes;
+} HashMap;
+
+void *hashmap_get(HashMap *map, char *key);
+void *hashmap_get2(HashMap *map, char *key, int keylen);
+void hashmap_put(HashMap *map, char *key, void *val);
+void hashmap_put2(HashMap *map, char *key, int keylen, void *val);
+void hashmap_delete(HashMap *map, char *key);
+void hashmap_delete2(HashMap *map, char *key, int keylen);
+
+//
+// main.c
+//
+
+extern _Bool preprocess_only;
+extern _Bool output_object;
+extern char *include_pch;
+// This file implements a built-in assembler for `-c`. It translates
+// the assembly text that codegen.c produces into an ELF64 relocatable
+// object file, so that we don't have to run an external assembler.
+//
+// This is not a general-purpose assembler. It understands only the
+// subset of the Intel syntax that codegen.c emits, i.e. mov, lea,
+// movsx, movzx, arithmetic and logical operations, setcc, jcc, call,
+// push, pop and a handful of data directives. Every jump is encoded
+// with a 32-bit displacement, so we don't need branch relaxation and
+// can assemble in a single pass, patching jump targets at the end.
+//
+// .file and .loc directives are ignored, so the resulting object
+// file has no line number information.
+
+
+typedef struct {
+  char *data;
+  long len;
+  long cap;
+} ByteBuf;
+
+// Sections
+enum { SEC_TEXT, SEC_DATA, SEC_BSS };
+
+typedef struct Symbol Symbol;
+struct Symbol {
+  Symbol *next;
+  char *name;
+  int sec;        // -1 if undefined
+  long offset;
+  _Bool is_global;
+  int index;      // Index in .symtab
+};
+
+// Relocation
+typedef struct Reloc Reloc;
+struct Reloc {
+  Reloc *next;
+  long offset;
+  int type;
+  Symbol *sym;
+  long addend;
+};
+
+// A jump whose 32-bit displacement is resolved after all labels
+// are defined.
+typedef struct Fixup Fixup;
+struct Fixup {
+  Fixup *next;
+  long offset;
+  Symbol *sym;
+  char *line;
+};
+
+// Instruction operand
+typedef enum {
+  OP_REG, // Register
+  OP_MEM, // Memory reference [base+disp]
+  OP_IMM, // Immediate value
+  OP_SYM, // Symbol address or jump target
+} OperandKind;
+
+typedef struct {
+  OperandKind kind;
+  int reg;   // Register number, or the base register if OP_MEM
+  int size;  // Operand size in bytes. 0 if unknown.
+  long val;  // Immediate value or displacement
+  Symbol *sym;
+} Operand;
+
+// ELF constants
+enum {
+  R_X86_64_64 = 1,
+  R_X86_64_32S = 11,
+
+  SHT_PROGBITS = 1,
+  SHT_SYMTAB = 2,
+  SHT_STRTAB = 3,
+  SHT_RELA = 4,
+  SHT_NOBITS = 8,
+
+  SHF_WRITE = 1,
+  SHF_ALLOC = 2,
+  SHF_EXECINSTR = 4,
+  SHF_INFO_LINK = 0x40,
+
+  STB_LOCAL = 0,
+  STB_GLOBAL = 1,
+
+  STT_NOTYPE = 0,
+  STT_OBJECT = 1,
+  STT_FUNC = 2,
+  STT_SECTION = 3,
+  STT_FILE = 4,
+
+  SHN_ABS = 0xfff1,
+};
+
+// Section header
+typedef struct {
+  int name;
+  int type;
+  long flags;
+  long offset;
+  long size;
+  int link;
+  int info;
+  int align;
+  int entsize;
+} Shdr;
+
+// Section header indices
+enum {
+  SH_NULL, SH_TEXT, SH_DATA, SH_BSS, SH_RELA_TEXT, SH_RELA_DATA,
+  SH_SYMTAB, SH_STRTAB, SH_SHSTRTAB, SH_NOTE, SH_NUM,
+};
+
+static ByteBuf text;
+static ByteBuf data;
+static long bss_size;
+static int align[3];
+static int cur_sec;
+
+static HashMap symbols;
+static Symbol sym_head;
+static Symbol *sym_last = &sym_head;
+static char *source_file;
+
+static Reloc *text_relocs;
+static Reloc *data_relocs;
+static Fixup *fixups;
+
+static HashMap registers;
+
+// The current line for error messages
+static char *cur_line;
+
+static char *reg64[] = {
+  "rax", "rcx", "rdx", "rbx", "rsp", "rbp", "rsi", "rdi",
+  "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15",
+};
+
+static char *reg32[] = {
+  "eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi",
+  "r8d", "r9d", "r10d", "r11d", "r12d", "r13d", "r14d", "r15d",
+};
+
+static char *reg16[] = {
+  "ax", "cx", "dx", "bx", "sp", "bp", "si", "di",
+  "r8w", "r9w", "r10w", "r11w", "r12w", "r13w", "r14w", "r15w",
+};
+
+static char *reg8[] = {
+  "al", "cl", "dl", "bl", "spl", "bpl", "sil", "dil",
+  "r8b", "r9b", "r10b", "r11b", "r12b", "r13b", "r14b", "r15b",
+};
+
+static void asm_error(char *msg) {
+  char *end = cur_line;
+  while (*end && *end != '\n')
+    end++;
+  error("internal error: %s: %.*s", msg, (int)(end - cur_line), cur_line);
+}
+
+//
+// Output buffers
+//
+
+static void buf_reserve(ByteBuf *buf, long len) {
+  if (buf->len + len <= buf->cap)
+    return;
+  while (buf->len + len > buf->cap)
+    buf->cap = buf->cap ? buf->cap * 2 : 4096;
+  buf->data = realloc(buf->data, buf->cap);
+}
+
+static void buf_put(ByteBuf *buf, void *p, long len) {
+  buf_reserve(buf, len);
+  memcpy(buf->data + buf->len, p, len);
+  buf->len += len;
+}
+
+// Appends a little-endian integer of a given size.
+static void buf_int(ByteBuf *buf, long val, int size) {
+  char tmp[8];
+  for (int i = 0; i < size; i++)
+    tmp[i] = val >> (i * 8);
+  buf_put(buf, tmp, size);
+}
+
+static void buf_zero(ByteBuf *buf, long len) {
+  buf_reserve(buf, len);
+  memset(buf->data + buf->len, 0, len);
+  buf->len += len;
+}
+
+static void buf_align(ByteBuf *buf, int align) {
+  buf_zero(buf, align_to(buf->len, align) - buf->len);
+}
+
+static void patch32(ByteBuf *buf, long offset, long val) {
+  for (int i = 0; i < 4; i++)
+    buf->data[offset + i] = val >> (i * 8);
+}
+
+static void emit8(int val) {
+  buf_int(&text, val, 1);
+}
+
+//
+// Symbols
+//
+
+static Symbol *get_symbol(char *name, int len) {
+  Symbol *sym = hashmap_get2(&symbols, name, len);
+  if (sym)
+    return sym;
+
+  sym = calloc(1, sizeof(Symbol));
+  sym->name = strndup(name, len);
+  sym->sec = -1;
+  hashmap_put2(&symbols, sym->name, len, sym);
+  sym_last = sym_last->next = sym;
+  return sym;
+}
+
+static long cur_offset(void) {
+  if (cur_sec == SEC_TEXT)
+    return text.len;
+  if (cur_sec == SEC_DATA)
+    return data.len;
+  return bss_size;
+}
+
+static void define_symbol(char *name, int len) {
+  Symbol *sym = get_symbol(name, len);
+  if (sym->sec != -1)
+    asm_error("symbol already defined");
+  sym->sec = cur_sec;
+  sym->offset = cur_offset();
+}
+
+static _Bool is_local_label(Symbol *sym) {
+  return !strncmp(sym->name, ".L", 2);
+}
+
+static void add_reloc(Reloc **list, long offset, int type, Symbol *sym, long addend) {
+  Reloc *rel = calloc(1, sizeof(Reloc));
+  rel->offset = offset;
+  rel->type = type;
+  rel->sym = sym;
+  rel->addend = addend;
+  rel->next = *list;
+  *list = rel;
+}
+
+//
+// Operand parser
+//
+
+static void init_registers(void) {
+  if (registers.buckets)
+    return;
+
+  // Values are encoded as size * 16 + register number + 1
+  // so that we don't store a null pointer.
+  for (int i = 0; i < 16; i++) {
+    hashmap_put(&registers, reg64[i], (void *)(long)(8 * 16 + i + 1));
+    hashmap_put(&registers, reg32[i], (void *)(long)(4 * 16 + i + 1));
+    hashmap_put(&registers, reg16[i], (void *)(long)(2 * 16 + i + 1));
+    hashmap_put(&registers, reg8[i], (void *)(long)(1 * 16 + i + 1));
+  }
+}
+
+// Parses a register name. Returns 0 if it is not a register.
+static _Bool parse_reg(Operand *op, char *s, int len) {
+  long val = (long)hashmap_get2(&registers, s, len);
+  if (!val)
+    return 0;
+  val--;
+  op->reg = val % 16;
+  op->size = val / 16;
+  return 1;
+}
+
+static long parse_number(char *s, int len) {
+  char *end;
+  long val = strtol(s, &end, 10);
+  if (end != s + len)
+    asm_error("invalid number");
+  return val;
+}
+
+static _Bool startswith(char *p, int len, char *q) {
+  int n = strlen(q);
+  return n <= len && !strncmp(p, q, n);
+}
+
+// Parses `[reg]`, `[reg+disp]` or `[reg-disp]`.
+static void parse_mem(Operand *op, char *s, int len) {
+  if (s[0] != '[' || s[len - 1] != ']')
+    asm_error("invalid memory operand");
+
+  char *p = s + 1;
+  char *end = s + len - 1;
+  char *q = p;
+  while (q < end && *q != '+' && *q != '-')
+    q++;
+
+  Operand base = {};
+  if (!parse_reg(&base, p, q - p) || base.size != 8)
+    asm_error("invalid base register");
+
+  op->kind = OP_MEM;
+  op->reg = base.reg;
+  op->val = 0;
+  if (q < end)
+    op->val = parse_number(q, end - q);
+}
+
+static void parse_operand(Operand *op, char *s, int len) {
+  *op = (Operand){};
+
+  if (startswith(s, len, "byte ptr ")) {
+    parse_mem(op, s + 9, len - 9);
+    op->size = 1;
+    return;
+  }
+
+  if (startswith(s, len, "word ptr ")) {
+    parse_mem(op, s + 9, len - 9);
+    op->size = 2;
+    return;
+  }
+
+  if (startswith(s, len, "dword ptr ")) {
+    parse_mem(op, s + 10, len - 10);
+    op->size = 4;
+    return;
+  }
+
+  if (startswith(s, len, "qword ptr ")) {
+    parse_mem(op, s + 10, len - 10);
+    op->size = 8;
+    return;
+  }
+
+  if (s[0] == '[') {
+    parse_mem(op, s, len);
+    return;
+  }
+
+  if (startswith(s, len, "offset ")) {
+    op->kind = OP_SYM;
+    op->sym = get_symbol(s + 7, len - 7);
+    return;
+  }
+
+  if (isdigit(s[0]) || s[0] == '-') {
+    op->kind = OP_IMM;
+    op->val = parse_number(s, len);
+    return;
+  }
+
+  if (parse_reg(op, s, len)) {
+    op->kind = OP_REG;
+    return;
+  }
+
+  op->kind = OP_SYM;
+  op->sym = get_symbol(s, len);
+}
+
+//
+// Instruction encoder
+//
+
+// Returns 1 if a given operand is spl, bpl, sil or dil, which
+// can be accessed only with a REX prefix.
+static _Bool needs_rex8(Operand *op) {
+  return op && op->kind == OP_REG && op->size == 1 && 4 <= op->reg && op->reg < 8;
+}
+
+// Emits prefixes, opcode and ModRM (and SIB and displacement if
+// needed) bytes. `reg` is a register number or an opcode extension
+// for the reg field. `rm` is a register or a memory operand. `src`
+// is the register operand in the reg field, if any.
+static void emit_modrm(int size, int opcode, int opcode2, int reg, Operand *rm, Operand *src) {
+  if (size == 2)
+    emit8(0x66);
+
+  int rex = 0x40;
+  if (size == 8)
+    rex |= 8;
+  if (reg >= 8)
+    rex |= 4;
+  if (rm->reg >= 8)
+    rex |= 1;
+  if (rex != 0x40 || needs_rex8(rm) || needs_rex8(src))
+    emit8(rex);
+
+  emit8(opcode);
+  if (opcode2 >= 0)
+    emit8(opcode2);
+
+  if (rm->kind == OP_REG) {
+    emit8(0xc0 | ((reg & 7) << 3) | (rm->reg & 7));
+    return;
+  }
+
+  if (rm->kind != OP_MEM)
+    asm_error("invalid operand");
+
+  int base = rm->reg & 7;
+  int mod;
+  if (rm->val == 0 && base != 5)
+    mod = 0;
+  else if (-128 <= rm->val && rm->val <= 127)
+    mod = 1;
+  else
+    mod = 2;
+
+  emit8((mod << 6) | ((reg & 7) << 3) | base);
+
+  // rsp and r12 as a base register require a SIB byte.
+  if (base == 4)
+    emit8(0x24);
+
+  if (mod == 1)
+    buf_int(&text, rm->val, 1);
+  else if (mod == 2)
+    buf_int(&text, rm->val, 4);
+}
+
+// Emits an instruction that encodes a register in its opcode,
+// such as push, pop or mov with an immediate.
+static void emit_opreg(_Bool rex_w, int opcode, Operand *op) {
+  int rex = 0x40;
+  if (rex_w)
+    rex |= 8;
+  if (op->reg >= 8)
+    rex |= 1;
+  if (rex != 0x40 || needs_rex8(op))
+    emit8(rex);
+  emit8(opcode + (op->reg & 7));
+}
+
+static _Bool is_rm(Operand *op) {
+  return op->kind == OP_REG || op->kind == OP_MEM;
+}
+
+static _Bool is_int8(long val) {
+  return -128 <= val && val <= 127;
+}
+
+static _Bool is_int32(long val) {
+  return -2147483648 <= val && val <= 2147483647;
+}
+
+static int operand_size(Operand *x, Operand *y) {
+  if (x->size)
+    return x->size;
+  if (y && y->size)
+    return y->size;
+  asm_error("unknown operand size");
+  return 0;
+}
+
+// mov
+static void asm_mov(Operand *dst, Operand *src) {
+  int size = operand_size(dst, src);
+
+  if (is_rm(dst) && src->kind == OP_REG) {
+    emit_modrm(size, size == 1 ? 0x88 : 0x89, -1, src->reg, dst, src);
+    return;
+  }
+
+  if (dst->kind == OP_REG && src->kind == OP_MEM) {
+    emit_modrm(size, size == 1 ? 0x8a : 0x8b, -1, dst->reg, src, dst);
+    return;
+  }
+
+  if (dst->kind == OP_REG && src->kind == OP_SYM) {
+    // mov r64, imm32 (sign-extended) with a relocation
+    if (size != 8)
+      asm_error("invalid operand size");
+    emit_modrm(8, 0xc7, -1, 0, dst, 0);
+    add_reloc(&text_relocs, text.len, R_X86_64_32S, src->sym, 0);
+    buf_int(&text, 0, 4);
+    return;
+  }
+
+  if (src->kind != OP_IMM)
+    asm_error("invalid operand");
+
+  if (dst->kind == OP_REG && size == 8 && !is_int32(src->val)) {
+    emit_opreg(1, 0xb8, dst);
+    buf_int(&text, src->val, 8);
+    return;
+  }
+
+  if (dst->kind == OP_REG && size == 4) {
+    emit_opreg(0, 0xb8, dst);
+    buf_int(&text, src->val, 4);
+    return;
+  }
+
+  if (size == 1) {
+    emit_modrm(1, 0xc6, -1, 0, dst, 0);
+    buf_int(&text, src->val, 1);
+    return;
+  }
+
+  emit_modrm(size, 0xc7, -1, 0, dst, 0);
+  buf_int(&text, src->val, size == 2 ? 2 : 4);
+}
+
+// add, or, and, sub, xor and cmp
+static void asm_alu(int ext, Operand *dst, Operand *src) {
+  int size = operand_size(dst, src);
+
+  if (is_rm(dst) && src->kind == OP_REG) {
+    emit_modrm(size, ext * 8 + (size == 1 ? 0 : 1), -1, src->reg, dst, src);
+    return;
+  }
+
+  if (dst->kind == OP_REG && src->kind == OP_MEM) {
+    emit_modrm(size, ext * 8 + (size == 1 ? 2 : 3), -1, dst->reg, src, dst);
+    return;
+  }
+
+  if (src->kind != OP_IMM)
+    asm_error("invalid operand");
+
+  if (size == 1) {
+    emit_modrm(1, 0x80, -1, ext, dst, 0);
+    buf_int(&text, src->val, 1);
+  } else if (is_int8(src->val)) {
+    emit_modrm(size, 0x83, -1, ext, dst, 0);
+    buf_int(&text, src->val, 1);
+  } else {
+    emit_modrm(size, 0x81, -1, ext, dst, 0);
+    buf_int(&text, src->val, size == 2 ? 2 : 4);
+  }
+}
+
+// movsx and movzx
+static void asm_movx(_Bool is_signed, Operand *dst, Operand *src) {
+  if (dst->kind != OP_REG || !is_rm(src))
+    asm_error("invalid operand");
+
+  if (src->size == 1)
+    emit_modrm(dst->size, 0x0f, is_signed ? 0xbe : 0xb6, dst->reg, src, 0);
+  else if (src->size == 2)
+    emit_modrm(dst->size, 0x0f, is_signed ? 0xbf : 0xb7, dst->reg, src, 0);
+  else if (src->size == 4 && dst->size == 8 && is_signed)
+    emit_modrm(8, 0x63, -1, dst->reg, src, 0);
+  else
+    asm_error("invalid operand size");
+}
+
+// Unary operations with an opcode extension, i.e. not, div and idiv
+static void asm_unary(int ext, Operand *op) {
+  if (!is_rm(op) || !op->size)
+    asm_error("invalid operand");
+  emit_modrm(op->size, op->size == 1 ? 0xf6 : 0xf7, -1, ext, op, 0);
+}
+
+// shl, shr and sar
+static void asm_shift(int ext, Operand *dst, Operand *src) {
+  if (!is_rm(dst) || src->kind != OP_REG || src->size != 1 || src->reg != 1)
+    asm_error("invalid operand");
+  emit_modrm(dst->size, dst->size == 1 ? 0xd2 : 0xd3, -1, ext, dst, 0);
+}
+
+static void asm_jump(int opcode, int opcode2, Operand *op) {
+  if (op->kind != OP_SYM)
+    asm_error("invalid jump target");
+
+  emit8(opcode);
+  if (opcode2 >= 0)
+    emit8(opcode2);
+
+  Fixup *fix = calloc(1, sizeof(Fixup));
+  fix->offset = text.len;
+  fix->sym = op->sym;
+  fix->line = cur_line;
+  fix->next = fixups;
+  fixups = fix;
+  buf_int(&text, 0, 4);
+}
+
+// Condition codes for jcc and setcc
+static int cond_code(char *s) {
+  static char *conds[] = {
+    "o", "no", "b", "ae", "e", "ne", "be", "a",
+    "s", "ns", "p", "np", "l", "ge", "le", "g",
+  };
+
+  for (int i = 0; i < sizeof(conds) / sizeof(*conds); i++)
+    if (!strcmp(s, conds[i]))
+      return i;
+  return -1;
+}
+
+static void expect_operands(int nops, int n) {
+  if (nops != n)
+    asm_error("wrong number of operands");
+}
+
+static void assemble_insn(char *insn, Operand *ops, int nops) {
+  if (cur_sec != SEC_TEXT)
+    asm_error("instruction outside .text");
+
+  if (!strcmp(insn, "mov")) {
+    expect_operands(nops, 2);
+    asm_mov(&ops[0], &ops[1]);
+    return;
+  }
+
+  if (!strcmp(insn, "movabs")) {
+    expect_operands(nops, 2);
+    if (ops[0].kind != OP_REG || ops[0].size != 8 || ops[1].kind != OP_IMM)
+      asm_error("invalid operand");
+    emit_opreg(1, 0xb8, &ops[0]);
+    buf_int(&text, ops[1].val, 8);
+    return;
+  }
+
+  if (!strcmp(insn, "lea")) {
+    expect_operands(nops, 2);
+    if (ops[0].kind != OP_REG || ops[1].kind != OP_MEM)
+      asm_error("invalid operand");
+    emit_modrm(ops[0].size, 0x8d, -1, ops[0].reg, &ops[1], 0);
+    return;
+  }
+
+  if (!strcmp(insn, "movsx")) {
+    expect_operands(nops, 2);
+    asm_movx(1, &ops[0], &ops[1]);
+    return;
+  }
+
+  if (!strcmp(insn, "movzx") || !strcmp(insn, "movzb")) {
+    expect_operands(nops, 2);
+    if (insn[4] == 'b' && ops[1].kind == OP_MEM)
+      ops[1].size = 1;
+    asm_movx(0, &ops[0], &ops[1]);
+    return;
+  }
+
+  static char *alu[] = {"add", "or", "adc", "sbb", "and", "sub", "xor", "cmp"};
+  for (int i = 0; i < sizeof(alu) / sizeof(*alu); i++) {
+    if (!strcmp(insn, alu[i])) {
+      expect_operands(nops, 2);
+      asm_alu(i, &ops[0], &ops[1]);
+      return;
+    }
+  }
+
+  if (!strcmp(insn, "imul")) {
+    expect_operands(nops, 2);
+    if (ops[0].kind != OP_REG || !is_rm(&ops[1]))
+      asm_error("invalid operand");
+    emit_modrm(ops[0].size, 0x0f, 0xaf, ops[0].reg, &ops[1], 0);
+    return;
+  }
+
+  if (!strcmp(insn, "not")) {
+    expect_operands(nops, 1);
+    asm_unary(2, &ops[0]);
+    return;
+  }
+
+  if (!strcmp(insn, "div")) {
+    expect_operands(nops, 1);
+    asm_unary(6, &ops[0]);
+    return;
+  }
+
+  if (!strcmp(insn, "idiv")) {
+    expect_operands(nops, 1);
+    asm_unary(7, &ops[0]);
+    return;
+  }
+
+  if (!strcmp(insn, "shl")) {
+    expect_operands(nops, 2);
+    asm_shift(4, &ops[0], &ops[1]);
+    return;
+  }
+
+  if (!strcmp(insn, "shr")) {
+    expect_operands(nops, 2);
+    asm_shift(5, &ops[0], &ops[1]);
+    return;
+  }
+
+  if (!strcmp(insn, "sar")) {
+    expect_operands(nops, 2);
+    asm_shift(7, &ops[0], &ops[1]);
+    return;
+  }
+
+  if (!strncmp(insn, "set", 3) && cond_code(insn + 3) >= 0) {
+    expect_operands(nops, 1);
+    if (!is_rm(&ops[0]))
+      asm_error("invalid operand");
+    emit_modrm(1, 0x0f, 0x90 + cond_code(insn + 3), 0, &ops[0], 0);
+    return;
+  }
+
+  if (!strcmp(insn, "jmp")) {
+    expect_operands(nops, 1);
+    asm_jump(0xe9, -1, &ops[0]);
+    return;
+  }
+
+  if (insn[0] == 'j' && cond_code(insn + 1) >= 0) {
+    expect_operands(nops, 1);
+    asm_jump(0x0f, 0x80 + cond_code(insn + 1), &ops[0]);
+    return;
+  }
+
+  if (!strcmp(insn, "call")) {
+    expect_operands(nops, 1);
+    if (ops[0].kind != OP_REG || ops[0].size != 8)
+      asm_error("invalid operand");
+    emit_modrm(4, 0xff, -1, 2, &ops[0], 0);
+    return;
+  }
+
+  if (!strcmp(insn, "push") || !strcmp(insn, "pop")) {
+    expect_operands(nops, 1);
+    if (ops[0].kind != OP_REG || ops[0].size != 8)
+      asm_error("invalid operand");
+    emit_opreg(0, insn[1] == 'u' ? 0x50 : 0x58, &ops[0]);
+    return;
+  }
+
+  if (!strcmp(insn, "ret")) {
+    expect_operands(nops, 0);
+    emit8(0xc3);
+    return;
+  }
+
+  if (!strcmp(insn, "cqo")) {
+    expect_operands(nops, 0);
+    emit8(0x48);
+    emit8(0x99);
+    return;
+  }
+
+  if (!strcmp(insn, "cdq")) {
+    expect_operands(nops, 0);
+    emit8(0x99);
+    return;
+  }
+
+  asm_error("unknown instruction");
+}
+
+//
+// Directives
+//
+
+static void assemble_data(char *directive, int size, char *arg, int len) {
+  if (cur_sec != SEC_DATA)
+    asm_error("data directive outside .data");
+
+  // A number or `sym+addend` or `sym-addend`.
+  if (isdigit(arg[0]) || arg[0] == '-') {
+    buf_int(&data, parse_number(arg, len), size);
+    return;
+  }
+
+  char *p = arg;
+  while (p < arg + len && *p != '+' && *p != '-')
+    p++;
+
+  if (size != 8)
+    asm_error("symbol reference must be 8 bytes");
+
+  long addend = 0;
+  if (p < arg + len)
+    addend = parse_number(p, arg + len - p);
+  add_reloc(&data_relocs, data.len, R_X86_64_64, get_symbol(arg, p - arg), addend);
+  buf_int(&data, 0, 8);
+}
+
+static void assemble_directive(char *directive, char *arg, int len) {
+  if (!strcmp(directive, ".text")) {
+    cur_sec = SEC_TEXT;
+    return;
+  }
+
+  if (!strcmp(directive, ".data")) {
+    cur_sec = SEC_DATA;
+    return;
+  }
+
+  if (!strcmp(directive, ".bss")) {
+    cur_sec = SEC_BSS;
+    return;
+  }
+
+  if (!strcmp(directive, ".globl")) {
+    get_symbol(arg, len)->is_global = 1;
+    return;
+  }
+
+  if (!strcmp(directive, ".align")) {
+    int n = parse_number(arg, len);
+    if (align[cur_sec] < n)
+      align[cur_sec] = n;
+
+    if (cur_sec == SEC_TEXT)
+      buf_align(&text, n);
+    else if (cur_sec == SEC_DATA)
+      buf_align(&data, n);
+    else
+      bss_size = align_to(bss_size, n);
+    return;
+  }
+
+  if (!strcmp(directive, ".zero")) {
+    int n = parse_number(arg, len);
+    if (cur_sec == SEC_TEXT)
+      buf_zero(&text, n);
+    else if (cur_sec == SEC_DATA)
+      buf_zero(&data, n);
+    else
+      bss_size += n;
+    return;
+  }
+
+  if (!strcmp(directive, ".byte")) {
+    assemble_data(directive, 1, arg, len);
+    return;
+  }
+
+  if (!strcmp(directive, ".short")) {
+    assemble_data(directive, 2, arg, len);
+    return;
+  }
+
+  if (!strcmp(directive, ".long")) {
+    assemble_data(directive, 4, arg, len);
+    return;
+  }
+
+  if (!strcmp(directive, ".quad")) {
+    assemble_data(directive, 8, arg, len);
+    return;
+  }
+
+  if (!strcmp(directive, ".file")) {
+    // Use the first filename for an STT_FILE symbol.
+    char *p = strchr(arg, '"');
+    if (p && !source_file)
+      source_file = strndup(p + 1, arg + len - p - 2);
+    return;
+  }
+
+  if (!strcmp(directive, ".loc") || !strcmp(directive, ".intel_syntax"))
+    return;
+
+  asm_error("unknown directive");
+}
+
+// Assembles a single line.
+static void assemble_line(char *p, char *end) {
+  cur_line = p;
+
+  while (p < end && *p == ' ')
+    p++;
+  if (p == end)
+    return;
+
+  // Label
+  if (end[-1] == ':') {
+    define_symbol(p, end - 1 - p);
+    return;
+  }
+
+  // Read a mnemonic or a directive name.
+  char name[16];
+  char *q = p;
+  while (q < end && *q != ' ')
+    q++;
+
+  int len = q - p;
+  if (len >= sizeof(name))
+    asm_error("unknown instruction");
+  memcpy(name, p, len);
+  name[len] = '\0';
+
+  while (q < end && *q == ' ')
+    q++;
+
+  if (name[0] == '.') {
+    assemble_directive(name, q, end - q);
+    return;
+  }
+
+  // Read operands.
+  Operand ops[2];
+  int nops = 0;
+  while (q < end) {
+    char *start = q;
+    while (q < end && *q != ',')
+      q++;
+    if (nops == 2)
+      asm_error("too many operands");
+    parse_operand(&ops[nops++], start, q - start);
+    if (q < end)
+      q += 2; // skip ", "
+  }
+
+  assemble_insn(name, ops, nops);
+}
+
+static void resolve_fixups(void) {
+  for (Fixup *fix = fixups; fix; fix = fix->next) {
+    cur_line = fix->line;
+    if (fix->sym->sec != SEC_TEXT)
+      asm_error("undefined jump target");
+    patch32(&text, fix->offset, fix->sym->offset - (fix->offset + 4));
+  }
+}
+
+//
+// ELF writer
+//
+
+static int add_string(ByteBuf *strtab, char *s) {
+  int offset = strtab->len;
+  buf_put(strtab, s, strlen(s) + 1);
+  return offset;
+}
+
+static void write_symbol(ByteBuf *buf, int name, int bind, int type, int shndx, long val) {
+  buf_int(buf, name, 4);
+  buf_int(buf, (bind << 4) | type, 1);
+  buf_int(buf, 0, 1);
+  buf_int(buf, shndx, 2);
+  buf_int(buf, val, 8);
+  buf_int(buf, 0, 8);
+}
+
+static void write_relocs(ByteBuf *buf, Reloc *rel) {
+  for (; rel; rel = rel->next) {
+    Symbol *sym = rel->sym;
+    long addend = rel->addend;
+    int index;
+
+    if (sym->sec == -1 && is_local_label(sym))
+      error("internal error: undefined symbol %s", sym->name);
+
+    if (sym->sec != -1 && is_local_label(sym)) {
+      // References to local labels are converted to references
+      // to their section symbols.
+      index = SH_TEXT + sym->sec + (source_file ? 1 : 0);
+      addend += sym->offset;
+    } else {
+      index = sym->index;
+    }
+
+    buf_int(buf, rel->offset, 8);
+    buf_int(buf, ((long)index << 32) | rel->type, 8);
+    buf_int(buf, addend, 8);
+  }
+}
+
+static void write_shdr(ByteBuf *buf, Shdr *sh) {
+  buf_int(buf, sh->name, 4);
+  buf_int(buf, sh->type, 4);
+  buf_int(buf, sh->flags, 8);
+  buf_int(buf, 0, 8);  // sh_addr
+  buf_int(buf, sh->offset, 8);
+  buf_int(buf, sh->size, 8);
+  buf_int(buf, sh->link, 4);
+  buf_int(buf, sh->info, 4);
+  buf_int(buf, sh->align, 8);
+  buf_int(buf, sh->entsize, 8);
+}
+
+static int symbol_type(Symbol *sym) {
+  if (sym->sec == SEC_TEXT)
+    return STT_FUNC;
+  if (sym->sec == -1)
+    return STT_NOTYPE;
+  return STT_OBJECT;
+}
+
+static void write_elf(char *path) {
+  ByteBuf strtab = {};
+  ByteBuf symtab = {};
+  buf_int(&strtab, 0, 1);
+
+  // Null symbol, an optional file symbol and section symbols
+  write_symbol(&symtab, 0, STB_LOCAL, STT_NOTYPE, 0, 0);
+  int nsyms = 1;
+
+  if (source_file) {
+    write_symbol(&symtab, add_string(&strtab, source_file), STB_LOCAL, STT_FILE, SHN_ABS, 0);
+    nsyms++;
+  }
+
+  for (int i = SH_TEXT; i <= SH_BSS; i++) {
+    write_symbol(&symtab, 0, STB_LOCAL, STT_SECTION, i, 0);
+    nsyms++;
+  }
+
+  // Local symbols must precede global ones.
+  for (Symbol *sym = sym_head.next; sym; sym = sym->next) {
+    if (sym->is_global || sym->sec == -1 || is_local_label(sym))
+      continue;
+    sym->index = nsyms++;
+    write_symbol(&symtab, add_string(&strtab, sym->name), STB_LOCAL,
+                 symbol_type(sym), SH_TEXT + sym->sec, sym->offset);
+  }
+
+  int first_global = nsyms;
+
+  for (Symbol *sym = sym_head.next; sym; sym = sym->next) {
+    if (is_local_label(sym) || !(sym->is_global || sym->sec == -1))
+      continue;
+    sym->index = nsyms++;
+    write_symbol(&symtab, add_string(&strtab, sym->name), STB_GLOBAL,
+                 symbol_type(sym), sym->sec == -1 ? 0 : SH_TEXT + sym->sec,
+                 sym->offset);
+  }
+
+  ByteBuf rela_text = {};
+  ByteBuf rela_data = {};
+  write_relocs(&rela_text, text_relocs);
+  write_relocs(&rela_data, data_relocs);
+
+  ByteBuf shstrtab = {};
+  buf_int(&shstrtab, 0, 1);
+  int name_text = add_string(&shstrtab, ".text");
+  int name_data = add_string(&shstrtab, ".data");
+  int name_bss = add_string(&shstrtab, ".bss");
+  int name_rela_text = add_string(&shstrtab, ".rela.text");
+  int name_rela_data = add_string(&shstrtab, ".rela.data");
+  int name_symtab = add_string(&shstrtab, ".symtab");
+  int name_strtab = add_string(&shstrtab, ".strtab");
+  int name_shstrtab = add_string(&shstrtab, ".shstrtab");
+  int name_note = add_string(&shstrtab, ".note.GNU-stack");
+
+  // Lay out the file: the ELF header, section contents and then
+  // the section header table.
+  ByteBuf out = {};
+  buf_zero(&out, 64);
+
+  buf_align(&out, 16);
+  long off_text = out.len;
+  buf_put(&out, text.data, text.len);
+
+  buf_align(&out, 16);
+  long off_data = out.len;
+  buf_put(&out, data.data, data.len);
+
+  buf_align(&out, 8);
+  long off_rela_text = out.len;
+  buf_put(&out, rela_text.data, rela_text.len);
+
+  long off_rela_data = out.len;
+  buf_put(&out, rela_data.data, rela_data.len);
+
+  long off_symtab = out.len;
+  buf_put(&out, symtab.data, symtab.len);
+
+  long off_strtab = out.len;
+  buf_put(&out, strtab.data, strtab.len);
+
+  long off_shstrtab = out.len;
+  buf_put(&out, shstrtab.data, shstrtab.len);
+
+  buf_align(&out, 8);
+  long off_shdr = out.len;
+
+  for (int i = 0; i < 3; i++)
+    if (align[i] == 0)
+      align[i] = 1;
+
+  write_shdr(&out, &(Shdr){0, 0, 0, 0, 0, 0, 0, 0, 0});
+  write_shdr(&out, &(Shdr){name_text, SHT_PROGBITS, SHF_ALLOC | SHF_EXECINSTR, off_text, text.len, 0, 0, align[SEC_TEXT], 0});
+  write_shdr(&out, &(Shdr){name_data, SHT_PROGBITS, SHF_ALLOC | SHF_WRITE, off_data, data.len, 0, 0, align[SEC_DATA], 0});
+  write_shdr(&out, &(Shdr){name_bss, SHT_NOBITS, SHF_ALLOC | SHF_WRITE, off_data + data.len, bss_size, 0, 0, align[SEC_BSS], 0});
+  write_shdr(&out, &(Shdr){name_rela_text, SHT_RELA, SHF_INFO_LINK, off_rela_text, rela_text.len, SH_SYMTAB, SH_TEXT, 8, 24});
+  write_shdr(&out, &(Shdr){name_rela_data, SHT_RELA, SHF_INFO_LINK, off_rela_data, rela_data.len, SH_SYMTAB, SH_DATA, 8, 24});
+  write_shdr(&out, &(Shdr){name_symtab, SHT_SYMTAB, 0, off_symtab, symtab.len, SH_STRTAB, first_global, 8, 24});
+  write_shdr(&out, &(Shdr){name_strtab, SHT_STRTAB, 0, off_strtab, strtab.len, 0, 0, 1, 0});
+  write_shdr(&out, &(Shdr){name_shstrtab, SHT_STRTAB, 0, off_shstrtab, shstrtab.len, 0, 0, 1, 0});
+  write_shdr(&out, &(Shdr){name_note, SHT_PROGBITS, 0, off_shdr, 0, 0, 0, 1, 0});
+
+  // ELF header
+  char *h = out.data;
+  memcpy(h, "\177ELF", 4);
+  h[4] = 2;  // ELFCLASS64
+  h[5] = 1;  // ELFDATA2LSB
+  h[6] = 1;  // EV_CURRENT
+
+  ByteBuf hdr = {};
+  buf_int(&hdr, 1, 2);         // e_type = ET_REL
+  buf_int(&hdr, 62, 2);        // e_machine = EM_X86_64
+  buf_int(&hdr, 1, 4);         // e_version
+  buf_int(&hdr, 0, 8);         // e_entry
+  buf_int(&hdr, 0, 8);         // e_phoff
+  buf_int(&hdr, off_shdr, 8);  // e_shoff
+  buf_int(&hdr, 0, 4);         // e_flags
+  buf_int(&hdr, 64, 2);        // e_ehsize
+  buf_int(&hdr, 0, 2);         // e_phentsize
+  buf_int(&hdr, 0, 2);         // e_phnum
+  buf_int(&hdr, 64, 2);        // e_shentsize
+  buf_int(&hdr, SH_NUM, 2);    // e_shnum
+  buf_int(&hdr, SH_SHSTRTAB, 2); // e_shstrndx
+  memcpy(h + 16, hdr.data, hdr.len);
+
+  open_output(path);
+  write_output(out.data, out.len);
+  timer_count(PH_ASSEMBLE, out.len);
+}
+
+// Assembles a given assembly text and writes an object file to path.
+void assemble(char *input, char *path) {
+  init_registers();
+
+  char *p = input;
+  while (*p) {
+    char *end = strchr(p, '\n');
+    if (!end)
+      end = p + strlen(p);
+    assemble_line(p, end);
+    p = *end ? end + 1 : end;
+  }
+
+  resolve_fixups();
+  write_elf(path);
+}
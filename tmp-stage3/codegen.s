@@ -0,0 +1,17447 @@
+.file 1 "codegen.c"
+.intel_syntax noprefix
+.bss
+.align 4
+loc_lineno:
+  .zero 4
+.align 4
+loc_file_no:
+  .zero 4
+.align 8
+funcname:
+  .zero 8
+.align 4
+contseq:
+  .zero 4
+.align 4
+brkseq:
+  .zero 4
+.align 4
+top:
+  .zero 4
+.data
+.align 1
+.L.data.281:
+  .byte 46
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 101
+  .byte 108
+  .byte 95
+  .byte 115
+  .byte 121
+  .byte 110
+  .byte 116
+  .byte 97
+  .byte 120
+  .byte 32
+  .byte 110
+  .byte 111
+  .byte 112
+  .byte 114
+  .byte 101
+  .byte 102
+  .byte 105
+  .byte 120
+  .zero 1
+.align 1
+.L.data.280:
+  .byte 46
+  .byte 116
+  .byte 101
+  .byte 120
+  .byte 116
+  .zero 1
+.align 1
+.L.data.279:
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.278:
+  .byte 119
+  .byte 97
+  .byte 105
+  .byte 116
+  .byte 112
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 102
+  .byte 97
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 100
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.277:
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 107
+  .byte 32
+  .byte 102
+  .byte 97
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 100
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.276:
+  .byte 112
+  .byte 105
+  .byte 112
+  .byte 101
+  .byte 32
+  .byte 102
+  .byte 97
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 100
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.275:
+  .byte 32
+  .byte 32
+  .byte 114
+  .byte 101
+  .byte 116
+  .zero 1
+.align 1
+.L.data.274:
+  .byte 32
+  .byte 32
+  .byte 112
+  .byte 111
+  .byte 112
+  .byte 32
+  .byte 114
+  .byte 98
+  .byte 112
+  .zero 1
+.align 1
+.L.data.273:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 114
+  .byte 115
+  .byte 112
+  .byte 44
+  .byte 32
+  .byte 114
+  .byte 98
+  .byte 112
+  .zero 1
+.align 1
+.L.data.272:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 114
+  .byte 49
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 91
+  .byte 114
+  .byte 98
+  .byte 112
+  .byte 45
+  .byte 51
+  .byte 50
+  .byte 93
+  .zero 1
+.align 1
+.L.data.271:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 114
+  .byte 49
+  .byte 52
+  .byte 44
+  .byte 32
+  .byte 91
+  .byte 114
+  .byte 98
+  .byte 112
+  .byte 45
+  .byte 50
+  .byte 52
+  .byte 93
+  .zero 1
+.align 1
+.L.data.270:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 114
+  .byte 49
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 91
+  .byte 114
+  .byte 98
+  .byte 112
+  .byte 45
+  .byte 49
+  .byte 54
+  .byte 93
+  .zero 1
+.align 1
+.L.data.269:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 114
+  .byte 49
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 91
+  .byte 114
+  .byte 98
+  .byte 112
+  .byte 45
+  .byte 56
+  .byte 93
+  .zero 1
+.align 1
+.L.data.268:
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 114
+  .byte 101
+  .byte 116
+  .byte 117
+  .byte 114
+  .byte 110
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 58
+  .zero 1
+.align 1
+.L.data.267:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 91
+  .byte 114
+  .byte 98
+  .byte 112
+  .byte 45
+  .byte 37
+  .byte 100
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.266:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 100
+  .byte 119
+  .byte 111
+  .byte 114
+  .byte 100
+  .byte 32
+  .byte 112
+  .byte 116
+  .byte 114
+  .byte 32
+  .byte 91
+  .byte 114
+  .byte 98
+  .byte 112
+  .byte 45
+  .byte 52
+  .byte 48
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.265:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 91
+  .byte 114
+  .byte 98
+  .byte 112
+  .byte 45
+  .byte 52
+  .byte 56
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 114
+  .byte 57
+  .zero 1
+.align 1
+.L.data.264:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 91
+  .byte 114
+  .byte 98
+  .byte 112
+  .byte 45
+  .byte 53
+  .byte 54
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 114
+  .byte 56
+  .zero 1
+.align 1
+.L.data.263:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 91
+  .byte 114
+  .byte 98
+  .byte 112
+  .byte 45
+  .byte 54
+  .byte 52
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 114
+  .byte 99
+  .byte 120
+  .zero 1
+.align 1
+.L.data.262:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 91
+  .byte 114
+  .byte 98
+  .byte 112
+  .byte 45
+  .byte 55
+  .byte 50
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 114
+  .byte 100
+  .byte 120
+  .zero 1
+.align 1
+.L.data.261:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 91
+  .byte 114
+  .byte 98
+  .byte 112
+  .byte 45
+  .byte 56
+  .byte 48
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 114
+  .byte 115
+  .byte 105
+  .zero 1
+.align 1
+.L.data.260:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 91
+  .byte 114
+  .byte 98
+  .byte 112
+  .byte 45
+  .byte 56
+  .byte 56
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 114
+  .byte 100
+  .byte 105
+  .zero 1
+.align 1
+.L.data.259:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 91
+  .byte 114
+  .byte 98
+  .byte 112
+  .byte 45
+  .byte 51
+  .byte 50
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 114
+  .byte 49
+  .byte 53
+  .zero 1
+.align 1
+.L.data.258:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 91
+  .byte 114
+  .byte 98
+  .byte 112
+  .byte 45
+  .byte 50
+  .byte 52
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 114
+  .byte 49
+  .byte 52
+  .zero 1
+.align 1
+.L.data.257:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 91
+  .byte 114
+  .byte 98
+  .byte 112
+  .byte 45
+  .byte 49
+  .byte 54
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 114
+  .byte 49
+  .byte 51
+  .zero 1
+.align 1
+.L.data.256:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 91
+  .byte 114
+  .byte 98
+  .byte 112
+  .byte 45
+  .byte 56
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 114
+  .byte 49
+  .byte 50
+  .zero 1
+.align 1
+.L.data.255:
+  .byte 32
+  .byte 32
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 32
+  .byte 114
+  .byte 115
+  .byte 112
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.254:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 114
+  .byte 98
+  .byte 112
+  .byte 44
+  .byte 32
+  .byte 114
+  .byte 115
+  .byte 112
+  .zero 1
+.align 1
+.L.data.253:
+  .byte 32
+  .byte 32
+  .byte 112
+  .byte 117
+  .byte 115
+  .byte 104
+  .byte 32
+  .byte 114
+  .byte 98
+  .byte 112
+  .zero 1
+.align 1
+.L.data.252:
+  .byte 37
+  .byte 115
+  .byte 58
+  .zero 1
+.align 1
+.L.data.251:
+  .byte 46
+  .byte 103
+  .byte 108
+  .byte 111
+  .byte 98
+  .byte 108
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.250:
+  .byte 32
+  .byte 32
+  .byte 46
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 32
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.249:
+  .byte 32
+  .byte 32
+  .byte 46
+  .byte 113
+  .byte 117
+  .byte 97
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .zero 1
+.align 1
+.L.data.248:
+  .byte 32
+  .byte 32
+  .byte 46
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .zero 1
+.align 1
+.L.data.247:
+  .byte 32
+  .byte 32
+  .byte 46
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .zero 1
+.align 1
+.L.data.246:
+  .byte 32
+  .byte 32
+  .byte 46
+  .byte 98
+  .byte 121
+  .byte 116
+  .byte 101
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .zero 1
+.align 1
+.L.data.245:
+  .byte 32
+  .byte 32
+  .byte 46
+  .byte 113
+  .byte 117
+  .byte 97
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 37
+  .byte 43
+  .byte 108
+  .byte 100
+  .zero 1
+.align 1
+.L.data.244:
+  .byte 32
+  .byte 32
+  .byte 46
+  .byte 98
+  .byte 121
+  .byte 116
+  .byte 101
+  .byte 32
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.243:
+  .byte 32
+  .byte 32
+  .byte 46
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 32
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.242:
+  .byte 37
+  .byte 115
+  .byte 58
+  .zero 1
+.align 1
+.L.data.241:
+  .byte 46
+  .byte 103
+  .byte 108
+  .byte 111
+  .byte 98
+  .byte 108
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.240:
+  .byte 46
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 32
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.239:
+  .byte 46
+  .byte 100
+  .byte 97
+  .byte 116
+  .byte 97
+  .zero 1
+.align 1
+.L.data.238:
+  .byte 32
+  .byte 32
+  .byte 46
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 32
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.237:
+  .byte 37
+  .byte 115
+  .byte 58
+  .zero 1
+.align 1
+.L.data.236:
+  .byte 46
+  .byte 103
+  .byte 108
+  .byte 111
+  .byte 98
+  .byte 108
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.235:
+  .byte 46
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 32
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.234:
+  .byte 46
+  .byte 98
+  .byte 115
+  .byte 115
+  .zero 1
+.align 1
+.L.data.233:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 116
+  .byte 101
+  .byte 109
+  .byte 101
+  .byte 110
+  .byte 116
+  .zero 1
+.align 1
+.L.data.232:
+  .byte 32
+  .byte 32
+  .byte 106
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 114
+  .byte 101
+  .byte 116
+  .byte 117
+  .byte 114
+  .byte 110
+  .byte 46
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.231:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 114
+  .byte 97
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.230:
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 108
+  .byte 97
+  .byte 98
+  .byte 101
+  .byte 108
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 58
+  .zero 1
+.align 1
+.L.data.229:
+  .byte 32
+  .byte 32
+  .byte 106
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 108
+  .byte 97
+  .byte 98
+  .byte 101
+  .byte 108
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.228:
+  .byte 32
+  .byte 32
+  .byte 106
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.227:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 97
+  .byte 121
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .zero 1
+.align 1
+.L.data.226:
+  .byte 32
+  .byte 32
+  .byte 106
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.225:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 97
+  .byte 121
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .zero 1
+.align 1
+.L.data.224:
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .byte 58
+  .zero 1
+.align 1
+.L.data.223:
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .byte 58
+  .zero 1
+.align 1
+.L.data.222:
+  .byte 32
+  .byte 32
+  .byte 106
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.221:
+  .byte 32
+  .byte 32
+  .byte 106
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.220:
+  .byte 32
+  .byte 32
+  .byte 106
+  .byte 101
+  .byte 32
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.219:
+  .byte 32
+  .byte 32
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .zero 1
+.align 1
+.L.data.218:
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .byte 58
+  .zero 1
+.align 1
+.L.data.217:
+  .byte 32
+  .byte 32
+  .byte 106
+  .byte 110
+  .byte 101
+  .byte 32
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 98
+  .byte 101
+  .byte 103
+  .byte 105
+  .byte 110
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.216:
+  .byte 32
+  .byte 32
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 48
+  .zero 1
+.align 1
+.L.data.215:
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .byte 58
+  .zero 1
+.align 1
+.L.data.214:
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 98
+  .byte 101
+  .byte 103
+  .byte 105
+  .byte 110
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .byte 58
+  .zero 1
+.align 1
+.L.data.213:
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .byte 58
+  .zero 1
+.align 1
+.L.data.212:
+  .byte 32
+  .byte 32
+  .byte 106
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 98
+  .byte 101
+  .byte 103
+  .byte 105
+  .byte 110
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.211:
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .byte 58
+  .zero 1
+.align 1
+.L.data.210:
+  .byte 32
+  .byte 32
+  .byte 106
+  .byte 101
+  .byte 32
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.209:
+  .byte 32
+  .byte 32
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 48
+  .zero 1
+.align 1
+.L.data.208:
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 98
+  .byte 101
+  .byte 103
+  .byte 105
+  .byte 110
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .byte 58
+  .zero 1
+.align 1
+.L.data.207:
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 101
+  .byte 110
+  .byte 100
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .byte 58
+  .zero 1
+.align 1
+.L.data.206:
+  .byte 32
+  .byte 32
+  .byte 106
+  .byte 101
+  .byte 32
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 101
+  .byte 110
+  .byte 100
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.205:
+  .byte 32
+  .byte 32
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 48
+  .zero 1
+.align 1
+.L.data.204:
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 101
+  .byte 110
+  .byte 100
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .byte 58
+  .zero 1
+.align 1
+.L.data.203:
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .byte 58
+  .zero 1
+.align 1
+.L.data.202:
+  .byte 32
+  .byte 32
+  .byte 106
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 101
+  .byte 110
+  .byte 100
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.201:
+  .byte 32
+  .byte 32
+  .byte 106
+  .byte 101
+  .byte 32
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.200:
+  .byte 32
+  .byte 32
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 48
+  .zero 1
+.align 1
+.L.data.199:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 101
+  .byte 120
+  .byte 112
+  .byte 114
+  .byte 101
+  .byte 115
+  .byte 115
+  .byte 105
+  .byte 111
+  .byte 110
+  .zero 1
+.align 1
+.L.data.198:
+  .byte 32
+  .byte 32
+  .byte 115
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 99
+  .byte 108
+  .zero 1
+.align 1
+.L.data.197:
+  .byte 32
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 114
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 99
+  .byte 108
+  .zero 1
+.align 1
+.L.data.196:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 114
+  .byte 99
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.195:
+  .byte 32
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 108
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 99
+  .byte 108
+  .zero 1
+.align 1
+.L.data.194:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 114
+  .byte 99
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.193:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 122
+  .byte 98
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 97
+  .byte 108
+  .zero 1
+.align 1
+.L.data.192:
+  .byte 32
+  .byte 32
+  .byte 115
+  .byte 101
+  .byte 116
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 97
+  .byte 108
+  .zero 1
+.align 1
+.L.data.191:
+  .byte 32
+  .byte 32
+  .byte 115
+  .byte 101
+  .byte 116
+  .byte 98
+  .byte 101
+  .byte 32
+  .byte 97
+  .byte 108
+  .zero 1
+.align 1
+.L.data.190:
+  .byte 32
+  .byte 32
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.189:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 122
+  .byte 98
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 97
+  .byte 108
+  .zero 1
+.align 1
+.L.data.188:
+  .byte 32
+  .byte 32
+  .byte 115
+  .byte 101
+  .byte 116
+  .byte 108
+  .byte 32
+  .byte 97
+  .byte 108
+  .zero 1
+.align 1
+.L.data.187:
+  .byte 32
+  .byte 32
+  .byte 115
+  .byte 101
+  .byte 116
+  .byte 98
+  .byte 32
+  .byte 97
+  .byte 108
+  .zero 1
+.align 1
+.L.data.186:
+  .byte 32
+  .byte 32
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.185:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 122
+  .byte 98
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 97
+  .byte 108
+  .zero 1
+.align 1
+.L.data.184:
+  .byte 32
+  .byte 32
+  .byte 115
+  .byte 101
+  .byte 116
+  .byte 110
+  .byte 101
+  .byte 32
+  .byte 97
+  .byte 108
+  .zero 1
+.align 1
+.L.data.183:
+  .byte 32
+  .byte 32
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.182:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 122
+  .byte 98
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 97
+  .byte 108
+  .zero 1
+.align 1
+.L.data.181:
+  .byte 32
+  .byte 32
+  .byte 115
+  .byte 101
+  .byte 116
+  .byte 101
+  .byte 32
+  .byte 97
+  .byte 108
+  .zero 1
+.align 1
+.L.data.180:
+  .byte 32
+  .byte 32
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.179:
+  .byte 32
+  .byte 32
+  .byte 120
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.178:
+  .byte 32
+  .byte 32
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.177:
+  .byte 32
+  .byte 32
+  .byte 97
+  .byte 110
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.176:
+  .byte 101
+  .byte 100
+  .byte 120
+  .zero 1
+.align 1
+.L.data.175:
+  .byte 114
+  .byte 100
+  .byte 120
+  .zero 1
+.align 1
+.L.data.174:
+  .byte 101
+  .byte 97
+  .byte 120
+  .zero 1
+.align 1
+.L.data.173:
+  .byte 114
+  .byte 97
+  .byte 120
+  .zero 1
+.align 1
+.L.data.172:
+  .byte 32
+  .byte 32
+  .byte 105
+  .byte 109
+  .byte 117
+  .byte 108
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.171:
+  .byte 32
+  .byte 32
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.170:
+  .byte 32
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.169:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 114
+  .byte 97
+  .byte 120
+  .zero 1
+.align 1
+.L.data.168:
+  .byte 32
+  .byte 32
+  .byte 112
+  .byte 111
+  .byte 112
+  .byte 32
+  .byte 114
+  .byte 49
+  .byte 48
+  .zero 1
+.align 1
+.L.data.167:
+  .byte 32
+  .byte 32
+  .byte 112
+  .byte 111
+  .byte 112
+  .byte 32
+  .byte 114
+  .byte 49
+  .byte 49
+  .zero 1
+.align 1
+.L.data.166:
+  .byte 32
+  .byte 32
+  .byte 112
+  .byte 111
+  .byte 112
+  .byte 32
+  .byte 114
+  .byte 49
+  .byte 50
+  .zero 1
+.align 1
+.L.data.165:
+  .byte 32
+  .byte 32
+  .byte 112
+  .byte 111
+  .byte 112
+  .byte 32
+  .byte 114
+  .byte 49
+  .byte 51
+  .zero 1
+.align 1
+.L.data.164:
+  .byte 32
+  .byte 32
+  .byte 112
+  .byte 111
+  .byte 112
+  .byte 32
+  .byte 114
+  .byte 49
+  .byte 52
+  .zero 1
+.align 1
+.L.data.163:
+  .byte 32
+  .byte 32
+  .byte 112
+  .byte 111
+  .byte 112
+  .byte 32
+  .byte 114
+  .byte 49
+  .byte 53
+  .zero 1
+.align 1
+.L.data.162:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 122
+  .byte 120
+  .byte 32
+  .byte 101
+  .byte 97
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 97
+  .byte 108
+  .zero 1
+.align 1
+.L.data.161:
+  .byte 32
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.160:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 114
+  .byte 97
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 48
+  .zero 1
+.align 1
+.L.data.159:
+  .byte 32
+  .byte 32
+  .byte 112
+  .byte 111
+  .byte 112
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.158:
+  .byte 32
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 32
+  .byte 114
+  .byte 115
+  .byte 112
+  .byte 44
+  .byte 32
+  .byte 56
+  .zero 1
+.align 1
+.L.data.157:
+  .byte 32
+  .byte 32
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 32
+  .byte 114
+  .byte 115
+  .byte 112
+  .byte 44
+  .byte 32
+  .byte 56
+  .zero 1
+.align 1
+.L.data.156:
+  .byte 32
+  .byte 32
+  .byte 112
+  .byte 117
+  .byte 115
+  .byte 104
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.155:
+  .byte 32
+  .byte 32
+  .byte 112
+  .byte 117
+  .byte 115
+  .byte 104
+  .byte 32
+  .byte 114
+  .byte 49
+  .byte 53
+  .zero 1
+.align 1
+.L.data.154:
+  .byte 32
+  .byte 32
+  .byte 112
+  .byte 117
+  .byte 115
+  .byte 104
+  .byte 32
+  .byte 114
+  .byte 49
+  .byte 52
+  .zero 1
+.align 1
+.L.data.153:
+  .byte 32
+  .byte 32
+  .byte 112
+  .byte 117
+  .byte 115
+  .byte 104
+  .byte 32
+  .byte 114
+  .byte 49
+  .byte 51
+  .zero 1
+.align 1
+.L.data.152:
+  .byte 32
+  .byte 32
+  .byte 112
+  .byte 117
+  .byte 115
+  .byte 104
+  .byte 32
+  .byte 114
+  .byte 49
+  .byte 50
+  .zero 1
+.align 1
+.L.data.151:
+  .byte 32
+  .byte 32
+  .byte 112
+  .byte 117
+  .byte 115
+  .byte 104
+  .byte 32
+  .byte 114
+  .byte 49
+  .byte 49
+  .zero 1
+.align 1
+.L.data.150:
+  .byte 32
+  .byte 32
+  .byte 112
+  .byte 117
+  .byte 115
+  .byte 104
+  .byte 32
+  .byte 114
+  .byte 49
+  .byte 48
+  .zero 1
+.align 1
+.L.data.149:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 91
+  .byte 37
+  .byte 115
+  .byte 43
+  .byte 49
+  .byte 54
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 114
+  .byte 97
+  .byte 120
+  .zero 1
+.align 1
+.L.data.148:
+  .byte 32
+  .byte 32
+  .byte 108
+  .byte 101
+  .byte 97
+  .byte 32
+  .byte 114
+  .byte 97
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 91
+  .byte 114
+  .byte 98
+  .byte 112
+  .byte 45
+  .byte 56
+  .byte 56
+  .byte 93
+  .zero 1
+.align 1
+.L.data.147:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 91
+  .byte 37
+  .byte 115
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 101
+  .byte 97
+  .byte 120
+  .zero 1
+.align 1
+.L.data.146:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 101
+  .byte 97
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 91
+  .byte 114
+  .byte 98
+  .byte 112
+  .byte 45
+  .byte 52
+  .byte 48
+  .byte 93
+  .zero 1
+.align 1
+.L.data.145:
+  .byte 95
+  .byte 95
+  .byte 98
+  .byte 117
+  .byte 105
+  .byte 108
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 95
+  .byte 118
+  .byte 97
+  .byte 95
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 114
+  .byte 116
+  .zero 1
+.align 1
+.L.data.144:
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 101
+  .byte 110
+  .byte 100
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .byte 58
+  .zero 1
+.align 1
+.L.data.143:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 49
+  .zero 1
+.align 1
+.L.data.142:
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 49
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .byte 58
+  .zero 1
+.align 1
+.L.data.141:
+  .byte 32
+  .byte 32
+  .byte 106
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 101
+  .byte 110
+  .byte 100
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.140:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 48
+  .zero 1
+.align 1
+.L.data.139:
+  .byte 32
+  .byte 32
+  .byte 106
+  .byte 110
+  .byte 101
+  .byte 32
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 49
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.138:
+  .byte 32
+  .byte 32
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 48
+  .zero 1
+.align 1
+.L.data.137:
+  .byte 32
+  .byte 32
+  .byte 106
+  .byte 110
+  .byte 101
+  .byte 32
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 49
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.136:
+  .byte 32
+  .byte 32
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 48
+  .zero 1
+.align 1
+.L.data.135:
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 101
+  .byte 110
+  .byte 100
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .byte 58
+  .zero 1
+.align 1
+.L.data.134:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 48
+  .zero 1
+.align 1
+.L.data.133:
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 48
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .byte 58
+  .zero 1
+.align 1
+.L.data.132:
+  .byte 32
+  .byte 32
+  .byte 106
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 101
+  .byte 110
+  .byte 100
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.131:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 49
+  .zero 1
+.align 1
+.L.data.130:
+  .byte 32
+  .byte 32
+  .byte 106
+  .byte 101
+  .byte 32
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 48
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.129:
+  .byte 32
+  .byte 32
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 48
+  .zero 1
+.align 1
+.L.data.128:
+  .byte 32
+  .byte 32
+  .byte 106
+  .byte 101
+  .byte 32
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 48
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.127:
+  .byte 32
+  .byte 32
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 48
+  .zero 1
+.align 1
+.L.data.126:
+  .byte 32
+  .byte 32
+  .byte 110
+  .byte 111
+  .byte 116
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.125:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 122
+  .byte 120
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 98
+  .zero 1
+.align 1
+.L.data.124:
+  .byte 32
+  .byte 32
+  .byte 115
+  .byte 101
+  .byte 116
+  .byte 101
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 98
+  .zero 1
+.align 1
+.L.data.123:
+  .byte 32
+  .byte 32
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 48
+  .zero 1
+.align 1
+.L.data.122:
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 101
+  .byte 110
+  .byte 100
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .byte 58
+  .zero 1
+.align 1
+.L.data.121:
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .byte 58
+  .zero 1
+.align 1
+.L.data.120:
+  .byte 32
+  .byte 32
+  .byte 106
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 101
+  .byte 110
+  .byte 100
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.119:
+  .byte 32
+  .byte 32
+  .byte 106
+  .byte 101
+  .byte 32
+  .byte 32
+  .byte 46
+  .byte 76
+  .byte 46
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 46
+  .byte 37
+  .byte 115
+  .byte 46
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.118:
+  .byte 32
+  .byte 32
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 48
+  .zero 1
+.align 1
+.L.data.117:
+  .byte 99
+  .byte 97
+  .byte 110
+  .byte 110
+  .byte 111
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 115
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 32
+  .byte 116
+  .byte 111
+  .byte 32
+  .byte 97
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 115
+  .byte 116
+  .byte 32
+  .byte 118
+  .byte 97
+  .byte 114
+  .byte 105
+  .byte 97
+  .byte 98
+  .byte 108
+  .byte 101
+  .zero 1
+.align 1
+.L.data.116:
+  .byte 110
+  .byte 111
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 110
+  .byte 32
+  .byte 108
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 117
+  .byte 101
+  .zero 1
+.align 1
+.L.data.115:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .zero 1
+.align 1
+.L.data.114:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 97
+  .byte 98
+  .byte 115
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .zero 1
+.align 1
+.L.data.113:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.112:
+  .byte 32
+  .byte 32
+  .byte 105
+  .byte 100
+  .byte 105
+  .byte 118
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.111:
+  .byte 32
+  .byte 32
+  .byte 99
+  .byte 100
+  .byte 113
+  .zero 1
+.align 1
+.L.data.110:
+  .byte 32
+  .byte 32
+  .byte 100
+  .byte 105
+  .byte 118
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.109:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 101
+  .byte 100
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 48
+  .zero 1
+.align 1
+.L.data.108:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 101
+  .byte 97
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.107:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.106:
+  .byte 32
+  .byte 32
+  .byte 105
+  .byte 100
+  .byte 105
+  .byte 118
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.105:
+  .byte 32
+  .byte 32
+  .byte 99
+  .byte 113
+  .byte 111
+  .zero 1
+.align 1
+.L.data.104:
+  .byte 32
+  .byte 32
+  .byte 100
+  .byte 105
+  .byte 118
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.103:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 114
+  .byte 100
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 48
+  .zero 1
+.align 1
+.L.data.102:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 114
+  .byte 97
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.101:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 115
+  .byte 120
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 100
+  .zero 1
+.align 1
+.L.data.100:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 100
+  .zero 1
+.align 1
+.L.data.99:
+  .byte 32
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 119
+  .zero 1
+.align 1
+.L.data.98:
+  .byte 32
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 98
+  .zero 1
+.align 1
+.L.data.97:
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 115
+  .byte 120
+  .zero 1
+.align 1
+.L.data.96:
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 122
+  .byte 120
+  .zero 1
+.align 1
+.L.data.95:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 122
+  .byte 120
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 98
+  .zero 1
+.align 1
+.L.data.94:
+  .byte 32
+  .byte 32
+  .byte 115
+  .byte 101
+  .byte 116
+  .byte 110
+  .byte 101
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 98
+  .zero 1
+.align 1
+.L.data.93:
+  .byte 32
+  .byte 32
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 48
+  .zero 1
+.align 1
+.L.data.92:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 91
+  .byte 37
+  .byte 115
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.91:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 91
+  .byte 37
+  .byte 115
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 100
+  .zero 1
+.align 1
+.L.data.90:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 91
+  .byte 37
+  .byte 115
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 119
+  .zero 1
+.align 1
+.L.data.89:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 91
+  .byte 37
+  .byte 115
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 98
+  .zero 1
+.align 1
+.L.data.88:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 91
+  .byte 37
+  .byte 115
+  .byte 43
+  .byte 37
+  .byte 100
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 97
+  .byte 108
+  .zero 1
+.align 1
+.L.data.87:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 97
+  .byte 108
+  .byte 44
+  .byte 32
+  .byte 91
+  .byte 37
+  .byte 115
+  .byte 43
+  .byte 37
+  .byte 100
+  .byte 93
+  .zero 1
+.align 1
+.L.data.86:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 91
+  .byte 37
+  .byte 115
+  .byte 93
+  .zero 1
+.align 1
+.L.data.85:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 100
+  .byte 119
+  .byte 111
+  .byte 114
+  .byte 100
+  .byte 32
+  .byte 112
+  .byte 116
+  .byte 114
+  .byte 32
+  .byte 91
+  .byte 37
+  .byte 115
+  .byte 93
+  .zero 1
+.align 1
+.L.data.84:
+  .byte 32
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 119
+  .byte 111
+  .byte 114
+  .byte 100
+  .byte 32
+  .byte 112
+  .byte 116
+  .byte 114
+  .byte 32
+  .byte 91
+  .byte 37
+  .byte 115
+  .byte 93
+  .zero 1
+.align 1
+.L.data.83:
+  .byte 32
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 121
+  .byte 116
+  .byte 101
+  .byte 32
+  .byte 112
+  .byte 116
+  .byte 114
+  .byte 32
+  .byte 91
+  .byte 37
+  .byte 115
+  .byte 93
+  .zero 1
+.align 1
+.L.data.82:
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 115
+  .byte 120
+  .zero 1
+.align 1
+.L.data.81:
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 122
+  .byte 120
+  .zero 1
+.align 1
+.L.data.80:
+  .byte 110
+  .byte 111
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 110
+  .byte 32
+  .byte 108
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 117
+  .byte 101
+  .zero 1
+.align 1
+.L.data.79:
+  .byte 32
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.78:
+  .byte 32
+  .byte 32
+  .byte 109
+  .byte 111
+  .byte 118
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 111
+  .byte 102
+  .byte 102
+  .byte 115
+  .byte 101
+  .byte 116
+  .byte 32
+  .byte 37
+  .byte 115
+  .zero 1
+.align 1
+.L.data.77:
+  .byte 32
+  .byte 32
+  .byte 108
+  .byte 101
+  .byte 97
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 91
+  .byte 114
+  .byte 98
+  .byte 112
+  .byte 45
+  .byte 37
+  .byte 100
+  .byte 93
+  .zero 1
+.align 1
+.L.data.76:
+  .byte 46
+  .byte 108
+  .byte 111
+  .byte 99
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.75:
+  .byte 114
+  .byte 97
+  .byte 103
+  .byte 101
+  .byte 115
+  .byte 105
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 32
+  .byte 111
+  .byte 117
+  .byte 116
+  .byte 32
+  .byte 111
+  .byte 102
+  .byte 32
+  .byte 114
+  .byte 97
+  .byte 110
+  .byte 103
+  .byte 101
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.74:
+  .byte 114
+  .byte 49
+  .byte 53
+  .byte 100
+  .zero 1
+.align 1
+.L.data.73:
+  .byte 114
+  .byte 49
+  .byte 52
+  .byte 100
+  .zero 1
+.align 1
+.L.data.72:
+  .byte 114
+  .byte 49
+  .byte 51
+  .byte 100
+  .zero 1
+.align 1
+.L.data.71:
+  .byte 114
+  .byte 49
+  .byte 50
+  .byte 100
+  .zero 1
+.align 1
+.L.data.70:
+  .byte 114
+  .byte 49
+  .byte 49
+  .byte 100
+  .zero 1
+.align 1
+.L.data.69:
+  .byte 114
+  .byte 49
+  .byte 48
+  .byte 100
+  .zero 1
+.align 1
+.L.data.68:
+  .byte 114
+  .byte 49
+  .byte 53
+  .byte 100
+  .zero 1
+.align 1
+.L.data.67:
+  .byte 114
+  .byte 49
+  .byte 52
+  .byte 100
+  .zero 1
+.align 1
+.L.data.66:
+  .byte 114
+  .byte 49
+  .byte 51
+  .byte 100
+  .zero 1
+.align 1
+.L.data.65:
+  .byte 114
+  .byte 49
+  .byte 50
+  .byte 100
+  .zero 1
+.align 1
+.L.data.64:
+  .byte 114
+  .byte 49
+  .byte 49
+  .byte 100
+  .zero 1
+.align 1
+.L.data.63:
+  .byte 114
+  .byte 49
+  .byte 48
+  .byte 100
+  .zero 1
+.align 8
+.L.data.62:
+  .quad .L.data.69+0
+  .quad .L.data.70+0
+  .quad .L.data.71+0
+  .quad .L.data.72+0
+  .quad .L.data.73+0
+  .quad .L.data.74+0
+.align 1
+.L.data.61:
+  .byte 114
+  .byte 101
+  .byte 103
+  .byte 105
+  .byte 115
+  .byte 116
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 111
+  .byte 117
+  .byte 116
+  .byte 32
+  .byte 111
+  .byte 102
+  .byte 32
+  .byte 114
+  .byte 97
+  .byte 110
+  .byte 103
+  .byte 101
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 100
+  .zero 1
+.align 1
+.L.data.60:
+  .byte 114
+  .byte 49
+  .byte 53
+  .zero 1
+.align 1
+.L.data.59:
+  .byte 114
+  .byte 49
+  .byte 52
+  .zero 1
+.align 1
+.L.data.58:
+  .byte 114
+  .byte 49
+  .byte 51
+  .zero 1
+.align 1
+.L.data.57:
+  .byte 114
+  .byte 49
+  .byte 50
+  .zero 1
+.align 1
+.L.data.56:
+  .byte 114
+  .byte 49
+  .byte 49
+  .zero 1
+.align 1
+.L.data.55:
+  .byte 114
+  .byte 49
+  .byte 48
+  .zero 1
+.align 1
+.L.data.54:
+  .byte 114
+  .byte 49
+  .byte 53
+  .zero 1
+.align 1
+.L.data.53:
+  .byte 114
+  .byte 49
+  .byte 52
+  .zero 1
+.align 1
+.L.data.52:
+  .byte 114
+  .byte 49
+  .byte 51
+  .zero 1
+.align 1
+.L.data.51:
+  .byte 114
+  .byte 49
+  .byte 50
+  .zero 1
+.align 1
+.L.data.50:
+  .byte 114
+  .byte 49
+  .byte 49
+  .zero 1
+.align 1
+.L.data.49:
+  .byte 114
+  .byte 49
+  .byte 48
+  .zero 1
+.align 8
+.L.data.48:
+  .quad .L.data.55+0
+  .quad .L.data.56+0
+  .quad .L.data.57+0
+  .quad .L.data.58+0
+  .quad .L.data.59+0
+  .quad .L.data.60+0
+.align 1
+.L.data.47:
+  .byte 114
+  .byte 57
+  .zero 1
+.align 1
+.L.data.46:
+  .byte 114
+  .byte 56
+  .zero 1
+.align 1
+.L.data.45:
+  .byte 114
+  .byte 99
+  .byte 120
+  .zero 1
+.align 1
+.L.data.44:
+  .byte 114
+  .byte 100
+  .byte 120
+  .zero 1
+.align 1
+.L.data.43:
+  .byte 114
+  .byte 115
+  .byte 105
+  .zero 1
+.align 1
+.L.data.42:
+  .byte 114
+  .byte 100
+  .byte 105
+  .zero 1
+.align 1
+.L.data.41:
+  .byte 114
+  .byte 57
+  .zero 1
+.align 1
+.L.data.40:
+  .byte 114
+  .byte 56
+  .zero 1
+.align 1
+.L.data.39:
+  .byte 114
+  .byte 99
+  .byte 120
+  .zero 1
+.align 1
+.L.data.38:
+  .byte 114
+  .byte 100
+  .byte 120
+  .zero 1
+.align 1
+.L.data.37:
+  .byte 114
+  .byte 115
+  .byte 105
+  .zero 1
+.align 1
+.L.data.36:
+  .byte 114
+  .byte 100
+  .byte 105
+  .zero 1
+.align 8
+argreg64:
+  .quad .L.data.42+0
+  .quad .L.data.43+0
+  .quad .L.data.44+0
+  .quad .L.data.45+0
+  .quad .L.data.46+0
+  .quad .L.data.47+0
+.align 1
+.L.data.35:
+  .byte 114
+  .byte 57
+  .byte 100
+  .zero 1
+.align 1
+.L.data.34:
+  .byte 114
+  .byte 56
+  .byte 100
+  .zero 1
+.align 1
+.L.data.33:
+  .byte 101
+  .byte 99
+  .byte 120
+  .zero 1
+.align 1
+.L.data.32:
+  .byte 101
+  .byte 100
+  .byte 120
+  .zero 1
+.align 1
+.L.data.31:
+  .byte 101
+  .byte 115
+  .byte 105
+  .zero 1
+.align 1
+.L.data.30:
+  .byte 101
+  .byte 100
+  .byte 105
+  .zero 1
+.align 1
+.L.data.29:
+  .byte 114
+  .byte 57
+  .byte 100
+  .zero 1
+.align 1
+.L.data.28:
+  .byte 114
+  .byte 56
+  .byte 100
+  .zero 1
+.align 1
+.L.data.27:
+  .byte 101
+  .byte 99
+  .byte 120
+  .zero 1
+.align 1
+.L.data.26:
+  .byte 101
+  .byte 100
+  .byte 120
+  .zero 1
+.align 1
+.L.data.25:
+  .byte 101
+  .byte 115
+  .byte 105
+  .zero 1
+.align 1
+.L.data.24:
+  .byte 101
+  .byte 100
+  .byte 105
+  .zero 1
+.align 8
+argreg32:
+  .quad .L.data.30+0
+  .quad .L.data.31+0
+  .quad .L.data.32+0
+  .quad .L.data.33+0
+  .quad .L.data.34+0
+  .quad .L.data.35+0
+.align 1
+.L.data.23:
+  .byte 114
+  .byte 57
+  .byte 98
+  .zero 1
+.align 1
+.L.data.22:
+  .byte 114
+  .byte 56
+  .byte 119
+  .zero 1
+.align 1
+.L.data.21:
+  .byte 99
+  .byte 120
+  .zero 1
+.align 1
+.L.data.20:
+  .byte 100
+  .byte 120
+  .zero 1
+.align 1
+.L.data.19:
+  .byte 115
+  .byte 105
+  .zero 1
+.align 1
+.L.data.18:
+  .byte 100
+  .byte 105
+  .zero 1
+.align 1
+.L.data.17:
+  .byte 114
+  .byte 57
+  .byte 98
+  .zero 1
+.align 1
+.L.data.16:
+  .byte 114
+  .byte 56
+  .byte 119
+  .zero 1
+.align 1
+.L.data.15:
+  .byte 99
+  .byte 120
+  .zero 1
+.align 1
+.L.data.14:
+  .byte 100
+  .byte 120
+  .zero 1
+.align 1
+.L.data.13:
+  .byte 115
+  .byte 105
+  .zero 1
+.align 1
+.L.data.12:
+  .byte 100
+  .byte 105
+  .zero 1
+.align 8
+argreg16:
+  .quad .L.data.18+0
+  .quad .L.data.19+0
+  .quad .L.data.20+0
+  .quad .L.data.21+0
+  .quad .L.data.22+0
+  .quad .L.data.23+0
+.align 1
+.L.data.11:
+  .byte 114
+  .byte 57
+  .byte 98
+  .zero 1
+.align 1
+.L.data.10:
+  .byte 114
+  .byte 56
+  .byte 98
+  .zero 1
+.align 1
+.L.data.9:
+  .byte 99
+  .byte 108
+  .zero 1
+.align 1
+.L.data.8:
+  .byte 100
+  .byte 108
+  .zero 1
+.align 1
+.L.data.7:
+  .byte 115
+  .byte 105
+  .byte 108
+  .zero 1
+.align 1
+.L.data.6:
+  .byte 100
+  .byte 105
+  .byte 108
+  .zero 1
+.align 1
+.L.data.5:
+  .byte 114
+  .byte 57
+  .byte 98
+  .zero 1
+.align 1
+.L.data.4:
+  .byte 114
+  .byte 56
+  .byte 98
+  .zero 1
+.align 1
+.L.data.3:
+  .byte 99
+  .byte 108
+  .zero 1
+.align 1
+.L.data.2:
+  .byte 100
+  .byte 108
+  .zero 1
+.align 1
+.L.data.1:
+  .byte 115
+  .byte 105
+  .byte 108
+  .zero 1
+.align 1
+.L.data.0:
+  .byte 100
+  .byte 105
+  .byte 108
+  .zero 1
+.align 8
+argreg8:
+  .quad .L.data.6+0
+  .quad .L.data.7+0
+  .quad .L.data.8+0
+  .quad .L.data.9+0
+  .quad .L.data.10+0
+  .quad .L.data.11+0
+.align 4
+labelseq:
+  .long 1
+.align 4
+.globl codegen_jobs
+codegen_jobs:
+  .long 1
+.text
+assert:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.L.return.assert:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+va_end:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.L.return.va_end:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+reg:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-36], edi
+.loc 1 758 64
+.loc 1 759 3
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.1.reg.2
+  movabs r10, 48
+  movabs r11, 8
+  mov rax, r10
+  mov rdx, 0
+  div r11
+  mov r10, rax
+  lea r11, [rbp-36]
+  mov r11d, dword ptr [r11]
+  movsx r11, r11d
+  cmp r10, r11
+  setbe al
+  movzb r10, al
+  cmp r10, 0
+  jne .L.1.reg.2
+  mov r10, 0
+  jmp .L.end.reg.2
+.L.1.reg.2:
+  mov r10, 1
+.L.end.reg.2:
+  cmp r10, 0
+  je .L.end.reg.1
+.loc 1 760 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.61
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.reg.1:
+.loc 1 761 3
+  mov r10, offset .L.data.48
+  lea r11, [rbp-36]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.reg
+.L.return.reg:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+regx:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-36], esi
+  mov [rbp-48], rdi
+.loc 1 765 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  cmp r10, 0
+  jne .L.1.regx.2
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.1.regx.2
+  mov r10, 0
+  jmp .L.end.regx.2
+.L.1.regx.2:
+  mov r10, 1
+.L.end.regx.2:
+  cmp r10, 0
+  je .L.end.regx.1
+.loc 1 766 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov rax, r10
+  jmp .L.return.regx
+.L.end.regx.1:
+.loc 1 768 70
+.loc 1 769 3
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.1.regx.4
+  movabs r10, 48
+  movabs r11, 8
+  mov rax, r10
+  mov rdx, 0
+  div r11
+  mov r10, rax
+  lea r11, [rbp-36]
+  mov r11d, dword ptr [r11]
+  movsx r11, r11d
+  cmp r10, r11
+  setbe al
+  movzb r10, al
+  cmp r10, 0
+  jne .L.1.regx.4
+  mov r10, 0
+  jmp .L.end.regx.4
+.L.1.regx.4:
+  mov r10, 1
+.L.end.regx.4:
+  cmp r10, 0
+  je .L.end.regx.3
+.loc 1 770 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.75
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.regx.3:
+.loc 1 771 3
+  mov r10, offset .L.data.62
+  lea r11, [rbp-36]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.regx
+.L.return.regx:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+emit_loc:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 780 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  add r10, 16
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, offset loc_file_no
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.emit_loc.2
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 28
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, offset loc_lineno
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.emit_loc.2
+  mov r10, 1
+  jmp .L.end.emit_loc.2
+.L.0.emit_loc.2:
+  mov r10, 0
+.L.end.emit_loc.2:
+  cmp r10, 0
+  je .L.end.emit_loc.1
+.loc 1 781 5
+  jmp .L.return.emit_loc
+.L.end.emit_loc.1:
+.loc 1 782 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  add r10, 16
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, offset loc_file_no
+  mov [r11], r10d
+.loc 1 783 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 28
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, offset loc_lineno
+  mov [r11], r10d
+.loc 1 784 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.76
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  add r10, 16
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 28
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset get_column
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.emit_loc:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+gen_addr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-64], rdi
+.loc 1 789 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  cmp r10, 16
+  je .L.case.gen_addr.2
+  cmp r10, 17
+  je .L.case.gen_addr.3
+  cmp r10, 19
+  je .L.case.gen_addr.4
+  cmp r10, 38
+  je .L.case.gen_addr.5
+  jmp .L.break.gen_addr.1
+.loc 1 790 5
+.L.case.gen_addr.5:
+.loc 1 791 7
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 168
+  mov r10, [r10]
+  add r10, 32
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.else.gen_addr.6
+.loc 1 792 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.77
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  lea r11, [rbp-56]
+  mov [r11], r10
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 168
+  mov r10, [r10]
+  add r10, 56
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.gen_addr.6
+.L.else.gen_addr.6:
+.loc 1 794 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.78
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 168
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.gen_addr.6:
+.loc 1 795 7
+  jmp .L.return.gen_addr
+.loc 1 796 5
+.L.case.gen_addr.4:
+.loc 1 797 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_expr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 798 7
+  jmp .L.return.gen_addr
+.loc 1 799 5
+.L.case.gen_addr.3:
+.loc 1 800 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_addr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 801 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.79
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 104
+  mov r10, [r10]
+  add r10, 36
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 802 7
+  jmp .L.return.gen_addr
+.loc 1 803 5
+.L.case.gen_addr.2:
+.loc 1 804 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_expr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 805 7
+  mov r10, offset top
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+.loc 1 806 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_addr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 807 7
+  jmp .L.return.gen_addr
+.L.break.gen_addr.1:
+.loc 1 810 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.80
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.gen_addr:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+load:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-72], rdi
+.loc 1 815 3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 9
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.1.load.3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.1.load.3
+  mov r10, 0
+  jmp .L.end.load.3
+.L.1.load.3:
+  mov r10, 1
+.L.end.load.3:
+  cmp r10, 0
+  jne .L.1.load.2
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.1.load.2
+  mov r10, 0
+  jmp .L.end.load.2
+.L.1.load.2:
+  mov r10, 1
+.L.end.load.2:
+  cmp r10, 0
+  je .L.end.load.1
+.loc 1 822 5
+  jmp .L.return.load
+.L.end.load.1:
+.loc 1 825 25
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 826 31
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset top
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset regx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 827 51
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 12
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je  .L.else.load.4
+  mov r10, offset .L.data.81
+  jmp .L.end.load.4
+.L.else.load.4:
+  mov r10, offset .L.data.82
+.L.end.load.4:
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 834 23
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 835 3
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.load.5
+.loc 1 836 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.83
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.load.5
+.L.else.load.5:
+.loc 1 837 8
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.load.6
+.loc 1 838 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.84
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.load.6
+.L.else.load.6:
+.loc 1 839 8
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.load.7
+.loc 1 840 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.85
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.load.7
+.L.else.load.7:
+.loc 1 842 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.86
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.load.7:
+.L.end.load.6:
+.L.end.load.5:
+.L.return.load:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+store:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-80], rdi
+.loc 1 846 26
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 847 26
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 848 23
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 850 3
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.store.1
+.loc 1 851 5
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.store.2:
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 4
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.store.2
+.loc 1 852 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.87
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 853 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.88
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.store.2:
+.loc 1 851 35
+  lea r10, [rbp-52]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.store.2
+.L.break.store.2:
+  jmp .L.end.store.1
+.L.else.store.1:
+.loc 1 855 10
+  lea r10, [rbp-56]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.store.3
+.loc 1 856 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.89
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.store.3
+.L.else.store.3:
+.loc 1 857 10
+  lea r10, [rbp-56]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.store.4
+.loc 1 858 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.90
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.store.4
+.L.else.store.4:
+.loc 1 859 10
+  lea r10, [rbp-56]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.store.5
+.loc 1 860 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.91
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.store.5
+.L.else.store.5:
+.loc 1 862 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.92
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.store.5:
+.L.end.store.4:
+.L.end.store.3:
+.L.end.store.1:
+.loc 1 865 3
+  mov r10, offset top
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+.L.return.store:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+cast:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-56], rsi
+  mov [rbp-64], rdi
+.loc 1 869 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.cast.1
+.loc 1 870 5
+  jmp .L.return.cast
+.L.end.cast.1:
+.loc 1 872 25
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 874 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.cast.2
+.loc 1 875 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.93
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 876 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.94
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 877 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.95
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 878 5
+  jmp .L.return.cast
+.L.end.cast.2:
+.loc 1 881 51
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 12
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je  .L.else.cast.3
+  mov r10, offset .L.data.96
+  jmp .L.end.cast.3
+.L.else.cast.3:
+  mov r10, offset .L.data.97
+.L.end.cast.3:
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 883 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.cast.4
+.loc 1 884 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.98
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.cast.4
+.L.else.cast.4:
+.loc 1 885 10
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.cast.5
+.loc 1 886 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.99
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.cast.5
+.L.else.cast.5:
+.loc 1 887 10
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.cast.6
+.loc 1 888 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.100
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.cast.6
+.L.else.cast.6:
+.loc 1 889 10
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.0.cast.9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.cast.9
+  mov r10, 1
+  jmp .L.end.cast.9
+.L.0.cast.9:
+  mov r10, 0
+.L.end.cast.9:
+  cmp r10, 0
+  je .L.0.cast.8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 12
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.0.cast.8
+  mov r10, 1
+  jmp .L.end.cast.8
+.L.0.cast.8:
+  mov r10, 0
+.L.end.cast.8:
+  cmp r10, 0
+  je .L.end.cast.7
+.loc 1 890 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.101
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.cast.7:
+.L.end.cast.6:
+.L.end.cast.5:
+.L.end.cast.4:
+.L.return.cast:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+divmod:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], r8
+  mov [rbp-48], rcx
+  mov [rbp-56], rdx
+  mov [rbp-64], rsi
+  mov [rbp-72], rdi
+.loc 1 895 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.divmod.1
+.loc 1 896 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.102
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 897 7
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 12
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.else.divmod.2
+.loc 1 898 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.103
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 899 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.104
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.divmod.2
+.L.else.divmod.2:
+.loc 1 901 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.105
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 902 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.106
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.divmod.2:
+.loc 1 904 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.107
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.divmod.1
+.L.else.divmod.1:
+.loc 1 906 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.108
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 907 7
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 12
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.else.divmod.3
+.loc 1 908 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.109
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 909 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.110
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.divmod.3
+.L.else.divmod.3:
+.loc 1 911 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.111
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 912 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.112
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.divmod.3:
+.loc 1 914 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.113
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.divmod.1:
+.L.return.divmod:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+gen_expr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 288
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-280], rdi
+.loc 1 920 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_loc
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 922 3
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  cmp r10, 35
+  je .L.case.gen_expr.2
+  cmp r10, 23
+  je .L.case.gen_expr.3
+  cmp r10, 22
+  je .L.case.gen_expr.4
+  cmp r10, 21
+  je .L.case.gen_expr.5
+  cmp r10, 20
+  je .L.case.gen_expr.6
+  cmp r10, 15
+  je .L.case.gen_expr.7
+  cmp r10, 16
+  je .L.case.gen_expr.8
+  cmp r10, 40
+  je .L.case.gen_expr.9
+  cmp r10, 37
+  je .L.case.gen_expr.10
+  cmp r10, 14
+  je .L.case.gen_expr.11
+  cmp r10, 18
+  je .L.case.gen_expr.12
+  cmp r10, 19
+  je .L.case.gen_expr.13
+  cmp r10, 38
+  je .L.case.gen_expr.14
+  cmp r10, 17
+  je .L.case.gen_expr.15
+  cmp r10, 39
+  je .L.case.gen_expr.16
+  jmp .L.break.gen_expr.1
+.loc 1 923 5
+.L.case.gen_expr.16:
+.loc 1 924 7
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 5
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.gen_expr.17
+.loc 1 925 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.114
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  lea r11, [rbp-272]
+  mov [r11], r10
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-272]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-272]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 176
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.gen_expr.17
+.L.else.gen_expr.17:
+.loc 1 927 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.115
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  lea r11, [rbp-264]
+  mov [r11], r10
+  lea r10, [rbp-264]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-264]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-264]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 176
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.gen_expr.17:
+.loc 1 928 7
+  jmp .L.return.gen_expr
+.loc 1 929 5
+.L.case.gen_expr.14:
+.loc 1 930 5
+.L.case.gen_expr.15:
+.loc 1 931 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_addr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 932 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset load
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 933 7
+  jmp .L.return.gen_expr
+.loc 1 934 5
+.L.case.gen_expr.13:
+.loc 1 935 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_expr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 936 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset load
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 937 7
+  jmp .L.return.gen_expr
+.loc 1 938 5
+.L.case.gen_expr.12:
+.loc 1 939 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_addr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 940 7
+  jmp .L.return.gen_expr
+.loc 1 941 5
+.L.case.gen_expr.11:
+.loc 1 942 7
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 9
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.gen_expr.18
+.loc 1 943 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.116
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.gen_expr.18:
+.loc 1 944 7
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 14
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.0.gen_expr.20
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 88
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.0.gen_expr.20
+  mov r10, 1
+  jmp .L.end.gen_expr.20
+.L.0.gen_expr.20:
+  mov r10, 0
+.L.end.gen_expr.20:
+  cmp r10, 0
+  je .L.end.gen_expr.19
+.loc 1 945 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.117
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.gen_expr.19:
+.loc 1 947 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_expr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 948 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_addr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 949 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset store
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 950 7
+  jmp .L.return.gen_expr
+.loc 1 951 5
+.L.case.gen_expr.10:
+.loc 1 952 7
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 96
+  mov r10, [r10]
+  lea r11, [rbp-256]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.gen_expr.21:
+  lea r10, [rbp-256]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.gen_expr.21
+.loc 1 953 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-256]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_stmt
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.gen_expr.21:
+.loc 1 952 37
+  lea r10, [rbp-256]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-256]
+  mov [r11], r10
+  jmp .L.begin.gen_expr.21
+.L.break.gen_expr.21:
+.loc 1 954 7
+  mov r10, offset top
+  lea r11, [rbp-248]
+  mov [r11], r10
+  lea r10, [rbp-248]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-248]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-248]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.loc 1 955 7
+  jmp .L.return.gen_expr
+.loc 1 956 5
+.L.case.gen_expr.9:
+.loc 1 957 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_expr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 958 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset cast
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 959 7
+  jmp .L.return.gen_expr
+.loc 1 960 5
+.L.case.gen_expr.8:
+.loc 1 961 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_expr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 962 7
+  mov r10, offset top
+  lea r11, [rbp-240]
+  mov [r11], r10
+  lea r10, [rbp-240]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-240]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-240]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+.loc 1 963 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_expr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 964 7
+  jmp .L.return.gen_expr
+.loc 1 965 5
+.L.case.gen_expr.7:
+.loc 1 966 7
+  mov r10, offset labelseq
+  lea r11, [rbp-224]
+  mov [r11], r10
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-224]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-228]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 967 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 48
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_expr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 968 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.118
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  lea r11, [rbp-216]
+  mov [r11], r10
+  lea r10, [rbp-216]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-216]
+  mov r11, [r11]
+  mov [r11], r10d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 969 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.119
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-228]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 970 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_expr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 971 7
+  mov r10, offset top
+  lea r11, [rbp-208]
+  mov [r11], r10
+  lea r10, [rbp-208]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-208]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-208]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+.loc 1 972 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.120
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-228]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 973 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.121
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-228]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 974 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 64
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_expr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 975 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.122
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-228]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 976 7
+  jmp .L.return.gen_expr
+.loc 1 978 5
+.L.case.gen_expr.6:
+.loc 1 979 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_expr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 980 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.123
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 981 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.124
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 982 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.125
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 983 7
+  jmp .L.return.gen_expr
+.loc 1 984 5
+.L.case.gen_expr.5:
+.loc 1 985 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_expr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 986 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.126
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 987 7
+  jmp .L.return.gen_expr
+.loc 1 988 5
+.L.case.gen_expr.4:
+.loc 1 989 7
+  mov r10, offset labelseq
+  lea r11, [rbp-192]
+  mov [r11], r10
+  lea r10, [rbp-192]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-192]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-192]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-196]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 990 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_expr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 991 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.127
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  lea r11, [rbp-184]
+  mov [r11], r10
+  lea r10, [rbp-184]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-184]
+  mov r11, [r11]
+  mov [r11], r10d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 992 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.128
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-196]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 993 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_expr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 994 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.129
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  lea r11, [rbp-176]
+  mov [r11], r10
+  lea r10, [rbp-176]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-176]
+  mov r11, [r11]
+  mov [r11], r10d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 995 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.130
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-196]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 996 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.131
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 997 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.132
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-196]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 998 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.133
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-196]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 999 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.134
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  lea r11, [rbp-168]
+  mov [r11], r10
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-168]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-168]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1000 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.135
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-196]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1001 7
+  jmp .L.return.gen_expr
+.loc 1 1003 5
+.L.case.gen_expr.3:
+.loc 1 1004 7
+  mov r10, offset labelseq
+  lea r11, [rbp-152]
+  mov [r11], r10
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-152]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-156]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1005 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_expr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1006 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.136
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  lea r11, [rbp-144]
+  mov [r11], r10
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-144]
+  mov r11, [r11]
+  mov [r11], r10d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1007 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.137
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-156]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1008 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_expr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1009 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.138
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  lea r11, [rbp-136]
+  mov [r11], r10
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-136]
+  mov r11, [r11]
+  mov [r11], r10d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1010 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.139
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-156]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1011 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.140
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1012 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.141
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-156]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1013 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.142
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-156]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1014 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.143
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  lea r11, [rbp-128]
+  mov [r11], r10
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1015 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.144
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-156]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1016 7
+  jmp .L.return.gen_expr
+.loc 1 1018 5
+.L.case.gen_expr.2:
+.loc 1 1019 7
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 38
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.gen_expr.23
+.loc 1 1020 11
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  add r10, 168
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.145
+  push r10
+  sub rsp, 8
+  mov r10, offset strcmp
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.0.gen_expr.23
+  mov r10, 1
+  jmp .L.end.gen_expr.23
+.L.0.gen_expr.23:
+  mov r10, 0
+.L.end.gen_expr.23:
+  cmp r10, 0
+  je .L.end.gen_expr.22
+.loc 1 1021 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 128
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_expr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1022 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.146
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1023 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.147
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1024 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.148
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1025 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.149
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1026 9
+  jmp .L.return.gen_expr
+.L.end.gen_expr.22:
+.loc 1 1033 25
+  mov r10, offset top
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-120]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1034 7
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, offset top
+  mov [r11], r10d
+.loc 1 1036 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.150
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1037 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.151
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1038 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.152
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1039 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.153
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1040 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.154
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1041 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.155
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1043 20
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-116]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1044 7
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 128
+  mov r10, [r10]
+  lea r11, [rbp-112]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.gen_expr.24:
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.gen_expr.24
+.loc 1 1045 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_expr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1046 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.156
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  lea r11, [rbp-104]
+  mov [r11], r10
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  mov [r11], r10d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1047 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.157
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1048 9
+  lea r10, [rbp-116]
+  lea r11, [rbp-96]
+  mov [r11], r10
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-96]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.continue.gen_expr.24:
+.loc 1 1044 41
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-112]
+  mov [r11], r10
+  jmp .L.begin.gen_expr.24
+.L.break.gen_expr.24:
+.loc 1 1051 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_expr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1053 7
+  lea r10, [rbp-116]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-84]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.gen_expr.25:
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-84]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.gen_expr.25
+.loc 1 1054 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.158
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1055 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.159
+  push r10
+  sub rsp, 8
+  mov r10, offset argreg64
+  lea r11, [rbp-84]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.gen_expr.25:
+.loc 1 1053 39
+  lea r10, [rbp-84]
+  lea r11, [rbp-80]
+  mov [r11], r10
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.gen_expr.25
+.L.break.gen_expr.25:
+.loc 1 1058 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.160
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1059 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.161
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  lea r11, [rbp-72]
+  mov [r11], r10
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  mov [r11], r10d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1065 7
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.gen_expr.26
+.loc 1 1066 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.162
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.gen_expr.26:
+.loc 1 1068 7
+  lea r10, [rbp-120]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, offset top
+  mov [r11], r10d
+.loc 1 1069 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.163
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1070 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.164
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1071 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.165
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1072 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.166
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1073 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.167
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1074 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.168
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1076 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.169
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  lea r11, [rbp-64]
+  mov [r11], r10
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1077 7
+  jmp .L.return.gen_expr
+.L.break.gen_expr.1:
+.loc 1 1082 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_expr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1083 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_expr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1085 42
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset top
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset regx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1086 42
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset top
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset regx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1087 3
+  mov r10, offset top
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+.loc 1 1089 3
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  cmp r10, 9
+  je .L.case.gen_expr.28
+  cmp r10, 8
+  je .L.case.gen_expr.29
+  cmp r10, 13
+  je .L.case.gen_expr.30
+  cmp r10, 12
+  je .L.case.gen_expr.31
+  cmp r10, 11
+  je .L.case.gen_expr.32
+  cmp r10, 10
+  je .L.case.gen_expr.33
+  cmp r10, 7
+  je .L.case.gen_expr.34
+  cmp r10, 6
+  je .L.case.gen_expr.35
+  cmp r10, 5
+  je .L.case.gen_expr.36
+  cmp r10, 4
+  je .L.case.gen_expr.37
+  cmp r10, 3
+  je .L.case.gen_expr.38
+  cmp r10, 2
+  je .L.case.gen_expr.39
+  cmp r10, 1
+  je .L.case.gen_expr.40
+  cmp r10, 0
+  je .L.case.gen_expr.41
+  jmp .L.case.gen_expr.42
+  jmp .L.break.gen_expr.27
+.loc 1 1090 3
+.L.case.gen_expr.41:
+.loc 1 1091 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.170
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1092 5
+  jmp .L.return.gen_expr
+.loc 1 1093 3
+.L.case.gen_expr.40:
+.loc 1 1094 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.171
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1095 5
+  jmp .L.return.gen_expr
+.loc 1 1096 3
+.L.case.gen_expr.39:
+.loc 1 1097 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.172
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1098 5
+  jmp .L.return.gen_expr
+.loc 1 1099 3
+.L.case.gen_expr.38:
+.loc 1 1100 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.173
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.174
+  push r10
+  sub rsp, 8
+  mov r10, offset divmod
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1101 5
+  jmp .L.return.gen_expr
+.loc 1 1102 3
+.L.case.gen_expr.37:
+.loc 1 1103 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.175
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.176
+  push r10
+  sub rsp, 8
+  mov r10, offset divmod
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1104 5
+  jmp .L.return.gen_expr
+.loc 1 1105 3
+.L.case.gen_expr.36:
+.loc 1 1106 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.177
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1107 5
+  jmp .L.return.gen_expr
+.loc 1 1108 3
+.L.case.gen_expr.35:
+.loc 1 1109 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.178
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1110 5
+  jmp .L.return.gen_expr
+.loc 1 1111 3
+.L.case.gen_expr.34:
+.loc 1 1112 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.179
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1113 5
+  jmp .L.return.gen_expr
+.loc 1 1114 3
+.L.case.gen_expr.33:
+.loc 1 1115 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.180
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1116 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.181
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1117 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.182
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1118 5
+  jmp .L.return.gen_expr
+.loc 1 1119 3
+.L.case.gen_expr.32:
+.loc 1 1120 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.183
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1121 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.184
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1122 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.185
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1123 5
+  jmp .L.return.gen_expr
+.loc 1 1124 3
+.L.case.gen_expr.31:
+.loc 1 1125 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.186
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1126 5
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 12
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.else.gen_expr.43
+.loc 1 1127 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.187
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.gen_expr.43
+.L.else.gen_expr.43:
+.loc 1 1129 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.188
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.gen_expr.43:
+.loc 1 1130 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.189
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1131 5
+  jmp .L.return.gen_expr
+.loc 1 1132 3
+.L.case.gen_expr.30:
+.loc 1 1133 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.190
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1134 5
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 12
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.else.gen_expr.44
+.loc 1 1135 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.191
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.gen_expr.44
+.L.else.gen_expr.44:
+.loc 1 1137 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.192
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.gen_expr.44:
+.loc 1 1138 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.193
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1139 5
+  jmp .L.return.gen_expr
+.loc 1 1140 3
+.L.case.gen_expr.29:
+.loc 1 1141 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.194
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1142 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.195
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1143 5
+  jmp .L.return.gen_expr
+.loc 1 1144 3
+.L.case.gen_expr.28:
+.loc 1 1145 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.196
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1146 5
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  add r10, 12
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.else.gen_expr.45
+.loc 1 1147 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.197
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.gen_expr.45
+.L.else.gen_expr.45:
+.loc 1 1149 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.198
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.gen_expr.45:
+.loc 1 1150 5
+  jmp .L.return.gen_expr
+.loc 1 1151 3
+.L.case.gen_expr.42:
+.loc 1 1152 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-280]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.199
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.break.gen_expr.27:
+.L.return.gen_expr:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+gen_stmt:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 224
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-224], rdi
+.loc 1 1157 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_loc
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1159 3
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  cmp r10, 36
+  je .L.case.gen_stmt.2
+  cmp r10, 24
+  je .L.case.gen_stmt.3
+  cmp r10, 34
+  je .L.case.gen_stmt.4
+  cmp r10, 33
+  je .L.case.gen_stmt.5
+  cmp r10, 32
+  je .L.case.gen_stmt.6
+  cmp r10, 31
+  je .L.case.gen_stmt.7
+  cmp r10, 30
+  je .L.case.gen_stmt.8
+  cmp r10, 29
+  je .L.case.gen_stmt.9
+  cmp r10, 28
+  je .L.case.gen_stmt.10
+  cmp r10, 27
+  je .L.case.gen_stmt.11
+  cmp r10, 26
+  je .L.case.gen_stmt.12
+  cmp r10, 25
+  je .L.case.gen_stmt.13
+  jmp .L.case.gen_stmt.14
+  jmp .L.break.gen_stmt.1
+.loc 1 1160 3
+.L.case.gen_stmt.13:
+.loc 1 1161 5
+  mov r10, offset labelseq
+  lea r11, [rbp-208]
+  mov [r11], r10
+  lea r10, [rbp-208]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-208]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-208]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-212]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1162 5
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 64
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.else.gen_stmt.15
+.loc 1 1163 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 48
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_expr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1164 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.200
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  lea r11, [rbp-200]
+  mov [r11], r10
+  lea r10, [rbp-200]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-200]
+  mov r11, [r11]
+  mov [r11], r10d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1165 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.201
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-212]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1166 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_stmt
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1167 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.202
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-212]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1168 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.203
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-212]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1169 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 64
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_stmt
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1170 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.204
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-212]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.gen_stmt.15
+.L.else.gen_stmt.15:
+.loc 1 1172 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 48
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_expr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1173 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.205
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  lea r11, [rbp-192]
+  mov [r11], r10
+  lea r10, [rbp-192]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-192]
+  mov r11, [r11]
+  mov [r11], r10d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1174 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.206
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-212]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1175 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_stmt
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1176 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.207
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-212]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.gen_stmt.15:
+.loc 1 1178 5
+  jmp .L.return.gen_stmt
+.loc 1 1180 3
+.L.case.gen_stmt.12:
+.loc 1 1181 5
+  mov r10, offset labelseq
+  lea r11, [rbp-176]
+  mov [r11], r10
+  lea r10, [rbp-176]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-176]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-176]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-180]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1182 21
+  mov r10, offset brkseq
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-168]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1183 23
+  mov r10, offset contseq
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-164]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1184 5
+  lea r10, [rbp-180]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, offset contseq
+  mov [r11], r10d
+  mov r10d, r10d
+  mov r11, offset brkseq
+  mov [r11], r10d
+.loc 1 1186 5
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 72
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.gen_stmt.16
+.loc 1 1187 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 72
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_stmt
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.gen_stmt.16:
+.loc 1 1188 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.208
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-180]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1189 5
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 48
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.gen_stmt.17
+.loc 1 1190 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 48
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_expr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1191 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.209
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  lea r11, [rbp-160]
+  mov [r11], r10
+  lea r10, [rbp-160]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-160]
+  mov r11, [r11]
+  mov [r11], r10d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1192 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.210
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-180]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.gen_stmt.17:
+.loc 1 1194 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_stmt
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1195 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.211
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-180]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1196 5
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 80
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.gen_stmt.18
+.loc 1 1197 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 80
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_stmt
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.gen_stmt.18:
+.loc 1 1198 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.212
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-180]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1199 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.213
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-180]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1201 5
+  lea r10, [rbp-168]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, offset brkseq
+  mov [r11], r10d
+.loc 1 1202 5
+  lea r10, [rbp-164]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, offset contseq
+  mov [r11], r10d
+.loc 1 1203 5
+  jmp .L.return.gen_stmt
+.loc 1 1205 3
+.L.case.gen_stmt.11:
+.loc 1 1206 5
+  mov r10, offset labelseq
+  lea r11, [rbp-144]
+  mov [r11], r10
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-144]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-148]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1207 21
+  mov r10, offset brkseq
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-136]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1208 24
+  mov r10, offset contseq
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-132]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1209 5
+  lea r10, [rbp-148]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, offset contseq
+  mov [r11], r10d
+  mov r10d, r10d
+  mov r11, offset brkseq
+  mov [r11], r10d
+.loc 1 1211 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.214
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-148]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1212 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_stmt
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1213 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.215
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-148]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1214 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 48
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_expr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1215 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.216
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  lea r11, [rbp-128]
+  mov [r11], r10
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  mov [r11], r10d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1216 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.217
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-148]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1217 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.218
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-148]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1219 5
+  lea r10, [rbp-136]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, offset brkseq
+  mov [r11], r10d
+.loc 1 1220 5
+  lea r10, [rbp-132]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, offset contseq
+  mov [r11], r10d
+.loc 1 1221 5
+  jmp .L.return.gen_stmt
+.loc 1 1223 3
+.L.case.gen_stmt.10:
+.loc 1 1224 5
+  mov r10, offset labelseq
+  lea r11, [rbp-112]
+  mov [r11], r10
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-116]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1225 21
+  mov r10, offset brkseq
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-100]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1226 5
+  lea r10, [rbp-116]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, offset brkseq
+  mov [r11], r10d
+.loc 1 1227 5
+  lea r10, [rbp-116]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-224]
+  mov r11, [r11]
+  add r11, 160
+  mov [r11], r10d
+.loc 1 1229 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 48
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_expr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1231 5
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 144
+  mov r10, [r10]
+  lea r11, [rbp-96]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.gen_stmt.19:
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.gen_stmt.19
+.loc 1 1232 7
+  mov r10, offset labelseq
+  lea r11, [rbp-88]
+  mov [r11], r10
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-96]
+  mov r11, [r11]
+  add r11, 160
+  mov [r11], r10d
+.loc 1 1233 7
+  lea r10, [rbp-116]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-96]
+  mov r11, [r11]
+  add r11, 164
+  mov [r11], r10d
+.loc 1 1234 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.219
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 176
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1235 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.220
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 160
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.gen_stmt.19:
+.loc 1 1231 40
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 144
+  mov r10, [r10]
+  lea r11, [rbp-96]
+  mov [r11], r10
+  jmp .L.begin.gen_stmt.19
+.L.break.gen_stmt.19:
+.loc 1 1237 5
+  mov r10, offset top
+  lea r11, [rbp-80]
+  mov [r11], r10
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+.loc 1 1239 5
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 152
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.gen_stmt.20
+.loc 1 1240 7
+  mov r10, offset labelseq
+  lea r11, [rbp-64]
+  mov [r11], r10
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-68]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1241 7
+  lea r10, [rbp-116]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-224]
+  mov r11, [r11]
+  add r11, 152
+  mov r11, [r11]
+  add r11, 164
+  mov [r11], r10d
+.loc 1 1242 7
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-224]
+  mov r11, [r11]
+  add r11, 152
+  mov r11, [r11]
+  add r11, 160
+  mov [r11], r10d
+.loc 1 1243 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.221
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.gen_stmt.20:
+.loc 1 1246 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.222
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-116]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1247 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_stmt
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1248 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.223
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-116]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1250 5
+  lea r10, [rbp-100]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, offset brkseq
+  mov [r11], r10d
+.loc 1 1251 5
+  jmp .L.return.gen_stmt
+.loc 1 1253 3
+.L.case.gen_stmt.9:
+.loc 1 1254 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.224
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 160
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1255 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_stmt
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1256 5
+  jmp .L.return.gen_stmt
+.loc 1 1257 3
+.L.case.gen_stmt.8:
+.loc 1 1258 5
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 96
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.gen_stmt.21:
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.gen_stmt.21
+.loc 1 1259 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_stmt
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.gen_stmt.21:
+.loc 1 1258 35
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov [r11], r10
+  jmp .L.begin.gen_stmt.21
+.L.break.gen_stmt.21:
+.loc 1 1260 5
+  jmp .L.return.gen_stmt
+.loc 1 1261 3
+.L.case.gen_stmt.7:
+.loc 1 1262 5
+  mov r10, offset brkseq
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.gen_stmt.22
+.loc 1 1263 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.225
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.gen_stmt.22:
+.loc 1 1264 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.226
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset brkseq
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1265 5
+  jmp .L.return.gen_stmt
+.loc 1 1266 3
+.L.case.gen_stmt.6:
+.loc 1 1267 5
+  mov r10, offset contseq
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.gen_stmt.23
+.loc 1 1268 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.227
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.gen_stmt.23:
+.loc 1 1269 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.228
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset contseq
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1270 5
+  jmp .L.return.gen_stmt
+.loc 1 1271 3
+.L.case.gen_stmt.5:
+.loc 1 1272 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.229
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 136
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1273 5
+  jmp .L.return.gen_stmt
+.loc 1 1274 3
+.L.case.gen_stmt.4:
+.loc 1 1275 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.230
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 136
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1276 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_stmt
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1277 5
+  jmp .L.return.gen_stmt
+.loc 1 1278 3
+.L.case.gen_stmt.3:
+.loc 1 1279 5
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.gen_stmt.24
+.loc 1 1280 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_expr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1281 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.231
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset reg
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.gen_stmt.24:
+.loc 1 1283 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.232
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1284 5
+  jmp .L.return.gen_stmt
+.loc 1 1285 3
+.L.case.gen_stmt.2:
+.loc 1 1286 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_expr
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1287 5
+  mov r10, offset top
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+.loc 1 1288 5
+  jmp .L.return.gen_stmt
+.loc 1 1289 3
+.L.case.gen_stmt.14:
+.loc 1 1290 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-224]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.233
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.break.gen_stmt.1:
+.L.return.gen_stmt:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+emit_data:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-88], rdi
+.loc 1 1295 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.234
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1297 3
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.emit_data.1:
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.emit_data.1
+.loc 1 1298 5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 48
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.emit_data.2
+.loc 1 1299 7
+  jmp .L.continue.emit_data.1
+.L.end.emit_data.2:
+.loc 1 1301 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.235
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 36
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1302 5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 40
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.emit_data.3
+.loc 1 1303 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.236
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.emit_data.3:
+.loc 1 1304 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.237
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1305 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.238
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.emit_data.1:
+.loc 1 1297 39
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov [r11], r10
+  jmp .L.begin.emit_data.1
+.L.break.emit_data.1:
+.loc 1 1308 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.239
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1310 3
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.emit_data.4:
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.emit_data.4
+.loc 1 1311 5
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 48
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.emit_data.5
+.loc 1 1312 7
+  jmp .L.continue.emit_data.4
+.L.end.emit_data.5:
+.loc 1 1314 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.240
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 36
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1315 5
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 40
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.emit_data.6
+.loc 1 1316 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.241
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.emit_data.6:
+.loc 1 1317 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.242
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1319 19
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-60]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1320 5
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 48
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.emit_data.7:
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.emit_data.7
+.loc 1 1321 7
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 8
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.emit_data.8
+.loc 1 1322 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.243
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-60]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  sub r10d, r11d
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.emit_data.8:
+.loc 1 1323 7
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 12
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-60]
+  mov [r11], r10d
+.loc 1 1325 7
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.else.emit_data.9
+.loc 1 1326 9
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-44]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.emit_data.10:
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 12
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.emit_data.10
+.loc 1 1327 11
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.244
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  lea r11, [rbp-44]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.emit_data.10:
+.loc 1 1326 39
+  lea r10, [rbp-44]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.emit_data.10
+.L.break.emit_data.10:
+  jmp .L.end.emit_data.9
+.L.else.emit_data.9:
+.loc 1 1328 12
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.else.emit_data.11
+.loc 1 1329 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.245
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.emit_data.11
+.L.else.emit_data.11:
+.loc 1 1330 12
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 12
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.emit_data.12
+.loc 1 1331 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.246
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.emit_data.12
+.L.else.emit_data.12:
+.loc 1 1332 12
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 12
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.emit_data.13
+.loc 1 1333 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.247
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.emit_data.13
+.L.else.emit_data.13:
+.loc 1 1334 12
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 12
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.emit_data.14
+.loc 1 1335 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.248
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.emit_data.14
+.L.else.emit_data.14:
+.loc 1 1337 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.249
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.emit_data.14:
+.L.end.emit_data.13:
+.L.end.emit_data.12:
+.L.end.emit_data.11:
+.L.end.emit_data.9:
+.L.continue.emit_data.7:
+.loc 1 1320 58
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov [r11], r10
+  jmp .L.begin.emit_data.7
+.L.break.emit_data.7:
+.loc 1 1340 5
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.emit_data.15
+.loc 1 1341 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.250
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-60]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  sub r10d, r11d
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.emit_data.15:
+.L.continue.emit_data.4:
+.loc 1 1310 39
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov [r11], r10
+  jmp .L.begin.emit_data.4
+.L.break.emit_data.4:
+.L.return.emit_data:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+get_argreg:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-36], esi
+  mov [rbp-40], edi
+.loc 1 1346 3
+  lea r10, [rbp-40]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.get_argreg.1
+.loc 1 1347 5
+  mov r10, offset argreg8
+  lea r11, [rbp-36]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.get_argreg
+.L.end.get_argreg.1:
+.loc 1 1348 3
+  lea r10, [rbp-40]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.get_argreg.2
+.loc 1 1349 5
+  mov r10, offset argreg16
+  lea r11, [rbp-36]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.get_argreg
+.L.end.get_argreg.2:
+.loc 1 1350 3
+  lea r10, [rbp-40]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.get_argreg.3
+.loc 1 1351 5
+  mov r10, offset argreg32
+  lea r11, [rbp-36]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.get_argreg
+.L.end.get_argreg.3:
+.loc 1 1352 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1353 3
+  mov r10, offset argreg64
+  lea r11, [rbp-36]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.get_argreg
+.L.return.get_argreg:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+emit_function:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 128
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-120], rdi
+.loc 1 1357 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 24
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.emit_function.1
+.loc 1 1358 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.251
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.emit_function.1:
+.loc 1 1359 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.252
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1360 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  mov r11, offset funcname
+  mov [r11], r10
+.loc 1 1361 3
+  mov r10, 1
+  mov r10d, r10d
+  mov r11, offset labelseq
+  mov [r11], r10d
+.loc 1 1362 3
+  mov r10, 0
+  mov r10d, r10d
+  mov r11, offset loc_lineno
+  mov [r11], r10d
+  mov r10d, r10d
+  mov r11, offset loc_file_no
+  mov [r11], r10d
+.loc 1 1365 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.253
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1366 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.254
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1367 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.255
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 48
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1368 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.256
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1369 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.257
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1370 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.258
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1371 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.259
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1374 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 25
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.emit_function.2
+.loc 1 1375 5
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-108]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1376 5
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-104]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.emit_function.3:
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.emit_function.3
+.loc 1 1377 7
+  lea r10, [rbp-108]
+  lea r11, [rbp-96]
+  mov [r11], r10
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-96]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.continue.emit_function.3:
+.loc 1 1376 38
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-104]
+  mov [r11], r10
+  jmp .L.begin.emit_function.3
+.L.break.emit_function.3:
+.loc 1 1379 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.260
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1380 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.261
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1381 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.262
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1382 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.263
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1383 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.264
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1384 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.265
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1385 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.266
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-108]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 8
+  mov r11d, r11d
+  imul r10d, r11d
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.emit_function.2:
+.loc 1 1389 12
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-84]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1390 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.emit_function.4:
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.emit_function.4
+.loc 1 1391 5
+  lea r10, [rbp-84]
+  lea r11, [rbp-72]
+  mov [r11], r10
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.continue.emit_function.4:
+.loc 1 1390 36
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov [r11], r10
+  jmp .L.begin.emit_function.4
+.L.break.emit_function.4:
+.loc 1 1393 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.emit_function.5:
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.emit_function.5
+.loc 1 1394 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset size_of
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-84]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10d
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset get_argreg
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1395 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.267
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 56
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.emit_function.5:
+.loc 1 1393 36
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov [r11], r10
+  jmp .L.begin.emit_function.5
+.L.break.emit_function.5:
+.loc 1 1399 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 32
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.emit_function.6:
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.emit_function.6
+.loc 1 1400 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset gen_stmt
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1401 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset top
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  push r10
+  sub rsp, 8
+  mov r10, offset assert
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.emit_function.6:
+.loc 1 1399 31
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  jmp .L.begin.emit_function.6
+.L.break.emit_function.6:
+.loc 1 1405 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.268
+  push r10
+  sub rsp, 8
+  mov r10, offset funcname
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1406 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.269
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1407 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.270
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1408 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.271
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1409 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.272
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1410 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.273
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1411 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.274
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1412 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.275
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.emit_function:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+emit_text_parallel:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 224
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-200], rdx
+  mov [rbp-204], esi
+  mov [rbp-216], rdi
+.loc 1 1426 27
+  mov r10, offset codegen_jobs
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-188]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1427 3
+  lea r10, [rbp-200]
+  mov r10, [r10]
+  mov r11, 50000
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  lea r11, [rbp-188]
+  mov r11d, dword ptr [r11]
+  movsx r11, r11d
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.emit_text_parallel.1
+.loc 1 1428 5
+  lea r10, [rbp-200]
+  mov r10, [r10]
+  mov r11, 50000
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-188]
+  mov [r11], r10d
+.L.end.emit_text_parallel.1:
+.loc 1 1430 41
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-188]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset calloc
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-184]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1431 40
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-188]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  push r10
+  sub rsp, 8
+  mov r10, offset calloc
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-176]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1432 19
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-164]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1433 16
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-160]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1435 3
+.L.begin.emit_text_parallel.2:
+  lea r10, [rbp-160]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-204]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.emit_text_parallel.2
+.loc 1 1437 5
+  lea r10, [rbp-160]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-156]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1438 19
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-152]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1439 31
+  lea r10, [rbp-200]
+  mov r10, [r10]
+  lea r11, [rbp-188]
+  mov r11d, dword ptr [r11]
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  lea r11, [rbp-144]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1440 5
+.L.begin.emit_text_parallel.3:
+.loc 1 1441 7
+  lea r10, [rbp-152]
+  lea r11, [rbp-128]
+  mov [r11], r10
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-216]
+  mov r11, [r11]
+  lea r12, [rbp-156]
+  lea r13, [rbp-136]
+  mov [r13], r12
+  lea r12, [rbp-136]
+  mov r12, [r12]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  add r12d, r13d
+  mov r12d, r12d
+  lea r13, [rbp-136]
+  mov r13, [r13]
+  mov [r13], r12d
+  lea r12, [rbp-136]
+  mov r12, [r12]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, -1
+  mov r13d, r13d
+  add r12d, r13d
+  mov r12d, r12d
+  mov r13, 8
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov r11, [r11]
+  add r11, 56
+  mov r11, [r11]
+  add r10, r11
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  mov [r11], r10
+.L.continue.emit_text_parallel.3:
+.loc 1 1442 42
+  lea r10, [rbp-156]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-204]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.emit_text_parallel.5
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  lea r11, [rbp-144]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.0.emit_text_parallel.5
+  mov r10, 1
+  jmp .L.end.emit_text_parallel.5
+.L.0.emit_text_parallel.5:
+  mov r10, 0
+.L.end.emit_text_parallel.5:
+  cmp r10, 0
+  je .L.0.emit_text_parallel.4
+  lea r10, [rbp-164]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-188]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  sub r11d, r12d
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.emit_text_parallel.4
+  mov r10, 1
+  jmp .L.end.emit_text_parallel.4
+.L.0.emit_text_parallel.4:
+  mov r10, 0
+.L.end.emit_text_parallel.4:
+  cmp r10, 0
+  jne .L.begin.emit_text_parallel.3
+.L.break.emit_text_parallel.3:
+.loc 1 1443 5
+  lea r10, [rbp-164]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-188]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  sub r11d, r12d
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.emit_text_parallel.6
+.loc 1 1444 7
+  lea r10, [rbp-204]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-156]
+  mov [r11], r10d
+.L.end.emit_text_parallel.6:
+.loc 1 1446 15
+.loc 1 1447 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  push r10
+  sub rsp, 8
+  mov r10, offset pipe
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.emit_text_parallel.7
+.loc 1 1448 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.276
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset __errno_location
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset strerror
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.emit_text_parallel.7:
+.loc 1 1450 21
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset fork
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-112]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1451 5
+  lea r10, [rbp-112]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.emit_text_parallel.8
+.loc 1 1452 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.277
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset __errno_location
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset strerror
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.emit_text_parallel.8:
+.loc 1 1454 5
+  lea r10, [rbp-112]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.emit_text_parallel.9
+.loc 1 1455 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset close
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1456 7
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-108]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.emit_text_parallel.10:
+  lea r10, [rbp-108]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-164]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.emit_text_parallel.10
+.loc 1 1457 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-176]
+  mov r10, [r10]
+  lea r11, [rbp-108]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset close
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.emit_text_parallel.10:
+.loc 1 1456 37
+  lea r10, [rbp-108]
+  lea r11, [rbp-104]
+  mov [r11], r10
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.emit_text_parallel.10
+.L.break.emit_text_parallel.10:
+.loc 1 1462 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset take_output
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1463 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset capture_output
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1465 7
+  lea r10, [rbp-160]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-92]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.emit_text_parallel.11:
+  lea r10, [rbp-92]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-156]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.emit_text_parallel.11
+.loc 1 1466 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-216]
+  mov r10, [r10]
+  lea r11, [rbp-92]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_function
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.emit_text_parallel.11:
+.loc 1 1465 36
+  lea r10, [rbp-92]
+  lea r11, [rbp-88]
+  mov [r11], r10
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.emit_text_parallel.11
+.L.break.emit_text_parallel.11:
+.loc 1 1468 30
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset take_output
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1469 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset dup2
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1470 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset open_output
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1471 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strlen
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset write_output
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1472 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset exit
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.emit_text_parallel.9:
+.loc 1 1475 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset close
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1476 5
+  lea r10, [rbp-112]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-184]
+  mov r11, [r11]
+  lea r12, [rbp-164]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1477 5
+  lea r10, [rbp-120]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-176]
+  mov r11, [r11]
+  lea r12, [rbp-164]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1478 5
+  lea r10, [rbp-164]
+  lea r11, [rbp-72]
+  mov [r11], r10
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.loc 1 1479 5
+  lea r10, [rbp-156]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-160]
+  mov [r11], r10d
+.L.continue.emit_text_parallel.2:
+  jmp .L.begin.emit_text_parallel.2
+.L.break.emit_text_parallel.2:
+.loc 1 1482 19
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-61]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.loc 1 1483 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-60]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.emit_text_parallel.12:
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-164]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.emit_text_parallel.12
+.loc 1 1484 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-176]
+  mov r10, [r10]
+  lea r11, [rbp-60]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset read_all
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1485 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-176]
+  mov r10, [r10]
+  lea r11, [rbp-60]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset close
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1487 15
+.loc 1 1488 5
+.L.begin.emit_text_parallel.13:
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-184]
+  mov r10, [r10]
+  lea r11, [rbp-60]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-36]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset waitpid
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.emit_text_parallel.13
+.loc 1 1489 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset __errno_location
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.emit_text_parallel.14
+.loc 1 1490 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.278
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset __errno_location
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset strerror
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset error
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.emit_text_parallel.14:
+.L.continue.emit_text_parallel.13:
+  jmp .L.begin.emit_text_parallel.13
+.L.break.emit_text_parallel.13:
+.loc 1 1492 5
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.emit_text_parallel.15
+.loc 1 1493 7
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-61]
+  mov [r11], r10b
+  jmp .L.end.emit_text_parallel.15
+.L.else.emit_text_parallel.15:
+.loc 1 1494 10
+  lea r10, [rbp-61]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.emit_text_parallel.16
+.loc 1 1495 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.279
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset emitf
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.emit_text_parallel.16:
+.L.end.emit_text_parallel.15:
+.loc 1 1496 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset free
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.emit_text_parallel.12:
+.loc 1 1483 33
+  lea r10, [rbp-60]
+  lea r11, [rbp-56]
+  mov [r11], r10
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.emit_text_parallel.12
+.L.break.emit_text_parallel.12:
+.loc 1 1500 3
+  lea r10, [rbp-61]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.emit_text_parallel.17
+.loc 1 1501 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset exit
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.emit_text_parallel.17:
+.loc 1 1503 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-184]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset free
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1504 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-176]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset free
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.emit_text_parallel:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+emit_text:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 128
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-120], rdi
+.loc 1 1508 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.280
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1510 15
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-108]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1511 17
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-104]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1512 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-96]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.emit_text.1:
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.emit_text.1
+.loc 1 1513 5
+  lea r10, [rbp-108]
+  lea r11, [rbp-88]
+  mov [r11], r10
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.loc 1 1514 5
+  lea r10, [rbp-104]
+  lea r11, [rbp-80]
+  mov [r11], r10
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-96]
+  mov r11, [r11]
+  add r11, 56
+  mov r11, [r11]
+  add r10, r11
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  mov [r11], r10
+.L.continue.emit_text.1:
+.loc 1 1512 38
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-96]
+  mov [r11], r10
+  jmp .L.begin.emit_text.1
+.L.break.emit_text.1:
+.loc 1 1517 3
+  mov r10, 1
+  mov r10d, r10d
+  mov r11, offset codegen_jobs
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.emit_text.4
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-108]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.emit_text.4
+  mov r10, 1
+  jmp .L.end.emit_text.4
+.L.0.emit_text.4:
+  mov r10, 0
+.L.end.emit_text.4:
+  cmp r10, 0
+  je .L.0.emit_text.3
+  mov r10, 50000
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  imul r10d, r11d
+  movsx r10, r10d
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  cmp r10, r11
+  setle al
+  movzb r10, al
+  cmp r10, 0
+  je .L.0.emit_text.3
+  mov r10, 1
+  jmp .L.end.emit_text.3
+.L.0.emit_text.3:
+  mov r10, 0
+.L.end.emit_text.3:
+  cmp r10, 0
+  je .L.end.emit_text.2
+.loc 1 1518 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-108]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  push r10
+  sub rsp, 8
+  mov r10, offset calloc
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1519 14
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-60]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1520 5
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.emit_text.5:
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.emit_text.5
+.loc 1 1521 7
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  lea r12, [rbp-60]
+  lea r13, [rbp-48]
+  mov [r13], r12
+  lea r12, [rbp-48]
+  mov r12, [r12]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  add r12d, r13d
+  mov r12d, r12d
+  lea r13, [rbp-48]
+  mov r13, [r13]
+  mov [r13], r12d
+  lea r12, [rbp-48]
+  mov r12, [r12]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, -1
+  mov r13d, r13d
+  add r12d, r13d
+  mov r12d, r12d
+  mov r13, 8
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.continue.emit_text.5:
+.loc 1 1520 40
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov [r11], r10
+  jmp .L.begin.emit_text.5
+.L.break.emit_text.5:
+.loc 1 1522 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-108]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_text_parallel
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1523 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset free
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1524 5
+  jmp .L.return.emit_text
+.L.end.emit_text.2:
+.loc 1 1527 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.emit_text.6:
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.emit_text.6
+.loc 1 1528 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_function
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.emit_text.6:
+.loc 1 1527 38
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  jmp .L.begin.emit_text.6
+.L.break.emit_text.6:
+.L.return.emit_text:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl codegen
+codegen:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdi
+.loc 1 1532 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset .L.data.281
+  push r10
+  sub rsp, 8
+  mov r10, offset println
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1534 29
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset output_size
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1535 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset timer_start
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1536 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_data
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1537 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset timer_stop
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1538 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 6
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset output_size
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  sub r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset timer_count
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1540 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset output_size
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 1541 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset timer_start
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1542 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset emit_text
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1543 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset timer_stop
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1544 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 7
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset output_size
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  sub r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset timer_count
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.codegen:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,2934 @@
+typedef struct FILE FILE;
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+typedef struct {
+  int gp_offset;
+  int fp_offset;
+  void *overflow_arg_area;
+  void *reg_save_area;
+} va_list[1];
+
+struct timespec {
+  long tv_sec;
+  long tv_nsec;
+};
+
+struct rusage {
+  long ru_utime[2];
+  long ru_stime[2];
+  long ru_maxrss;
+  long ru_reserved[13];
+};
+
+struct stat {
+  unsigned long st_dev;
+  unsigned long st_ino;
+  unsigned long st_nlink;
+  unsigned int st_mode;
+  unsigned int st_uid;
+  unsigned int st_gid;
+  int __pad0;
+  unsigned long st_rdev;
+  long st_size;
+  long st_blksize;
+  long st_blocks;
+  struct timespec st_atim;
+  struct timespec st_mtim;
+  struct timespec st_ctim;
+  long __reserved[3];
+};
+
+struct sockaddr_un {
+  unsigned short sun_family;
+  char sun_path[108];
+};
+
+struct iovec {
+  void *iov_base;
+  long iov_len;
+};
+
+struct msghdr {
+  void *msg_name;
+  int msg_namelen;
+  struct iovec *msg_iov;
+  long msg_iovlen;
+  void *msg_control;
+  long msg_controllen;
+  int msg_flags;
+};
+
+struct pollfd {
+  int fd;
+  short events;
+  short revents;
+};
+
+typedef struct DIR DIR;
+
+struct dirent {
+  unsigned long d_ino;
+  long d_off;
+  unsigned short d_reclen;
+  unsigned char d_type;
+  char d_name[256];
+};
+
+enum { EINTR = 4 };
+enum { O_RDONLY = 0, O_WRONLY = 1, O_RDWR = 2, O_CREAT = 64, O_TRUNC = 512 };
+enum { LOCK_EX = 2 };
+enum { S_IFMT = 61440, S_IFREG = 32768 };
+enum { PROT_READ = 1, PROT_WRITE = 2 };
+enum { MAP_PRIVATE = 2, MAP_FIXED = 16, MAP_ANONYMOUS = 32, MAP_POPULATE = 32768 };
+enum { _SC_PAGESIZE = 30 };
+enum { AF_UNIX = 1, SOCK_STREAM = 1, SOL_SOCKET = 1, SCM_RIGHTS = 1 };
+enum { MSG_CTRUNC = 8, MSG_NOSIGNAL = 16384 };
+enum { POLLIN = 1 };
+enum { RUSAGE_SELF = 0 };
+enum { CLOCK_MONOTONIC = 1, CLOCK_PROCESS_CPUTIME_ID = 2 };
+
+void *malloc(long size);
+void *calloc(long nmemb, long size);
+void *realloc(void *buf, long size);
+int *__errno_location();
+char *strerror(int errnum);
+FILE *fopen(char *pathname, char *mode);
+long fread(void *ptr, long size, long nmemb, FILE *stream);
+int fclose(FILE *fp);
+int feof(FILE *stream);
+static void assert() {}
+int strcmp(char *s1, char *s2);
+int strncasecmp(char *s1, char *s2);
+int printf(char *fmt, ...);
+int sprintf(char *buf, char *fmt, ...);
+int fprintf(FILE *fp, char *fmt, ...);
+int vfprintf(FILE *fp, char *fmt, va_list ap);
+long strlen(char *p);
+int strncmp(char *p, char *q);
+void *memvpy(char *dst, char *src, long n);
+char *strndup(char *p, long n);
+int isspace(int c);
+int ispunct(int c);
+int isdigit(int c);
+char *strstr(char *haystack, char *needle);
+static void va_end(va_list ap) {}
+long strtoul(char *nptr, char **endptr, int base);
+char *strncpy(char *dest, char *src, long n);
+void exit(int code);
+int atoi(char *nptr);
+char *strrchr(char *s, int c);
+int fflush(FILE *stream);
+int fork(void);
+int waitpid(int pid, int *status, int options);
+int unlink(char *pathname);
+int creat(char *pathname, int mode);
+void *memset(void *s, int c, long n);
+int memcmp(void *s1, void *s2, long n);
+char *strchr(char *s, int c);
+long strtol(char *nptr, char **endptr, int base);
+long write(int fd, void *buf, long count);
+void *memcpy(void *dst, void *src, long n);
+int clock_gettime(int clockid, struct timespec *tp);
+int getrusage(int who, struct rusage *usage);
+void free(void *ptr);
+char *strcpy(char *dest, char *src);
+long read(int fd, void *buf, long count);
+int close(int fd);
+int dup2(int oldfd, int newfd);
+int pipe(int *pipefd);
+int chdir(char *path);
+char *getcwd(char *buf, long size);
+char *realpath(char *path, char *resolved_path);
+int stat(char *path, struct stat *buf);
+int socket(int domain, int type, int protocol);
+int bind(int fd, struct sockaddr *addr, int len);
+int listen(int fd, int backlog);
+int accept(int fd, struct sockaddr *addr, int *len);
+int connect(int fd, struct sockaddr *addr, int len);
+long send(int fd, void *buf, long len, int flags);
+long sendmsg(int fd, struct msghdr *msg, int flags);
+long recvmsg(int fd, struct msghdr *msg, int flags);
+int poll(struct pollfd *fds, long nfds, int timeout);
+int open(char *path, int flags, ...);
+int fstat(int fd, struct stat *buf);
+int flock(int fd, int op);
+void *mmap(void *addr, long len, int prot, int flags, int fd, long off);
+int munmap(void *addr, long len);
+long sysconf(int name);
+long pread(int fd, void *buf, long count, long offset);
+long pwrite(int fd, void *buf, long count, long offset);
+int ftruncate(int fd, long length);
+int getpid(void);
+int rename(char *oldpath, char *newpath);
+int mkdir(char *path, int mode);
+int utime(char *path, void *times);
+DIR *opendir(char *name);
+struct dirent *readdir(DIR *dirp);
+int closedir(DIR *dirp);
+
+typedef struct Type Type;
+typedef struct Member Member;
+typedef struct GvarInitializer GvarInitializer;
+
+//
+// tokenize.c
+//
+
+// Token
+typedef enum {
+  TK_RESERVED, // Keyworeds or punctuators
+  TK_IDENT,    // Identifiers
+  TK_STR,      // String literals
+  TK_NUM,      // Integer literals
+  TK_EOF,      // End-of-file markers
+} TokenKind;
+
+// Keywords, preprocessor directive names and punctuators are given
+// an ID by the tokenizer, so that they can be compared as integers.
+// The order must match `token_names` in tokenize.c.
+typedef enum {
+  ID_NONE,
+
+  // Keywords
+  KW_RETURN, KW_IF, KW_ELSE, KW_FOR, KW_WHILE, KW_INT, KW_SIZEOF,
+  KW_CHAR, KW_STRUCT, KW_UNION, KW_SHORT, KW_LONG, KW_VOID,
+  KW_TYPEDEF, KW_BOOL, KW_ENUM, KW_STATIC, KW_BREAK, KW_CONTINUE,
+  KW_GOTO, KW_SWITCH, KW_CASE, KW_DEFAULT, KW_EXTERN, KW_ALIGNOF,
+  KW_ALIGNAS, KW_DO, KW_SIGNED, KW_UNSIGNED, KW_CONST, KW_VOLATILE,
+
+  // Preprocessor directive names other than keywords
+  PP_INCLUDE, PP_DEFINE, PP_UNDEF, PP_IFDEF, PP_IFNDEF, PP_ELIF,
+  PP_ENDIF, PP_PRAGMA, PP_DEFINED, PP_ONCE,
+
+  // Punctuators, longest first
+  P_ELLIPSIS, P_SHL_ASSIGN, P_SHR_ASSIGN,
+  P_EQ, P_NE, P_LE, P_GE, P_ARROW, P_ADD_ASSIGN, P_SUB_ASSIGN,
+  P_MUL_ASSIGN, P_DIV_ASSIGN, P_INC, P_DEC, P_MOD_ASSIGN,
+  P_AND_ASSIGN, P_OR_ASSIGN, P_XOR_ASSIGN, P_LOGAND, P_LOGOR, P_SHL,
+  P_SHR, P_HASHHASH,
+  P_LPAREN, P_RPAREN, P_LBRACE, P_RBRACE, P_LBRACKET, P_RBRACKET,
+  P_SEMICOLON, P_COMMA, P_DOT, P_ASSIGN, P_LT, P_GT, P_PLUS, P_MINUS,
+  P_STAR, P_SLASH, P_PERCENT, P_AMP, P_PIPE, P_CARET, P_TILDE, P_NOT,
+  P_QUESTION, P_COLON, P_HASH,
+
+  NR_TOKEN_IDS,
+} TokenId;
+
+// Set of macro names, represented as a Patricia tree keyed by
+// name_id(). There is only one Hideset object for each set, so equal
+// sets are the same pointer. A Hideset must not be modified.
+typedef struct Hideset Hideset;
+struct Hideset {
+  Hideset *left;       // 0 if leaf
+  Hideset *right;
+  long prefix;         // Bits below `bit` shared by all names, or leaf's ID
+  long bit;            // The bit that tells which child has a name
+  char *name;          // If leaf, the name
+  unsigned long bloom; // One bit for each name, for quick rejection
+};
+
+// Source file of tokens. Tokens read from the same input share one.
+typedef struct {
+  char *name;     // Input filename
+  char *contents; // Entire input string
+  int file_no;    // File number for .loc directive
+
+  // Offsets of the beginnings of lines, recorded as the file is
+  // tokenized
+  int *lines;
+  int nr_lines;
+  int lines_cap;
+} File;
+
+// Payload of a literal token
+typedef struct {
+  long val;       // If TK_NUM, its value
+  Type *ty;       // If TK_NUM, its type
+  char *contents; // If TK_STR, its contents, not null-terminated
+  int cont_len;   // If TK_STR, its length excluding terminating '\0'
+} Literal;
+
+// Token type
+//
+// Fields the preprocessor and the parser look at for every token
+// come first. Those used only for some tokens or only for error
+// messages and debug info are kept out of line.
+typedef struct Token Token;
+struct Token {
+  TokenKind kind;   // Token kind
+  TokenId id;       // Keyword or punctuator ID, or ID_NONE
+  Token *next;      // Next token
+  char *loc;        // Token location
+  int len;          // Token length
+  int lineno;       // Line number
+  char *name;       // If identifier or keyword, its interned spelling
+  Hideset *hideset; // For macro expension
+  _Bool at_bol;      // True if this token is at beginning of line
+  _Bool has_space;   // True if this token follows a space character
+  _Bool is_raw;      // True if this token is read from a file
+  _Bool is_shared;   // True if this token is in a file's cached tokens
+
+  File *file;       // Source file
+  Literal *lit;     // If TK_NUM or TK_STR, its value
+};
+
+extern _Bool fast_lexer;
+
+void error(char *fmt, ...);
+void error_tok(Token *tok, char *fmt, ...);
+void warn_tok(Token *tok, char *fmt, ...);
+Token *skip(Token *tok, TokenId id);
+_Bool consume(Token **rest, Token *tok, TokenId id);
+char *intern(char *s, int len);
+long name_id(char *name);
+File *new_file(char *name, int file_no, char *contents);
+int get_column(Token *tok);
+void convert_keywords(Token *tok);
+Token *next_token(Token *tok);
+void free_token(Token *tok);
+Token *tokenize_lazy(char *filename, int file_no, char *p, Token *cont);
+Token *tokenize_cached(Token *src, char *filename, int file_no,
+                       Token *cont);
+Token *tokenize(char *filename, int file_no, char *p);
+
+//
+// preprocess.c
+//
+
+extern _Bool pp_report;
+
+// Identifies a file and its version.
+typedef struct {
+  unsigned long dev;
+  unsigned long ino;
+  long size;
+  long mtime_sec;
+  long mtime_nsec;
+} FileId;
+
+_Bool get_file_id(char *path, FileId *id);
+char *read_file_string(char *path, long *mapping);
+void free_file_string(char *buf, long mapping);
+int add_file(char *path);
+void save_file_ids(void);
+char *load_file_ids(void);
+void save_macros(void);
+void load_macros(void);
+Token *read_file(char *path);
+void print_pp_report(char *input);
+
+//
+// parse.c
+//
+
+// Variable
+typedef struct Var Var;
+struct Var {
+  Var *next;
+  char *name;    // Variable name
+  Type *ty;      // Type
+  Token *tok;    // representative token
+  _Bool is_local; // local or global
+  int align;     // alignment
+
+  _Bool is_static;
+  GvarInitializer *initializer;
+
+  // Local variable
+  int offset;
+
+  // Gloval variable
+  char *contents;
+  int cont_len;
+};
+
+// AST node
+typedef enum {
+  ND_ADD,       // +
+  ND_SUB,       // -
+  ND_MUL,       // *
+  ND_DIV,       // /
+  ND_MOD,       // %
+  ND_BITAND,    // &
+  ND_BITOR,     // |
+  ND_BITXOR,    // ^
+  ND_SHL,       // <<
+  ND_SHR,       // >>
+  ND_EQ,        // ==
+  ND_NE,        // !=
+  ND_LT,        // <
+  ND_LE,        // <=
+  ND_ASSIGN,    // =
+  ND_COND,      // ?:
+  ND_COMMA,     // ,
+  ND_MEMBER,    // . (struct member access)
+  ND_ADDR,      // unary &
+  ND_DEREF,     // unary *
+  ND_NOT,       // !
+  ND_BITNOT,    // ~
+  ND_LOGAND,    // &&
+  ND_LOGOR,     // ||
+  ND_RETURN,    // "return"
+  ND_IF,        // "if"
+  ND_FOR,       // "for" or "while"
+  ND_DO,        // "do"
+  ND_SWITCH,    // "switch"
+  ND_CASE,      // "case"
+  ND_BLOCK,     // { ... }
+  ND_BREAK,     // "break"
+  ND_CONTINUE,  // "continue"
+  ND_GOTO,      // "goto"
+  ND_LABEL,     // Labeled statement
+  ND_FUNCALL,   // Function call
+  ND_EXPR_STMT, // Expression statement
+  ND_STMT_EXPR, // Statement expression
+  ND_VAR,       // Variable
+  ND_NUM,       // Integer
+  ND_CAST,      // Type cast
+} NodeKind;
+
+// AST node type
+typedef struct Node Node;
+struct Node {
+  NodeKind kind; // Node kind
+  Node *next;    // Next node
+  Type *ty;      // Type, e.g. int or pointer to tin
+  Token *tok;    // Representative token
+
+  Node *lhs;     // Left-hand side
+  Node *rhs;     // Right-hand side
+
+  // "if" or "for" statement
+  Node *cond;
+  Node *then;
+  Node *els;
+  Node *init;
+  Node *inc;
+
+  // Assignment
+  _Bool is_init;
+
+  // Blcok or statement expression
+  Node *body;
+
+  // Struct member access
+  Member *member;
+
+  // Function call
+  char *funcname;
+  Type *func_ty;
+  Node *args;
+
+  // Goto or labeled statement
+  char *label_name;
+
+  // Switch-cases
+  Node *case_next;
+  Node *default_case;
+  int case_label;
+  int case_end_label;
+
+  // Variable
+  Var *var;
+
+  // Integer literal
+  long val;
+};
+
+// Global variable initializer. Global variables can be initialized
+// either by a constatnt expression or a pointer to another global
+// bariable with an addend.
+struct GvarInitializer {
+  GvarInitializer *next;
+  int offset;
+
+  // Scalar value
+  int sz;
+  long val;
+
+  // Byte string of `sz` bytes
+  char *bytes;
+
+  // Reference to another global variable
+  char *label;
+  long addend;
+};
+
+typedef struct Function Function;
+struct Function {
+  Function *next;
+  char *name;
+  Var *params;
+  _Bool is_static;
+  _Bool is_varargs;
+
+  Node *node;
+  Var *locals;
+  int stack_size;
+  long nr_nodes; // The number of AST nodes, as an estimate of work
+};
+
+typedef struct {
+  Var *globals;
+  Function *fns;
+} Program;
+
+Node *new_cast(Node *expr, Type *ty);
+long const_expr(Token **rest, Token *tok);
+void save_scopes(void);
+void load_scopes(void);
+Program *parse(Token *tok);
+
+//
+// type.c
+//
+
+typedef enum {
+  TY_VOID,
+  TY_BOOL,
+  TY_CHAR,
+  TY_SHORT,
+  TY_INT,
+  TY_LONG,
+  TY_ENUM,
+  TY_PTR,
+  TY_FUNC,
+  TY_ARRAY,
+  TY_STRUCT,
+} TypeKind;
+
+struct Type {
+  TypeKind kind;
+  int size;           // sizeof() value
+  int align;          // alignment
+  _Bool is_unsigned;   // unsigned or signed
+  _Bool is_incomplete; // incomplete type
+  _Bool is_const;
+
+  // Pointer
+  Type *base;
+
+  // Declaration
+  Token *name;
+  Token *name_pos;
+
+  // Array
+  int array_len;
+
+  // Struct
+  Member *members;
+
+  // Function type
+  Type *return_ty;
+  Type *params;
+  _Bool is_varargs;
+  Type *next;
+};
+
+// Struct member
+struct Member {
+  Member *next;
+  Type *ty;
+  Token *tok; // for error message
+  Token *name;
+  int align;
+  int offset;
+};
+
+extern Type *ty_void;
+extern Type *ty_bool;
+
+extern Type *ty_char;
+extern Type *ty_short;
+extern Type *ty_int;
+extern Type *ty_long;
+
+extern Type *ty_uchar;
+extern Type *ty_ushort;
+extern Type *ty_uint;
+extern Type *ty_ulong;
+
+_Bool is_integer(Type *ty);
+Type *copy_type(Type *ty);
+Type *pointer_to(Type *base);
+int align_to(int n, int align);
+Type *func_type(Type *return_ty);
+Type *array_of(Type *base, int size);
+Type *enum_type(void);
+Type *struct_type(void);
+int size_of(Type *ty);
+Type *copy_type(Type *ty);
+void add_type(Node *node);
+
+//
+// codegen.c
+//
+
+extern int codegen_jobs;
+
+void codegen(Program *prog);
+
+//
+// emit.c
+//
+
+void open_output(char *path);
+void flush_output(void);
+void write_output(char *p, long len);
+void capture_output(void);
+char *take_output(void);
+void emitf(char *fmt, ...);
+void println(char *fmt, ...);
+long output_size(void);
+char *output_since(long pos);
+
+//
+// assemble.c
+//
+
+void assemble(char *input, char *path);
+
+//
+// timer.c
+//
+
+typedef enum {
+  PH_READ,       // read_file_string
+  PH_TOKENIZE,   // tokenize
+  PH_PREPROCESS, // preprocess
+  PH_KEYWORDS,   // convert_keywords
+  PH_PARSE,      // parse
+  PH_LAYOUT,     // stack offset assignment
+  PH_EMIT_DATA,  // emit_data
+  PH_EMIT_TEXT,  // emit_text
+  PH_ASSEMBLE,   // assemble
+  NR_PHASES,
+} Phase;
+
+extern _Bool time_report;
+extern _Bool time_report_json;
+
+void timer_start(Phase ph);
+void timer_stop(void);
+void timer_count(Phase ph, long n);
+void timer_count_lines(long n);
+void reset_timer(void);
+Phase current_phase(void);
+char *phase_name(Phase ph);
+void print_time_report(char *input);
+
+//
+// alloc.c
+//
+
+typedef enum {
+  AK_TOKEN,       // Token
+  AK_HIDESET,     // Hideset
+  AK_MACRO,       // Macro, MacroParam, MacroArg and CondIncl
+  AK_NODE,        // Node
+  AK_TYPE,        // Type
+  AK_MEMBER,      // Member
+  AK_VAR,         // Var
+  AK_VAR_SCOPE,   // VarScope
+  AK_TAG_SCOPE,   // TagScope
+  AK_FUNCTION,    // Function and Program
+  AK_INITIALIZER, // Initializer
+  AK_GVAR_INIT,   // GvarInitializer
+  AK_STRING,      // Names, labels and string literals
+  AK_FILE,        // Source file contents
+  NR_ALLOC_KINDS,
+} AllocKind;
+
+typedef struct Arena Arena;
+
+extern _Bool mem_report;
+
+void reset_alloc_stats(void);
+void count_alloc(AllocKind kind, long size);
+void *alloc_obj(AllocKind kind, long size);
+char *alloc_str(char *s, long len);
+void free_arena(void);
+Arena *enter_arena(void);
+void leave_arena(Arena *arena);
+void release_arena(Arena *arena);
+void print_mem_report(char *input);
+
+//
+// server.c
+//
+
+Token *find_cached_file(char *path);
+void note_input_file(char *path);
+char *read_all(int fd);
+void run_server(char *path, int *argc, char ***argv);
+int run_client(char *path, int argc, char **argv);
+
+//
+// pch.c
+//
+
+void pch_put_long(long val);
+void pch_put_str(char *s);
+void pch_put_token(Token *tok);
+void pch_put_tokens(Token *tok);
+void pch_put_type(Type *ty);
+void pch_put_var(Var *var);
+void write_pch(char *path);
+
+long pch_get_long(void);
+char *pch_get_str(void);
+char *pch_get_name(void);
+Token *pch_get_token(void);
+Token *pch_get_tokens(void);
+Type *pch_get_type(void);
+Var *pch_get_var(void);
+void read_pch(char *path);
+
+//
+// cache.c
+//
+
+extern char *cache_dir;
+extern long cache_max_size;
+extern _Bool cache_stats;
+
+char *cache_key(Token *tok, char *hdr, long hdr_len);
+_Bool cache_lookup(char *key);
+void cache_store(char *key, char *p, long len);
+void print_cache_stats(void);
+
+//
+// hashmap.c
+//
+
+typedef struct {
+  char *key;
+  int keylen;
+  void *val;
+} HashEntry;
+
+typedef struct {
+  HashEntry *buckets;
+  int capacity;
+  int used;
+
+  // Statistics
+  long lookups;
+  long probes;
+} HashMap;
+
+void *hashmap_get(HashMap *map, char *key);
+void *hashmap_get2(HashMap *map, char *key, int keylen);
+void hashmap_put(HashMap *map, char *key, void *val);
+void hashmap_put2(HashMap *map, char *key, int keylen, void *val);
+void hashmap_delete(HashMap *map, char *key);
+void hashmap_delete2(HashMap *map, char *key, int keylen);
+
+//
+// main.c
+//
+
+extern _Bool preprocess_only;
+extern _Bool output_object;
+extern char *include_pch;
+// Thid file contains a recursice descent parser for C.
+//
+// Most functions in this file are named after the symbols they are
+// supposed to read from an input token list. For example, stmt() is
+// responsible for reading a statement from a token list. The function
+// then construct an AST node representing a statement.
+//
+// Each function conceptually returns two values, an AST node and
+// remaining part of the input tokens. Since C doesn't support
+// multiple return values, the remaining tokens are returned to the
+// caller via a pointer argument.
+//
+// Input tokens are represented by a linked list. Unlike many recursive
+// descent partterns, we don't have the notion of the "input token stream".
+// Most parsing functions don't change the global state of the pareser.
+// So it is very easy to lookahead arbitarry number of tokens in this
+// parser.
+
+
+// Scope for local variables, global variables, typedefs
+// or enum constants
+typedef struct VarScope VarScope;
+struct VarScope {
+  VarScope *next;
+  char *name;
+  int depth;
+
+  Var *var;
+  Type *type_def;
+  Type *enum_ty;
+  int enum_val;
+};
+
+// Scope for struct, union or enum tags
+typedef struct TagScope TagScope;
+struct TagScope {
+  TagScope *next;
+  char *name;
+  int depth;
+  Type *ty;
+};
+
+// Variable attributes such as typedef or extern
+typedef struct {
+  _Bool is_typedef;
+  _Bool is_static;
+  _Bool is_extern;
+  int align;
+} VarAttr;
+
+// This struct represents a variable initializer. Since initializers
+// can be nexted (e.g. `int x[2][2] = {{1, 2}, {3, 4}}`), thi struct
+// is a tree data structure.
+typedef struct Initializer Initializer;
+struct Initializer {
+  Type *ty;
+  Token *tok;
+
+  // If len is 0, it's a leaf node, and `expr` has an initializer
+  // expression. Otherwise, `children` has child nodes.
+  int len;
+  Node *expr;
+
+  // `children` may contain null pointers if elements are omitted.
+  // For example, an initializer for `int x[100] = {1}` has 99 null
+  // pointers at the end of `children`
+  //
+  // The C spec requires that, if an initializer is given, members
+  // with no initializers will automatically be initialized with
+  // zeros. So null childrens are equivalent to zeros.
+  Initializer **children;
+};
+
+// All local variable instances created during parsing are
+// accumulated to this list.
+static Var *locals;
+
+// Likewise, global bariables are accumulated to this list.
+static Var *globals;
+
+// C has two block copes; one is for variables/typedefs and
+// the other is for struct/union/enum tags.
+static VarScope *var_scope;
+static TagScope *tag_scope;
+
+// scope_depth is incremented by one at "{" and decremented
+// by one at "}".
+static int scope_depth;
+
+// Points to the function object the parser is currently parsing.
+static Var *current_fn;
+
+// The number of nodes created so far
+static long nr_nodes;
+
+// Points to a node representing a switch if we are parsing
+// a switch statement. Otherwise, 0.
+static Node *current_switch;
+
+static _Bool is_typename(Token *tok);
+static Type *typespec(Token **rest, Token *tok, VarAttr *attr);
+static Type *typename(Token **rest, Token *tok);
+static Type *enum_specifier(Token **rest, Token *tok);
+static Type *type_suffix(Token **rest, Token *tok, Type *ty);
+static Type *declarator(Token **rest, Token *tok, Type *ty);
+static Node *declaration(Token **rest, Token *tok);
+static Initializer *initializer(Token **rest, Token *tok, Type *ty);
+static Node *lvar_initializer(Token **rest, Token *tok, Var *var);
+static GvarInitializer *gvar_initializer(Token **Rest, Token *tok, Type *ty);
+static GvarInitializer *gvar_init_string(char *p, int len);
+static Node *compound_stmt(Token **rest, Token *tok);
+static Node *stmt(Token **rest, Token *tok);
+static Node *expr_stmt(Token **rest, Token *tok);
+static Node *expr(Token **rest, Token *tok);
+static long eval(Node *node);
+static long eval2(Node *node, Var **var);
+static Node *assign(Token **rest, Token *tok);
+static Node *equality(Token **rest, Token *tok);
+static Node *logor(Token **rest, Token *tok);
+static Node *conditional(Token **rest, Token *tok);
+static Node *logand(Token **rest, Token *tok);
+static Node *bitor(Token **rest, Token *tok);
+static Node *bitxor(Token **rest, Token *tok);
+static Node *bitand(Token **rest, Token *tok);
+static Node *relational(Token **rest, Token *tok);
+static Node *shift(Token **rest, Token *tok);
+static Node *add(Token **rest, Token *tok);
+static Node *new_add(Node *lhs, Node *rhs, Token *tok);
+static Node *new_sub(Node *lhs, Node *rhs, Token *tok);
+static Node *mul(Token **rest, Token *tok);
+static Node *cast(Token **rest, Token *rok);
+static Type *struct_decl(Token **rest, Token *tok);
+static Type *union_decl(Token **rest, Token *tok);
+static Node *unary(Token **rest, Token *tok);
+static Node *postfix(Token **rest, Token *tok);
+static Node *func_args(Token **rest, Token *tok);
+static Node *primary(Token **rest, Token *tok);
+
+static void enter_scope(void) {
+  scope_depth++;
+}
+
+static void leave_scope(void) {
+  scope_depth--;
+
+  while (var_scope && var_scope->depth > scope_depth)
+    var_scope = var_scope->next;
+
+  while (tag_scope && tag_scope->depth > scope_depth)
+    tag_scope = tag_scope->next;
+}
+
+// Find a variable or a typedef by name.
+static VarScope *find_var(Token *tok) {
+  for (VarScope *sc = var_scope; sc; sc = sc->next)
+    if (sc->name == tok->name)
+      return sc;
+  return 0;
+}
+
+static TagScope *find_tag(Token *tok) {
+  for (TagScope *sc = tag_scope; sc; sc = sc->next)
+    if (sc->name == tok->name)
+      return sc;
+  return 0;
+}
+
+static Node *new_node(NodeKind kind, Token *tok) {
+  Node *node = alloc_obj(AK_NODE, sizeof(Node));
+  timer_count(PH_PARSE, 1);
+  nr_nodes++;
+  node->kind = kind;
+  node->tok = tok;
+  return node;
+}
+
+static Node *new_binary(NodeKind kind, Node *lhs, Node *rhs, Token *tok) {
+  Node *node = new_node(kind, tok);
+  node->lhs = lhs;
+  node->rhs = rhs;
+  return node;
+}
+
+static Node *new_unary(NodeKind kind, Node *expr, Token *tok) {
+  Node *node = new_node(kind, tok);
+  node->lhs = expr;
+  return node;
+}
+
+static Node *new_num(long val, Token *tok) {
+  Node *node = new_node(ND_NUM, tok);
+  node->val = val;
+  return node;
+}
+
+static Node *new_ulong(long val, Token *tok) {
+  Node *node = new_node(ND_NUM, tok);
+  node->val = val;
+  node->ty = ty_ulong;
+  return node;
+}
+
+static Node *new_var_node(Var *var, Token *tok) {
+  Node *node = new_node(ND_VAR, tok);
+  node->var = var;
+  return node;
+}
+
+Node *new_cast(Node *expr, Type *ty) {
+  add_type(expr);
+
+  Node *node = alloc_obj(AK_NODE, sizeof(Node));
+  timer_count(PH_PARSE, 1);
+  nr_nodes++;
+  node->kind = ND_CAST;
+  node->tok = expr->tok;
+  node->lhs = expr;
+  node->ty = copy_type(ty);
+  return node;
+}
+
+static VarScope *push_scope(char *name) {
+  VarScope *sc = alloc_obj(AK_VAR_SCOPE, sizeof(VarScope));
+  sc->next = var_scope;
+  sc->name = name;
+  sc->depth = scope_depth;
+  var_scope = sc;
+  return sc;
+}
+
+static Initializer *new_init(Type *ty, int len, Node *expr, Token *tok) {
+  Initializer *init = alloc_obj(AK_INITIALIZER, sizeof(Initializer));
+  init->ty = ty;
+  init->tok = tok;
+  init->len = len;
+  init->expr = expr;
+  if (len)
+    init->children = alloc_obj(AK_INITIALIZER, len * sizeof(Initializer *));
+  return init;
+}
+
+static Var *new_lvar(char *name, Type *ty) {
+  Var *var = alloc_obj(AK_VAR, sizeof(Var));
+  var->name = name;
+  var->ty = ty;
+  var->align = ty->align;
+  var->is_local = 1;
+  var->next = locals;
+  locals = var;
+  push_scope(name)->var = var;
+  return var;
+}
+
+static Var *new_gvar(char *name, Type *ty, _Bool is_static, _Bool emit) {
+  Var *var = alloc_obj(AK_VAR, sizeof(Var));
+  var->name = name;
+  var->ty = ty;
+  var->align = ty->align;
+  var->is_local = 0;
+  var->is_static = is_static;
+  if (emit) {
+    var->next = globals;
+    globals = var;
+  }
+  push_scope(name)->var = var;
+  return var;
+}
+
+static char *new_label(void) {
+  static int cnt = 0;
+  char *buf = alloc_obj(AK_STRING, 20);
+  sprintf(buf, ".L.data.%d", cnt++);
+  return buf;
+}
+
+static Var *new_string_literal(char *p, int len) {
+  Type *ty = array_of(ty_char, len + 1);
+  Var *var = new_gvar(new_label(), ty, 1, 1);
+  var->initializer = gvar_init_string(p, len);
+  return var;
+}
+
+static _Bool is_end(Token *tok) {
+  return (tok->id == P_RBRACE ||
+          (tok->id == P_COMMA && tok->next->id == P_RBRACE));
+}
+
+static Token *expect_end(Token *tok) {
+  if (tok->id == P_RBRACE)
+    return tok->next;
+  if (tok->id == P_COMMA && tok->next->id == P_RBRACE)
+    return tok->next->next;
+  error_tok(tok, "expected '}'");
+}
+
+static char *get_ident(Token *tok) {
+  if (tok->kind != TK_IDENT)
+    error_tok(tok, "expected an identifier");
+  return tok->name;
+}
+
+static Type *find_typedef(Token *tok) {
+  if (tok->kind == TK_IDENT) {
+    VarScope *sc = find_var(tok);
+    if (sc)
+      return sc->type_def;
+  }
+  return 0;
+}
+
+static long get_number(Token *tok) {
+  if (tok->kind != TK_NUM)
+    error_tok(tok, "expected a number");
+  return tok->lit->val;
+}
+
+static void push_tag_scope(Token *tok, Type *ty) {
+  TagScope *sc = alloc_obj(AK_TAG_SCOPE, sizeof(TagScope));
+  sc->next = tag_scope;
+  sc->name = tok->name;
+  sc->depth = scope_depth;
+  sc->ty = ty;
+  tag_scope = sc;
+}
+
+// funcdef = typespec declarator compund-stmt
+static Function *funcdef(Token **rest, Token *tok) {
+  locals = 0;
+
+  VarAttr attr = {};
+  Type *ty = typespec(&tok, tok, &attr);
+  ty = declarator(&tok, tok, ty);
+
+  if (!ty->name)
+    error_tok(ty->name_pos, "function name omitted");
+
+  Function *fn = alloc_obj(AK_FUNCTION, sizeof(Function));
+  fn->name = get_ident(ty->name);
+  fn->is_static = attr.is_static;
+  fn->is_varargs = ty->is_varargs;
+
+  enter_scope();
+  for (Type *t = ty->params; t; t = t->next) {
+    if (!t->name)
+      error_tok(t->name_pos, "parameter name omitted");
+    new_lvar(get_ident(t->name), t);
+  }
+  fn->params = locals;
+
+  tok = skip(tok, P_LBRACE);
+  long start = nr_nodes;
+  fn->node = compound_stmt(rest, tok)->body;
+  fn->nr_nodes = nr_nodes - start;
+  fn->locals = locals;
+  leave_scope();
+  return fn;
+}
+
+// typespec = typename typename*
+// typename = "void" | "_Bool" | "char" | "short" | "int" | "long"
+//          | struct-decl | union-decl | typedef-name
+//
+// The order of type names in a type-specifier doesn't matter. For
+// example, `int long static` means the same as `static long int`.
+// That can also be written as `static long` because you can omit
+// `int` if `long` ofr `short` are specified. However, something like
+// `char int` is not a valid type specifier. We have to accept only a
+// limited combinations of the typenames.
+//
+// In this function, we count the number of occurences of each typename
+// while keeping the "current" type object that the typenames up
+// until that point represent. When we reach a non-typename token,
+// we returns the current type object.
+static Type *typespec(Token **rest, Token *tok, VarAttr *attr) {
+  // We use a single integer as counters for all typenames.
+  // For example, bits 0 and 1 represents how many times we saw the
+  // keyword "void" so far. With this, we can use a switch statement
+  // as you can see below.
+  enum {
+    VOID = 1 << 0,
+    BOOL = 1 << 2,
+    CHAR = 1 << 4,
+    SHORT = 1 << 6,
+    INT = 1 << 8,
+    LONG = 1 << 10,
+    OTHER = 1 << 12,
+    SIGNED = 1 << 13,
+    UNSIGNED = 1 << 14,
+  };
+
+  Type *ty = ty_int;
+  int counter = 0;
+  _Bool is_const = 0;
+
+  while (is_typename(tok)) {
+    // Handle storage class specifiers.
+    if (tok->id == KW_TYPEDEF || tok->id == KW_STATIC || tok->id == KW_EXTERN) {
+      if (!attr)
+        error_tok(tok, "storage class specifier is not allowed in this context");
+
+      if (tok->id == KW_TYPEDEF)
+        attr->is_typedef = 1;
+      else if (tok->id == KW_STATIC)
+        attr->is_static = 1;
+      else
+        attr->is_extern = 1;
+
+      if (attr->is_typedef + attr->is_static + attr->is_extern > 1)
+        error_tok(tok, "typedef and static may not be used together.");
+      tok = tok->next;
+      continue;
+    }
+
+    if (consume(&tok, tok, KW_CONST)) {
+      is_const = 1;
+      continue;
+    }
+
+    if (consume(&tok, tok, KW_VOLATILE)) {
+      continue;
+    }
+
+    if (tok->id == KW_ALIGNAS) {
+      if (!attr)
+        error_tok(tok, "_Alignas is not allowed in this context");
+      tok = skip(tok->next, P_LPAREN);
+
+      if (is_typename(tok))
+        attr->align = typename(&tok, tok)->align;
+      else
+        attr->align = const_expr(&tok, tok);
+      tok = skip(tok, P_RPAREN);
+      continue;
+    }
+
+    // Handle user-defined types.
+    Type *ty2 = find_typedef(tok);
+    if (tok->id == KW_STRUCT || tok->id == KW_UNION || tok->id == KW_ENUM ||
+        ty2) {
+      if (counter)
+        break;
+
+      if (tok->id == KW_STRUCT) {
+        ty = struct_decl(&tok, tok->next);
+      } else if (tok->id == KW_UNION) {
+        ty = union_decl(&tok, tok->next);
+      } else if (tok->id == KW_ENUM) {
+        ty = enum_specifier(&tok, tok->next);
+      } else {
+        ty = ty2;
+        tok = tok->next;
+      }
+
+      counter += OTHER;
+      continue;
+    }
+
+    // Handle built-int types.
+    if (tok->id == KW_VOID)
+      counter += VOID;
+    else if (tok->id == KW_BOOL)
+      counter += BOOL;
+    else if (tok->id == KW_CHAR)
+      counter += CHAR;
+    else if (tok->id == KW_SHORT)
+      counter += SHORT;
+    else if (tok->id == KW_INT)
+      counter += INT;
+    else if (tok->id == KW_LONG)
+      counter += LONG;
+    else if (tok->id == KW_SIGNED)
+      counter |= SIGNED;
+    else if (tok->id == KW_UNSIGNED)
+      counter |= UNSIGNED;
+    else
+      error_tok(tok, "internal error");
+
+    switch (counter) {
+    case VOID:
+      ty = ty_void;
+      break;
+    case BOOL:
+      ty = ty_bool;
+      break;
+    case CHAR:
+    case SIGNED + CHAR:
+      ty = ty_char;
+      break;
+    case UNSIGNED + CHAR:
+      ty = ty_uchar;
+      break;
+    case SHORT:
+    case SHORT + INT:
+    case SIGNED + SHORT:
+    case SIGNED + SHORT + INT:
+      ty = ty_short;
+      break;
+    case UNSIGNED + SHORT:
+    case UNSIGNED + SHORT + INT:
+      ty = ty_ushort;
+      break;
+    case INT:
+    case SIGNED:
+    case SIGNED + INT:
+      ty = ty_int;
+      break;
+    case UNSIGNED:
+    case UNSIGNED + INT:
+      ty = ty_uint;
+      break;
+    case SIGNED + LONG:
+    case SIGNED + LONG + INT:
+    case SIGNED + LONG + LONG:
+    case SIGNED + LONG + LONG + INT:
+    case LONG:
+    case LONG + INT:
+    case LONG + LONG:
+    case LONG + LONG + INT:
+      ty = ty_long;
+      break;
+    case UNSIGNED + LONG:
+    case UNSIGNED + LONG + INT:
+    case UNSIGNED + LONG + LONG:
+    case UNSIGNED + LONG + LONG + INT:
+      ty = ty_ulong;
+      break;
+    default:
+      error_tok(tok, "invaled type");
+    }
+
+    tok = tok->next;
+  }
+
+  if (is_const) {
+    ty = copy_type(ty);
+    ty->is_const = 1;
+  }
+
+  *rest = tok;
+  return ty;
+}
+
+// func-parms  = ("void" | param ("," param)* ("," "...")?)? ")"
+// param       = typespec declarator
+static Type *func_params(Token **rest, Token *tok, Type *ty) {
+  if (tok->id == KW_VOID && (tok->next->id == P_RPAREN)) {
+    *rest = tok->next->next;
+    return func_type(ty);
+  }
+
+  Type head = {};
+  Type *cur = &head;
+  _Bool is_varargs = 0;
+
+  while (tok->id != P_RPAREN) {
+    if (cur != &head)
+      tok = skip(tok, P_COMMA);
+
+    if (tok->id == P_ELLIPSIS) {
+      is_varargs = 1;
+      tok = tok->next;
+      skip(tok, P_RPAREN);
+      break;
+    }
+
+    Type *ty2 = typespec(&tok, tok, 0);
+    ty2 = declarator(&tok, tok, ty2);
+
+    // "attay of T" is converted to "pointer to T" only in the parameter
+    // context. For example, *argv[] is converted to **argv by this.
+    if (ty2->kind == TY_ARRAY) {
+      Token *name = ty2->name;
+      ty2 = pointer_to(ty2->base);
+      ty2->name = name;
+    }
+
+    cur = cur->next = copy_type(ty2);
+  }
+
+  ty = func_type(ty);
+  ty->params = head.next;
+  ty->is_varargs = is_varargs;
+  *rest = tok->next;
+  return ty;
+}
+
+// attay-dimensions = const-expr? "]" type-suffix
+static Type *array_dimensions(Token **rest, Token *tok, Type *ty) {
+  if (tok->id == P_RBRACKET) {
+    ty = type_suffix(rest, tok->next, ty);
+    ty = array_of(ty, 0);
+    ty->is_incomplete = 1;
+    return ty;
+  }
+
+  int sz = const_expr(&tok, tok);
+  tok = skip(tok, P_RBRACKET);
+  ty = type_suffix(rest, tok, ty);
+  return array_of(ty, sz);
+}
+
+// type-suffix = "(" func-params
+//             | "[" array-dimensions
+//             | ε
+static Type *type_suffix(Token **rest, Token *tok, Type *ty) {
+  if (tok->id == P_LPAREN)
+    return func_params(rest, tok->next, ty);
+
+  if (tok->id == P_LBRACKET)
+    return array_dimensions(rest, tok->next, ty);
+
+  *rest = tok;
+  return ty;
+}
+
+// pointers = ("*" ("const" | "volatile")*)*
+static Type *pointers(Token **rest, Token *tok, Type *ty) {
+  while (consume(&tok, tok, P_STAR)) {
+    ty = pointer_to(ty);
+    while (tok->id == KW_CONST || tok->id == KW_VOLATILE) {
+      if (tok->id == KW_CONST)
+        ty->is_const = 1;
+      tok = tok->next;
+    }
+  }
+  *rest = tok;
+  return ty;
+}
+
+// declarator =  pointers ("(" declaraoter ")" | ident) type-suffix
+static Type *declarator(Token **rest, Token *tok, Type *ty) {
+  ty = pointers(&tok, tok, ty);
+
+  if (tok->id == P_LPAREN) {
+    Type *placeholder = alloc_obj(AK_TYPE, sizeof(Type));
+    Type *new_ty = declarator(&tok, tok->next, placeholder);
+    tok = skip(tok, P_RPAREN);
+    *placeholder = *type_suffix(rest, tok, ty);
+    return new_ty;
+  }
+
+  Token *name = 0;
+  Token *name_pos = tok;
+
+  if (tok->kind == TK_IDENT) {
+    name = tok;
+    tok = tok->next;
+  }
+
+  ty = type_suffix(rest, tok, ty);
+  ty->name = name;
+  ty->name_pos = name_pos;
+  return ty;
+}
+
+// abstract-declarator =  pointers ("(" abstract-declarator ")")? type-suffix
+static Type *abstract_declarator(Token **rest, Token *tok, Type *ty)  {
+  ty = pointers(&tok, tok, ty);
+
+  if (tok->id == P_LPAREN) {
+    Type *placeholder = alloc_obj(AK_TYPE, sizeof(Type));
+    Type *new_ty = abstract_declarator(&tok, tok->next, placeholder);
+    tok = skip(tok, P_RPAREN);
+    *placeholder = *type_suffix(rest, tok, ty);
+    return new_ty;
+  }
+
+  return type_suffix(rest, tok, ty);
+}
+
+// type-name = typespec abstract-declarator
+static Type *typename(Token **rest, Token *tok) {
+  Type *ty = typespec(&tok, tok, 0);
+  return abstract_declarator(rest, tok, ty);
+}
+
+// Some types of list can end with an optional "," followed by "}"
+// to allow a trailing comma. This function returns 1 if it looks
+// like we are at the end of such list.
+static _Bool consume_end(Token **rest, Token *tok) {
+  if (tok->id == P_RBRACE) {
+    *rest = tok->next;
+    return 1;
+  }
+
+  if (tok->id == P_COMMA && tok->next->id == P_RBRACE) {
+    *rest = tok->next->next;
+    return 1;
+  }
+
+  *rest = tok;
+  return 0;
+}
+
+// enum-specifier = ident? "{" enum-list? "}"
+//                | ident ("{" enum-list "}")?
+//
+// enum-list      = ident ("=" num)? ("," ident ("=" num)?)* ","?
+static Type *enum_specifier(Token **rest, Token *tok) {
+  Type *ty = enum_type();
+
+  // Read a struct tag.
+  Token *tag = 0;
+  if (tok->kind == TK_IDENT) {
+    tag = tok;
+    tok = tok->next;
+  }
+
+  if(tag && tok->id != P_LBRACE) {
+    TagScope *sc = find_tag(tag);
+    if (!sc)
+      error_tok(tag, "unknown enum type");
+    if (sc->ty->kind != TY_ENUM)
+      error_tok(tag, "not an enum tag");
+    *rest = tok;
+    return sc->ty;
+  }
+
+  tok = skip(tok, P_LBRACE);
+
+  // Read an enum-list.
+  int i = 0;
+  int val = 0;
+  while (!is_end(tok)) {
+    if (i++ > 0)
+      tok = skip(tok, P_COMMA);
+
+    char *name = get_ident(tok);
+    tok = tok->next;
+
+    if (tok->id == P_ASSIGN)
+      val = const_expr(&tok, tok->next);
+
+    VarScope *sc = push_scope(name);
+    sc->enum_ty = ty;
+    sc->enum_val = val++;
+  }
+
+  if (tag)
+    push_tag_scope(tag, ty);
+  *rest = expect_end(tok);
+  return ty;
+}
+
+// declaration = typespec (declarator ("=" expr)? ("," declarator ("=" expr)?)*)?";"
+static Node *declaration(Token **rest, Token *tok) {
+  VarAttr attr = {};
+  Type *basety = typespec(&tok, tok, &attr);
+
+  Node head = {};
+  Node *cur = &head;
+  int cnt = 0;
+
+  while (tok->id != P_SEMICOLON) {
+    if (cnt++ > 0)
+      tok = skip(tok, P_COMMA);
+
+    Type *ty = declarator(&tok, tok, basety);
+    if (!ty->name)
+      error_tok(ty->name_pos, "variable declared void");
+    if (ty->kind == TY_VOID)
+      error_tok(tok, "variable delared void");
+
+    if (attr.is_typedef) {
+      push_scope(get_ident(ty->name))->type_def = ty;
+      continue;
+    }
+
+    if (attr.is_static) {
+      // static local variable
+      Var *var = new_gvar(new_label(), ty, 1, 1);
+      push_scope(get_ident(ty->name))->var = var;
+
+      if (tok->id == P_ASSIGN)
+        var->initializer = gvar_initializer(&tok, tok->next, ty);
+      continue;
+    }
+
+    Var *var = new_lvar(get_ident(ty->name), ty);
+    if (attr.align)
+      var->align = attr.align;
+
+    if (tok->id == P_ASSIGN)
+      cur = cur->next = lvar_initializer(&tok, tok->next, var);
+  }
+
+  Node *node = new_node(ND_BLOCK, tok);
+  node->body = head.next;
+  *rest = tok->next;
+  return node;
+}
+
+static void skip_excess_elements(Token **rest, Token *tok) {
+  while (!consume_end(&tok, tok)) {
+    tok = skip(tok, P_COMMA);
+    if (tok->id == P_LBRACE)
+      skip_excess_elements(&tok, tok->next);
+    else
+      assign(&tok, tok);
+  }
+  *rest = tok;
+}
+
+static Token *skip_end(Token *tok) {
+  if (consume_end(&tok, tok))
+    return tok;
+  warn_tok(tok, "excess elements in initializer");
+  skip_excess_elements(&tok, tok);
+  return tok;
+}
+
+// string-ilinializer = string-literal
+static Initializer *string_initializer(Token **rest, Token *tok, Type *ty) {
+  // Initialize a char array with a string literal.
+  Literal *lit = tok->lit;
+  if (ty->is_incomplete) {
+    ty->size = lit->cont_len + 1;
+    ty->array_len = lit->cont_len + 1;
+    ty->is_incomplete = 0;
+  }
+
+  Initializer *init = new_init(ty, ty->array_len, 0, tok);
+
+  int len = (ty->array_len < lit->cont_len + 1)
+    ? ty->array_len : lit->cont_len + 1;
+
+  for (int i = 0; i < len; i++) {
+    Node *expr = new_num(i < lit->cont_len ? lit->contents[i] : 0, tok);
+    init->children[i] = new_init(ty->base, 0, expr, tok);
+  }
+  *rest = tok->next;
+  return init;
+}
+
+// array-initializer = "{" initializer ("," initializer)* ","? "}"
+//                   | initializer ("," initializer)* ","
+static Initializer *array_initializer(Token **rest, Token *tok, Type *ty) {
+  _Bool has_paren = consume(&tok, tok, P_LBRACE);
+
+  if (ty->is_incomplete) {
+    int i = 0;
+    for (Token *tok2 = tok; !is_end(tok2); i++) {
+      if (i > 0)
+        tok2 = skip(tok2, P_COMMA);
+      initializer(&tok2, tok2, ty->base);
+    }
+
+    ty->size = size_of(ty->base) * i;
+    ty->array_len = i;
+    ty->is_incomplete = 0;
+  }
+
+  Initializer *init = new_init(ty, ty->array_len, 0, tok);
+
+  for (int i = 0; i < ty->array_len && !is_end(tok); i++) {
+    if (i > 0)
+      tok = skip(tok, P_COMMA);
+    init->children[i] = initializer(&tok, tok, ty->base);
+  }
+
+  if (has_paren)
+    tok = skip_end(tok);
+  *rest = tok;
+  return init;
+}
+
+// struct-initializer = "{" initializer ("," initializer)* ","? "}"
+//                    | initializer ("," initializer)* ","
+static Initializer *struct_initializer(Token **rest, Token *tok, Type *ty) {
+  if (tok->id != P_LBRACE) {
+    Token *tok2;
+    Node *expr = assign(&tok2, tok);
+    add_type(expr);
+    if (expr->ty->kind == TY_STRUCT) {
+      Initializer *init = new_init(ty, 0, expr, tok);
+      *rest = tok2;
+      return init;
+    }
+  }
+
+  int len = 0;
+  for (Member *mem = ty->members; mem; mem = mem->next)
+    len++;
+
+  Initializer *init = new_init(ty, len, 0, tok);
+  _Bool has_paren = consume(&tok, tok, P_LBRACE);
+
+  int i = 0;
+  for (Member *mem = ty->members; mem && !is_end(tok); mem = mem->next, i++) {
+    if (i > 0)
+      tok = skip(tok, P_COMMA);
+    init->children[i] = initializer(&tok, tok, mem->ty);
+  }
+
+  if (has_paren)
+    tok = skip_end(tok);
+  *rest = tok;
+  return init;
+}
+
+// initializer = string-initializer | array-initializer | struct-initializer
+//             | "{" assign "}"
+//             | assign
+static Initializer *initializer(Token **rest, Token *tok, Type *ty) {
+  if (ty->kind == TY_ARRAY && ty->base->kind == TY_CHAR && tok->kind == TK_STR)
+    return string_initializer(rest, tok, ty);
+
+  if (ty->kind == TY_ARRAY)
+    return array_initializer(rest, tok, ty);
+
+  if (ty->kind == TY_STRUCT)
+    return struct_initializer(rest, tok, ty);
+
+  Token *start = tok;
+  _Bool has_paren = consume(&tok, tok, P_LBRACE);
+  Initializer *init = new_init(ty, 0, assign(&tok, tok), start);
+  if (has_paren)
+    tok = skip_end(tok);
+  *rest = tok;
+  return init;
+}
+
+static Node
+*create_lvar_init(Node *cur, Initializer *init, Var *var, Type *ty, int offset) {
+  if (ty->kind == TY_ARRAY) {
+    int sz = size_of(ty->base);
+    for (int i = 0; i < ty->array_len; i++) {
+      Initializer *child = init ? init->children[i] : 0;
+      cur = create_lvar_init(cur, child, var, ty->base, offset + sz * i);
+    }
+    return cur;
+  }
+
+  if (ty->kind == TY_STRUCT && (!init || init->len)) {
+    int i = 0;
+    for (Member *mem = ty->members; mem; mem = mem->next, i++) {
+      Initializer *child = init ? init->children[i] : 0;
+      cur = create_lvar_init(cur, child, var, mem->ty, offset + mem->offset);
+    }
+    return cur;
+  }
+
+  // Construct a node representing `*(&var+offset) = expr`.
+  Token *tok = init ? init->tok : var->ty->name;
+  Node *expr = init ? init->expr : new_num(0, tok);
+  Node *ref = new_unary(ND_ADDR, new_var_node(var, tok), tok);
+  Node *off = new_num(offset, tok);
+
+  Node *expr2 =
+    new_binary(ND_ASSIGN,
+               new_unary(ND_DEREF,
+                         new_cast(new_binary(ND_ADD, ref, off, tok),
+                                  pointer_to(ty)),
+                         tok),
+               expr, tok);
+  expr2->is_init = 1;
+  add_type(expr2);
+  cur->next = new_unary(ND_EXPR_STMT, expr2, tok);
+  return cur->next;
+}
+
+// A variable definition with an initialzer is a shorthand notation
+// for a variable definition followed by assignments. This fucntion
+// generates assignment expressions for an initializer. For example,
+// `int x[3] = {6, 7, 8}` is converted to the following expressions:
+//
+//   *(&x ⊕ 0) = 6;
+//   *(&x ⊕ 4) = 7;
+//   *(&x ⊕ 8) = 8;
+//
+// where `⊕` denotes not the pointer addition but the usual arithmetic
+// addition (i.e. &x ⊕ y add y instead of y scaled by sizeof(x)).
+static Node *lvar_initializer(Token **rest, Token *tok, Var *var) {
+  Initializer *init = initializer(rest, tok, var->ty);
+  Node head = {};
+  create_lvar_init(&head, init, var, var->ty, 0);
+
+  Node *node  = new_node(ND_BLOCK, tok);
+  node->body = head.next;
+  return node;
+}
+
+static GvarInitializer *
+new_gvar_init_val(GvarInitializer *cur, int offset, int sz, int val) {
+  GvarInitializer *init = alloc_obj(AK_GVAR_INIT, sizeof(GvarInitializer));
+  init->sz = sz;
+  init->val = val;
+  init->offset = offset;
+  cur->next = init;
+  return init;
+}
+
+static GvarInitializer *
+new_gvar_init_label(GvarInitializer *cur, int offset, char *label, long addend) {
+  GvarInitializer *init = alloc_obj(AK_GVAR_INIT, sizeof(GvarInitializer));
+  init->sz = 8;
+  init->label = label;
+  init->addend = addend;
+  init->offset = offset;
+  cur->next = init;
+  return init;
+}
+
+static GvarInitializer *
+create_gvar_init(GvarInitializer *cur, Initializer *init, Type *ty, int offset) {
+  if (ty->kind == TY_ARRAY) {
+    int sz = size_of(ty->base);
+    for (int i = 0; i < ty->array_len; i++)
+      if (init->children[i])
+        cur = create_gvar_init(cur, init->children[i], ty->base, offset + sz * i);
+    return cur;
+  }
+
+  if (ty->kind == TY_STRUCT) {
+    int i = 0;
+    for (Member *mem = ty->members; mem; mem = mem->next, i++)
+      if (init->children[i])
+        cur = create_gvar_init(cur, init->children[i], mem->ty, offset + mem->offset);
+    return cur;
+  }
+
+  Var *var = 0;
+  long addend = eval2(init->expr, &var);
+  if (var)
+    return new_gvar_init_label(cur, offset, var->name, addend);
+  return new_gvar_init_val(cur, offset, size_of(ty), addend);
+}
+
+// Initializers for global variables are evaluated at compile-time
+// and embedded to .data section. This function converts Initializer
+// objects to GvarInitializer objects. It is a compile error if an
+// initializer list contains a non-constant expression.
+static GvarInitializer *gvar_initializer(Token **rest, Token *tok, Type *ty) {
+  // A char array initialized with a string literal doesn't need
+  // an Initializer object for each byte.
+  if (ty->kind == TY_ARRAY && ty->base->kind == TY_CHAR && tok->kind == TK_STR) {
+    Literal *lit = tok->lit;
+    if (ty->is_incomplete) {
+      ty->size = lit->cont_len + 1;
+      ty->array_len = lit->cont_len + 1;
+      ty->is_incomplete = 0;
+    }
+    *rest = tok->next;
+    int len = (ty->array_len < lit->cont_len) ? ty->array_len : lit->cont_len;
+    return gvar_init_string(lit->contents, len);
+  }
+
+  Initializer *init = initializer(rest, tok, ty);
+  GvarInitializer head = {};
+  create_gvar_init(&head, init, ty, 0);
+  return head.next;
+}
+
+// Construct a GvarInitializer object for a given string literal.
+// The terminating '\0' is left to zero padding.
+static GvarInitializer *gvar_init_string(char *p, int len) {
+  GvarInitializer *init = alloc_obj(AK_GVAR_INIT, sizeof(GvarInitializer));
+  init->sz = len;
+  init->bytes = p;
+  return init;
+}
+
+static _Bool is_typename(Token *tok) {
+  switch (tok->id) {
+  case KW_VOID: case KW_BOOL: case KW_CHAR: case KW_SHORT: case KW_INT:
+  case KW_LONG: case KW_STRUCT: case KW_UNION: case KW_TYPEDEF:
+  case KW_ENUM: case KW_STATIC: case KW_EXTERN: case KW_ALIGNAS:
+  case KW_SIGNED: case KW_UNSIGNED: case KW_CONST: case KW_VOLATILE:
+    return 1;
+  }
+  return find_typedef(tok);
+}
+
+// stmt = "return" expr? ";"
+//      | "if" "(" expr ")" stmt ("else" stmt)?
+//      | "switch" "(" expr ")" stmt
+//      | "case" const-expr ":" stmt
+//      | "default" ":" stmt
+//      | "for" "(" (expr? ";" | declaration) expr? ";" expr? ")" stmt
+//      | "while" "(" expr ")" stmt
+//      | "do" stmt "while" "(" expr ")" ";"
+//      | "break" ";"
+//      | "continue" ";"
+//      | "goto" ident ";"
+//      | ";"
+//      | ident ":" stmt
+//      | "{" compund-stmt
+//      | expr ";"
+static Node *stmt(Token **rest, Token *tok) {
+  switch (tok->id) {
+  case KW_RETURN: {
+    Node *node = new_node(ND_RETURN, tok);
+    if (consume(rest, tok->next, P_SEMICOLON))
+      return node;
+
+    Node *exp = expr(&tok, tok->next);
+    *rest = skip(tok, P_SEMICOLON);
+
+    add_type(exp);
+    node->lhs = new_cast(exp, current_fn->ty->return_ty);
+    return node;
+  }
+
+  case KW_IF: {
+    Node *node = new_node(ND_IF, tok);
+    tok = skip(tok->next, P_LPAREN);
+    node->cond = expr(&tok, tok);
+    tok = skip(tok, P_RPAREN);
+    node->then = stmt(&tok, tok);
+    if (tok->id == KW_ELSE)
+      node->els = stmt(&tok, tok->next);
+    *rest = tok;
+    return node;
+  }
+
+  case KW_SWITCH: {
+    Node *node = new_node(ND_SWITCH, tok);
+    tok = skip(tok->next, P_LPAREN);
+    node->cond = expr(&tok, tok);
+    tok = skip(tok, P_RPAREN);
+
+    Node *sw = current_switch;
+    current_switch = node;
+    node->then = stmt(rest, tok);
+    current_switch = sw;
+    return node;
+  }
+
+  case KW_CASE: {
+    if (!current_switch)
+      error_tok(tok, "stray case");
+
+    Node *node = new_node(ND_CASE, tok);
+    int val = const_expr(&tok, tok->next);
+    tok = skip(tok, P_COLON);
+    node->lhs = stmt(rest, tok);
+    node->val = val;
+    node->case_next = current_switch->case_next;
+    current_switch->case_next = node;
+    return node;
+  }
+
+  case KW_DEFAULT: {
+    if (!current_switch)
+      error_tok(tok, "stray default");
+
+    Node *node = new_node(ND_CASE, tok);
+    tok = skip(tok->next, P_COLON);
+    node->lhs = stmt(rest, tok);
+    current_switch->default_case = node;
+    return node;
+  }
+
+  case KW_FOR: {
+    Node *node = new_node(ND_FOR, tok);
+    tok = skip(tok->next, P_LPAREN);
+
+    enter_scope();
+
+    if (is_typename(tok)) {
+      node->init = declaration(&tok, tok);
+    } else {
+      if(tok->id != P_SEMICOLON)
+        node->init = expr_stmt(&tok, tok);
+      tok = skip(tok, P_SEMICOLON);
+    }
+
+    if(tok->id != P_SEMICOLON)
+      node->cond = expr(&tok, tok);
+    tok = skip(tok, P_SEMICOLON);
+
+    if(tok->id != P_RPAREN)
+      node->inc = expr_stmt(&tok, tok);
+    tok = skip(tok, P_RPAREN);
+
+    node->then = stmt(rest, tok);
+    leave_scope();
+    return node;
+  }
+
+  case KW_WHILE: {
+    Node *node = new_node(ND_FOR, tok);
+    tok = skip(tok->next, P_LPAREN);
+    node->cond = expr(&tok, tok);
+    tok = skip(tok, P_RPAREN);
+    node->then = stmt(rest, tok);
+    return node;
+  }
+
+  case KW_DO: {
+    Node *node = new_node(ND_DO, tok);
+    node->then = stmt(&tok, tok->next);
+    tok = skip(tok, KW_WHILE);
+    tok = skip(tok, P_LPAREN);
+    node->cond = expr(&tok, tok);
+    tok = skip(tok, P_RPAREN);
+    *rest = skip(tok, P_SEMICOLON);
+    return node;
+  }
+
+  case KW_BREAK: {
+    *rest = skip(tok->next, P_SEMICOLON);
+    return new_node(ND_BREAK, tok);
+  }
+
+  case KW_CONTINUE: {
+    *rest = skip(tok->next, P_SEMICOLON);
+    return new_node(ND_CONTINUE, tok);
+  }
+
+  case KW_GOTO: {
+    Node *node = new_node(ND_GOTO, tok);
+    node->label_name = get_ident(tok->next);
+    *rest = skip(tok->next->next, P_SEMICOLON);
+    return node;
+  }
+
+  case P_SEMICOLON: {
+    Node *node = new_node(ND_BLOCK, tok);
+    *rest = tok->next;
+    return node;
+  }
+
+  case P_LBRACE:
+    return compound_stmt(rest, tok->next);
+  }
+
+  if (tok->kind == TK_IDENT && tok->next->id == P_COLON) {
+    Node *node = new_node(ND_LABEL, tok);
+    node->label_name = tok->name;
+    node->lhs = stmt(rest, tok->next->next);
+    return node;
+  }
+
+  Node *node = expr_stmt(&tok, tok);
+  *rest = skip(tok, P_SEMICOLON);
+  return node;
+}
+
+// compund-stmt = (declaration | stmt)* "}"
+static Node *compound_stmt(Token **rest, Token *tok) {
+  Node *node = new_node(ND_BLOCK, tok);
+  Node head = {};
+  Node *cur = &head;
+
+  enter_scope();
+
+  while (tok->id != P_RBRACE) {
+    if (is_typename(tok))
+      cur = cur->next = declaration(&tok, tok);
+    else
+      cur = cur->next = stmt(&tok, tok);
+    add_type(cur);
+  }
+
+  leave_scope();
+
+  node->body = head.next;
+  *rest = tok->next;
+  return node;
+}
+
+// expr-stmt = expr
+static Node *expr_stmt(Token **rest, Token *tok) {
+  Node *node = new_node(ND_EXPR_STMT, tok);
+  node->lhs = expr(rest, tok);
+  return node;
+}
+
+// expr = assign ("," expr)?
+static Node *expr(Token **rest, Token *tok) {
+  Node *node = assign(&tok, tok);
+
+  if(tok->id == P_COMMA)
+    return new_binary(ND_COMMA, node, expr(rest, tok->next), tok);
+
+  *rest = tok;
+  return node;
+}
+
+static long eval(Node *node) {
+  return eval2(node, 0);
+}
+
+// Evaluate a given node as a constant expression.
+//
+// A constant expression is either just a number of ptr+n where ptr
+// is a pointer to a global variable and n is a positive/negative
+// number. The latter form is accepted only as an initialization
+// expression for a global variable.
+static long eval2(Node *node, Var **var) {
+  add_type(node);
+
+  switch (node->kind) {
+    case ND_ADD:
+      return eval2(node->lhs, var) + eval(node->rhs);
+    case ND_SUB:
+      return eval2(node->lhs, var) - eval(node->rhs);
+    case ND_MUL:
+      return eval(node->lhs) * eval(node->rhs);
+    case ND_DIV:
+      if (node->ty->is_unsigned)
+        return (unsigned long)eval(node->lhs) / eval(node->rhs);
+      return eval(node->lhs) / eval(node->rhs);
+    case ND_BITAND:
+      return eval(node->lhs) & eval(node->rhs);
+    case ND_BITOR:
+      return eval(node->lhs) | eval(node->rhs);
+    case ND_BITXOR:
+      return eval(node->lhs) ^ eval(node->rhs);
+    case ND_SHL:
+      return eval(node->lhs) << eval(node->rhs);
+    case ND_SHR:
+      if (node->ty->is_unsigned)
+        return (unsigned long)eval(node->lhs) >> eval(node->rhs);
+      return eval(node->lhs) >> eval(node->rhs);
+    case ND_EQ:
+      return eval(node->lhs) == eval(node->rhs);
+    case ND_NE:
+      return eval(node->lhs) != eval(node->rhs);
+    case ND_LT:
+      if (node->ty->is_unsigned)
+        return (unsigned long)eval(node->lhs) < eval(node->rhs);
+      return eval(node->lhs) < eval(node->rhs);
+    case ND_LE:
+      if (node->ty->is_unsigned)
+        return (unsigned long)eval(node->lhs) <= eval(node->rhs);
+      return eval(node->lhs) <= eval(node->rhs);
+    case ND_COND:
+      return eval(node->cond) ? eval(node->then) : eval(node->els);
+    case ND_COMMA:
+      return eval(node->rhs);
+    case ND_NOT:
+      return !eval(node->lhs);
+    case ND_BITNOT:
+      return ~eval(node->lhs);
+    case ND_LOGOR:
+      return eval(node->lhs) || eval(node->rhs);
+    case ND_LOGAND:
+      return eval(node->lhs) && eval(node->rhs);
+    case ND_CAST: {
+      long val = eval2(node->lhs, var);
+      if (!is_integer(node->ty) || size_of(node->ty) == 8)
+        return val;
+
+      switch (size_of(node->ty)) {
+      case 1:
+        if (node->ty->is_unsigned)
+          return (unsigned char) val;
+        return (char) val;
+      case 2:
+        if (node->ty->is_unsigned)
+          return (unsigned short) val;
+        return (short) val;
+      case 4:
+        if (node->ty->is_unsigned)
+          return (unsigned int) val;
+        return (int) val;
+        }
+      }
+    case ND_NUM:
+      return node->val;
+    case ND_ADDR:
+      if (!var || *var || node->lhs->kind != ND_VAR || node->lhs->var->is_local)
+        error_tok(node->tok, "invalid initializer");
+      *var = node->lhs->var;
+      return 0;
+    case ND_VAR:
+      if (!var || *var || node->var->ty->kind != TY_ARRAY)
+        error_tok(node->tok, "invalid initializer");
+      *var = node->var;
+      return 0;
+  }
+
+  error_tok(node->tok, "not a constant expression");
+}
+
+long const_expr(Token **rest, Token *tok) {
+  Node *node = conditional(rest, tok);
+  return eval(node);
+}
+
+// Convert `A op= B` to `tmp = &A, *tmp = *tmp op B`
+// where tmp is a fresh pointer variable.
+static Node *to_assign(Node *binary) {
+  add_type(binary->lhs);
+  add_type(binary->rhs);
+
+  Var *var = new_lvar("", pointer_to(binary->lhs->ty));
+  Token *tok = binary->tok;
+
+  Node *expr1 = new_binary(ND_ASSIGN, new_var_node(var, tok),
+                           new_unary(ND_ADDR, binary->lhs, tok), tok);
+
+  Node *expr2 =
+    new_binary(ND_ASSIGN,
+               new_unary(ND_DEREF, new_var_node(var, tok), tok),
+               new_binary(binary->kind,
+                          new_unary(ND_DEREF, new_var_node(var, tok), tok),
+                          binary->rhs,
+                          tok),
+               tok);
+
+  return new_binary(ND_COMMA, expr1, expr2, tok);
+}
+
+// assign    = conditional (assign-op assign)?
+// assign-op = "=" | "+=" | "-=" | "*=" | "/=" | "%=" | "&=" | "|=" | "^="
+//           | "<<=" | ">>="
+static Node *assign(Token **rest, Token *tok) {
+  Node *node = conditional(&tok, tok);
+
+  if (tok->id == P_ASSIGN)
+    return new_binary(ND_ASSIGN, node, assign(rest, tok->next), tok);
+
+  if (tok->id == P_ADD_ASSIGN)
+    return to_assign(new_add(node, assign(rest, tok->next), tok));
+
+  if (tok->id == P_SUB_ASSIGN)
+    return to_assign(new_sub(node, assign(rest, tok->next), tok));
+
+  if (tok->id == P_MUL_ASSIGN)
+    return to_assign(new_binary(ND_MUL, node, assign(rest, tok->next), tok));
+
+  if (tok->id == P_DIV_ASSIGN)
+    return to_assign(new_binary(ND_DIV, node, assign(rest, tok->next), tok));
+
+  if (tok->id == P_MOD_ASSIGN)
+    return to_assign(new_binary(ND_MOD, node, assign(rest, tok->next), tok));
+
+  if (tok->id == P_AND_ASSIGN)
+    return to_assign(new_binary(ND_BITAND, node, assign(rest, tok->next), tok));
+
+  if (tok->id == P_OR_ASSIGN)
+    return to_assign(new_binary(ND_BITOR, node, assign(rest, tok->next), tok));
+
+  if (tok->id == P_XOR_ASSIGN)
+    return to_assign(new_binary(ND_BITXOR, node, assign(rest, tok->next), tok));
+
+  if (tok->id == P_SHL_ASSIGN)
+    return to_assign(new_binary(ND_SHL, node, assign(rest, tok->next), tok));
+
+  if (tok->id == P_SHR_ASSIGN)
+    return to_assign(new_binary(ND_SHR, node, assign(rest, tok->next), tok));
+
+  *rest = tok;
+  return node;
+}
+
+// conditional = logor ("?" expr ":" conditional)?
+static Node *conditional(Token **rest, Token *tok) {
+  Node *node = logor(&tok, tok);
+
+  if (tok->id != P_QUESTION) {
+    *rest = tok;
+    return node;
+  }
+
+  Node *cond = new_node(ND_COND, tok);
+  cond->cond = node;
+  cond->then = expr(&tok, tok->next);
+  tok = skip(tok, P_COLON);
+  cond->els = conditional(rest, tok);
+  return cond;
+}
+
+// logor = logand ("||" logand)*
+static Node *logor(Token **rest, Token *tok) {
+  Node *node = logand(&tok, tok);
+  while (tok->id == P_LOGOR) {
+    node = new_binary(ND_LOGOR, node, 0, tok);
+    node->rhs = logand(&tok, tok->next);
+  }
+  *rest = tok;
+  return node;
+}
+
+// logand = bitor ("&&" bitor)*
+static Node *logand(Token **rest, Token *tok) {
+  Node *node = bitor(&tok, tok);
+  while (tok->id == P_LOGAND) {
+    node = new_binary(ND_LOGAND, node, 0, tok);
+    node->rhs = bitor(&tok, tok->next);
+  }
+  *rest = tok;
+  return node;
+}
+
+// bitor = bitxor ("|" bitxor)*
+static Node *bitor(Token **rest, Token *tok) {
+  Node *node = bitxor(&tok, tok);
+  while (tok->id == P_PIPE) {
+    node = new_binary(ND_BITOR, node, 0, tok);
+    node->rhs = bitxor(&tok, tok->next);
+  }
+  *rest = tok;
+  return node;
+}
+
+// bitxor = bitand ("^" bitand)*
+static Node *bitxor(Token **rest, Token *tok) {
+  Node *node = bitand(&tok, tok);
+  while (tok->id == P_CARET) {
+    node = new_binary(ND_BITXOR, node, 0, tok);
+    node->rhs = bitand(&tok, tok->next);
+  }
+  *rest = tok;
+  return node;
+}
+
+// bitand = equality ("&" equality)*
+static Node *bitand(Token **rest, Token *tok) {
+  Node *node = equality(&tok, tok);
+  while (tok->id == P_AMP) {
+    node = new_binary(ND_BITAND, node, 0, tok);
+    node->rhs = equality(&tok, tok->next);
+  }
+  *rest = tok;
+  return node;
+}
+
+// equality = relational ("==" relational | "!=" relational)*
+static Node *equality(Token **rest, Token *tok) {
+  Node *node = relational(&tok, tok);
+
+  for (;;) {
+    if (tok->id == P_EQ) {
+      node = new_binary(ND_EQ, node, 0, tok);
+      node->rhs = relational(&tok, tok->next);
+      continue;
+    }
+
+    if (tok->id == P_NE) {
+      node = new_binary(ND_NE, node, 0, tok);
+      node->rhs = relational(&tok, tok->next);
+      continue;
+    }
+
+    *rest = tok;
+    return node;
+  }
+}
+
+// relational = shift ("<" shift | "<=" shift | ">" shift | ">=" shift)*
+static Node *relational(Token **rest, Token *tok) {
+  Node *node = shift(&tok, tok);
+
+  for (;;) {
+    if (tok->id == P_LT) {
+      node = new_binary(ND_LT, node, 0, tok);
+      node->rhs = shift(&tok, tok->next);
+      continue;
+    }
+
+    if (tok->id == P_LE) {
+      node = new_binary(ND_LE, node, 0, tok);
+      node->rhs = shift(&tok, tok->next);
+      continue;
+    }
+
+    if (tok->id == P_GT) {
+      node = new_binary(ND_LT, 0, node, tok);
+      node->lhs = shift(&tok, tok->next);
+      continue;
+    }
+
+    if (tok->id == P_GE) {
+      node = new_binary(ND_LE, 0, node, tok);
+      node->lhs = shift(&tok, tok->next);
+      continue;
+    }
+
+    *rest = tok;
+    return node;
+  }
+}
+
+// shift = add ("<<" add | ">>" add)*
+static Node *shift(Token **rest, Token *tok) {
+  Node *node = add(&tok, tok);
+
+  for (;;) {
+    if (tok->id == P_SHL) {
+      node = new_binary(ND_SHL, node, 0, tok);
+      node->rhs = add(&tok, tok->next);
+      continue;
+    }
+
+    if (tok->id == P_SHR) {
+      node = new_binary(ND_SHR, node, 0, tok);
+      node->rhs = add(&tok, tok->next);
+      continue;
+    }
+
+  *rest = tok;
+  return node;
+  }
+}
+
+// In C, `+` operator is overloaded to perform the pointer arithmetic.
+// If p is a point, p+n adds not n but sizeof(*p)*n to the value of p,
+// so that p+n points to the location n elements (not bytes) ahead of p.
+// In other words, we need to scale an integer value before adding to a
+// pointer value. This fucntion takes care of the scaling.
+static Node *new_add(Node *lhs, Node *rhs, Token *tok) {
+  add_type(lhs);
+  add_type(rhs);
+
+  // num + num
+  if (is_integer(lhs->ty) && is_integer(rhs->ty))
+    return new_binary(ND_ADD, lhs, rhs, tok);
+
+  if (lhs->ty->base && rhs->ty->base)
+    error_tok(tok, "invalid operands");
+
+  // Canonicalize `num + ptr` to `ptr + num`.
+  if (!lhs->ty->base && rhs->ty->base){
+    Node *tmp = lhs;
+    lhs = rhs;
+    rhs =tmp;
+  }
+
+  // ptr + num
+  rhs = new_binary(ND_MUL, rhs, new_num(size_of(lhs->ty->base), tok), tok);
+  return new_binary(ND_ADD, lhs, rhs, tok);
+}
+
+// Like `+`, `-` is overloaded for the pointer type.
+static Node *new_sub(Node *lhs, Node *rhs, Token *tok) {
+  add_type(lhs);
+  add_type(rhs);
+
+  // num - num
+  if (is_integer(lhs->ty) && is_integer(rhs->ty))
+    return new_binary(ND_SUB, lhs, rhs, tok);
+
+  // ptr - num
+  if (lhs->ty->base && is_integer(rhs->ty)) {
+    rhs = new_binary(ND_MUL, rhs, new_num(size_of(lhs->ty->base), tok), tok);
+    return new_binary(ND_SUB, lhs, rhs, tok);
+  }
+
+  // ptr - ptr, which returns how many elements are between the two.
+  if (lhs->ty->base && rhs->ty->base) {
+    Node *node = new_binary(ND_SUB, lhs, rhs, tok);
+    return new_binary(ND_DIV, node, new_num(size_of(lhs->ty->base), tok), tok);
+  }
+
+  error_tok(tok, "invalid operands");
+}
+
+// add = mul ("+" mul | "-" mul)*
+static Node *add(Token **rest, Token *tok) {
+  Node *node = mul(&tok, tok);
+
+  for (;;) {
+    Token *start = tok;
+
+    if (tok->id == P_PLUS) {
+      node = new_add(node, mul(&tok, tok->next), start);
+      continue;
+    }
+
+    if (tok->id == P_MINUS) {
+      node = new_sub(node, mul(&tok, tok->next), start);
+      continue;
+    }
+
+    *rest = tok;
+    return node;
+  }
+}
+
+// mul = cast ("*" cast | "/" cast | "%" cast)*
+static Node *mul(Token **rest, Token *tok) {
+  Node *node = cast(&tok, tok);
+
+  for (;;) {
+    if (tok->id == P_STAR) {
+      node = new_binary(ND_MUL, node, 0, tok);
+      node->rhs = cast(&tok, tok->next);
+      continue;
+    }
+
+    if (tok->id == P_SLASH) {
+      node = new_binary(ND_DIV, node, 0, tok);
+      node->rhs = cast(&tok, tok->next);
+      continue;
+    }
+
+    if (tok->id == P_PERCENT) {
+      node = new_binary(ND_MOD, node, 0, tok);
+      node->rhs = cast(&tok, tok->next);
+      continue;
+    }
+
+    *rest = tok;
+    return node;
+  }
+}
+
+// compound-literal = initializer "}"
+static Node *compound_literal(Token **rest, Token *tok, Type *ty, Token *start) {
+  if (scope_depth == 0) {
+    Var *var = new_gvar(new_label(), ty, 1, 1);
+    var->initializer = gvar_initializer(rest, tok, ty);
+    return new_var_node(var, start);
+  }
+
+  Var *var = new_lvar(new_label(), ty);
+  Node *lhs = new_node(ND_STMT_EXPR, tok);
+  lhs->body = lvar_initializer(rest, tok, var)->body;
+  Node *rhs = new_var_node(var, tok);
+  return new_binary(ND_COMMA, lhs, rhs, tok);
+}
+
+// cast = "(" type-name ")" "{" compound-literal
+//      | "(" type-name ")" cast
+//      | unary
+static Node *cast(Token **rest, Token *tok) {
+  if (tok->id == P_LPAREN && is_typename(tok->next)) {
+    Token *start = tok;
+    Type *ty = typename(&tok, tok->next);
+    tok = skip(tok, P_RPAREN);
+
+    if (tok->id == P_LBRACE)
+      return compound_literal(rest, tok, ty, start);
+
+    Node *node = new_unary(ND_CAST, 0, start);
+    node->lhs = cast(rest, tok);
+    add_type(node->lhs);
+    node->ty = ty;
+    return node;
+  }
+
+  return unary(rest, tok);
+}
+
+// unary = ("+" | "-" | "*" | "&" | "!") cast
+//       | ("++" | "--") unary
+//       | postfix
+static Node *unary(Token **rest, Token *tok) {
+  if (tok->id == P_PLUS)
+    return cast(rest, tok->next);
+
+  if (tok->id == P_MINUS)
+    return new_binary(ND_SUB, new_num(0, tok), cast(rest, tok->next), tok);
+
+  if (tok->id == P_AMP)
+    return new_unary(ND_ADDR, cast(rest, tok->next), tok);
+
+  if (tok->id == P_STAR)
+    return new_unary(ND_DEREF, cast(rest, tok->next), tok);
+
+  if (tok->id == P_NOT)
+    return new_unary(ND_NOT, cast(rest, tok->next), tok);
+
+  if (tok->id == P_TILDE)
+    return new_unary(ND_BITNOT, cast(rest, tok->next), tok);
+
+  // Read ++i as i+=1
+  if (tok->id == P_INC)
+    return to_assign(new_add(unary(rest, tok->next), new_num(1, tok), tok));
+
+  // Read --i as i-=1
+  if (tok->id == P_DEC)
+    return to_assign(new_sub(unary(rest, tok->next), new_num(1, tok), tok));
+
+  return postfix(rest, tok);
+}
+
+// struct-members = (typespec declarator ("," declarator)* ";")*
+static Member *struct_members(Token **rest, Token *tok) {
+  Member head = {};
+  Member *cur = &head;
+
+  while (tok->id != P_RBRACE) {
+    VarAttr attr = {};
+    Type *basety = typespec(&tok, tok, &attr);
+    int cnt = 0;
+
+    while (!consume(&tok, tok, P_SEMICOLON)) {
+      if (cnt++)
+        tok = skip(tok, P_COMMA);
+
+      Member *mem = alloc_obj(AK_MEMBER, sizeof(Member));
+      mem->ty = declarator(&tok, tok, basety);
+      mem->name = mem->ty->name;
+      mem->align = attr.align ? attr.align : mem->ty->align;
+      cur = cur->next = mem;
+    }
+  }
+
+  *rest = tok->next;
+  return head.next;
+}
+
+// struct-union-decl = ident?  ("{" struct-members)?
+static Type *struct_union_decl(Token **rest, Token *tok) {
+  // Read a tag.
+  Token *tag = 0;
+  if (tok->kind == TK_IDENT) {
+    tag = tok;
+    tok = tok->next;
+  }
+
+  if (tag && tok->id != P_LBRACE) {
+    *rest = tok;
+
+    TagScope *sc = find_tag(tag);
+    if (sc)
+      return sc->ty;
+
+    Type *ty = struct_type();
+    ty->is_incomplete = 1;
+    push_tag_scope(tag, ty);
+    return ty;
+  }
+
+  tok = skip(tok, P_LBRACE);
+
+  // Construct a struct object.
+  Type *ty = struct_type();
+  ty->members = struct_members(rest, tok);
+
+  if (tag) {
+    // If this is a redefinition, overwrite a previous type.
+    // Otherwise, register the struct type.
+    TagScope *sc = find_tag(tag);
+    if(sc && sc->depth == scope_depth) {
+      *sc->ty = *ty;
+      return sc->ty;
+    }
+
+    push_tag_scope(tag, ty);
+  }
+
+  return ty;
+}
+
+// struct-decl = struct-union-decl
+static Type *struct_decl(Token **rest, Token *tok) {
+  Type *ty = struct_union_decl(rest, tok);
+
+  //Assign offsets within the struct to members.
+  int offset = 0;
+  for (Member *mem = ty->members; mem; mem = mem->next) {
+    offset = align_to(offset, mem->align);
+    mem->offset = offset;
+    offset += size_of(mem->ty);
+
+    if (ty->align < mem->align)
+      ty->align = mem->align;
+  }
+  ty->size = align_to(offset, ty->align);
+  return ty;
+}
+
+// union-decl = struct-union-decl
+static Type *union_decl(Token **rest, Token *tok) {
+  Type *ty = struct_union_decl(rest, tok);
+
+  // If union, we don't have to assign offsets because they
+  // are already initialized to zero. We need to compute the
+  // alignment and the size though.
+  for (Member *mem = ty->members; mem; mem = mem->next) {
+    if (ty->align < mem->ty->align)
+      ty->align = mem->ty->align;
+    if (ty->size < size_of(mem->ty))
+      ty->size = size_of(mem->ty);
+  }
+  ty->size = align_to(ty->size, ty->align);
+  return ty;
+}
+
+static Member *get_struct_member(Type *ty, Token *tok) {
+  for (Member *mem = ty->members; mem; mem = mem->next)
+    if (mem->name->name == tok->name)
+      return mem;
+  error_tok(tok, "no such member");
+}
+
+static Node *struct_ref(Node *lhs, Token *tok) {
+  add_type(lhs);
+  if (lhs->ty->kind != TY_STRUCT)
+    error_tok(lhs->tok, "not a struct");
+
+  Node *node = new_unary(ND_MEMBER, lhs, tok);
+  node->member = get_struct_member(lhs->ty, tok);
+  return node;
+}
+
+// Convert A++ to `tmp = &A, *tmp = *tmp + 1, *tmp - 1`
+// where tmp is a fresh pointer varibale.
+static Node *new_inc_dec(Node *lhs, Token *tok, _Bool is_inc) {
+  add_type(lhs);
+  Var *var = new_lvar("", pointer_to(lhs->ty));
+  int addend = is_inc ? 1 : -1;
+
+  Node *expr1 = new_binary(ND_ASSIGN, new_var_node(var, tok),
+                           new_unary(ND_ADDR, lhs, tok), tok);
+
+  Node *expr2 =
+    new_binary(ND_ASSIGN,
+               new_unary(ND_DEREF, new_var_node(var, tok), tok),
+               new_add(new_unary(ND_DEREF, new_var_node(var, tok), tok),
+                       new_num(addend, tok), tok),
+               tok);
+
+  Node *expr3 = new_add(new_unary(ND_DEREF, new_var_node(var, tok), tok),
+                        new_num(-addend, tok), tok);
+
+  return new_binary(ND_COMMA, expr1, new_binary(ND_COMMA, expr2, expr3, tok), tok);
+}
+
+// postfix = ident "(" func-args ")" postfix-tail*
+//         | primary postfix-tail*
+//
+// postfix-tail = primary ("[" expr "]" | "(" func-args ")"
+//              | "." ident | "->" ident | "++" | "--")*
+static Node *postfix(Token **rest, Token *tok) {
+  Token *start = tok;
+  Node *node = primary(&tok, tok);
+
+  for(;;) {
+    if (tok->id == P_LPAREN) {
+      add_type(node);
+
+      Type *ty = node->ty;
+      if (ty->kind != TY_FUNC &&
+          (ty->kind != TY_PTR || ty->base->kind != TY_FUNC))
+        error_tok(tok, "not a function");
+
+      node = new_unary(ND_FUNCALL, node, tok);
+      node->args = func_args(&tok, tok->next);
+      node->func_ty = (ty->kind == TY_FUNC) ? ty : ty->base;
+      continue;
+    }
+
+    if (tok->id == P_LBRACKET) {
+      // x[y] is shoert for *(x+y)
+      Token *start = tok;
+      Node *idx = expr(&tok, tok->next);
+      tok = skip(tok, P_RBRACKET);
+      node = new_unary(ND_DEREF, new_add(node, idx, start), start);
+      continue;
+    }
+
+    if (tok->id == P_DOT) {
+      node = struct_ref(node, tok->next);
+      tok = tok->next->next;
+      continue;
+    }
+
+    if (tok->id == P_ARROW) {
+      // x->y is short for (*x).y
+      node = new_unary(ND_DEREF, node, tok);
+      node = struct_ref(node, tok->next);
+      tok = tok->next->next;
+      continue;
+    }
+
+    if (tok->id == P_INC) {
+      node = new_inc_dec(node, tok, 1);
+      tok = tok->next;
+      continue;
+    }
+
+    if (tok->id == P_DEC) {
+      node = new_inc_dec(node, tok, 0);
+      tok = tok->next;
+      continue;
+    }
+
+    *rest = tok;
+    return node;
+  }
+}
+
+// func-args = "(" (assing ("," assing)*?) ")"
+static Node *func_args(Token **rest, Token *tok) {
+  Node head = {};
+  Node *cur = &head;
+
+  while (tok->id != P_RPAREN) {
+    if (cur != &head)
+      tok = skip(tok, P_COMMA);
+    cur = cur->next = assign(&tok, tok);
+  }
+
+  *rest = skip(tok, P_RPAREN);
+  return head.next;
+}
+
+// primary = "(" "{" stmt stmt* "}" ")"
+//         | "(" expr ")"
+//         | "sizeof" "(" type-name ")"
+//         | "sizeof" unary
+//         | "alignof" "(" type-name ")"
+//         | ident
+//         | str
+//         | num
+static Node *primary(Token **rest, Token *tok) {
+  if (tok->id == P_LPAREN && tok->next->id == P_LBRACE) {
+    // This is a GNU statment expression.
+    Node *node = new_node(ND_STMT_EXPR, tok);
+    node->body = compound_stmt(&tok, tok->next->next)->body;
+    *rest = skip(tok, P_RPAREN);
+
+    Node *cur = node->body;
+    while (cur->next)
+      cur = cur->next;
+
+    if (cur->kind != ND_EXPR_STMT)
+      error_tok(cur->tok, "statement expression returning void is not supported");
+    return node;
+  }
+
+  if (tok->id == P_LPAREN) {
+    Node *node = expr(&tok, tok->next);
+    *rest = skip(tok, P_RPAREN);
+    return node;
+  }
+
+  if (tok->id == KW_SIZEOF && tok->next->id == P_LPAREN &&
+      is_typename(tok->next->next)) {
+    Type *ty = typename(&tok, tok->next->next);
+    *rest = skip(tok, P_RPAREN);
+    return new_ulong(size_of(ty), tok);
+  }
+
+  if (tok->id == KW_SIZEOF) {
+    Node *node = unary(rest, tok->next);
+    add_type(node);
+    return new_ulong(size_of(node->ty), tok);
+  }
+
+  if (tok->id == KW_ALIGNOF) {
+    tok = skip(tok->next, P_LPAREN);
+    Type *ty = typename(&tok, tok);
+    *rest = skip(tok, P_RPAREN);
+    return new_ulong(ty->align, tok);
+  }
+
+  if (tok->kind == TK_IDENT) {
+
+    // Variable or enum constant
+    VarScope *sc = find_var(tok);
+    *rest = tok->next;
+    if (sc) {
+      if (sc->var)
+        return new_var_node(sc->var, tok);
+      if (sc->enum_ty)
+        return new_num(sc->enum_val, tok);
+    }
+
+    if (tok->next->id == P_LPAREN) {
+      warn_tok(tok, "implicit declaration of a function");
+      Var *var = new_gvar(tok->name, func_type(ty_int), 0, 0);
+      return new_var_node(var, tok);
+    }
+
+    error_tok(tok, "undefined variable");
+  }
+
+  if (tok->kind == TK_STR) {
+    Var *var = new_string_literal(tok->lit->contents, tok->lit->cont_len);
+    *rest = tok->next;
+    return new_var_node(var, tok);
+  }
+
+  if (tok->kind != TK_NUM)
+    error_tok(tok, "expected expression");
+
+  Node *node = new_num(tok->lit->val, tok);
+  node->ty = tok->lit->ty;
+  *rest = tok->next;
+  return node;
+}
+
+// Saves file-scope declarations to a precompiled header.
+void save_scopes(void) {
+  long n = 0;
+  for (VarScope *sc = var_scope; sc; sc = sc->next)
+    n++;
+  pch_put_long(n);
+
+  for (VarScope *sc = var_scope; sc; sc = sc->next) {
+    pch_put_str(sc->name);
+    pch_put_var(sc->var);
+    pch_put_type(sc->type_def);
+    pch_put_type(sc->enum_ty);
+    pch_put_long(sc->enum_val);
+  }
+
+  n = 0;
+  for (TagScope *sc = tag_scope; sc; sc = sc->next)
+    n++;
+  pch_put_long(n);
+
+  for (TagScope *sc = tag_scope; sc; sc = sc->next) {
+    pch_put_str(sc->name);
+    pch_put_type(sc->ty);
+  }
+}
+
+// Restores file-scope declarations from a precompiled header.
+void load_scopes(void) {
+  VarScope head = {};
+  VarScope *cur = &head;
+
+  for (long n = pch_get_long(); n > 0; n--) {
+    cur = cur->next = alloc_obj(AK_VAR_SCOPE, sizeof(VarScope));
+    cur->name = pch_get_name();
+    cur->var = pch_get_var();
+    cur->type_def = pch_get_type();
+    cur->enum_ty = pch_get_type();
+    cur->enum_val = pch_get_long();
+  }
+  cur->next = var_scope;
+  var_scope = head.next;
+
+  TagScope head2 = {};
+  TagScope *cur2 = &head2;
+
+  for (long n = pch_get_long(); n > 0; n--) {
+    cur2 = cur2->next = alloc_obj(AK_TAG_SCOPE, sizeof(TagScope));
+    cur2->name = pch_get_name();
+    cur2->ty = pch_get_type();
+  }
+  cur2->next = tag_scope;
+  tag_scope = head2.next;
+}
+
+// program = (funcdef | global-var)*
+Program *parse(Token *tok) {
+  // Add built-in function types.
+  new_gvar("__builtin_va_start", func_type(ty_void), 0, 0);
+
+  // Read source coude until EOF.
+  Function head = {};
+  Function *cur = &head;
+  globals = 0;
+
+  while (tok->kind != TK_EOF) {
+    Token *start = tok;
+    VarAttr attr = {};
+    Type *basety = typespec(&tok, tok, &attr);
+    if (consume (&tok, tok, P_SEMICOLON))
+      continue;
+    Type *ty = declarator(&tok, tok, basety);
+
+    // Typedef
+    if (attr.is_typedef) {
+      for (;;) {
+        if (!ty->name)
+          error_tok(ty->name_pos, "typedef name omitted");
+        push_scope(get_ident(ty->name))->type_def = ty;
+
+        if (consume(&tok, tok, P_SEMICOLON))
+          break;
+        tok = skip(tok, P_COMMA);
+        ty = declarator(&tok, tok, basety);
+      }
+      continue;
+    }
+
+    // Function
+    if (ty->kind == TY_FUNC) {
+      current_fn = new_gvar(get_ident(ty->name), ty, 1, 0);
+      if (!consume(&tok, tok, P_SEMICOLON))
+        cur = cur->next = funcdef(&tok, start);
+      continue;
+    }
+
+    // Global variable
+    for (;;) {
+        if (!ty->name)
+          error_tok(ty->name_pos, "typedef name omitted");
+
+      Var *var = new_gvar(get_ident(ty->name), ty, attr.is_static, !attr.is_extern);
+      if (attr.align)
+        var->align = attr.align;
+
+      if (tok->id == P_ASSIGN)
+        var->initializer = gvar_initializer(&tok, tok->next, ty);
+
+      if (consume(&tok, tok, P_SEMICOLON))
+        break;
+      tok = skip(tok, P_COMMA);
+      ty = declarator(&tok, tok, basety);
+    }
+  }
+
+  Program *prog = alloc_obj(AK_FUNCTION, sizeof(Program));
+  prog->globals = globals;
+  prog->fns = head.next;
+  return prog;
+}
@@ -0,0 +1,1222 @@
+typedef struct FILE FILE;
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+typedef struct {
+  int gp_offset;
+  int fp_offset;
+  void *overflow_arg_area;
+  void *reg_save_area;
+} va_list[1];
+
+struct timespec {
+  long tv_sec;
+  long tv_nsec;
+};
+
+struct rusage {
+  long ru_utime[2];
+  long ru_stime[2];
+  long ru_maxrss;
+  long ru_reserved[13];
+};
+
+struct stat {
+  unsigned long st_dev;
+  unsigned long st_ino;
+  unsigned long st_nlink;
+  unsigned int st_mode;
+  unsigned int st_uid;
+  unsigned int st_gid;
+  int __pad0;
+  unsigned long st_rdev;
+  long st_size;
+  long st_blksize;
+  long st_blocks;
+  struct timespec st_atim;
+  struct timespec st_mtim;
+  struct timespec st_ctim;
+  long __reserved[3];
+};
+
+struct sockaddr_un {
+  unsigned short sun_family;
+  char sun_path[108];
+};
+
+struct iovec {
+  void *iov_base;
+  long iov_len;
+};
+
+struct msghdr {
+  void *msg_name;
+  int msg_namelen;
+  struct iovec *msg_iov;
+  long msg_iovlen;
+  void *msg_control;
+  long msg_controllen;
+  int msg_flags;
+};
+
+struct pollfd {
+  int fd;
+  short events;
+  short revents;
+};
+
+typedef struct DIR DIR;
+
+struct dirent {
+  unsigned long d_ino;
+  long d_off;
+  unsigned short d_reclen;
+  unsigned char d_type;
+  char d_name[256];
+};
+
+enum { EINTR = 4 };
+enum { O_RDONLY = 0, O_WRONLY = 1, O_RDWR = 2, O_CREAT = 64, O_TRUNC = 512 };
+enum { LOCK_EX = 2 };
+enum { S_IFMT = 61440, S_IFREG = 32768 };
+enum { PROT_READ = 1, PROT_WRITE = 2 };
+enum { MAP_PRIVATE = 2, MAP_FIXED = 16, MAP_ANONYMOUS = 32, MAP_POPULATE = 32768 };
+enum { _SC_PAGESIZE = 30 };
+enum { AF_UNIX = 1, SOCK_STREAM = 1, SOL_SOCKET = 1, SCM_RIGHTS = 1 };
+enum { MSG_CTRUNC = 8, MSG_NOSIGNAL = 16384 };
+enum { POLLIN = 1 };
+enum { RUSAGE_SELF = 0 };
+enum { CLOCK_MONOTONIC = 1, CLOCK_PROCESS_CPUTIME_ID = 2 };
+
+void *malloc(long size);
+void *calloc(long nmemb, long size);
+void *realloc(void *buf, long size);
+int *__errno_location();
+char *strerror(int errnum);
+FILE *fopen(char *pathname, char *mode);
+long fread(void *ptr, long size, long nmemb, FILE *stream);
+int fclose(FILE *fp);
+int feof(FILE *stream);
+static void assert() {}
+int strcmp(char *s1, char *s2);
+int strncasecmp(char *s1, char *s2);
+int printf(char *fmt, ...);
+int sprintf(char *buf, char *fmt, ...);
+int fprintf(FILE *fp, char *fmt, ...);
+int vfprintf(FILE *fp, char *fmt, va_list ap);
+long strlen(char *p);
+int strncmp(char *p, char *q);
+void *memvpy(char *dst, char *src, long n);
+char *strndup(char *p, long n);
+int isspace(int c);
+int ispunct(int c);
+int isdigit(int c);
+char *strstr(char *haystack, char *needle);
+static void va_end(va_list ap) {}
+long strtoul(char *nptr, char **endptr, int base);
+char *strncpy(char *dest, char *src, long n);
+void exit(int code);
+int atoi(char *nptr);
+char *strrchr(char *s, int c);
+int fflush(FILE *stream);
+int fork(void);
+int waitpid(int pid, int *status, int options);
+int unlink(char *pathname);
+int creat(char *pathname, int mode);
+void *memset(void *s, int c, long n);
+int memcmp(void *s1, void *s2, long n);
+char *strchr(char *s, int c);
+long strtol(char *nptr, char **endptr, int base);
+long write(int fd, void *buf, long count);
+void *memcpy(void *dst, void *src, long n);
+int clock_gettime(int clockid, struct timespec *tp);
+int getrusage(int who, struct rusage *usage);
+void free(void *ptr);
+char *strcpy(char *dest, char *src);
+long read(int fd, void *buf, long count);
+int close(int fd);
+int dup2(int oldfd, int newfd);
+int pipe(int *pipefd);
+int chdir(char *path);
+char *getcwd(char *buf, long size);
+char *realpath(char *path, char *resolved_path);
+int stat(char *path, struct stat *buf);
+int socket(int domain, int type, int protocol);
+int bind(int fd, struct sockaddr *addr, int len);
+int listen(int fd, int backlog);
+int accept(int fd, struct sockaddr *addr, int *len);
+int connect(int fd, struct sockaddr *addr, int len);
+long send(int fd, void *buf, long len, int flags);
+long sendmsg(int fd, struct msghdr *msg, int flags);
+long recvmsg(int fd, struct msghdr *msg, int flags);
+int poll(struct pollfd *fds, long nfds, int timeout);
+int open(char *path, int flags, ...);
+int fstat(int fd, struct stat *buf);
+int flock(int fd, int op);
+void *mmap(void *addr, long len, int prot, int flags, int fd, long off);
+int munmap(void *addr, long len);
+long sysconf(int name);
+long pread(int fd, void *buf, long count, long offset);
+long pwrite(int fd, void *buf, long count, long offset);
+int ftruncate(int fd, long length);
+int getpid(void);
+int rename(char *oldpath, char *newpath);
+int mkdir(char *path, int mode);
+int utime(char *path, void *times);
+DIR *opendir(char *name);
+struct dirent *readdir(DIR *dirp);
+int closedir(DIR *dirp);
+
+typedef struct Type Type;
+typedef struct Member Member;
+typedef struct GvarInitializer GvarInitializer;
+
+//
+// tokenize.c
+//
+
+// Token
+typedef enum {
+  TK_RESERVED, // Keyworeds or punctuators
+  TK_IDENT,    // Identifiers
+  TK_STR,      // String literals
+  TK_NUM,      // Integer literals
+  TK_EOF,      // End-of-file markers
+} TokenKind;
+
+// Keywords, preprocessor directive names and punctuators are given
+// an ID by the tokenizer, so that they can be compared as integers.
+// The order must match `token_names` in tokenize.c.
+typedef enum {
+  ID_NONE,
+
+  // Keywords
+  KW_RETURN, KW_IF, KW_ELSE, KW_FOR, KW_WHILE, KW_INT, KW_SIZEOF,
+  KW_CHAR, KW_STRUCT, KW_UNION, KW_SHORT, KW_LONG, KW_VOID,
+  KW_TYPEDEF, KW_BOOL, KW_ENUM, KW_STATIC, KW_BREAK, KW_CONTINUE,
+  KW_GOTO, KW_SWITCH, KW_CASE, KW_DEFAULT, KW_EXTERN, KW_ALIGNOF,
+  KW_ALIGNAS, KW_DO, KW_SIGNED, KW_UNSIGNED, KW_CONST, KW_VOLATILE,
+
+  // Preprocessor directive names other than keywords
+  PP_INCLUDE, PP_DEFINE, PP_UNDEF, PP_IFDEF, PP_IFNDEF, PP_ELIF,
+  PP_ENDIF, PP_PRAGMA, PP_DEFINED, PP_ONCE,
+
+  // Punctuators, longest first
+  P_ELLIPSIS, P_SHL_ASSIGN, P_SHR_ASSIGN,
+  P_EQ, P_NE, P_LE, P_GE, P_ARROW, P_ADD_ASSIGN, P_SUB_ASSIGN,
+  P_MUL_ASSIGN, P_DIV_ASSIGN, P_INC, P_DEC, P_MOD_ASSIGN,
+  P_AND_ASSIGN, P_OR_ASSIGN, P_XOR_ASSIGN, P_LOGAND, P_LOGOR, P_SHL,
+  P_SHR, P_HASHHASH,
+  P_LPAREN, P_RPAREN, P_LBRACE, P_RBRACE, P_LBRACKET, P_RBRACKET,
+  P_SEMICOLON, P_COMMA, P_DOT, P_ASSIGN, P_LT, P_GT, P_PLUS, P_MINUS,
+  P_STAR, P_SLASH, P_PERCENT, P_AMP, P_PIPE, P_CARET, P_TILDE, P_NOT,
+  P_QUESTION, P_COLON, P_HASH,
+
+  NR_TOKEN_IDS,
+} TokenId;
+
+// Set of macro names, represented as a Patricia tree keyed by
+// name_id(). There is only one Hideset object for each set, so equal
+// sets are the same pointer. A Hideset must not be modified.
+typedef struct Hideset Hideset;
+struct Hideset {
+  Hideset *left;       // 0 if leaf
+  Hideset *right;
+  long prefix;         // Bits below `bit` shared by all names, or leaf's ID
+  long bit;            // The bit that tells which child has a name
+  char *name;          // If leaf, the name
+  unsigned long bloom; // One bit for each name, for quick rejection
+};
+
+// Source file of tokens. Tokens read from the same input share one.
+typedef struct {
+  char *name;     // Input filename
+  char *contents; // Entire input string
+  int file_no;    // File number for .loc directive
+
+  // Offsets of the beginnings of lines, recorded as the file is
+  // tokenized
+  int *lines;
+  int nr_lines;
+  int lines_cap;
+} File;
+
+// Payload of a literal token
+typedef struct {
+  long val;       // If TK_NUM, its value
+  Type *ty;       // If TK_NUM, its type
+  char *contents; // If TK_STR, its contents, not null-terminated
+  int cont_len;   // If TK_STR, its length excluding terminating '\0'
+} Literal;
+
+// Token type
+//
+// Fields the preprocessor and the parser look at for every token
+// come first. Those used only for some tokens or only for error
+// messages and debug info are kept out of line.
+typedef struct Token Token;
+struct Token {
+  TokenKind kind;   // Token kind
+  TokenId id;       // Keyword or punctuator ID, or ID_NONE
+  Token *next;      // Next token
+  char *loc;        // Token location
+  int len;          // Token length
+  int lineno;       // Line number
+  char *name;       // If identifier or keyword, its interned spelling
+  Hideset *hideset; // For macro expension
+  _Bool at_bol;      // True if this token is at beginning of line
+  _Bool has_space;   // True if this token follows a space character
+  _Bool is_raw;      // True if this token is read from a file
+  _Bool is_shared;   // True if this token is in a file's cached tokens
+
+  File *file;       // Source file
+  Literal *lit;     // If TK_NUM or TK_STR, its value
+};
+
+extern _Bool fast_lexer;
+
+void error(char *fmt, ...);
+void error_tok(Token *tok, char *fmt, ...);
+void warn_tok(Token *tok, char *fmt, ...);
+Token *skip(Token *tok, TokenId id);
+_Bool consume(Token **rest, Token *tok, TokenId id);
+char *intern(char *s, int len);
+long name_id(char *name);
+File *new_file(char *name, int file_no, char *contents);
+int get_column(Token *tok);
+void convert_keywords(Token *tok);
+Token *next_token(Token *tok);
+void free_token(Token *tok);
+Token *tokenize_lazy(char *filename, int file_no, char *p, Token *cont);
+Token *tokenize_cached(Token *src, char *filename, int file_no,
+                       Token *cont);
+Token *tokenize(char *filename, int file_no, char *p);
+
+//
+// preprocess.c
+//
+
+extern _Bool pp_report;
+
+// Identifies a file and its version.
+typedef struct {
+  unsigned long dev;
+  unsigned long ino;
+  long size;
+  long mtime_sec;
+  long mtime_nsec;
+} FileId;
+
+_Bool get_file_id(char *path, FileId *id);
+char *read_file_string(char *path, long *mapping);
+void free_file_string(char *buf, long mapping);
+int add_file(char *path);
+void save_file_ids(void);
+char *load_file_ids(void);
+void save_macros(void);
+void load_macros(void);
+Token *read_file(char *path);
+void print_pp_report(char *input);
+
+//
+// parse.c
+//
+
+// Variable
+typedef struct Var Var;
+struct Var {
+  Var *next;
+  char *name;    // Variable name
+  Type *ty;      // Type
+  Token *tok;    // representative token
+  _Bool is_local; // local or global
+  int align;     // alignment
+
+  _Bool is_static;
+  GvarInitializer *initializer;
+
+  // Local variable
+  int offset;
+
+  // Gloval variable
+  char *contents;
+  int cont_len;
+};
+
+// AST node
+typedef enum {
+  ND_ADD,       // +
+  ND_SUB,       // -
+  ND_MUL,       // *
+  ND_DIV,       // /
+  ND_MOD,       // %
+  ND_BITAND,    // &
+  ND_BITOR,     // |
+  ND_BITXOR,    // ^
+  ND_SHL,       // <<
+  ND_SHR,       // >>
+  ND_EQ,        // ==
+  ND_NE,        // !=
+  ND_LT,        // <
+  ND_LE,        // <=
+  ND_ASSIGN,    // =
+  ND_COND,      // ?:
+  ND_COMMA,     // ,
+  ND_MEMBER,    // . (struct member access)
+  ND_ADDR,      // unary &
+  ND_DEREF,     // unary *
+  ND_NOT,       // !
+  ND_BITNOT,    // ~
+  ND_LOGAND,    // &&
+  ND_LOGOR,     // ||
+  ND_RETURN,    // "return"
+  ND_IF,        // "if"
+  ND_FOR,       // "for" or "while"
+  ND_DO,        // "do"
+  ND_SWITCH,    // "switch"
+  ND_CASE,      // "case"
+  ND_BLOCK,     // { ... }
+  ND_BREAK,     // "break"
+  ND_CONTINUE,  // "continue"
+  ND_GOTO,      // "goto"
+  ND_LABEL,     // Labeled statement
+  ND_FUNCALL,   // Function call
+  ND_EXPR_STMT, // Expression statement
+  ND_STMT_EXPR, // Statement expression
+  ND_VAR,       // Variable
+  ND_NUM,       // Integer
+  ND_CAST,      // Type cast
+} NodeKind;
+
+// AST node type
+typedef struct Node Node;
+struct Node {
+  NodeKind kind; // Node kind
+  Node *next;    // Next node
+  Type *ty;      // Type, e.g. int or pointer to tin
+  Token *tok;    // Representative token
+
+  Node *lhs;     // Left-hand side
+  Node *rhs;     // Right-hand side
+
+  // "if" or "for" statement
+  Node *cond;
+  Node *then;
+  Node *els;
+  Node *init;
+  Node *inc;
+
+  // Assignment
+  _Bool is_init;
+
+  // Blcok or statement expression
+  Node *body;
+
+  // Struct member access
+  Member *member;
+
+  // Function call
+  char *funcname;
+  Type *func_ty;
+  Node *args;
+
+  // Goto or labeled statement
+  char *label_name;
+
+  // Switch-cases
+  Node *case_next;
+  Node *default_case;
+  int case_label;
+  int case_end_label;
+
+  // Variable
+  Var *var;
+
+  // Integer literal
+  long val;
+};
+
+// Global variable initializer. Global variables can be initialized
+// either by a constatnt expression or a pointer to another global
+// bariable with an addend.
+struct GvarInitializer {
+  GvarInitializer *next;
+  int offset;
+
+  // Scalar value
+  int sz;
+  long val;
+
+  // Byte string of `sz` bytes
+  char *bytes;
+
+  // Reference to another global variable
+  char *label;
+  long addend;
+};
+
+typedef struct Function Function;
+struct Function {
+  Function *next;
+  char *name;
+  Var *params;
+  _Bool is_static;
+  _Bool is_varargs;
+
+  Node *node;
+  Var *locals;
+  int stack_size;
+  long nr_nodes; // The number of AST nodes, as an estimate of work
+};
+
+typedef struct {
+  Var *globals;
+  Function *fns;
+} Program;
+
+Node *new_cast(Node *expr, Type *ty);
+long const_expr(Token **rest, Token *tok);
+void save_scopes(void);
+void load_scopes(void);
+Program *parse(Token *tok);
+
+//
+// type.c
+//
+
+typedef enum {
+  TY_VOID,
+  TY_BOOL,
+  TY_CHAR,
+  TY_SHORT,
+  TY_INT,
+  TY_LONG,
+  TY_ENUM,
+  TY_PTR,
+  TY_FUNC,
+  TY_ARRAY,
+  TY_STRUCT,
+} TypeKind;
+
+struct Type {
+  TypeKind kind;
+  int size;           // sizeof() value
+  int align;          // alignment
+  _Bool is_unsigned;   // unsigned or signed
+  _Bool is_incomplete; // incomplete type
+  _Bool is_const;
+
+  // Pointer
+  Type *base;
+
+  // Declaration
+  Token *name;
+  Token *name_pos;
+
+  // Array
+  int array_len;
+
+  // Struct
+  Member *members;
+
+  // Function type
+  Type *return_ty;
+  Type *params;
+  _Bool is_varargs;
+  Type *next;
+};
+
+// Struct member
+struct Member {
+  Member *next;
+  Type *ty;
+  Token *tok; // for error message
+  Token *name;
+  int align;
+  int offset;
+};
+
+extern Type *ty_void;
+extern Type *ty_bool;
+
+extern Type *ty_char;
+extern Type *ty_short;
+extern Type *ty_int;
+extern Type *ty_long;
+
+extern Type *ty_uchar;
+extern Type *ty_ushort;
+extern Type *ty_uint;
+extern Type *ty_ulong;
+
+_Bool is_integer(Type *ty);
+Type *copy_type(Type *ty);
+Type *pointer_to(Type *base);
+int align_to(int n, int align);
+Type *func_type(Type *return_ty);
+Type *array_of(Type *base, int size);
+Type *enum_type(void);
+Type *struct_type(void);
+int size_of(Type *ty);
+Type *copy_type(Type *ty);
+void add_type(Node *node);
+
+//
+// codegen.c
+//
+
+extern int codegen_jobs;
+
+void codegen(Program *prog);
+
+//
+// emit.c
+//
+
+void open_output(char *path);
+void flush_output(void);
+void write_output(char *p, long len);
+void capture_output(void);
+char *take_output(void);
+void emitf(char *fmt, ...);
+void println(char *fmt, ...);
+long output_size(void);
+char *output_since(long pos);
+
+//
+// assemble.c
+//
+
+void assemble(char *input, char *path);
+
+//
+// timer.c
+//
+
+typedef enum {
+  PH_READ,       // read_file_string
+  PH_TOKENIZE,   // tokenize
+  PH_PREPROCESS, // preprocess
+  PH_KEYWORDS,   // convert_keywords
+  PH_PARSE,      // parse
+  PH_LAYOUT,     // stack offset assignment
+  PH_EMIT_DATA,  // emit_data
+  PH_EMIT_TEXT,  // emit_text
+  PH_ASSEMBLE,   // assemble
+  NR_PHASES,
+} Phase;
+
+extern _Bool time_report;
+extern _Bool time_report_json;
+
+void timer_start(Phase ph);
+void timer_stop(void);
+void timer_count(Phase ph, long n);
+void timer_count_lines(long n);
+void reset_timer(void);
+Phase current_phase(void);
+char *phase_name(Phase ph);
+void print_time_report(char *input);
+
+//
+// alloc.c
+//
+
+typedef enum {
+  AK_TOKEN,       // Token
+  AK_HIDESET,     // Hideset
+  AK_MACRO,       // Macro, MacroParam, MacroArg and CondIncl
+  AK_NODE,        // Node
+  AK_TYPE,        // Type
+  AK_MEMBER,      // Member
+  AK_VAR,         // Var
+  AK_VAR_SCOPE,   // VarScope
+  AK_TAG_SCOPE,   // TagScope
+  AK_FUNCTION,    // Function and Program
+  AK_INITIALIZER, // Initializer
+  AK_GVAR_INIT,   // GvarInitializer
+  AK_STRING,      // Names, labels and string literals
+  AK_FILE,        // Source file contents
+  NR_ALLOC_KINDS,
+} AllocKind;
+
+typedef struct Arena Arena;
+
+extern _Bool mem_report;
+
+void reset_alloc_stats(void);
+void count_alloc(AllocKind kind, long size);
+void *alloc_obj(AllocKind kind, long size);
+char *alloc_str(char *s, long len);
+void free_arena(void);
+Arena *enter_arena(void);
+void leave_arena(Arena *arena);
+void release_arena(Arena *arena);
+void print_mem_report(char *input);
+
+//
+// server.c
+//
+
+Token *find_cached_file(char *path);
+void note_input_file(char *path);
+char *read_all(int fd);
+void run_server(char *path, int *argc, char ***argv);
+int run_client(char *path, int argc, char **argv);
+
+//
+// pch.c
+//
+
+void pch_put_long(long val);
+void pch_put_str(char *s);
+void pch_put_token(Token *tok);
+void pch_put_tokens(Token *tok);
+void pch_put_type(Type *ty);
+void pch_put_var(Var *var);
+void write_pch(char *path);
+
+long pch_get_long(void);
+char *pch_get_str(void);
+char *pch_get_name(void);
+Token *pch_get_token(void);
+Token *pch_get_tokens(void);
+Type *pch_get_type(void);
+Var *pch_get_var(void);
+void read_pch(char *path);
+
+//
+// cache.c
+//
+
+extern char *cache_dir;
+extern long cache_max_size;
+extern _Bool cache_stats;
+
+char *cache_key(Token *tok, char *hdr, long hdr_len);
+_Bool cache_lookup(char *key);
+void cache_store(char *key, char *p, long len);
+void print_cache_stats(void);
+
+//
+// hashmap.c
+//
+
+typedef struct {
+  char *key;
+  int keylen;
+  void *val;
+} HashEntry;
+
+typedef struct {
+  HashEntry *buckets;
+  int capacity;
+  int used;
+
+  // Statistics
+  long lookups;
+  long probes;
+} HashMap;
+
+void *hashmap_get(HashMap *map, char *key);
+void *hashmap_get2(HashMap *map, char *key, int keylen);
+void hashmap_put(HashMap *map, char *key, void *val);
+void hashmap_put2(HashMap *map, char *key, int keylen, void *val);
+void hashmap_delete(HashMap *map, char *key);
+void hashmap_delete2(HashMap *map, char *key, int keylen);
+
+//
+// main.c
+//
+
+extern _Bool preprocess_only;
+extern _Bool output_object;
+extern char *include_pch;
+// This file implements precompiled headers.
+//
+// `punyc --emit-pch foo.h -o foo.pch` preprocesses and parses a
+// header, and saves the resulting state of the preprocessor (macros)
+// and the parser (file-scope typedefs, struct/union/enum tags, enum
+// constants and extern declarations) to a file. `-include-pch
+// foo.pch` restores that state before compiling a file, which has
+// the same effect as including the header first but doesn't
+// tokenize nor parse it again.
+//
+// The saved state is a graph of Types, Tokens, Vars and so on which
+// may have cycles (e.g. a struct with a pointer to itself). We
+// serialize it by visiting each object only once: the first
+// reference to an object writes it out in full and implicitly
+// assigns it a new ID, and later references are written as the ID.
+
+
+static char *pch_magic = "PUNYCPCH";
+
+// Bump this if the file format changes.
+enum { PCH_VERSION = 7 };
+
+// A reference to an object which is written out right after it.
+enum { NEW_OBJECT = -1 };
+
+// Writer states
+static char *out;
+static long out_len;
+static long out_cap;
+static HashMap obj_ids;
+static long nr_objs;
+
+// Reader states
+static char *in;
+static long in_len;
+static long in_pos;
+static char *in_path;
+static void **objs;
+static long objs_cap;
+
+// File numbers in the precompiled header are mapped to new ones
+// when a token from the file is read for the first time.
+static int *file_map;
+static int file_map_cap;
+
+// Built-in types are not written out, but always referred to by ID.
+static Type **builtin_types(void) {
+  static Type *types[11];
+  types[0] = ty_void;
+  types[1] = ty_bool;
+  types[2] = ty_char;
+  types[3] = ty_short;
+  types[4] = ty_int;
+  types[5] = ty_long;
+  types[6] = ty_uchar;
+  types[7] = ty_ushort;
+  types[8] = ty_uint;
+  types[9] = ty_ulong;
+  types[10] = 0;
+  return types;
+}
+
+//
+// Writer
+//
+
+static void put_bytes(void *p, long len) {
+  if (out_len + len > out_cap) {
+    while (out_len + len > out_cap)
+      out_cap = out_cap ? out_cap * 2 : 4096;
+    out = realloc(out, out_cap);
+  }
+  memcpy(out + out_len, p, len);
+  out_len += len;
+}
+
+void pch_put_long(long val) {
+  put_bytes(&val, sizeof(val));
+}
+
+// Assigns a new ID to a given object.
+static void add_id(void *p) {
+  char *key = alloc_obj(AK_STRING, sizeof(p));
+  memcpy(key, &p, sizeof(p));
+  hashmap_put2(&obj_ids, key, sizeof(p), (void *)++nr_objs);
+}
+
+// Writes a reference to a given object. Returns 1 if the object
+// is seen for the first time, in which case the caller must write
+// out its contents.
+static _Bool put_ref(void *p) {
+  if (!p) {
+    pch_put_long(0);
+    return 0;
+  }
+
+  long id = (long)hashmap_get2(&obj_ids, (char *)&p, sizeof(p));
+  if (id) {
+    pch_put_long(id);
+    return 0;
+  }
+
+  add_id(p);
+  pch_put_long(NEW_OBJECT);
+  return 1;
+}
+
+static void put_blob(char *p, long len) {
+  pch_put_long(len);
+  put_bytes(p, len);
+}
+
+void pch_put_str(char *s) {
+  if (put_ref(s))
+    put_blob(s, strlen(s));
+}
+
+static void put_file(File *file) {
+  if (!put_ref(file))
+    return;
+  pch_put_str(file->name);
+  pch_put_str(file->contents);
+  pch_put_long(file->file_no);
+}
+
+static void put_literal(Literal *lit) {
+  if (!put_ref(lit))
+    return;
+  pch_put_long(lit->val);
+  pch_put_type(lit->ty);
+  pch_put_long(lit->contents != 0);
+  if (lit->contents)
+    put_blob(lit->contents, lit->cont_len);
+}
+
+static void put_token_fields(Token *tok) {
+  pch_put_long(tok->kind);
+  pch_put_long(tok->id);
+  put_file(tok->file);
+  pch_put_long(tok->loc - tok->file->contents);
+  pch_put_long(tok->len);
+  pch_put_long(tok->name != 0);
+  put_literal(tok->lit);
+  pch_put_long(tok->lineno);
+  pch_put_long(tok->at_bol);
+  pch_put_long(tok->has_space);
+}
+
+// Writes a single token. Its `next` is not followed.
+void pch_put_token(Token *tok) {
+  if (put_ref(tok))
+    put_token_fields(tok);
+}
+
+// Writes a list of tokens.
+void pch_put_tokens(Token *tok) {
+  long n = 0;
+  for (Token *t = tok; t; t = t->next)
+    n++;
+
+  pch_put_long(n);
+  for (Token *t = tok; t; t = t->next)
+    put_token_fields(t);
+}
+
+static void put_member(Member *mem) {
+  if (!put_ref(mem))
+    return;
+  put_member(mem->next);
+  pch_put_type(mem->ty);
+  pch_put_token(mem->tok);
+  pch_put_token(mem->name);
+  pch_put_long(mem->align);
+  pch_put_long(mem->offset);
+}
+
+void pch_put_type(Type *ty) {
+  if (!put_ref(ty))
+    return;
+  pch_put_long(ty->kind);
+  pch_put_long(ty->size);
+  pch_put_long(ty->align);
+  pch_put_long(ty->is_unsigned);
+  pch_put_long(ty->is_incomplete);
+  pch_put_long(ty->is_const);
+  pch_put_type(ty->base);
+  pch_put_token(ty->name);
+  pch_put_token(ty->name_pos);
+  pch_put_long(ty->array_len);
+  put_member(ty->members);
+  pch_put_type(ty->return_ty);
+  pch_put_type(ty->params);
+  pch_put_long(ty->is_varargs);
+  pch_put_type(ty->next);
+}
+
+void pch_put_var(Var *var) {
+  if (!put_ref(var))
+    return;
+  pch_put_str(var->name);
+  pch_put_type(var->ty);
+  pch_put_token(var->tok);
+  pch_put_long(var->align);
+  pch_put_long(var->is_static);
+}
+
+static void put_compiler_id(void) {
+  struct stat st = {};
+  stat("/proc/self/exe", &st);
+  pch_put_long(st.st_size);
+  pch_put_long(st.st_mtim.tv_sec);
+  pch_put_long(st.st_mtim.tv_nsec);
+}
+
+// Writes the current preprocessor and parser states to a given file.
+void write_pch(char *path) {
+  nr_objs = 0;
+  put_bytes(pch_magic, strlen(pch_magic));
+  pch_put_long(PCH_VERSION);
+  put_compiler_id();
+
+  for (Type **ty = builtin_types(); *ty; ty++)
+    add_id(*ty);
+
+  save_file_ids();
+  save_macros();
+  save_scopes();
+
+  open_output(path);
+  write_output(out, out_len);
+}
+
+//
+// Reader
+//
+
+static void get_bytes(void *p, long len) {
+  if (in_pos + len > in_len)
+    error("%s: corrupted precompiled header", in_path);
+  memcpy(p, in + in_pos, len);
+  in_pos += len;
+}
+
+long pch_get_long(void) {
+  long val;
+  get_bytes(&val, sizeof(val));
+  return val;
+}
+
+static void add_obj(void *p) {
+  if (nr_objs == objs_cap) {
+    objs_cap = objs_cap ? objs_cap * 2 : 1024;
+    objs = realloc(objs, sizeof(void *) * objs_cap);
+  }
+  objs[nr_objs++] = p;
+}
+
+// Reads a reference written by put_ref(). If it's a new object,
+// sets `fresh` to 1, and the caller must read its contents and
+// register it with add_obj().
+static void *get_ref(_Bool *fresh) {
+  *fresh = 0;
+
+  long id = pch_get_long();
+  if (id == 0)
+    return 0;
+
+  if (id == NEW_OBJECT) {
+    *fresh = 1;
+    return 0;
+  }
+
+  if (id < 1 || id > nr_objs)
+    error("%s: corrupted precompiled header", in_path);
+  return objs[id - 1];
+}
+
+static char *get_blob(long *len) {
+  *len = pch_get_long();
+  if (*len < 0 || in_pos + *len > in_len)
+    error("%s: corrupted precompiled header", in_path);
+  char *p = alloc_str(in + in_pos, *len);
+  in_pos += *len;
+  return p;
+}
+
+char *pch_get_str(void) {
+  _Bool fresh;
+  char *s = get_ref(&fresh);
+  if (!fresh)
+    return s;
+
+  long len;
+  s = get_blob(&len);
+  add_obj(s);
+  return s;
+}
+
+// Reads a string written by pch_put_str() and interns it.
+char *pch_get_name(void) {
+  char *s = pch_get_str();
+  return s ? intern(s, strlen(s)) : 0;
+}
+
+static int map_file_no(int old, char *filename) {
+  if (old <= 0)
+    return old;
+
+  if (old >= file_map_cap) {
+    int cap = file_map_cap;
+    while (old >= file_map_cap)
+      file_map_cap = file_map_cap ? file_map_cap * 2 : 16;
+    file_map = realloc(file_map, sizeof(int) * file_map_cap);
+    memset(file_map + cap, 0, sizeof(int) * (file_map_cap - cap));
+  }
+
+  if (!file_map[old])
+    file_map[old] = add_file(filename);
+  return file_map[old];
+}
+
+static File *get_file(void) {
+  _Bool fresh;
+  File *file = get_ref(&fresh);
+  if (!fresh)
+    return file;
+
+  file = alloc_obj(AK_FILE, sizeof(File));
+  add_obj(file);
+  file->name = pch_get_str();
+  file->contents = pch_get_str();
+  file->file_no = map_file_no(pch_get_long(), file->name);
+  return file;
+}
+
+static Literal *get_literal(void) {
+  _Bool fresh;
+  Literal *lit = get_ref(&fresh);
+  if (!fresh)
+    return lit;
+
+  lit = alloc_obj(AK_TOKEN, sizeof(Literal));
+  add_obj(lit);
+  lit->val = pch_get_long();
+  lit->ty = pch_get_type();
+  if (pch_get_long()) {
+    long len;
+    lit->contents = get_blob(&len);
+    lit->cont_len = len;
+  }
+  return lit;
+}
+
+static void get_token_fields(Token *tok) {
+  tok->kind = pch_get_long();
+  tok->id = pch_get_long();
+  tok->file = get_file();
+  tok->loc = tok->file->contents + pch_get_long();
+  tok->len = pch_get_long();
+  if (pch_get_long())
+    tok->name = intern(tok->loc, tok->len);
+  tok->lit = get_literal();
+  tok->lineno = pch_get_long();
+  tok->at_bol = pch_get_long();
+  tok->has_space = pch_get_long();
+}
+
+Token *pch_get_token(void) {
+  _Bool fresh;
+  Token *tok = get_ref(&fresh);
+  if (!fresh)
+    return tok;
+
+  tok = alloc_obj(AK_TOKEN, sizeof(Token));
+  add_obj(tok);
+  get_token_fields(tok);
+  return tok;
+}
+
+Token *pch_get_tokens(void) {
+  Token head = {};
+  Token *cur = &head;
+
+  for (long n = pch_get_long(); n > 0; n--) {
+    cur = cur->next = alloc_obj(AK_TOKEN, sizeof(Token));
+    get_token_fields(cur);
+  }
+  return head.next;
+}
+
+static Member *get_member(void) {
+  _Bool fresh;
+  Member *mem = get_ref(&fresh);
+  if (!fresh)
+    return mem;
+
+  mem = alloc_obj(AK_MEMBER, sizeof(Member));
+  add_obj(mem);
+  mem->next = get_member();
+  mem->ty = pch_get_type();
+  mem->tok = pch_get_token();
+  mem->name = pch_get_token();
+  mem->align = pch_get_long();
+  mem->offset = pch_get_long();
+  return mem;
+}
+
+Type *pch_get_type(void) {
+  _Bool fresh;
+  Type *ty = get_ref(&fresh);
+  if (!fresh)
+    return ty;
+
+  ty = alloc_obj(AK_TYPE, sizeof(Type));
+  add_obj(ty);
+  ty->kind = pch_get_long();
+  ty->size = pch_get_long();
+  ty->align = pch_get_long();
+  ty->is_unsigned = pch_get_long();
+  ty->is_incomplete = pch_get_long();
+  ty->is_const = pch_get_long();
+  ty->base = pch_get_type();
+  ty->name = pch_get_token();
+  ty->name_pos = pch_get_token();
+  ty->array_len = pch_get_long();
+  ty->members = get_member();
+  ty->return_ty = pch_get_type();
+  ty->params = pch_get_type();
+  ty->is_varargs = pch_get_long();
+  ty->next = pch_get_type();
+  return ty;
+}
+
+Var *pch_get_var(void) {
+  _Bool fresh;
+  Var *var = get_ref(&fresh);
+  if (!fresh)
+    return var;
+
+  var = alloc_obj(AK_VAR, sizeof(Var));
+  add_obj(var);
+  var->name = pch_get_str();
+  var->ty = pch_get_type();
+  var->tok = pch_get_token();
+  var->align = pch_get_long();
+  var->is_static = pch_get_long();
+  return var;
+}
+
+// Restores the preprocessor and parser states from a given file.
+void read_pch(char *path) {
+  in_path = path;
+  in = read_file_string(path, 0);
+  if (!in)
+    error("cannot open %s: %s", path, strerror(*__errno_location()));
+  in_len = strlen(pch_magic) + sizeof(long) * 4;
+
+  // read_file_string() may have appended a newline.
+  struct stat st;
+  stat(path, &st);
+  if (st.st_size < in_len || memcmp(in, pch_magic, strlen(pch_magic)))
+    error("%s: not a precompiled header", path);
+  in_len = st.st_size;
+  in_pos = strlen(pch_magic);
+
+  // A precompiled header depends on the compiler's data structures,
+  // so it can be used only by the compiler that created it.
+  long version = pch_get_long();
+  struct stat exe = {};
+  stat("/proc/self/exe", &exe);
+  if (version != PCH_VERSION || pch_get_long() != exe.st_size ||
+      pch_get_long() != exe.st_mtim.tv_sec ||
+      pch_get_long() != exe.st_mtim.tv_nsec)
+    error("%s: precompiled header was created by a different compiler", path);
+
+  for (Type **ty = builtin_types(); *ty; ty++)
+    add_obj(*ty);
+
+  // The header and the files it includes must not have changed.
+  char *changed = load_file_ids();
+  if (changed)
+    error("%s: precompiled header is out of date: %s has changed",
+          path, changed);
+
+  load_macros();
+  load_scopes();
+}
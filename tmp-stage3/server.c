@@ -0,0 +1,1283 @@
+typedef struct FILE FILE;
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+typedef struct {
+  int gp_offset;
+  int fp_offset;
+  void *overflow_arg_area;
+  void *reg_save_area;
+} va_list[1];
+
+struct timespec {
+  long tv_sec;
+  long tv_nsec;
+};
+
+struct rusage {
+  long ru_utime[2];
+  long ru_stime[2];
+  long ru_maxrss;
+  long ru_reserved[13];
+};
+
+struct stat {
+  unsigned long st_dev;
+  unsigned long st_ino;
+  unsigned long st_nlink;
+  unsigned int st_mode;
+  unsigned int st_uid;
+  unsigned int st_gid;
+  int __pad0;
+  unsigned long st_rdev;
+  long st_size;
+  long st_blksize;
+  long st_blocks;
+  struct timespec st_atim;
+  struct timespec st_mtim;
+  struct timespec st_ctim;
+  long __reserved[3];
+};
+
+struct sockaddr_un {
+  unsigned short sun_family;
+  char sun_path[108];
+};
+
+struct iovec {
+  void *iov_base;
+  long iov_len;
+};
+
+struct msghdr {
+  void *msg_name;
+  int msg_namelen;
+  struct iovec *msg_iov;
+  long msg_iovlen;
+  void *msg_control;
+  long msg_controllen;
+  int msg_flags;
+};
+
+struct pollfd {
+  int fd;
+  short events;
+  short revents;
+};
+
+typedef struct DIR DIR;
+
+struct dirent {
+  unsigned long d_ino;
+  long d_off;
+  unsigned short d_reclen;
+  unsigned char d_type;
+  char d_name[256];
+};
+
+enum { EINTR = 4 };
+enum { O_RDONLY = 0, O_WRONLY = 1, O_RDWR = 2, O_CREAT = 64, O_TRUNC = 512 };
+enum { LOCK_EX = 2 };
+enum { S_IFMT = 61440, S_IFREG = 32768 };
+enum { PROT_READ = 1, PROT_WRITE = 2 };
+enum { MAP_PRIVATE = 2, MAP_FIXED = 16, MAP_ANONYMOUS = 32, MAP_POPULATE = 32768 };
+enum { _SC_PAGESIZE = 30 };
+enum { AF_UNIX = 1, SOCK_STREAM = 1, SOL_SOCKET = 1, SCM_RIGHTS = 1 };
+enum { MSG_CTRUNC = 8, MSG_NOSIGNAL = 16384 };
+enum { POLLIN = 1 };
+enum { RUSAGE_SELF = 0 };
+enum { CLOCK_MONOTONIC = 1, CLOCK_PROCESS_CPUTIME_ID = 2 };
+
+void *malloc(long size);
+void *calloc(long nmemb, long size);
+void *realloc(void *buf, long size);
+int *__errno_location();
+char *strerror(int errnum);
+FILE *fopen(char *pathname, char *mode);
+long fread(void *ptr, long size, long nmemb, FILE *stream);
+int fclose(FILE *fp);
+int feof(FILE *stream);
+static void assert() {}
+int strcmp(char *s1, char *s2);
+int strncasecmp(char *s1, char *s2);
+int printf(char *fmt, ...);
+int sprintf(char *buf, char *fmt, ...);
+int fprintf(FILE *fp, char *fmt, ...);
+int vfprintf(FILE *fp, char *fmt, va_list ap);
+long strlen(char *p);
+int strncmp(char *p, char *q);
+void *memvpy(char *dst, char *src, long n);
+char *strndup(char *p, long n);
+int isspace(int c);
+int ispunct(int c);
+int isdigit(int c);
+char *strstr(char *haystack, char *needle);
+static void va_end(va_list ap) {}
+long strtoul(char *nptr, char **endptr, int base);
+char *strncpy(char *dest, char *src, long n);
+void exit(int code);
+int atoi(char *nptr);
+char *strrchr(char *s, int c);
+int fflush(FILE *stream);
+int fork(void);
+int waitpid(int pid, int *status, int options);
+int unlink(char *pathname);
+int creat(char *pathname, int mode);
+void *memset(void *s, int c, long n);
+int memcmp(void *s1, void *s2, long n);
+char *strchr(char *s, int c);
+long strtol(char *nptr, char **endptr, int base);
+long write(int fd, void *buf, long count);
+void *memcpy(void *dst, void *src, long n);
+int clock_gettime(int clockid, struct timespec *tp);
+int getrusage(int who, struct rusage *usage);
+void free(void *ptr);
+char *strcpy(char *dest, char *src);
+long read(int fd, void *buf, long count);
+int close(int fd);
+int dup2(int oldfd, int newfd);
+int pipe(int *pipefd);
+int chdir(char *path);
+char *getcwd(char *buf, long size);
+char *realpath(char *path, char *resolved_path);
+int stat(char *path, struct stat *buf);
+int socket(int domain, int type, int protocol);
+int bind(int fd, struct sockaddr *addr, int len);
+int listen(int fd, int backlog);
+int accept(int fd, struct sockaddr *addr, int *len);
+int connect(int fd, struct sockaddr *addr, int len);
+long send(int fd, void *buf, long len, int flags);
+long sendmsg(int fd, struct msghdr *msg, int flags);
+long recvmsg(int fd, struct msghdr *msg, int flags);
+int poll(struct pollfd *fds, long nfds, int timeout);
+int open(char *path, int flags, ...);
+int fstat(int fd, struct stat *buf);
+int flock(int fd, int op);
+void *mmap(void *addr, long len, int prot, int flags, int fd, long off);
+int munmap(void *addr, long len);
+long sysconf(int name);
+long pread(int fd, void *buf, long count, long offset);
+long pwrite(int fd, void *buf, long count, long offset);
+int ftruncate(int fd, long length);
+int getpid(void);
+int rename(char *oldpath, char *newpath);
+int mkdir(char *path, int mode);
+int utime(char *path, void *times);
+DIR *opendir(char *name);
+struct dirent *readdir(DIR *dirp);
+int closedir(DIR *dirp);
+
+typedef struct Type Type;
+typedef struct Member Member;
+typedef struct GvarInitializer GvarInitializer;
+
+//
+// tokenize.c
+//
+
+// Token
+typedef enum {
+  TK_RESERVED, // Keyworeds or punctuators
+  TK_IDENT,    // Identifiers
+  TK_STR,      // String literals
+  TK_NUM,      // Integer literals
+  TK_EOF,      // End-of-file markers
+} TokenKind;
+
+// Keywords, preprocessor directive names and punctuators are given
+// an ID by the tokenizer, so that they can be compared as integers.
+// The order must match `token_names` in tokenize.c.
+typedef enum {
+  ID_NONE,
+
+  // Keywords
+  KW_RETURN, KW_IF, KW_ELSE, KW_FOR, KW_WHILE, KW_INT, KW_SIZEOF,
+  KW_CHAR, KW_STRUCT, KW_UNION, KW_SHORT, KW_LONG, KW_VOID,
+  KW_TYPEDEF, KW_BOOL, KW_ENUM, KW_STATIC, KW_BREAK, KW_CONTINUE,
+  KW_GOTO, KW_SWITCH, KW_CASE, KW_DEFAULT, KW_EXTERN, KW_ALIGNOF,
+  KW_ALIGNAS, KW_DO, KW_SIGNED, KW_UNSIGNED, KW_CONST, KW_VOLATILE,
+
+  // Preprocessor directive names other than keywords
+  PP_INCLUDE, PP_DEFINE, PP_UNDEF, PP_IFDEF, PP_IFNDEF, PP_ELIF,
+  PP_ENDIF, PP_PRAGMA, PP_DEFINED, PP_ONCE,
+
+  // Punctuators, longest first
+  P_ELLIPSIS, P_SHL_ASSIGN, P_SHR_ASSIGN,
+  P_EQ, P_NE, P_LE, P_GE, P_ARROW, P_ADD_ASSIGN, P_SUB_ASSIGN,
+  P_MUL_ASSIGN, P_DIV_ASSIGN, P_INC, P_DEC, P_MOD_ASSIGN,
+  P_AND_ASSIGN, P_OR_ASSIGN, P_XOR_ASSIGN, P_LOGAND, P_LOGOR, P_SHL,
+  P_SHR, P_HASHHASH,
+  P_LPAREN, P_RPAREN, P_LBRACE, P_RBRACE, P_LBRACKET, P_RBRACKET,
+  P_SEMICOLON, P_COMMA, P_DOT, P_ASSIGN, P_LT, P_GT, P_PLUS, P_MINUS,
+  P_STAR, P_SLASH, P_PERCENT, P_AMP, P_PIPE, P_CARET, P_TILDE, P_NOT,
+  P_QUESTION, P_COLON, P_HASH,
+
+  NR_TOKEN_IDS,
+} TokenId;
+
+// Set of macro names, represented as a Patricia tree keyed by
+// name_id(). There is only one Hideset object for each set, so equal
+// sets are the same pointer. A Hideset must not be modified.
+typedef struct Hideset Hideset;
+struct Hideset {
+  Hideset *left;       // 0 if leaf
+  Hideset *right;
+  long prefix;         // Bits below `bit` shared by all names, or leaf's ID
+  long bit;            // The bit that tells which child has a name
+  char *name;          // If leaf, the name
+  unsigned long bloom; // One bit for each name, for quick rejection
+};
+
+// Source file of tokens. Tokens read from the same input share one.
+typedef struct {
+  char *name;     // Input filename
+  char *contents; // Entire input string
+  int file_no;    // File number for .loc directive
+
+  // Offsets of the beginnings of lines, recorded as the file is
+  // tokenized
+  int *lines;
+  int nr_lines;
+  int lines_cap;
+} File;
+
+// Payload of a literal token
+typedef struct {
+  long val;       // If TK_NUM, its value
+  Type *ty;       // If TK_NUM, its type
+  char *contents; // If TK_STR, its contents, not null-terminated
+  int cont_len;   // If TK_STR, its length excluding terminating '\0'
+} Literal;
+
+// Token type
+//
+// Fields the preprocessor and the parser look at for every token
+// come first. Those used only for some tokens or only for error
+// messages and debug info are kept out of line.
+typedef struct Token Token;
+struct Token {
+  TokenKind kind;   // Token kind
+  TokenId id;       // Keyword or punctuator ID, or ID_NONE
+  Token *next;      // Next token
+  char *loc;        // Token location
+  int len;          // Token length
+  int lineno;       // Line number
+  char *name;       // If identifier or keyword, its interned spelling
+  Hideset *hideset; // For macro expension
+  _Bool at_bol;      // True if this token is at beginning of line
+  _Bool has_space;   // True if this token follows a space character
+  _Bool is_raw;      // True if this token is read from a file
+  _Bool is_shared;   // True if this token is in a file's cached tokens
+
+  File *file;       // Source file
+  Literal *lit;     // If TK_NUM or TK_STR, its value
+};
+
+extern _Bool fast_lexer;
+
+void error(char *fmt, ...);
+void error_tok(Token *tok, char *fmt, ...);
+void warn_tok(Token *tok, char *fmt, ...);
+Token *skip(Token *tok, TokenId id);
+_Bool consume(Token **rest, Token *tok, TokenId id);
+char *intern(char *s, int len);
+long name_id(char *name);
+File *new_file(char *name, int file_no, char *contents);
+int get_column(Token *tok);
+void convert_keywords(Token *tok);
+Token *next_token(Token *tok);
+void free_token(Token *tok);
+Token *tokenize_lazy(char *filename, int file_no, char *p, Token *cont);
+Token *tokenize_cached(Token *src, char *filename, int file_no,
+                       Token *cont);
+Token *tokenize(char *filename, int file_no, char *p);
+
+//
+// preprocess.c
+//
+
+extern _Bool pp_report;
+
+// Identifies a file and its version.
+typedef struct {
+  unsigned long dev;
+  unsigned long ino;
+  long size;
+  long mtime_sec;
+  long mtime_nsec;
+} FileId;
+
+_Bool get_file_id(char *path, FileId *id);
+char *read_file_string(char *path, long *mapping);
+void free_file_string(char *buf, long mapping);
+int add_file(char *path);
+void save_file_ids(void);
+char *load_file_ids(void);
+void save_macros(void);
+void load_macros(void);
+Token *read_file(char *path);
+void print_pp_report(char *input);
+
+//
+// parse.c
+//
+
+// Variable
+typedef struct Var Var;
+struct Var {
+  Var *next;
+  char *name;    // Variable name
+  Type *ty;      // Type
+  Token *tok;    // representative token
+  _Bool is_local; // local or global
+  int align;     // alignment
+
+  _Bool is_static;
+  GvarInitializer *initializer;
+
+  // Local variable
+  int offset;
+
+  // Gloval variable
+  char *contents;
+  int cont_len;
+};
+
+// AST node
+typedef enum {
+  ND_ADD,       // +
+  ND_SUB,       // -
+  ND_MUL,       // *
+  ND_DIV,       // /
+  ND_MOD,       // %
+  ND_BITAND,    // &
+  ND_BITOR,     // |
+  ND_BITXOR,    // ^
+  ND_SHL,       // <<
+  ND_SHR,       // >>
+  ND_EQ,        // ==
+  ND_NE,        // !=
+  ND_LT,        // <
+  ND_LE,        // <=
+  ND_ASSIGN,    // =
+  ND_COND,      // ?:
+  ND_COMMA,     // ,
+  ND_MEMBER,    // . (struct member access)
+  ND_ADDR,      // unary &
+  ND_DEREF,     // unary *
+  ND_NOT,       // !
+  ND_BITNOT,    // ~
+  ND_LOGAND,    // &&
+  ND_LOGOR,     // ||
+  ND_RETURN,    // "return"
+  ND_IF,        // "if"
+  ND_FOR,       // "for" or "while"
+  ND_DO,        // "do"
+  ND_SWITCH,    // "switch"
+  ND_CASE,      // "case"
+  ND_BLOCK,     // { ... }
+  ND_BREAK,     // "break"
+  ND_CONTINUE,  // "continue"
+  ND_GOTO,      // "goto"
+  ND_LABEL,     // Labeled statement
+  ND_FUNCALL,   // Function call
+  ND_EXPR_STMT, // Expression statement
+  ND_STMT_EXPR, // Statement expression
+  ND_VAR,       // Variable
+  ND_NUM,       // Integer
+  ND_CAST,      // Type cast
+} NodeKind;
+
+// AST node type
+typedef struct Node Node;
+struct Node {
+  NodeKind kind; // Node kind
+  Node *next;    // Next node
+  Type *ty;      // Type, e.g. int or pointer to tin
+  Token *tok;    // Representative token
+
+  Node *lhs;     // Left-hand side
+  Node *rhs;     // Right-hand side
+
+  // "if" or "for" statement
+  Node *cond;
+  Node *then;
+  Node *els;
+  Node *init;
+  Node *inc;
+
+  // Assignment
+  _Bool is_init;
+
+  // Blcok or statement expression
+  Node *body;
+
+  // Struct member access
+  Member *member;
+
+  // Function call
+  char *funcname;
+  Type *func_ty;
+  Node *args;
+
+  // Goto or labeled statement
+  char *label_name;
+
+  // Switch-cases
+  Node *case_next;
+  Node *default_case;
+  int case_label;
+  int case_end_label;
+
+  // Variable
+  Var *var;
+
+  // Integer literal
+  long val;
+};
+
+// Global variable initializer. Global variables can be initialized
+// either by a constatnt expression or a pointer to another global
+// bariable with an addend.
+struct GvarInitializer {
+  GvarInitializer *next;
+  int offset;
+
+  // Scalar value
+  int sz;
+  long val;
+
+  // Byte string of `sz` bytes
+  char *bytes;
+
+  // Reference to another global variable
+  char *label;
+  long addend;
+};
+
+typedef struct Function Function;
+struct Function {
+  Function *next;
+  char *name;
+  Var *params;
+  _Bool is_static;
+  _Bool is_varargs;
+
+  Node *node;
+  Var *locals;
+  int stack_size;
+  long nr_nodes; // The number of AST nodes, as an estimate of work
+};
+
+typedef struct {
+  Var *globals;
+  Function *fns;
+} Program;
+
+Node *new_cast(Node *expr, Type *ty);
+long const_expr(Token **rest, Token *tok);
+void save_scopes(void);
+void load_scopes(void);
+Program *parse(Token *tok);
+
+//
+// type.c
+//
+
+typedef enum {
+  TY_VOID,
+  TY_BOOL,
+  TY_CHAR,
+  TY_SHORT,
+  TY_INT,
+  TY_LONG,
+  TY_ENUM,
+  TY_PTR,
+  TY_FUNC,
+  TY_ARRAY,
+  TY_STRUCT,
+} TypeKind;
+
+struct Type {
+  TypeKind kind;
+  int size;           // sizeof() value
+  int align;          // alignment
+  _Bool is_unsigned;   // unsigned or signed
+  _Bool is_incomplete; // incomplete type
+  _Bool is_const;
+
+  // Pointer
+  Type *base;
+
+  // Declaration
+  Token *name;
+  Token *name_pos;
+
+  // Array
+  int array_len;
+
+  // Struct
+  Member *members;
+
+  // Function type
+  Type *return_ty;
+  Type *params;
+  _Bool is_varargs;
+  Type *next;
+};
+
+// Struct member
+struct Member {
+  Member *next;
+  Type *ty;
+  Token *tok; // for error message
+  Token *name;
+  int align;
+  int offset;
+};
+
+extern Type *ty_void;
+extern Type *ty_bool;
+
+extern Type *ty_char;
+extern Type *ty_short;
+extern Type *ty_int;
+extern Type *ty_long;
+
+extern Type *ty_uchar;
+extern Type *ty_ushort;
+extern Type *ty_uint;
+extern Type *ty_ulong;
+
+_Bool is_integer(Type *ty);
+Type *copy_type(Type *ty);
+Type *pointer_to(Type *base);
+int align_to(int n, int align);
+Type *func_type(Type *return_ty);
+Type *array_of(Type *base, int size);
+Type *enum_type(void);
+Type *struct_type(void);
+int size_of(Type *ty);
+Type *copy_type(Type *ty);
+void add_type(Node *node);
+
+//
+// codegen.c
+//
+
+extern int codegen_jobs;
+
+void codegen(Program *prog);
+
+//
+// emit.c
+//
+
+void open_output(char *path);
+void flush_output(void);
+void write_output(char *p, long len);
+void capture_output(void);
+char *take_output(void);
+void emitf(char *fmt, ...);
+void println(char *fmt, ...);
+long output_size(void);
+char *output_since(long pos);
+
+//
+// assemble.c
+//
+
+void assemble(char *input, char *path);
+
+//
+// timer.c
+//
+
+typedef enum {
+  PH_READ,       // read_file_string
+  PH_TOKENIZE,   // tokenize
+  PH_PREPROCESS, // preprocess
+  PH_KEYWORDS,   // convert_keywords
+  PH_PARSE,      // parse
+  PH_LAYOUT,     // stack offset assignment
+  PH_EMIT_DATA,  // emit_data
+  PH_EMIT_TEXT,  // emit_text
+  PH_ASSEMBLE,   // assemble
+  NR_PHASES,
+} Phase;
+
+extern _Bool time_report;
+extern _Bool time_report_json;
+
+void timer_start(Phase ph);
+void timer_stop(void);
+void timer_count(Phase ph, long n);
+void timer_count_lines(long n);
+void reset_timer(void);
+Phase current_phase(void);
+char *phase_name(Phase ph);
+void print_time_report(char *input);
+
+//
+// alloc.c
+//
+
+typedef enum {
+  AK_TOKEN,       // Token
+  AK_HIDESET,     // Hideset
+  AK_MACRO,       // Macro, MacroParam, MacroArg and CondIncl
+  AK_NODE,        // Node
+  AK_TYPE,        // Type
+  AK_MEMBER,      // Member
+  AK_VAR,         // Var
+  AK_VAR_SCOPE,   // VarScope
+  AK_TAG_SCOPE,   // TagScope
+  AK_FUNCTION,    // Function and Program
+  AK_INITIALIZER, // Initializer
+  AK_GVAR_INIT,   // GvarInitializer
+  AK_STRING,      // Names, labels and string literals
+  AK_FILE,        // Source file contents
+  NR_ALLOC_KINDS,
+} AllocKind;
+
+typedef struct Arena Arena;
+
+extern _Bool mem_report;
+
+void reset_alloc_stats(void);
+void count_alloc(AllocKind kind, long size);
+void *alloc_obj(AllocKind kind, long size);
+char *alloc_str(char *s, long len);
+void free_arena(void);
+Arena *enter_arena(void);
+void leave_arena(Arena *arena);
+void release_arena(Arena *arena);
+void print_mem_report(char *input);
+
+//
+// server.c
+//
+
+Token *find_cached_file(char *path);
+void note_input_file(char *path);
+char *read_all(int fd);
+void run_server(char *path, int *argc, char ***argv);
+int run_client(char *path, int argc, char **argv);
+
+//
+// pch.c
+//
+
+void pch_put_long(long val);
+void pch_put_str(char *s);
+void pch_put_token(Token *tok);
+void pch_put_tokens(Token *tok);
+void pch_put_type(Type *ty);
+void pch_put_var(Var *var);
+void write_pch(char *path);
+
+long pch_get_long(void);
+char *pch_get_str(void);
+char *pch_get_name(void);
+Token *pch_get_token(void);
+Token *pch_get_tokens(void);
+Type *pch_get_type(void);
+Var *pch_get_var(void);
+void read_pch(char *path);
+
+//
+// cache.c
+//
+
+extern char *cache_dir;
+extern long cache_max_size;
+extern _Bool cache_stats;
+
+char *cache_key(Token *tok, char *hdr, long hdr_len);
+_Bool cache_lookup(char *key);
+void cache_store(char *key, char *p, long len);
+void print_cache_stats(void);
+
+//
+// hashmap.c
+//
+
+typedef struct {
+  char *key;
+  int keylen;
+  void *val;
+} HashEntry;
+
+typedef struct {
+  HashEntry *buckets;
+  int capacity;
+  int used;
+
+  // Statistics
+  long lookups;
+  long probes;
+} HashMap;
+
+void *hashmap_get(HashMap *map, char *key);
+void *hashmap_get2(HashMap *map, char *key, int keylen);
+void hashmap_put(HashMap *map, char *key, void *val);
+void hashmap_put2(HashMap *map, char *key, int keylen, void *val);
+void hashmap_delete(HashMap *map, char *key);
+void hashmap_delete2(HashMap *map, char *key, int keylen);
+
+//
+// main.c
+//
+
+extern _Bool preprocess_only;
+extern _Bool output_object;
+extern char *include_pch;
+// This file implements the compile server.
+//
+// `punyc --server <socket>` starts a daemon that accepts compile
+// requests from `punyc --client <socket> <args>...`. A client sends
+// its working directory, its arguments and its standard file
+// descriptors, and the server compiles the request just as if punyc
+// had been started with these arguments in that directory. The
+// exit status is sent back to the client.
+//
+// The compiler keeps its state in global variables and calls exit()
+// on errors, so each request is still compiled in a worker process
+// forked from the server. What the server keeps across requests is
+// a cache of files that have already been read and tokenized.
+// Workers inherit the cache when they are forked, and report back
+// the files they read so that the server can add them to the cache
+// once a request has succeeded. A cached file is used only while
+// its device, inode, size and modification time are unchanged.
+//
+// The server never waits for a worker: it goes back to accepting
+// connections right after forking, and watches the workers' report
+// pipes with poll(). When a pipe is closed, the worker has exited,
+// and its status is sent back to the client. Reported files are
+// tokenized into the cache only while there's nothing else to do.
+
+
+enum { MAX_REQUEST = 1 << 20 };
+
+typedef struct {
+  FileId id;
+  Token *tok;
+  Arena *arena;  // Where the tokens are allocated
+  char *input;   // The contents of the file
+  long mapping;  // See read_file_string()
+} CachedFile;
+
+// Ancillary data for passing the standard file descriptors to the
+// server. This has the same layout as struct cmsghdr followed by
+// three ints, padded to CMSG_SPACE. The padding has room for one
+// more descriptor, which a bad request may send.
+typedef struct {
+  long len;
+  int level;
+  int type;
+  int fds[4];
+} FdMessage;
+
+// A request being compiled by a worker process
+typedef struct Job Job;
+struct Job {
+  Job *next;
+  int pid;
+  int conn;    // The connection to the client
+  int fd;      // The pipe from which files read by the worker come
+  char *files; // Files reported so far, one per line
+  long len;
+  long cap;
+};
+
+// A file to be added to the cache
+typedef struct PendingFile PendingFile;
+struct PendingFile {
+  PendingFile *next;
+  char *path;
+};
+
+// Maps absolute paths to CachedFiles.
+static HashMap file_cache;
+
+// Requests being compiled
+static Job *jobs;
+
+// Files to be added to the cache when the server is idle
+static PendingFile *pending;
+static PendingFile *pending_last;
+
+// In a worker, the pipe to report files read back to the server.
+static int report_fd = -1;
+
+// In a worker, the current directory to make paths absolute.
+static char *cwd;
+
+// Returns an absolute path for a given path.
+static char *absolute_path(char *path) {
+  if (path[0] == '/')
+    return path;
+
+  if (!cwd) {
+    char buf[4096];
+    if (!getcwd(buf, sizeof(buf)))
+      return path;
+    cwd = alloc_str(buf, strlen(buf));
+  }
+
+  char *buf = alloc_obj(AK_STRING, strlen(cwd) + strlen(path) + 2);
+  sprintf(buf, "%s/%s", cwd, path);
+  return buf;
+}
+
+static _Bool is_fresh(CachedFile *cf, FileId *id) {
+  return !memcmp(&cf->id, id, sizeof(FileId));
+}
+
+// Returns the cached tokens of a given file, or 0 if the file
+// is not in the cache or has been modified since it was cached.
+Token *find_cached_file(char *path) {
+  if (file_cache.used == 0 || !strcmp(path, "-"))
+    return 0;
+
+  CachedFile *cf = hashmap_get(&file_cache, absolute_path(path));
+  if (!cf)
+    return 0;
+
+  FileId id;
+  if (!get_file_id(path, &id) || !is_fresh(cf, &id))
+    return 0;
+  return cf->tok;
+}
+
+// In a worker, tells the server that a given file has been read.
+void note_input_file(char *path) {
+  if (report_fd < 0 || !strcmp(path, "-"))
+    return;
+
+  char *abs = absolute_path(path);
+  int len = strlen(abs);
+  char *buf = alloc_obj(AK_STRING, len + 1);
+  memcpy(buf, abs, len);
+  buf[len] = '\n';
+
+  // A write to a pipe up to PIPE_BUF bytes is atomic, so lines
+  // written by parallel workers don't get mixed.
+  write(report_fd, buf, len + 1);
+}
+
+// Releases a cached file which has been replaced or removed. Workers
+// forked before have their own copies, so they are not affected.
+static void free_cached_file(CachedFile *cf) {
+  free(cf->tok->file->lines);
+  release_arena(cf->arena);
+  free_file_string(cf->input, cf->mapping);
+  free(cf);
+}
+
+// Reads and tokenizes a given file into the cache unless it's
+// already cached. A stale entry is replaced, and its memory is
+// released so that the server doesn't grow as files are edited.
+static void cache_file(char *path) {
+  CachedFile *old = hashmap_get(&file_cache, path);
+
+  FileId id;
+  if (!get_file_id(path, &id)) {
+    if (old) {
+      hashmap_delete(&file_cache, path);
+      free_cached_file(old);
+    }
+    return;
+  }
+
+  if (old && is_fresh(old, &id))
+    return;
+
+  CachedFile *cf = calloc(1, sizeof(CachedFile));
+  cf->input = read_file_string(path, &cf->mapping);
+  if (!cf->input) {
+    free(cf);
+    return;
+  }
+
+  cf->id = id;
+  cf->arena = enter_arena();
+  cf->tok = tokenize(path, 0, cf->input);
+  leave_arena(cf->arena);
+
+  if (old) {
+    hashmap_put(&file_cache, path, cf);
+    free_cached_file(old);
+  } else {
+    hashmap_put(&file_cache, alloc_str(path, strlen(path)), cf);
+  }
+}
+
+static _Bool send_all(int fd, char *p, long len) {
+  while (len > 0) {
+    long n = send(fd, p, len, MSG_NOSIGNAL);
+    if (n < 0 && *__errno_location() == EINTR)
+      continue;
+    if (n <= 0)
+      return 0;
+    p += n;
+    len -= n;
+  }
+  return 1;
+}
+
+static _Bool recv_all(int fd, char *p, long len) {
+  while (len > 0) {
+    long n = read(fd, p, len);
+    if (n < 0 && *__errno_location() == EINTR)
+      continue;
+    if (n <= 0)
+      return 0;
+    p += n;
+    len -= n;
+  }
+  return 1;
+}
+
+// Reads everything from a given file descriptor until EOF.
+char *read_all(int fd) {
+  long cap = 4096;
+  long len = 0;
+  char *buf = malloc(cap);
+
+  for (;;) {
+    if (len == cap - 1) {
+      cap *= 2;
+      buf = realloc(buf, cap);
+    }
+    long n = read(fd, buf + len, cap - 1 - len);
+    if (n < 0 && *__errno_location() == EINTR)
+      continue;
+    if (n <= 0)
+      break;
+    len += n;
+  }
+  buf[len] = '\0';
+  return buf;
+}
+
+// Returns the length of an FdMessage with `n` descriptors, just
+// like CMSG_LEN.
+static long fd_message_len(int n) {
+  return sizeof(long) + sizeof(int) * 2 + sizeof(int) * n;
+}
+
+// Receives a request, which consists of the payload length, the
+// standard file descriptors, and a payload of null-terminated
+// strings: the working directory followed by arguments.
+static char *recv_request(int conn, int *fds, int *len) {
+  struct iovec iov = {};
+  iov.iov_base = len;
+  iov.iov_len = sizeof(int);
+
+  FdMessage fdmsg = {};
+  struct msghdr msg = {};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = &fdmsg;
+  msg.msg_controllen = sizeof(fdmsg);
+
+  long n = recvmsg(conn, &msg, 0);
+
+  // Find out how many descriptors have arrived, so that they are
+  // closed if the request turns out to be bad.
+  int nfds = 0;
+  if (n >= 0 && msg.msg_controllen >= fd_message_len(0) &&
+      fdmsg.level == SOL_SOCKET && fdmsg.type == SCM_RIGHTS &&
+      fdmsg.len > fd_message_len(0))
+    nfds = (fdmsg.len - fd_message_len(0)) / sizeof(int);
+  if (nfds > 4)
+    nfds = 4;
+
+  char *buf = 0;
+  if (n == sizeof(int) && !(msg.msg_flags & MSG_CTRUNC) &&
+      fdmsg.len == fd_message_len(3) && 0 < *len && *len <= MAX_REQUEST) {
+    buf = calloc(1, *len + 1);
+    if (recv_all(conn, buf, *len)) {
+      for (int i = 0; i < 3; i++)
+        fds[i] = fdmsg.fds[i];
+      return buf;
+    }
+  }
+
+  for (int i = 0; i < nfds; i++)
+    close(fdmsg.fds[i]);
+  free(buf);
+  return 0;
+}
+
+// Sets up the current process as a worker for a given request.
+static void start_worker(char *buf, int len, int *fds, int *argc,
+                         char ***argv) {
+  for (int i = 0; i < 3; i++) {
+    dup2(fds[i], i);
+    close(fds[i]);
+  }
+
+  char **args = calloc(len + 2, sizeof(char *));
+  int n = 0;
+  args[n++] = "punyc";
+  for (char *p = buf + strlen(buf) + 1; p < buf + len; p += strlen(p) + 1)
+    args[n++] = p;
+
+  if (chdir(buf))
+    error("cannot change directory to %s: %s", buf, strerror(*__errno_location()));
+
+  *argc = n;
+  *argv = args;
+}
+
+// Accepts a connection and starts a worker for it. Returns 1 in
+// the forked worker process which should go on to compile the
+// request.
+static _Bool start_job(int sock, int *argc, char ***argv) {
+  int conn = accept(sock, 0, 0);
+  if (conn < 0) {
+    if (*__errno_location() == EINTR)
+      return 0;
+    error("accept failed: %s", strerror(*__errno_location()));
+  }
+
+  int fds[3];
+  int len;
+  char *buf = recv_request(conn, fds, &len);
+  if (!buf) {
+    close(conn);
+    return 0;
+  }
+
+  int pfd[2];
+  if (pipe(pfd))
+    error("pipe failed: %s", strerror(*__errno_location()));
+
+  int pid = fork();
+  if (pid < 0)
+    error("fork failed: %s", strerror(*__errno_location()));
+
+  if (pid == 0) {
+    close(sock);
+    for (Job *job = jobs; job; job = job->next) {
+      close(job->conn);
+      close(job->fd);
+    }
+    close(conn);
+    close(pfd[0]);
+    report_fd = pfd[1];
+    reset_timer();
+    reset_alloc_stats();
+    start_worker(buf, len, fds, argc, argv);
+    return 1;
+  }
+
+  close(pfd[1]);
+  for (int i = 0; i < 3; i++)
+    close(fds[i]);
+  free(buf);
+
+  Job *job = calloc(1, sizeof(Job));
+  job->pid = pid;
+  job->conn = conn;
+  job->fd = pfd[0];
+  job->cap = 4096;
+  job->files = malloc(job->cap);
+  job->next = jobs;
+  jobs = job;
+  return 0;
+}
+
+// Adds files listed in a given string to the pending list.
+static void add_pending_files(char *files) {
+  for (char *p = files; *p;) {
+    char *end = strchr(p, '\n');
+    if (!end)
+      break;
+
+    PendingFile *pf = malloc(sizeof(PendingFile));
+    pf->next = 0;
+    pf->path = strndup(p, end - p);
+    if (pending_last)
+      pending_last->next = pf;
+    else
+      pending = pf;
+    pending_last = pf;
+    p = end + 1;
+  }
+}
+
+// Reads what a worker has reported. Once the worker has exited,
+// sends its exit status to the client and returns 1.
+static _Bool read_job(Job *job) {
+  if (job->len == job->cap - 1) {
+    job->cap *= 2;
+    job->files = realloc(job->files, job->cap);
+  }
+
+  long n = read(job->fd, job->files + job->len, job->cap - 1 - job->len);
+  if (n < 0 && *__errno_location() == EINTR)
+    return 0;
+  if (n > 0) {
+    job->len += n;
+    return 0;
+  }
+  close(job->fd);
+
+  int status;
+  while (waitpid(job->pid, &status, 0) < 0)
+    if (*__errno_location() != EINTR)
+      error("waitpid failed: %s", strerror(*__errno_location()));
+
+  int code = status ? 1 : 0;
+  send_all(job->conn, (char *)&code, sizeof(code));
+  close(job->conn);
+
+  // Files of a failed compilation may not even tokenize,
+  // so we cache files only for successful ones.
+  job->files[job->len] = '\0';
+  if (code == 0)
+    add_pending_files(job->files);
+  free(job->files);
+  return 1;
+}
+
+// Adds the first pending file to the cache.
+static void cache_pending_file(void) {
+  PendingFile *pf = pending;
+  pending = pf->next;
+  if (!pending)
+    pending_last = 0;
+  cache_file(pf->path);
+  free(pf->path);
+  free(pf);
+}
+
+// Runs the compile server. This function returns only in a worker
+// process, with `argc` and `argv` set to the arguments of a request.
+void run_server(char *path, int *argc, char ***argv) {
+  struct sockaddr_un addr = {};
+  if (strlen(path) >= sizeof(addr.sun_path))
+    error("socket path too long: %s", path);
+  addr.sun_family = AF_UNIX;
+  strcpy(addr.sun_path, path);
+
+  int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (sock < 0)
+    error("socket failed: %s", strerror(*__errno_location()));
+
+  unlink(path);
+  if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)))
+    error("cannot bind to %s: %s", path, strerror(*__errno_location()));
+  if (listen(sock, 64))
+    error("listen failed: %s", strerror(*__errno_location()));
+
+  for (;;) {
+    // Watch the socket and the report pipes of all workers.
+    int nfds = 1;
+    for (Job *job = jobs; job; job = job->next)
+      nfds++;
+
+    struct pollfd *fds = calloc(nfds, sizeof(struct pollfd));
+    fds[0].fd = sock;
+    fds[0].events = POLLIN;
+    int i = 1;
+    for (Job *job = jobs; job; job = job->next) {
+      fds[i].fd = job->fd;
+      fds[i].events = POLLIN;
+      i++;
+    }
+
+    // Don't block if there are files to cache.
+    int n = poll(fds, nfds, pending ? 0 : -1);
+    if (n < 0 && *__errno_location() != EINTR)
+      error("poll failed: %s", strerror(*__errno_location()));
+
+    if (n == 0) {
+      cache_pending_file();
+      free(fds);
+      continue;
+    }
+
+    // Finish requests whose workers have exited.
+    Job **jp = &jobs;
+    for (i = 1; i < nfds; i++) {
+      Job *job = *jp;
+      if (n > 0 && fds[i].revents && read_job(job)) {
+        *jp = job->next;
+        free(job);
+        continue;
+      }
+      jp = &job->next;
+    }
+
+    _Bool is_new = n > 0 && (fds[0].revents & POLLIN);
+    free(fds);
+    if (is_new && start_job(sock, argc, argv))
+      return;
+  }
+}
+
+// Sends a compile request to the server and returns the exit status
+// of the compilation. argv[0] is ignored.
+int run_client(char *path, int argc, char **argv) {
+  struct sockaddr_un addr = {};
+  if (strlen(path) >= sizeof(addr.sun_path))
+    error("socket path too long: %s", path);
+  addr.sun_family = AF_UNIX;
+  strcpy(addr.sun_path, path);
+
+  int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (sock < 0)
+    error("socket failed: %s", strerror(*__errno_location()));
+  if (connect(sock, (struct sockaddr *)&addr, sizeof(addr)))
+    error("cannot connect to %s: %s", path, strerror(*__errno_location()));
+
+  // Build a payload.
+  char dir[4096];
+  if (!getcwd(dir, sizeof(dir)))
+    error("getcwd failed: %s", strerror(*__errno_location()));
+
+  int len = strlen(dir) + 1;
+  for (int i = 1; i < argc; i++)
+    len += strlen(argv[i]) + 1;
+
+  char *buf = malloc(len);
+  char *p = buf;
+  strcpy(p, dir);
+  p += strlen(dir) + 1;
+  for (int i = 1; i < argc; i++) {
+    strcpy(p, argv[i]);
+    p += strlen(argv[i]) + 1;
+  }
+
+  // Send the payload length along with our stdin, stdout and stderr.
+  struct iovec iov = {};
+  iov.iov_base = &len;
+  iov.iov_len = sizeof(int);
+
+  FdMessage fdmsg = {};
+  fdmsg.len = fd_message_len(3);
+  fdmsg.level = SOL_SOCKET;
+  fdmsg.type = SCM_RIGHTS;
+  for (int i = 0; i < 3; i++)
+    fdmsg.fds[i] = i;
+
+  struct msghdr msg = {};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = &fdmsg;
+  msg.msg_controllen = sizeof(fdmsg);
+
+  if (sendmsg(sock, &msg, 0) != sizeof(int) || !send_all(sock, buf, len))
+    error("cannot send a request to %s: %s", path, strerror(*__errno_location()));
+
+  int code;
+  if (!recv_all(sock, (char *)&code, sizeof(code)))
+    error("%s: connection closed by server", path);
+  close(sock);
+  return code;
+}
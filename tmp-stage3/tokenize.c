@@ -0,0 +1,1585 @@
+typedef struct FILE FILE;
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+typedef struct {
+  int gp_offset;
+  int fp_offset;
+  void *overflow_arg_area;
+  void *reg_save_area;
+} va_list[1];
+
+struct timespec {
+  long tv_sec;
+  long tv_nsec;
+};
+
+struct rusage {
+  long ru_utime[2];
+  long ru_stime[2];
+  long ru_maxrss;
+  long ru_reserved[13];
+};
+
+struct stat {
+  unsigned long st_dev;
+  unsigned long st_ino;
+  unsigned long st_nlink;
+  unsigned int st_mode;
+  unsigned int st_uid;
+  unsigned int st_gid;
+  int __pad0;
+  unsigned long st_rdev;
+  long st_size;
+  long st_blksize;
+  long st_blocks;
+  struct timespec st_atim;
+  struct timespec st_mtim;
+  struct timespec st_ctim;
+  long __reserved[3];
+};
+
+struct sockaddr_un {
+  unsigned short sun_family;
+  char sun_path[108];
+};
+
+struct iovec {
+  void *iov_base;
+  long iov_len;
+};
+
+struct msghdr {
+  void *msg_name;
+  int msg_namelen;
+  struct iovec *msg_iov;
+  long msg_iovlen;
+  void *msg_control;
+  long msg_controllen;
+  int msg_flags;
+};
+
+struct pollfd {
+  int fd;
+  short events;
+  short revents;
+};
+
+typedef struct DIR DIR;
+
+struct dirent {
+  unsigned long d_ino;
+  long d_off;
+  unsigned short d_reclen;
+  unsigned char d_type;
+  char d_name[256];
+};
+
+enum { EINTR = 4 };
+enum { O_RDONLY = 0, O_WRONLY = 1, O_RDWR = 2, O_CREAT = 64, O_TRUNC = 512 };
+enum { LOCK_EX = 2 };
+enum { S_IFMT = 61440, S_IFREG = 32768 };
+enum { PROT_READ = 1, PROT_WRITE = 2 };
+enum { MAP_PRIVATE = 2, MAP_FIXED = 16, MAP_ANONYMOUS = 32, MAP_POPULATE = 32768 };
+enum { _SC_PAGESIZE = 30 };
+enum { AF_UNIX = 1, SOCK_STREAM = 1, SOL_SOCKET = 1, SCM_RIGHTS = 1 };
+enum { MSG_CTRUNC = 8, MSG_NOSIGNAL = 16384 };
+enum { POLLIN = 1 };
+enum { RUSAGE_SELF = 0 };
+enum { CLOCK_MONOTONIC = 1, CLOCK_PROCESS_CPUTIME_ID = 2 };
+
+void *malloc(long size);
+void *calloc(long nmemb, long size);
+void *realloc(void *buf, long size);
+int *__errno_location();
+char *strerror(int errnum);
+FILE *fopen(char *pathname, char *mode);
+long fread(void *ptr, long size, long nmemb, FILE *stream);
+int fclose(FILE *fp);
+int feof(FILE *stream);
+static void assert() {}
+int strcmp(char *s1, char *s2);
+int strncasecmp(char *s1, char *s2);
+int printf(char *fmt, ...);
+int sprintf(char *buf, char *fmt, ...);
+int fprintf(FILE *fp, char *fmt, ...);
+int vfprintf(FILE *fp, char *fmt, va_list ap);
+long strlen(char *p);
+int strncmp(char *p, char *q);
+void *memvpy(char *dst, char *src, long n);
+char *strndup(char *p, long n);
+int isspace(int c);
+int ispunct(int c);
+int isdigit(int c);
+char *strstr(char *haystack, char *needle);
+static void va_end(va_list ap) {}
+long strtoul(char *nptr, char **endptr, int base);
+char *strncpy(char *dest, char *src, long n);
+void exit(int code);
+int atoi(char *nptr);
+char *strrchr(char *s, int c);
+int fflush(FILE *stream);
+int fork(void);
+int waitpid(int pid, int *status, int options);
+int unlink(char *pathname);
+int creat(char *pathname, int mode);
+void *memset(void *s, int c, long n);
+int memcmp(void *s1, void *s2, long n);
+char *strchr(char *s, int c);
+long strtol(char *nptr, char **endptr, int base);
+long write(int fd, void *buf, long count);
+void *memcpy(void *dst, void *src, long n);
+int clock_gettime(int clockid, struct timespec *tp);
+int getrusage(int who, struct rusage *usage);
+void free(void *ptr);
+char *strcpy(char *dest, char *src);
+long read(int fd, void *buf, long count);
+int close(int fd);
+int dup2(int oldfd, int newfd);
+int pipe(int *pipefd);
+int chdir(char *path);
+char *getcwd(char *buf, long size);
+char *realpath(char *path, char *resolved_path);
+int stat(char *path, struct stat *buf);
+int socket(int domain, int type, int protocol);
+int bind(int fd, struct sockaddr *addr, int len);
+int listen(int fd, int backlog);
+int accept(int fd, struct sockaddr *addr, int *len);
+int connect(int fd, struct sockaddr *addr, int len);
+long send(int fd, void *buf, long len, int flags);
+long sendmsg(int fd, struct msghdr *msg, int flags);
+long recvmsg(int fd, struct msghdr *msg, int flags);
+int poll(struct pollfd *fds, long nfds, int timeout);
+int open(char *path, int flags, ...);
+int fstat(int fd, struct stat *buf);
+int flock(int fd, int op);
+void *mmap(void *addr, long len, int prot, int flags, int fd, long off);
+int munmap(void *addr, long len);
+long sysconf(int name);
+long pread(int fd, void *buf, long count, long offset);
+long pwrite(int fd, void *buf, long count, long offset);
+int ftruncate(int fd, long length);
+int getpid(void);
+int rename(char *oldpath, char *newpath);
+int mkdir(char *path, int mode);
+int utime(char *path, void *times);
+DIR *opendir(char *name);
+struct dirent *readdir(DIR *dirp);
+int closedir(DIR *dirp);
+
+typedef struct Type Type;
+typedef struct Member Member;
+typedef struct GvarInitializer GvarInitializer;
+
+//
+// tokenize.c
+//
+
+// Token
+typedef enum {
+  TK_RESERVED, // Keyworeds or punctuators
+  TK_IDENT,    // Identifiers
+  TK_STR,      // String literals
+  TK_NUM,      // Integer literals
+  TK_EOF,      // End-of-file markers
+} TokenKind;
+
+// Keywords, preprocessor directive names and punctuators are given
+// an ID by the tokenizer, so that they can be compared as integers.
+// The order must match `token_names` in tokenize.c.
+typedef enum {
+  ID_NONE,
+
+  // Keywords
+  KW_RETURN, KW_IF, KW_ELSE, KW_FOR, KW_WHILE, KW_INT, KW_SIZEOF,
+  KW_CHAR, KW_STRUCT, KW_UNION, KW_SHORT, KW_LONG, KW_VOID,
+  KW_TYPEDEF, KW_BOOL, KW_ENUM, KW_STATIC, KW_BREAK, KW_CONTINUE,
+  KW_GOTO, KW_SWITCH, KW_CASE, KW_DEFAULT, KW_EXTERN, KW_ALIGNOF,
+  KW_ALIGNAS, KW_DO, KW_SIGNED, KW_UNSIGNED, KW_CONST, KW_VOLATILE,
+
+  // Preprocessor directive names other than keywords
+  PP_INCLUDE, PP_DEFINE, PP_UNDEF, PP_IFDEF, PP_IFNDEF, PP_ELIF,
+  PP_ENDIF, PP_PRAGMA, PP_DEFINED, PP_ONCE,
+
+  // Punctuators, longest first
+  P_ELLIPSIS, P_SHL_ASSIGN, P_SHR_ASSIGN,
+  P_EQ, P_NE, P_LE, P_GE, P_ARROW, P_ADD_ASSIGN, P_SUB_ASSIGN,
+  P_MUL_ASSIGN, P_DIV_ASSIGN, P_INC, P_DEC, P_MOD_ASSIGN,
+  P_AND_ASSIGN, P_OR_ASSIGN, P_XOR_ASSIGN, P_LOGAND, P_LOGOR, P_SHL,
+  P_SHR, P_HASHHASH,
+  P_LPAREN, P_RPAREN, P_LBRACE, P_RBRACE, P_LBRACKET, P_RBRACKET,
+  P_SEMICOLON, P_COMMA, P_DOT, P_ASSIGN, P_LT, P_GT, P_PLUS, P_MINUS,
+  P_STAR, P_SLASH, P_PERCENT, P_AMP, P_PIPE, P_CARET, P_TILDE, P_NOT,
+  P_QUESTION, P_COLON, P_HASH,
+
+  NR_TOKEN_IDS,
+} TokenId;
+
+// Set of macro names, represented as a Patricia tree keyed by
+// name_id(). There is only one Hideset object for each set, so equal
+// sets are the same pointer. A Hideset must not be modified.
+typedef struct Hideset Hideset;
+struct Hideset {
+  Hideset *left;       // 0 if leaf
+  Hideset *right;
+  long prefix;         // Bits below `bit` shared by all names, or leaf's ID
+  long bit;            // The bit that tells which child has a name
+  char *name;          // If leaf, the name
+  unsigned long bloom; // One bit for each name, for quick rejection
+};
+
+// Source file of tokens. Tokens read from the same input share one.
+typedef struct {
+  char *name;     // Input filename
+  char *contents; // Entire input string
+  int file_no;    // File number for .loc directive
+
+  // Offsets of the beginnings of lines, recorded as the file is
+  // tokenized
+  int *lines;
+  int nr_lines;
+  int lines_cap;
+} File;
+
+// Payload of a literal token
+typedef struct {
+  long val;       // If TK_NUM, its value
+  Type *ty;       // If TK_NUM, its type
+  char *contents; // If TK_STR, its contents, not null-terminated
+  int cont_len;   // If TK_STR, its length excluding terminating '\0'
+} Literal;
+
+// Token type
+//
+// Fields the preprocessor and the parser look at for every token
+// come first. Those used only for some tokens or only for error
+// messages and debug info are kept out of line.
+typedef struct Token Token;
+struct Token {
+  TokenKind kind;   // Token kind
+  TokenId id;       // Keyword or punctuator ID, or ID_NONE
+  Token *next;      // Next token
+  char *loc;        // Token location
+  int len;          // Token length
+  int lineno;       // Line number
+  char *name;       // If identifier or keyword, its interned spelling
+  Hideset *hideset; // For macro expension
+  _Bool at_bol;      // True if this token is at beginning of line
+  _Bool has_space;   // True if this token follows a space character
+  _Bool is_raw;      // True if this token is read from a file
+  _Bool is_shared;   // True if this token is in a file's cached tokens
+
+  File *file;       // Source file
+  Literal *lit;     // If TK_NUM or TK_STR, its value
+};
+
+extern _Bool fast_lexer;
+
+void error(char *fmt, ...);
+void error_tok(Token *tok, char *fmt, ...);
+void warn_tok(Token *tok, char *fmt, ...);
+Token *skip(Token *tok, TokenId id);
+_Bool consume(Token **rest, Token *tok, TokenId id);
+char *intern(char *s, int len);
+long name_id(char *name);
+File *new_file(char *name, int file_no, char *contents);
+int get_column(Token *tok);
+void convert_keywords(Token *tok);
+Token *next_token(Token *tok);
+void free_token(Token *tok);
+Token *tokenize_lazy(char *filename, int file_no, char *p, Token *cont);
+Token *tokenize_cached(Token *src, char *filename, int file_no,
+                       Token *cont);
+Token *tokenize(char *filename, int file_no, char *p);
+
+//
+// preprocess.c
+//
+
+extern _Bool pp_report;
+
+// Identifies a file and its version.
+typedef struct {
+  unsigned long dev;
+  unsigned long ino;
+  long size;
+  long mtime_sec;
+  long mtime_nsec;
+} FileId;
+
+_Bool get_file_id(char *path, FileId *id);
+char *read_file_string(char *path, long *mapping);
+void free_file_string(char *buf, long mapping);
+int add_file(char *path);
+void save_file_ids(void);
+char *load_file_ids(void);
+void save_macros(void);
+void load_macros(void);
+Token *read_file(char *path);
+void print_pp_report(char *input);
+
+//
+// parse.c
+//
+
+// Variable
+typedef struct Var Var;
+struct Var {
+  Var *next;
+  char *name;    // Variable name
+  Type *ty;      // Type
+  Token *tok;    // representative token
+  _Bool is_local; // local or global
+  int align;     // alignment
+
+  _Bool is_static;
+  GvarInitializer *initializer;
+
+  // Local variable
+  int offset;
+
+  // Gloval variable
+  char *contents;
+  int cont_len;
+};
+
+// AST node
+typedef enum {
+  ND_ADD,       // +
+  ND_SUB,       // -
+  ND_MUL,       // *
+  ND_DIV,       // /
+  ND_MOD,       // %
+  ND_BITAND,    // &
+  ND_BITOR,     // |
+  ND_BITXOR,    // ^
+  ND_SHL,       // <<
+  ND_SHR,       // >>
+  ND_EQ,        // ==
+  ND_NE,        // !=
+  ND_LT,        // <
+  ND_LE,        // <=
+  ND_ASSIGN,    // =
+  ND_COND,      // ?:
+  ND_COMMA,     // ,
+  ND_MEMBER,    // . (struct member access)
+  ND_ADDR,      // unary &
+  ND_DEREF,     // unary *
+  ND_NOT,       // !
+  ND_BITNOT,    // ~
+  ND_LOGAND,    // &&
+  ND_LOGOR,     // ||
+  ND_RETURN,    // "return"
+  ND_IF,        // "if"
+  ND_FOR,       // "for" or "while"
+  ND_DO,        // "do"
+  ND_SWITCH,    // "switch"
+  ND_CASE,      // "case"
+  ND_BLOCK,     // { ... }
+  ND_BREAK,     // "break"
+  ND_CONTINUE,  // "continue"
+  ND_GOTO,      // "goto"
+  ND_LABEL,     // Labeled statement
+  ND_FUNCALL,   // Function call
+  ND_EXPR_STMT, // Expression statement
+  ND_STMT_EXPR, // Statement expression
+  ND_VAR,       // Variable
+  ND_NUM,       // Integer
+  ND_CAST,      // Type cast
+} NodeKind;
+
+// AST node type
+typedef struct Node Node;
+struct Node {
+  NodeKind kind; // Node kind
+  Node *next;    // Next node
+  Type *ty;      // Type, e.g. int or pointer to tin
+  Token *tok;    // Representative token
+
+  Node *lhs;     // Left-hand side
+  Node *rhs;     // Right-hand side
+
+  // "if" or "for" statement
+  Node *cond;
+  Node *then;
+  Node *els;
+  Node *init;
+  Node *inc;
+
+  // Assignment
+  _Bool is_init;
+
+  // Blcok or statement expression
+  Node *body;
+
+  // Struct member access
+  Member *member;
+
+  // Function call
+  char *funcname;
+  Type *func_ty;
+  Node *args;
+
+  // Goto or labeled statement
+  char *label_name;
+
+  // Switch-cases
+  Node *case_next;
+  Node *default_case;
+  int case_label;
+  int case_end_label;
+
+  // Variable
+  Var *var;
+
+  // Integer literal
+  long val;
+};
+
+// Global variable initializer. Global variables can be initialized
+// either by a constatnt expression or a pointer to another global
+// bariable with an addend.
+struct GvarInitializer {
+  GvarInitializer *next;
+  int offset;
+
+  // Scalar value
+  int sz;
+  long val;
+
+  // Byte string of `sz` bytes
+  char *bytes;
+
+  // Reference to another global variable
+  char *label;
+  long addend;
+};
+
+typedef struct Function Function;
+struct Function {
+  Function *next;
+  char *name;
+  Var *params;
+  _Bool is_static;
+  _Bool is_varargs;
+
+  Node *node;
+  Var *locals;
+  int stack_size;
+  long nr_nodes; // The number of AST nodes, as an estimate of work
+};
+
+typedef struct {
+  Var *globals;
+  Function *fns;
+} Program;
+
+Node *new_cast(Node *expr, Type *ty);
+long const_expr(Token **rest, Token *tok);
+void save_scopes(void);
+void load_scopes(void);
+Program *parse(Token *tok);
+
+//
+// type.c
+//
+
+typedef enum {
+  TY_VOID,
+  TY_BOOL,
+  TY_CHAR,
+  TY_SHORT,
+  TY_INT,
+  TY_LONG,
+  TY_ENUM,
+  TY_PTR,
+  TY_FUNC,
+  TY_ARRAY,
+  TY_STRUCT,
+} TypeKind;
+
+struct Type {
+  TypeKind kind;
+  int size;           // sizeof() value
+  int align;          // alignment
+  _Bool is_unsigned;   // unsigned or signed
+  _Bool is_incomplete; // incomplete type
+  _Bool is_const;
+
+  // Pointer
+  Type *base;
+
+  // Declaration
+  Token *name;
+  Token *name_pos;
+
+  // Array
+  int array_len;
+
+  // Struct
+  Member *members;
+
+  // Function type
+  Type *return_ty;
+  Type *params;
+  _Bool is_varargs;
+  Type *next;
+};
+
+// Struct member
+struct Member {
+  Member *next;
+  Type *ty;
+  Token *tok; // for error message
+  Token *name;
+  int align;
+  int offset;
+};
+
+extern Type *ty_void;
+extern Type *ty_bool;
+
+extern Type *ty_char;
+extern Type *ty_short;
+extern Type *ty_int;
+extern Type *ty_long;
+
+extern Type *ty_uchar;
+extern Type *ty_ushort;
+extern Type *ty_uint;
+extern Type *ty_ulong;
+
+_Bool is_integer(Type *ty);
+Type *copy_type(Type *ty);
+Type *pointer_to(Type *base);
+int align_to(int n, int align);
+Type *func_type(Type *return_ty);
+Type *array_of(Type *base, int size);
+Type *enum_type(void);
+Type *struct_type(void);
+int size_of(Type *ty);
+Type *copy_type(Type *ty);
+void add_type(Node *node);
+
+//
+// codegen.c
+//
+
+extern int codegen_jobs;
+
+void codegen(Program *prog);
+
+//
+// emit.c
+//
+
+void open_output(char *path);
+void flush_output(void);
+void write_output(char *p, long len);
+void capture_output(void);
+char *take_output(void);
+void emitf(char *fmt, ...);
+void println(char *fmt, ...);
+long output_size(void);
+char *output_since(long pos);
+
+//
+// assemble.c
+//
+
+void assemble(char *input, char *path);
+
+//
+// timer.c
+//
+
+typedef enum {
+  PH_READ,       // read_file_string
+  PH_TOKENIZE,   // tokenize
+  PH_PREPROCESS, // preprocess
+  PH_KEYWORDS,   // convert_keywords
+  PH_PARSE,      // parse
+  PH_LAYOUT,     // stack offset assignment
+  PH_EMIT_DATA,  // emit_data
+  PH_EMIT_TEXT,  // emit_text
+  PH_ASSEMBLE,   // assemble
+  NR_PHASES,
+} Phase;
+
+extern _Bool time_report;
+extern _Bool time_report_json;
+
+void timer_start(Phase ph);
+void timer_stop(void);
+void timer_count(Phase ph, long n);
+void timer_count_lines(long n);
+void reset_timer(void);
+Phase current_phase(void);
+char *phase_name(Phase ph);
+void print_time_report(char *input);
+
+//
+// alloc.c
+//
+
+typedef enum {
+  AK_TOKEN,       // Token
+  AK_HIDESET,     // Hideset
+  AK_MACRO,       // Macro, MacroParam, MacroArg and CondIncl
+  AK_NODE,        // Node
+  AK_TYPE,        // Type
+  AK_MEMBER,      // Member
+  AK_VAR,         // Var
+  AK_VAR_SCOPE,   // VarScope
+  AK_TAG_SCOPE,   // TagScope
+  AK_FUNCTION,    // Function and Program
+  AK_INITIALIZER, // Initializer
+  AK_GVAR_INIT,   // GvarInitializer
+  AK_STRING,      // Names, labels and string literals
+  AK_FILE,        // Source file contents
+  NR_ALLOC_KINDS,
+} AllocKind;
+
+typedef struct Arena Arena;
+
+extern _Bool mem_report;
+
+void reset_alloc_stats(void);
+void count_alloc(AllocKind kind, long size);
+void *alloc_obj(AllocKind kind, long size);
+char *alloc_str(char *s, long len);
+void free_arena(void);
+Arena *enter_arena(void);
+void leave_arena(Arena *arena);
+void release_arena(Arena *arena);
+void print_mem_report(char *input);
+
+//
+// server.c
+//
+
+Token *find_cached_file(char *path);
+void note_input_file(char *path);
+char *read_all(int fd);
+void run_server(char *path, int *argc, char ***argv);
+int run_client(char *path, int argc, char **argv);
+
+//
+// pch.c
+//
+
+void pch_put_long(long val);
+void pch_put_str(char *s);
+void pch_put_token(Token *tok);
+void pch_put_tokens(Token *tok);
+void pch_put_type(Type *ty);
+void pch_put_var(Var *var);
+void write_pch(char *path);
+
+long pch_get_long(void);
+char *pch_get_str(void);
+char *pch_get_name(void);
+Token *pch_get_token(void);
+Token *pch_get_tokens(void);
+Type *pch_get_type(void);
+Var *pch_get_var(void);
+void read_pch(char *path);
+
+//
+// cache.c
+//
+
+extern char *cache_dir;
+extern long cache_max_size;
+extern _Bool cache_stats;
+
+char *cache_key(Token *tok, char *hdr, long hdr_len);
+_Bool cache_lookup(char *key);
+void cache_store(char *key, char *p, long len);
+void print_cache_stats(void);
+
+//
+// hashmap.c
+//
+
+typedef struct {
+  char *key;
+  int keylen;
+  void *val;
+} HashEntry;
+
+typedef struct {
+  HashEntry *buckets;
+  int capacity;
+  int used;
+
+  // Statistics
+  long lookups;
+  long probes;
+} HashMap;
+
+void *hashmap_get(HashMap *map, char *key);
+void *hashmap_get2(HashMap *map, char *key, int keylen);
+void hashmap_put(HashMap *map, char *key, void *val);
+void hashmap_put2(HashMap *map, char *key, int keylen, void *val);
+void hashmap_delete(HashMap *map, char *key);
+void hashmap_delete2(HashMap *map, char *key, int keylen);
+
+//
+// main.c
+//
+
+extern _Bool preprocess_only;
+extern _Bool output_object;
+extern char *include_pch;
+// This file implements the tokenizer.
+//
+// A file is tokenized lazily: tokenize_lazy() reads only the first
+// few tokens, and the rest are read on demand when the preprocessor
+// asks for the token following the last one read so far by calling
+// next_token(). Tokens that the preprocessor consumes without
+// passing them on, such as directives and skipped conditional
+// blocks, are given back with free_token() and reused for tokens
+// read later, so that they don't pile up while a large file is
+// being preprocessed.
+//
+// A file that has been tokenized before can be read again with
+// tokenize_cached(), which copies its tokens on demand in the same
+// way instead of reading characters.
+
+
+// The number of tokens read at once by next_token().
+enum { LEX_BATCH = 64 };
+
+// If 0, the input is scanned one character at a time, which is
+// the reference behavior the fast paths must match.
+_Bool fast_lexer = 1;
+
+// What scan() looks for
+typedef enum {
+  SCAN_IDENT, // The end of an identifier
+  SCAN_BLANK, // The end of a run of spaces and tabs
+  SCAN_EOL,   // A newline
+  SCAN_STR,   // A double-quote or a backslash
+} ScanKind;
+
+// A lexer reads tokens from a single input string.
+typedef struct Lexer Lexer;
+struct Lexer {
+  Lexer *next;
+  File *file;
+  char *p;      // Current position
+  _Bool lazy;    // True if tokens are read on demand
+
+  // Position info for the next token
+  int lineno;
+  _Bool at_bol;
+  _Bool has_space;
+
+  Token *last;  // The last token read so far
+  Token *cont;  // The token that follows the end of input
+
+  Token *src;   // If not 0, the tokens to copy instead of reading p
+};
+
+// Lexers of lazily tokenized files that have not reached the end.
+static Lexer *lexers;
+
+// Recycled tokens
+static Token *free_tokens;
+
+// Input file
+static File *current_file;
+
+// True if the input is lazily tokenized
+static _Bool current_lazy;
+
+// Reports an error and exit.
+void error(char *fmt, ...) {
+  va_list ap;
+  __builtin_va_start(ap, fmt);
+  vfprintf(stderr, fmt, ap);
+  fprintf(stderr, "\n");
+  exit(1);
+}
+
+// Returns the beginning of the line containing `loc`, which is
+// line `lineno` of a given file.
+static char *line_start(File *file, int lineno, char *loc) {
+  if (0 < lineno && lineno <= file->nr_lines)
+    return file->contents + file->lines[lineno - 1];
+
+  // Files restored from a precompiled header have no line table.
+  while (file->contents < loc && loc[-1] != '\n')
+    loc--;
+  return loc;
+}
+
+// Returns the line number of `loc` in a given file.
+static int find_line(File *file, char *loc) {
+  long off = loc - file->contents;
+  int lo = 0;
+  int hi = file->nr_lines;
+  while (hi - lo > 1) {
+    int mid = (lo + hi) / 2;
+    if (file->lines[mid] <= off)
+      lo = mid;
+    else
+      hi = mid;
+  }
+  return lo + 1;
+}
+
+// Returns the 1-based column of a given token.
+int get_column(Token *tok) {
+  long col = tok->loc - line_start(tok->file, tok->lineno, tok->loc);
+  return col + 1;
+}
+
+// Reports an error message in the following format.
+//
+// foo.c:10 x = y + 1;
+//              ^ <error message here>
+static void verror_at(File *file, int lineno, char *loc, char *fmt,
+                      va_list ap) {
+  char *line = line_start(file, lineno, loc);
+  char *end = loc;
+  while (*end && *end != '\n')
+    end++;
+
+  // Print out the line.
+  int indent = fprintf(stderr, "%s:%d ", file->name, lineno);
+  fprintf(stderr, "%.*s\n", (int)(end - line), line);
+
+  // Show the error maessage.
+  int pos = loc - line + indent;
+
+  fprintf(stderr, "%*s", pos, ""); // print pos spaces.
+  fprintf(stderr, "^ ");
+  vfprintf(stderr, fmt, ap);
+  fprintf(stderr, "\n");
+}
+
+static void error_at(char *loc, char *fmt, ...) {
+  va_list ap;
+  __builtin_va_start(ap, fmt);
+  verror_at(current_file, find_line(current_file, loc), loc, fmt, ap);
+  exit(1);
+}
+
+void error_tok(Token *tok, char *fmt, ...) {
+  va_list ap;
+  __builtin_va_start(ap, fmt);
+  verror_at(tok->file, tok->lineno, tok->loc, fmt, ap);
+  exit(1);
+}
+
+void warn_tok(Token *tok, char *fmt, ...) {
+  va_list ap;
+  __builtin_va_start(ap, fmt);
+  verror_at(tok->file, tok->lineno, tok->loc, fmt, ap);
+}
+
+// Spellings of keywords, directive names and punctuators, indexed
+// by TokenId.
+static char *token_names[] = {
+  "",
+  "return", "if", "else", "for", "while", "int", "sizeof", "char",
+  "struct", "union", "short", "long", "void", "typedef", "_Bool",
+  "enum", "static", "break", "continue", "goto", "switch", "case",
+  "default", "extern", "alignof", "_Alignas", "do", "signed",
+  "unsigned", "const", "volatile",
+  "include", "define", "undef", "ifdef", "ifndef", "elif", "endif",
+  "pragma", "defined", "once",
+  "...", "<<=", ">>=",
+  "==", "!=", "<=", ">=", "->", "+=", "-=", "*=", "/=", "++", "--",
+  "%=", "&=", "|=", "^=", "&&", "||", "<<", ">>", "##",
+  "(", ")", "{", "}", "[", "]", ";", ",", ".", "=", "<", ">", "+", "-",
+  "*", "/", "%", "&", "|", "^", "~", "!", "?", ":", "#",
+};
+
+// Maps keywords and directive names to their IDs.
+static HashMap word_ids;
+
+// Interned identifiers
+static HashMap names;
+
+// For each character, IDs of punctuators starting with it, longest
+// first and terminated by ID_NONE. No more than four punctuators
+// share the same first character.
+static TokenId punct_ids[256][5];
+
+static void init_token_ids(void) {
+  for (int i = KW_RETURN; i < P_ELLIPSIS; i++)
+    hashmap_put(&word_ids, token_names[i], (void *)(long)i);
+
+  for (int i = P_ELLIPSIS; i < NR_TOKEN_IDS; i++) {
+    TokenId *ids = punct_ids[(unsigned char)token_names[i][0]];
+    while (*ids)
+      ids++;
+    *ids = i;
+  }
+}
+
+// Returns the canonical copy of a given identifier. Identifiers are
+// interned when they are read, so that names can be compared by
+// pointer instead of by contents.
+//
+// Interned names are numbered in the order they are first seen.
+// The number is stored right before the name. Names are not
+// allocated from the arena, as they must outlive objects in an
+// arena that is released early (see enter_arena()).
+char *intern(char *s, int len) {
+  char *name = hashmap_get2(&names, s, len);
+  if (name)
+    return name;
+
+  count_alloc(AK_STRING, sizeof(long) + len + 1);
+  long *p = calloc(1, sizeof(long) + len + 1);
+  *p = names.used;
+  name = (char *)(p + 1);
+  memcpy(name, s, len);
+  hashmap_put2(&names, name, len, name);
+  return name;
+}
+
+// Returns the number of an interned name.
+long name_id(char *name) {
+  return ((long *)name)[-1];
+}
+
+// Ensure that the current token is `id`.
+Token *skip(Token *tok, TokenId id) {
+  if (tok->id != id)
+    error_tok(tok, "expected '%s'", token_names[id]);
+  return tok->next;
+}
+
+// Consumes the current token if it is `id`.
+_Bool consume(Token **rest, Token *tok, TokenId id) {
+  if (tok->id == id) {
+    *rest = tok->next;
+    return 1;
+  }
+  *rest = tok;
+  return 0;
+}
+
+// Create a new token and add it as the next token of `cur`.
+static Token *new_token(TokenKind kind, Token *cur, char *str, int len) {
+  Token *tok;
+  if (free_tokens) {
+    tok = free_tokens;
+    free_tokens = tok->next;
+    memset(tok, 0, sizeof(Token));
+  } else {
+    tok = alloc_obj(AK_TOKEN, sizeof(Token));
+  }
+
+  tok->kind = kind;
+  tok->loc = str;
+  tok->len = len;
+  tok->file = current_file;
+  tok->is_raw = current_lazy;
+  cur->next = tok;
+  return tok;
+}
+
+// Gives back a token that is no longer referenced from anywhere so
+// that it can be reused. Only tokens read from a file are recycled;
+// others may be shared (e.g. a macro body), so they are left alone.
+void free_token(Token *tok) {
+  if (!tok->is_raw)
+    return;
+  tok->next = free_tokens;
+  free_tokens = tok;
+}
+
+// The fast paths below scan the input a word (8 bytes) at a time,
+// testing all bytes of a word at once with the same bit tricks as
+// strlen(). In a mask computed from a word, the high bit of each
+// byte is set if the byte satisfies a condition. Words are always
+// read from aligned addresses, so a read never crosses a page
+// boundary beyond the terminating '\0', at which every scan stops.
+//
+// For a byte b with the high bit clear, b + (128 - lo) has the
+// high bit set iff b >= lo, and no carry goes to the next byte.
+// Likewise, b ^ c is zero iff b == c.
+
+// Returns a mask of bytes at which a scan of a given kind stops.
+static unsigned long stop_bytes(ScanKind kind, unsigned long x) {
+  unsigned long ones = 0x0101010101010101;
+  unsigned long highs = 0x8080808080808080;
+  unsigned long x7 = x & ~highs;
+
+  switch (kind) {
+  case SCAN_IDENT: {
+    // [0-9A-Za-z_]
+    unsigned long m = (x7 + ones * (128 - '0')) & ~(x7 + ones * (127 - '9'));
+    m |= (x7 + ones * (128 - 'A')) & ~(x7 + ones * (127 - 'Z'));
+    m |= (x7 + ones * (128 - 'a')) & ~(x7 + ones * (127 - 'z'));
+    unsigned long t = x ^ (ones * '_');
+    m |= ~(((t & ~highs) + ~highs) | t);
+    return ~(m & ~x) & highs;
+  }
+  case SCAN_BLANK: {
+    // Neither ' ' nor '\t'
+    unsigned long t1 = x ^ (ones * ' ');
+    unsigned long t2 = x ^ (ones * '\t');
+    return (((t1 & ~highs) + ~highs) | t1) &
+           (((t2 & ~highs) + ~highs) | t2) & highs;
+  }
+  case SCAN_EOL: {
+    // '\n' or '\0'
+    unsigned long t = x ^ (ones * '\n');
+    return ~((((t & ~highs) + ~highs) | t) & ((x7 + ~highs) | x)) & highs;
+  }
+  case SCAN_STR: {
+    // '"', '\\' or '\0'
+    unsigned long t1 = x ^ (ones * '"');
+    unsigned long t2 = x ^ (ones * '\\');
+    return ~((((t1 & ~highs) + ~highs) | t1) &
+             (((t2 & ~highs) + ~highs) | t2) & ((x7 + ~highs) | x)) & highs;
+  }
+  }
+  return 0;
+}
+
+// Returns the first byte at or after `p` at which a scan of a given
+// kind stops.
+static char *scan(char *p, ScanKind kind) {
+  // Read the word containing `p` and ignore the bytes before `p`.
+  long off = (long)p & 7;
+  unsigned long *w = (unsigned long *)(p - off);
+  unsigned long mask = stop_bytes(kind, *w) & (~0UL << (off * 8));
+
+  while (!mask)
+    mask = stop_bytes(kind, *++w);
+
+  // Bytes are in little-endian order. Isolate the lowest byte in
+  // the mask, 1 << (8 * i), and multiply to move i to the top byte.
+  unsigned long low = (mask & -mask) >> 7;
+  return (char *)w + ((low * 0x0001020304050607) >> 56);
+}
+
+static _Bool startswith(char *p, char *q) {
+  return strncmp(p, q, strlen(q)) == 0;
+}
+
+static _Bool is_alpha(char c) {
+  return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || c == '_';
+}
+
+static _Bool is_alnum(char c) {
+  return is_alpha(c) || ('0' <= c && c <= '9');
+}
+
+static _Bool is_hex(char c) {
+  return ('0' <= c && c <= '9') ||
+         ('a' <= c && c <= 'f') ||
+         ('A' <= c && c <= 'F');
+}
+
+static int from_hex(char c) {
+  if ('0' <= c && c <= '9')
+    return c - '0';
+  if ('a' <= c && c <= 'f')
+    return c - 'a' + 10;
+  return c - 'A' + 10;
+}
+
+void convert_keywords(Token *tok) {
+  timer_start(PH_KEYWORDS);
+  long n = 0;
+  for (Token *t = tok; t->kind != TK_EOF; t = t->next) {
+    if (t->kind == TK_IDENT && KW_RETURN <= t->id && t->id <= KW_VOLATILE)
+      t->kind = TK_RESERVED;
+    n++;
+  }
+  timer_count(PH_PREPROCESS, n);
+  timer_count(PH_KEYWORDS, n);
+  timer_stop();
+}
+
+static char *read_escaped_char(char *result, char *p) {
+  switch (*p) {
+    case 'x': {
+      // Read a hexadecimal number.
+      p++;
+      if (!is_hex(*p))
+        error_at(p, "invalid hex escape sequece");
+
+      int r = 0;
+      for (; is_hex(*p); p++) {
+        r = (r << 4) | from_hex(*p);
+        if (r > 255)
+          error_at(p, "hex escape sequence out of range");
+      }
+      *result = r;
+      return p;
+    }
+    case '0': case'1': case'2': case'3':
+    case '4': case'5': case'6': case'7': {
+      // Read an octal number.
+      int r = *p++ - '0';
+      if ('0' <= *p && *p <= '7') {
+        r = (r << 3) | (*p++ - '0');
+        if ('0' <= *p && *p <= '7')
+          r = (r << 3) | (*p++ - '0');
+      }
+      *result = r;
+      return p;
+    }
+    case 'a': *result = '\a'; return p + 1;
+    case 'b': *result = '\b'; return p + 1;
+    case 't': *result = '\t'; return p + 1;
+    case 'n': *result = '\n'; return p + 1;
+    case 'v': *result = '\v'; return p + 1;
+    case 'f': *result = '\f'; return p + 1;
+    case 'r': *result = '\r'; return p + 1;
+    case 'e': *result = 27; return p + 1;
+    default: *result = *p; return p + 1;
+  }
+}
+
+static Token *read_string_leteral(Token *cur, char *start) {
+  char *p = start + 1;
+  char *end = p;
+  _Bool has_escape = 0;
+
+  // Find the closing double-quote.
+  if (fast_lexer) {
+    for (end = scan(end, SCAN_STR); *end != '"'; end = scan(end, SCAN_STR)) {
+      if (*end == '\0')
+        error_at(start, "unclosed string literal");
+      has_escape = 1;
+      end += 2;
+    }
+  } else {
+    for (; *end != '"'; end++) {
+      if (*end == '\0')
+        error_at(start, "unclosed string literal");
+      if (*end == '\\') {
+        has_escape = 1;
+        end++;
+      }
+    }
+  }
+
+  Token *tok = new_token(TK_STR, cur, start, end - start + 1);
+  tok->lit = alloc_obj(AK_TOKEN, sizeof(Literal));
+
+  // Most string literals have no escape sequences. Their contents
+  // are the same as in the source, so we don't copy them.
+  if (!has_escape) {
+    tok->lit->contents = p;
+    tok->lit->cont_len = end - p;
+    return tok;
+  }
+
+  // Decode escape sequences. The result is never longer than the
+  // literal in the source.
+  char *buf = alloc_obj(AK_STRING, end - p + 1);
+  int len = 0;
+
+  while (p < end) {
+    if (*p == '\\') {
+      char c;
+      p = read_escaped_char(&c, p + 1);
+      buf[len++] = c;
+    } else {
+      buf[len++] = *p++;
+    }
+  }
+
+  tok->lit->contents = buf;
+  tok->lit->cont_len = len;
+  return tok;
+}
+
+static Token *read_char_literal(Token *cur, char *start) {
+  char *p = start + 1;
+  if (*p == '\0')
+    error_at(start, "unclosed char literal");
+
+  char c;
+  if (*p == '\\')
+    p = read_escaped_char(&c, p + 1);
+  else
+    c = *p++;
+
+  if (*p != '\'')
+    error_at(p, "char literal too long");
+  p++;
+
+  Token *tok = new_token(TK_NUM, cur, start, p - start);
+  tok->lit = alloc_obj(AK_TOKEN, sizeof(Literal));
+  tok->lit->val = c;
+  return tok;
+}
+
+static Token *read_int_literal(Token *cur, char *start) {
+  char *p = start;
+
+  // Read a binary, octal, decimal or hexadecimal number.
+  int base = 10;
+  if (!strncasecmp(p, "0x", 2) && is_alnum(p[2])) {
+    p += 2;
+    base = 16;
+  } else if (!strncasecmp(p, "0b", 2) && is_alnum(p[2])) {
+    p += 2;
+    base = 2;
+  } else if (*p == '0') {
+    base = 8;
+  }
+
+  long val = strtoul(p, &p, base);
+  Type *ty = ty_int;
+
+  // Read U, L or LL prefixes or infer a type.
+  if (startswith(p, "LLU") || startswith(p, "LLu") ||
+      startswith(p, "llU") || startswith(p, "llu") ||
+      startswith(p, "ULL") || startswith(p, "Ull") ||
+      startswith(p, "uLL") || startswith(p, "ull")) {
+    p += 3;
+    ty = ty_ulong;
+  } else if (startswith(p, "LL") || startswith(p, "ll")) {
+    p += 2;
+    ty = ty_long;
+  } else if (!strncasecmp(p, "lu", 2) || !strncasecmp(p, "ul", 2)) {
+    p += 2;
+    ty = ty_ulong;
+  } else if (*p == 'L' || *p == 'l') {
+    p++;
+    ty = ty_long;
+  } else if (*p == 'U' || *p == 'u') {
+    p++;
+    ty = ty_uint;
+  } else if (val >> 63) {
+    ty = ty_ulong;
+  } else if (val >> 31) {
+    ty = ty_long;
+  }
+
+  if (is_alnum(*p))
+    error_at(p, "invalid digit");
+
+  Token *tok = new_token(TK_NUM, cur, start, p - start);
+  tok->lit = alloc_obj(AK_TOKEN, sizeof(Literal));
+  tok->lit->val = val;
+  tok->lit->ty = ty;
+  return tok;
+}
+
+// Records that a new line begins at `p`.
+static void add_line(File *file, char *p) {
+  if (file->nr_lines == file->lines_cap) {
+    file->lines_cap = file->lines_cap ? file->lines_cap * 2 : 16;
+    file->lines = realloc(file->lines, sizeof(int) * file->lines_cap);
+  }
+  file->lines[file->nr_lines++] = p - file->contents;
+}
+
+// Updates the position info for a newline character at `p`.
+static void new_line(Lexer *lx, char *p) {
+  add_line(lx->file, p + 1);
+  lx->lineno++;
+  lx->at_bol = 1;
+}
+
+// Same as skip_chars(), but finds newlines a word at a time and
+// looks only at the characters following the last one, as the
+// characters before it don't affect the flags.
+static void skip_chars_fast(Lexer *lx, char *end) {
+  char *p = lx->p;
+  for (char *q = scan(p, SCAN_EOL); q < end; q = scan(p, SCAN_EOL)) {
+    new_line(lx, q);
+    p = q + 1;
+  }
+
+  char *q = end;
+  while (p < q && isspace(q[-1]))
+    q--;
+
+  if (p < q) {
+    lx->at_bol = 0;
+    lx->has_space = (q < end);
+  } else if (p < end) {
+    lx->has_space = 1;
+  }
+  lx->p = end;
+}
+
+// Updates the position info for characters that don't form a
+// token, i.e. whitespace and comments, up to `end`.
+static void skip_chars(Lexer *lx, char *end) {
+  if (fast_lexer) {
+    skip_chars_fast(lx, end);
+    return;
+  }
+
+  for (; lx->p < end; lx->p++) {
+    if (*lx->p == '\n') {
+      new_line(lx, lx->p);
+    } else if (isspace(*lx->p)) {
+      lx->has_space = 1;
+    } else {
+      lx->at_bol = 0;
+      lx->has_space = 0;
+    }
+  }
+}
+
+// Reads a token and returns it as the next token of `cur`. Returns
+// 0 at the end of input.
+static Token *read_token(Lexer *lx, Token *cur) {
+  char *p = lx->p;
+
+  for (;;) {
+    // Skip newline character.
+    if (*p == '\n') {
+      new_line(lx, p);
+      p++;
+      continue;
+    }
+
+    // Skip whitespace characters.
+    if (isspace(*p)) {
+      lx->has_space = 1;
+      p = fast_lexer ? scan(p + 1, SCAN_BLANK) : p + 1;
+      continue;
+    }
+
+    // Skip line comments.
+    if (startswith(p, "//")) {
+      lx->p = p;
+      if (fast_lexer) {
+        p = scan(p + 2, SCAN_EOL);
+      } else {
+        p += 2;
+        while (*p && *p != '\n')
+          p++;
+      }
+      skip_chars(lx, p);
+      continue;
+    }
+
+    // Skip block comments.
+    if (startswith(p, "/*")) {
+      char *q = strstr(p + 2, "*/");
+      if (!q)
+        error_at(p, "unclosed block comment.");
+      lx->p = p;
+      skip_chars(lx, q + 2);
+      p = q + 2;
+      continue;
+    }
+
+    break;
+  }
+
+  lx->p = p;
+  if (!*p)
+    return 0;
+
+  if (*p == '"') {
+    // String literal
+    cur = read_string_leteral(cur, p);
+  } else if (*p == '\'') {
+    // Character literal
+    cur = read_char_literal(cur, p);
+  } else if (is_alpha(*p)) {
+    // Identifier
+    char *q = p + 1;
+    if (fast_lexer)
+      q = scan(q, SCAN_IDENT);
+    else
+      while (is_alnum(*q))
+        q++;
+    cur = new_token(TK_IDENT, cur, p, q - p);
+    cur->id = (long)hashmap_get2(&word_ids, p, q - p);
+    cur->name = intern(p, q - p);
+  } else if (ispunct(*p)) {
+    // Punctuators
+    TokenId *ids = punct_ids[(unsigned char)*p];
+    for (; *ids; ids++)
+      if (startswith(p, token_names[*ids]))
+        break;
+    int len = *ids ? strlen(token_names[*ids]) : 1;
+    cur = new_token(TK_RESERVED, cur, p, len);
+    cur->id = *ids;
+  } else if (isdigit(*p)) {
+    // Integer literal
+    cur = read_int_literal(cur, p);
+  } else {
+    error_at(p, "invalid token");
+  }
+
+  cur->lineno = lx->lineno;
+  cur->at_bol = lx->at_bol;
+  cur->has_space = lx->has_space;
+  lx->at_bol = 0;
+  lx->has_space = 0;
+  lx->p = p + cur->len;
+
+  // A string literal may contain newlines.
+  if (cur->kind == TK_STR) {
+    for (char *q = p; q < lx->p; q++) {
+      if (*q == '\n') {
+        add_line(lx->file, q + 1);
+        lx->lineno++;
+      }
+    }
+  }
+  return cur;
+}
+
+// Copies the next token of `lx->src`. Returns 0 at the end, where
+// the lexer takes over the position of the EOF token.
+static Token *copy_src_token(Lexer *lx, Token *cur) {
+  Token *src = lx->src;
+  if (src->kind == TK_EOF) {
+    lx->p = src->loc;
+    lx->lineno = src->lineno;
+    lx->at_bol = src->at_bol;
+    lx->has_space = src->has_space;
+    return 0;
+  }
+
+  Token *tok = new_token(src->kind, cur, src->loc, src->len);
+  *tok = *src;
+  tok->next = 0;
+  tok->file = lx->file;
+  tok->is_raw = 1;
+  tok->is_shared = 0;
+  lx->src = src->next;
+  return tok;
+}
+
+// Reads up to `n` more tokens from a given lexer. At the end of
+// input, the last token is followed by an EOF token, or by
+// `lx->cont` if it is set.
+static void lex(Lexer *lx, int n) {
+  timer_start(PH_TOKENIZE);
+  current_file = lx->file;
+  current_lazy = lx->lazy;
+
+  Token *cur = lx->last;
+  long cnt = 0;
+  for (; cnt < n; cnt++) {
+    Token *tok = lx->src ? copy_src_token(lx, cur) : read_token(lx, cur);
+    if (!tok)
+      break;
+    cur = tok;
+  }
+  lx->last = cur;
+  timer_count(PH_TOKENIZE, cnt);
+
+  if (cnt == n) {
+    timer_stop();
+    return;
+  }
+
+  if (lx->cont) {
+    cur->next = lx->cont;
+  } else {
+    Token *eof = new_token(TK_EOF, cur, lx->p, 0);
+    eof->lineno = lx->lineno;
+    eof->at_bol = lx->at_bol;
+    eof->has_space = lx->has_space;
+    lx->last = eof;
+  }
+  timer_count_lines(lx->lineno - 1);
+
+  // This lexer is done.
+  for (Lexer **lp = &lexers; *lp; lp = &(*lp)->next) {
+    if (*lp == lx) {
+      *lp = lx->next;
+      break;
+    }
+  }
+  timer_stop();
+}
+
+File *new_file(char *name, int file_no, char *contents) {
+  File *file = alloc_obj(AK_FILE, sizeof(File));
+  file->name = name;
+  file->file_no = file_no;
+  file->contents = contents;
+  return file;
+}
+
+static Lexer *new_lexer(char *filename, int file_no, char *p) {
+  if (!word_ids.capacity)
+    init_token_ids();
+
+  Lexer *lx = alloc_obj(AK_FILE, sizeof(Lexer));
+  lx->file = new_file(filename, file_no, p);
+  lx->p = p;
+  lx->lineno = 1;
+  lx->at_bol = 1;
+  add_line(lx->file, p);
+  return lx;
+}
+
+// Returns the token following `tok`. If `tok` is the last token
+// read so far from a lazily tokenized file, more tokens are read.
+Token *next_token(Token *tok) {
+  if (tok->next)
+    return tok->next;
+
+  for (Lexer *lx = lexers; lx; lx = lx->next) {
+    if (lx->last == tok) {
+      lex(lx, LEX_BATCH);
+      break;
+    }
+  }
+  return tok->next;
+}
+
+// Starts tokenizing a given string lazily and returns the first
+// token. The last token is followed by `cont` if it's not 0,
+// or by an EOF token otherwise.
+Token *tokenize_lazy(char *filename, int file_no, char *p, Token *cont) {
+  Lexer *lx = new_lexer(filename, file_no, p);
+  lx->lazy = 1;
+  lx->cont = cont;
+  lx->next = lexers;
+  lexers = lx;
+
+  Token head = {};
+  lx->last = &head;
+  lex(lx, LEX_BATCH);
+  return head.next;
+}
+
+// Starts reading a copy of tokens returned by tokenize() earlier,
+// just like tokenize_lazy() would read the same file again.
+Token *tokenize_cached(Token *src, char *filename, int file_no,
+                       Token *cont) {
+  Lexer *lx = alloc_obj(AK_FILE, sizeof(Lexer));
+  lx->file = alloc_obj(AK_FILE, sizeof(File));
+  *lx->file = *src->file;
+  lx->file->name = filename;
+  lx->file->file_no = file_no;
+  lx->src = src;
+  lx->lazy = 1;
+  lx->cont = cont;
+  lx->next = lexers;
+  lexers = lx;
+
+  Token head = {};
+  lx->last = &head;
+  lex(lx, LEX_BATCH);
+  return head.next;
+}
+
+// Tokenize a given string and returns new tokens.
+Token *tokenize(char *filename, int file_no, char *p) {
+  Lexer *lx = new_lexer(filename, file_no, p);
+  Token head = {};
+  lx->last = &head;
+  lex(lx, 2147483647);
+  return head.next;
+}
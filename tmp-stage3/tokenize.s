@@ -0,0 +1,12134 @@
+.file 1 "tokenize.c"
+.intel_syntax noprefix
+.bss
+.align 4
+punct_ids:
+  .zero 5120
+.align 8
+names:
+  .zero 32
+.align 8
+word_ids:
+  .zero 32
+.align 1
+current_lazy:
+  .zero 1
+.align 8
+current_file:
+  .zero 8
+.align 8
+free_tokens:
+  .zero 8
+.align 8
+lexers:
+  .zero 8
+.data
+.align 1
+.L.data.213:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 116
+  .byte 111
+  .byte 107
+  .byte 101
+  .byte 110
+  .zero 1
+.align 1
+.L.data.212:
+  .byte 117
+  .byte 110
+  .byte 99
+  .byte 108
+  .byte 111
+  .byte 115
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 98
+  .byte 108
+  .byte 111
+  .byte 99
+  .byte 107
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 109
+  .byte 109
+  .byte 101
+  .byte 110
+  .byte 116
+  .byte 46
+  .zero 1
+.align 1
+.L.data.211:
+  .byte 42
+  .byte 47
+  .zero 1
+.align 1
+.L.data.210:
+  .byte 47
+  .byte 42
+  .zero 1
+.align 1
+.L.data.209:
+  .byte 47
+  .byte 47
+  .zero 1
+.align 1
+.L.data.208:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 100
+  .byte 105
+  .byte 103
+  .byte 105
+  .byte 116
+  .zero 1
+.align 1
+.L.data.207:
+  .byte 117
+  .byte 108
+  .zero 1
+.align 1
+.L.data.206:
+  .byte 108
+  .byte 117
+  .zero 1
+.align 1
+.L.data.205:
+  .byte 108
+  .byte 108
+  .zero 1
+.align 1
+.L.data.204:
+  .byte 76
+  .byte 76
+  .zero 1
+.align 1
+.L.data.203:
+  .byte 117
+  .byte 108
+  .byte 108
+  .zero 1
+.align 1
+.L.data.202:
+  .byte 117
+  .byte 76
+  .byte 76
+  .zero 1
+.align 1
+.L.data.201:
+  .byte 85
+  .byte 108
+  .byte 108
+  .zero 1
+.align 1
+.L.data.200:
+  .byte 85
+  .byte 76
+  .byte 76
+  .zero 1
+.align 1
+.L.data.199:
+  .byte 108
+  .byte 108
+  .byte 117
+  .zero 1
+.align 1
+.L.data.198:
+  .byte 108
+  .byte 108
+  .byte 85
+  .zero 1
+.align 1
+.L.data.197:
+  .byte 76
+  .byte 76
+  .byte 117
+  .zero 1
+.align 1
+.L.data.196:
+  .byte 76
+  .byte 76
+  .byte 85
+  .zero 1
+.align 1
+.L.data.195:
+  .byte 48
+  .byte 98
+  .zero 1
+.align 1
+.L.data.194:
+  .byte 48
+  .byte 120
+  .zero 1
+.align 1
+.L.data.193:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 108
+  .byte 105
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 97
+  .byte 108
+  .byte 32
+  .byte 116
+  .byte 111
+  .byte 111
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .zero 1
+.align 1
+.L.data.192:
+  .byte 117
+  .byte 110
+  .byte 99
+  .byte 108
+  .byte 111
+  .byte 115
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 108
+  .byte 105
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 97
+  .byte 108
+  .zero 1
+.align 1
+.L.data.191:
+  .byte 117
+  .byte 110
+  .byte 99
+  .byte 108
+  .byte 111
+  .byte 115
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 105
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 108
+  .byte 105
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 97
+  .byte 108
+  .zero 1
+.align 1
+.L.data.190:
+  .byte 117
+  .byte 110
+  .byte 99
+  .byte 108
+  .byte 111
+  .byte 115
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 105
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 108
+  .byte 105
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 97
+  .byte 108
+  .zero 1
+.align 1
+.L.data.189:
+  .byte 104
+  .byte 101
+  .byte 120
+  .byte 32
+  .byte 101
+  .byte 115
+  .byte 99
+  .byte 97
+  .byte 112
+  .byte 101
+  .byte 32
+  .byte 115
+  .byte 101
+  .byte 113
+  .byte 117
+  .byte 101
+  .byte 110
+  .byte 99
+  .byte 101
+  .byte 32
+  .byte 111
+  .byte 117
+  .byte 116
+  .byte 32
+  .byte 111
+  .byte 102
+  .byte 32
+  .byte 114
+  .byte 97
+  .byte 110
+  .byte 103
+  .byte 101
+  .zero 1
+.align 1
+.L.data.188:
+  .byte 105
+  .byte 110
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 100
+  .byte 32
+  .byte 104
+  .byte 101
+  .byte 120
+  .byte 32
+  .byte 101
+  .byte 115
+  .byte 99
+  .byte 97
+  .byte 112
+  .byte 101
+  .byte 32
+  .byte 115
+  .byte 101
+  .byte 113
+  .byte 117
+  .byte 101
+  .byte 99
+  .byte 101
+  .zero 1
+.align 1
+.L.data.187:
+  .byte 101
+  .byte 120
+  .byte 112
+  .byte 101
+  .byte 99
+  .byte 116
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 39
+  .byte 37
+  .byte 115
+  .byte 39
+  .zero 1
+.align 1
+.L.data.186:
+  .byte 35
+  .zero 1
+.align 1
+.L.data.185:
+  .byte 58
+  .zero 1
+.align 1
+.L.data.184:
+  .byte 63
+  .zero 1
+.align 1
+.L.data.183:
+  .byte 33
+  .zero 1
+.align 1
+.L.data.182:
+  .byte 126
+  .zero 1
+.align 1
+.L.data.181:
+  .byte 94
+  .zero 1
+.align 1
+.L.data.180:
+  .byte 124
+  .zero 1
+.align 1
+.L.data.179:
+  .byte 38
+  .zero 1
+.align 1
+.L.data.178:
+  .byte 37
+  .zero 1
+.align 1
+.L.data.177:
+  .byte 47
+  .zero 1
+.align 1
+.L.data.176:
+  .byte 42
+  .zero 1
+.align 1
+.L.data.175:
+  .byte 45
+  .zero 1
+.align 1
+.L.data.174:
+  .byte 43
+  .zero 1
+.align 1
+.L.data.173:
+  .byte 62
+  .zero 1
+.align 1
+.L.data.172:
+  .byte 60
+  .zero 1
+.align 1
+.L.data.171:
+  .byte 61
+  .zero 1
+.align 1
+.L.data.170:
+  .byte 46
+  .zero 1
+.align 1
+.L.data.169:
+  .byte 44
+  .zero 1
+.align 1
+.L.data.168:
+  .byte 59
+  .zero 1
+.align 1
+.L.data.167:
+  .byte 93
+  .zero 1
+.align 1
+.L.data.166:
+  .byte 91
+  .zero 1
+.align 1
+.L.data.165:
+  .byte 125
+  .zero 1
+.align 1
+.L.data.164:
+  .byte 123
+  .zero 1
+.align 1
+.L.data.163:
+  .byte 41
+  .zero 1
+.align 1
+.L.data.162:
+  .byte 40
+  .zero 1
+.align 1
+.L.data.161:
+  .byte 35
+  .byte 35
+  .zero 1
+.align 1
+.L.data.160:
+  .byte 62
+  .byte 62
+  .zero 1
+.align 1
+.L.data.159:
+  .byte 60
+  .byte 60
+  .zero 1
+.align 1
+.L.data.158:
+  .byte 124
+  .byte 124
+  .zero 1
+.align 1
+.L.data.157:
+  .byte 38
+  .byte 38
+  .zero 1
+.align 1
+.L.data.156:
+  .byte 94
+  .byte 61
+  .zero 1
+.align 1
+.L.data.155:
+  .byte 124
+  .byte 61
+  .zero 1
+.align 1
+.L.data.154:
+  .byte 38
+  .byte 61
+  .zero 1
+.align 1
+.L.data.153:
+  .byte 37
+  .byte 61
+  .zero 1
+.align 1
+.L.data.152:
+  .byte 45
+  .byte 45
+  .zero 1
+.align 1
+.L.data.151:
+  .byte 43
+  .byte 43
+  .zero 1
+.align 1
+.L.data.150:
+  .byte 47
+  .byte 61
+  .zero 1
+.align 1
+.L.data.149:
+  .byte 42
+  .byte 61
+  .zero 1
+.align 1
+.L.data.148:
+  .byte 45
+  .byte 61
+  .zero 1
+.align 1
+.L.data.147:
+  .byte 43
+  .byte 61
+  .zero 1
+.align 1
+.L.data.146:
+  .byte 45
+  .byte 62
+  .zero 1
+.align 1
+.L.data.145:
+  .byte 62
+  .byte 61
+  .zero 1
+.align 1
+.L.data.144:
+  .byte 60
+  .byte 61
+  .zero 1
+.align 1
+.L.data.143:
+  .byte 33
+  .byte 61
+  .zero 1
+.align 1
+.L.data.142:
+  .byte 61
+  .byte 61
+  .zero 1
+.align 1
+.L.data.141:
+  .byte 62
+  .byte 62
+  .byte 61
+  .zero 1
+.align 1
+.L.data.140:
+  .byte 60
+  .byte 60
+  .byte 61
+  .zero 1
+.align 1
+.L.data.139:
+  .byte 46
+  .byte 46
+  .byte 46
+  .zero 1
+.align 1
+.L.data.138:
+  .byte 111
+  .byte 110
+  .byte 99
+  .byte 101
+  .zero 1
+.align 1
+.L.data.137:
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 105
+  .byte 110
+  .byte 101
+  .byte 100
+  .zero 1
+.align 1
+.L.data.136:
+  .byte 112
+  .byte 114
+  .byte 97
+  .byte 103
+  .byte 109
+  .byte 97
+  .zero 1
+.align 1
+.L.data.135:
+  .byte 101
+  .byte 110
+  .byte 100
+  .byte 105
+  .byte 102
+  .zero 1
+.align 1
+.L.data.134:
+  .byte 101
+  .byte 108
+  .byte 105
+  .byte 102
+  .zero 1
+.align 1
+.L.data.133:
+  .byte 105
+  .byte 102
+  .byte 110
+  .byte 100
+  .byte 101
+  .byte 102
+  .zero 1
+.align 1
+.L.data.132:
+  .byte 105
+  .byte 102
+  .byte 100
+  .byte 101
+  .byte 102
+  .zero 1
+.align 1
+.L.data.131:
+  .byte 117
+  .byte 110
+  .byte 100
+  .byte 101
+  .byte 102
+  .zero 1
+.align 1
+.L.data.130:
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 105
+  .byte 110
+  .byte 101
+  .zero 1
+.align 1
+.L.data.129:
+  .byte 105
+  .byte 110
+  .byte 99
+  .byte 108
+  .byte 117
+  .byte 100
+  .byte 101
+  .zero 1
+.align 1
+.L.data.128:
+  .byte 118
+  .byte 111
+  .byte 108
+  .byte 97
+  .byte 116
+  .byte 105
+  .byte 108
+  .byte 101
+  .zero 1
+.align 1
+.L.data.127:
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 115
+  .byte 116
+  .zero 1
+.align 1
+.L.data.126:
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .zero 1
+.align 1
+.L.data.125:
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .zero 1
+.align 1
+.L.data.124:
+  .byte 100
+  .byte 111
+  .zero 1
+.align 1
+.L.data.123:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 97
+  .byte 115
+  .zero 1
+.align 1
+.L.data.122:
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .zero 1
+.align 1
+.L.data.121:
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 110
+  .zero 1
+.align 1
+.L.data.120:
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 97
+  .byte 117
+  .byte 108
+  .byte 116
+  .zero 1
+.align 1
+.L.data.119:
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .zero 1
+.align 1
+.L.data.118:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .zero 1
+.align 1
+.L.data.117:
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .zero 1
+.align 1
+.L.data.116:
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .zero 1
+.align 1
+.L.data.115:
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .zero 1
+.align 1
+.L.data.114:
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 116
+  .byte 105
+  .byte 99
+  .zero 1
+.align 1
+.L.data.113:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .zero 1
+.align 1
+.L.data.112:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .zero 1
+.align 1
+.L.data.111:
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .zero 1
+.align 1
+.L.data.110:
+  .byte 118
+  .byte 111
+  .byte 105
+  .byte 100
+  .zero 1
+.align 1
+.L.data.109:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .zero 1
+.align 1
+.L.data.108:
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .zero 1
+.align 1
+.L.data.107:
+  .byte 117
+  .byte 110
+  .byte 105
+  .byte 111
+  .byte 110
+  .zero 1
+.align 1
+.L.data.106:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .zero 1
+.align 1
+.L.data.105:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .zero 1
+.align 1
+.L.data.104:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .zero 1
+.align 1
+.L.data.103:
+  .byte 105
+  .byte 110
+  .byte 116
+  .zero 1
+.align 1
+.L.data.102:
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .zero 1
+.align 1
+.L.data.101:
+  .byte 102
+  .byte 111
+  .byte 114
+  .zero 1
+.align 1
+.L.data.100:
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .zero 1
+.align 1
+.L.data.99:
+  .byte 105
+  .byte 102
+  .zero 1
+.align 1
+.L.data.98:
+  .byte 114
+  .byte 101
+  .byte 116
+  .byte 117
+  .byte 114
+  .byte 110
+  .zero 1
+.align 1
+.L.data.97:
+  .zero 1
+.align 1
+.L.data.96:
+  .byte 35
+  .zero 1
+.align 1
+.L.data.95:
+  .byte 58
+  .zero 1
+.align 1
+.L.data.94:
+  .byte 63
+  .zero 1
+.align 1
+.L.data.93:
+  .byte 33
+  .zero 1
+.align 1
+.L.data.92:
+  .byte 126
+  .zero 1
+.align 1
+.L.data.91:
+  .byte 94
+  .zero 1
+.align 1
+.L.data.90:
+  .byte 124
+  .zero 1
+.align 1
+.L.data.89:
+  .byte 38
+  .zero 1
+.align 1
+.L.data.88:
+  .byte 37
+  .zero 1
+.align 1
+.L.data.87:
+  .byte 47
+  .zero 1
+.align 1
+.L.data.86:
+  .byte 42
+  .zero 1
+.align 1
+.L.data.85:
+  .byte 45
+  .zero 1
+.align 1
+.L.data.84:
+  .byte 43
+  .zero 1
+.align 1
+.L.data.83:
+  .byte 62
+  .zero 1
+.align 1
+.L.data.82:
+  .byte 60
+  .zero 1
+.align 1
+.L.data.81:
+  .byte 61
+  .zero 1
+.align 1
+.L.data.80:
+  .byte 46
+  .zero 1
+.align 1
+.L.data.79:
+  .byte 44
+  .zero 1
+.align 1
+.L.data.78:
+  .byte 59
+  .zero 1
+.align 1
+.L.data.77:
+  .byte 93
+  .zero 1
+.align 1
+.L.data.76:
+  .byte 91
+  .zero 1
+.align 1
+.L.data.75:
+  .byte 125
+  .zero 1
+.align 1
+.L.data.74:
+  .byte 123
+  .zero 1
+.align 1
+.L.data.73:
+  .byte 41
+  .zero 1
+.align 1
+.L.data.72:
+  .byte 40
+  .zero 1
+.align 1
+.L.data.71:
+  .byte 35
+  .byte 35
+  .zero 1
+.align 1
+.L.data.70:
+  .byte 62
+  .byte 62
+  .zero 1
+.align 1
+.L.data.69:
+  .byte 60
+  .byte 60
+  .zero 1
+.align 1
+.L.data.68:
+  .byte 124
+  .byte 124
+  .zero 1
+.align 1
+.L.data.67:
+  .byte 38
+  .byte 38
+  .zero 1
+.align 1
+.L.data.66:
+  .byte 94
+  .byte 61
+  .zero 1
+.align 1
+.L.data.65:
+  .byte 124
+  .byte 61
+  .zero 1
+.align 1
+.L.data.64:
+  .byte 38
+  .byte 61
+  .zero 1
+.align 1
+.L.data.63:
+  .byte 37
+  .byte 61
+  .zero 1
+.align 1
+.L.data.62:
+  .byte 45
+  .byte 45
+  .zero 1
+.align 1
+.L.data.61:
+  .byte 43
+  .byte 43
+  .zero 1
+.align 1
+.L.data.60:
+  .byte 47
+  .byte 61
+  .zero 1
+.align 1
+.L.data.59:
+  .byte 42
+  .byte 61
+  .zero 1
+.align 1
+.L.data.58:
+  .byte 45
+  .byte 61
+  .zero 1
+.align 1
+.L.data.57:
+  .byte 43
+  .byte 61
+  .zero 1
+.align 1
+.L.data.56:
+  .byte 45
+  .byte 62
+  .zero 1
+.align 1
+.L.data.55:
+  .byte 62
+  .byte 61
+  .zero 1
+.align 1
+.L.data.54:
+  .byte 60
+  .byte 61
+  .zero 1
+.align 1
+.L.data.53:
+  .byte 33
+  .byte 61
+  .zero 1
+.align 1
+.L.data.52:
+  .byte 61
+  .byte 61
+  .zero 1
+.align 1
+.L.data.51:
+  .byte 62
+  .byte 62
+  .byte 61
+  .zero 1
+.align 1
+.L.data.50:
+  .byte 60
+  .byte 60
+  .byte 61
+  .zero 1
+.align 1
+.L.data.49:
+  .byte 46
+  .byte 46
+  .byte 46
+  .zero 1
+.align 1
+.L.data.48:
+  .byte 111
+  .byte 110
+  .byte 99
+  .byte 101
+  .zero 1
+.align 1
+.L.data.47:
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 105
+  .byte 110
+  .byte 101
+  .byte 100
+  .zero 1
+.align 1
+.L.data.46:
+  .byte 112
+  .byte 114
+  .byte 97
+  .byte 103
+  .byte 109
+  .byte 97
+  .zero 1
+.align 1
+.L.data.45:
+  .byte 101
+  .byte 110
+  .byte 100
+  .byte 105
+  .byte 102
+  .zero 1
+.align 1
+.L.data.44:
+  .byte 101
+  .byte 108
+  .byte 105
+  .byte 102
+  .zero 1
+.align 1
+.L.data.43:
+  .byte 105
+  .byte 102
+  .byte 110
+  .byte 100
+  .byte 101
+  .byte 102
+  .zero 1
+.align 1
+.L.data.42:
+  .byte 105
+  .byte 102
+  .byte 100
+  .byte 101
+  .byte 102
+  .zero 1
+.align 1
+.L.data.41:
+  .byte 117
+  .byte 110
+  .byte 100
+  .byte 101
+  .byte 102
+  .zero 1
+.align 1
+.L.data.40:
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 105
+  .byte 110
+  .byte 101
+  .zero 1
+.align 1
+.L.data.39:
+  .byte 105
+  .byte 110
+  .byte 99
+  .byte 108
+  .byte 117
+  .byte 100
+  .byte 101
+  .zero 1
+.align 1
+.L.data.38:
+  .byte 118
+  .byte 111
+  .byte 108
+  .byte 97
+  .byte 116
+  .byte 105
+  .byte 108
+  .byte 101
+  .zero 1
+.align 1
+.L.data.37:
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 115
+  .byte 116
+  .zero 1
+.align 1
+.L.data.36:
+  .byte 117
+  .byte 110
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .zero 1
+.align 1
+.L.data.35:
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .zero 1
+.align 1
+.L.data.34:
+  .byte 100
+  .byte 111
+  .zero 1
+.align 1
+.L.data.33:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 97
+  .byte 115
+  .zero 1
+.align 1
+.L.data.32:
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .zero 1
+.align 1
+.L.data.31:
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 110
+  .zero 1
+.align 1
+.L.data.30:
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 97
+  .byte 117
+  .byte 108
+  .byte 116
+  .zero 1
+.align 1
+.L.data.29:
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .zero 1
+.align 1
+.L.data.28:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .zero 1
+.align 1
+.L.data.27:
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .zero 1
+.align 1
+.L.data.26:
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .zero 1
+.align 1
+.L.data.25:
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .zero 1
+.align 1
+.L.data.24:
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 116
+  .byte 105
+  .byte 99
+  .zero 1
+.align 1
+.L.data.23:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .zero 1
+.align 1
+.L.data.22:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .zero 1
+.align 1
+.L.data.21:
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .zero 1
+.align 1
+.L.data.20:
+  .byte 118
+  .byte 111
+  .byte 105
+  .byte 100
+  .zero 1
+.align 1
+.L.data.19:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .zero 1
+.align 1
+.L.data.18:
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .zero 1
+.align 1
+.L.data.17:
+  .byte 117
+  .byte 110
+  .byte 105
+  .byte 111
+  .byte 110
+  .zero 1
+.align 1
+.L.data.16:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .zero 1
+.align 1
+.L.data.15:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .zero 1
+.align 1
+.L.data.14:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .zero 1
+.align 1
+.L.data.13:
+  .byte 105
+  .byte 110
+  .byte 116
+  .zero 1
+.align 1
+.L.data.12:
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .zero 1
+.align 1
+.L.data.11:
+  .byte 102
+  .byte 111
+  .byte 114
+  .zero 1
+.align 1
+.L.data.10:
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .zero 1
+.align 1
+.L.data.9:
+  .byte 105
+  .byte 102
+  .zero 1
+.align 1
+.L.data.8:
+  .byte 114
+  .byte 101
+  .byte 116
+  .byte 117
+  .byte 114
+  .byte 110
+  .zero 1
+.align 1
+.L.data.7:
+  .zero 1
+.align 8
+token_names:
+  .quad .L.data.97+0
+  .quad .L.data.98+0
+  .quad .L.data.99+0
+  .quad .L.data.100+0
+  .quad .L.data.101+0
+  .quad .L.data.102+0
+  .quad .L.data.103+0
+  .quad .L.data.104+0
+  .quad .L.data.105+0
+  .quad .L.data.106+0
+  .quad .L.data.107+0
+  .quad .L.data.108+0
+  .quad .L.data.109+0
+  .quad .L.data.110+0
+  .quad .L.data.111+0
+  .quad .L.data.112+0
+  .quad .L.data.113+0
+  .quad .L.data.114+0
+  .quad .L.data.115+0
+  .quad .L.data.116+0
+  .quad .L.data.117+0
+  .quad .L.data.118+0
+  .quad .L.data.119+0
+  .quad .L.data.120+0
+  .quad .L.data.121+0
+  .quad .L.data.122+0
+  .quad .L.data.123+0
+  .quad .L.data.124+0
+  .quad .L.data.125+0
+  .quad .L.data.126+0
+  .quad .L.data.127+0
+  .quad .L.data.128+0
+  .quad .L.data.129+0
+  .quad .L.data.130+0
+  .quad .L.data.131+0
+  .quad .L.data.132+0
+  .quad .L.data.133+0
+  .quad .L.data.134+0
+  .quad .L.data.135+0
+  .quad .L.data.136+0
+  .quad .L.data.137+0
+  .quad .L.data.138+0
+  .quad .L.data.139+0
+  .quad .L.data.140+0
+  .quad .L.data.141+0
+  .quad .L.data.142+0
+  .quad .L.data.143+0
+  .quad .L.data.144+0
+  .quad .L.data.145+0
+  .quad .L.data.146+0
+  .quad .L.data.147+0
+  .quad .L.data.148+0
+  .quad .L.data.149+0
+  .quad .L.data.150+0
+  .quad .L.data.151+0
+  .quad .L.data.152+0
+  .quad .L.data.153+0
+  .quad .L.data.154+0
+  .quad .L.data.155+0
+  .quad .L.data.156+0
+  .quad .L.data.157+0
+  .quad .L.data.158+0
+  .quad .L.data.159+0
+  .quad .L.data.160+0
+  .quad .L.data.161+0
+  .quad .L.data.162+0
+  .quad .L.data.163+0
+  .quad .L.data.164+0
+  .quad .L.data.165+0
+  .quad .L.data.166+0
+  .quad .L.data.167+0
+  .quad .L.data.168+0
+  .quad .L.data.169+0
+  .quad .L.data.170+0
+  .quad .L.data.171+0
+  .quad .L.data.172+0
+  .quad .L.data.173+0
+  .quad .L.data.174+0
+  .quad .L.data.175+0
+  .quad .L.data.176+0
+  .quad .L.data.177+0
+  .quad .L.data.178+0
+  .quad .L.data.179+0
+  .quad .L.data.180+0
+  .quad .L.data.181+0
+  .quad .L.data.182+0
+  .quad .L.data.183+0
+  .quad .L.data.184+0
+  .quad .L.data.185+0
+  .quad .L.data.186+0
+.align 1
+.L.data.6:
+  .byte 10
+  .zero 1
+.align 1
+.L.data.5:
+  .byte 94
+  .byte 32
+  .zero 1
+.align 1
+.L.data.4:
+  .zero 1
+.align 1
+.L.data.3:
+  .byte 37
+  .byte 42
+  .byte 115
+  .zero 1
+.align 1
+.L.data.2:
+  .byte 37
+  .byte 46
+  .byte 42
+  .byte 115
+  .byte 10
+  .zero 1
+.align 1
+.L.data.1:
+  .byte 37
+  .byte 115
+  .byte 58
+  .byte 37
+  .byte 100
+  .byte 32
+  .zero 1
+.align 1
+.L.data.0:
+  .byte 10
+  .zero 1
+.align 1
+.globl fast_lexer
+fast_lexer:
+  .byte 1
+.text
+assert:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.L.return.assert:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+va_end:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.L.return.va_end:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl error
+error:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 128
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-88], rdi
+  mov [rbp-80], rsi
+  mov [rbp-72], rdx
+  mov [rbp-64], rcx
+  mov [rbp-56], r8
+  mov [rbp-48], r9
+  mov dword ptr [rbp-40], 8
+  mov [rbp-120], rdi
+.loc 1 800 13
+.loc 1 801 3
+  lea r10, [rbp-112]
+  mov eax, [rbp-40]
+  mov [r10], eax
+  lea rax, [rbp-88]
+  mov [r10+16], rax
+.loc 1 802 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-112]
+  push r10
+  sub rsp, 8
+  mov r10, offset vfprintf
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 803 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.0
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 804 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset exit
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.error:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+line_start:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdx
+  mov [rbp-52], esi
+  mov [rbp-64], rdi
+.loc 1 810 3
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.line_start.2
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 32
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.line_start.2
+  mov r10, 1
+  jmp .L.end.line_start.2
+.L.0.line_start.2:
+  mov r10, 0
+.L.end.line_start.2:
+  cmp r10, 0
+  je .L.end.line_start.1
+.loc 1 811 5
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 24
+  mov r11, [r11]
+  lea r12, [rbp-52]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  sub r12d, r13d
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.line_start
+.L.end.line_start.1:
+.loc 1 814 3
+.L.begin.line_start.3:
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.0.line_start.4
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  sub r11d, r12d
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.line_start.4
+  mov r10, 1
+  jmp .L.end.line_start.4
+.L.0.line_start.4:
+  mov r10, 0
+.L.end.line_start.4:
+  cmp r10, 0
+  je .L.break.line_start.3
+.loc 1 815 5
+  lea r10, [rbp-48]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+.L.continue.line_start.3:
+  jmp .L.begin.line_start.3
+.L.break.line_start.3:
+.loc 1 816 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.line_start
+.L.return.line_start:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+find_line:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-64], rsi
+  mov [rbp-72], rdi
+.loc 1 821 34
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  add r11, 8
+  mov r11, [r11]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 822 13
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-44]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 823 26
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 32
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 824 3
+.L.begin.find_line.1:
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  lea r12, [rbp-44]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  sub r11d, r12d
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.find_line.1
+.loc 1 825 5
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  mov eax, r10d
+  cdq
+  idiv r11d
+  mov r10d, eax
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 826 5
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  lea r11, [rbp-36]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  cmp r10, r11
+  setle al
+  movzb r10, al
+  cmp r10, 0
+  je .L.else.find_line.2
+.loc 1 827 7
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-44]
+  mov [r11], r10d
+  jmp .L.end.find_line.2
+.L.else.find_line.2:
+.loc 1 829 7
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov [r11], r10d
+.L.end.find_line.2:
+.L.continue.find_line.1:
+  jmp .L.begin.find_line.1
+.L.break.find_line.1:
+.loc 1 831 3
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.find_line
+.L.return.find_line:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl get_column
+get_column:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdi
+.loc 1 836 69
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 28
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset line_start
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 837 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.get_column
+.L.return.get_column:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+verror_at:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 112
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-72], r8
+  mov [rbp-80], rcx
+  mov [rbp-88], rdx
+  mov [rbp-92], esi
+  mov [rbp-104], rdi
+.loc 1 846 45
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-92]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset line_start
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 847 18
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 848 3
+.L.begin.verror_at.1:
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.0.verror_at.2
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.verror_at.2
+  mov r10, 1
+  jmp .L.end.verror_at.2
+.L.0.verror_at.2:
+  mov r10, 0
+.L.end.verror_at.2:
+  cmp r10, 0
+  je .L.break.verror_at.1
+.loc 1 849 5
+  lea r10, [rbp-56]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+.L.continue.verror_at.1:
+  jmp .L.begin.verror_at.1
+.L.break.verror_at.1:
+.loc 1 852 61
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.1
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-92]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 853 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.2
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 856 32
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 858 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.3
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-36]
+  mov r10d, dword ptr [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.4
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 859 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.5
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 860 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset vfprintf
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 861 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset stderr
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.6
+  push r10
+  sub rsp, 8
+  mov r10, offset fprintf
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.verror_at:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+error_at:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 128
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-88], rdi
+  mov [rbp-80], rsi
+  mov [rbp-72], rdx
+  mov [rbp-64], rcx
+  mov [rbp-56], r8
+  mov [rbp-48], r9
+  mov dword ptr [rbp-40], 16
+  mov [rbp-120], rsi
+  mov [rbp-128], rdi
+.loc 1 865 13
+.loc 1 866 3
+  lea r10, [rbp-112]
+  mov eax, [rbp-40]
+  mov [r10], eax
+  lea rax, [rbp-88]
+  mov [r10+16], rax
+.loc 1 867 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset current_file
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset current_file
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset find_line
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-112]
+  push r10
+  sub rsp, 8
+  mov r10, offset verror_at
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 868 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset exit
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.error_at:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl error_tok
+error_tok:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 128
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-88], rdi
+  mov [rbp-80], rsi
+  mov [rbp-72], rdx
+  mov [rbp-64], rcx
+  mov [rbp-56], r8
+  mov [rbp-48], r9
+  mov dword ptr [rbp-40], 16
+  mov [rbp-120], rsi
+  mov [rbp-128], rdi
+.loc 1 872 13
+.loc 1 873 3
+  lea r10, [rbp-112]
+  mov eax, [rbp-40]
+  mov [r10], eax
+  lea rax, [rbp-88]
+  mov [r10+16], rax
+.loc 1 874 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  add r10, 28
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-112]
+  push r10
+  sub rsp, 8
+  mov r10, offset verror_at
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 875 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset exit
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.error_tok:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl warn_tok
+warn_tok:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 128
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-88], rdi
+  mov [rbp-80], rsi
+  mov [rbp-72], rdx
+  mov [rbp-64], rcx
+  mov [rbp-56], r8
+  mov [rbp-48], r9
+  mov dword ptr [rbp-40], 16
+  mov [rbp-120], rsi
+  mov [rbp-128], rdi
+.loc 1 879 13
+.loc 1 880 3
+  lea r10, [rbp-112]
+  mov eax, [rbp-40]
+  mov [r10], eax
+  lea rax, [rbp-88]
+  mov [r10+16], rax
+.loc 1 881 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  add r10, 28
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-112]
+  push r10
+  sub rsp, 8
+  mov r10, offset verror_at
+  add rsp, 8
+  pop r8
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.warn_tok:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+init_token_ids:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+.loc 1 914 3
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-76]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.init_token_ids.1:
+  lea r10, [rbp-76]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 42
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.init_token_ids.1
+.loc 1 915 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset word_ids
+  push r10
+  sub rsp, 8
+  mov r10, offset token_names
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-76]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_put
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.continue.init_token_ids.1:
+.loc 1 914 43
+  lea r10, [rbp-76]
+  lea r11, [rbp-72]
+  mov [r11], r10
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.init_token_ids.1
+.L.break.init_token_ids.1:
+.loc 1 917 3
+  mov r10, 42
+  mov r10d, r10d
+  lea r11, [rbp-60]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.begin.init_token_ids.2:
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 90
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.init_token_ids.2
+.loc 1 918 5
+  mov r10, offset punct_ids
+  mov r11, offset token_names
+  lea r12, [rbp-60]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 8
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov r11, [r11]
+  mov r12, 0
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  movsx r11d, byte ptr [r11]
+  movzx r11, r11b
+  mov r11d, r11d
+  mov r12, 20
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 919 5
+.L.begin.init_token_ids.3:
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  cmp r10, 0
+  je .L.break.init_token_ids.3
+.loc 1 920 7
+  lea r10, [rbp-48]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+.L.continue.init_token_ids.3:
+  jmp .L.begin.init_token_ids.3
+.L.break.init_token_ids.3:
+.loc 1 921 5
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10d
+.L.continue.init_token_ids.2:
+.loc 1 917 46
+  lea r10, [rbp-60]
+  lea r11, [rbp-56]
+  mov [r11], r10
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+  jmp .L.begin.init_token_ids.2
+.L.break.init_token_ids.2:
+.L.return.init_token_ids:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl intern
+intern:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-52], esi
+  mov [rbp-64], rdi
+.loc 1 934 44
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset names
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_get2
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 935 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.intern.1
+.loc 1 936 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.intern
+.L.end.intern.1:
+.loc 1 938 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 12
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  movsx r11, r11d
+  add r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset count_alloc
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 939 46
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 8
+  lea r11, [rbp-52]
+  mov r11d, dword ptr [r11]
+  movsx r11, r11d
+  add r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset calloc
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 940 3
+  mov r10, offset names
+  add r10, 12
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 941 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-48]
+  mov [r11], r10
+.loc 1 942 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset memcpy
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 943 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset names
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_put2
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 944 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.intern
+.L.return.intern:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl name_id
+name_id:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 949 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  sub r11d, r12d
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.name_id
+.L.return.name_id:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl skip
+skip:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-36], esi
+  mov [rbp-48], rdi
+.loc 1 954 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.skip.1
+.loc 1 955 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.187
+  push r10
+  sub rsp, 8
+  mov r10, offset token_names
+  lea r11, [rbp-36]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset error_tok
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.skip.1:
+.loc 1 956 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.skip
+.L.return.skip:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl consume
+consume:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-36], edx
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 961 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-36]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.consume.1
+.loc 1 962 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 963 5
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.consume
+.L.end.consume.1:
+.loc 1 965 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 966 3
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.consume
+.L.return.consume:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+new_token:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-44], ecx
+  mov [rbp-56], rdx
+  mov [rbp-64], rsi
+  mov [rbp-68], edi
+.loc 1 971 13
+.loc 1 972 3
+  mov r10, offset free_tokens
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.else.new_token.1
+.loc 1 973 5
+  mov r10, offset free_tokens
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov [r11], r10
+.loc 1 974 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  mov r11, offset free_tokens
+  mov [r11], r10
+.loc 1 975 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 72
+  push r10
+  sub rsp, 8
+  mov r10, offset memset
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.new_token.1
+.L.else.new_token.1:
+.loc 1 977 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 72
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov [r11], r10
+.L.end.new_token.1:
+.loc 1 980 3
+  lea r10, [rbp-68]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10d
+.loc 1 981 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 982 3
+  lea r10, [rbp-44]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10d
+.loc 1 983 3
+  mov r10, offset current_file
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 56
+  mov [r11], r10
+.loc 1 984 3
+  mov r10, offset current_lazy
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 50
+  mov [r11], r10b
+.loc 1 985 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 986 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.new_token
+.L.return.new_token:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl free_token
+free_token:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rdi
+.loc 1 993 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 50
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.free_token.1
+.loc 1 994 5
+  jmp .L.return.free_token
+.L.end.free_token.1:
+.loc 1 995 3
+  mov r10, offset free_tokens
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 996 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r11, offset free_tokens
+  mov [r11], r10
+.L.return.free_token:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+stop_bytes:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 160
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-144], rsi
+  mov [rbp-148], edi
+.loc 1 1012 42
+  movabs r10, 72340172838076673
+  lea r11, [rbp-136]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1013 43
+  movabs r10, -9187201950435737472
+  lea r11, [rbp-128]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1014 32
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  not r11
+  and r10, r11
+  lea r11, [rbp-120]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1016 3
+  lea r10, [rbp-148]
+  mov r10d, dword ptr [r10]
+  cmp r10, 3
+  je .L.case.stop_bytes.2
+  cmp r10, 2
+  je .L.case.stop_bytes.3
+  cmp r10, 1
+  je .L.case.stop_bytes.4
+  cmp r10, 0
+  je .L.case.stop_bytes.5
+  jmp .L.break.stop_bytes.1
+.loc 1 1017 3
+.L.case.stop_bytes.5:
+.loc 1 1019 5
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  lea r11, [rbp-136]
+  mov r11, [r11]
+  mov r12, 128
+  mov r12d, r12d
+  mov r13, 48
+  mov r13d, r13d
+  sub r12d, r13d
+  movsx r12, r12d
+  imul r11, r12
+  add r10, r11
+  lea r11, [rbp-120]
+  mov r11, [r11]
+  lea r12, [rbp-136]
+  mov r12, [r12]
+  mov r13, 127
+  mov r13d, r13d
+  mov r14, 57
+  mov r14d, r14d
+  sub r13d, r14d
+  movsx r13, r13d
+  imul r12, r13
+  add r11, r12
+  not r11
+  and r10, r11
+  lea r11, [rbp-112]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1020 5
+  lea r10, [rbp-112]
+  lea r11, [rbp-104]
+  mov [r11], r10
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-120]
+  mov r11, [r11]
+  lea r12, [rbp-136]
+  mov r12, [r12]
+  mov r13, 128
+  mov r13d, r13d
+  mov r14, 65
+  mov r14d, r14d
+  sub r13d, r14d
+  movsx r13, r13d
+  imul r12, r13
+  add r11, r12
+  lea r12, [rbp-120]
+  mov r12, [r12]
+  lea r13, [rbp-136]
+  mov r13, [r13]
+  mov r14, 127
+  mov r14d, r14d
+  mov r15, 90
+  mov r15d, r15d
+  sub r14d, r15d
+  movsx r14, r14d
+  imul r13, r14
+  add r12, r13
+  not r12
+  and r11, r12
+  or r10, r11
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1021 5
+  lea r10, [rbp-112]
+  lea r11, [rbp-96]
+  mov [r11], r10
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-120]
+  mov r11, [r11]
+  lea r12, [rbp-136]
+  mov r12, [r12]
+  mov r13, 128
+  mov r13d, r13d
+  mov r14, 97
+  mov r14d, r14d
+  sub r13d, r14d
+  movsx r13, r13d
+  imul r12, r13
+  add r11, r12
+  lea r12, [rbp-120]
+  mov r12, [r12]
+  lea r13, [rbp-136]
+  mov r13, [r13]
+  mov r14, 127
+  mov r14d, r14d
+  mov r15, 122
+  mov r15d, r15d
+  sub r14d, r15d
+  movsx r14, r14d
+  imul r13, r14
+  add r12, r13
+  not r12
+  and r11, r12
+  or r10, r11
+  lea r11, [rbp-96]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1022 39
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  lea r11, [rbp-136]
+  mov r11, [r11]
+  mov r12, 95
+  movsx r12, r12d
+  imul r11, r12
+  xor r10, r11
+  lea r11, [rbp-88]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1023 5
+  lea r10, [rbp-112]
+  lea r11, [rbp-80]
+  mov [r11], r10
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  lea r12, [rbp-128]
+  mov r12, [r12]
+  not r12
+  and r11, r12
+  lea r12, [rbp-128]
+  mov r12, [r12]
+  not r12
+  add r11, r12
+  lea r12, [rbp-88]
+  mov r12, [r12]
+  or r11, r12
+  not r11
+  or r10, r11
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1024 5
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  lea r11, [rbp-144]
+  mov r11, [r11]
+  not r11
+  and r10, r11
+  not r10
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  and r10, r11
+  mov rax, r10
+  jmp .L.return.stop_bytes
+.loc 1 1026 3
+.L.case.stop_bytes.4:
+.loc 1 1028 5
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  lea r11, [rbp-136]
+  mov r11, [r11]
+  mov r12, 32
+  movsx r12, r12d
+  imul r11, r12
+  xor r10, r11
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1029 41
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  lea r11, [rbp-136]
+  mov r11, [r11]
+  mov r12, 9
+  movsx r12, r12d
+  imul r11, r12
+  xor r10, r11
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1030 5
+.loc 1 1031 44
+.loc 1 1030 44
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  not r11
+  and r10, r11
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  not r11
+  add r10, r11
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  or r10, r11
+.loc 1 1031 38
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  lea r12, [rbp-128]
+  mov r12, [r12]
+  not r12
+  and r11, r12
+  lea r12, [rbp-128]
+  mov r12, [r12]
+  not r12
+  add r11, r12
+  lea r12, [rbp-64]
+  mov r12, [r12]
+  or r11, r12
+  and r10, r11
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  and r10, r11
+  mov rax, r10
+  jmp .L.return.stop_bytes
+.loc 1 1033 3
+.L.case.stop_bytes.3:
+.loc 1 1035 5
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  lea r11, [rbp-136]
+  mov r11, [r11]
+  mov r12, 10
+  movsx r12, r12d
+  imul r11, r12
+  xor r10, r11
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1036 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  not r11
+  and r10, r11
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  not r11
+  add r10, r11
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  or r10, r11
+  lea r11, [rbp-120]
+  mov r11, [r11]
+  lea r12, [rbp-128]
+  mov r12, [r12]
+  not r12
+  add r11, r12
+  lea r12, [rbp-144]
+  mov r12, [r12]
+  or r11, r12
+  and r10, r11
+  not r10
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  and r10, r11
+  mov rax, r10
+  jmp .L.return.stop_bytes
+.loc 1 1038 3
+.L.case.stop_bytes.2:
+.loc 1 1040 5
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  lea r11, [rbp-136]
+  mov r11, [r11]
+  mov r12, 34
+  movsx r12, r12d
+  imul r11, r12
+  xor r10, r11
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1041 41
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  lea r11, [rbp-136]
+  mov r11, [r11]
+  mov r12, 92
+  movsx r12, r12d
+  imul r11, r12
+  xor r10, r11
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1042 5
+.loc 1 1043 69
+.loc 1 1042 12
+.loc 1 1043 46
+.loc 1 1042 46
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  not r11
+  and r10, r11
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  not r11
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  or r10, r11
+.loc 1 1043 40
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  lea r12, [rbp-128]
+  mov r12, [r12]
+  not r12
+  and r11, r12
+  lea r12, [rbp-128]
+  mov r12, [r12]
+  not r12
+  add r11, r12
+  lea r12, [rbp-40]
+  mov r12, [r12]
+  or r11, r12
+  and r10, r11
+  lea r11, [rbp-120]
+  mov r11, [r11]
+  lea r12, [rbp-128]
+  mov r12, [r12]
+  not r12
+  add r11, r12
+  lea r12, [rbp-144]
+  mov r12, [r12]
+  or r11, r12
+  and r10, r11
+  not r10
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  and r10, r11
+  mov rax, r10
+  jmp .L.return.stop_bytes
+.L.break.stop_bytes.1:
+.loc 1 1046 3
+  mov r10, 0
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.stop_bytes
+.L.return.stop_bytes:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+scan:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-76], esi
+  mov [rbp-88], rdi
+.loc 1 1053 25
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  mov r11, 7
+  movsx r11, r11d
+  and r10, r11
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1054 48
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  mov r12, 1
+  movsx r12, r12d
+  imul r11, r12
+  sub r10, r11
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1055 66
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-76]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset stop_bytes
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  movabs r11, 0
+  not r11
+  lea r12, [rbp-72]
+  mov r12, [r12]
+  mov r13, 8
+  movsx r13, r13d
+  imul r12, r13
+  mov rcx, r12
+  shl r11, cl
+  and r10, r11
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1057 3
+.L.begin.scan.1:
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.break.scan.1
+.loc 1 1058 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-76]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-64]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset stop_bytes
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov [r11], r10
+.L.continue.scan.1:
+  jmp .L.begin.scan.1
+.L.break.scan.1:
+.loc 1 1062 42
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 0
+  movsx r11, r11d
+  lea r12, [rbp-56]
+  mov r12, [r12]
+  sub r11, r12
+  and r10, r11
+  mov r11, 7
+  mov rcx, r11
+  shr r10, cl
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1063 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  movabs r12, 283686952306183
+  imul r11, r12
+  mov r12, 56
+  mov rcx, r12
+  shr r11, cl
+  mov r12, 1
+  movsx r12, r12d
+  imul r11, r12
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.scan
+.L.return.scan:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+startswith:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-40], rsi
+  mov [rbp-48], rdi
+.loc 1 1067 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strlen
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  push r10
+  sub rsp, 8
+  mov r10, offset strncmp
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.startswith
+.L.return.startswith:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+is_alpha:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-33], dil
+.loc 1 1071 3
+  mov r10, 97
+  mov r10d, r10d
+  lea r11, [rbp-33]
+  movsx r11d, byte ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.is_alpha.3
+  lea r10, [rbp-33]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 122
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.is_alpha.3
+  mov r10, 1
+  jmp .L.end.is_alpha.3
+.L.0.is_alpha.3:
+  mov r10, 0
+.L.end.is_alpha.3:
+  cmp r10, 0
+  jne .L.1.is_alpha.2
+  mov r10, 65
+  mov r10d, r10d
+  lea r11, [rbp-33]
+  movsx r11d, byte ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.is_alpha.4
+  lea r10, [rbp-33]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 90
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.is_alpha.4
+  mov r10, 1
+  jmp .L.end.is_alpha.4
+.L.0.is_alpha.4:
+  mov r10, 0
+.L.end.is_alpha.4:
+  cmp r10, 0
+  jne .L.1.is_alpha.2
+  mov r10, 0
+  jmp .L.end.is_alpha.2
+.L.1.is_alpha.2:
+  mov r10, 1
+.L.end.is_alpha.2:
+  cmp r10, 0
+  jne .L.1.is_alpha.1
+  lea r10, [rbp-33]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 95
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.1.is_alpha.1
+  mov r10, 0
+  jmp .L.end.is_alpha.1
+.L.1.is_alpha.1:
+  mov r10, 1
+.L.end.is_alpha.1:
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.is_alpha
+.L.return.is_alpha:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+is_alnum:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-33], dil
+.loc 1 1075 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-33]
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset is_alpha
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  jne .L.1.is_alnum.1
+  mov r10, 48
+  mov r10d, r10d
+  lea r11, [rbp-33]
+  movsx r11d, byte ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.is_alnum.2
+  lea r10, [rbp-33]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 57
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.is_alnum.2
+  mov r10, 1
+  jmp .L.end.is_alnum.2
+.L.0.is_alnum.2:
+  mov r10, 0
+.L.end.is_alnum.2:
+  cmp r10, 0
+  jne .L.1.is_alnum.1
+  mov r10, 0
+  jmp .L.end.is_alnum.1
+.L.1.is_alnum.1:
+  mov r10, 1
+.L.end.is_alnum.1:
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.is_alnum
+.L.return.is_alnum:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+is_hex:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-33], dil
+.loc 1 1079 3
+.loc 1 1080 33
+.loc 1 1079 33
+  mov r10, 48
+  mov r10d, r10d
+  lea r11, [rbp-33]
+  movsx r11d, byte ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.is_hex.3
+  lea r10, [rbp-33]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 57
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.is_hex.3
+  mov r10, 1
+  jmp .L.end.is_hex.3
+.L.0.is_hex.3:
+  mov r10, 0
+.L.end.is_hex.3:
+  cmp r10, 0
+  jne .L.1.is_hex.2
+.loc 1 1080 20
+  mov r10, 97
+  mov r10d, r10d
+  lea r11, [rbp-33]
+  movsx r11d, byte ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.is_hex.4
+  lea r10, [rbp-33]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 102
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.is_hex.4
+  mov r10, 1
+  jmp .L.end.is_hex.4
+.L.0.is_hex.4:
+  mov r10, 0
+.L.end.is_hex.4:
+  cmp r10, 0
+  jne .L.1.is_hex.2
+  mov r10, 0
+  jmp .L.end.is_hex.2
+.L.1.is_hex.2:
+  mov r10, 1
+.L.end.is_hex.2:
+  cmp r10, 0
+  jne .L.1.is_hex.1
+.loc 1 1081 20
+  mov r10, 65
+  mov r10d, r10d
+  lea r11, [rbp-33]
+  movsx r11d, byte ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.is_hex.5
+  lea r10, [rbp-33]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 70
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.is_hex.5
+  mov r10, 1
+  jmp .L.end.is_hex.5
+.L.0.is_hex.5:
+  mov r10, 0
+.L.end.is_hex.5:
+  cmp r10, 0
+  jne .L.1.is_hex.1
+  mov r10, 0
+  jmp .L.end.is_hex.1
+.L.1.is_hex.1:
+  mov r10, 1
+.L.end.is_hex.1:
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov rax, r10
+  jmp .L.return.is_hex
+.L.return.is_hex:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+from_hex:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-33], dil
+.loc 1 1085 3
+  mov r10, 48
+  mov r10d, r10d
+  lea r11, [rbp-33]
+  movsx r11d, byte ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.from_hex.2
+  lea r10, [rbp-33]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 57
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.from_hex.2
+  mov r10, 1
+  jmp .L.end.from_hex.2
+.L.0.from_hex.2:
+  mov r10, 0
+.L.end.from_hex.2:
+  cmp r10, 0
+  je .L.end.from_hex.1
+.loc 1 1086 5
+  lea r10, [rbp-33]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 48
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.from_hex
+.L.end.from_hex.1:
+.loc 1 1087 3
+  mov r10, 97
+  mov r10d, r10d
+  lea r11, [rbp-33]
+  movsx r11d, byte ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.from_hex.4
+  lea r10, [rbp-33]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 102
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.from_hex.4
+  mov r10, 1
+  jmp .L.end.from_hex.4
+.L.0.from_hex.4:
+  mov r10, 0
+.L.end.from_hex.4:
+  cmp r10, 0
+  je .L.end.from_hex.3
+.loc 1 1088 5
+  lea r10, [rbp-33]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 97
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.from_hex
+.L.end.from_hex.3:
+.loc 1 1089 3
+  lea r10, [rbp-33]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 65
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  mov rax, r10
+  jmp .L.return.from_hex
+.L.return.from_hex:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl convert_keywords
+convert_keywords:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-64], rdi
+.loc 1 1093 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset timer_start
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1094 13
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1095 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.convert_keywords.1:
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.convert_keywords.1
+.loc 1 1096 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.convert_keywords.4
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 4
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.convert_keywords.4
+  mov r10, 1
+  jmp .L.end.convert_keywords.4
+.L.0.convert_keywords.4:
+  mov r10, 0
+.L.end.convert_keywords.4:
+  cmp r10, 0
+  je .L.0.convert_keywords.3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 4
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 31
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.convert_keywords.3
+  mov r10, 1
+  jmp .L.end.convert_keywords.3
+.L.0.convert_keywords.3:
+  mov r10, 0
+.L.end.convert_keywords.3:
+  cmp r10, 0
+  je .L.end.convert_keywords.2
+.loc 1 1097 7
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10d
+.L.end.convert_keywords.2:
+.loc 1 1098 5
+  lea r10, [rbp-56]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+.L.continue.convert_keywords.1:
+.loc 1 1095 43
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  jmp .L.begin.convert_keywords.1
+.L.break.convert_keywords.1:
+.loc 1 1100 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset timer_count
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1101 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset timer_count
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1102 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset timer_stop
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.convert_keywords:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+read_escaped_char:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 112
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-96], rsi
+  mov [rbp-104], rdi
+.loc 1 1106 3
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 101
+  je .L.case.read_escaped_char.2
+  cmp r10, 114
+  je .L.case.read_escaped_char.3
+  cmp r10, 102
+  je .L.case.read_escaped_char.4
+  cmp r10, 118
+  je .L.case.read_escaped_char.5
+  cmp r10, 110
+  je .L.case.read_escaped_char.6
+  cmp r10, 116
+  je .L.case.read_escaped_char.7
+  cmp r10, 98
+  je .L.case.read_escaped_char.8
+  cmp r10, 97
+  je .L.case.read_escaped_char.9
+  cmp r10, 48
+  je .L.case.read_escaped_char.10
+  cmp r10, 49
+  je .L.case.read_escaped_char.11
+  cmp r10, 50
+  je .L.case.read_escaped_char.12
+  cmp r10, 51
+  je .L.case.read_escaped_char.13
+  cmp r10, 52
+  je .L.case.read_escaped_char.14
+  cmp r10, 53
+  je .L.case.read_escaped_char.15
+  cmp r10, 54
+  je .L.case.read_escaped_char.16
+  cmp r10, 55
+  je .L.case.read_escaped_char.17
+  cmp r10, 120
+  je .L.case.read_escaped_char.18
+  jmp .L.case.read_escaped_char.19
+  jmp .L.break.read_escaped_char.1
+.loc 1 1107 5
+.L.case.read_escaped_char.18:
+.loc 1 1109 7
+  lea r10, [rbp-96]
+  lea r11, [rbp-88]
+  mov [r11], r10
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+.loc 1 1110 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset is_hex
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.read_escaped_char.20
+.loc 1 1111 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.188
+  push r10
+  sub rsp, 8
+  mov r10, offset error_at
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.read_escaped_char.20:
+.loc 1 1113 16
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-76]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1114 7
+.L.begin.read_escaped_char.21:
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset is_hex
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.break.read_escaped_char.21
+.loc 1 1115 9
+  lea r10, [rbp-76]
+  mov r10d, dword ptr [r10]
+  mov r11, 4
+  mov rcx, r11
+  shl r10d, cl
+  mov r10d, r10d
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset from_hex
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r11, rax
+  mov r11d, r11d
+  or r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-76]
+  mov [r11], r10d
+.loc 1 1116 9
+  mov r10, 255
+  mov r10d, r10d
+  lea r11, [rbp-76]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setl al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.read_escaped_char.22
+.loc 1 1117 11
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.189
+  push r10
+  sub rsp, 8
+  mov r10, offset error_at
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.read_escaped_char.22:
+.L.continue.read_escaped_char.21:
+.loc 1 1114 26
+  lea r10, [rbp-96]
+  lea r11, [rbp-72]
+  mov [r11], r10
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  jmp .L.begin.read_escaped_char.21
+.L.break.read_escaped_char.21:
+.loc 1 1119 7
+  lea r10, [rbp-76]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10b
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  mov [r11], r10b
+.loc 1 1120 7
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.read_escaped_char
+.loc 1 1122 5
+.L.case.read_escaped_char.10:
+.L.case.read_escaped_char.11:
+.L.case.read_escaped_char.12:
+.L.case.read_escaped_char.13:
+.loc 1 1123 5
+.L.case.read_escaped_char.14:
+.L.case.read_escaped_char.15:
+.L.case.read_escaped_char.16:
+.L.case.read_escaped_char.17:
+.loc 1 1125 7
+  lea r10, [rbp-96]
+  lea r11, [rbp-56]
+  mov [r11], r10
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 48
+  mov r11d, r11d
+  sub r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-60]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1126 7
+  mov r10, 48
+  mov r10d, r10d
+  lea r11, [rbp-96]
+  mov r11, [r11]
+  movsx r11d, byte ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.read_escaped_char.24
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 55
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.read_escaped_char.24
+  mov r10, 1
+  jmp .L.end.read_escaped_char.24
+.L.0.read_escaped_char.24:
+  mov r10, 0
+.L.end.read_escaped_char.24:
+  cmp r10, 0
+  je .L.end.read_escaped_char.23
+.loc 1 1127 9
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r11, 3
+  mov rcx, r11
+  shl r10d, cl
+  mov r10d, r10d
+  lea r11, [rbp-96]
+  lea r12, [rbp-48]
+  mov [r12], r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov r11, [r11]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  lea r12, [rbp-48]
+  mov r12, [r12]
+  mov [r12], r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov r11, [r11]
+  mov r12, -1
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  movsx r11d, byte ptr [r11]
+  mov r11d, r11d
+  mov r12, 48
+  mov r12d, r12d
+  sub r11d, r12d
+  mov r11d, r11d
+  or r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-60]
+  mov [r11], r10d
+.loc 1 1128 9
+  mov r10, 48
+  mov r10d, r10d
+  lea r11, [rbp-96]
+  mov r11, [r11]
+  movsx r11d, byte ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.read_escaped_char.26
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 55
+  mov r11d, r11d
+  cmp r10d, r11d
+  setle al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.read_escaped_char.26
+  mov r10, 1
+  jmp .L.end.read_escaped_char.26
+.L.0.read_escaped_char.26:
+  mov r10, 0
+.L.end.read_escaped_char.26:
+  cmp r10, 0
+  je .L.end.read_escaped_char.25
+.loc 1 1129 11
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r11, 3
+  mov rcx, r11
+  shl r10d, cl
+  mov r10d, r10d
+  lea r11, [rbp-96]
+  lea r12, [rbp-40]
+  mov [r12], r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov r11, [r11]
+  mov r12, 1
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  lea r12, [rbp-40]
+  mov r12, [r12]
+  mov [r12], r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov r11, [r11]
+  mov r12, -1
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  movsx r11d, byte ptr [r11]
+  mov r11d, r11d
+  mov r12, 48
+  mov r12d, r12d
+  sub r11d, r12d
+  mov r11d, r11d
+  or r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-60]
+  mov [r11], r10d
+.L.end.read_escaped_char.25:
+.L.end.read_escaped_char.23:
+.loc 1 1131 7
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  movsx r10, r10b
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  mov [r11], r10b
+.loc 1 1132 7
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.read_escaped_char
+.loc 1 1134 5
+.L.case.read_escaped_char.9:
+  mov r10, 7
+  movsx r10, r10b
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  mov [r11], r10b
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.read_escaped_char
+.loc 1 1135 5
+.L.case.read_escaped_char.8:
+  mov r10, 8
+  movsx r10, r10b
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  mov [r11], r10b
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.read_escaped_char
+.loc 1 1136 5
+.L.case.read_escaped_char.7:
+  mov r10, 9
+  movsx r10, r10b
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  mov [r11], r10b
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.read_escaped_char
+.loc 1 1137 5
+.L.case.read_escaped_char.6:
+  mov r10, 10
+  movsx r10, r10b
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  mov [r11], r10b
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.read_escaped_char
+.loc 1 1138 5
+.L.case.read_escaped_char.5:
+  mov r10, 11
+  movsx r10, r10b
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  mov [r11], r10b
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.read_escaped_char
+.loc 1 1139 5
+.L.case.read_escaped_char.4:
+  mov r10, 12
+  movsx r10, r10b
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  mov [r11], r10b
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.read_escaped_char
+.loc 1 1140 5
+.L.case.read_escaped_char.3:
+  mov r10, 13
+  movsx r10, r10b
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  mov [r11], r10b
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.read_escaped_char
+.loc 1 1141 5
+.L.case.read_escaped_char.2:
+  mov r10, 27
+  movsx r10, r10b
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  mov [r11], r10b
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.read_escaped_char
+.loc 1 1142 5
+.L.case.read_escaped_char.19:
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10b
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  mov [r11], r10b
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.read_escaped_char
+.L.break.read_escaped_char.1:
+.L.return.read_escaped_char:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+read_string_leteral:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 144
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-136], rsi
+  mov [rbp-144], rdi
+.loc 1 1147 22
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-128]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1148 16
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  lea r11, [rbp-120]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1149 23
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-105]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.loc 1 1152 3
+  mov r10, offset fast_lexer
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.else.read_string_leteral.1
+.loc 1 1153 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset scan
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-120]
+  mov [r11], r10
+.L.begin.read_string_leteral.2:
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 34
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.read_string_leteral.2
+.loc 1 1154 7
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.read_string_leteral.3
+.loc 1 1155 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.190
+  push r10
+  sub rsp, 8
+  mov r10, offset error_at
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.read_string_leteral.3:
+.loc 1 1156 7
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-105]
+  mov [r11], r10b
+.loc 1 1157 7
+  lea r10, [rbp-120]
+  lea r11, [rbp-104]
+  mov [r11], r10
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  mov [r11], r10
+.L.continue.read_string_leteral.2:
+.loc 1 1153 50
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 3
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset scan
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-120]
+  mov [r11], r10
+  jmp .L.begin.read_string_leteral.2
+.L.break.read_string_leteral.2:
+  jmp .L.end.read_string_leteral.1
+.L.else.read_string_leteral.1:
+.loc 1 1160 5
+.L.begin.read_string_leteral.4:
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 34
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.break.read_string_leteral.4
+.loc 1 1161 7
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.read_string_leteral.5
+.loc 1 1162 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.191
+  push r10
+  sub rsp, 8
+  mov r10, offset error_at
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.read_string_leteral.5:
+.loc 1 1163 7
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 92
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.read_string_leteral.6
+.loc 1 1164 9
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-105]
+  mov [r11], r10b
+.loc 1 1165 9
+  lea r10, [rbp-120]
+  lea r11, [rbp-88]
+  mov [r11], r10
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+.L.end.read_string_leteral.6:
+.L.continue.read_string_leteral.4:
+.loc 1 1160 25
+  lea r10, [rbp-120]
+  lea r11, [rbp-96]
+  mov [r11], r10
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-96]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  jmp .L.begin.read_string_leteral.4
+.L.break.read_string_leteral.4:
+.L.end.read_string_leteral.1:
+.loc 1 1170 62
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  lea r11, [rbp-136]
+  mov r11, [r11]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset new_token
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1171 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 32
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 64
+  mov [r11], r10
+.loc 1 1175 3
+  lea r10, [rbp-105]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.read_string_leteral.7
+.loc 1 1176 5
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 64
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 1177 5
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 64
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10d
+.loc 1 1178 5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.read_string_leteral
+.L.end.read_string_leteral.7:
+.loc 1 1183 48
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 12
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1184 14
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1186 3
+.L.begin.read_string_leteral.8:
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  lea r11, [rbp-120]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.break.read_string_leteral.8
+.loc 1 1187 5
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 92
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.read_string_leteral.9
+.loc 1 1188 7
+.loc 1 1189 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-57]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset read_escaped_char
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-128]
+  mov [r11], r10
+.loc 1 1190 7
+  lea r10, [rbp-57]
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10b
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  lea r12, [rbp-64]
+  lea r13, [rbp-56]
+  mov [r13], r12
+  lea r12, [rbp-56]
+  mov r12, [r12]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  add r12d, r13d
+  mov r12d, r12d
+  lea r13, [rbp-56]
+  mov r13, [r13]
+  mov [r13], r12d
+  lea r12, [rbp-56]
+  mov r12, [r12]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, -1
+  mov r13d, r13d
+  add r12d, r13d
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  jmp .L.end.read_string_leteral.9
+.L.else.read_string_leteral.9:
+.loc 1 1192 7
+  lea r10, [rbp-128]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10b
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  lea r12, [rbp-64]
+  lea r13, [rbp-48]
+  mov [r13], r12
+  lea r12, [rbp-48]
+  mov r12, [r12]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  add r12d, r13d
+  mov r12d, r12d
+  lea r13, [rbp-48]
+  mov r13, [r13]
+  mov [r13], r12d
+  lea r12, [rbp-48]
+  mov r12, [r12]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, -1
+  mov r13d, r13d
+  add r12d, r13d
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+.L.end.read_string_leteral.9:
+.L.continue.read_string_leteral.8:
+  jmp .L.begin.read_string_leteral.8
+.L.break.read_string_leteral.8:
+.loc 1 1196 3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 64
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 1197 3
+  lea r10, [rbp-64]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 64
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10d
+.loc 1 1198 3
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.read_string_leteral
+.L.return.read_string_leteral:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+read_char_literal:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-80], rsi
+  mov [rbp-88], rdi
+.loc 1 1202 22
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1203 3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 0
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.read_char_literal.1
+.loc 1 1204 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.192
+  push r10
+  sub rsp, 8
+  mov r10, offset error_at
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.read_char_literal.1:
+.loc 1 1206 9
+.loc 1 1207 3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 92
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.read_char_literal.2
+.loc 1 1208 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-57]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset read_escaped_char
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-72]
+  mov [r11], r10
+  jmp .L.end.read_char_literal.2
+.L.else.read_char_literal.2:
+.loc 1 1210 5
+  lea r10, [rbp-72]
+  lea r11, [rbp-56]
+  mov [r11], r10
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10b
+  lea r11, [rbp-57]
+  mov [r11], r10b
+.L.end.read_char_literal.2:
+.loc 1 1212 3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 39
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.read_char_literal.3
+.loc 1 1213 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.193
+  push r10
+  sub rsp, 8
+  mov r10, offset error_at
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.read_char_literal.3:
+.loc 1 1214 3
+  lea r10, [rbp-72]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+.loc 1 1216 56
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset new_token
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1217 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 32
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 64
+  mov [r11], r10
+.loc 1 1218 3
+  lea r10, [rbp-57]
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 64
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 1219 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.read_char_literal
+.L.return.read_char_literal:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+read_int_literal:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 144
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-136], rsi
+  mov [rbp-144], rdi
+.loc 1 1223 18
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  lea r11, [rbp-128]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1226 16
+  mov r10, 10
+  mov r10d, r10d
+  lea r11, [rbp-116]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1227 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.194
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset strncasecmp
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.0.read_int_literal.2
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset is_alnum
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.0.read_int_literal.2
+  mov r10, 1
+  jmp .L.end.read_int_literal.2
+.L.0.read_int_literal.2:
+  mov r10, 0
+.L.end.read_int_literal.2:
+  cmp r10, 0
+  je .L.else.read_int_literal.1
+.loc 1 1228 5
+  lea r10, [rbp-128]
+  lea r11, [rbp-112]
+  mov [r11], r10
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1229 5
+  mov r10, 16
+  mov r10d, r10d
+  lea r11, [rbp-116]
+  mov [r11], r10d
+  jmp .L.end.read_int_literal.1
+.L.else.read_int_literal.1:
+.loc 1 1230 10
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.195
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset strncasecmp
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.0.read_int_literal.4
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset is_alnum
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.0.read_int_literal.4
+  mov r10, 1
+  jmp .L.end.read_int_literal.4
+.L.0.read_int_literal.4:
+  mov r10, 0
+.L.end.read_int_literal.4:
+  cmp r10, 0
+  je .L.else.read_int_literal.3
+.loc 1 1231 5
+  lea r10, [rbp-128]
+  lea r11, [rbp-104]
+  mov [r11], r10
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-104]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1232 5
+  mov r10, 2
+  mov r10d, r10d
+  lea r11, [rbp-116]
+  mov [r11], r10d
+  jmp .L.end.read_int_literal.3
+.L.else.read_int_literal.3:
+.loc 1 1233 10
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 48
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.read_int_literal.5
+.loc 1 1234 5
+  mov r10, 8
+  mov r10d, r10d
+  lea r11, [rbp-116]
+  mov [r11], r10d
+.L.end.read_int_literal.5:
+.L.end.read_int_literal.3:
+.L.end.read_int_literal.1:
+.loc 1 1237 34
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-128]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-116]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset strtoul
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-96]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1238 20
+  mov r10, offset ty_int
+  mov r10, [r10]
+  lea r11, [rbp-88]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1241 3
+.loc 1 1244 28
+.loc 1 1243 52
+.loc 1 1242 52
+.loc 1 1241 52
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.196
+  push r10
+  sub rsp, 8
+  mov r10, offset startswith
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  jne .L.1.read_int_literal.13
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.197
+  push r10
+  sub rsp, 8
+  mov r10, offset startswith
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  jne .L.1.read_int_literal.13
+  mov r10, 0
+  jmp .L.end.read_int_literal.13
+.L.1.read_int_literal.13:
+  mov r10, 1
+.L.end.read_int_literal.13:
+  cmp r10, 0
+  jne .L.1.read_int_literal.12
+.loc 1 1242 17
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.198
+  push r10
+  sub rsp, 8
+  mov r10, offset startswith
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  jne .L.1.read_int_literal.12
+  mov r10, 0
+  jmp .L.end.read_int_literal.12
+.L.1.read_int_literal.12:
+  mov r10, 1
+.L.end.read_int_literal.12:
+  cmp r10, 0
+  jne .L.1.read_int_literal.11
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.199
+  push r10
+  sub rsp, 8
+  mov r10, offset startswith
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  jne .L.1.read_int_literal.11
+  mov r10, 0
+  jmp .L.end.read_int_literal.11
+.L.1.read_int_literal.11:
+  mov r10, 1
+.L.end.read_int_literal.11:
+  cmp r10, 0
+  jne .L.1.read_int_literal.10
+.loc 1 1243 17
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.200
+  push r10
+  sub rsp, 8
+  mov r10, offset startswith
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  jne .L.1.read_int_literal.10
+  mov r10, 0
+  jmp .L.end.read_int_literal.10
+.L.1.read_int_literal.10:
+  mov r10, 1
+.L.end.read_int_literal.10:
+  cmp r10, 0
+  jne .L.1.read_int_literal.9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.201
+  push r10
+  sub rsp, 8
+  mov r10, offset startswith
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  jne .L.1.read_int_literal.9
+  mov r10, 0
+  jmp .L.end.read_int_literal.9
+.L.1.read_int_literal.9:
+  mov r10, 1
+.L.end.read_int_literal.9:
+  cmp r10, 0
+  jne .L.1.read_int_literal.8
+.loc 1 1244 17
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.202
+  push r10
+  sub rsp, 8
+  mov r10, offset startswith
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  jne .L.1.read_int_literal.8
+  mov r10, 0
+  jmp .L.end.read_int_literal.8
+.L.1.read_int_literal.8:
+  mov r10, 1
+.L.end.read_int_literal.8:
+  cmp r10, 0
+  jne .L.1.read_int_literal.7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.203
+  push r10
+  sub rsp, 8
+  mov r10, offset startswith
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  jne .L.1.read_int_literal.7
+  mov r10, 0
+  jmp .L.end.read_int_literal.7
+.L.1.read_int_literal.7:
+  mov r10, 1
+.L.end.read_int_literal.7:
+  cmp r10, 0
+  je .L.else.read_int_literal.6
+.loc 1 1245 5
+  lea r10, [rbp-128]
+  lea r11, [rbp-80]
+  mov [r11], r10
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 3
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1246 5
+  mov r10, offset ty_ulong
+  mov r10, [r10]
+  lea r11, [rbp-88]
+  mov [r11], r10
+  jmp .L.end.read_int_literal.6
+.L.else.read_int_literal.6:
+.loc 1 1247 10
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.204
+  push r10
+  sub rsp, 8
+  mov r10, offset startswith
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  jne .L.1.read_int_literal.15
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.205
+  push r10
+  sub rsp, 8
+  mov r10, offset startswith
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  jne .L.1.read_int_literal.15
+  mov r10, 0
+  jmp .L.end.read_int_literal.15
+.L.1.read_int_literal.15:
+  mov r10, 1
+.L.end.read_int_literal.15:
+  cmp r10, 0
+  je .L.else.read_int_literal.14
+.loc 1 1248 5
+  lea r10, [rbp-128]
+  lea r11, [rbp-72]
+  mov [r11], r10
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1249 5
+  mov r10, offset ty_long
+  mov r10, [r10]
+  lea r11, [rbp-88]
+  mov [r11], r10
+  jmp .L.end.read_int_literal.14
+.L.else.read_int_literal.14:
+.loc 1 1250 10
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.206
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset strncasecmp
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.1.read_int_literal.17
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.207
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  push r10
+  sub rsp, 8
+  mov r10, offset strncasecmp
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  jne .L.1.read_int_literal.17
+  mov r10, 0
+  jmp .L.end.read_int_literal.17
+.L.1.read_int_literal.17:
+  mov r10, 1
+.L.end.read_int_literal.17:
+  cmp r10, 0
+  je .L.else.read_int_literal.16
+.loc 1 1251 5
+  lea r10, [rbp-128]
+  lea r11, [rbp-64]
+  mov [r11], r10
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1252 5
+  mov r10, offset ty_ulong
+  mov r10, [r10]
+  lea r11, [rbp-88]
+  mov [r11], r10
+  jmp .L.end.read_int_literal.16
+.L.else.read_int_literal.16:
+.loc 1 1253 10
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 76
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.1.read_int_literal.19
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 108
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.1.read_int_literal.19
+  mov r10, 0
+  jmp .L.end.read_int_literal.19
+.L.1.read_int_literal.19:
+  mov r10, 1
+.L.end.read_int_literal.19:
+  cmp r10, 0
+  je .L.else.read_int_literal.18
+.loc 1 1254 5
+  lea r10, [rbp-128]
+  lea r11, [rbp-56]
+  mov [r11], r10
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+.loc 1 1255 5
+  mov r10, offset ty_long
+  mov r10, [r10]
+  lea r11, [rbp-88]
+  mov [r11], r10
+  jmp .L.end.read_int_literal.18
+.L.else.read_int_literal.18:
+.loc 1 1256 10
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 85
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.1.read_int_literal.21
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 117
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  jne .L.1.read_int_literal.21
+  mov r10, 0
+  jmp .L.end.read_int_literal.21
+.L.1.read_int_literal.21:
+  mov r10, 1
+.L.end.read_int_literal.21:
+  cmp r10, 0
+  je .L.else.read_int_literal.20
+.loc 1 1257 5
+  lea r10, [rbp-128]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+.loc 1 1258 5
+  mov r10, offset ty_uint
+  mov r10, [r10]
+  lea r11, [rbp-88]
+  mov [r11], r10
+  jmp .L.end.read_int_literal.20
+.L.else.read_int_literal.20:
+.loc 1 1259 10
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov r11, 63
+  mov rcx, r11
+  sar r10, cl
+  cmp r10, 0
+  je .L.else.read_int_literal.22
+.loc 1 1260 5
+  mov r10, offset ty_ulong
+  mov r10, [r10]
+  lea r11, [rbp-88]
+  mov [r11], r10
+  jmp .L.end.read_int_literal.22
+.L.else.read_int_literal.22:
+.loc 1 1261 10
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  mov r11, 31
+  mov rcx, r11
+  sar r10, cl
+  cmp r10, 0
+  je .L.end.read_int_literal.23
+.loc 1 1262 5
+  mov r10, offset ty_long
+  mov r10, [r10]
+  lea r11, [rbp-88]
+  mov [r11], r10
+.L.end.read_int_literal.23:
+.L.end.read_int_literal.22:
+.L.end.read_int_literal.20:
+.L.end.read_int_literal.18:
+.L.end.read_int_literal.16:
+.L.end.read_int_literal.14:
+.L.end.read_int_literal.6:
+.loc 1 1265 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset is_alnum
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.read_int_literal.24
+.loc 1 1266 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.208
+  push r10
+  sub rsp, 8
+  mov r10, offset error_at
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.read_int_literal.24:
+.loc 1 1268 56
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 3
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  lea r11, [rbp-136]
+  mov r11, [r11]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset new_token
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1269 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 32
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 64
+  mov [r11], r10
+.loc 1 1270 3
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 64
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 1271 3
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 64
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 1272 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.read_int_literal
+.L.return.read_int_literal:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+add_line:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 1277 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 32
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 36
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.add_line.1
+.loc 1 1278 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 36
+  mov r10d, dword ptr [r10]
+  cmp r10, 0
+  je  .L.else.add_line.2
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 36
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  imul r10d, r11d
+  mov r10d, r10d
+  jmp .L.end.add_line.2
+.L.else.add_line.2:
+  mov r10, 16
+  mov r10d, r10d
+.L.end.add_line.2:
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 36
+  mov [r11], r10d
+.loc 1 1279 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 24
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  movabs r10, 4
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 36
+  mov r11d, dword ptr [r11]
+  movsx r11, r11d
+  imul r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset realloc
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10
+.L.end.add_line.1:
+.loc 1 1281 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 8
+  mov r11, [r11]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 24
+  mov r11, [r11]
+  lea r12, [rbp-56]
+  mov r12, [r12]
+  add r12, 32
+  lea r13, [rbp-40]
+  mov [r13], r12
+  lea r12, [rbp-40]
+  mov r12, [r12]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, 1
+  mov r13d, r13d
+  add r12d, r13d
+  mov r12d, r12d
+  lea r13, [rbp-40]
+  mov r13, [r13]
+  mov [r13], r12d
+  lea r12, [rbp-40]
+  mov r12, [r12]
+  mov r12d, dword ptr [r12]
+  mov r12d, r12d
+  mov r13, -1
+  mov r13d, r13d
+  add r12d, r13d
+  mov r12d, r12d
+  mov r13, 4
+  mov r13d, r13d
+  imul r12d, r13d
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.L.return.add_line:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+new_line:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 1286 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset add_line
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1287 3
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 28
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.loc 1 1288 3
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10b
+.L.return.new_line:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+skip_chars_fast:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-72], rsi
+  mov [rbp-80], rdi
+.loc 1 1295 18
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1296 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset scan
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.skip_chars_fast.1:
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.break.skip_chars_fast.1
+.loc 1 1297 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_line
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1298 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-64]
+  mov [r11], r10
+.L.continue.skip_chars_fast.1:
+.loc 1 1296 46
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset scan
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-56]
+  mov [r11], r10
+  jmp .L.begin.skip_chars_fast.1
+.L.break.skip_chars_fast.1:
+.loc 1 1301 16
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1302 3
+.L.begin.skip_chars_fast.2:
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.0.skip_chars_fast.3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r11, 0
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  sub r11d, r12d
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset isspace
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.0.skip_chars_fast.3
+  mov r10, 1
+  jmp .L.end.skip_chars_fast.3
+.L.0.skip_chars_fast.3:
+  mov r10, 0
+.L.end.skip_chars_fast.3:
+  cmp r10, 0
+  je .L.break.skip_chars_fast.2
+.loc 1 1303 5
+  lea r10, [rbp-48]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+.L.continue.skip_chars_fast.2:
+  jmp .L.begin.skip_chars_fast.2
+.L.break.skip_chars_fast.2:
+.loc 1 1305 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.else.skip_chars_fast.4
+.loc 1 1306 5
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10b
+.loc 1 1307 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 33
+  mov [r11], r10b
+  jmp .L.end.skip_chars_fast.4
+.L.else.skip_chars_fast.4:
+.loc 1 1308 10
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.skip_chars_fast.5
+.loc 1 1309 5
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 33
+  mov [r11], r10b
+.L.end.skip_chars_fast.5:
+.L.end.skip_chars_fast.4:
+.loc 1 1311 3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.L.return.skip_chars_fast:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+skip_chars:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rsi
+  mov [rbp-56], rdi
+.loc 1 1317 3
+  mov r10, offset fast_lexer
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.end.skip_chars.1
+.loc 1 1318 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset skip_chars_fast
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1319 5
+  jmp .L.return.skip_chars
+.L.end.skip_chars.1:
+.loc 1 1322 3
+.L.begin.skip_chars.2:
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.break.skip_chars.2
+.loc 1 1323 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.skip_chars.3
+.loc 1 1324 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_line
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.skip_chars.3
+.L.else.skip_chars.3:
+.loc 1 1325 12
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset isspace
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.else.skip_chars.4
+.loc 1 1326 7
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 33
+  mov [r11], r10b
+  jmp .L.end.skip_chars.4
+.L.else.skip_chars.4:
+.loc 1 1328 7
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10b
+.loc 1 1329 7
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-56]
+  mov r11, [r11]
+  add r11, 33
+  mov [r11], r10b
+.L.end.skip_chars.4:
+.L.end.skip_chars.3:
+.L.continue.skip_chars.2:
+.loc 1 1322 23
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  add r10, 16
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  jmp .L.begin.skip_chars.2
+.L.break.skip_chars.2:
+.L.return.skip_chars:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+read_token:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 160
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-144], rsi
+  mov [rbp-152], rdi
+.loc 1 1337 18
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-136]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1339 3
+.L.begin.read_token.1:
+.loc 1 1341 5
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.read_token.2
+.loc 1 1342 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_line
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1343 7
+  lea r10, [rbp-136]
+  lea r11, [rbp-128]
+  mov [r11], r10
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-128]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+.loc 1 1344 7
+  jmp .L.continue.read_token.1
+.L.end.read_token.2:
+.loc 1 1348 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset isspace
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.read_token.3
+.loc 1 1349 7
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-152]
+  mov r11, [r11]
+  add r11, 33
+  mov [r11], r10b
+.loc 1 1350 7
+  mov r10, offset fast_lexer
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je  .L.else.read_token.4
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset scan
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.read_token.4
+.L.else.read_token.4:
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+.L.end.read_token.4:
+  lea r11, [rbp-136]
+  mov [r11], r10
+.loc 1 1351 7
+  jmp .L.continue.read_token.1
+.L.end.read_token.3:
+.loc 1 1355 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.209
+  push r10
+  sub rsp, 8
+  mov r10, offset startswith
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.read_token.5
+.loc 1 1356 7
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  lea r11, [rbp-152]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 1357 7
+  mov r10, offset fast_lexer
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.else.read_token.6
+.loc 1 1358 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, 2
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset scan
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-136]
+  mov [r11], r10
+  jmp .L.end.read_token.6
+.L.else.read_token.6:
+.loc 1 1360 9
+  lea r10, [rbp-136]
+  lea r11, [rbp-120]
+  mov [r11], r10
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-120]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1361 9
+.L.begin.read_token.7:
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.0.read_token.8
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  setne al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.0.read_token.8
+  mov r10, 1
+  jmp .L.end.read_token.8
+.L.0.read_token.8:
+  mov r10, 0
+.L.end.read_token.8:
+  cmp r10, 0
+  je .L.break.read_token.7
+.loc 1 1362 11
+  lea r10, [rbp-136]
+  lea r11, [rbp-112]
+  mov [r11], r10
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+.L.continue.read_token.7:
+  jmp .L.begin.read_token.7
+.L.break.read_token.7:
+.L.end.read_token.6:
+.loc 1 1364 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset skip_chars
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1365 7
+  jmp .L.continue.read_token.1
+.L.end.read_token.5:
+.loc 1 1369 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.210
+  push r10
+  sub rsp, 8
+  mov r10, offset startswith
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.read_token.9
+.loc 1 1370 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.211
+  push r10
+  sub rsp, 8
+  mov r10, offset strstr
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-104]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1371 7
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.read_token.10
+.loc 1 1372 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.212
+  push r10
+  sub rsp, 8
+  mov r10, offset error_at
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.read_token.10:
+.loc 1 1373 7
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  lea r11, [rbp-152]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 1374 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset skip_chars
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1375 7
+  lea r10, [rbp-104]
+  mov r10, [r10]
+  mov r11, 2
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-136]
+  mov [r11], r10
+.loc 1 1376 7
+  jmp .L.continue.read_token.1
+.L.end.read_token.9:
+.loc 1 1379 5
+  jmp .L.break.read_token.1
+.L.continue.read_token.1:
+  jmp .L.begin.read_token.1
+.L.break.read_token.1:
+.loc 1 1382 3
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  lea r11, [rbp-152]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 1383 3
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.read_token.11
+.loc 1 1384 5
+  mov r10, 0
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.read_token
+.L.end.read_token.11:
+.loc 1 1386 3
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 34
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.read_token.12
+.loc 1 1388 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset read_string_leteral
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-144]
+  mov [r11], r10
+  jmp .L.end.read_token.12
+.L.else.read_token.12:
+.loc 1 1389 10
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 39
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.else.read_token.13
+.loc 1 1391 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset read_char_literal
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-144]
+  mov [r11], r10
+  jmp .L.end.read_token.13
+.L.else.read_token.13:
+.loc 1 1392 10
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset is_alpha
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.else.read_token.14
+.loc 1 1394 5
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-96]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1395 5
+  mov r10, offset fast_lexer
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  je .L.else.read_token.15
+.loc 1 1396 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset scan
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-96]
+  mov [r11], r10
+  jmp .L.end.read_token.15
+.L.else.read_token.15:
+.loc 1 1398 7
+.L.begin.read_token.16:
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  movsx r10, r10b
+  push r10
+  sub rsp, 8
+  mov r10, offset is_alnum
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.break.read_token.16
+.loc 1 1399 9
+  lea r10, [rbp-96]
+  lea r11, [rbp-88]
+  mov [r11], r10
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-88]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-88]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+.L.continue.read_token.16:
+  jmp .L.begin.read_token.16
+.L.break.read_token.16:
+.L.end.read_token.15:
+.loc 1 1400 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  lea r11, [rbp-136]
+  mov r11, [r11]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset new_token
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-144]
+  mov [r11], r10
+.loc 1 1401 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset word_ids
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  lea r11, [rbp-136]
+  mov r11, [r11]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset hashmap_get2
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  mov r10d, r10d
+  lea r11, [rbp-144]
+  mov r11, [r11]
+  add r11, 4
+  mov [r11], r10d
+.loc 1 1402 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  lea r11, [rbp-136]
+  mov r11, [r11]
+  sub r10, r11
+  mov r11, 1
+  movsx r11, r11d
+  mov rax, r10
+  cqo
+  idiv r11
+  mov r10, rax
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset intern
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-144]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10
+  jmp .L.end.read_token.14
+.L.else.read_token.14:
+.loc 1 1403 10
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset ispunct
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.else.read_token.17
+.loc 1 1405 5
+  mov r10, offset punct_ids
+  lea r11, [rbp-136]
+  mov r11, [r11]
+  movsx r11d, byte ptr [r11]
+  movzx r11, r11b
+  mov r11d, r11d
+  mov r12, 20
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1406 5
+.L.begin.read_token.18:
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  cmp r10, 0
+  je .L.break.read_token.18
+.loc 1 1407 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset token_names
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset startswith
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  movzx eax, al
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.end.read_token.19
+.loc 1 1408 9
+  jmp .L.break.read_token.18
+.L.end.read_token.19:
+.L.continue.read_token.18:
+.loc 1 1406 18
+  lea r10, [rbp-80]
+  lea r11, [rbp-72]
+  mov [r11], r10
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-72]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 4
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  jmp .L.begin.read_token.18
+.L.break.read_token.18:
+.loc 1 1409 51
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  cmp r10, 0
+  je  .L.else.read_token.20
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset token_names
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 8
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset strlen
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.read_token.20
+.L.else.read_token.20:
+  mov r10, 1
+  movsx r10, r10d
+.L.end.read_token.20:
+  mov r10d, r10d
+  lea r11, [rbp-60]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+.loc 1 1410 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-60]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset new_token
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-144]
+  mov [r11], r10
+.loc 1 1411 5
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-144]
+  mov r11, [r11]
+  add r11, 4
+  mov [r11], r10d
+  jmp .L.end.read_token.17
+.L.else.read_token.17:
+.loc 1 1412 10
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset isdigit
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  cmp r10, 0
+  je .L.else.read_token.21
+.loc 1 1414 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset read_int_literal
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-144]
+  mov [r11], r10
+  jmp .L.end.read_token.21
+.L.else.read_token.21:
+.loc 1 1416 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset .L.data.213
+  push r10
+  sub rsp, 8
+  mov r10, offset error_at
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.read_token.21:
+.L.end.read_token.17:
+.L.end.read_token.14:
+.L.end.read_token.13:
+.L.end.read_token.12:
+.loc 1 1419 3
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  add r10, 28
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-144]
+  mov r11, [r11]
+  add r11, 28
+  mov [r11], r10d
+.loc 1 1420 3
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  add r10, 32
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-144]
+  mov r11, [r11]
+  add r11, 48
+  mov [r11], r10b
+.loc 1 1421 3
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  add r10, 33
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-144]
+  mov r11, [r11]
+  add r11, 49
+  mov [r11], r10b
+.loc 1 1422 3
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-152]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10b
+.loc 1 1423 3
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-152]
+  mov r11, [r11]
+  add r11, 33
+  mov [r11], r10b
+.loc 1 1424 3
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  lea r11, [rbp-144]
+  mov r11, [r11]
+  add r11, 24
+  mov r11d, dword ptr [r11]
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-152]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 1427 3
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 2
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.read_token.22
+.loc 1 1428 5
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.read_token.23:
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-152]
+  mov r11, [r11]
+  add r11, 16
+  mov r11, [r11]
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.break.read_token.23
+.loc 1 1429 7
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  movsx r10d, byte ptr [r10]
+  mov r10d, r10d
+  mov r11, 10
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.read_token.24
+.loc 1 1430 9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  push r10
+  sub rsp, 8
+  mov r10, offset add_line
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1431 9
+  lea r10, [rbp-152]
+  mov r10, [r10]
+  add r10, 28
+  lea r11, [rbp-40]
+  mov [r11], r10
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  add r10d, r11d
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10d
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, -1
+  mov r11d, r11d
+  add r10d, r11d
+.L.end.read_token.24:
+.L.continue.read_token.23:
+.loc 1 1428 34
+  lea r10, [rbp-56]
+  lea r11, [rbp-48]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  mov r11d, r11d
+  mov r12, 1
+  mov r12d, r12d
+  imul r11d, r12d
+  movsx r11, r11d
+  add r10, r11
+  jmp .L.begin.read_token.23
+.L.break.read_token.23:
+.L.end.read_token.22:
+.loc 1 1435 3
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.read_token
+.L.return.read_token:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+copy_src_token:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-56], rsi
+  mov [rbp-64], rdi
+.loc 1 1441 23
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1442 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 4
+  mov r11d, r11d
+  cmp r10d, r11d
+  sete al
+  movzb r10d, al
+  cmp r10, 0
+  je .L.end.copy_src_token.1
+.loc 1 1443 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 1444 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 28
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 28
+  mov [r11], r10d
+.loc 1 1445 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 48
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10b
+.loc 1 1446 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 49
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 33
+  mov [r11], r10b
+.loc 1 1447 5
+  mov r10, 0
+  movsx r10, r10d
+  mov rax, r10
+  jmp .L.return.copy_src_token
+.L.end.copy_src_token.1:
+.loc 1 1450 61
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 0
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 24
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset new_token
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1451 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov al, [r10+0]
+  mov [r11+0], al
+  mov al, [r10+1]
+  mov [r11+1], al
+  mov al, [r10+2]
+  mov [r11+2], al
+  mov al, [r10+3]
+  mov [r11+3], al
+  mov al, [r10+4]
+  mov [r11+4], al
+  mov al, [r10+5]
+  mov [r11+5], al
+  mov al, [r10+6]
+  mov [r11+6], al
+  mov al, [r10+7]
+  mov [r11+7], al
+  mov al, [r10+8]
+  mov [r11+8], al
+  mov al, [r10+9]
+  mov [r11+9], al
+  mov al, [r10+10]
+  mov [r11+10], al
+  mov al, [r10+11]
+  mov [r11+11], al
+  mov al, [r10+12]
+  mov [r11+12], al
+  mov al, [r10+13]
+  mov [r11+13], al
+  mov al, [r10+14]
+  mov [r11+14], al
+  mov al, [r10+15]
+  mov [r11+15], al
+  mov al, [r10+16]
+  mov [r11+16], al
+  mov al, [r10+17]
+  mov [r11+17], al
+  mov al, [r10+18]
+  mov [r11+18], al
+  mov al, [r10+19]
+  mov [r11+19], al
+  mov al, [r10+20]
+  mov [r11+20], al
+  mov al, [r10+21]
+  mov [r11+21], al
+  mov al, [r10+22]
+  mov [r11+22], al
+  mov al, [r10+23]
+  mov [r11+23], al
+  mov al, [r10+24]
+  mov [r11+24], al
+  mov al, [r10+25]
+  mov [r11+25], al
+  mov al, [r10+26]
+  mov [r11+26], al
+  mov al, [r10+27]
+  mov [r11+27], al
+  mov al, [r10+28]
+  mov [r11+28], al
+  mov al, [r10+29]
+  mov [r11+29], al
+  mov al, [r10+30]
+  mov [r11+30], al
+  mov al, [r10+31]
+  mov [r11+31], al
+  mov al, [r10+32]
+  mov [r11+32], al
+  mov al, [r10+33]
+  mov [r11+33], al
+  mov al, [r10+34]
+  mov [r11+34], al
+  mov al, [r10+35]
+  mov [r11+35], al
+  mov al, [r10+36]
+  mov [r11+36], al
+  mov al, [r10+37]
+  mov [r11+37], al
+  mov al, [r10+38]
+  mov [r11+38], al
+  mov al, [r10+39]
+  mov [r11+39], al
+  mov al, [r10+40]
+  mov [r11+40], al
+  mov al, [r10+41]
+  mov [r11+41], al
+  mov al, [r10+42]
+  mov [r11+42], al
+  mov al, [r10+43]
+  mov [r11+43], al
+  mov al, [r10+44]
+  mov [r11+44], al
+  mov al, [r10+45]
+  mov [r11+45], al
+  mov al, [r10+46]
+  mov [r11+46], al
+  mov al, [r10+47]
+  mov [r11+47], al
+  mov al, [r10+48]
+  mov [r11+48], al
+  mov al, [r10+49]
+  mov [r11+49], al
+  mov al, [r10+50]
+  mov [r11+50], al
+  mov al, [r10+51]
+  mov [r11+51], al
+  mov al, [r10+52]
+  mov [r11+52], al
+  mov al, [r10+53]
+  mov [r11+53], al
+  mov al, [r10+54]
+  mov [r11+54], al
+  mov al, [r10+55]
+  mov [r11+55], al
+  mov al, [r10+56]
+  mov [r11+56], al
+  mov al, [r10+57]
+  mov [r11+57], al
+  mov al, [r10+58]
+  mov [r11+58], al
+  mov al, [r10+59]
+  mov [r11+59], al
+  mov al, [r10+60]
+  mov [r11+60], al
+  mov al, [r10+61]
+  mov [r11+61], al
+  mov al, [r10+62]
+  mov [r11+62], al
+  mov al, [r10+63]
+  mov [r11+63], al
+  mov al, [r10+64]
+  mov [r11+64], al
+  mov al, [r10+65]
+  mov [r11+65], al
+  mov al, [r10+66]
+  mov [r11+66], al
+  mov al, [r10+67]
+  mov [r11+67], al
+  mov al, [r10+68]
+  mov [r11+68], al
+  mov al, [r10+69]
+  mov [r11+69], al
+  mov al, [r10+70]
+  mov [r11+70], al
+  mov al, [r10+71]
+  mov [r11+71], al
+.loc 1 1452 3
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 1453 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 56
+  mov [r11], r10
+.loc 1 1454 3
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 50
+  mov [r11], r10b
+.loc 1 1455 3
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 51
+  mov [r11], r10b
+.loc 1 1456 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  add r11, 56
+  mov [r11], r10
+.loc 1 1457 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.copy_src_token
+.L.return.copy_src_token:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+lex:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-84], esi
+  mov [rbp-96], rdi
+.loc 1 1464 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset timer_start
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1465 3
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  mov r11, offset current_file
+  mov [r11], r10
+.loc 1 1466 3
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 24
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov r11, offset current_lazy
+  mov [r11], r10b
+.loc 1 1468 24
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1469 15
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-72]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1470 3
+.L.begin.lex.1:
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  lea r11, [rbp-84]
+  mov r11d, dword ptr [r11]
+  movsx r11, r11d
+  cmp r10, r11
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L.break.lex.1
+.loc 1 1471 5
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  cmp r10, 0
+  je  .L.else.lex.2
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset copy_src_token
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  jmp .L.end.lex.2
+.L.else.lex.2:
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset read_token
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.lex.2:
+  lea r11, [rbp-56]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1472 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.lex.3
+.loc 1 1473 7
+  jmp .L.break.lex.1
+.L.end.lex.3:
+.loc 1 1474 5
+  lea r10, [rbp-56]
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov [r11], r10
+.L.continue.lex.1:
+.loc 1 1470 19
+  lea r10, [rbp-72]
+  lea r11, [rbp-64]
+  mov [r11], r10
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, 1
+  movsx r11, r11d
+  add r10, r11
+  lea r11, [rbp-64]
+  mov r11, [r11]
+  mov [r11], r10
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, -1
+  movsx r11, r11d
+  add r10, r11
+  jmp .L.begin.lex.1
+.L.break.lex.1:
+.loc 1 1476 3
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  lea r11, [rbp-96]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.loc 1 1477 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 1
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset timer_count
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1479 3
+  lea r10, [rbp-72]
+  mov r10, [r10]
+  lea r11, [rbp-84]
+  mov r11d, dword ptr [r11]
+  movsx r11, r11d
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.lex.4
+.loc 1 1480 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset timer_stop
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1481 5
+  jmp .L.return.lex
+.L.end.lex.4:
+.loc 1 1484 3
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 48
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.else.lex.5
+.loc 1 1485 5
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 48
+  mov r10, [r10]
+  lea r11, [rbp-80]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+  jmp .L.end.lex.5
+.L.else.lex.5:
+.loc 1 1487 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 4
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-80]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 16
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 0
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset new_token
+  add rsp, 8
+  pop rcx
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-48]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1488 5
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 28
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 28
+  mov [r11], r10d
+.loc 1 1489 5
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 32
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 48
+  mov [r11], r10b
+.loc 1 1490 5
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 33
+  movsx r10d, byte ptr [r10]
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  add r11, 49
+  mov [r11], r10b
+.loc 1 1491 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-96]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.L.end.lex.5:
+.loc 1 1493 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 28
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  mov r11, 1
+  mov r11d, r11d
+  sub r10d, r11d
+  movsx r10, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset timer_count_lines
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1496 3
+  mov r10, offset lexers
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.lex.6:
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.lex.6
+.loc 1 1497 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  lea r11, [rbp-96]
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.lex.7
+.loc 1 1498 7
+  lea r10, [rbp-96]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  mov [r11], r10
+.loc 1 1499 7
+  jmp .L.break.lex.6
+.L.end.lex.7:
+.L.continue.lex.6:
+.loc 1 1496 35
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov r10, [r10]
+  add r10, 0
+  lea r11, [rbp-40]
+  mov [r11], r10
+  jmp .L.begin.lex.6
+.L.break.lex.6:
+.loc 1 1502 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset timer_stop
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.return.lex:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl new_file
+new_file:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdx
+  mov [rbp-52], esi
+  mov [rbp-64], rdi
+.loc 1 1506 48
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 13
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 40
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1507 3
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 1508 3
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10d
+.loc 1 1509 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 1510 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.new_file
+.L.return.new_file:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+new_lexer:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdx
+  mov [rbp-52], esi
+  mov [rbp-64], rdi
+.loc 1 1514 3
+  mov r10, offset word_ids
+  add r10, 8
+  mov r10d, dword ptr [r10]
+  cmp r10, 0
+  sete r10b
+  movzx r10, r10b
+  cmp r10, 0
+  je .L.end.new_lexer.1
+.loc 1 1515 5
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, offset init_token_ids
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.L.end.new_lexer.1:
+.loc 1 1517 48
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 13
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 64
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1518 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-64]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-52]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_file
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 1519 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10
+.loc 1 1520 3
+  mov r10, 1
+  mov r10d, r10d
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 28
+  mov [r11], r10d
+.loc 1 1521 3
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-40]
+  mov r11, [r11]
+  add r11, 32
+  mov [r11], r10b
+.loc 1 1522 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset add_line
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1523 3
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.new_lexer
+.L.return.new_lexer:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl next_token
+next_token:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-48], rdi
+.loc 1 1529 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.end.next_token.1
+.loc 1 1530 5
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.next_token
+.L.end.next_token.1:
+.loc 1 1532 3
+  mov r10, offset lexers
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.L.begin.next_token.2:
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  cmp r10, 0
+  je .L.break.next_token.2
+.loc 1 1533 5
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 40
+  mov r10, [r10]
+  lea r11, [rbp-48]
+  mov r11, [r11]
+  cmp r10, r11
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L.end.next_token.3
+.loc 1 1534 7
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 64
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset lex
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1535 7
+  jmp .L.break.next_token.2
+.L.end.next_token.3:
+.L.continue.next_token.2:
+.loc 1 1532 32
+  lea r10, [rbp-40]
+  mov r10, [r10]
+  add r10, 0
+  mov r10, [r10]
+  lea r11, [rbp-40]
+  mov [r11], r10
+  jmp .L.begin.next_token.2
+.L.break.next_token.2:
+.loc 1 1538 3
+  lea r10, [rbp-48]
+  mov r10, [r10]
+  add r10, 8
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.next_token
+.L.return.next_token:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl tokenize_lazy
+tokenize_lazy:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 144
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-120], rcx
+  mov [rbp-128], rdx
+  mov [rbp-132], esi
+  mov [rbp-144], rdi
+.loc 1 1545 46
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-132]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-128]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_lexer
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-112]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1546 3
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10b
+.loc 1 1547 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  add r11, 48
+  mov [r11], r10
+.loc 1 1548 3
+  mov r10, offset lexers
+  mov r10, [r10]
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 1549 3
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  mov r11, offset lexers
+  mov [r11], r10
+.loc 1 1551 18
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-104]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-104]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-104]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-104]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-104]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-104]
+  mov r12, 28
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-104]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-104]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-104]
+  mov r12, 48
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-104]
+  mov r12, 49
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-104]
+  mov r12, 50
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-104]
+  mov r12, 51
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-104]
+  mov r12, 56
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-104]
+  mov r12, 64
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1552 3
+  lea r10, [rbp-104]
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.loc 1 1553 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 64
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset lex
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1554 3
+  lea r10, [rbp-104]
+  add r10, 8
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.tokenize_lazy
+.L.return.tokenize_lazy:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl tokenize_cached
+tokenize_cached:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 144
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-120], rcx
+  mov [rbp-124], edx
+  mov [rbp-136], rsi
+  mov [rbp-144], rdi
+.loc 1 1561 48
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 13
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 64
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-112]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1562 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  mov r10, 13
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  movabs r10, 40
+  push r10
+  sub rsp, 8
+  mov r10, offset alloc_obj
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  add r11, 8
+  mov [r11], r10
+.loc 1 1563 3
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  add r10, 56
+  mov r10, [r10]
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  add r11, 8
+  mov r11, [r11]
+  mov al, [r10+0]
+  mov [r11+0], al
+  mov al, [r10+1]
+  mov [r11+1], al
+  mov al, [r10+2]
+  mov [r11+2], al
+  mov al, [r10+3]
+  mov [r11+3], al
+  mov al, [r10+4]
+  mov [r11+4], al
+  mov al, [r10+5]
+  mov [r11+5], al
+  mov al, [r10+6]
+  mov [r11+6], al
+  mov al, [r10+7]
+  mov [r11+7], al
+  mov al, [r10+8]
+  mov [r11+8], al
+  mov al, [r10+9]
+  mov [r11+9], al
+  mov al, [r10+10]
+  mov [r11+10], al
+  mov al, [r10+11]
+  mov [r11+11], al
+  mov al, [r10+12]
+  mov [r11+12], al
+  mov al, [r10+13]
+  mov [r11+13], al
+  mov al, [r10+14]
+  mov [r11+14], al
+  mov al, [r10+15]
+  mov [r11+15], al
+  mov al, [r10+16]
+  mov [r11+16], al
+  mov al, [r10+17]
+  mov [r11+17], al
+  mov al, [r10+18]
+  mov [r11+18], al
+  mov al, [r10+19]
+  mov [r11+19], al
+  mov al, [r10+20]
+  mov [r11+20], al
+  mov al, [r10+21]
+  mov [r11+21], al
+  mov al, [r10+22]
+  mov [r11+22], al
+  mov al, [r10+23]
+  mov [r11+23], al
+  mov al, [r10+24]
+  mov [r11+24], al
+  mov al, [r10+25]
+  mov [r11+25], al
+  mov al, [r10+26]
+  mov [r11+26], al
+  mov al, [r10+27]
+  mov [r11+27], al
+  mov al, [r10+28]
+  mov [r11+28], al
+  mov al, [r10+29]
+  mov [r11+29], al
+  mov al, [r10+30]
+  mov [r11+30], al
+  mov al, [r10+31]
+  mov [r11+31], al
+  mov al, [r10+32]
+  mov [r11+32], al
+  mov al, [r10+33]
+  mov [r11+33], al
+  mov al, [r10+34]
+  mov [r11+34], al
+  mov al, [r10+35]
+  mov [r11+35], al
+  mov al, [r10+36]
+  mov [r11+36], al
+  mov al, [r10+37]
+  mov [r11+37], al
+  mov al, [r10+38]
+  mov [r11+38], al
+  mov al, [r10+39]
+  mov [r11+39], al
+.loc 1 1564 3
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  add r11, 8
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 1565 3
+  lea r10, [rbp-124]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  add r11, 8
+  mov r11, [r11]
+  add r11, 16
+  mov [r11], r10d
+.loc 1 1566 3
+  lea r10, [rbp-144]
+  mov r10, [r10]
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  add r11, 56
+  mov [r11], r10
+.loc 1 1567 3
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  add r11, 24
+  mov [r11], r10b
+.loc 1 1568 3
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  add r11, 48
+  mov [r11], r10
+.loc 1 1569 3
+  mov r10, offset lexers
+  mov r10, [r10]
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  add r11, 0
+  mov [r11], r10
+.loc 1 1570 3
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  mov r11, offset lexers
+  mov [r11], r10
+.loc 1 1572 18
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-104]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-104]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-104]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-104]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-104]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-104]
+  mov r12, 28
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-104]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-104]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-104]
+  mov r12, 48
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-104]
+  mov r12, 49
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-104]
+  mov r12, 50
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-104]
+  mov r12, 51
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-104]
+  mov r12, 56
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-104]
+  mov r12, 64
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1573 3
+  lea r10, [rbp-104]
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.loc 1 1574 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 64
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset lex
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1575 3
+  lea r10, [rbp-104]
+  add r10, 8
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.tokenize_cached
+.L.return.tokenize_cached:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl tokenize
+tokenize:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 144
+  mov [rbp-8], r12
+  mov [rbp-16], r13
+  mov [rbp-24], r14
+  mov [rbp-32], r15
+  mov [rbp-120], rdx
+  mov [rbp-124], esi
+  mov [rbp-136], rdi
+.loc 1 1580 46
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-136]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-124]
+  mov r10d, dword ptr [r10]
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  lea r10, [rbp-120]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, offset new_lexer
+  add rsp, 8
+  pop rdx
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+  lea r11, [rbp-112]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1581 18
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-104]
+  mov r12, 0
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-104]
+  mov r12, 4
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-104]
+  mov r12, 8
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-104]
+  mov r12, 16
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-104]
+  mov r12, 24
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  mov r10d, r10d
+  lea r11, [rbp-104]
+  mov r12, 28
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10d
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-104]
+  mov r12, 32
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-104]
+  mov r12, 40
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-104]
+  mov r12, 48
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-104]
+  mov r12, 49
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-104]
+  mov r12, 50
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  lea r11, [rbp-104]
+  mov r12, 51
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10b
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-104]
+  mov r12, 56
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+  mov r10, 0
+  movsx r10, r10d
+  lea r11, [rbp-104]
+  mov r12, 64
+  movsx r12, r12d
+  add r11, r12
+  mov [r11], r10
+.loc 1 1582 3
+  lea r10, [rbp-104]
+  lea r11, [rbp-112]
+  mov r11, [r11]
+  add r11, 40
+  mov [r11], r10
+.loc 1 1583 3
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r10, [rbp-112]
+  mov r10, [r10]
+  push r10
+  sub rsp, 8
+  mov r10, 2147483647
+  mov r10d, r10d
+  push r10
+  sub rsp, 8
+  mov r10, offset lex
+  add rsp, 8
+  pop rsi
+  add rsp, 8
+  pop rdi
+  mov rax, 0
+  call r10
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  mov r10, rax
+.loc 1 1584 3
+  lea r10, [rbp-104]
+  add r10, 8
+  mov r10, [r10]
+  mov rax, r10
+  jmp .L.return.tokenize
+.L.return.tokenize:
+  mov r12, [rbp-8]
+  mov r13, [rbp-16]
+  mov r14, [rbp-24]
+  mov r15, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
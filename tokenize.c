@@ -1,10 +1,65 @@
+// This file implements the tokenizer.
+//
+// A file is tokenized lazily: tokenize_lazy() reads only the first
+// few tokens, and the rest are read on demand when the preprocessor
+// asks for the token following the last one read so far by calling
+// next_token(). Tokens that the preprocessor consumes without
+// passing them on, such as directives and skipped conditional
+// blocks, are given back with free_token() and reused for tokens
+// read later, so that they don't pile up while a large file is
+// being preprocessed.
+//
+// A file that has been tokenized before can be read again with
+// tokenize_cached(), which copies its tokens on demand in the same
+// way instead of reading characters.
+
 #include "punyc.h"
 
-// Input filename
-static char *current_filename;
+// The number of tokens read at once by next_token().
+enum { LEX_BATCH = 64 };
+
+// If false, the input is scanned one character at a time, which is
+// the reference behavior the fast paths must match.
+bool fast_lexer = true;
+
+// What scan() looks for
+typedef enum {
+  SCAN_IDENT, // The end of an identifier
+  SCAN_BLANK, // The end of a run of spaces and tabs
+  SCAN_EOL,   // A newline
+  SCAN_STR,   // A double-quote or a backslash
+} ScanKind;
+
+// A lexer reads tokens from a single input string.
+typedef struct Lexer Lexer;
+struct Lexer {
+  Lexer *next;
+  File *file;
+  char *p;      // Current position
+  bool lazy;    // True if tokens are read on demand
+
+  // Position info for the next token
+  int lineno;
+  bool at_bol;
+  bool has_space;
+
+  Token *last;  // The last token read so far
+  Token *cont;  // The token that follows the end of input
+
+  Token *src;   // If not NULL, the tokens to copy instead of reading p
+};
 
-// Input string
-static char *current_input;
+// Lexers of lazily tokenized files that have not reached the end.
+static Lexer *lexers;
+
+// Recycled tokens
+static Token *free_tokens;
+
+// Input file
+static File *current_file;
+
+// True if the input is lazily tokenized
+static bool current_lazy;
 
 // Reports an error and exit.
 void error(char *fmt, ...) {
@@ -15,23 +70,52 @@ void error(char *fmt, ...) {
   exit(1);
 }
 
+// Returns the beginning of the line containing `loc`, which is
+// line `lineno` of a given file.
+static char *line_start(File *file, int lineno, char *loc) {
+  if (0 < lineno && lineno <= file->nr_lines)
+    return file->contents + file->lines[lineno - 1];
+
+  // Files restored from a precompiled header have no line table.
+  while (file->contents < loc && loc[-1] != '\n')
+    loc--;
+  return loc;
+}
+
+// Returns the line number of `loc` in a given file.
+static int find_line(File *file, char *loc) {
+  long off = loc - file->contents;
+  int lo = 0;
+  int hi = file->nr_lines;
+  while (hi - lo > 1) {
+    int mid = (lo + hi) / 2;
+    if (file->lines[mid] <= off)
+      lo = mid;
+    else
+      hi = mid;
+  }
+  return lo + 1;
+}
+
+// Returns the 1-based column of a given token.
+int get_column(Token *tok) {
+  long col = tok->loc - line_start(tok->file, tok->lineno, tok->loc);
+  return col + 1;
+}
+
 // Reports an error message in the following format.
 //
 // foo.c:10 x = y + 1;
 //              ^ <error message here>
-static void verror_at(char *filename, char *input, int lineno,
-                      char *loc, char *fmt, va_list ap) {
-  // Find a line containinc `loc`.
-  char *line = loc;
-  while (input < line && line[-1] != '\n')
-    line--;
-
+static void verror_at(File *file, int lineno, char *loc, char *fmt,
+                      va_list ap) {
+  char *line = line_start(file, lineno, loc);
   char *end = loc;
   while (*end && *end != '\n')
     end++;
 
   // Print out the line.
-  int indent = fprintf(stderr, "%s:%d ", filename, lineno);
+  int indent = fprintf(stderr, "%s:%d ", file->name, lineno);
   fprintf(stderr, "%.*s\n", (int)(end - line), line);
 
   // Show the error maessage.
@@ -44,45 +128,103 @@ static void verror_at(char *filename, char *input, int lineno,
 }
 
 static void error_at(char *loc, char *fmt, ...) {
-  int lineno = 1;
-  for (char *p = current_input; p < loc; p++)
-    if (*p == '\n')
-      lineno++;
-
   va_list ap;
   va_start(ap, fmt);
-  verror_at(current_filename, current_input, lineno, loc, fmt, ap);
+  verror_at(current_file, find_line(current_file, loc), loc, fmt, ap);
   exit(1);
 }
 
 void error_tok(Token *tok, char *fmt, ...) {
   va_list ap;
   va_start(ap, fmt);
-  verror_at(tok->filename, tok->input, tok->lineno, tok->loc, fmt, ap);
+  verror_at(tok->file, tok->lineno, tok->loc, fmt, ap);
   exit(1);
 }
 
 void warn_tok(Token *tok, char *fmt, ...) {
   va_list ap;
   va_start(ap, fmt);
-  verror_at(tok->filename, tok->input, tok->lineno, tok->loc, fmt, ap);
+  verror_at(tok->file, tok->lineno, tok->loc, fmt, ap);
+}
+
+// Spellings of keywords, directive names and punctuators, indexed
+// by TokenId.
+static char *token_names[] = {
+  "",
+  "return", "if", "else", "for", "while", "int", "sizeof", "char",
+  "struct", "union", "short", "long", "void", "typedef", "_Bool",
+  "enum", "static", "break", "continue", "goto", "switch", "case",
+  "default", "extern", "alignof", "_Alignas", "do", "signed",
+  "unsigned", "const", "volatile",
+  "include", "define", "undef", "ifdef", "ifndef", "elif", "endif",
+  "pragma", "defined", "once",
+  "...", "<<=", ">>=",
+  "==", "!=", "<=", ">=", "->", "+=", "-=", "*=", "/=", "++", "--",
+  "%=", "&=", "|=", "^=", "&&", "||", "<<", ">>", "##",
+  "(", ")", "{", "}", "[", "]", ";", ",", ".", "=", "<", ">", "+", "-",
+  "*", "/", "%", "&", "|", "^", "~", "!", "?", ":", "#",
+};
+
+// Maps keywords and directive names to their IDs.
+static HashMap word_ids;
+
+// Interned identifiers
+static HashMap names;
+
+// For each character, IDs of punctuators starting with it, longest
+// first and terminated by ID_NONE. No more than four punctuators
+// share the same first character.
+static TokenId punct_ids[256][5];
+
+static void init_token_ids(void) {
+  for (int i = KW_RETURN; i < P_ELLIPSIS; i++)
+    hashmap_put(&word_ids, token_names[i], (void *)(long)i);
+
+  for (int i = P_ELLIPSIS; i < NR_TOKEN_IDS; i++) {
+    TokenId *ids = punct_ids[(unsigned char)token_names[i][0]];
+    while (*ids)
+      ids++;
+    *ids = i;
+  }
 }
 
-// Consumes the current token if it matches `s`.
-bool equal(Token *tok, char *op) {
-  return strlen(op) == tok->len &&
-         !strncmp(tok->loc, op, tok->len);
+// Returns the canonical copy of a given identifier. Identifiers are
+// interned when they are read, so that names can be compared by
+// pointer instead of by contents.
+//
+// Interned names are numbered in the order they are first seen.
+// The number is stored right before the name. Names are not
+// allocated from the arena, as they must outlive objects in an
+// arena that is released early (see enter_arena()).
+char *intern(char *s, int len) {
+  char *name = hashmap_get2(&names, s, len);
+  if (name)
+    return name;
+
+  count_alloc(AK_STRING, sizeof(long) + len + 1);
+  long *p = calloc(1, sizeof(long) + len + 1);
+  *p = names.used;
+  name = (char *)(p + 1);
+  memcpy(name, s, len);
+  hashmap_put2(&names, name, len, name);
+  return name;
+}
+
+// Returns the number of an interned name.
+long name_id(char *name) {
+  return ((long *)name)[-1];
 }
 
-// Ensure that the current token is `s`.
-Token *skip(Token *tok, char *op) {
-  if (!equal(tok, op))
-    error_tok(tok, "expected '%s'", op);
+// Ensure that the current token is `id`.
+Token *skip(Token *tok, TokenId id) {
+  if (tok->id != id)
+    error_tok(tok, "expected '%s'", token_names[id]);
   return tok->next;
 }
 
-bool consume(Token **rest, Token *tok, char *str) {
-  if (equal(tok, str)) {
+// Consumes the current token if it is `id`.
+bool consume(Token **rest, Token *tok, TokenId id) {
+  if (tok->id == id) {
     *rest = tok->next;
     return true;
   }
@@ -92,16 +234,101 @@ bool consume(Token **rest, Token *tok, char *str) {
 
 // Create a new token and add it as the next token of `cur`.
 static Token *new_token(TokenKind kind, Token *cur, char *str, int len) {
-  Token *tok = calloc(1, sizeof(Token));
+  Token *tok;
+  if (free_tokens) {
+    tok = free_tokens;
+    free_tokens = tok->next;
+    memset(tok, 0, sizeof(Token));
+  } else {
+    tok = alloc_obj(AK_TOKEN, sizeof(Token));
+  }
+
   tok->kind = kind;
   tok->loc = str;
   tok->len = len;
-  tok->filename = current_filename;
-  tok->input = current_input;
+  tok->file = current_file;
+  tok->is_raw = current_lazy;
   cur->next = tok;
   return tok;
 }
 
+// Gives back a token that is no longer referenced from anywhere so
+// that it can be reused. Only tokens read from a file are recycled;
+// others may be shared (e.g. a macro body), so they are left alone.
+void free_token(Token *tok) {
+  if (!tok->is_raw)
+    return;
+  tok->next = free_tokens;
+  free_tokens = tok;
+}
+
+// The fast paths below scan the input a word (8 bytes) at a time,
+// testing all bytes of a word at once with the same bit tricks as
+// strlen(). In a mask computed from a word, the high bit of each
+// byte is set if the byte satisfies a condition. Words are always
+// read from aligned addresses, so a read never crosses a page
+// boundary beyond the terminating '\0', at which every scan stops.
+//
+// For a byte b with the high bit clear, b + (128 - lo) has the
+// high bit set iff b >= lo, and no carry goes to the next byte.
+// Likewise, b ^ c is zero iff b == c.
+
+// Returns a mask of bytes at which a scan of a given kind stops.
+static unsigned long stop_bytes(ScanKind kind, unsigned long x) {
+  unsigned long ones = 0x0101010101010101;
+  unsigned long highs = 0x8080808080808080;
+  unsigned long x7 = x & ~highs;
+
+  switch (kind) {
+  case SCAN_IDENT: {
+    // [0-9A-Za-z_]
+    unsigned long m = (x7 + ones * (128 - '0')) & ~(x7 + ones * (127 - '9'));
+    m |= (x7 + ones * (128 - 'A')) & ~(x7 + ones * (127 - 'Z'));
+    m |= (x7 + ones * (128 - 'a')) & ~(x7 + ones * (127 - 'z'));
+    unsigned long t = x ^ (ones * '_');
+    m |= ~(((t & ~highs) + ~highs) | t);
+    return ~(m & ~x) & highs;
+  }
+  case SCAN_BLANK: {
+    // Neither ' ' nor '\t'
+    unsigned long t1 = x ^ (ones * ' ');
+    unsigned long t2 = x ^ (ones * '\t');
+    return (((t1 & ~highs) + ~highs) | t1) &
+           (((t2 & ~highs) + ~highs) | t2) & highs;
+  }
+  case SCAN_EOL: {
+    // '\n' or '\0'
+    unsigned long t = x ^ (ones * '\n');
+    return ~((((t & ~highs) + ~highs) | t) & ((x7 + ~highs) | x)) & highs;
+  }
+  case SCAN_STR: {
+    // '"', '\\' or '\0'
+    unsigned long t1 = x ^ (ones * '"');
+    unsigned long t2 = x ^ (ones * '\\');
+    return ~((((t1 & ~highs) + ~highs) | t1) &
+             (((t2 & ~highs) + ~highs) | t2) & ((x7 + ~highs) | x)) & highs;
+  }
+  }
+  return 0;
+}
+
+// Returns the first byte at or after `p` at which a scan of a given
+// kind stops.
+static char *scan(char *p, ScanKind kind) {
+  // Read the word containing `p` and ignore the bytes before `p`.
+  long off = (long)p & 7;
+  unsigned long *w = (unsigned long *)(p - off);
+  unsigned long mask = stop_bytes(kind, *w) & (~0UL << (off * 8));
+
+  while (!mask)
+    mask = stop_bytes(kind, *++w);
+
+  // Bytes are in little-endian order. Isolate the lowest byte in
+  // the mask, 1 << (8 * i), and multiply to move i to the top byte.
+  unsigned long low = (mask & -mask) >> 7;
+  return (char *)w + ((low * 0x0001020304050607) >> 56);
+}
+
 static bool startswith(char *p, char *q) {
   return strncmp(p, q, strlen(q)) == 0;
 }
@@ -128,25 +355,17 @@ static int from_hex(char c) {
   return c - 'A' + 10;
 }
 
-static bool is_keyword(Token *tok) {
-  static char *kw[] = {
-    "return", "if", "else", "for", "while", "int", "sizeof", "char",
-    "struct", "union", "short", "long", "void", "typedef", "_Bool",
-    "enum", "static", "break", "continue", "goto", "switch", "case",
-    "default", "extern", "alignof", "_Alignas", "do", "signed",
-    "unsigned", "const", "volatile",
-  };
-
-  for (int i = 0; i < sizeof(kw) / sizeof(*kw); i++)
-    if (equal(tok, kw[i]))
-      return true;
-  return false;
-}
-
 void convert_keywords(Token *tok) {
-  for (Token *t = tok; t->kind != TK_EOF; t = t->next)
-    if (t->kind == TK_IDENT && is_keyword(t))
+  timer_start(PH_KEYWORDS);
+  long n = 0;
+  for (Token *t = tok; t->kind != TK_EOF; t = t->next) {
+    if (t->kind == TK_IDENT && KW_RETURN <= t->id && t->id <= KW_VOLATILE)
       t->kind = TK_RESERVED;
+    n++;
+  }
+  timer_count(PH_PREPROCESS, n);
+  timer_count(PH_KEYWORDS, n);
+  timer_stop();
 }
 
 static char *read_escaped_char(char *result, char *p) {
@@ -193,20 +412,44 @@ static char *read_escaped_char(char *result, char *p) {
 static Token *read_string_leteral(Token *cur, char *start) {
   char *p = start + 1;
   char *end = p;
+  bool has_escape = false;
 
   // Find the closing double-quote.
-  for (; *end != '"'; end++) {
-    if (*end == '\0')
-      error_at(start, "unclosed string literal");
-    if (*end == '\\')
-      end++;
+  if (fast_lexer) {
+    for (end = scan(end, SCAN_STR); *end != '"'; end = scan(end, SCAN_STR)) {
+      if (*end == '\0')
+        error_at(start, "unclosed string literal");
+      has_escape = true;
+      end += 2;
+    }
+  } else {
+    for (; *end != '"'; end++) {
+      if (*end == '\0')
+        error_at(start, "unclosed string literal");
+      if (*end == '\\') {
+        has_escape = true;
+        end++;
+      }
+    }
+  }
+
+  Token *tok = new_token(TK_STR, cur, start, end - start + 1);
+  tok->lit = alloc_obj(AK_TOKEN, sizeof(Literal));
+
+  // Most string literals have no escape sequences. Their contents
+  // are the same as in the source, so we don't copy them.
+  if (!has_escape) {
+    tok->lit->contents = p;
+    tok->lit->cont_len = end - p;
+    return tok;
   }
 
-  // Allocate a buffer that is large enough to hold the entire string.
-  char *buf = malloc(end - p + 1);
+  // Decode escape sequences. The result is never longer than the
+  // literal in the source.
+  char *buf = alloc_obj(AK_STRING, end - p + 1);
   int len = 0;
 
-  while (*p != '"') {
+  while (p < end) {
     if (*p == '\\') {
       char c;
       p = read_escaped_char(&c, p + 1);
@@ -216,11 +459,8 @@ static Token *read_string_leteral(Token *cur, char *start) {
     }
   }
 
-  buf[len++] = '\0';
-
-  Token *tok = new_token(TK_STR, cur, start, p - start + 1);
-  tok->contents = buf;
-  tok->cont_len = len;
+  tok->lit->contents = buf;
+  tok->lit->cont_len = len;
   return tok;
 }
 
@@ -240,7 +480,8 @@ static Token *read_char_literal(Token *cur, char *start) {
   p++;
 
   Token *tok = new_token(TK_NUM, cur, start, p - start);
-  tok->val = c;
+  tok->lit = alloc_obj(AK_TOKEN, sizeof(Literal));
+  tok->lit->val = c;
   return tok;
 }
 
@@ -291,64 +532,102 @@ static Token *read_int_literal(Token *cur, char *start) {
     error_at(p, "invalid digit");
 
   Token *tok = new_token(TK_NUM, cur, start, p - start);
-  tok->val = val;
-  tok->ty = ty;
+  tok->lit = alloc_obj(AK_TOKEN, sizeof(Literal));
+  tok->lit->val = val;
+  tok->lit->ty = ty;
   return tok;
 }
 
-// Initialize token position info for all tokens.
-static void add_line_info(Token *tok) {
-  char *p = current_input;
-  int lineno = 1;
-  bool at_bol = true;
-  bool has_space = false;
+// Records that a new line begins at `p`.
+static void add_line(File *file, char *p) {
+  if (file->nr_lines == file->lines_cap) {
+    file->lines_cap = file->lines_cap ? file->lines_cap * 2 : 16;
+    file->lines = realloc(file->lines, sizeof(int) * file->lines_cap);
+  }
+  file->lines[file->nr_lines++] = p - file->contents;
+}
 
-  do {
-    if (p == tok->loc) {
-      tok->lineno = lineno;
-      tok->at_bol = at_bol;
-      tok->has_space = has_space;
-      tok = tok->next;
-    }
+// Updates the position info for a newline character at `p`.
+static void new_line(Lexer *lx, char *p) {
+  add_line(lx->file, p + 1);
+  lx->lineno++;
+  lx->at_bol = true;
+}
+
+// Same as skip_chars(), but finds newlines a word at a time and
+// looks only at the characters following the last one, as the
+// characters before it don't affect the flags.
+static void skip_chars_fast(Lexer *lx, char *end) {
+  char *p = lx->p;
+  for (char *q = scan(p, SCAN_EOL); q < end; q = scan(p, SCAN_EOL)) {
+    new_line(lx, q);
+    p = q + 1;
+  }
+
+  char *q = end;
+  while (p < q && isspace(q[-1]))
+    q--;
+
+  if (p < q) {
+    lx->at_bol = false;
+    lx->has_space = (q < end);
+  } else if (p < end) {
+    lx->has_space = true;
+  }
+  lx->p = end;
+}
+
+// Updates the position info for characters that don't form a
+// token, i.e. whitespace and comments, up to `end`.
+static void skip_chars(Lexer *lx, char *end) {
+  if (fast_lexer) {
+    skip_chars_fast(lx, end);
+    return;
+  }
 
-    if (*p == '\n'){
-      lineno++;
-      at_bol = true;
-    } else if (isspace(*p)) {
-      has_space = true;
+  for (; lx->p < end; lx->p++) {
+    if (*lx->p == '\n') {
+      new_line(lx, lx->p);
+    } else if (isspace(*lx->p)) {
+      lx->has_space = true;
     } else {
-      at_bol = false;
-      has_space = false;
+      lx->at_bol = false;
+      lx->has_space = false;
     }
-  } while (*p++);
+  }
 }
 
-// Tokenize a given string and returns new tokens.
-Token *tokenize(char *filename, int file_no, char *p) {
-  current_filename = filename;
-  current_input = p;
+// Reads a token and returns it as the next token of `cur`. Returns
+// NULL at the end of input.
+static Token *read_token(Lexer *lx, Token *cur) {
+  char *p = lx->p;
 
-  Token head = {};
-  Token *cur = &head;
-
-  while (*p) {
+  for (;;) {
     // Skip newline character.
     if (*p == '\n') {
+      new_line(lx, p);
       p++;
       continue;
     }
 
     // Skip whitespace characters.
     if (isspace(*p)) {
-      p++;
+      lx->has_space = true;
+      p = fast_lexer ? scan(p + 1, SCAN_BLANK) : p + 1;
       continue;
     }
 
     // Skip line comments.
     if (startswith(p, "//")) {
-      p += 2;
-      while (*p != '\n')
-        p++;
+      lx->p = p;
+      if (fast_lexer) {
+        p = scan(p + 2, SCAN_EOL);
+      } else {
+        p += 2;
+        while (*p && *p != '\n')
+          p++;
+      }
+      skip_chars(lx, p);
       continue;
     }
 
@@ -357,77 +636,216 @@ Token *tokenize(char *filename, int file_no, char *p) {
       char *q = strstr(p + 2, "*/");
       if (!q)
         error_at(p, "unclosed block comment.");
+      lx->p = p;
+      skip_chars(lx, q + 2);
       p = q + 2;
       continue;
     }
 
-    // String literal
-    if (*p == '"') {
-      cur = read_string_leteral(cur, p);
-      p += cur->len;
-      continue;
-    }
+    break;
+  }
 
-    // Character literal
-    if (*p == '\'') {
-      cur = read_char_literal(cur, p);
-      p += cur->len;
-      continue;
-    }
+  lx->p = p;
+  if (!*p)
+    return NULL;
 
+  if (*p == '"') {
+    // String literal
+    cur = read_string_leteral(cur, p);
+  } else if (*p == '\'') {
+    // Character literal
+    cur = read_char_literal(cur, p);
+  } else if (is_alpha(*p)) {
     // Identifier
-    if (is_alpha(*p)) {
-      char *q = p++;
-      while (is_alnum(*p))
-        p++;
-      cur = new_token(TK_IDENT, cur, q, p - q);
-      continue;
-    }
+    char *q = p + 1;
+    if (fast_lexer)
+      q = scan(q, SCAN_IDENT);
+    else
+      while (is_alnum(*q))
+        q++;
+    cur = new_token(TK_IDENT, cur, p, q - p);
+    cur->id = (long)hashmap_get2(&word_ids, p, q - p);
+    cur->name = intern(p, q - p);
+  } else if (ispunct(*p)) {
+    // Punctuators
+    TokenId *ids = punct_ids[(unsigned char)*p];
+    for (; *ids; ids++)
+      if (startswith(p, token_names[*ids]))
+        break;
+    int len = *ids ? strlen(token_names[*ids]) : 1;
+    cur = new_token(TK_RESERVED, cur, p, len);
+    cur->id = *ids;
+  } else if (isdigit(*p)) {
+    // Integer literal
+    cur = read_int_literal(cur, p);
+  } else {
+    error_at(p, "invalid token");
+  }
 
-    // Three-letter punctuators
-    if (startswith(p, "<<=") || startswith(p, ">>=") ||
-        startswith(p, "...")) {
-      cur = new_token(TK_RESERVED, cur, p, 3);
-      p += 3;
-      continue;
+  cur->lineno = lx->lineno;
+  cur->at_bol = lx->at_bol;
+  cur->has_space = lx->has_space;
+  lx->at_bol = false;
+  lx->has_space = false;
+  lx->p = p + cur->len;
+
+  // A string literal may contain newlines.
+  if (cur->kind == TK_STR) {
+    for (char *q = p; q < lx->p; q++) {
+      if (*q == '\n') {
+        add_line(lx->file, q + 1);
+        lx->lineno++;
+      }
     }
+  }
+  return cur;
+}
 
-    // Two-letter punctuators
-    if (startswith(p, "==") || startswith(p, "!=") ||
-        startswith(p, "<=") || startswith(p, ">=") ||
-        startswith(p, "->") || startswith(p, "+=") ||
-        startswith(p, "-=") || startswith(p, "*=") ||
-        startswith(p, "/=") || startswith(p, "++") ||
-        startswith(p, "--") || startswith(p, "%=") ||
-        startswith(p, "&=") || startswith(p, "|=") ||
-        startswith(p, "^=") || startswith(p, "&&") ||
-        startswith(p, "||") || startswith(p, "<<") ||
-        startswith(p, ">>") || startswith(p, "##")) {
-      cur = new_token(TK_RESERVED, cur, p, 2);
-      p += 2;
-      continue;
-    }
+// Copies the next token of `lx->src`. Returns NULL at the end, where
+// the lexer takes over the position of the EOF token.
+static Token *copy_src_token(Lexer *lx, Token *cur) {
+  Token *src = lx->src;
+  if (src->kind == TK_EOF) {
+    lx->p = src->loc;
+    lx->lineno = src->lineno;
+    lx->at_bol = src->at_bol;
+    lx->has_space = src->has_space;
+    return NULL;
+  }
 
-    // Single-letter punctuators
-    if (ispunct(*p)) {
-      cur = new_token(TK_RESERVED, cur, p++, 1);
-      continue;
-    }
+  Token *tok = new_token(src->kind, cur, src->loc, src->len);
+  *tok = *src;
+  tok->next = NULL;
+  tok->file = lx->file;
+  tok->is_raw = true;
+  tok->is_shared = false;
+  lx->src = src->next;
+  return tok;
+}
 
-    // Integer literal
-    if (isdigit(*p)) {
-      cur = read_int_literal(cur, p);
-      p += cur->len;
-      continue;
+// Reads up to `n` more tokens from a given lexer. At the end of
+// input, the last token is followed by an EOF token, or by
+// `lx->cont` if it is set.
+static void lex(Lexer *lx, int n) {
+  timer_start(PH_TOKENIZE);
+  current_file = lx->file;
+  current_lazy = lx->lazy;
+
+  Token *cur = lx->last;
+  long cnt = 0;
+  for (; cnt < n; cnt++) {
+    Token *tok = lx->src ? copy_src_token(lx, cur) : read_token(lx, cur);
+    if (!tok)
+      break;
+    cur = tok;
+  }
+  lx->last = cur;
+  timer_count(PH_TOKENIZE, cnt);
+
+  if (cnt == n) {
+    timer_stop();
+    return;
+  }
+
+  if (lx->cont) {
+    cur->next = lx->cont;
+  } else {
+    Token *eof = new_token(TK_EOF, cur, lx->p, 0);
+    eof->lineno = lx->lineno;
+    eof->at_bol = lx->at_bol;
+    eof->has_space = lx->has_space;
+    lx->last = eof;
+  }
+  timer_count_lines(lx->lineno - 1);
+
+  // This lexer is done.
+  for (Lexer **lp = &lexers; *lp; lp = &(*lp)->next) {
+    if (*lp == lx) {
+      *lp = lx->next;
+      break;
     }
+  }
+  timer_stop();
+}
 
-    error_at(p, "invalid token");
+File *new_file(char *name, int file_no, char *contents) {
+  File *file = alloc_obj(AK_FILE, sizeof(File));
+  file->name = name;
+  file->file_no = file_no;
+  file->contents = contents;
+  return file;
+}
+
+static Lexer *new_lexer(char *filename, int file_no, char *p) {
+  if (!word_ids.capacity)
+    init_token_ids();
+
+  Lexer *lx = alloc_obj(AK_FILE, sizeof(Lexer));
+  lx->file = new_file(filename, file_no, p);
+  lx->p = p;
+  lx->lineno = 1;
+  lx->at_bol = true;
+  add_line(lx->file, p);
+  return lx;
+}
+
+// Returns the token following `tok`. If `tok` is the last token
+// read so far from a lazily tokenized file, more tokens are read.
+Token *next_token(Token *tok) {
+  if (tok->next)
+    return tok->next;
+
+  for (Lexer *lx = lexers; lx; lx = lx->next) {
+    if (lx->last == tok) {
+      lex(lx, LEX_BATCH);
+      break;
+    }
   }
+  return tok->next;
+}
+
+// Starts tokenizing a given string lazily and returns the first
+// token. The last token is followed by `cont` if it's not NULL,
+// or by an EOF token otherwise.
+Token *tokenize_lazy(char *filename, int file_no, char *p, Token *cont) {
+  Lexer *lx = new_lexer(filename, file_no, p);
+  lx->lazy = true;
+  lx->cont = cont;
+  lx->next = lexers;
+  lexers = lx;
+
+  Token head = {};
+  lx->last = &head;
+  lex(lx, LEX_BATCH);
+  return head.next;
+}
 
-  new_token(TK_EOF, cur, p, 0);
+// Starts reading a copy of tokens returned by tokenize() earlier,
+// just like tokenize_lazy() would read the same file again.
+Token *tokenize_cached(Token *src, char *filename, int file_no,
+                       Token *cont) {
+  Lexer *lx = alloc_obj(AK_FILE, sizeof(Lexer));
+  lx->file = alloc_obj(AK_FILE, sizeof(File));
+  *lx->file = *src->file;
+  lx->file->name = filename;
+  lx->file->file_no = file_no;
+  lx->src = src;
+  lx->lazy = true;
+  lx->cont = cont;
+  lx->next = lexers;
+  lexers = lx;
 
-  for (Token *t = head.next; t; t = t->next)
-    t->file_no = file_no;
-  add_line_info(head.next);
+  Token head = {};
+  lx->last = &head;
+  lex(lx, LEX_BATCH);
+  return head.next;
+}
+
+// Tokenize a given string and returns new tokens.
+Token *tokenize(char *filename, int file_no, char *p) {
+  Lexer *lx = new_lexer(filename, file_no, p);
+  Token head = {};
+  lx->last = &head;
+  lex(lx, INT_MAX);
   return head.next;
-}
\ No newline at end of file
+}
@@ -14,7 +14,7 @@ Type *ty_uint = &(Type){TY_INT, 4, 4, true};
 Type *ty_ulong = &(Type){TY_LONG, 8, 8, true};
 
 static Type *new_type(TypeKind kind, int size, int align) {
-  Type *ty = malloc(sizeof(Type));
+  Type *ty = alloc_obj(AK_TYPE, sizeof(Type));
   ty->kind = kind;
   ty->size = size;
   ty->align = align;
@@ -28,7 +28,7 @@ bool is_integer(Type *ty) {
 }
 
 Type *copy_type(Type *ty) {
-  Type *ret = malloc(sizeof(Type));
+  Type *ret = alloc_obj(AK_TYPE, sizeof(Type));
   *ret = *ty;
   return ret;
 }
@@ -44,7 +44,7 @@ Type *pointer_to(Type *base) {
 }
 
 Type *func_type(Type *return_ty) {
-  Type *ty = calloc(1, sizeof(Type));
+  Type *ty = alloc_obj(AK_TYPE, sizeof(Type));
   ty->kind = TY_FUNC;
   ty->return_ty = return_ty;
   return ty;